@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/common/hash_table/string_hash_map.h"
+
+namespace doris::vectorized {
+
+// emplace the keys of 64K rows into a new hash table as the aggregation does, and the mapped
+// value is the first row of the key
+template <typename HashMethodType, typename... Args>
+static void run_agg_hash_map_benchmark(benchmark::State& state, const Columns& columns,
+                                       Args... method_args) {
+    using State = typename HashMethodType::State;
+    ColumnRawPtrs key_columns;
+    for (const auto& column : columns) {
+        key_columns.push_back(column.get());
+    }
+    const size_t rows = key_columns[0]->size();
+
+    for (auto _ : state) {
+        HashMethodType method(method_args...);
+        State hash_state(key_columns);
+        method.init_serialized_keys(key_columns, rows);
+        for (size_t i = 0; i < rows; ++i) {
+            // the keys are in the key columns, which outlive the hash table
+            auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, i); };
+            auto creator_for_null_key = [&](auto& mapped) { mapped = i; };
+            benchmark::DoNotOptimize(method.lazy_emplace(hash_state, i, creator,
+                                                         creator_for_null_key));
+        }
+        benchmark::DoNotOptimize(method.hash_table->size());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// args of all: the cardinality, the skew percent
+
+static void BM_AggOneNumber(benchmark::State& state) {
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(1 << 16, uint64_t(state.range(0)), int(state.range(1)));
+    run_agg_hash_map_benchmark<
+            MethodOneNumber<UInt64, PHHashMap<UInt64, IColumn::ColumnIndex, HashCRC32<UInt64>>>>(
+            state, {generator.int64_column(keys)});
+}
+
+static void BM_AggKeysFixed(benchmark::State& state) {
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(1 << 16, uint64_t(state.range(0)), int(state.range(1)));
+    run_agg_hash_map_benchmark<
+            MethodKeysFixed<PHHashMap<UInt128, IColumn::ColumnIndex, HashCRC32<UInt128>>>>(
+            state, {generator.int64_column(keys), generator.int64_column(keys)},
+            Sizes {sizeof(Int64), sizeof(Int64)});
+}
+
+static void BM_AggString(benchmark::State& state) {
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(1 << 16, uint64_t(state.range(0)), int(state.range(1)));
+    run_agg_hash_map_benchmark<MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>>>(
+            state, {generator.string_column(keys, 16)});
+}
+
+static void BM_AggSerialized(benchmark::State& state) {
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(1 << 16, uint64_t(state.range(0)), int(state.range(1)));
+    run_agg_hash_map_benchmark<MethodSerialized<StringHashMap<IColumn::ColumnIndex>>>(
+            state, {generator.int64_column(keys), generator.string_column(keys, 16)});
+}
+
+} // namespace doris::vectorized
@@ -100,4 +100,71 @@ static void BM_BitPackOptimized(benchmark::State& state) {
 
     state.SetBytesProcessed(int64_t(state.iterations()) * size);
 }
-} // namespace doris
\ No newline at end of file
+
+// original bit_unpack function
+template <typename T>
+void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
+    unsigned char in_mask = 0x80;
+    int bit_index = 0;
+    while (in_num > 0) {
+        *output = 0;
+        for (int i = 0; i < bit_width; i++) {
+            if (bit_index > 7) {
+                input++;
+                bit_index = 0;
+            }
+            *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index)))
+                       << (bit_width - i - 1);
+            bit_index++;
+        }
+        output++;
+        in_num--;
+    }
+}
+
+static std::vector<uint8_t> packed_int64_data(int w, int n) {
+    std::default_random_engine e;
+    std::uniform_int_distribution<int64_t> u;
+    std::vector<int64_t> test_data(n);
+    for (int i = 0; i < n; i++) {
+        test_data[i] = int64_t(uint64_t(u(e)) & ((uint64_t(1) << w) - 1));
+    }
+    std::vector<uint8_t> packed((n * w + 7) / 8);
+    bit_pack(test_data.data(), n, w, packed.data());
+    return packed;
+}
+
+static void BM_BitUnpack(benchmark::State& state) {
+    int w = state.range(0);
+    int n = 255;
+    auto packed = packed_int64_data(w, n);
+    std::vector<int64_t> output(n);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(packed.data());
+        benchmark::DoNotOptimize(output.data());
+        bit_unpack(packed.data(), n, w, output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * packed.size());
+}
+
+static void BM_BitUnpackOptimized(benchmark::State& state) {
+    int w = state.range(0);
+    int n = 255;
+    auto packed = packed_int64_data(w, n);
+    std::vector<int64_t> output(n);
+
+    ForDecoder<int64_t> forDecoder(nullptr, 0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(packed.data());
+        benchmark::DoNotOptimize(output.data());
+        forDecoder.bit_unpack(packed.data(), n, w, output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * packed.size());
+}
+} // namespace doris
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "exprs/block_bloom_filter.hpp"
+
+namespace doris {
+
+// a filter of 2^log_space_bytes bytes with 1/8 of the probed keys inserted
+static void init_bloom_filter_benchmark(int log_space_bytes, BlockBloomFilter& filter,
+                                        std::vector<uint32_t>& hashes) {
+    std::mt19937 rng(42);
+    hashes.resize(1 << 20);
+    for (auto& hash : hashes) {
+        hash = uint32_t(rng());
+    }
+    static_cast<void>(filter.init(log_space_bytes, 0));
+    for (size_t i = 0; i < hashes.size(); i += 8) {
+        filter.insert(hashes[i]);
+    }
+}
+
+static void BM_BloomFilterFind(benchmark::State& state) {
+    BlockBloomFilter filter;
+    std::vector<uint32_t> hashes;
+    init_bloom_filter_benchmark(int(state.range(0)), filter, hashes);
+    std::vector<uint8_t> results(hashes.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            results[i] = filter.find(hashes[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+
+static void BM_BloomFilterFindBatch(benchmark::State& state) {
+    BlockBloomFilter filter;
+    std::vector<uint32_t> hashes;
+    init_bloom_filter_benchmark(int(state.range(0)), filter, hashes);
+    std::vector<uint8_t> results(hashes.size());
+
+    for (auto _ : state) {
+        filter.find_batch(hashes.data(), hashes.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+
+} // namespace doris
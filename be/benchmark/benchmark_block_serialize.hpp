@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include "agent/be_exec_version_manager.h"
+#include "benchmark_data_gen.hpp"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// a block of 4096 rows of a bigint, a nullable bigint and a string of 32 bytes,
+// args: the cardinality and the null percent of the nullable column
+static Block make_benchmark_block(uint64_t cardinality, int null_percent) {
+    constexpr size_t rows = 4096;
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(rows, cardinality, 0);
+    Block block;
+    block.insert({generator.int64_column(keys), std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({generator.nullable(generator.int64_column(keys), null_percent),
+                  make_nullable(std::make_shared<DataTypeInt64>()), "v"});
+    block.insert({generator.string_column(keys, 32), std::make_shared<DataTypeString>(), "s"});
+    return block;
+}
+
+// the serialization of the blocks sent by the exchange, args: the cardinality, the null percent
+static void BM_BlockSerialize(benchmark::State& state) {
+    Block block = make_benchmark_block(uint64_t(state.range(0)), int(state.range(1)));
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+
+    for (auto _ : state) {
+        PBlock pblock;
+        auto st = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                  &uncompressed_bytes, &compressed_bytes,
+                                  segment_v2::CompressionTypePB::LZ4);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations() * uncompressed_bytes));
+    state.counters["compress_ratio"] =
+            compressed_bytes == 0 ? 0 : double(uncompressed_bytes) / double(compressed_bytes);
+}
+
+} // namespace doris::vectorized
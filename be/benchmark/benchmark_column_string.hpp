@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/columns/column_string.h"
+
+namespace doris::vectorized {
+
+// filter 4096 strings of 32 bytes, arg: the selectivity in percent
+static void BM_ColumnStringFilter(benchmark::State& state) {
+    constexpr size_t rows = 4096;
+    BenchmarkDataGenerator generator;
+    auto column = generator.string_column(generator.keys(rows, rows, 0), 32);
+    auto filter = generator.filter(rows, int(state.range(0)));
+
+    for (auto _ : state) {
+        auto result = column->filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// gather 4096 strings of 32 bytes by random indices, as the probe side output of a join,
+// arg: the cardinality of the indices
+static void BM_ColumnStringGather(benchmark::State& state) {
+    constexpr size_t rows = 4096;
+    BenchmarkDataGenerator generator;
+    auto column = generator.string_column(generator.keys(rows, rows, 0), 32);
+    auto keys = generator.keys(rows, uint64_t(state.range(0)), 0);
+    std::vector<uint32_t> indices(keys.begin(), keys.end());
+
+    for (auto _ : state) {
+        auto result = ColumnString::create();
+        result->insert_indices_from(*column, indices.data(), indices.data() + indices.size());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+} // namespace doris::vectorized
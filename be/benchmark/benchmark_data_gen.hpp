@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+// The synthetic data of the operator benchmarks. The seed is fixed so the runs are comparable.
+//
+// - cardinality: the number of the distinct keys
+// - skew_percent: the percent of the rows whose key is one of the 1% hottest keys
+// - null_percent: the percent of the null rows
+class BenchmarkDataGenerator {
+public:
+    BenchmarkDataGenerator() : _rng(42) {}
+
+    std::vector<uint64_t> keys(size_t rows, uint64_t cardinality, int skew_percent) {
+        std::vector<uint64_t> keys(rows);
+        uint64_t hot_keys = std::max<uint64_t>(1, cardinality / 100);
+        std::uniform_int_distribution<uint64_t> all(0, cardinality - 1);
+        std::uniform_int_distribution<uint64_t> hot(0, hot_keys - 1);
+        std::uniform_int_distribution<int> percent(0, 99);
+        for (auto& key : keys) {
+            key = percent(_rng) < skew_percent ? hot(_rng) : all(_rng);
+        }
+        return keys;
+    }
+
+    MutableColumnPtr int64_column(const std::vector<uint64_t>& keys) {
+        auto column = ColumnInt64::create();
+        for (auto key : keys) {
+            column->insert_value(static_cast<Int64>(key));
+        }
+        return column;
+    }
+
+    // the strings of `length` bytes, one per key
+    MutableColumnPtr string_column(const std::vector<uint64_t>& keys, size_t length) {
+        auto column = ColumnString::create();
+        std::string value;
+        for (auto key : keys) {
+            value = std::to_string(key);
+            value.resize(std::max(length, value.size()), 'x');
+            column->insert_data(value.data(), value.size());
+        }
+        return column;
+    }
+
+    MutableColumnPtr nullable(MutableColumnPtr nested, int null_percent) {
+        auto null_map = ColumnUInt8::create(nested->size(), 0);
+        std::uniform_int_distribution<int> percent(0, 99);
+        for (auto& is_null : null_map->get_data()) {
+            is_null = percent(_rng) < null_percent;
+        }
+        return ColumnNullable::create(std::move(nested), std::move(null_map));
+    }
+
+    // the filter of `selectivity_percent` rows
+    IColumn::Filter filter(size_t rows, int selectivity_percent) {
+        IColumn::Filter filter(rows);
+        std::uniform_int_distribution<int> percent(0, 99);
+        for (auto& selected : filter) {
+            selected = percent(_rng) < selectivity_percent;
+        }
+        return filter;
+    }
+
+private:
+    std::mt19937_64 _rng;
+};
+
+} // namespace doris::vectorized
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/common/hash_table/join_hash_table.h"
+
+namespace doris {
+
+using BenchmarkJoinHashTable = JoinHashTable<uint64_t>;
+
+// build the hash table of an inner join, row 0 is the mocked row as the hash join does
+static void build_join_hash_table(BenchmarkJoinHashTable& table, const std::vector<uint64_t>& keys,
+                                  int batch_size) {
+    auto rows = uint32_t(keys.size());
+    table.prepare_build<TJoinOp::INNER_JOIN>(rows, batch_size, false);
+    uint32_t bucket_size = table.get_bucket_size();
+    std::vector<uint32_t> bucket_nums(rows);
+    for (uint32_t i = 0; i < rows; ++i) {
+        bucket_nums[i] = uint32_t(table.hash(keys[i]) & (bucket_size - 1));
+    }
+    table.build(keys.data(), bucket_nums.data(), rows, false);
+}
+
+// args: the build rows, the build cardinality
+static void BM_JoinHashTableBuild(benchmark::State& state) {
+    vectorized::BenchmarkDataGenerator generator;
+    auto keys = generator.keys(size_t(state.range(0)), uint64_t(state.range(1)), 0);
+
+    for (auto _ : state) {
+        BenchmarkJoinHashTable table;
+        build_join_hash_table(table, keys, 4096);
+        benchmark::DoNotOptimize(table.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// probe 4096 rows, args: the build rows (unique keys), the percent of the matched probe rows
+static void BM_JoinHashTableProbe(benchmark::State& state) {
+    constexpr uint32_t probe_rows = 4096;
+    const auto build_rows = uint64_t(state.range(0));
+    vectorized::BenchmarkDataGenerator generator;
+    std::vector<uint64_t> build_keys(build_rows);
+    for (uint64_t i = 0; i < build_rows; ++i) {
+        build_keys[i] = i;
+    }
+    BenchmarkJoinHashTable table;
+    build_join_hash_table(table, build_keys, probe_rows);
+    uint32_t bucket_size = table.get_bucket_size();
+
+    // the keys out of the build keys are not matched
+    auto probe_cardinality = build_rows * 100 / uint64_t(std::max<int64_t>(1, state.range(1)));
+    auto probe_keys = generator.keys(probe_rows, probe_cardinality, 0);
+    DorisVector<uint32_t> bucket_nums(probe_rows);
+    std::vector<uint32_t> probe_idxs(probe_rows + 1);
+    std::vector<uint32_t> build_idxs(probe_rows + 1);
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < probe_rows; ++i) {
+            bucket_nums[i] = uint32_t(table.hash(probe_keys[i]) & (bucket_size - 1));
+        }
+        table.pre_build_idxs(bucket_nums);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        while (probe_idx < int(probe_rows)) {
+            auto [next_probe_idx, next_build_idx, matched_cnt] =
+                    table.find_batch<TJoinOp::INNER_JOIN>(
+                            probe_keys.data(), bucket_nums.data(), probe_idx, build_idx,
+                            probe_rows, probe_idxs.data(), probe_visited, build_idxs.data(),
+                            nullptr, false, false, false);
+            benchmark::DoNotOptimize(matched_cnt);
+            probe_idx = next_probe_idx;
+            build_idx = next_build_idx;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * probe_rows);
+}
+
+} // namespace doris
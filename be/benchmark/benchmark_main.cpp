@@ -19,7 +19,16 @@
 
 #include <string>
 
+#include "benchmark_agg_hash_map.hpp"
 #include "benchmark_bit_pack.cpp"
+#include "benchmark_block_bloom_filter.hpp"
+#include "benchmark_block_serialize.hpp"
+#include "benchmark_column_string.hpp"
+#include "benchmark_join_hash_table.hpp"
+#include "benchmark_mem_counter.hpp"
+#include "benchmark_rle_decoding.hpp"
+#include "benchmark_sort_block.hpp"
+#include "benchmark_tablet_lookup.hpp"
 #include "vec/columns/column_string.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
@@ -49,6 +58,34 @@ static void Example1(benchmark::State& state) {
 BENCHMARK(Example1);
 BENCHMARK(BM_BitPack)->DenseRange(1, 127)->Unit(benchmark::kNanosecond);
 BENCHMARK(BM_BitPackOptimized)->DenseRange(1, 127)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_BitUnpack)->DenseRange(1, 63)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_BitUnpackOptimized)->DenseRange(1, 63)->Unit(benchmark::kNanosecond);
+// filters of 16KB (fits in L1), 1MB (L2) and 64MB (memory)
+BENCHMARK(BM_BloomFilterFind)->Arg(14)->Arg(20)->Arg(26);
+BENCHMARK(BM_BloomFilterFindBatch)->Arg(14)->Arg(20)->Arg(26);
+// bit widths of the levels, with the literal runs and with the runs of 16 values
+BENCHMARK(BM_RleDecodeLevels)->ArgsProduct({{1, 2, 3}, {1, 16}});
+BENCHMARK(BM_RleDecodeIndices)->DenseRange(1, 20);
+BENCHMARK(BM_MemCounterAdd)->ThreadRange(1, 64);
+BENCHMARK(BM_ShardedMemCounterAdd)->ThreadRange(1, 64);
+BENCHMARK(BM_TabletLookupSharedMutex)->ThreadRange(1, 64);
+BENCHMARK(BM_TabletLookupDoublyBuffered)->ThreadRange(1, 64);
+// the operators, on the synthetic data of BenchmarkDataGenerator
+BENCHMARK(BM_JoinHashTableBuild)->ArgsProduct({{1 << 10, 1 << 16, 1 << 22}, {1 << 10, 1 << 22}});
+BENCHMARK(BM_JoinHashTableProbe)->ArgsProduct({{1 << 10, 1 << 16, 1 << 22}, {10, 100}});
+// cardinality, skew percent
+BENCHMARK(BM_AggOneNumber)->ArgsProduct({{16, 1 << 12, 1 << 16}, {0, 90}});
+BENCHMARK(BM_AggKeysFixed)->ArgsProduct({{16, 1 << 12, 1 << 16}, {0, 90}});
+BENCHMARK(BM_AggString)->ArgsProduct({{16, 1 << 12, 1 << 16}, {0, 90}});
+BENCHMARK(BM_AggSerialized)->ArgsProduct({{16, 1 << 12, 1 << 16}, {0, 90}});
+// cardinality, limit of TopN
+BENCHMARK(BM_SortBlock)->ArgsProduct({{16, 1 << 16}, {0, 100}});
+// selectivity percent
+BENCHMARK(BM_ColumnStringFilter)->Arg(1)->Arg(50)->Arg(99);
+// cardinality of the indices
+BENCHMARK(BM_ColumnStringGather)->Arg(16)->Arg(4096);
+// cardinality, null percent
+BENCHMARK(BM_BlockSerialize)->ArgsProduct({{16, 4096}, {0, 50}});
 } // namespace doris::vectorized
 
 BENCHMARK_MAIN();
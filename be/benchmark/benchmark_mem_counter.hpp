@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "runtime/memory/mem_counter.h"
+
+namespace doris {
+
+// the threads of a query flush their untracked memory of 1MB into the same counter
+static void BM_MemCounterAdd(benchmark::State& state) {
+    static MemCounter counter;
+    for (auto _ : state) {
+        counter.add(1 << 20);
+        counter.sub(1 << 20);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+static void BM_ShardedMemCounterAdd(benchmark::State& state) {
+    // shared by the threads of the benchmark
+    static ShardedMemCounter* counter = [] {
+        auto* counter = new ShardedMemCounter();
+        counter->set_fold_bytes(8 << 20);
+        return counter;
+    }();
+    for (auto _ : state) {
+        counter->add(1 << 20);
+        counter->sub(1 << 20);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+} // namespace doris
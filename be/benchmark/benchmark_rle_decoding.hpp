@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/rle_encoding.h"
+
+namespace doris {
+
+// 64K values of 'bit_width' bits, where a value repeats 'run_length' times
+template <typename T>
+static void init_rle_benchmark(int bit_width, int run_length, faststring& buffer,
+                               size_t& num_values) {
+    std::mt19937 rng(42);
+    RleEncoder<T> encoder(&buffer, bit_width);
+    num_values = 1 << 16;
+    T value = 0;
+    for (size_t i = 0; i < num_values; ++i) {
+        if (i % run_length == 0) {
+            value = static_cast<T>(rng() & ((1ULL << bit_width) - 1));
+        }
+        encoder.Put(value);
+    }
+    encoder.Flush();
+}
+
+// definition levels of nested columns, short runs are encoded as literal runs
+static void BM_RleDecodeLevels(benchmark::State& state) {
+    faststring buffer;
+    size_t num_values;
+    init_rle_benchmark<int16_t>(int(state.range(0)), int(state.range(1)), buffer, num_values);
+    std::vector<int16_t> levels(num_values);
+
+    for (auto _ : state) {
+        RleDecoder<int16_t> decoder(buffer.data(), int(buffer.size()), int(state.range(0)));
+        // the column reader reads a batch of 4064 rows at a time
+        for (size_t i = 0; i < num_values; i += 4064) {
+            decoder.get_values(levels.data() + i, std::min<size_t>(4064, num_values - i));
+        }
+        benchmark::DoNotOptimize(levels.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+// dictionary indices
+static void BM_RleDecodeIndices(benchmark::State& state) {
+    faststring buffer;
+    size_t num_values;
+    init_rle_benchmark<uint32_t>(int(state.range(0)), 1, buffer, num_values);
+    std::vector<uint32_t> indices(num_values);
+
+    for (auto _ : state) {
+        RleBatchDecoder<uint32_t> decoder(buffer.data(), int(buffer.size()),
+                                          int(state.range(0)));
+        for (size_t i = 0; i < num_values; i += 4064) {
+            decoder.GetBatch(indices.data() + i,
+                             uint32_t(std::min<size_t>(4064, num_values - i)));
+        }
+        benchmark::DoNotOptimize(indices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+} // namespace doris
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data_gen.hpp"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// sort 64K rows by a bigint and a string of 16 bytes,
+// args: the cardinality of the keys, the limit of TopN (0 means a full sort)
+static void BM_SortBlock(benchmark::State& state) {
+    constexpr size_t rows = 1 << 16;
+    BenchmarkDataGenerator generator;
+    auto keys = generator.keys(rows, uint64_t(state.range(0)), 0);
+    Block block;
+    block.insert({generator.int64_column(keys), std::make_shared<DataTypeInt64>(), "k"});
+    block.insert({generator.string_column(generator.keys(rows, rows, 0), 16),
+                  std::make_shared<DataTypeString>(), "s"});
+    SortDescription description {{0, 1, 1}, {1, 1, 1}};
+
+    for (auto _ : state) {
+        Block sorted = block.clone_empty();
+        sort_block(block, sorted, description, UInt64(state.range(1)));
+        benchmark::DoNotOptimize(sorted);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+} // namespace doris::vectorized
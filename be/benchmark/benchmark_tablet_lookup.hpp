@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+#include <butil/containers/doubly_buffered_data.h>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace doris {
+
+// The lookups of a hot shard of TabletManager from all the threads of the benchmark, with the
+// shard lock, and with the lookup map read without the lock.
+using BenchTabletMap = std::unordered_map<int64_t, std::shared_ptr<int64_t>>;
+constexpr int64_t BENCH_TABLETS_OF_SHARD = 512;
+
+static BenchTabletMap make_bench_tablet_map() {
+    BenchTabletMap tablet_map;
+    for (int64_t tablet_id = 0; tablet_id < BENCH_TABLETS_OF_SHARD; ++tablet_id) {
+        tablet_map[tablet_id] = std::make_shared<int64_t>(tablet_id);
+    }
+    return tablet_map;
+}
+
+static void BM_TabletLookupSharedMutex(benchmark::State& state) {
+    static std::shared_mutex lock;
+    static BenchTabletMap tablet_map = make_bench_tablet_map();
+    int64_t tablet_id = state.thread_index();
+    for (auto _ : state) {
+        std::shared_ptr<int64_t> tablet;
+        {
+            std::shared_lock rdlock(lock);
+            auto it = tablet_map.find(tablet_id++ % BENCH_TABLETS_OF_SHARD);
+            if (it != tablet_map.end()) {
+                tablet = it->second;
+            }
+        }
+        benchmark::DoNotOptimize(tablet);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_TabletLookupDoublyBuffered(benchmark::State& state) {
+    static auto* lookup_map = [] {
+        auto* lookup_map = new butil::DoublyBufferedData<BenchTabletMap>();
+        auto fill = [](BenchTabletMap& tablet_map) {
+            tablet_map = make_bench_tablet_map();
+            return 1;
+        };
+        lookup_map->Modify(fill);
+        return lookup_map;
+    }();
+    int64_t tablet_id = state.thread_index();
+    for (auto _ : state) {
+        std::shared_ptr<int64_t> tablet;
+        {
+            butil::DoublyBufferedData<BenchTabletMap>::ScopedPtr tablet_map;
+            if (lookup_map->Read(&tablet_map) == 0) {
+                auto it = tablet_map->find(tablet_id++ % BENCH_TABLETS_OF_SHARD);
+                if (it != tablet_map->end()) {
+                    tablet = it->second;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(tablet);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace doris
@@ -170,6 +170,33 @@ void finish_task(const TFinishTaskRequest& finish_task_request) {
     }
 }
 
+// Report the finished task and remove its task info in the background, so the worker takes the
+// next task without waiting for the RPC to FE, e.g. when the tablets of a lot of partitions are
+// created or dropped. It's reported synchronously if the report pool is not available.
+void finish_task_async(TFinishTaskRequest finish_task_request) {
+    static ThreadPool* report_pool = []() -> ThreadPool* {
+        std::unique_ptr<ThreadPool> pool;
+        auto st = ThreadPoolBuilder("FinishTaskReport")
+                          .set_min_threads(1)
+                          .set_max_threads(std::max(1, config::finish_task_report_worker_count))
+                          .build(&pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build the finish task report pool: " << st;
+            return nullptr;
+        }
+        // never destroyed, since the reports may be still in flight when the process exits
+        return pool.release();
+    }();
+    auto request = std::make_shared<TFinishTaskRequest>(std::move(finish_task_request));
+    auto report = [request]() {
+        finish_task(*request);
+        remove_task_info(request->task_type, request->signature);
+    };
+    if (report_pool == nullptr || !report_pool->submit_func(report).ok()) {
+        report();
+    }
+}
+
 Status get_tablet_info(StorageEngine& engine, const TTabletId tablet_id,
                        const TSchemaHash schema_hash, TTabletInfo* tablet_info) {
     tablet_info->__set_tablet_id(tablet_id);
@@ -1616,8 +1643,7 @@ void create_tablet_callback(StorageEngine& engine, const TAgentTaskRequest& req)
     finish_task_request.__set_task_type(req.task_type);
     finish_task_request.__set_signature(req.signature);
     finish_task_request.__set_task_status(status.to_thrift());
-    finish_task(finish_task_request);
-    remove_task_info(req.task_type, req.signature);
+    finish_task_async(std::move(finish_task_request));
 }
 
 void drop_tablet_callback(StorageEngine& engine, const TAgentTaskRequest& req) {
@@ -1654,8 +1680,7 @@ void drop_tablet_callback(StorageEngine& engine, const TAgentTaskRequest& req) {
     finish_task_request.__set_signature(req.signature);
     finish_task_request.__set_task_status(status.to_thrift());
 
-    finish_task(finish_task_request);
-    remove_task_info(req.task_type, req.signature);
+    finish_task_async(std::move(finish_task_request));
 }
 
 void drop_tablet_callback(CloudStorageEngine& engine, const TAgentTaskRequest& req) {
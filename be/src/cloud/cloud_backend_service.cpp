@@ -24,6 +24,7 @@
 #include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "cloud/cloud_warm_up_manager.h"
+#include "cloud/config.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
@@ -61,7 +62,19 @@ Status CloudBackendService::create_service(CloudStorageEngine& engine, ExecEnv*
 
 void CloudBackendService::sync_load_for_tablets(TSyncLoadForTabletsResponse&,
                                                 const TSyncLoadForTabletsRequest& request) {
-    auto f = [this, tablet_ids = request.tablet_ids]() {
+    // The tablets are split into a task per thread of the pool, so the tablets of a big load are
+    // synced in parallel before the queries on them arrive.
+    int64_t num_tablets = request.tablet_ids.size();
+    int64_t num_tasks = std::min<int64_t>(num_tablets, config::sync_load_for_tablets_thread);
+    for (int64_t task = 0; task < num_tasks; ++task) {
+        auto begin = request.tablet_ids.begin() + num_tablets * task / num_tasks;
+        auto end = request.tablet_ids.begin() + num_tablets * (task + 1) / num_tasks;
+        _submit_sync_load_for_tablets(std::vector<int64_t>(begin, end));
+    }
+}
+
+void CloudBackendService::_submit_sync_load_for_tablets(std::vector<int64_t> tablet_ids) {
+    auto f = [this, tablet_ids = std::move(tablet_ids)]() {
         std::for_each(tablet_ids.cbegin(), tablet_ids.cend(), [this](int64_t tablet_id) {
             CloudTabletSPtr tablet;
             auto result = _engine.tablet_mgr().get_tablet(tablet_id, true);
@@ -57,6 +57,8 @@ public:
                                 int64_t last_stream_record_time) override;
 
 private:
+    void _submit_sync_load_for_tablets(std::vector<int64_t> tablet_ids);
+
     CloudStorageEngine& _engine;
 };
 
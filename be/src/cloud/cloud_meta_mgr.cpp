@@ -976,12 +976,27 @@ Status CloudMetaMgr::sync_tablet_delete_bitmap(CloudTablet* tablet, int64_t old_
             sync_stats->get_remote_delete_bitmap_bytes += dbm.length();
         }
     }
-    for (int i = 0; i < rowset_ids.size(); i++) {
+    {
+        // The response is ordered by the keys of the delete bitmaps, which are grouped by rowset,
+        // so the rowset ids are parsed once per rowset and the bitmaps are appended to the map
+        // under a single lock instead of a lookup and a copy for each of them.
+        std::lock_guard l(delete_bitmap->lock);
+        auto& bitmaps = delete_bitmap->delete_bitmap;
         RowsetId rst_id;
-        rst_id.init(rowset_ids[i]);
-        delete_bitmap->merge(
-                {rst_id, segment_ids[i], vers[i]},
-                roaring::Roaring::readSafe(delete_bitmaps[i].data(), delete_bitmaps[i].length()));
+        for (int i = 0; i < rowset_ids.size(); i++) {
+            if (i == 0 || rowset_ids[i] != rowset_ids[i - 1]) {
+                rst_id.init(rowset_ids[i]);
+            }
+            DeleteBitmap::BitmapKey key {rst_id, segment_ids[i], vers[i]};
+            auto bitmap = roaring::Roaring::readSafe(delete_bitmaps[i].data(),
+                                                     delete_bitmaps[i].length());
+            auto it = bitmaps.emplace_hint(bitmaps.end(), key, roaring::Roaring());
+            if (it->second.isEmpty()) {
+                it->second = std::move(bitmap);
+            } else {
+                it->second |= bitmap;
+            }
+        }
     }
     int64_t latency = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
     if (latency > 100 * 1000) { // 100ms
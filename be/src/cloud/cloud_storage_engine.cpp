@@ -978,8 +978,13 @@ Status CloudStorageEngine::submit_compaction_task(const CloudTabletSPtr& tablet,
 }
 
 void CloudStorageEngine::_lease_compaction_thread_callback() {
-    while (!_stop_background_threads_latch.wait_for(
-            std::chrono::seconds(config::lease_compaction_interval_seconds))) {
+    // All the jobs are renewed in a round, the jobs prepared during the wait were leased for
+    // 4 intervals by their preparation, so they are renewed in time too
+    auto renew_interval = [] {
+        return config::lease_compaction_interval_seconds *
+               std::clamp(config::lease_compaction_renew_rounds, 1, 3);
+    };
+    while (!_stop_background_threads_latch.wait_for(std::chrono::seconds(renew_interval()))) {
         std::vector<std::shared_ptr<CloudFullCompaction>> full_compactions;
         std::vector<std::shared_ptr<CloudBaseCompaction>> base_compactions;
         std::vector<std::shared_ptr<CloudCumulativeCompaction>> cumu_compactions;
@@ -35,6 +35,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_mgr.h"
+#include "cloud/cloud_warm_up_manager.h"
 #include "common/cast_set.h"
 #include "common/config.h"
 #include "common/logging.h"
@@ -186,6 +187,14 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
     return st;
 }
 
+bool CloudTablet::is_synced_to(int64_t query_version) {
+    if (query_version <= 0 || tablet_state() != TABLET_RUNNING) {
+        return false;
+    }
+    std::shared_lock rlock(_meta_lock);
+    return _max_version >= query_version;
+}
+
 // Sync tablet meta and all rowset meta if not running.
 // This could happen when BE didn't finish schema change job and another BE committed this schema change job.
 // It should be a quite rare situation.
@@ -248,6 +257,12 @@ void CloudTablet::add_rowsets(std::vector<RowsetSharedPtr> to_add, bool version_
     if (to_add.empty()) {
         return;
     }
+#ifndef BE_TEST
+    if (!warmup_delta_data && _engine.cloud_warm_up_manager().is_table_subscribed(table_id())) {
+        // the new rowsets of a subscribed table are warmed up as the ones loaded by other clusters
+        warmup_delta_data = true;
+    }
+#endif
 
     auto add_rowsets_directly = [=, this](std::vector<RowsetSharedPtr>& rowsets) {
         for (auto& rs : rowsets) {
@@ -95,6 +95,9 @@ public:
     // rowsets datum async.
     Status sync_rowsets(const SyncOptions& options = {}, SyncRowsetStats* stats = nullptr);
 
+    // Return true if `sync_rowsets` with `query_version` has nothing to do.
+    bool is_synced_to(int64_t query_version);
+
     // Synchronize the tablet meta from meta service.
     Status sync_meta();
 
@@ -26,11 +26,14 @@
 
 #include "cloud/cloud_tablet_mgr.h"
 #include "common/logging.h"
+#include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_downloader.h"
+#include "io/cache/file_cache_peers.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
 #include "olap/tablet.h"
 #include "runtime/exec_env.h"
+#include "util/string_util.h"
 #include "util/time.h"
 
 namespace doris {
@@ -39,6 +42,7 @@ bvar::Adder<uint64_t> file_cache_warm_up_failed_task_num("file_cache_warm_up", "
 
 CloudWarmUpManager::CloudWarmUpManager(CloudStorageEngine& engine) : _engine(engine) {
     _download_thread = std::thread(&CloudWarmUpManager::handle_jobs, this);
+    _sync_thread = std::thread(&CloudWarmUpManager::sync_subscribed_tablets, this);
 }
 
 CloudWarmUpManager::~CloudWarmUpManager() {
@@ -50,6 +54,62 @@ CloudWarmUpManager::~CloudWarmUpManager() {
     if (_download_thread.joinable()) {
         _download_thread.join();
     }
+    if (_sync_thread.joinable()) {
+        _sync_thread.join();
+    }
+}
+
+bool CloudWarmUpManager::is_table_subscribed(int64_t table_id) {
+    std::string table_ids = config::warm_up_rowset_table_ids;
+    if (table_ids.empty()) {
+        return false;
+    }
+    std::lock_guard lock(_subscribed_tables_mtx);
+    if (table_ids != _subscribed_tables_config) {
+        _subscribed_tables.clear();
+        for (const auto& id : split(table_ids, ",")) {
+            try {
+                _subscribed_tables.insert(std::stoll(std::string(trim(id))));
+            } catch (...) {
+                LOG(WARNING) << "invalid table id in warm_up_rowset_table_ids: " << id;
+            }
+        }
+        _subscribed_tables_config = std::move(table_ids);
+    }
+    return _subscribed_tables.contains(table_id);
+}
+
+void CloudWarmUpManager::sync_subscribed_tablets() {
+#ifndef BE_TEST
+    while (true) {
+        {
+            std::unique_lock lock(_mtx);
+            auto interval = std::max(config::warm_up_rowset_sync_interval_s, 1);
+            _cond.wait_for(lock, std::chrono::seconds(interval), [this] { return _closed; });
+            if (_closed) {
+                break;
+            }
+        }
+        if (config::warm_up_rowset_table_ids.empty()) {
+            continue;
+        }
+        for (auto& weak_tablet : _engine.tablet_mgr().get_weak_tablets()) {
+            auto tablet = weak_tablet.lock();
+            if (tablet == nullptr || !is_table_subscribed(tablet->table_id())) {
+                continue;
+            }
+            // the new rowsets are warmed up by `CloudTablet::add_rowsets`
+            SyncOptions options;
+            options.warmup_delta_data = true;
+            auto st = tablet->sync_rowsets(options);
+            if (!st.ok()) {
+                LOG_WARNING("failed to sync the tablet to warm up")
+                        .tag("tablet_id", tablet->tablet_id())
+                        .error(st);
+            }
+        }
+    }
+#endif
 }
 
 std::unordered_map<std::string, RowsetMetaSharedPtr> snapshot_rs_metas(BaseTablet* tablet) {
@@ -130,6 +190,16 @@ void CloudWarmUpManager::handle_jobs() {
         std::shared_ptr<bthread::CountdownEvent> wait =
                 std::make_shared<bthread::CountdownEvent>(0);
 
+        // the files are read from the BE warming up this one, which caches them
+        auto add_peer = [&cur_job](const std::string& path) {
+            if (cur_job->download_type == DownloadType::BE &&
+                config::enable_file_cache_peer_fetch) {
+                io::FileCachePeers::instance().add(
+                        io::BlockFileCache::hash(io::Path(path).filename().native()),
+                        cur_job->be_ip);
+            }
+        };
+
         for (int64_t tablet_id : cur_job->tablet_ids) {
             if (_cur_job_id == 0) { // The job is canceled
                 break;
@@ -165,10 +235,10 @@ void CloudWarmUpManager::handle_jobs() {
                     }
 
                     // 1st. download segment files
-                    submit_download_tasks(
-                            storage_resource.value()->remote_segment_path(*rs, seg_id),
-                            rs->segment_file_size(seg_id), storage_resource.value()->fs,
-                            expiration_time, wait);
+                    auto segment_path = storage_resource.value()->remote_segment_path(*rs, seg_id);
+                    add_peer(segment_path);
+                    submit_download_tasks(segment_path, rs->segment_file_size(seg_id),
+                                          storage_resource.value()->fs, expiration_time, wait);
 
                     // 2nd. download inverted index files
                     int64_t file_size = -1;
@@ -188,6 +258,7 @@ void CloudWarmUpManager::handle_jobs() {
                                     }
                                 }
                             }
+                            add_peer(idx_path);
                             submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
                                                   expiration_time, wait);
                         }
@@ -197,6 +268,7 @@ void CloudWarmUpManager::handle_jobs() {
                                     storage_resource.value()->remote_idx_v2_path(*rs, seg_id);
                             file_size = idx_file_info.has_index_size() ? idx_file_info.index_size()
                                                                        : -1;
+                            add_peer(idx_path);
                             submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
                                                   expiration_time, wait);
                         }
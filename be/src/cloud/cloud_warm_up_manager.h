@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "cloud/cloud_storage_engine.h"
@@ -69,8 +70,16 @@ public:
     // Cancel the job
     Status clear_job(int64_t job_id);
 
+    // Whether the new rowsets of the table are warmed up once they are synced, see
+    // config::warm_up_rowset_table_ids.
+    bool is_table_subscribed(int64_t table_id);
+
 private:
     void handle_jobs();
+
+    // Sync the tablets of the subscribed tables periodically, which warms up their new rowsets.
+    void sync_subscribed_tablets();
+
     void submit_download_tasks(io::Path path, int64_t file_size, io::FileSystemSPtr file_system,
                                int64_t expiration_time,
                                std::shared_ptr<bthread::CountdownEvent> wait);
@@ -81,7 +90,13 @@ private:
     std::deque<std::shared_ptr<JobMeta>> _pending_job_metas;
     std::vector<std::shared_ptr<JobMeta>> _finish_job;
     std::thread _download_thread;
+    std::thread _sync_thread;
     bool _closed {false};
+
+    std::mutex _subscribed_tables_mtx;
+    // parsed from config::warm_up_rowset_table_ids
+    std::string _subscribed_tables_config;
+    std::unordered_set<int64_t> _subscribed_tables;
     // the attribute for compile in ut
     [[maybe_unused]] CloudStorageEngine& _engine;
 };
@@ -49,6 +49,7 @@ DEFINE_mInt64(cumu_compaction_interval_s, "1800");
 
 DEFINE_mInt32(compaction_timeout_seconds, "86400");
 DEFINE_mInt32(lease_compaction_interval_seconds, "20");
+DEFINE_mInt32(lease_compaction_renew_rounds, "2");
 DEFINE_mBool(enable_parallel_cumu_compaction, "false");
 DEFINE_mDouble(base_compaction_thread_num_factor, "0.25");
 DEFINE_mDouble(cumu_compaction_thread_num_factor, "0.5");
@@ -67,6 +68,9 @@ DEFINE_mBool(save_load_error_log_to_s3, "false");
 
 DEFINE_mInt32(sync_load_for_tablets_thread, "32");
 
+DEFINE_mString(warm_up_rowset_table_ids, "");
+DEFINE_mInt32(warm_up_rowset_sync_interval_s, "10");
+
 DEFINE_mBool(enable_new_tablet_do_compaction, "true");
 
 DEFINE_mInt32(delete_bitmap_lock_expiration_seconds, "10");
@@ -83,6 +83,9 @@ DECLARE_mInt64(cumu_compaction_interval_s);
 
 DECLARE_mInt32(compaction_timeout_seconds);
 DECLARE_mInt32(lease_compaction_interval_seconds);
+// Renew the leases of the compaction jobs once every this many `lease_compaction_interval_seconds`,
+// in [1, 3], a job is leased for 4 intervals so its lease never expires while it's running
+DECLARE_mInt32(lease_compaction_renew_rounds);
 DECLARE_mBool(enable_parallel_cumu_compaction);
 DECLARE_mDouble(base_compaction_thread_num_factor);
 DECLARE_mDouble(cumu_compaction_thread_num_factor);
@@ -104,6 +107,12 @@ DECLARE_mBool(save_load_error_log_to_s3);
 // the theads which sync the datas which loaded in other clusters
 DECLARE_mInt32(sync_load_for_tablets_thread);
 
+// The comma separated ids of the tables whose new rowsets are warmed up into the file cache once
+// they are synced. The tablets of them on this BE are synced every
+// warm_up_rowset_sync_interval_s seconds to get the rowsets written by the other clusters.
+DECLARE_mString(warm_up_rowset_table_ids);
+DECLARE_mInt32(warm_up_rowset_sync_interval_s);
+
 DECLARE_mInt32(delete_bitmap_lock_expiration_seconds);
 
 DECLARE_mInt32(get_delete_bitmap_lock_max_retry_times);
@@ -120,6 +120,7 @@ DEFINE_Double(soft_mem_limit_frac, "0.9");
 
 // Cache capacity reduce mem limit as a fraction of soft mem limit.
 DEFINE_mDouble(cache_capacity_reduce_mem_limit_frac, "0.7");
+DEFINE_mBool(enable_cache_capacity_adjust_by_hit_ratio, "true");
 
 // Schema change memory limit as a fraction of soft memory limit.
 DEFINE_Double(schema_change_mem_limit_frac, "0.6");
@@ -138,6 +139,12 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+DEFINE_mInt64(allocator_thread_cache_bytes, "4194304");
+DEFINE_mInt64(allocator_thread_cache_max_buffer_bytes, "524288");
+
+DEFINE_Bool(enable_huge_page_for_large_allocation, "false");
+DEFINE_Int64(huge_page_allocation_threshold_bytes, "67108864");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -201,6 +208,8 @@ DEFINE_Int32(heartbeat_service_thread_count, "1");
 DEFINE_Int32(create_tablet_worker_count, "3");
 // the count of thread to drop table
 DEFINE_Int32(drop_tablet_worker_count, "3");
+// the count of thread to report the finished create and drop tablet tasks to FE
+DEFINE_Int32(finish_task_report_worker_count, "4");
 // the count of thread to batch load
 DEFINE_Int32(push_worker_count_normal_priority, "3");
 // the count of thread to high priority batch load
@@ -213,6 +222,7 @@ DEFINE_Int32(tablet_publish_txn_max_thread, "32");
 DEFINE_Int32(publish_version_task_timeout_s, "8");
 // the count of thread to calc delete bitmap
 DEFINE_Int32(calc_delete_bitmap_max_thread, "32");
+DEFINE_mInt32(calc_delete_bitmap_rows_per_task, "0");
 // the count of thread to calc delete bitmap worker, only used for cloud
 DEFINE_Int32(calc_delete_bitmap_worker_count, "8");
 // the count of thread to calc tablet delete bitmap task, only used for cloud
@@ -257,6 +267,7 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+DEFINE_mInt32(clone_batch_download_parallelism, "4");
 // whether to check md5sum when download
 DEFINE_mBool(enable_download_md5sum_check, "false");
 // download binlog meta timeout, default 30s
@@ -293,6 +304,16 @@ DEFINE_Int32(be_service_threads, "64");
 // The pipeline task has a high concurrency, therefore reducing its report frequency
 DEFINE_mInt32(pipeline_status_report_interval, "10");
 DEFINE_mInt32(pipeline_task_exec_time_slice, "100");
+DEFINE_mInt32(pipeline_task_trace_sample_interval, "100");
+DEFINE_Int32(pipeline_task_trace_ring_size, "65536");
+DEFINE_mBool(enable_pipeline_task_hardware_counters, "false");
+DEFINE_Bool(enable_query_cpu_profiler, "false");
+DEFINE_Int32(query_cpu_profiler_frequency, "100");
+DEFINE_mInt32(query_cpu_profiler_window_minutes, "10");
+DEFINE_mInt32(lock_contention_sample_interval, "16");
+DEFINE_Bool(enable_numa_aware_pipeline_task_steal, "false");
+DEFINE_mInt32(pipeline_task_cross_numa_steal_idle_ms, "10");
+DEFINE_mBool(enable_pipeline_task_queue_try_lock_steal, "false");
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DEFINE_Int32(doris_scanner_thread_pool_thread_num, "-1");
@@ -304,8 +325,11 @@ DEFINE_Validator(doris_scanner_thread_pool_thread_num, [](const int config) -> b
     return true;
 });
 DEFINE_Int32(doris_scanner_min_thread_pool_thread_num, "8");
+DEFINE_mBool(enable_workload_group_elastic_scan_thread_pool, "true");
 DEFINE_Int32(remote_split_source_batch_size, "1000");
+DEFINE_mInt64(file_scan_max_range_size, "1073741824");
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "-1");
+DEFINE_mInt32(remote_scan_concurrency_max_io_wait_scale, "4");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
 // default thrift client connect timeout(in seconds)
@@ -325,12 +349,15 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mInt64(scan_block_max_bytes, "0");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_mInt32(exchg_multi_blocks_byte_size, "0");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_mInt32(schema_change_max_parallel_rowsets, "4");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
@@ -389,12 +416,23 @@ DEFINE_Bool(disable_pk_storage_page_cache, "false");
 
 // Cache for mow primary key storage page size
 DEFINE_String(pk_storage_page_cache_limit, "10%");
+DEFINE_String(compressed_page_cache_limit, "0");
 // data page size for primary key index
 DEFINE_Int32(primary_key_data_page_size, "32768");
 
+DEFINE_Bool(enable_segment_footer_store, "false");
+DEFINE_Int64(segment_footer_store_max_file_size, "1073741824");
+
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+DEFINE_Int32(data_page_cache_protected_percentage, "0");
+DEFINE_Int32(index_page_cache_protected_percentage, "0");
+DEFINE_Int32(pk_index_page_cache_protected_percentage, "0");
+DEFINE_Bool(enable_page_cache_clock_lookup, "false");
+DEFINE_mBool(enable_page_cache_single_flight, "true");
+DEFINE_mBool(enable_page_decompress_prefetch, "false");
+DEFINE_Int32(page_decompress_prefetch_thread_num, "16");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
@@ -421,6 +459,13 @@ DEFINE_mBool(enable_vertical_segment_writer, "true");
 // In ordered data compaction, min segment size for input rowset
 DEFINE_mInt32(ordered_data_compaction_min_segment_size, "10485760");
 
+DEFINE_mBool(enable_adaptive_column_encoding, "false");
+DEFINE_mInt32(adaptive_column_encoding_sample_rows, "4096");
+DEFINE_mDouble(adaptive_column_encoding_max_size_ratio, "0.8");
+
+DEFINE_mInt64(base_compaction_io_bytes_per_second_per_disk, "-1");
+DEFINE_mInt64(cumu_compaction_io_bytes_per_second_per_disk, "-1");
+
 // This config can be set to limit thread number in compaction thread pool.
 DEFINE_mInt32(max_base_compaction_threads, "4");
 DEFINE_mInt32(max_cumu_compaction_threads, "-1");
@@ -580,6 +625,8 @@ DEFINE_Bool(enable_brpc_builtin_services, "true");
 DEFINE_Bool(enable_brpc_connection_check, "false");
 
 DEFINE_mInt64(brpc_connection_check_timeout_ms, "10000");
+DEFINE_mBool(exchange_skip_compression_for_same_host, "true");
+DEFINE_mBool(enable_exchange_adaptive_compression, "true");
 
 // The maximum amount of data that can be processed by a stream load
 DEFINE_mInt64(streaming_load_max_mb, "102400");
@@ -608,6 +655,9 @@ DEFINE_Int32(stream_load_record_expire_time_secs, "28800");
 DEFINE_mInt64(clean_stream_load_record_interval_secs, "1800");
 // enable stream load commit txn on BE directly, bypassing FE. Only for cloud.
 DEFINE_mBool(enable_stream_load_commit_txn_on_be, "false");
+DEFINE_mInt32(stream_load_parallel_parse_num, "8");
+DEFINE_mInt64(stream_load_parallel_parse_chunk_size, "1048576");
+DEFINE_mInt32(routine_load_parallel_parse_num, "1");
 // The buffer size to store stream table function schema info
 DEFINE_Int64(stream_tvf_buffer_size, "1048576"); // 1MB
 
@@ -664,6 +714,11 @@ DEFINE_mInt64(write_buffer_size, "209715200");
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+DEFINE_mInt64(memtable_flush_split_rows, "0");
+DEFINE_mBool(enable_adaptive_memtable_size, "false");
+DEFINE_mInt64(adaptive_memtable_min_size, "16777216");
+DEFINE_mInt64(adaptive_memtable_max_size, "1073741824");
+DEFINE_mInt64(memtable_target_segment_size, "268435456");
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DEFINE_mInt32(memtable_wait_for_memory_sleep_time_s, "300");
@@ -692,6 +747,7 @@ DEFINE_mInt32(arrow_flight_result_sink_buffer_size_rows, "32768");
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DEFINE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms, "300000");
+DEFINE_mBool(enable_zero_copy_block_to_arrow, "true");
 
 // the increased frequency of priority for remaining tasks in BlockingPriorityQueue
 DEFINE_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
@@ -858,6 +914,8 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
 
+DEFINE_mInt64(mem_tracker_sharded_counter_fold_bytes, "8388608");
+
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
 // And as the new version is written and the old version is deleted,
@@ -885,6 +943,7 @@ DEFINE_Int32(load_stream_eagain_wait_seconds, "600");
 DEFINE_Int32(load_stream_flush_token_max_tasks, "15");
 // max wait flush token time in load stream
 DEFINE_Int32(load_stream_max_wait_flush_token_time_ms, "600000");
+DEFINE_mBool(enable_load_stream_select_by_load, "true");
 // number of send batch thread pool size
 DEFINE_Int32(send_batch_thread_pool_thread_num, "64");
 // number of send batch thread pool queue size
@@ -971,6 +1030,8 @@ DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
+DEFINE_mBool(enable_adaptive_merged_io_size, "false");
+DEFINE_mBool(skip_merging_file_cached_ranges, "true");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -979,6 +1040,8 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 
 // Perform the always_true check at intervals determined by runtime_filter_sampling_frequency
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
+DEFINE_mInt64(runtime_filter_selectivity_window_rows, "32768");
+DEFINE_mInt32(runtime_filter_merge_fan_in, "8");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
 // cooldown task configs
@@ -1032,6 +1095,11 @@ DEFINE_Bool(enable_segcompaction, "true");
 // Max number of segments allowed in a single segcompaction task.
 DEFINE_mInt32(segcompaction_batch_size, "10");
 
+// Max number of segments allowed in a single segcompaction task when the flushes outpace the
+// segcompaction, a task takes all the pending segments up to this number so the backlog is
+// compacted instead of being left to the final rename.
+DEFINE_mInt32(segcompaction_max_batch_size, "50");
+
 // Max row count allowed in a single source segment, bigger segments will be skipped.
 DEFINE_Int32(segcompaction_candidate_max_rows, "1048576");
 
@@ -1067,6 +1135,7 @@ DEFINE_mBool(variant_use_cloud_schema_dict_cache, "true");
 DEFINE_mDouble(variant_ratio_of_defaults_as_sparse_column, "1");
 DEFINE_mInt64(variant_threshold_rows_to_estimate_sparse_column, "2048");
 DEFINE_mBool(variant_throw_exeception_on_invalid_json, "false");
+DEFINE_mInt32(variant_max_subcolumns_count, "0");
 
 // block file cache
 DEFINE_Bool(enable_file_cache, "false");
@@ -1085,6 +1154,7 @@ DEFINE_Bool(enable_file_cache, "false");
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DEFINE_String(file_cache_path, "[{\"path\":\"${DORIS_HOME}/file_cache\"}]");
 DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
+DEFINE_mBool(file_cache_write_bypass_page_cache, "false");
 
 DEFINE_Bool(clear_file_cache, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
@@ -1098,7 +1168,16 @@ DEFINE_mInt64(file_cache_evict_in_advance_batch_bytes, "31457280"); // 30MB
 DEFINE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold, "1000");
 
 DEFINE_mBool(enable_read_cache_file_directly, "false");
+DEFINE_mBool(enable_file_cache_prefetch, "false");
+DEFINE_mInt32(file_cache_prefetch_blocks, "4");
+DEFINE_mInt64(file_cache_prefetch_max_inflight_bytes, "268435456"); // 256MB
+DEFINE_mBool(enable_file_cache_peer_fetch, "false");
+DEFINE_mInt32(file_cache_peer_fetch_timeout_ms, "3000");
+DEFINE_mInt64(file_cache_peer_ttl_s, "3600");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "true");
+DEFINE_mBool(file_cache_pin_index_blocks, "false");
+DEFINE_mInt64(file_cache_disposable_scan_bytes, "-1");
+DEFINE_mString(file_cache_disposable_workload_groups, "");
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
 DEFINE_Bool(enable_ttl_cache_evict_using_lru, "true");
@@ -1108,6 +1187,7 @@ DEFINE_mInt64(file_cache_error_log_limit_bytes, "209715200"); // 200MB
 DEFINE_mInt64(cache_lock_wait_long_tail_threshold_us, "30000000");
 DEFINE_mInt64(cache_lock_held_long_tail_threshold_us, "30000000");
 DEFINE_mBool(enable_file_cache_keep_base_compaction_output, "false");
+DEFINE_mInt64(file_cache_keep_base_compaction_output_min_qpd, "0");
 DEFINE_mInt64(file_cache_remove_block_qps_limit, "1000");
 DEFINE_mInt64(file_cache_background_gc_interval_ms, "100");
 DEFINE_mBool(enable_reader_dryrun_when_download_file_cache, "true");
@@ -1118,11 +1198,14 @@ DEFINE_mInt64(file_cache_background_lru_dump_interval_ms, "60000");
 // dump queue only if the queue update specific times through several dump intervals
 DEFINE_mInt64(file_cache_background_lru_dump_update_cnt_threshold, "1000");
 DEFINE_mInt64(file_cache_background_lru_dump_tail_record_num, "5000000");
+DEFINE_mInt64(file_cache_lru_restore_batch_size, "10000");
 DEFINE_mInt64(file_cache_background_lru_log_replay_interval_ms, "1000");
+DEFINE_mInt64(file_cache_lru_promotion_interval_s, "0");
 DEFINE_mBool(enable_evaluate_shadow_queue_diff, "false");
 
 DEFINE_Int32(file_cache_downloader_thread_num_min, "32");
 DEFINE_Int32(file_cache_downloader_thread_num_max, "32");
+DEFINE_mInt64(file_cache_downloader_bytes_per_second, "-1");
 
 DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "1800");
 DEFINE_mInt32(inverted_index_cache_stale_sweep_time_sec, "600");
@@ -1149,6 +1232,7 @@ DEFINE_Int32(inverted_index_read_buffer_size, "4096");
 DEFINE_Int32(max_depth_in_bkd_tree, "32");
 // index compaction
 DEFINE_mBool(inverted_index_compaction_enable, "true");
+DEFINE_mInt32(inverted_index_compaction_threads, "1");
 // Only for debug, do not use in production
 DEFINE_mBool(debug_inverted_index_compaction, "false");
 // index by RAM directory
@@ -1161,6 +1245,10 @@ DEFINE_Int32(num_broadcast_buffer, "32");
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
 
+DEFINE_mBool(enable_fused_expr_execution, "true");
+
+DEFINE_mBool(enable_projection_common_expr_elimination, "true");
+
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
 
@@ -1170,6 +1258,9 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt64(s3_write_buffer_max_size, "67108864");
+DEFINE_mInt32(s3_write_buffer_grow_parts, "1000");
+DEFINE_mInt32(s3_upload_max_connections_per_bucket, "0");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1196,6 +1287,7 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "28800");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+DEFINE_Int64(external_file_meta_index_cache_size, "268435456");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1245,6 +1337,7 @@ DEFINE_mBool(enable_missing_rows_correctness_check, "false");
 // When the number of missing versions is more than this value, do not directly
 // retry the publish and handle it through async publish.
 DEFINE_mInt32(mow_publish_max_discontinuous_version_num, "20");
+DEFINE_mInt32(mow_publish_max_batch_versions, "0");
 // When the size of primary keys in memory exceeds this value, finish current segment
 // and create a new segment, used in compaction. Default 50MB.
 DEFINE_mInt64(mow_primary_key_index_max_size_in_memory, "52428800");
@@ -1258,6 +1351,7 @@ DEFINE_mBool(enable_mow_get_agg_by_cache, "true");
 DEFINE_mBool(enable_mow_get_agg_correctness_check_core, "false");
 DEFINE_mBool(enable_agg_and_remove_pre_rowsets_delete_bitmap, "true");
 DEFINE_mBool(enable_check_agg_and_remove_pre_rowsets_delete_bitmap, "false");
+DEFINE_mBool(enable_delete_bitmap_run_optimize, "true");
 
 // The secure path with user files, used in the `local` table function.
 DEFINE_mString(user_files_secure_path, "${DORIS_HOME}");
@@ -1284,6 +1378,13 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mBool(group_commit_wal_sync_on_append, "false");
+DEFINE_mInt64(group_commit_wal_preallocate_bytes, "0");
+DEFINE_mBool(enable_adaptive_group_commit_interval, "false");
+DEFINE_mInt32(group_commit_target_visible_latency_ms, "2000");
+DEFINE_mInt32(group_commit_min_interval_ms, "100");
+DEFINE_mInt32(group_commit_max_shards, "1");
+DEFINE_mInt64(group_commit_shard_bytes_per_second, "67108864");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1324,6 +1425,12 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+DEFINE_mBool(enable_local_exchange_broadcast_zero_copy, "false");
+DEFINE_mBool(enable_hash_join_lazy_materialize_by_conjuncts, "true");
+DEFINE_mBool(enable_agg_two_level_hash_table, "false");
+DEFINE_mInt32(streaming_agg_reprobe_interval_blocks, "64");
+DEFINE_mInt32(streaming_agg_resume_min_hit_percent, "50");
+DEFINE_mBool(enable_sort_normalized_key, "true");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1359,6 +1466,10 @@ DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
 
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
+DEFINE_mInt64(spill_io_batch_bytes, "4194304");
+DEFINE_mInt64(spill_hash_join_partition_max_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_max_repartition_levels, "3");
+DEFINE_mInt64(spill_write_bytes_per_second_per_query, "0");
 
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
@@ -1367,6 +1478,11 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mBool(enable_s3_hedged_read, "false");
+DEFINE_mInt64(s3_hedged_read_max_bytes, "4194304");
+DEFINE_mInt32(s3_hedged_read_min_delay_ms, "20");
+DEFINE_mInt32(s3_hedged_read_budget_percent, "5");
+DEFINE_Int32(s3_hedged_read_thread_num, "64");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1441,6 +1557,7 @@ DEFINE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio, "0.5");
 DEFINE_mInt64(hdfs_jni_write_sleep_milliseconds, "300");
 // The max retry times when hdfs write failed
 DEFINE_mInt64(hdfs_jni_write_max_retry_time, "3");
+DEFINE_mBool(enable_jni_arrow_batch, "true");
 
 // The min thread num for NonBlockCloseThreadPool
 DEFINE_Int64(min_nonblock_close_thread_num, "12");
@@ -1458,6 +1575,15 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "8");
+
+DEFINE_mBool(enable_segment_read_coalescing, "false");
+
+DEFINE_mBool(enable_adaptive_predicate_order, "false");
+
+DEFINE_mBool(enable_monotonic_function_pruning, "true");
+
+DEFINE_mBool(enable_pk_index_fence_pointers, "false");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1466,6 +1592,7 @@ DEFINE_Bool(enable_file_logger, "true");
 
 // The minimum row group size when exporting Parquet files. default 128MB
 DEFINE_Int64(min_row_group_size, "134217728");
+DEFINE_mBool(enable_parquet_writer_parallel_column_write, "true");
 
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
@@ -1498,6 +1625,7 @@ DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
+DEFINE_mBool(enable_query_cache_reuse_on_empty_versions, "true");
 
 // Enable validation to check the correctness of table size.
 DEFINE_Bool(enable_table_size_correctness_check, "false");
@@ -1505,6 +1633,7 @@ DEFINE_Bool(force_regenerate_rowsetid_on_start_error, "false");
 DEFINE_mBool(enable_sleep_between_delete_cumu_compaction, "false");
 
 DEFINE_mInt32(compaction_num_per_round, "4");
+DEFINE_mBool(enable_compaction_read_amp_score, "false");
 
 DEFINE_mInt32(check_tablet_delete_bitmap_interval_seconds, "300");
 DEFINE_mInt32(check_tablet_delete_bitmap_score_top_n, "10");
@@ -155,6 +155,10 @@ DECLARE_Double(soft_mem_limit_frac);
 // Cache capacity reduce mem limit as a fraction of soft mem limit.
 DECLARE_mDouble(cache_capacity_reduce_mem_limit_frac);
 
+// When the cache capacity is reduced, shrink the caches by their hit ratios since the last
+// adjustment, the caches hit less are shrunk more.
+DECLARE_mBool(enable_cache_capacity_adjust_by_hit_ratio);
+
 // Schema change memory limit as a fraction of soft memory limit.
 DECLARE_Double(schema_change_mem_limit_frac);
 
@@ -172,6 +176,19 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// The max bytes of the freed buffers cached by each thread for reuse, e.g. the PODArray buffers
+// of the blocks created and destroyed by an operator. Only power of two buffers between 4KB and
+// `allocator_thread_cache_max_buffer_bytes` are cached. 0 disables the cache.
+DECLARE_mInt64(allocator_thread_cache_bytes);
+DECLARE_mInt64(allocator_thread_cache_max_buffer_bytes);
+
+// If true, the tracked allocations not smaller than `huge_page_allocation_threshold_bytes`, e.g.
+// the buckets of large hash tables and the chunks of Arena, are advised to be backed by
+// transparent huge pages with madvise(MADV_HUGEPAGE), which reduces the TLB misses of random
+// accesses. It only works if transparent_hugepage/enabled is `madvise` or `always`.
+DECLARE_Bool(enable_huge_page_for_large_allocation);
+DECLARE_Int64(huge_page_allocation_threshold_bytes);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -246,6 +263,8 @@ DECLARE_Int32(heartbeat_service_thread_count);
 DECLARE_Int32(create_tablet_worker_count);
 // the count of thread to drop table
 DECLARE_Int32(drop_tablet_worker_count);
+// the count of thread to report the finished create and drop tablet tasks to FE
+DECLARE_Int32(finish_task_report_worker_count);
 // the count of thread to batch load
 DECLARE_Int32(push_worker_count_normal_priority);
 // the count of thread to high priority batch load
@@ -258,6 +277,9 @@ DECLARE_Int32(tablet_publish_txn_max_thread);
 DECLARE_Int32(publish_version_task_timeout_s);
 // the count of thread to calc delete bitmap
 DECLARE_Int32(calc_delete_bitmap_max_thread);
+// the max rows of the new segment to calc delete bitmap in one task, the larger segments are
+// split into row ranges calculated concurrently, 0 means one task per segment
+DECLARE_mInt32(calc_delete_bitmap_rows_per_task);
 // the count of thread to calc delete bitmap worker, only used for cloud
 DECLARE_Int32(calc_delete_bitmap_worker_count);
 // the count of thread to calc tablet delete bitmap task, only used for cloud
@@ -301,6 +323,9 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// The max number of batches of files a clone downloads in parallel. Each download is limited by
+// max_download_speed_kbps.
+DECLARE_mInt32(clone_batch_download_parallelism);
 // whether to check md5sum when download
 DECLARE_mBool(enable_download_md5sum_check);
 // download binlog meta timeout
@@ -340,15 +365,52 @@ DECLARE_Int32(be_service_threads);
 DECLARE_mInt32(pipeline_status_report_interval);
 // Time slice for pipeline task execution (ms)
 DECLARE_mInt32(pipeline_task_exec_time_slice);
+// The run, blocked and runnable intervals of the pipeline tasks of one in this number of queries
+// are kept in a ring buffer, which is exported by api/pipeline/trace. 0 means disabled.
+DECLARE_mInt32(pipeline_task_trace_sample_interval);
+// The max number of the pipeline task intervals kept for api/pipeline/trace.
+DECLARE_Int32(pipeline_task_trace_ring_size);
+// Whether to collect the hardware counters (cycles, instructions, LLC and dTLB misses) of each
+// execution slice of the pipeline tasks into the profile, which costs two reads per slice.
+DECLARE_mBool(enable_pipeline_task_hardware_counters);
+// Whether to sample the cpu time of the process continuously, tagged with the query and the plan
+// node, see api/query_cpu_profile.
+DECLARE_Bool(enable_query_cpu_profiler);
+// The samples per second of the process cpu time of the query cpu profiler.
+DECLARE_Int32(query_cpu_profiler_frequency);
+// The minutes of the samples kept by the query cpu profiler.
+DECLARE_mInt32(query_cpu_profiler_window_minutes);
+// Time one of every N waits of the profiled locks when they are contended, see
+// api/lock_contention. 0 means the waits are only counted.
+DECLARE_mInt32(lock_contention_sample_interval);
+// Whether pipeline workers steal tasks from queues on the same NUMA node first, and bind
+// each worker thread to the cpus of its NUMA node.
+DECLARE_Bool(enable_numa_aware_pipeline_task_steal);
+// A worker only steals tasks from queues on other NUMA nodes after it has been idle for
+// longer than this threshold (ms). Only used when `enable_numa_aware_pipeline_task_steal` is true.
+DECLARE_mInt32(pipeline_task_cross_numa_steal_idle_ms);
+// If true, a pipeline worker skips the task queues which are empty or locked by other
+// threads when stealing tasks, instead of waiting for their locks.
+DECLARE_mBool(enable_pipeline_task_queue_try_lock_steal);
 // number of scanner thread pool size for olap table
 // and the min thread num of remote scanner thread pool
 DECLARE_mInt32(doris_scanner_thread_pool_thread_num);
 DECLARE_mInt32(doris_scanner_min_thread_pool_thread_num);
+// If true, the local scan thread pool of a workload group keeps only
+// doris_scanner_min_thread_pool_thread_num threads when it's idle, and grows to its
+// scan_thread_num on demand.
+DECLARE_mBool(enable_workload_group_elastic_scan_thread_pool);
 // number of batch size to fetch the remote split source
 DECLARE_mInt32(remote_split_source_batch_size);
+// The parquet and orc scan ranges larger than this are cut into the ranges of this size, so the
+// row groups of a large file are read by several scanners. 0 means not to cut.
+DECLARE_mInt64(file_scan_max_range_size);
 // max number of remote scanner thread pool size
 // if equal to -1, value is std::max(512, CpuInfo::num_cores() * 10)
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
+// The scan concurrency of a remote scan operator is scaled up by the ratio of the wall time to
+// the cpu time of its scan tasks, up to this value. 1 means not to scale.
+DECLARE_mInt32(remote_scan_concurrency_max_io_wait_scale);
 // number of olap scanner thread pool queue size
 DECLARE_Int32(doris_scanner_thread_pool_queue_size);
 // default thrift client connect timeout(in seconds)
@@ -367,12 +429,23 @@ DECLARE_mInt32(doris_scanner_row_num);
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Max bytes of a block read from a segment, the segment iterator reads fewer rows than the batch
+// size when the rows are wide, and the scanner does not merge the blocks beyond it, so the blocks
+// of the wide rows fit in the cache of the operators above, e.g. the hash join probe and the sort.
+// 0 means the blocks are only limited by the batch size.
+DECLARE_mInt64(scan_block_max_bytes);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// If the query does not set `exchange_multi_blocks_byte_size`, the exchange sink packs the pending
+// blocks of one channel into one rpc until their size exceeds this value. 0 means disabled.
+DECLARE_mInt32(exchg_multi_blocks_byte_size);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// The max number of rowsets of a tablet converted in parallel by a schema change which doesn't
+// sort the rows. 1 means converting them one by one.
+DECLARE_mInt32(schema_change_max_parallel_rowsets);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
@@ -435,14 +508,43 @@ DECLARE_Bool(disable_pk_storage_page_cache);
 // Cache for mow primary key storage page size, it's seperated from
 // storage_page_cache_limit
 DECLARE_String(pk_storage_page_cache_limit);
+// Cache for the compressed bytes of storage pages, it's seperated from storage_page_cache_limit.
+// A compressed page read from file is kept here, and only decompressed into the data or index
+// page cache when it is read again, so the cold pages take less memory. 0 means disabled.
+DECLARE_String(compressed_page_cache_limit);
 // data page size for primary key index
 DECLARE_Int32(primary_key_data_page_size);
 
+// Whether to keep the segment footers in a file of each data dir, so they are not read again from
+// the segment files after restart.
+DECLARE_Bool(enable_segment_footer_store);
+// The max size of the segment footer store file of each data dir, the file is started over on the
+// next restart when it reaches the size.
+DECLARE_Int64(segment_footer_store_max_file_size);
+
 // inc_rowset snapshot rs sweep time interval
 DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// The percentage of the capacity of each page cache for the pages hit again after they are
+// inserted, which are evicted after the pages hit once, so a large scan does not flush the hot
+// pages. 0 means plain LRU.
+DECLARE_Int32(data_page_cache_protected_percentage);
+DECLARE_Int32(index_page_cache_protected_percentage);
+DECLARE_Int32(pk_index_page_cache_protected_percentage);
+// Whether the hits of the page caches take the shard lock shared and only mark the pages visited,
+// the pages are then evicted in CLOCK order instead of strict LRU.
+DECLARE_Bool(enable_page_cache_clock_lookup);
+// Whether a reader that misses a page being read into the page cache by another reader, for
+// example a concurrent query on the same tablet, waits for that page instead of reading and
+// decompressing it again.
+DECLARE_mBool(enable_page_cache_single_flight);
+// Whether a column iterator that reads the pages in order decompresses its next page into the
+// page cache on another thread while it decodes the current one, so the scans of compressed cold
+// data are not bound to the decompression of the scanner thread.
+DECLARE_mBool(enable_page_decompress_prefetch);
+DECLARE_Int32(page_decompress_prefetch_thread_num);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
@@ -469,6 +571,20 @@ DECLARE_mBool(enable_vertical_segment_writer);
 // In ordered data compaction, min segment size for input rowset
 DECLARE_mInt32(ordered_data_compaction_min_segment_size);
 
+// Whether to choose the encoding of each column of compaction output by sampling its first values
+DECLARE_mBool(enable_adaptive_column_encoding);
+// The number of values sampled to choose the encoding of a column
+DECLARE_mInt32(adaptive_column_encoding_sample_rows);
+// The default encoding of a type is kept for decoding speed, unless the sampled size of another
+// encoding is below this ratio of the size of the default encoding
+DECLARE_mDouble(adaptive_column_encoding_max_size_ratio);
+
+// The bytes per second the base and full compactions may read from a data dir, -1 means no limit.
+// The io of queries and loads is never held back by them.
+DECLARE_mInt64(base_compaction_io_bytes_per_second_per_disk);
+// The bytes per second the cumulative compactions may read from a data dir, -1 means no limit.
+DECLARE_mInt64(cumu_compaction_io_bytes_per_second_per_disk);
+
 // This config can be set to limit thread number in compaction thread pool.
 DECLARE_mInt32(max_base_compaction_threads);
 DECLARE_mInt32(max_cumu_compaction_threads);
@@ -643,6 +759,14 @@ DECLARE_Int32(stream_load_record_expire_time_secs);
 DECLARE_mInt64(clean_stream_load_record_interval_secs);
 // enable stream load commit txn on BE directly, bypassing FE. Only for cloud.
 DECLARE_mBool(enable_stream_load_commit_txn_on_be);
+// max number of scanners to parse the body of a stream load with the header `parallel_parse: true`
+DECLARE_mInt32(stream_load_parallel_parse_num);
+// the size of a chunk of lines of a stream load body parsed by one scanner
+DECLARE_mInt64(stream_load_parallel_parse_chunk_size);
+// max number of scanners to parse the kafka messages of a routine load task of csv format, 1 means
+// disabled. The rows of a partition are not loaded in order any more, and it must not be enabled
+// for the jobs with `enclose`, whose messages may have line delimiters in the enclosed fields.
+DECLARE_mInt32(routine_load_parallel_parse_num);
 // The buffer size to store stream table function schema info
 DECLARE_Int64(stream_tvf_buffer_size);
 
@@ -702,6 +826,17 @@ DECLARE_mInt64(write_buffer_size);
 DECLARE_mInt64(write_buffer_size_for_agg);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// a memtable of a duplicate key table with more rows than this is flushed into several segments
+// of at most this many rows, which are written concurrently, 0 means one segment per memtable
+DECLARE_mInt64(memtable_flush_split_rows);
+// If true, MemTableMemoryLimiter shares the load memory among the memtable writers by their
+// ingest rate, instead of flushing every memtable at write_buffer_size
+DECLARE_mBool(enable_adaptive_memtable_size);
+// the memory size of a memtable to flush is kept in [min, max] by the adaptive memtable size
+DECLARE_mInt64(adaptive_memtable_min_size);
+DECLARE_mInt64(adaptive_memtable_max_size);
+// the adaptive memtable size is also limited to flush segments of about this size on disk
+DECLARE_mInt64(memtable_target_segment_size);
 
 // maximum sleep time to wait for memory when writing or flushing memtable.
 DECLARE_mInt32(memtable_wait_for_memory_sleep_time_s);
@@ -730,6 +865,9 @@ DECLARE_mInt32(arrow_flight_result_sink_buffer_size_rows);
 // The timeout for ADBC Client to wait for data using arrow flight reader.
 // If the query is very complex and no result is generated after this time, consider increasing this timeout.
 DECLARE_mInt32(arrow_flight_reader_brpc_controller_timeout_ms);
+// Whether the numeric and string columns share their buffers with the arrow arrays they are
+// converted to, instead of being copied by the arrow builders.
+DECLARE_mBool(enable_zero_copy_block_to_arrow);
 
 // the increased frequency of priority for remaining tasks in BlockingPriorityQueue
 DECLARE_mInt32(priority_queue_remaining_tasks_increased_frequency);
@@ -892,6 +1030,12 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
 
+// The consumption of a MemTrackerLimiter is counted in shards to avoid the contention of the
+// threads of a query, a shard is folded into the total when it reaches this value. The total
+// may lag by 16 times of this value, so the trackers with a limit less than 100 times of the lag
+// count precisely. 0 means always count precisely.
+DECLARE_mInt64(mem_tracker_sharded_counter_fold_bytes);
+
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
 // And as the new version is written and the old version is deleted,
@@ -919,6 +1063,9 @@ DECLARE_Int32(load_stream_eagain_wait_seconds);
 DECLARE_Int32(load_stream_flush_token_max_tasks);
 // max wait flush token time in load stream
 DECLARE_Int32(load_stream_max_wait_flush_token_time_ms);
+// Whether a tablet is written through the least loaded load stream to its backend, instead of
+// the streams in turn.
+DECLARE_mBool(enable_load_stream_select_by_load);
 // number of send batch thread pool size
 DECLARE_Int32(send_batch_thread_pool_thread_num);
 // number of send batch thread pool queue size
@@ -1010,6 +1157,11 @@ DECLARE_mDouble(max_amplified_read_ratio);
 // 1MB for oss, 8KB for hdfs
 DECLARE_mInt32(merged_oss_min_io_size);
 DECLARE_mInt32(merged_hdfs_min_io_size);
+// Estimate the equivalent min io size of each kind of file system from the latency and the size
+// of the merged reads, instead of merged_oss_min_io_size and merged_hdfs_min_io_size
+DECLARE_mBool(enable_adaptive_merged_io_size);
+// Read the ranges which are in the file cache directly without merging
+DECLARE_mBool(skip_merging_file_cached_ranges);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -1017,6 +1169,13 @@ DECLARE_mInt64(big_column_size_buffer);
 DECLARE_mInt64(small_column_size_buffer);
 
 DECLARE_mInt32(runtime_filter_sampling_frequency);
+// The selectivity of a runtime filter is judged on windows of this many input rows, a filter
+// that filters too few rows of a window is disabled until the next sampling period.
+DECLARE_mInt64(runtime_filter_selectivity_window_rows);
+// The merge node of a global runtime filter merges the products of more producers than this into
+// this many partial filters concurrently, and then merges the partial filters. <= 1 means the
+// products are merged one by one.
+DECLARE_mInt32(runtime_filter_merge_fan_in);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
 
@@ -1053,6 +1212,13 @@ DECLARE_Bool(enable_brpc_connection_check);
 
 DECLARE_mInt64(brpc_connection_check_timeout_ms);
 
+// If true, the blocks sent to another BE process on the same host (e.g. one BE per NUMA node)
+// are not compressed, since the data only goes through the loopback device.
+DECLARE_mBool(exchange_skip_compression_for_same_host);
+// If true, the exchange sink stops compressing the blocks of a channel for a while if the data
+// of the channel turns out to be incompressible, and then probes the compression ratio again.
+DECLARE_mBool(enable_exchange_adaptive_compression);
+
 // Max waiting time to wait the "plan fragment start" rpc.
 // If timeout, the fragment will be cancelled.
 // This parameter is usually only used when the FE loses connection,
@@ -1075,6 +1241,11 @@ DECLARE_Bool(enable_segcompaction);
 // Max number of segments allowed in a single segcompaction task.
 DECLARE_mInt32(segcompaction_batch_size);
 
+// Max number of segments allowed in a single segcompaction task when the flushes outpace the
+// segcompaction, a task takes all the pending segments up to this number so the backlog is
+// compacted instead of being left to the final rename.
+DECLARE_mInt32(segcompaction_max_batch_size);
+
 // Max row count allowed in a single source segment, bigger segments will be skipped.
 DECLARE_Int32(segcompaction_candidate_max_rows);
 
@@ -1120,6 +1291,9 @@ DECLARE_Bool(enable_file_cache);
 // Both will use the directory "memory" on the disk instead of the real RAM.
 DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
+// Write the blocks of the file cache through to the disk and drop them from the page cache, as
+// O_DIRECT would, so the page cache is not filled with the data the file cache already holds
+DECLARE_mBool(file_cache_write_bypass_page_cache);
 DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
@@ -1131,7 +1305,27 @@ DECLARE_mInt32(file_cache_evict_in_advance_interval_ms);
 DECLARE_mInt64(file_cache_evict_in_advance_batch_bytes);
 DECLARE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold);
 DECLARE_mBool(enable_read_cache_file_directly);
+// Read ahead the blocks of a remote file into the file cache when it's read sequentially or by a
+// stride, at most file_cache_prefetch_blocks blocks ahead of a read, and at most
+// file_cache_prefetch_max_inflight_bytes bytes being read ahead by all the readers.
+DECLARE_mBool(enable_file_cache_prefetch);
+DECLARE_mInt32(file_cache_prefetch_blocks);
+DECLARE_mInt64(file_cache_prefetch_max_inflight_bytes);
+// Read a miss of the file cache from the file cache of the BE which warms up this BE, before the
+// remote storage. The BE is remembered for file_cache_peer_ttl_s after the warm up.
+DECLARE_mBool(enable_file_cache_peer_fetch);
+DECLARE_mInt32(file_cache_peer_fetch_timeout_ms);
+DECLARE_mInt64(file_cache_peer_ttl_s);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
+// If true, the blocks of the index queue, e.g. the index pages and the segment footers, are only
+// evicted for the index data, so the scans of the other data don't evict them.
+DECLARE_mBool(file_cache_pin_index_blocks);
+// A query scanner reading more bytes of rowsets than it caches the data as disposable, so a large
+// one-off scan doesn't evict the hot data of the others. -1 means no limit.
+DECLARE_mInt64(file_cache_disposable_scan_bytes);
+// The comma separated names of the workload groups of batch queries, which cache the data they
+// read as disposable.
+DECLARE_mString(file_cache_disposable_workload_groups);
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
 DECLARE_Bool(enable_ttl_cache_evict_using_lru);
@@ -1147,6 +1341,9 @@ DECLARE_mInt64(cache_lock_held_long_tail_threshold_us);
 // If your file cache is ample enough to accommodate all the data in your database,
 // enable this option; otherwise, it is recommended to leave it disabled.
 DECLARE_mBool(enable_file_cache_keep_base_compaction_output);
+// Cache the output of base compaction of the tablets queried at least this many times in the last
+// day even if `enable_file_cache_keep_base_compaction_output` is false, 0 to disable.
+DECLARE_mInt64(file_cache_keep_base_compaction_output_min_qpd);
 DECLARE_mInt64(file_cache_remove_block_qps_limit);
 DECLARE_mInt64(file_cache_background_gc_interval_ms);
 DECLARE_mBool(enable_reader_dryrun_when_download_file_cache);
@@ -1155,12 +1352,20 @@ DECLARE_mInt64(file_cache_background_ttl_gc_interval_ms);
 DECLARE_mInt64(file_cache_background_ttl_gc_batch);
 DECLARE_Int32(file_cache_downloader_thread_num_min);
 DECLARE_Int32(file_cache_downloader_thread_num_max);
+// The max bytes per second downloaded into the file cache by the warm up, -1 means no limit.
+DECLARE_mInt64(file_cache_downloader_bytes_per_second);
 // used to persist lru information before be reboot and load the info back
 DECLARE_mInt64(file_cache_background_lru_dump_interval_ms);
 // dump queue only if the queue update specific times through several dump intervals
 DECLARE_mInt64(file_cache_background_lru_dump_update_cnt_threshold);
 DECLARE_mInt64(file_cache_background_lru_dump_tail_record_num);
+// The dumped lru entries are restored in the background after the start, and the cache lock is
+// held to add each batch of this number of entries.
+DECLARE_mInt64(file_cache_lru_restore_batch_size);
 DECLARE_mInt64(file_cache_background_lru_log_replay_interval_ms);
+// A cached block used again within this interval in seconds is not moved to the end of its LRU
+// queue, which takes less work under the cache lock for the hot blocks. 0 moves it on every use.
+DECLARE_mInt64(file_cache_lru_promotion_interval_s);
 DECLARE_mBool(enable_evaluate_shadow_queue_diff);
 
 // inverted index searcher cache
@@ -1189,6 +1394,9 @@ DECLARE_Int32(inverted_index_read_buffer_size);
 DECLARE_Int32(max_depth_in_bkd_tree);
 // index compaction
 DECLARE_mBool(inverted_index_compaction_enable);
+// The max number of threads a compaction merges the inverted indexes of its columns with, each
+// thread holds the index of one column in memory at a time
+DECLARE_mInt32(inverted_index_compaction_threads);
 // Only for debug, do not use in production
 DECLARE_mBool(debug_inverted_index_compaction);
 // index by RAM directory
@@ -1201,6 +1409,13 @@ DECLARE_Int32(num_broadcast_buffer);
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
 
+// Evaluate the comparisons of bigint or double arithmetic, e.g. `a * b + c > d`, in one fused loop
+// without materializing the columns of the arithmetic.
+DECLARE_mBool(enable_fused_expr_execution);
+
+// Compute the same deterministic function call in the projections of an operator once per block.
+DECLARE_mBool(enable_projection_common_expr_elimination);
+
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
 
@@ -1210,6 +1425,14 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The part size of a multipart upload is doubled every s3_write_buffer_grow_parts parts from
+// s3_write_buffer_size up to s3_write_buffer_max_size, so a large file needs fewer requests
+// and stays within the 10000 parts limit.
+DECLARE_mInt64(s3_write_buffer_max_size);
+DECLARE_mInt32(s3_write_buffer_grow_parts);
+// The max number of concurrent uploading requests to a bucket of all the s3 file writers,
+// 0 means no limit
+DECLARE_mInt32(s3_upload_max_connections_per_bucket);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1241,6 +1464,8 @@ DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max bytes of the serialized indexes of external files, such as parquet page index
+DECLARE_Int64(external_file_meta_index_cache_size);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1293,6 +1518,9 @@ DECLARE_mBool(variant_use_cloud_schema_dict_cache);
 DECLARE_mInt64(variant_threshold_rows_to_estimate_sparse_column);
 // Treat invalid json format str as string, instead of throwing exception if false
 DECLARE_mBool(variant_throw_exeception_on_invalid_json);
+// The max number of the subcolumns of a variant column materialized by a flush, the ones with
+// the most default values are the sparse columns beyond it. 0 means no limit.
+DECLARE_mInt32(variant_max_subcolumns_count);
 
 DECLARE_mBool(enable_merge_on_write_correctness_check);
 // USED FOR DEBUGING
@@ -1308,6 +1536,10 @@ DECLARE_mBool(enable_missing_rows_correctness_check);
 // When the number of missing versions is more than this value, do not directly
 // retry the publish and handle it through async publish.
 DECLARE_mInt32(mow_publish_max_discontinuous_version_num);
+// If it's positive, a discontinuous version of a merge-on-write tablet waits in async publish,
+// and the publish of the version before it also publishes at most this many following pending
+// versions under the same rowset update lock, instead of waiting for the retry of FE.
+DECLARE_mInt32(mow_publish_max_batch_versions);
 // When the size of primary keys in memory exceeds this value, finish current segment
 // and create a new segment, used in compaction.
 DECLARE_mInt64(mow_primary_key_index_max_size_in_memory);
@@ -1321,6 +1553,9 @@ DECLARE_mBool(enable_mow_get_agg_by_cache);
 DECLARE_mBool(enable_mow_get_agg_correctness_check_core);
 DECLARE_mBool(enable_agg_and_remove_pre_rowsets_delete_bitmap);
 DECLARE_mBool(enable_check_agg_and_remove_pre_rowsets_delete_bitmap);
+// Whether to compress the aggregated delete bitmaps with run containers, which are much smaller
+// and faster to subtract for the contiguous deleted rows
+DECLARE_mBool(enable_delete_bitmap_run_optimize);
 
 // The secure path with user files, used in the `local` table function.
 DECLARE_mString(user_files_secure_path);
@@ -1353,6 +1588,21 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// If true, the blocks a group commit load writes to the wal are synced before the load returns.
+// The loads sharing a wal writing at the same time share one sync.
+DECLARE_mBool(group_commit_wal_sync_on_append);
+// The size(bytes) to preallocate for a new wal file, 0 to disable.
+DECLARE_mInt64(group_commit_wal_preallocate_bytes);
+// If true, the commit interval of a group commit load is shortened to keep the p99 visible
+// latency of the table around group_commit_target_visible_latency_ms, but not below
+// group_commit_min_interval_ms, nor above the group_commit_interval_ms of the table.
+DECLARE_mBool(enable_adaptive_group_commit_interval);
+DECLARE_mInt32(group_commit_target_visible_latency_ms);
+DECLARE_mInt32(group_commit_min_interval_ms);
+// The max number of group commit loads of a table accepting loads at the same time. A table
+// uses one more of them for each group_commit_shard_bytes_per_second of its ingest rate.
+DECLARE_mInt32(group_commit_max_shards);
+DECLARE_mInt64(group_commit_shard_bytes_per_second);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1400,6 +1650,24 @@ DECLARE_Bool(enable_snapshot_action);
 DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// If true, the sources of broadcast local exchanger share the columns of the broadcast block
+// instead of copying them.
+DECLARE_mBool(enable_local_exchange_broadcast_zero_copy);
+// If true, the hash join probe evaluates the conjuncts of the join node before gathering the
+// columns which are not used by the conjuncts, so the filtered rows are never materialized.
+DECLARE_mBool(enable_hash_join_lazy_materialize_by_conjuncts);
+// If true, the aggregation on serialized group by keys uses a two-level hash table of 256 sub
+// tables, a huge hash table then grows one sub table at a time instead of rehashing all groups.
+DECLARE_mBool(enable_agg_two_level_hash_table);
+// Once the streaming pre-aggregation passes blocks through, it probes the hash table with one of
+// every this number of blocks to check whether the keys are repeating again, 0 means never.
+DECLARE_mInt32(streaming_agg_reprobe_interval_blocks);
+// The streaming pre-aggregation resumes aggregating if at least this percent of the rows of the
+// probed block hit the hash table.
+DECLARE_mInt32(streaming_agg_resume_min_hit_percent);
+// If true, a block sorted by several integer or date columns is sorted by a radix sort on keys
+// that encode all sort columns of a row into one memcmp comparable byte string.
+DECLARE_mBool(enable_sort_normalized_key);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1431,6 +1699,17 @@ DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// The serialized spill blocks are written to and read from the spill file in batches of
+// about this many bytes, to issue fewer and larger IOs.
+DECLARE_mInt64(spill_io_batch_bytes);
+// A spilled hash join partition whose build side exceeds this many bytes when it is recovered
+// from disk is split into partitions of the next level with a new hash seed.
+DECLARE_mInt64(spill_hash_join_partition_max_bytes);
+// The max levels of splitting a spilled hash join partition.
+DECLARE_mInt32(spill_hash_join_max_repartition_levels);
+// The max bytes per second a query writes to spill files, 0 means no limit. It keeps one large
+// spilling query from taking all the disk bandwidth of the other spilling queries.
+DECLARE_mInt64(spill_write_bytes_per_second_per_query);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1455,6 +1734,16 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// Send a duplicate "get" request when a read of s3 takes longer than the p95 latency of the
+// reads of its size class, and take whichever returns first. Only the reads not larger than
+// s3_hedged_read_max_bytes are hedged.
+DECLARE_mBool(enable_s3_hedged_read);
+DECLARE_mInt64(s3_hedged_read_max_bytes);
+// The min delay before sending the duplicate request
+DECLARE_mInt32(s3_hedged_read_min_delay_ms);
+// The duplicate requests are limited to this percent of all the "get" requests
+DECLARE_mInt32(s3_hedged_read_budget_percent);
+DECLARE_Int32(s3_hedged_read_thread_num);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1508,6 +1797,9 @@ DECLARE_mDouble(max_hdfs_wirter_jni_heap_usage_ratio);
 DECLARE_mInt64(hdfs_jni_write_sleep_milliseconds);
 // The max retry times when hdfs write failed
 DECLARE_mInt64(hdfs_jni_write_max_retry_time);
+// Whether to read the batches of the jni scanners by Arrow C Data Interface,
+// if the jni scanner implements getNextArrowBatch
+DECLARE_mBool(enable_jni_arrow_batch);
 
 // The min thread num for NonBlockCloseThreadPool
 DECLARE_Int64(min_nonblock_close_thread_num);
@@ -1527,6 +1819,25 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to load the tablet metas of a data dir, the metas are loaded one by one if it's not
+// greater than 1
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
+
+// Whether to plan the data pages to read of a segment on remote storage after the row ranges are
+// pruned, so the small page reads of the columns are merged and read ahead
+DECLARE_mBool(enable_segment_read_coalescing);
+
+// Whether to order the column predicates evaluated by a segment iterator by their observed pass
+// rates and costs, instead of the order they are pushed down
+DECLARE_mBool(enable_adaptive_predicate_order);
+
+// Whether to push down the column range implied by a comparison on a monotonic function of the
+// column, e.g. `date_trunc(col, 'day') >= x` implies `col >= x`, to prune with the zone maps
+DECLARE_mBool(enable_monotonic_function_pruning);
+
+// Whether to build the cache friendly fence pointers over the index page of the primary key
+// index when it's loaded, which speeds up the key lookups of the merge-on-write tables
+DECLARE_mBool(enable_pk_index_fence_pointers);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1538,6 +1849,9 @@ DECLARE_Bool(enable_file_logger);
 
 // The minimum row group size when exporting Parquet files.
 DECLARE_Int64(min_row_group_size);
+// Whether to encode and compress the column chunks of a row group in parallel
+// when exporting Parquet files.
+DECLARE_mBool(enable_parquet_writer_parallel_column_write);
 
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
@@ -1568,6 +1882,9 @@ DECLARE_mInt32(check_score_rounds_num);
 
 // MB
 DECLARE_Int32(query_cache_size);
+// Whether the query cache entry of a tablet is still used after new versions, if the rowsets of
+// the new versions are all empty.
+DECLARE_mBool(enable_query_cache_reuse_on_empty_versions);
 DECLARE_Bool(force_regenerate_rowsetid_on_start_error);
 
 // Enable validation to check the correctness of table size.
@@ -1576,6 +1893,11 @@ DECLARE_Bool(enable_table_size_correctness_check);
 DECLARE_mBool(enable_sleep_between_delete_cumu_compaction);
 
 DECLARE_mInt32(compaction_num_per_round);
+// If true, the tablets are picked for compaction by the read amplification the compaction
+// removes, weighted by how often the tablet is queried, per byte to compact, instead of by the
+// compaction score. The tasks of all the data dirs in a round are submitted in that order, so
+// the compaction permits go to the best ones first.
+DECLARE_mBool(enable_compaction_read_amp_score);
 
 DECLARE_mInt32(check_tablet_delete_bitmap_interval_seconds);
 DECLARE_mInt32(check_tablet_delete_bitmap_score_top_n);
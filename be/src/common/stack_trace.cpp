@@ -194,7 +194,7 @@ std::string signalToErrorMessage(int sig, const siginfo_t& info,
     }
 }
 
-static void* getCallerAddress(const ucontext_t& context) {
+void* getCallerAddress(const ucontext_t& context) {
 #if defined(__x86_64__)
     /// Get the address at the time the signal was raised from the RIP (x86-64)
 #if defined(__FreeBSD__)
@@ -99,3 +99,6 @@ protected:
 };
 
 std::string signalToErrorMessage(int sig, const siginfo_t& info, const ucontext_t& context);
+
+/// The address at the time the signal was raised, signal safe
+void* getCallerAddress(const ucontext_t& context);
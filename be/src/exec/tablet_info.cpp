@@ -542,6 +542,68 @@ Status VOlapTablePartitionParam::init() {
     return Status::OK();
 }
 
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
+    VOlapTablePartition* last_partition = nullptr;
+    for (int row = 0; row < rows; ++row) {
+        BlockRowWithIndicator key {block, row, true};
+        // the range partitions don't overlap, so the one containing the key is the one found by
+        // upper_bound of its right end
+        if (last_partition != nullptr && _part_contains(last_partition, key) &&
+            comparator(key, std::tuple {last_partition->end_key.first,
+                                        last_partition->end_key.second, false})) {
+            partitions[row] = last_partition;
+            continue;
+        }
+        find_partition(block, row, partitions[row]);
+        if (!_is_in_partition) {
+            last_partition = partitions[row];
+        }
+    }
+}
+
+bool VOlapTablePartitionParam::_compute_tablet_hashes(vectorized::Block* block,
+                                                      std::vector<uint32_t>& hashes) const {
+    for (auto slot_loc : _distributed_slot_locs) {
+        if (is_column_const(*block->get_by_position(slot_loc).column)) {
+            return false;
+        }
+        switch (_slots[slot_loc]->type()->get_primitive_type()) {
+        case TYPE_VARCHAR:
+        case TYPE_STRING:
+        case TYPE_CHAR:
+        case TYPE_BOOLEAN:
+        case TYPE_TINYINT:
+        case TYPE_SMALLINT:
+        case TYPE_INT:
+        case TYPE_BIGINT:
+        case TYPE_LARGEINT:
+        case TYPE_FLOAT:
+        case TYPE_DOUBLE:
+        case TYPE_DATE:
+        case TYPE_DATETIME:
+        case TYPE_DATEV2:
+        case TYPE_DATETIMEV2:
+        case TYPE_DECIMALV2:
+        case TYPE_DECIMAL32:
+        case TYPE_DECIMAL64:
+        case TYPE_DECIMAL128I:
+        case TYPE_DECIMAL256:
+            break;
+        default:
+            return false;
+        }
+    }
+    auto rows = static_cast<uint32_t>(block->rows());
+    hashes.assign(rows, 0);
+    for (auto slot_loc : _distributed_slot_locs) {
+        block->get_by_position(slot_loc).column->update_crcs_with_value(
+                hashes.data(), _slots[slot_loc]->type()->get_primitive_type(), rows);
+    }
+    return true;
+}
+
 bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
                                               BlockRowWithIndicator key) const {
     VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
@@ -222,6 +222,12 @@ public:
         return (partition != nullptr);
     }
 
+    // find_partition for the first `rows` rows. For range partitions, a row in the partition of
+    // the previous row reuses it without searching the map, since the loaded rows are often
+    // clustered by the partition columns.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
@@ -230,6 +236,14 @@ public:
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
+        std::vector<uint32_t> hashes;
+        if (!_distributed_slot_locs.empty() && partition_tablets_buffer == nullptr &&
+            _compute_tablet_hashes(block, hashes)) {
+            for (auto index : indexes) {
+                tablet_indexes[index] = hashes[index] % partitions[index]->num_buckets;
+            }
+            return;
+        }
         if (!_distributed_slot_locs.empty()) {
             //TODO: refactor by saving the hash values. then we can calculate in columnwise.
             compute_function = [this](vectorized::Block* block, uint32_t row,
@@ -312,6 +326,11 @@ private:
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
+    // Compute the bucket hashes of all the rows of `block` column by column, the same as
+    // RawValue::zlib_crc32 row by row. Return false if a distributed column is const or of a
+    // type not hashed the same way by the column.
+    bool _compute_tablet_hashes(vectorized::Block* block, std::vector<uint32_t>& hashes) const;
+
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
     TOlapTablePartitionParam _t_param;
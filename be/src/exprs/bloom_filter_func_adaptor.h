@@ -56,6 +56,10 @@ public:
 
     bool test(uint32_t data) const { return _bloom_filter->find(data); }
 
+    void test_batch(const uint32_t* hashes, size_t n, uint8_t* results) const {
+        _bloom_filter->find_batch(hashes, n, results);
+    }
+
     template <typename fixed_len_to_uint32_method, typename T>
     bool test_element(T element) const {
         if constexpr (std::is_same_v<T, StringRef>) {
@@ -139,20 +143,26 @@ struct CommonFindOp {
         }
 
         const auto size = column->size();
+        // hash a chunk of rows first, then probe the filter for the whole chunk
+        uint32_t hashes[FIND_BATCH_ROWS];
+        for (size_t begin = 0; begin < size; begin += FIND_BATCH_ROWS) {
+            const auto end = std::min(size, begin + FIND_BATCH_ROWS);
+            for (size_t i = begin; i < end; i++) {
+                hashes[i - begin] = fixed_len_to_uint32_method()(data[i]);
+            }
+            bloom_filter.test_batch(hashes, end - begin, results + begin);
+        }
         if (nullmap) {
+            const bool contain_null = bloom_filter.contain_null();
             for (size_t i = 0; i < size; i++) {
-                if (!nullmap[i]) {
-                    results[i] = bloom_filter.test_element<fixed_len_to_uint32_method>(data[i]);
-                } else {
-                    results[i] = bloom_filter.contain_null();
+                if (nullmap[i]) {
+                    results[i] = contain_null;
                 }
             }
-        } else {
-            for (size_t i = 0; i < size; i++) {
-                results[i] = bloom_filter.test_element<fixed_len_to_uint32_method>(data[i]);
-            }
         }
     }
+
+    static constexpr size_t FIND_BATCH_ROWS = 256;
 };
 
 template <typename fixed_len_to_uint32_method>
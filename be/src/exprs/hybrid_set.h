@@ -19,6 +19,10 @@
 
 #include <gen_cpp/internal_service.pb.h>
 
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
 #include "common/object_pool.h"
 #include "exprs/filter_base.h"
 #include "runtime/primitive_type.h"
@@ -32,6 +36,11 @@ namespace doris {
 
 constexpr int FIXED_CONTAINER_MAX_SIZE = 8;
 
+// A dynamic integer set is probed by a bitmap of [min, max] if the range has at most
+// DENSE_BITMAP_BITS_PER_VALUE bits per value and at most DENSE_BITMAP_MAX_BITS bits.
+constexpr uint64_t DENSE_BITMAP_BITS_PER_VALUE = 32;
+constexpr uint64_t DENSE_BITMAP_MAX_BITS = 1ULL << 24;
+
 /**
  * Fix Container can use simd to improve performance. 1 <= N <= 8 can be improved performance by test. FIXED_CONTAINER_MAX_SIZE = 8.
  * @tparam T Element Type
@@ -239,6 +248,10 @@ public:
 
     virtual void to_pb(PInFilter* filter) = 0;
 
+    // Called after the set is built and before it is probed concurrently, the set may choose a
+    // faster representation for probing. The set should not be changed any more.
+    virtual void prepare_for_probe() {}
+
     class IteratorBase {
     public:
         IteratorBase() = default;
@@ -268,14 +281,19 @@ public:
             _contain_null = true;
             return;
         }
+        _use_dense_bitmap = false;
         _set.insert(*reinterpret_cast<const ElementType*>(data));
     }
-    void clear() override { _set.clear(); }
+    void clear() override {
+        _use_dense_bitmap = false;
+        _set.clear();
+    }
 
     void insert(void* data, size_t /*unused*/) override { insert(data); }
 
     void insert_fixed_len(const vectorized::ColumnPtr& column, size_t start) override {
         const auto size = column->size();
+        _use_dense_bitmap = false;
 
         if (column->is_nullable()) {
             const auto* nullable = assert_cast<const vectorized::ColumnNullable*>(column.get());
@@ -303,7 +321,13 @@ public:
     int size() override { return _set.size(); }
 
     bool find(const void* data) const override {
-        return _set.find(*reinterpret_cast<const ElementType*>(data));
+        const auto& value = *reinterpret_cast<const ElementType*>(data);
+        if constexpr (SUPPORT_DENSE_BITMAP) {
+            if (_use_dense_bitmap) {
+                return _find_in_dense_bitmap(value);
+            }
+        }
+        return _set.find(value);
     }
 
     bool find(const void* data, size_t /*unused*/) const override { return find(data); }
@@ -346,17 +370,32 @@ public:
         }
 
         auto* __restrict result_data = results.data();
-        for (size_t i = 0; i < rows; ++i) {
-            if constexpr (!is_nullable && !is_negative) {
-                result_data[i] = _set.find(data[i]);
-            } else if constexpr (!is_nullable && is_negative) {
-                result_data[i] = !_set.find(data[i]);
-            } else if constexpr (is_nullable && !is_negative) {
-                result_data[i] = _set.find(data[i]) & (!null_map_data[i]);
-            } else { // (is_nullable && is_negative)
-                result_data[i] = !(_set.find(data[i]) & (!null_map_data[i]));
+        auto do_find = [&](auto&& find) {
+            for (size_t i = 0; i < rows; ++i) {
+                if constexpr (!is_nullable && !is_negative) {
+                    result_data[i] = find(data[i]);
+                } else if constexpr (!is_nullable && is_negative) {
+                    result_data[i] = !find(data[i]);
+                } else if constexpr (is_nullable && !is_negative) {
+                    result_data[i] = find(data[i]) & (!null_map_data[i]);
+                } else { // (is_nullable && is_negative)
+                    result_data[i] = !(find(data[i]) & (!null_map_data[i]));
+                }
+            }
+        };
+        if constexpr (SUPPORT_DENSE_BITMAP) {
+            if (_use_dense_bitmap) {
+                do_find([this](const ElementType& value) { return _find_in_dense_bitmap(value); });
+                return;
             }
         }
+        do_find([this](const ElementType& value) { return _set.find(value); });
+    }
+
+    void prepare_for_probe() override {
+        if constexpr (SUPPORT_DENSE_BITMAP) {
+            std::call_once(_prepare_for_probe_flag, [this]() { _build_dense_bitmap(); });
+        }
     }
 
     class Iterator : public IteratorBase {
@@ -386,8 +425,52 @@ public:
     void to_pb(PInFilter* filter) override { set_pb(filter, get_convertor<ElementType>()); }
 
 private:
+    static constexpr bool SUPPORT_DENSE_BITMAP = std::is_integral_v<ElementType> &&
+                                                 sizeof(ElementType) <= sizeof(uint64_t) &&
+                                                 !IsFixedContainer<ContainerType>::value;
+
+    // the offset of a value less than `_dense_min` wraps around to a large one
+    bool _find_in_dense_bitmap(const ElementType& value) const {
+        const uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(_dense_min);
+        return offset < _dense_bits && ((_dense_bitmap[offset >> 6] >> (offset & 63)) & 1);
+    }
+
+    void _build_dense_bitmap() {
+        if (_set.size() == 0) {
+            return;
+        }
+        ElementType min_value = *_set.begin();
+        ElementType max_value = min_value;
+        for (const auto& value : _set) {
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+        }
+        const uint64_t bits =
+                static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value) + 1;
+        // bits is 0 if the range covers all 64-bit integers
+        if (bits == 0 || bits > DENSE_BITMAP_MAX_BITS ||
+            bits > _set.size() * DENSE_BITMAP_BITS_PER_VALUE) {
+            return;
+        }
+        _dense_min = min_value;
+        _dense_bits = bits;
+        _dense_bitmap.assign((bits + 63) / 64, 0);
+        for (const auto& value : _set) {
+            const uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value);
+            _dense_bitmap[offset >> 6] |= 1ULL << (offset & 63);
+        }
+        _use_dense_bitmap = true;
+    }
+
     ContainerType _set;
     ObjectPool _pool;
+
+    // a bitmap of the values in [_dense_min, _dense_min + _dense_bits) for a dense integer set
+    bool _use_dense_bitmap = false;
+    ElementType _dense_min {};
+    uint64_t _dense_bits = 0;
+    std::vector<uint64_t> _dense_bitmap;
+    std::once_flag _prepare_for_probe_flag;
 };
 
 template <typename _ContainerType = DynamicContainer<std::string>>
@@ -55,6 +55,9 @@ constexpr static std::string_view RELEASE = "release";
 constexpr static std::string_view BASE_PATH = "base_path";
 constexpr static std::string_view RELEASED_ELEMENTS = "released_elements";
 constexpr static std::string_view VALUE = "value";
+constexpr static std::string_view READ = "read";
+constexpr static std::string_view OFFSET = "offset";
+constexpr static std::string_view SIZE = "size";
 
 Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metrics) {
     req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.data());
@@ -133,7 +136,62 @@ Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metri
     return st;
 }
 
+// Read a range of a file cached here for a peer BE, see FileCachePeers.
+void FileCacheAction::_handle_read(HttpRequest* req) {
+    const std::string& file_name = req->param(VALUE.data());
+    size_t offset = 0;
+    size_t size = 0;
+    try {
+        offset = std::stoull(req->param(OFFSET.data()));
+        size = std::stoull(req->param(SIZE.data()));
+    } catch (...) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                Status::InvalidArgument("invalid offset or size").to_json());
+        return;
+    }
+    if (file_name.empty() || size == 0) {
+        HttpChannel::send_reply(
+                req, HttpStatus::BAD_REQUEST,
+                Status::InvalidArgument("missing parameter: {} is required", VALUE.data())
+                        .to_json());
+        return;
+    }
+    io::UInt128Wrapper hash = io::BlockFileCache::hash(file_name);
+    io::BlockFileCache* cache = io::FileCacheFactory::instance()->get_by_path(hash);
+    auto blocks = cache->get_blocks_by_key(hash);
+    std::string data(size, '\0');
+    size_t cur_offset = offset;
+    auto it = blocks.upper_bound(offset);
+    if (it != blocks.begin()) {
+        --it;
+    }
+    for (; cur_offset < offset + size && it != blocks.end(); ++it) {
+        const auto& block = it->second;
+        if (block->offset() > cur_offset || block->range().right < cur_offset) {
+            break;
+        }
+        size_t file_offset = cur_offset - block->offset();
+        size_t read_size =
+                std::min(offset + size - cur_offset, block->range().size() - file_offset);
+        if (!block->read(Slice(data.data() + (cur_offset - offset), read_size), file_offset)
+                     .ok()) {
+            break;
+        }
+        cur_offset += read_size;
+    }
+    if (cur_offset != offset + size) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND);
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/octet-stream");
+    HttpChannel::send_reply(req, HttpStatus::OK, data);
+}
+
 void FileCacheAction::handle(HttpRequest* req) {
+    if (req->param(OP.data()) == READ) {
+        _handle_read(req);
+        return;
+    }
     std::string json_metrics;
     Status status = _handle_header(req, &json_metrics);
     std::string status_result = status.to_json();
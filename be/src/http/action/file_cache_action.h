@@ -38,5 +38,7 @@ public:
 
 private:
     Status _handle_header(HttpRequest* req, std::string* json_metrics);
+
+    void _handle_read(HttpRequest* req);
 };
 } // namespace doris
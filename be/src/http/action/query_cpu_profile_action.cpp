@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "http/action/query_cpu_profile_action.h"
+
+#include <string>
+
+#include "common/config.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/query_cpu_profiler.h"
+#include "util/string_parser.hpp"
+#include "util/uid_util.h"
+
+namespace doris {
+void QueryCpuProfileAction::handle(HttpRequest* req) {
+    if (!config::enable_query_cpu_profiler) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND,
+                                "query cpu profiler is disabled, see enable_query_cpu_profiler");
+        return;
+    }
+    const auto& query_id_param = req->param("query_id");
+    TUniqueId query_id;
+    if (!query_id_param.empty() && !parse_id(query_id_param, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + query_id_param);
+        return;
+    }
+    size_t top_n = 10;
+    if (const auto& top_n_param = req->param("top_n"); !top_n_param.empty()) {
+        StringParser::ParseResult result;
+        top_n = StringParser::string_to_unsigned_int<size_t>(
+                top_n_param.data(), static_cast<int>(top_n_param.size()), &result);
+        if (result != StringParser::PARSE_SUCCESS) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "invalid top_n: " + top_n_param);
+            return;
+        }
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HttpHeaders::JSON_TYPE.data());
+    HttpChannel::send_reply(
+            req, HttpStatus::OK,
+            QueryCpuProfiler::instance()->report(query_id_param.empty() ? nullptr : &query_id,
+                                                 top_n));
+}
+} // namespace doris
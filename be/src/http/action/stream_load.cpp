@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -48,6 +49,7 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/utils.h"
+#include "io/fs/stream_load_chunk_reader.h"
 #include "io/fs/stream_load_pipe.h"
 #include "olap/storage_engine.h"
 #include "runtime/client_cache.h"
@@ -83,6 +85,20 @@ bvar::LatencyRecorder g_stream_load_commit_and_publish_latency_ms("stream_load",
 static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
 static const std::string CHUNK = "chunked";
 
+// The body can be cut at any line delimiter only if each line is a row, in a plain csv without
+// enclose, header lines or a custom line delimiter.
+static bool can_parse_in_parallel(HttpRequest* http_req, const StreamLoadContext* ctx) {
+    if (!ctx->use_streaming || ctx->group_commit || config::stream_load_parallel_parse_num <= 1 ||
+        !iequal(http_req->header(HTTP_PARALLEL_PARSE), "true")) {
+        return false;
+    }
+    const auto& skip_lines = http_req->header(HTTP_SKIP_LINES);
+    return ctx->format == TFileFormatType::FORMAT_CSV_PLAIN && ctx->header_type.empty() &&
+           http_req->header(HTTP_ENCLOSE).empty() &&
+           http_req->header(HTTP_LINE_DELIMITER).empty() &&
+           (skip_lines.empty() || skip_lines == "0");
+}
+
 #ifdef BE_TEST
 TStreamLoadPutResult k_stream_load_put_result;
 #endif
@@ -357,7 +373,9 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     int64_t start_read_data_time = MonotonicNanos();
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
+        // the buffer is not larger than the data, the small loads receive only a few bytes
+        Status st = ByteBuffer::allocate(
+                std::min(evbuffer_get_length(evbuf), static_cast<size_t>(128 * 1024)), &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -365,7 +383,11 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
         auto remove_bytes = evbuffer_remove(evbuf, bb->ptr, bb->capacity);
         bb->pos = remove_bytes;
         bb->flip();
-        st = ctx->body_sink->append(bb);
+        if (ctx->pipe != nullptr) {
+            st = ctx->pipe->append_without_wait(bb);
+        } else {
+            st = ctx->body_sink->append(bb);
+        }
         if (!st.ok()) {
             LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
             ctx->status = st;
@@ -373,6 +395,14 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
         }
         ctx->receive_bytes += remove_bytes;
     }
+    // Instead of blocking the event thread which serves many connections until the consumer
+    // drains the pipe, stop reading this connection and let the consumer resume it.
+    if (ctx->pipe != nullptr && ctx->pipe->current_capacity() >= ctx->pipe->max_capacity()) {
+        auto resume_reading = req->pause_reading();
+        if (!ctx->pipe->notify_when_drained(resume_reading)) {
+            resume_reading();
+        }
+    }
     int64_t read_data_time = MonotonicNanos() - start_read_data_time;
     int64_t last_receive_and_read_data_cost_nanos = ctx->receive_and_read_data_cost_nanos;
     ctx->read_data_cost_nanos += read_data_time;
@@ -622,6 +652,12 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req,
         }
         request.__set_skip_lines(skip_lines);
     }
+    if (can_parse_in_parallel(http_req, ctx.get())) {
+        // the rows of a body are not loaded in order any more, so it's only enabled on demand
+        ctx->pipe_splitter = std::make_shared<io::StreamLoadPipeSplitter>(
+                ctx->pipe, '\n', config::stream_load_parallel_parse_chunk_size);
+        ctx->parallel_parse_num = config::stream_load_parallel_parse_num;
+    }
     if (!http_req->header(HTTP_ENABLE_PROFILE).empty()) {
         if (iequal(http_req->header(HTTP_ENABLE_PROFILE), "true")) {
             request.__set_enable_profile(true);
@@ -71,5 +71,6 @@ static const std::string HTTP_WAL_ID_KY = "wal_id";
 static const std::string HTTP_AUTH_CODE = "auth_code"; // deprecated
 static const std::string HTTP_GROUP_COMMIT = "group_commit";
 static const std::string HTTP_CLOUD_CLUSTER = "cloud_cluster";
+static const std::string HTTP_PARALLEL_PARSE = "parallel_parse";
 
 } // namespace doris
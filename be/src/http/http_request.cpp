@@ -18,6 +18,8 @@
 #include "http/http_request.h"
 
 #include <event2/buffer.h>
+#include <event2/bufferevent.h>
+#include <event2/event.h>
 #include <event2/http.h>
 #include <event2/http_struct.h>
 #include <event2/keyvalq_struct.h>
@@ -33,9 +35,26 @@ namespace doris {
 
 static std::string s_empty = "";
 
+struct HttpReadingState {
+    event_base* base = nullptr;
+    // Reset when the request is freed. It's only accessed in the event thread, like the request.
+    evhttp_connection* conn = nullptr;
+};
+
+static void on_resume_reading(evutil_socket_t /*fd*/, short /*events*/, void* arg) {
+    std::unique_ptr<std::shared_ptr<HttpReadingState>> state(
+            static_cast<std::shared_ptr<HttpReadingState>*>(arg));
+    if ((*state)->conn != nullptr) {
+        bufferevent_enable(evhttp_connection_get_bufferevent((*state)->conn), EV_READ);
+    }
+}
+
 HttpRequest::HttpRequest(evhttp_request* evhttp_request) : _ev_req(evhttp_request) {}
 
 HttpRequest::~HttpRequest() {
+    if (_reading_state != nullptr) {
+        _reading_state->conn = nullptr;
+    }
     if (_handler_ctx != nullptr) {
         DCHECK(_handler != nullptr);
         _handler->free_handler_ctx(_handler_ctx);
@@ -133,4 +152,23 @@ const char* HttpRequest::remote_host() const {
     return _ev_req->remote_host;
 }
 
+std::function<void()> HttpRequest::pause_reading() {
+    auto* conn = evhttp_request_get_connection(_ev_req);
+    if (_reading_state == nullptr) {
+        _reading_state = std::make_shared<HttpReadingState>();
+        _reading_state->base = evhttp_connection_get_base(conn);
+        _reading_state->conn = conn;
+    }
+    bufferevent_disable(evhttp_connection_get_bufferevent(conn), EV_READ);
+    return [state = _reading_state]() {
+        // the connection is resumed in the event thread, the event base is thread safe
+        auto* arg = new std::shared_ptr<HttpReadingState>(state);
+        timeval tv {0, 0};
+        if (event_base_once(state->base, -1, EV_TIMEOUT, on_resume_reading, arg, &tv) != 0) {
+            LOG(WARNING) << "failed to resume reading the HTTP request";
+            delete arg;
+        }
+    };
+}
+
 } // namespace doris
@@ -19,6 +19,7 @@
 
 #include <glog/logging.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -31,6 +32,7 @@ struct evhttp_request;
 namespace doris {
 
 class HttpHandler;
+struct HttpReadingState;
 
 class HttpRequest {
 public:
@@ -79,6 +81,11 @@ public:
 
     const char* remote_host() const;
 
+    // Stop reading the body from the connection, so the client is blocked by the TCP flow control.
+    // It must be called in the event thread of the request. The returned function resumes the
+    // reading, it can be called in any thread, even after the request is freed.
+    std::function<void()> pause_reading();
+
 private:
     HttpMethod _method;
     std::string _uri;
@@ -93,6 +100,8 @@ private:
 
     std::shared_ptr<void> _handler_ctx;
     std::string _request_body;
+
+    std::shared_ptr<HttpReadingState> _reading_state;
 };
 
 } // namespace doris
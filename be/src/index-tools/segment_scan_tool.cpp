@@ -0,0 +1,380 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "io/file_factory.h"
+#include "io/fs/local_file_system.h"
+#include "json2pb/json_to_pb.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/predicate_creator.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/schema.h"
+#include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/mem_info.h"
+#include "util/stopwatch.hpp"
+#include "util/string_util.h"
+#include "vec/common/arena.h"
+#include "vec/core/block.h"
+
+using doris::ColumnId;
+using doris::ColumnPredicate;
+using doris::OlapReaderStatistics;
+using doris::Status;
+using doris::TabletSchema;
+using doris::TabletSchemaSPtr;
+using doris::TCondition;
+using doris::segment_v2::Segment;
+
+DEFINE_string(conf, "", "be.conf to load the configs of the caches from, optional");
+DEFINE_string(file, "", "segment file path, a local path or s3://bucket/key");
+DEFINE_string(s3_properties, "",
+              "properties of the s3 file, AWS_ENDPOINT=...,AWS_REGION=...,AWS_ACCESS_KEY=...");
+DEFINE_string(tablet_meta_file, "",
+              "tablet meta json file of the segment, e.g. the output of meta_tool show_meta");
+DEFINE_string(columns, "", "columns to read, separated by comma, all the columns if empty");
+DEFINE_string(predicates, "",
+              "predicates separated by semicolon, e.g. \"k1>=10;k2=abc;k3 in 1,2,3;k4 is null\"");
+DEFINE_bool(use_page_cache, true, "read the pages through the storage page cache");
+DEFINE_int32(batch_size, 4064, "rows of a block");
+DEFINE_int32(iterations, 3, "times to scan the segment, the later scans may hit the page cache");
+
+std::string get_usage(const std::string& progname) {
+    std::stringstream ss;
+    ss << progname << " scans a segment file and reports the costs of the read path.\n";
+    ss << "Usage:\n";
+    ss << "./segment_scan_tool --file=/path/to/segment/file --tablet_meta_file=/path/to/json "
+          "--columns=k1,v1 --predicates=\"k1>=10;v1 in a,b\"\n";
+    ss << "./segment_scan_tool --file=s3://bucket/path/to/segment/file "
+          "--s3_properties=AWS_ENDPOINT=...,AWS_REGION=...,AWS_ACCESS_KEY=...,AWS_SECRET_KEY=... "
+          "--tablet_meta_file=/path/to/json\n";
+    return ss.str();
+}
+
+std::vector<std::string> split(const std::string& str, char delimiter) {
+    std::vector<std::string> parts;
+    std::stringstream ss(str);
+    std::string part;
+    while (std::getline(ss, part, delimiter)) {
+        part.erase(0, part.find_first_not_of(' '));
+        part.erase(part.find_last_not_of(' ') + 1);
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+// Parse "col op value" into TCondition, op is one of =, !=, <, <=, >, >=, in and is.
+Status parse_condition(const std::string& str, TCondition* condition) {
+    std::string lower = doris::to_lower(str);
+    size_t pos = std::string::npos;
+    size_t op_size = 0;
+    for (const auto* op : {" in ", " is "}) {
+        pos = lower.find(op);
+        if (pos != std::string::npos) {
+            condition->condition_op = std::string(op) == " in " ? "*=" : "is";
+            op_size = 4;
+            break;
+        }
+    }
+    if (pos == std::string::npos) {
+        pos = str.find_first_of("=!<>");
+        if (pos == std::string::npos) {
+            return Status::InvalidArgument("no operator in predicate {}", str);
+        }
+        op_size = pos + 1 < str.size() && str[pos + 1] == '=' ? 2 : 1;
+        std::string op = str.substr(pos, op_size);
+        if (op == "<" || op == ">") {
+            // the range operators of TCondition
+            op += op;
+        } else if (op == "!") {
+            return Status::InvalidArgument("bad operator in predicate {}", str);
+        }
+        condition->condition_op = op;
+    }
+    auto column = split(str.substr(0, pos), ' ');
+    if (column.size() != 1) {
+        return Status::InvalidArgument("bad column in predicate {}", str);
+    }
+    condition->column_name = column[0];
+    std::string values = str.substr(pos + op_size);
+    if (condition->condition_op == "*=") {
+        condition->condition_values = split(values, ',');
+    } else {
+        // a single value
+        condition->condition_values = split(values, '\n');
+    }
+    if (condition->condition_values.empty()) {
+        return Status::InvalidArgument("no value in predicate {}", str);
+    }
+    return Status::OK();
+}
+
+Status create_file_system(doris::io::FileSystemSPtr* fs) {
+    if (!FLAGS_file.starts_with("s3://")) {
+        *fs = doris::io::global_local_filesystem();
+        return Status::OK();
+    }
+    std::map<std::string, std::string> properties;
+    for (const auto& kv : split(FLAGS_s3_properties, ',')) {
+        size_t pos = kv.find('=');
+        if (pos == std::string::npos) {
+            return Status::InvalidArgument("bad s3 property {}", kv);
+        }
+        properties[kv.substr(0, pos)] = kv.substr(pos + 1);
+    }
+    doris::io::FSPropertiesRef fs_properties(doris::TFileType::FILE_S3);
+    fs_properties.properties = &properties;
+    doris::io::FileDescription file_description {.path = FLAGS_file};
+    *fs = DORIS_TRY(doris::FileFactory::create_fs(fs_properties, file_description));
+    return Status::OK();
+}
+
+Status load_tablet_schema(TabletSchemaSPtr* tablet_schema) {
+    std::ifstream in(FLAGS_tablet_meta_file);
+    if (!in) {
+        return Status::InvalidArgument("failed to open tablet meta file {}",
+                                       FLAGS_tablet_meta_file);
+    }
+    std::stringstream json;
+    json << in.rdbuf();
+    doris::TabletMetaPB tablet_meta_pb;
+    std::string error;
+    if (!json2pb::JsonToProtoMessage(json.str(), &tablet_meta_pb, &error)) {
+        return Status::InvalidArgument("failed to parse tablet meta: {}", error);
+    }
+    *tablet_schema = std::make_shared<TabletSchema>();
+    (*tablet_schema)->init_from_pb(tablet_meta_pb.schema());
+    return Status::OK();
+}
+
+void print_stat(const std::string& name, int64_t value) {
+    std::cout << "  " << std::left << std::setw(44) << name << value << std::endl;
+}
+
+void print_timer(const std::string& name, int64_t ns) {
+    std::cout << "  " << std::left << std::setw(44) << name << std::fixed << std::setprecision(3)
+              << static_cast<double>(ns) / 1000000 << " ms" << std::endl;
+}
+
+void print_stats(const OlapReaderStatistics& stats, const doris::io::FileCacheStatistics& cache,
+                 int64_t wall_ns, int64_t block_bytes) {
+    double seconds = std::max(static_cast<double>(wall_ns) / 1000000000, 1e-9);
+    std::cout << "throughput:" << std::endl;
+    print_stat("RowsReturned", stats.raw_rows_read);
+    print_stat("BlockBytes", block_bytes);
+    print_stat("RowsPerSecond", static_cast<int64_t>(stats.raw_rows_read / seconds));
+    print_stat("DecodedBytesPerSecond", static_cast<int64_t>(block_bytes / seconds));
+    print_stat("CompressedBytesRead", stats.compressed_bytes_read);
+    print_stat("UncompressedBytesRead", stats.uncompressed_bytes_read);
+    std::cout << "pages:" << std::endl;
+    print_stat("TotalPagesNum", stats.total_pages_num);
+    print_stat("CachedPagesNum", stats.cached_pages_num);
+    print_stat("CompressedCachedPagesNum", stats.compressed_cached_pages_num);
+    print_stat("CoalescedReadRanges", stats.coalesced_read_ranges);
+    print_stat("LocalIOUseFileCache", cache.num_local_io_total);
+    print_stat("RemoteIOUseFileCache", cache.num_remote_io_total);
+    print_stat("BytesReadFromLocal", cache.bytes_read_from_local);
+    print_stat("BytesReadFromRemote", cache.bytes_read_from_remote);
+    std::cout << "filters:" << std::endl;
+    print_stat("RowsKeyRangeFiltered", stats.rows_key_range_filtered);
+    print_stat("RowsZoneMapFiltered", stats.rows_stats_filtered);
+    print_stat("RowsBloomFilterFiltered", stats.rows_bf_filtered);
+    print_stat("RowsDictFiltered", stats.rows_dict_filtered);
+    print_stat("RowsInvertedIndexFiltered", stats.rows_inverted_index_filtered);
+    print_stat("RowsVectorPredFiltered", stats.rows_vec_cond_filtered);
+    print_stat("RowsShortCircuitPredFiltered", stats.rows_short_circuit_cond_filtered);
+    std::cout << "timers:" << std::endl;
+    print_timer("WallTime", wall_ns);
+    print_timer("SegmentIteratorInitTime", stats.segment_iterator_init_timer_ns);
+    print_timer("SegmentLoadIndexTime", stats.segment_load_index_timer_ns);
+    print_timer("IndexLoadTime", stats.index_load_ns);
+    print_timer("BlockInitTime", stats.block_init_ns);
+    print_timer("GenerateRowRangeByZoneMapTime", stats.generate_row_ranges_by_zonemap_ns);
+    print_timer("GenerateRowRangeByBloomFilterTime", stats.generate_row_ranges_by_bf_ns);
+    print_timer("GenerateRowRangeByDictTime", stats.generate_row_ranges_by_dict_ns);
+    print_timer("GenerateRowRangeByColumnConditionsTime",
+                stats.generate_row_ranges_by_column_conditions_ns);
+    print_timer("InvertedIndexFilterTime", stats.inverted_index_filter_timer);
+    print_timer("BlockLoadTime", stats.block_load_ns);
+    print_timer("PredicateColumnReadTime", stats.predicate_column_read_ns);
+    print_timer("NonPredicateReadTime", stats.non_predicate_read_ns);
+    print_timer("LazyReadTime", stats.lazy_read_ns);
+    print_timer("VectorPredEvalTime", stats.vec_cond_ns);
+    print_timer("ShortPredEvalTime", stats.short_cond_ns);
+    print_timer("OutputColumnTime", stats.output_col_ns);
+    print_timer("IOTimer", stats.io_ns);
+    print_timer("DecompressorTimer", stats.decompress_ns);
+}
+
+Status scan(const std::shared_ptr<Segment>& segment, const TabletSchemaSPtr& tablet_schema,
+            const std::vector<ColumnId>& cids,
+            const std::vector<std::unique_ptr<ColumnPredicate>>& predicates, int iteration) {
+    OlapReaderStatistics stats;
+    doris::io::FileCacheStatistics cache_stats;
+    doris::StorageReadOptions opts;
+    opts.stats = &stats;
+    opts.tablet_schema = tablet_schema;
+    opts.use_page_cache = FLAGS_use_page_cache;
+    opts.block_row_max = FLAGS_batch_size;
+    opts.io_ctx.reader_type = doris::ReaderType::READER_QUERY;
+    opts.io_ctx.file_cache_stats = &cache_stats;
+    for (const auto& pred : predicates) {
+        opts.column_predicates.push_back(pred.get());
+        auto& block_pred = opts.col_id_to_predicates[pred->column_id()];
+        if (block_pred == nullptr) {
+            block_pred = doris::AndBlockColumnPredicate::create_shared();
+        }
+        block_pred->add_column_predicate(
+                doris::SingleColumnBlockPredicate::create_unique(pred.get()));
+    }
+
+    doris::MonotonicStopWatch watch;
+    watch.start();
+    std::unique_ptr<doris::RowwiseIterator> iter;
+    auto schema = std::make_shared<doris::Schema>(tablet_schema->columns(), cids);
+    RETURN_IF_ERROR(segment->new_iterator(schema, opts, &iter));
+    auto block = tablet_schema->create_block_by_cids(cids);
+    int64_t block_bytes = 0;
+    while (true) {
+        block.clear_column_data();
+        Status st = iter->next_batch(&block);
+        if (st.is<doris::ErrorCode::END_OF_FILE>()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        block_bytes += block.bytes();
+    }
+    iter.reset();
+    int64_t wall_ns = watch.elapsed_time();
+
+    std::cout << "==================== scan " << iteration << " ====================" << std::endl;
+    print_stats(stats, cache_stats, wall_ns, block_bytes);
+    return Status::OK();
+}
+
+Status run() {
+    TabletSchemaSPtr tablet_schema;
+    RETURN_IF_ERROR(load_tablet_schema(&tablet_schema));
+
+    std::vector<ColumnId> cids;
+    if (FLAGS_columns.empty()) {
+        for (ColumnId cid = 0; cid < tablet_schema->num_columns(); ++cid) {
+            cids.push_back(cid);
+        }
+    }
+    for (const auto& name : split(FLAGS_columns, ',')) {
+        int32_t cid = tablet_schema->field_index(name);
+        if (cid < 0) {
+            return Status::InvalidArgument("column {} not found", name);
+        }
+        cids.push_back(cid);
+    }
+
+    doris::vectorized::Arena arena;
+    std::vector<std::unique_ptr<ColumnPredicate>> predicates;
+    for (const auto& str : split(FLAGS_predicates, ';')) {
+        TCondition condition;
+        RETURN_IF_ERROR(parse_condition(str, &condition));
+        int32_t cid = tablet_schema->field_index(condition.column_name);
+        if (cid < 0) {
+            return Status::InvalidArgument("column {} not found", condition.column_name);
+        }
+        predicates.emplace_back(doris::parse_to_predicate(tablet_schema->column(cid), cid,
+                                                          condition, arena));
+        // the predicate columns must be read
+        cids.push_back(cid);
+    }
+    std::sort(cids.begin(), cids.end());
+    cids.erase(std::unique(cids.begin(), cids.end()), cids.end());
+
+    doris::io::FileSystemSPtr fs;
+    RETURN_IF_ERROR(create_file_system(&fs));
+    // the rowset id and the segment id are in the name of the segment file, {rowset_id}_{id}.dat
+    std::string file_name = std::filesystem::path(FLAGS_file).stem().string();
+    doris::RowsetId rowset_id;
+    uint32_t segment_id = 0;
+    size_t pos = file_name.rfind('_');
+    if (pos != std::string::npos && pos + 1 < file_name.size() &&
+        std::all_of(file_name.begin() + pos + 1, file_name.end(), ::isdigit)) {
+        rowset_id.init(file_name.substr(0, pos));
+        segment_id = std::stoul(file_name.substr(pos + 1));
+    }
+
+    doris::MonotonicStopWatch watch;
+    watch.start();
+    OlapReaderStatistics open_stats;
+    std::shared_ptr<Segment> segment;
+    RETURN_IF_ERROR(Segment::open(fs, FLAGS_file, 0, segment_id, rowset_id, tablet_schema,
+                                  doris::io::FileReaderOptions::DEFAULT, &segment, {},
+                                  &open_stats));
+    std::cout << "segment " << FLAGS_file << ", rows " << segment->num_rows() << ", open time "
+              << watch.elapsed_time() / 1000 << " us" << std::endl;
+
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        RETURN_IF_ERROR(scan(segment, tablet_schema, cids, predicates, i));
+    }
+    return Status::OK();
+}
+
+int main(int argc, char** argv) {
+    SCOPED_INIT_THREAD_CONTEXT();
+    std::string usage = get_usage(argv[0]);
+    gflags::SetUsageMessage(usage);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (FLAGS_file.empty() || FLAGS_tablet_meta_file.empty()) {
+        std::cout << usage << std::endl;
+        return -1;
+    }
+    if (!FLAGS_conf.empty() && !doris::config::init(FLAGS_conf.c_str(), false)) {
+        std::cerr << "failed to load conf " << FLAGS_conf << std::endl;
+        return -1;
+    }
+    doris::CpuInfo::init();
+    doris::MemInfo::init();
+    Status st = doris::ExecEnv::GetInstance()->init_mem_env_for_tools();
+    if (st.ok()) {
+        st = run();
+    }
+    if (!st.ok()) {
+        std::cerr << "failed to scan segment: " << st << std::endl;
+        return -1;
+    }
+    return 0;
+}
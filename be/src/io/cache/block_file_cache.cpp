@@ -53,12 +53,15 @@
 
 namespace doris::io {
 
+static LockContentionSite g_file_cache_lock_site("file_cache");
+
 BlockFileCache::BlockFileCache(const std::string& cache_base_path,
                                const FileCacheSettings& cache_settings)
         : _cache_base_path(cache_base_path),
           _capacity(cache_settings.capacity),
           _max_file_block_size(cache_settings.max_file_block_size),
-          _max_query_cache_size(cache_settings.max_query_cache_size) {
+          _max_query_cache_size(cache_settings.max_query_cache_size),
+          _cache_lock_site(&g_file_cache_lock_site) {
     _cur_cache_size_metrics = std::make_shared<bvar::Status<size_t>>(_cache_base_path.c_str(),
                                                                      "file_cache_cache_size", 0);
     _cache_capacity_metrics = std::make_shared<bvar::Status<size_t>>(
@@ -227,6 +230,8 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
             _cache_base_path.c_str(), "file_cache_evict_in_advance_latency_us");
     _lru_dump_latency_us = std::make_shared<bvar::LatencyRecorder>(
             _cache_base_path.c_str(), "file_cache_lru_dump_latency_us");
+    _lru_restored_entry_num = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_lru_restored_entry_num");
     _recycle_keys_length_recorder = std::make_shared<bvar::LatencyRecorder>(
             _cache_base_path.c_str(), "file_cache_recycle_keys_length");
     _ttl_gc_latency_us = std::make_shared<bvar::LatencyRecorder>(_cache_base_path.c_str(),
@@ -333,15 +338,8 @@ Status BlockFileCache::initialize() {
 Status BlockFileCache::initialize_unlocked(std::lock_guard<std::mutex>& cache_lock) {
     DCHECK(!_is_initialized);
     _is_initialized = true;
-    if (config::file_cache_background_lru_dump_tail_record_num > 0) {
-        // requirements:
-        // 1. restored data should not overwrite the last dump
-        // 2. restore should happen before load and async load
-        // 3. all queues should be restored sequencially to avoid conflict
-        // TODO(zhengyu): we can parralize them but will increase complexity, so lets check the time cost
-        // to see if any improvement is a necessary
-        restore_lru_queues_from_disk(cache_lock);
-    }
+    // the lru queues are restored from disk by the async load of _storage,
+    // see restore_lru_queues_in_background()
     RETURN_IF_ERROR(_storage->init(this));
     _cache_background_monitor_thread = std::thread(&BlockFileCache::run_background_monitor, this);
     pthread_setname_np(_cache_background_monitor_thread.native_handle(), "run_background_monitor");
@@ -372,6 +370,18 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
         result->push_back(cell.file_block);
     }
 
+    // A block used again within the promotion interval is still near the end of its queue, so it
+    // keeps its place, which saves the move and its lru log under the cache lock for hot blocks.
+    int64_t promotion_interval_s = config::file_cache_lru_promotion_interval_s;
+    if (promotion_interval_s > 0 && cell.atime != 0) {
+        int64_t now_s = std::chrono::duration_cast<std::chrono::seconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+        if (now_s - cell.atime < promotion_interval_s) {
+            return;
+        }
+    }
+
     auto& queue = get_queue(cell.file_block->cache_type());
     /// Move to the end of the queue. The iterator remains valid.
     if (cell.queue_iterator && move_iter_flag) {
@@ -744,11 +754,11 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
     DCHECK(stats != nullptr);
     MonotonicStopWatch sw;
     sw.start();
-    std::lock_guard cache_lock(_mutex);
-    stats->lock_wait_timer += sw.elapsed_time();
     FileBlocks file_blocks;
     int64_t duration = 0;
     {
+        SCOPED_CACHE_LOCK(_mutex, this);
+        stats->lock_wait_timer += sw.elapsed_time();
         SCOPED_RAW_TIMER(&duration);
         if (auto iter = _key_to_time.find(hash);
             context.cache_type == FileCacheType::INDEX && iter != _key_to_time.end()) {
@@ -771,11 +781,12 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
             fill_holes_with_empty_file_blocks(file_blocks, hash, context, range, cache_lock);
         }
         DCHECK(!file_blocks.empty());
-        *_num_read_blocks << file_blocks.size();
-        for (auto& block : file_blocks) {
-            if (block->state_unsafe() == FileBlock::State::DOWNLOADED) {
-                *_num_hit_blocks << 1;
-            }
+    }
+    // the metrics are updated out of the cache lock
+    *_num_read_blocks << file_blocks.size();
+    for (auto& block : file_blocks) {
+        if (block->state_unsafe() == FileBlock::State::DOWNLOADED) {
+            *_num_hit_blocks << 1;
         }
     }
     *_get_or_set_latency_us << (duration / 1000);
@@ -1340,6 +1351,9 @@ bool BlockFileCache::try_reserve_from_other_queue(FileCacheType cur_cache_type,
                                                   bool evict_in_advance) {
     // currently, TTL cache is not considered as a candidate
     auto other_cache_types = get_other_cache_type_without_ttl(cur_cache_type);
+    if (config::file_cache_pin_index_blocks) {
+        std::erase(other_cache_types, FileCacheType::INDEX);
+    }
     bool reserve_success = try_reserve_from_other_queue_by_time_interval(
             cur_cache_type, other_cache_types, size, cur_time, cache_lock, evict_in_advance);
     if (reserve_success || !config::file_cache_enable_evict_from_other_queue_by_size) {
@@ -1347,6 +1361,9 @@ bool BlockFileCache::try_reserve_from_other_queue(FileCacheType cur_cache_type,
     }
 
     other_cache_types = get_other_cache_type(cur_cache_type);
+    if (config::file_cache_pin_index_blocks) {
+        std::erase(other_cache_types, FileCacheType::INDEX);
+    }
     auto& cur_queue = get_queue(cur_cache_type);
     size_t cur_queue_size = cur_queue.get_capacity(cache_lock);
     size_t cur_queue_max_size = cur_queue.get_max_size();
@@ -2264,7 +2281,8 @@ void BlockFileCache::run_background_lru_dump() {
             }
         }
 
-        if (config::file_cache_background_lru_dump_tail_record_num > 0 &&
+        // do not overwrite the last dump by the queues which are still being restored
+        if (config::file_cache_background_lru_dump_tail_record_num > 0 && _async_open_done &&
             !ExecEnv::GetInstance()->get_is_upgrading()) {
             _lru_dumper->dump_queue("disposable");
             _lru_dumper->dump_queue("normal");
@@ -2274,11 +2292,18 @@ void BlockFileCache::run_background_lru_dump() {
     }
 }
 
-void BlockFileCache::restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock) {
-    _lru_dumper->restore_queue(_disposable_queue, "disposable", cache_lock);
-    _lru_dumper->restore_queue(_index_queue, "index", cache_lock);
-    _lru_dumper->restore_queue(_normal_queue, "normal", cache_lock);
-    _lru_dumper->restore_queue(_ttl_queue, "ttl", cache_lock);
+void BlockFileCache::restore_lru_queues_in_background() {
+    if (config::file_cache_background_lru_dump_tail_record_num <= 0) {
+        return;
+    }
+    // requirements:
+    // 1. restored data should not overwrite the last dump, the dump waits for _async_open_done
+    // 2. restore should happen before load, the blocks loaded by queries are skipped
+    // 3. all queues should be restored sequencially to avoid conflict
+    _lru_dumper->restore_queue_in_batches("disposable");
+    _lru_dumper->restore_queue_in_batches("index");
+    _lru_dumper->restore_queue_in_batches("normal");
+    _lru_dumper->restore_queue_in_batches("ttl");
 }
 
 std::map<std::string, double> BlockFileCache::get_stats() {
@@ -31,6 +31,7 @@
 #include "io/cache/file_cache_common.h"
 #include "io/cache/file_cache_storage.h"
 #include "io/cache/lru_queue_recorder.h"
+#include "util/lock_contention.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
 
@@ -59,7 +60,8 @@ private:
 #define SCOPED_CACHE_LOCK(MUTEX, cache)                                                           \
     std::chrono::time_point<std::chrono::steady_clock> start_time =                               \
             std::chrono::steady_clock::now();                                                     \
-    std::lock_guard cache_lock(MUTEX);                                                            \
+    doris::profiled_lock(MUTEX, cache->_cache_lock_site, &cache->_cache_lock_holder);             \
+    std::lock_guard cache_lock(MUTEX, std::adopt_lock);                                           \
     std::chrono::time_point<std::chrono::steady_clock> acq_time =                                 \
             std::chrono::steady_clock::now();                                                     \
     auto duration_us =                                                                            \
@@ -71,7 +73,9 @@ private:
     }                                                                                             \
     LockScopedTimer cache_lock_timer;
 #else
-#define SCOPED_CACHE_LOCK(MUTEX, cache) std::lock_guard cache_lock(MUTEX);
+#define SCOPED_CACHE_LOCK(MUTEX, cache)                                               \
+    doris::profiled_lock(MUTEX, cache->_cache_lock_site, &cache->_cache_lock_holder); \
+    std::lock_guard cache_lock(MUTEX, std::adopt_lock);
 #endif
 
 class FSFileCacheStorage;
@@ -389,7 +393,8 @@ private:
     void run_background_gc();
     void run_background_lru_log_replay();
     void run_background_lru_dump();
-    void restore_lru_queues_from_disk(std::lock_guard<std::mutex>& cache_lock);
+    // Called by the async load of _storage without the cache lock.
+    void restore_lru_queues_in_background();
     void run_background_evict_in_advance();
 
     bool try_reserve_from_other_queue_by_time_interval(FileCacheType cur_type,
@@ -434,6 +439,9 @@ private:
     size_t _max_query_cache_size = 0;
 
     mutable std::mutex _mutex;
+    // the contention of _mutex, see SCOPED_CACHE_LOCK
+    LockContentionSite* _cache_lock_site = nullptr;
+    std::atomic<const void*> _cache_lock_holder = nullptr;
     bool _close {false};
     std::mutex _close_mtx;
     std::condition_variable _close_cv;
@@ -521,6 +529,8 @@ private:
     std::shared_ptr<bvar::LatencyRecorder> _ttl_gc_latency_us;
 
     std::shared_ptr<bvar::LatencyRecorder> _shadow_queue_levenshtein_distance;
+    // updated by the async load of _storage
+    std::shared_ptr<bvar::Adder<size_t>> _lru_restored_entry_num;
     // keep _storage last so it will deconstruct first
     // otherwise, load_cache_info_into_memory might crash
     // coz it will use other members of BlockFileCache
@@ -33,6 +33,7 @@
 
 #include "cloud/cloud_storage_engine.h"
 #include "io/fs/file_system.h"
+#include "runtime/workload_management/io_throttle.h"
 
 namespace doris::io {
 
@@ -92,6 +93,9 @@ private:
     // tablet id -> inflight block num of tablet
     std::unordered_map<int64_t, int64_t> _inflight_tablets;
 
+    // limits the bytes downloaded by all the workers
+    IOThrottle _throttle;
+
     static inline constexpr size_t _max_size {102400};
 };
 
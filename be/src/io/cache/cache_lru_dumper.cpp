@@ -17,6 +17,10 @@
 
 #include "io/cache/cache_lru_dumper.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "common/config.h"
 #include "io/cache/block_file_cache.h"
 #include "io/cache/cache_lru_dumper.h"
 #include "io/cache/lru_queue_recorder.h"
@@ -404,6 +408,46 @@ Status CacheLRUDumper::parse_one_lru_entry(std::ifstream& in, std::string& filen
 
 void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_name,
                                    std::lock_guard<std::mutex>& cache_lock) {
+    do_restore_queue(queue_name, std::numeric_limits<size_t>::max(),
+                     [&](const std::vector<RestoreEntry>& entries, const CacheContext& ctx) {
+                         add_restored_entries(entries, ctx, cache_lock);
+                     });
+}
+
+void CacheLRUDumper::restore_queue_in_batches(const std::string& queue_name) {
+    auto batch_size =
+            static_cast<size_t>(std::max<int64_t>(1, config::file_cache_lru_restore_batch_size));
+    do_restore_queue(queue_name, batch_size,
+                     [this](const std::vector<RestoreEntry>& entries, const CacheContext& ctx) {
+                         SCOPED_CACHE_LOCK(_mgr->_mutex, _mgr);
+                         add_restored_entries(entries, ctx, cache_lock);
+                     });
+}
+
+void CacheLRUDumper::do_restore_queue(const std::string& queue_name, size_t batch_size,
+                                      const AddEntriesFunc& add_entries) {
+    CacheContext ctx;
+    if (queue_name == "ttl") {
+        ctx.cache_type = FileCacheType::TTL;
+        // TODO(zhengyu): we haven't persist expiration time yet, use 3h default
+        // There are mulitiple places we can correct this fake 3h ttl, e.g.:
+        // 1. during load_cache_info_into_memory (this will cause overwriting the ttl of async load)
+        // 2. after restoring, use sync_meta to modify the ttl
+        // However, I plan not to do this in this commit but to figure a more elegant way
+        // after ttl expiration time being changed from file name encoding to rocksdb persistency.
+        ctx.expiration_time = 10800;
+    } else if (queue_name == "index") {
+        ctx.cache_type = FileCacheType::INDEX;
+    } else if (queue_name == "normal") {
+        ctx.cache_type = FileCacheType::NORMAL;
+    } else if (queue_name == "disposable") {
+        ctx.cache_type = FileCacheType::DISPOSABLE;
+    } else {
+        LOG_WARNING("unknown queue type for lru restore, skip");
+        DCHECK(false);
+        return;
+    }
+
     Status st;
     std::string filename = fmt::format("{}/lru_dump_{}.tail", _mgr->_cache_base_path, queue_name);
     std::ifstream in(filename, std::ios::binary);
@@ -416,40 +460,43 @@ void CacheLRUDumper::restore_queue(LRUQueue& queue, const std::string& queue_nam
         RETURN_IF_STATUS_ERROR(st, parse_dump_footer(in, filename, entry_num));
         LOG(INFO) << "lru dump file for " << queue_name << " has " << entry_num << " entries.";
         in.seekg(0, std::ios::beg);
-        UInt128Wrapper hash;
-        size_t offset, size;
-        for (int i = 0; i < entry_num; ++i) {
-            RETURN_IF_STATUS_ERROR(st, parse_one_lru_entry(in, filename, hash, offset, size));
-            CacheContext ctx;
-            if (queue_name == "ttl") {
-                ctx.cache_type = FileCacheType::TTL;
-                // TODO(zhengyu): we haven't persist expiration time yet, use 3h default
-                // There are mulitiple places we can correct this fake 3h ttl, e.g.:
-                // 1. during load_cache_info_into_memory (this will cause overwriting the ttl of async load)
-                // 2. after restoring, use sync_meta to modify the ttl
-                // However, I plan not to do this in this commit but to figure a more elegant way
-                // after ttl expiration time being changed from file name encoding to rocksdb persistency.
-                ctx.expiration_time = 10800;
-            } else if (queue_name == "index") {
-                ctx.cache_type = FileCacheType::INDEX;
-            } else if (queue_name == "normal") {
-                ctx.cache_type = FileCacheType::NORMAL;
-            } else if (queue_name == "disposable") {
-                ctx.cache_type = FileCacheType::DISPOSABLE;
-            } else {
-                LOG_WARNING("unknown queue type for lru restore, skip");
-                DCHECK(false);
-                return;
+        std::vector<RestoreEntry> entries;
+        entries.reserve(std::min(entry_num, batch_size));
+        for (size_t i = 0; i < entry_num; ++i) {
+            RestoreEntry entry;
+            RETURN_IF_STATUS_ERROR(
+                    st, parse_one_lru_entry(in, filename, entry.hash, entry.offset, entry.size));
+            entries.push_back(entry);
+            if (entries.size() >= batch_size) {
+                add_entries(entries, ctx);
+                entries.clear();
             }
-            // TODO(zhengyu): we don't use stats yet, see if this will cause any problem
-            _mgr->add_cell(hash, ctx, offset, size, FileBlock::State::DOWNLOADED, cache_lock);
+        }
+        if (!entries.empty()) {
+            add_entries(entries, ctx);
         }
         in.close();
     } else {
         LOG(INFO) << "no lru dump file is founded for " << queue_name;
     }
     LOG(INFO) << "lru restore time costs: " << (duration_ns / 1000) << "us.";
-};
+}
+
+void CacheLRUDumper::add_restored_entries(const std::vector<RestoreEntry>& entries,
+                                          const CacheContext& ctx,
+                                          std::lock_guard<std::mutex>& cache_lock) {
+    for (const auto& entry : entries) {
+        // the block may be loaded by a query while restoring in batches
+        if (auto it = _mgr->_files.find(entry.hash);
+            it != _mgr->_files.end() && it->second.contains(entry.offset)) {
+            continue;
+        }
+        // TODO(zhengyu): we don't use stats yet, see if this will cause any problem
+        _mgr->add_cell(entry.hash, ctx, entry.offset, entry.size, FileBlock::State::DOWNLOADED,
+                       cache_lock);
+    }
+    *_mgr->_lru_restored_entry_num << entries.size();
+}
 
 void CacheLRUDumper::remove_lru_dump_files() {
     std::vector<std::string> queue_names = {"disposable", "index", "normal", "ttl"};
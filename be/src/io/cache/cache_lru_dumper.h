@@ -21,6 +21,7 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <sstream>
@@ -42,9 +43,24 @@ public:
     void dump_queue(const std::string& queue_name);
     void restore_queue(LRUQueue& queue, const std::string& queue_name,
                        std::lock_guard<std::mutex>& cache_lock);
+    // Same as restore_queue, but the entries are parsed without the cache lock, and the lock is
+    // only held to add each batch of them, so the cache can serve while restoring.
+    void restore_queue_in_batches(const std::string& queue_name);
     void remove_lru_dump_files();
 
 private:
+    struct RestoreEntry {
+        UInt128Wrapper hash;
+        size_t offset;
+        size_t size;
+    };
+    using AddEntriesFunc =
+            std::function<void(const std::vector<RestoreEntry>&, const CacheContext&)>;
+
+    void do_restore_queue(const std::string& queue_name, size_t batch_size,
+                          const AddEntriesFunc& add_entries);
+    void add_restored_entries(const std::vector<RestoreEntry>& entries, const CacheContext& ctx,
+                              std::lock_guard<std::mutex>& cache_lock);
     void do_dump_queue(LRUQueue& queue, const std::string& queue_name);
     Status check_ofstream_status(std::ofstream& out, std::string& filename);
     Status check_ifstream_status(std::ifstream& in, std::string& filename);
@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <vector>
 
@@ -33,12 +34,15 @@
 #include "io/cache/block_file_cache_factory.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/cache/file_block.h"
+#include "io/cache/file_cache_peers.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
+#include "runtime/exec_env.h"
 #include "util/bit_util.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -47,6 +51,77 @@ bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
 bvar::Adder<uint64_t> g_skip_local_cache_io_sum_bytes(
         "cached_remote_reader_skip_local_cache_io_sum_bytes");
+bvar::Adder<uint64_t> g_peer_read_bytes("cached_remote_reader_peer_read_bytes");
+bvar::Adder<uint64_t> g_peer_read_failed("cached_remote_reader_peer_read_failed");
+bvar::Adder<uint64_t> g_prefetch_blocks("cached_remote_reader_prefetch_blocks");
+bvar::Adder<uint64_t> g_prefetch_hit_blocks("cached_remote_reader_prefetch_hit_blocks");
+bvar::Adder<uint64_t> g_prefetch_skip_blocks("cached_remote_reader_prefetch_skip_blocks");
+bvar::PassiveStatus<double> g_prefetch_hit_ratio(
+        "cached_remote_reader_prefetch_hit_ratio",
+        [](void*) {
+            uint64_t prefetch_blocks = g_prefetch_blocks.get_value();
+            return prefetch_blocks == 0
+                           ? 0.0
+                           : static_cast<double>(g_prefetch_hit_blocks.get_value()) /
+                                     static_cast<double>(prefetch_blocks);
+        },
+        nullptr);
+
+// the bytes read ahead and not written into the cache yet by all the readers
+static std::atomic<int64_t> s_prefetch_inflight_bytes {0};
+bvar::PassiveStatus<int64_t> g_prefetch_inflight_bytes(
+        "cached_remote_reader_prefetch_inflight_bytes",
+        [](void*) { return s_prefetch_inflight_bytes.load(std::memory_order_relaxed); }, nullptr);
+
+// a reader which reads ahead the blocks it never reads forgets them
+static constexpr size_t MAX_PREFETCHED_BLOCKS = 1024;
+
+std::vector<size_t> ReadPatternDetector::on_read(size_t offset, size_t size, size_t file_size,
+                                                 size_t block_size, size_t prefetch_blocks) {
+    if (_run_length > 0 && offset >= _last_end && offset - _last_end < block_size) {
+        // a read right after the last one, or skipping less than a block
+        _stride = 0;
+        ++_run_length;
+    } else if (_run_length > 0 && _stride > 0 && offset == _last_offset + _stride) {
+        ++_run_length;
+    } else {
+        _stride = offset > _last_offset ? offset - _last_offset : 0;
+        _run_length = 1;
+        _prefetched_end = 0;
+    }
+    _last_offset = offset;
+    _last_end = offset + size;
+
+    std::vector<size_t> blocks;
+    if (_run_length < MIN_RUN_LENGTH || prefetch_blocks == 0 || block_size == 0) {
+        return blocks;
+    }
+    if (_stride < block_size) {
+        // the next reads hit the blocks right after this one
+        size_t next_block = (_last_end + block_size - 1) / block_size * block_size;
+        size_t end = std::min(next_block + prefetch_blocks * block_size, file_size);
+        for (size_t block = std::max(next_block, _prefetched_end); block < end;
+             block += block_size) {
+            blocks.push_back(block);
+        }
+    } else {
+        for (size_t i = 1; i <= prefetch_blocks; ++i) {
+            size_t next_offset = offset + i * _stride;
+            if (next_offset >= file_size) {
+                break;
+            }
+            size_t block = next_offset / block_size * block_size;
+            if (block >= _prefetched_end && (blocks.empty() || block != blocks.back())) {
+                blocks.push_back(block);
+            }
+        }
+    }
+    if (!blocks.empty()) {
+        _prefetched_end = blocks.back() + block_size;
+    }
+    return blocks;
+}
+
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
@@ -85,6 +160,144 @@ void CachedRemoteFileReader::_insert_file_reader(FileBlockSPtr file_block) {
     }
 }
 
+void CachedRemoteFileReader::_prefetch(size_t offset, size_t size, const IOContext* io_ctx) {
+    ThreadPool* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    if (pool == nullptr) {
+        return;
+    }
+    const auto block_size = static_cast<size_t>(config::file_cache_each_block_size);
+    std::vector<size_t> blocks;
+    {
+        std::lock_guard lock(_prefetch_mtx);
+        blocks = _read_pattern_detector.on_read(
+                offset, size, this->size(), block_size,
+                static_cast<size_t>(std::max(config::file_cache_prefetch_blocks, 0)));
+    }
+    if (blocks.empty()) {
+        return;
+    }
+    CacheContext cache_context(io_ctx);
+    // a task downloads a run of adjacent blocks by one remote read
+    for (size_t i = 0; i < blocks.size();) {
+        size_t j = i + 1;
+        while (j < blocks.size() && blocks[j] == blocks[j - 1] + block_size) {
+            ++j;
+        }
+        size_t begin = blocks[i];
+        size_t end = std::min(blocks[j - 1] + block_size, this->size());
+        auto bytes = static_cast<int64_t>(end - begin);
+        if (s_prefetch_inflight_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes >
+            config::file_cache_prefetch_max_inflight_bytes) {
+            s_prefetch_inflight_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            g_prefetch_skip_blocks << blocks.size() - i;
+            return;
+        }
+        Status st = pool->submit_func([remote_file_reader = _remote_file_reader, cache = _cache,
+                                       cache_hash = _cache_hash, cache_context, begin, end,
+                                       bytes]() {
+            _download_blocks(remote_file_reader, cache, cache_hash, cache_context, begin,
+                             end - begin);
+            s_prefetch_inflight_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        });
+        if (!st.ok()) {
+            s_prefetch_inflight_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            g_prefetch_skip_blocks << blocks.size() - i;
+            return;
+        }
+        g_prefetch_blocks << j - i;
+        {
+            std::lock_guard lock(_prefetch_mtx);
+            if (_prefetched_blocks.size() > MAX_PREFETCHED_BLOCKS) {
+                _prefetched_blocks.clear();
+            }
+            _prefetched_blocks.insert(blocks.begin() + i, blocks.begin() + j);
+        }
+        i = j;
+    }
+}
+
+bool CachedRemoteFileReader::_read_from_peer(size_t offset, size_t size, char* buffer) {
+    if (!config::enable_file_cache_peer_fetch || !_is_doris_table) {
+        return false;
+    }
+    std::string host;
+    if (!FileCachePeers::instance().get(_cache_hash, &host)) {
+        return false;
+    }
+    Status st = FileCachePeers::read(host, path().filename().native(), offset, size, buffer);
+    if (!st.ok()) {
+        g_peer_read_failed << 1;
+        if (!st.is<ErrorCode::NOT_FOUND>()) {
+            // don't wait for the peer again if it's gone
+            FileCachePeers::instance().remove(_cache_hash);
+        }
+        VLOG_DEBUG << "failed to read from peer: " << st;
+        return false;
+    }
+    g_peer_read_bytes << size;
+    return true;
+}
+
+void CachedRemoteFileReader::_count_prefetch_hits(const FileBlocksHolder& holder) {
+    std::lock_guard lock(_prefetch_mtx);
+    if (_prefetched_blocks.empty()) {
+        return;
+    }
+    for (const auto& block : holder.file_blocks) {
+        // a block still being read ahead is not a hit, the read waits for it
+        if (_prefetched_blocks.erase(block->offset()) > 0 &&
+            block->state() == FileBlock::State::DOWNLOADED) {
+            g_prefetch_hit_blocks << 1;
+        }
+    }
+}
+
+void CachedRemoteFileReader::_download_blocks(FileReaderSPtr remote_file_reader,
+                                              BlockFileCache* cache, UInt128Wrapper cache_hash,
+                                              CacheContext cache_context, size_t offset,
+                                              size_t size) {
+    if (remote_file_reader->closed()) {
+        return;
+    }
+    ReadStatistics stats;
+    cache_context.stats = &stats;
+    FileBlocksHolder holder = cache->get_or_set(cache_hash, offset, size, cache_context);
+    std::vector<FileBlockSPtr> empty_blocks;
+    for (auto& block : holder.file_blocks) {
+        if (block->state() == FileBlock::State::EMPTY) {
+            block->get_or_set_downloader();
+            if (block->is_downloader()) {
+                empty_blocks.push_back(block);
+            }
+        }
+    }
+    if (empty_blocks.empty() || remote_file_reader->closed()) {
+        return;
+    }
+    size_t empty_start = empty_blocks.front()->range().left;
+    size_t read_size = empty_blocks.back()->range().right - empty_start + 1;
+    std::unique_ptr<char[]> buffer(new char[read_size]);
+    s3_read_counter << 1;
+    IOContext io_ctx;
+    Status st = remote_file_reader->read_at(empty_start, Slice(buffer.get(), read_size),
+                                            &read_size, &io_ctx);
+    if (!st.ok()) {
+        LOG_EVERY_N(WARNING, 100) << "Prefetch data failed. err=" << st.msg();
+        return;
+    }
+    for (auto& block : empty_blocks) {
+        char* cur_ptr = buffer.get() + block->range().left - empty_start;
+        st = block->append(Slice(cur_ptr, block->range().size()));
+        if (st.ok()) {
+            st = block->finalize();
+        }
+        if (!st.ok()) {
+            LOG_EVERY_N(WARNING, 100) << "Write prefetched data to file cache failed. err="
+                                      << st.msg();
+        }
+    }
+}
+
 CachedRemoteFileReader::~CachedRemoteFileReader() {
     static_cast<void>(close());
 }
@@ -139,6 +352,10 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
     };
     std::unique_ptr<int, decltype(defer_func)> defer((int*)0x01, std::move(defer_func));
     stats.bytes_read += bytes_req;
+    const bool enable_prefetch = config::enable_file_cache_prefetch && !is_dryrun;
+    if (enable_prefetch) {
+        _prefetch(offset, bytes_req, io_ctx);
+    }
     if (config::enable_read_cache_file_directly) {
         // read directly
         SCOPED_RAW_TIMER(&stats.read_cache_file_directly_timer);
@@ -190,6 +407,9 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
     FileBlocksHolder holder =
             _cache->get_or_set(_cache_hash, align_left, align_size, cache_context);
     stats.cache_get_or_set_timer += sw.elapsed_time();
+    if (enable_prefetch) {
+        _count_prefetch_hits(holder);
+    }
     std::vector<FileBlockSPtr> empty_blocks;
     for (auto& block : holder.file_blocks) {
         switch (block->state()) {
@@ -221,10 +441,12 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         size_t size = empty_end - empty_start + 1;
         std::unique_ptr<char[]> buffer(new char[size]);
         {
-            s3_read_counter << 1;
             SCOPED_RAW_TIMER(&stats.remote_read_timer);
-            RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size),
-                                                         &size, io_ctx));
+            if (!_read_from_peer(empty_start, size, buffer.get())) {
+                s3_read_counter << 1;
+                RETURN_IF_ERROR(_remote_file_reader->read_at(
+                        empty_start, Slice(buffer.get(), size), &size, io_ctx));
+            }
         }
         for (auto& block : empty_blocks) {
             if (block->state() == FileBlock::State::SKIP_CACHE) {
@@ -318,7 +540,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
                 SCOPED_RAW_TIMER(&stats.remote_read_timer);
                 RETURN_IF_ERROR(_remote_file_reader->read_at(
                         current_offset, Slice(result.data + (current_offset - offset), read_size),
-                        &bytes_read));
+                        &bytes_read, io_ctx));
                 DCHECK(bytes_read == read_size);
             }
         }
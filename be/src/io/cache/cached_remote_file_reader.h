@@ -20,8 +20,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "io/cache/block_file_cache.h"
@@ -36,6 +39,29 @@ namespace doris::io {
 struct IOContext;
 struct FileCacheStatistics;
 
+// Tracks the reads of a file to tell the blocks the next reads are likely to hit. A run of reads
+// each starting where the previous one ends is sequential, and a run of reads with the same
+// distance between their offsets is strided, e.g. the pages of a column read in turns with the
+// pages of another column. Any other read is random and breaks the run.
+class ReadPatternDetector {
+public:
+    // Record a read of [offset, offset + size) and return the left aligned offsets of the blocks
+    // to read ahead, which is empty for a random read or for the blocks read ahead already.
+    std::vector<size_t> on_read(size_t offset, size_t size, size_t file_size, size_t block_size,
+                                size_t prefetch_blocks);
+
+private:
+    // the reads in the run before prefetching
+    static constexpr int MIN_RUN_LENGTH = 2;
+
+    size_t _last_offset = 0;
+    size_t _last_end = 0;
+    size_t _stride = 0;
+    int _run_length = 0;
+    // the blocks before it are read ahead already
+    size_t _prefetched_end = 0;
+};
+
 class CachedRemoteFileReader final : public FileReader {
 public:
     CachedRemoteFileReader(FileReaderSPtr remote_file_reader, const FileReaderOptions& opts);
@@ -52,6 +78,11 @@ public:
 
     FileReader* get_remote_reader() { return _remote_file_reader.get(); }
 
+    // The downloaded blocks of the file in the cache by their offsets.
+    std::map<size_t, FileBlockSPtr> downloaded_blocks() {
+        return _cache->get_blocks_by_key(_cache_hash);
+    }
+
     static std::pair<size_t, size_t> s_align_size(size_t offset, size_t size, size_t length);
 
 protected:
@@ -60,6 +91,23 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+
+    // Read ahead the blocks the detector expects after the read of [offset, offset + size).
+    void _prefetch(size_t offset, size_t size, const IOContext* io_ctx);
+
+    // Read [offset, offset + size) from the file cache of a peer BE, return false if no peer
+    // caches it.
+    bool _read_from_peer(size_t offset, size_t size, char* buffer);
+
+    // Count the blocks of the read which are read ahead.
+    void _count_prefetch_hits(const FileBlocksHolder& holder);
+
+    // Download the missing blocks in [offset, offset + size) into the cache, it only holds the
+    // remote reader so it can outlive this reader.
+    static void _download_blocks(FileReaderSPtr remote_file_reader, BlockFileCache* cache,
+                                 UInt128Wrapper cache_hash, CacheContext cache_context,
+                                 size_t offset, size_t size);
+
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
@@ -67,6 +115,11 @@ private:
     std::shared_mutex _mtx;
     std::map<size_t, FileBlockSPtr> _cache_file_readers;
 
+    std::mutex _prefetch_mtx;
+    ReadPatternDetector _read_pattern_detector;
+    // the offsets of the blocks read ahead and not read yet
+    std::unordered_set<size_t> _prefetched_blocks;
+
     void _update_stats(const ReadStatistics& stats, FileCacheStatistics* state,
                        bool is_inverted_index) const;
 };
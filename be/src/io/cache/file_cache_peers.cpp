@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_cache_peers.h"
+
+#include <fmt/format.h>
+
+#include <cstring>
+
+#include "common/config.h"
+#include "http/http_client.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+// the expired peers are swept when there are more files than it
+static constexpr size_t SWEEP_PEERS_THRESHOLD = 1 << 20;
+
+void FileCachePeers::add(const UInt128Wrapper& hash, const std::string& host) {
+    int64_t now = UnixSeconds();
+    std::lock_guard lock(_mtx);
+    if (_peers.size() >= SWEEP_PEERS_THRESHOLD) {
+        std::erase_if(_peers, [now](const auto& entry) {
+            return entry.second.expiration_time <= now;
+        });
+    }
+    _peers[hash] = {host, now + config::file_cache_peer_ttl_s};
+}
+
+bool FileCachePeers::get(const UInt128Wrapper& hash, std::string* host) {
+    std::lock_guard lock(_mtx);
+    auto it = _peers.find(hash);
+    if (it == _peers.end()) {
+        return false;
+    }
+    if (it->second.expiration_time <= UnixSeconds()) {
+        _peers.erase(it);
+        return false;
+    }
+    *host = it->second.host;
+    return true;
+}
+
+void FileCachePeers::remove(const UInt128Wrapper& hash) {
+    std::lock_guard lock(_mtx);
+    _peers.erase(hash);
+}
+
+Status FileCachePeers::read(const std::string& host, const std::string& file_name, size_t offset,
+                            size_t size, char* buffer) {
+    std::string url =
+            fmt::format("http://{}:{}/api/file_cache?op=read&value={}&offset={}&size={}", host,
+                        config::webserver_port, file_name, offset, size);
+    HttpClient client;
+    RETURN_IF_ERROR(client.init(url, false));
+    client.set_timeout_ms(config::file_cache_peer_fetch_timeout_ms);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(client.execute([&](const void* data, size_t length) {
+        if (bytes_read + length > size) {
+            return false;
+        }
+        memcpy(buffer + bytes_read, data, length);
+        bytes_read += length;
+        return true;
+    }));
+    long http_status = client.get_http_status();
+    if (http_status == 404) {
+        return Status::NotFound("range [{}, {}) of {} is not cached by {}", offset, offset + size,
+                                file_name, host);
+    }
+    if (http_status != 200 || bytes_read != size) {
+        return Status::InternalError(
+                "failed to read range [{}, {}) of {} from {}, http status {}, read {} bytes",
+                offset, offset + size, file_name, host, http_status, bytes_read);
+    }
+    return Status::OK();
+}
+
+} // namespace doris::io
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "io/cache/file_cache_common.h"
+
+namespace doris::io {
+
+// Remembers the peer BE which caches a file, so a miss of the file cache reads the data from the
+// file cache of the peer before the remote storage. The files are added by the warm up jobs from
+// the BE which held the tablets before, e.g. after a scale out or a rebalance.
+//
+// The data is fetched from the file cache http action of the peer, which only returns a range
+// cached there. The reader falls back to the remote storage on any failure.
+class FileCachePeers {
+public:
+    static FileCachePeers& instance() {
+        static FileCachePeers s_peers;
+        return s_peers;
+    }
+
+    // `host` is the ip of the peer BE, the file is forgotten after file_cache_peer_ttl_s.
+    void add(const UInt128Wrapper& hash, const std::string& host);
+
+    // Return false if no peer is known to cache the file.
+    bool get(const UInt128Wrapper& hash, std::string* host);
+
+    void remove(const UInt128Wrapper& hash);
+
+    // Read [offset, offset + size) of the file `file_name` from the file cache of `host`.
+    // Return NotFound if the range is not cached by the peer.
+    static Status read(const std::string& host, const std::string& file_name, size_t offset,
+                       size_t size, char* buffer);
+
+private:
+    struct Peer {
+        std::string host;
+        int64_t expiration_time;
+    };
+
+    std::mutex _mtx;
+    std::unordered_map<UInt128Wrapper, Peer, KeyHash> _peers;
+};
+
+} // namespace doris::io
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <system_error>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -127,6 +128,7 @@ Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
                 throw doris::Exception(Status::InternalError(msg));
             }
         }
+        mgr->restore_lru_queues_in_background();
         load_cache_info_into_memory(mgr);
         mgr->_async_open_done = true;
         LOG_INFO("file cache {} lazy load done.", _cache_base_path);
@@ -169,6 +171,18 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
         file_writer = std::move(iter->second);
         _key_to_writer.erase(iter);
     }
+    if (config::file_cache_write_bypass_page_cache &&
+        file_writer->state() == FileWriter::State::OPENED) {
+        if (auto* local_writer = dynamic_cast<LocalFileWriter*>(file_writer.get())) {
+            // the block is cached by the file cache itself, keeping it in the page cache as well
+            // only pushes out the pages of other files
+            auto st = local_writer->drop_page_cache();
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to drop page cache of " << file_writer->path() << ": "
+                             << st;
+            }
+        }
+    }
     if (file_writer->state() != FileWriter::State::CLOSED) {
         RETURN_IF_ERROR(file_writer->close());
     }
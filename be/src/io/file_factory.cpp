@@ -39,6 +39,7 @@
 #include "io/fs/s3_file_reader.h"
 #include "io/fs/s3_file_system.h"
 #include "io/fs/s3_file_writer.h"
+#include "io/fs/stream_load_chunk_reader.h"
 #include "io/fs/stream_load_pipe.h"
 #include "io/hdfs_builder.h"
 #include "io/hdfs_util.h"
@@ -268,6 +269,9 @@ Status FileFactory::create_pipe_reader(const TUniqueId& load_id, io::FileReaderS
         RETURN_IF_ERROR(pipe->append(stream_load_ctx->schema_buffer()));
         RETURN_IF_ERROR(pipe->finish());
         *file_reader = std::move(pipe);
+    } else if (stream_load_ctx->pipe_splitter != nullptr) {
+        // each scanner of the body reads its own chunks of lines
+        *file_reader = std::make_shared<io::StreamLoadChunkReader>(stream_load_ctx->pipe_splitter);
     } else {
         *file_reader = stream_load_ctx->pipe;
     }
@@ -29,6 +29,7 @@
 #include "common/status.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "util/histogram.h"
 #include "util/slice.h"
 
 namespace doris::io {
@@ -122,12 +123,15 @@ public:
         long remaining_size = read_size;
 
         Status status;
+        HistogramStat read_latency;
         auto start = std::chrono::high_resolution_clock::now();
         while (remaining_size > 0) {
             bytes_read = 0;
             size_t size = std::min(buffer_size, (size_t)remaining_size);
             data.size = size;
+            auto read_start = std::chrono::high_resolution_clock::now();
             status = reader->read_at(offset, data, &bytes_read);
+            read_latency.add(elapsed_us(read_start));
             if (!status.ok()) {
                 bm_log("reader read_at error: {}", status.to_string());
                 break;
@@ -146,6 +150,7 @@ public:
                 benchmark::Counter(read_size, benchmark::Counter::kIsRate);
         state.counters["ReadTotal(B)"] = read_size;
         state.counters["ReadTime(S)"] = elapsed_seconds.count();
+        set_latency_counters(state, "Read", read_latency);
 
         if (status.ok() && reader != nullptr) {
             status = reader->close();
@@ -166,19 +171,27 @@ public:
         doris::Slice data = {buffer.data(), buffer.size()};
 
         Status status;
+        HistogramStat append_latency;
         auto start = std::chrono::high_resolution_clock::now();
         while (remaining_size > 0) {
             size_t size = std::min(buffer_size, (size_t)remaining_size);
             data.size = size;
+            // the parts of S3FileWriter are uploaded concurrently in s3_file_upload_thread_pool,
+            // an append waits only when the upload buffers run out
+            auto append_start = std::chrono::high_resolution_clock::now();
             status = writer->append(data);
+            append_latency.add(elapsed_us(append_start));
             if (!status.ok()) {
                 bm_log("writer append error: {}", status.to_string());
                 break;
             }
             remaining_size -= size;
         }
+        int64_t close_us = 0;
         if (status.ok() && writer != nullptr && writer->state() != FileWriter::State::CLOSED) {
+            auto close_start = std::chrono::high_resolution_clock::now();
             status = writer->close();
+            close_us = elapsed_us(close_start);
         }
 
         auto end = std::chrono::high_resolution_clock::now();
@@ -189,12 +202,41 @@ public:
                 benchmark::Counter(write_size, benchmark::Counter::kIsRate);
         state.counters["WriteTotal(B)"] = write_size;
         state.counters["WriteTime(S)"] = elapsed_seconds.count();
+        state.counters["CloseTime(us)"] =
+                benchmark::Counter(close_us, benchmark::Counter::kAvgThreads);
+        set_latency_counters(state, "Append", append_latency);
 
         bm_log("finish to write {}, thread: {}, size: {}, seconds: {}, status: {}", _name,
                state.thread_index(), write_size, elapsed_seconds.count(), status);
         return status;
     }
 
+    static uint64_t elapsed_us(std::chrono::high_resolution_clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::high_resolution_clock::now() - start)
+                .count();
+    }
+
+    // The latency percentiles of the operations of a thread, averaged over the threads.
+    void set_latency_counters(benchmark::State& state, const std::string& op,
+                              const HistogramStat& latency_us) {
+        if (latency_us.is_empty()) {
+            return;
+        }
+        state.counters[op + "P50(us)"] =
+                benchmark::Counter(latency_us.median(), benchmark::Counter::kAvgThreads);
+        state.counters[op + "P99(us)"] =
+                benchmark::Counter(latency_us.percentile(99), benchmark::Counter::kAvgThreads);
+        state.counters[op + "Max(us)"] =
+                benchmark::Counter(latency_us.max(), benchmark::Counter::kAvgThreads);
+        bm_log("{} latency of {}, thread: {}, {}", op, _name, state.thread_index(),
+               latency_us.to_string());
+    }
+
+    size_t conf_size(const std::string& key, size_t default_value) {
+        return _conf_map.contains(key) ? std::stol(_conf_map[key]) : default_value;
+    }
+
 protected:
     std::string _name;
     int _threads;
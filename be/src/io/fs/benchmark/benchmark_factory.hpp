@@ -46,6 +46,10 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new S3SingleReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "prefetch_read") {
             *bm = new S3PrefetchReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "parquet_range_read") {
+            *bm = new S3ParquetRangeReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "cached_page_read") {
+            *bm = new S3CachedPageReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "rename") {
             *bm = new S3RenameBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "exists") {
@@ -101,6 +105,7 @@ public:
             return Status::Error<INTERNAL_ERROR>("error read config file.");
         }
         doris::CpuInfo::init();
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->init_remote_io_env_for_tools());
         Status status = Status::OK();
         if (doris::config::enable_java_support) {
             // Init jni
@@ -26,7 +26,8 @@
 
 DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs");
 DEFINE_string(operation, "create_write",
-              "Supported Operations: create_write, open_read, open, rename, delete, exists");
+              "Supported Operations: create_write, open_read, single_read, prefetch_read, "
+              "parquet_range_read, cached_page_read, rename, exists, list");
 DEFINE_string(threads, "1", "Number of threads");
 DEFINE_string(iterations, "1", "Number of runs of each thread");
 DEFINE_string(repetitions, "1", "Number of iterations");
@@ -46,8 +47,13 @@ std::string get_usage(const std::string& progname) {
     ss << "     hdfs\n";
     ss << "     s3\n";
     ss << "\nop_type:\n";
-    ss << "     read\n";
-    ss << "     write\n";
+    ss << "     create_write: write a file of file_size, a file larger than s3_write_buffer_size "
+          "is a multipart upload\n";
+    ss << "     open_read/single_read/prefetch_read: read a file sequentially\n";
+    ss << "     parquet_range_read(s3): read the column chunks of file_path, conf: row_group_size, "
+          "num_columns, read_columns, buffer_size, merge_range\n";
+    ss << "     cached_page_read(s3): read the pages of file_path through the file cache, conf: "
+          "page_size, num_reads, hot_bytes, hot_ratio\n";
     ss << "\nthreads:\n";
     ss << "     num of threads\n";
     ss << "\niterations:\n";
@@ -110,20 +116,6 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    doris::CpuInfo::init();
-    int num_cores = doris::CpuInfo::num_cores();
-
-    // init s3 write buffer pool
-    std::unique_ptr<doris::ThreadPool> s3_file_upload_thread_pool;
-    doris::Status st = doris::ThreadPoolBuilder("S3FileUploadThreadPool")
-                               .set_min_threads(num_cores)
-                               .set_max_threads(num_cores)
-                               .build(&s3_file_upload_thread_pool);
-    if (!st.ok()) {
-        std::cerr << "init s3 write buffer pool failed" << std::endl;
-        return 1;
-    }
-
     try {
         doris::io::MultiBenchmark multi_bm(FLAGS_fs_type, FLAGS_operation, std::stoi(FLAGS_threads),
                                            std::stoi(FLAGS_iterations), std::stol(FLAGS_file_size),
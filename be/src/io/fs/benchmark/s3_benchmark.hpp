@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <random>
+
+#include "common/config.h"
 #include "io/file_factory.h"
 #include "io/fs/benchmark/base_benchmark.h"
 #include "io/fs/buffered_reader.h"
@@ -24,6 +27,7 @@
 #include "io/fs/file_writer.h"
 #include "io/fs/s3_file_reader.h"
 #include "io/fs/s3_file_system.h"
+#include "io/io_common.h"
 #include "runtime/exec_env.h"
 #include "util/s3_uri.h"
 #include "util/slice.h"
@@ -122,6 +126,166 @@ public:
     }
 };
 
+// Read the column chunks of a Parquet file like the Parquet reader does: `read_columns` of the
+// `num_columns` columns of every `row_group_size` row group, each chunk read in `buffer_size`
+// pieces. The chunks are read through MergeRangeFileReader unless `merge_range` is false.
+class S3ParquetRangeReadBenchmark : public S3Benchmark {
+public:
+    S3ParquetRangeReadBenchmark(int threads, int iterations, size_t file_size,
+                                const std::map<std::string, std::string>& conf_map)
+            : S3Benchmark("S3ParquetRangeReadBenchmark", threads, iterations, file_size,
+                          conf_map) {}
+    virtual ~S3ParquetRangeReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+        io::FileReaderSPtr reader;
+        RETURN_IF_ERROR(fs->open_file(file_path, &reader));
+
+        size_t row_group_size = conf_size("row_group_size", 128 * 1024 * 1024);
+        size_t num_columns = std::max(conf_size("num_columns", 20), 1UL);
+        size_t read_columns = std::min(conf_size("read_columns", 5), num_columns);
+        size_t buffer_size = conf_size("buffer_size", 1024 * 1024);
+        size_t chunk_size = row_group_size / num_columns;
+        std::vector<io::PrefetchRange> ranges;
+        for (size_t rg_start = 0; rg_start + row_group_size <= reader->size();
+             rg_start += row_group_size) {
+            // the projected columns spread over the row group
+            for (size_t i = 0; i < read_columns; ++i) {
+                size_t start = rg_start + i * num_columns / read_columns * chunk_size;
+                ranges.emplace_back(start, start + chunk_size);
+            }
+        }
+        if (ranges.empty()) {
+            return Status::InvalidArgument("file {} is smaller than a row group {}", file_path,
+                                           row_group_size);
+        }
+        std::shared_ptr<io::MergeRangeFileReader> merge_reader;
+        if (_conf_map["merge_range"] != "false") {
+            merge_reader = std::make_shared<io::MergeRangeFileReader>(nullptr, reader, ranges);
+            reader = merge_reader;
+        }
+
+        std::vector<char> buffer(buffer_size);
+        HistogramStat read_latency;
+        size_t read_bytes = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto& range : ranges) {
+            for (size_t offset = range.start_offset; offset < range.end_offset;
+                 offset += buffer_size) {
+                size_t bytes_read = 0;
+                Slice data(buffer.data(), std::min(buffer_size, range.end_offset - offset));
+                auto read_start = std::chrono::high_resolution_clock::now();
+                RETURN_IF_ERROR(reader->read_at(offset, data, &bytes_read));
+                read_latency.add(elapsed_us(read_start));
+                read_bytes += bytes_read;
+            }
+        }
+        auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::high_resolution_clock::now() - start);
+        state.SetIterationTime(elapsed_seconds.count());
+        state.counters["ReadRate(B/S)"] =
+                benchmark::Counter(read_bytes, benchmark::Counter::kIsRate);
+        state.counters["ReadTotal(B)"] = read_bytes;
+        set_latency_counters(state, "Read", read_latency);
+        if (merge_reader != nullptr) {
+            const auto& stats = merge_reader->statistics();
+            state.counters["RequestIO"] = stats.request_io;
+            state.counters["MergedIO"] = stats.merged_io;
+            state.counters["RequestBytes"] = stats.request_bytes;
+            state.counters["MergedBytes"] = stats.merged_bytes;
+        }
+        return reader->close();
+    }
+};
+
+// Read the pages of a segment file through CachedRemoteFileReader, `hot_ratio` of the reads go
+// to the first `hot_bytes` of the file, which are cached after the first reads, and the others
+// go anywhere in the file, so the hit ratio of the file cache is about `hot_ratio`.
+// The file cache of file_cache_path in be.conf is used.
+class S3CachedPageReadBenchmark : public S3Benchmark {
+public:
+    S3CachedPageReadBenchmark(int threads, int iterations, size_t file_size,
+                              const std::map<std::string, std::string>& conf_map)
+            : S3Benchmark("S3CachedPageReadBenchmark", threads, iterations, file_size,
+                          conf_map) {}
+    virtual ~S3CachedPageReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+
+    Status init() override {
+        if (!config::enable_file_cache) {
+            return Status::InvalidArgument("enable_file_cache of be.conf is false");
+        }
+        return Status::OK();
+    }
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+        io::FileReaderSPtr reader;
+        io::FileReaderOptions reader_opts;
+        reader_opts.cache_type = io::FileCachePolicy::FILE_BLOCK_CACHE;
+        reader_opts.is_doris_table = true;
+        RETURN_IF_ERROR(fs->open_file(file_path, &reader, &reader_opts));
+
+        size_t page_size = conf_size("page_size", 64 * 1024);
+        size_t num_reads = conf_size("num_reads", 1000);
+        size_t hot_bytes = std::min(conf_size("hot_bytes", reader->size() / 10), reader->size());
+        double hot_ratio =
+                _conf_map.contains("hot_ratio") ? std::stod(_conf_map["hot_ratio"]) : 0.8;
+        if (reader->size() < page_size || hot_bytes < page_size) {
+            return Status::InvalidArgument("file {} is too small", file_path);
+        }
+
+        std::mt19937_64 rng(state.thread_index());
+        std::bernoulli_distribution hot(hot_ratio);
+        std::uniform_int_distribution<size_t> hot_page(0, hot_bytes / page_size - 1);
+        std::uniform_int_distribution<size_t> any_page(0, reader->size() / page_size - 1);
+        std::vector<char> buffer(page_size);
+        FileCacheStatistics cache_stats;
+        IOContext io_ctx;
+        io_ctx.file_cache_stats = &cache_stats;
+        HistogramStat read_latency;
+        size_t read_bytes = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < num_reads; ++i) {
+            size_t offset = (hot(rng) ? hot_page(rng) : any_page(rng)) * page_size;
+            size_t bytes_read = 0;
+            auto read_start = std::chrono::high_resolution_clock::now();
+            RETURN_IF_ERROR(reader->read_at(offset, Slice(buffer.data(), page_size), &bytes_read,
+                                            &io_ctx));
+            read_latency.add(elapsed_us(read_start));
+            read_bytes += bytes_read;
+        }
+        auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::high_resolution_clock::now() - start);
+        state.SetIterationTime(elapsed_seconds.count());
+        state.counters["ReadRate(B/S)"] =
+                benchmark::Counter(read_bytes, benchmark::Counter::kIsRate);
+        state.counters["ReadTotal(B)"] = read_bytes;
+        state.counters["LocalIO"] = cache_stats.num_local_io_total;
+        state.counters["RemoteIO"] = cache_stats.num_remote_io_total;
+        state.counters["BytesReadFromLocal"] = cache_stats.bytes_read_from_local;
+        state.counters["BytesReadFromRemote"] = cache_stats.bytes_read_from_remote;
+        set_latency_counters(state, "Read", read_latency);
+        return reader->close();
+    }
+};
+
 class S3CreateWriteBenchmark : public S3Benchmark {
 public:
     S3CreateWriteBenchmark(int threads, int iterations, size_t file_size,
@@ -28,12 +28,15 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/status.h"
+#include "io/fs/hdfs_file_reader.h"
+#include "io/fs/local_file_reader.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
 #include "util/threadpool.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
@@ -45,6 +48,99 @@ bvar::PerSecond<bvar::Adder<uint64_t>> g_bytes_downloaded_per_second("buffered_r
                                                                      "bytes_downloaded_per_second",
                                                                      &g_bytes_downloaded, 60);
 
+IOCostModel* IOCostModel::instance(FileReader* reader) {
+    static IOCostModel s_local_model;
+    static IOCostModel s_s3_model;
+    static IOCostModel s_hdfs_model;
+    static IOCostModel s_broker_model;
+    if (typeid_cast<S3FileReader*>(reader) != nullptr) {
+        return &s_s3_model;
+    }
+    if (typeid_cast<HdfsFileReader*>(reader) != nullptr) {
+        return &s_hdfs_model;
+    }
+    if (typeid_cast<LocalFileReader*>(reader) != nullptr) {
+        return &s_local_model;
+    }
+    if (typeid_cast<BrokerFileReader*>(reader) != nullptr) {
+        return &s_broker_model;
+    }
+    return nullptr;
+}
+
+void IOCostModel::record(size_t bytes, int64_t elapsed_ns) {
+    if (bytes == 0) {
+        return;
+    }
+    auto x = static_cast<double>(bytes);
+    auto y = static_cast<double>(elapsed_ns);
+    std::lock_guard l(_mutex);
+    ++_samples;
+    double weight = 1.0 / static_cast<double>(std::min(_samples, WINDOW));
+    _mean_x += weight * (x - _mean_x);
+    _mean_y += weight * (y - _mean_y);
+    _mean_xx += weight * (x * x - _mean_xx);
+    _mean_xy += weight * (x * y - _mean_xy);
+    if (_samples < MIN_SAMPLES) {
+        return;
+    }
+    double variance = _mean_xx - _mean_x * _mean_x;
+    if (variance <= 0) {
+        // the reads of the same size can't tell the latency from the transfer
+        return;
+    }
+    double ns_per_byte = (_mean_xy - _mean_x * _mean_y) / variance;
+    double latency_ns = _mean_y - ns_per_byte * _mean_x;
+    if (ns_per_byte <= 0 || latency_ns <= 0) {
+        return;
+    }
+    auto size = static_cast<size_t>(
+            std::min(latency_ns / ns_per_byte, static_cast<double>(MAX_IO_SIZE)));
+    _equivalent_io_size.store(std::max(size, MIN_IO_SIZE), std::memory_order_relaxed);
+}
+
+void MergeRangeFileReader::_init_merge_policy() {
+    FileReader* reader = _reader.get();
+    auto* cached_reader = typeid_cast<CachedRemoteFileReader*>(reader);
+    if (cached_reader != nullptr) {
+        reader = cached_reader->get_remote_reader();
+        if (config::skip_merging_file_cached_ranges) {
+            auto blocks = cached_reader->downloaded_blocks();
+            _range_in_file_cache.resize(_random_access_ranges.size(), false);
+            for (size_t i = 0; i < _random_access_ranges.size() && !blocks.empty(); ++i) {
+                const PrefetchRange& range = _random_access_ranges[i];
+                size_t cur_offset = range.start_offset;
+                auto it = blocks.upper_bound(cur_offset);
+                if (it != blocks.begin()) {
+                    --it;
+                }
+                for (; cur_offset < range.end_offset && it != blocks.end(); ++it) {
+                    if (it->second->offset() > cur_offset ||
+                        it->second->range().right < cur_offset) {
+                        break;
+                    }
+                    cur_offset = it->second->range().right + 1;
+                }
+                _range_in_file_cache[i] = cur_offset >= range.end_offset;
+            }
+        }
+    }
+    if (config::enable_adaptive_merged_io_size) {
+        _io_cost_model = IOCostModel::instance(reader);
+        _record_io_cost = _io_cost_model != nullptr && cached_reader == nullptr;
+    }
+}
+
+Status MergeRangeFileReader::_read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                                               const IOContext* io_ctx) {
+    int64_t start_ns = MonotonicNanos();
+    RETURN_IF_ERROR(_reader->read_at(offset, result, bytes_read, io_ctx));
+    if (_record_io_cost) {
+        _io_cost_model->record(*bytes_read, MonotonicNanos() - start_ns);
+    }
+    return Status::OK();
+}
+
 Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                           const IOContext* io_ctx) {
     _statistics.request_io++;
@@ -55,7 +151,7 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     const int range_index = _search_read_range(offset, offset + result.size);
     if (range_index < 0) {
         SCOPED_RAW_TIMER(&_statistics.read_time);
-        Status st = _reader->read_at(offset, result, bytes_read, io_ctx);
+        Status st = _read_from_reader(offset, result, bytes_read, io_ctx);
         _statistics.merged_io++;
         _statistics.request_bytes += *bytes_read;
         _statistics.merged_bytes += *bytes_read;
@@ -87,11 +183,13 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     }
 
     size_t to_read = result.size - has_read;
-    if (to_read >= SMALL_IO || to_read >= _remaining) {
+    // no need to merge the reads of the cached ranges, they don't reach the remote storage
+    if (to_read >= SMALL_IO || to_read >= _remaining || _in_file_cache(range_index)) {
         SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read,
+                                          Slice(result.data + has_read, to_read), &read_size,
+                                          io_ctx));
         *bytes_read = has_read + read_size;
         _statistics.merged_io++;
         _statistics.request_bytes += read_size;
@@ -103,6 +201,11 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     size_t merge_start = offset + has_read;
     const size_t merge_end = merge_start + READ_SLICE_SIZE;
     // <slice_size, is_content>
+    if (_io_cost_model != nullptr) {
+        if (size_t io_size = _io_cost_model->equivalent_io_size(); io_size > 0) {
+            _equivalent_io_size = io_size;
+        }
+    }
     std::vector<std::pair<size_t, bool>> merged_slice;
     size_t content_size = 0;
     size_t hollow_size = 0;
@@ -185,8 +288,9 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
         // read directly to avoid copy operation
         SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read,
+                                          Slice(result.data + has_read, to_read), &read_size,
+                                          io_ctx));
         *bytes_read = has_read + read_size;
         _statistics.merged_io++;
         _statistics.request_bytes += read_size;
@@ -316,8 +420,8 @@ Status MergeRangeFileReader::_fill_box(int range_index, size_t start_offset, siz
     *bytes_read = 0;
     {
         SCOPED_RAW_TIMER(&_statistics.read_time);
-        RETURN_IF_ERROR(_reader->read_at(start_offset, Slice(_read_slice->data(), to_read),
-                                         bytes_read, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(start_offset, Slice(_read_slice->data(), to_read),
+                                          bytes_read, io_ctx));
         _statistics.merged_io++;
         _statistics.merged_bytes += *bytes_read;
     }
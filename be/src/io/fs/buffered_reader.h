@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -213,6 +214,41 @@ private:
  * equals zero, the box can be release or reused by other ranges. When there is no empty box for a new
  * read operation, the read operation will do directly.
  */
+// Models the time of a read from a kind of file system as latency + bytes / bandwidth, which are
+// fitted from the measured reads by the least squares with the recent reads weighted more. The io
+// size at which the latency is as long as the transfer, latency * bandwidth, is the equivalent
+// min size of each IO that can reach the bandwidth.
+class IOCostModel {
+public:
+    static constexpr size_t MIN_IO_SIZE = 4 * 1024;        // 4KB
+    static constexpr size_t MAX_IO_SIZE = 8 * 1024 * 1024; // 8MB
+
+    // The model of the file system `reader` reads, nullptr for an unknown one.
+    static IOCostModel* instance(FileReader* reader);
+
+    void record(size_t bytes, int64_t elapsed_ns);
+
+    // Return 0 if it's not estimated yet.
+    size_t equivalent_io_size() const {
+        return _equivalent_io_size.load(std::memory_order_relaxed);
+    }
+
+private:
+    // the reads before fitting
+    static constexpr int64_t MIN_SAMPLES = 32;
+    // the weight of a new read is 1 / WINDOW once there are enough reads
+    static constexpr int64_t WINDOW = 1024;
+
+    std::mutex _mutex;
+    int64_t _samples = 0;
+    // the weighted means of bytes, time, bytes^2 and bytes * time
+    double _mean_x = 0;
+    double _mean_y = 0;
+    double _mean_xx = 0;
+    double _mean_xy = 0;
+    std::atomic<size_t> _equivalent_io_size = 0;
+};
+
 class MergeRangeFileReader : public io::FileReader {
 public:
     struct Statistics {
@@ -307,6 +343,7 @@ public:
             _apply_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "ApplyBytes", TUnit::BYTES,
                                                         random_profile, 1);
         }
+        _init_merge_policy();
     }
 
     ~MergeRangeFileReader() override = default;
@@ -371,6 +408,13 @@ private:
     Status _fill_box(int range_index, size_t start_offset, size_t to_read, size_t* bytes_read,
                      const IOContext* io_ctx);
     void _dec_box_ref(int16_t box_index);
+    void _init_merge_policy();
+    // Read from the inner reader, and record the cost of the read.
+    Status _read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                             const IOContext* io_ctx);
+    bool _in_file_cache(int range_index) const {
+        return !_range_in_file_cache.empty() && _range_in_file_cache[range_index];
+    }
 
     RuntimeProfile* _profile = nullptr;
     io::FileReaderSPtr _reader;
@@ -388,6 +432,12 @@ private:
     bool _is_oss;
     double _max_amplified_ratio;
     size_t _equivalent_io_size;
+    // the model of the file system the inner reader reads, nullptr if it's disabled
+    IOCostModel* _io_cost_model = nullptr;
+    // the reads served by the file cache are not recorded into the model
+    bool _record_io_cost = false;
+    // whether each range is in the file cache, empty if the inner reader is not cached
+    std::vector<bool> _range_in_file_cache;
 
     Statistics _statistics;
 };
@@ -17,10 +17,27 @@
 
 #include "io/fs/file_meta_cache.h"
 
+#include <fmt/format.h>
+
+#include "io/fs/file_reader.h"
+#include "runtime/memory/lru_cache_value_base.h"
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
 
 namespace doris {
 
+namespace {
+
+struct FileIndexValue : public LRUCacheValueBase {
+    std::string data;
+};
+
+} // namespace
+
+Slice FileIndexHandle::data() const {
+    const auto& data = static_cast<FileIndexValue*>(_cache->value(_handle))->data;
+    return {data.data(), data.size()};
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
@@ -39,4 +56,28 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     return Status::OK();
 }
 
+Status FileMetaCache::get_file_index(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
+                                     int64_t mtime, size_t offset, size_t size,
+                                     size_t* bytes_read, FileIndexHandle* handle) {
+    std::string cache_key = fmt::format("{}:{}:{}:{}:{}", file_reader->path().native(), mtime,
+                                        file_reader->size(), offset, size);
+    *bytes_read = 0;
+    if (auto* lru_handle = _index_cache.lookup(cache_key); lru_handle != nullptr) {
+        *handle = FileIndexHandle(&_index_cache, lru_handle);
+        return Status::OK();
+    }
+    auto value = std::make_unique<FileIndexValue>();
+    value->data.resize(size);
+    RETURN_IF_ERROR(file_reader->read_at(offset, Slice(value->data.data(), size), bytes_read,
+                                         io_ctx));
+    if (*bytes_read != size) {
+        return Status::IOError("failed to read index of {} at {}, bytes_req={}, bytes_read={}",
+                               file_reader->path().native(), offset, size, *bytes_read);
+    }
+    auto* lru_handle = _index_cache.insert(cache_key, value.get(), size, size);
+    value.release();
+    *handle = FileIndexHandle(&_index_cache, lru_handle);
+    return Status::OK();
+}
+
 } // namespace doris
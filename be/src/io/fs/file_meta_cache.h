@@ -17,17 +17,63 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
+#include "common/config.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "runtime/memory/lru_cache_policy.h"
 #include "util/obj_lru_cache.h"
+#include "util/slice.h"
 
 namespace doris {
 
+// The serialized index of a file in FileMetaCache, which stays in the cache while it's held.
+class FileIndexHandle {
+public:
+    FileIndexHandle() = default;
+    ~FileIndexHandle() {
+        if (_handle != nullptr) {
+            _cache->release(_handle);
+        }
+    }
+
+    FileIndexHandle(FileIndexHandle&& other) noexcept {
+        std::swap(_cache, other._cache);
+        std::swap(_handle, other._handle);
+    }
+
+    FileIndexHandle& operator=(FileIndexHandle&& other) noexcept {
+        std::swap(_cache, other._cache);
+        std::swap(_handle, other._handle);
+        return *this;
+    }
+
+    Slice data() const;
+
+private:
+    friend class FileMetaCache;
+
+    FileIndexHandle(LRUCachePolicy* cache, Cache::Handle* handle)
+            : _cache(cache), _handle(handle) {}
+
+    LRUCachePolicy* _cache = nullptr;
+    Cache::Handle* _handle = nullptr;
+
+    DISALLOW_COPY_AND_ASSIGN(FileIndexHandle);
+};
+
 // A file meta cache depends on a LRU cache.
 // Such as parsed parquet footer.
 // The capacity will limit the number of cache entries in cache.
+//
+// The indexes of the files, such as the page index of a parquet row group, are kept serialized,
+// which is much smaller than the parsed objects and cheap to parse again, in another cache whose
+// capacity is in bytes.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    FileMetaCache(int64_t capacity, int64_t index_capacity = 0)
+            : _cache(capacity), _index_cache(index_capacity) {}
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
@@ -42,8 +88,23 @@ public:
         return Status::OK();
     }
 
+    // Read the index of `size` bytes at `offset` of the file through the index cache, which is
+    // keyed by the path, mtime and size of the file. `*bytes_read` is 0 if the index is cached.
+    Status get_file_index(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
+                          size_t offset, size_t size, size_t* bytes_read,
+                          FileIndexHandle* handle);
+
 private:
+    class IndexCache : public LRUCachePolicy {
+    public:
+        IndexCache(int64_t capacity)
+                : LRUCachePolicy(CachePolicy::CacheType::FILE_META_INDEX_CACHE, capacity,
+                                 LRUCacheType::SIZE,
+                                 config::common_obj_lru_cache_stale_sweep_time_sec) {}
+    };
+
     ObjLRUCache _cache;
+    IndexCache _index_cache;
 };
 
 } // namespace doris
@@ -34,6 +34,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
+#include "io/io_common.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/options.h"
@@ -125,7 +126,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -170,6 +171,7 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
         }
     }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
+    update_local_disk_io(io_ctx, *bytes_read);
     return Status::OK();
 }
 
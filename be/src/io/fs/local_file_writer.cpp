@@ -186,6 +186,49 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
     return Status::OK();
 }
 
+Status LocalFileWriter::sync_data() {
+    if (_state != State::OPENED) [[unlikely]] {
+        return Status::InternalError("sync closed file: {}", _path.native());
+    }
+#ifdef __APPLE__
+    if (fcntl(_fd, F_FULLFSYNC) < 0) [[unlikely]] {
+        return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+    }
+#else
+    if (0 != ::fdatasync(_fd)) [[unlikely]] {
+        return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+    }
+#endif
+    return Status::OK();
+}
+
+Status LocalFileWriter::preallocate(size_t bytes) {
+#if defined(__linux__)
+    if (0 != ::fallocate(_fd, FALLOC_FL_KEEP_SIZE, 0, bytes)) [[unlikely]] {
+        return localfs_error(errno, fmt::format("failed to preallocate {}", _path.native()));
+    }
+#endif
+    return Status::OK();
+}
+
+Status LocalFileWriter::drop_page_cache() {
+    if (_state != State::OPENED) [[unlikely]] {
+        return Status::InternalError("drop page cache of closed file: {}", _path.native());
+    }
+#if defined(__linux__)
+    // the dirty pages are not dropped, so wait for them to be written back first
+    int flags = SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER;
+    if (sync_file_range(_fd, 0, 0, flags) < 0) [[unlikely]] {
+        return localfs_error(errno, fmt::format("failed to write back {}", _path.native()));
+    }
+    if (int err = ::posix_fadvise(_fd, 0, 0, POSIX_FADV_DONTNEED); err != 0) [[unlikely]] {
+        return localfs_error(err, fmt::format("failed to drop page cache of {}", _path.native()));
+    }
+    _dirty = false;
+#endif
+    return Status::OK();
+}
+
 // TODO(ByteYue): Refactor this function as FileWriter::flush()
 Status LocalFileWriter::_finalize() {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileWriter::finalize",
@@ -40,6 +40,15 @@ public:
 
     Status close(bool non_block = false) override;
 
+    // Sync the data appended so far, it may be called concurrently with `appendv`.
+    Status sync_data();
+
+    // Allocate the disk space of `bytes` from the start of the file, without changing its size.
+    Status preallocate(size_t bytes);
+
+    // Write the data appended so far back to the disk, and drop its pages from the page cache.
+    Status drop_page_cache();
+
 private:
     Status _finalize();
     void _abort();
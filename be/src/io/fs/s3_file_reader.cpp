@@ -29,18 +29,25 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "io/io_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 
 namespace doris::io {
 
@@ -56,6 +63,70 @@ bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3
 // record successfull request, and s3_get_request_qps will record all request.
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_get_request_qps("s3_file_reader", "s3_get_request",
                                                           &s3_file_reader_read_counter);
+// The requests which take longer than the hedging delay, and the duplicate requests sent for them
+bvar::Adder<uint64_t> s3_file_reader_outlier_request("s3_file_reader", "outlier_get_request");
+bvar::Adder<uint64_t> s3_file_reader_hedged_request("s3_file_reader", "hedged_get_request");
+bvar::Adder<uint64_t> s3_file_reader_hedged_win("s3_file_reader", "hedged_get_request_win");
+
+namespace {
+
+// The latency of the "get" requests is recorded by the size of the range, reads up to 64KB,
+// 256KB, 1MB, 4MB and the larger ones.
+constexpr std::array<size_t, 4> GET_SIZE_CLASS_BOUNDS {64 << 10, 256 << 10, 1 << 20, 4 << 20};
+std::array<bvar::LatencyRecorder, GET_SIZE_CLASS_BOUNDS.size() + 1> s3_get_latency_us {
+        bvar::LatencyRecorder("s3_file_reader", "get_latency_64KB"),
+        bvar::LatencyRecorder("s3_file_reader", "get_latency_256KB"),
+        bvar::LatencyRecorder("s3_file_reader", "get_latency_1MB"),
+        bvar::LatencyRecorder("s3_file_reader", "get_latency_4MB"),
+        bvar::LatencyRecorder("s3_file_reader", "get_latency_large")};
+
+bvar::LatencyRecorder& get_latency_of(size_t bytes) {
+    size_t i = 0;
+    while (i < GET_SIZE_CLASS_BOUNDS.size() && bytes > GET_SIZE_CLASS_BOUNDS[i]) {
+        ++i;
+    }
+    return s3_get_latency_us[i];
+}
+
+// Each "get" request earns s3_hedged_read_budget_percent hundredths of a duplicate request,
+// and the unused budget is capped so a burst of slow requests can't flood the storage.
+constexpr int64_t MAX_HEDGE_BUDGET = 100 * 100;
+std::atomic<int64_t> hedge_budget {0};
+
+void earn_hedge_budget() {
+    int64_t earned = config::s3_hedged_read_budget_percent;
+    if (hedge_budget.load(std::memory_order_relaxed) + earned <= MAX_HEDGE_BUDGET) {
+        hedge_budget.fetch_add(earned, std::memory_order_relaxed);
+    }
+}
+
+bool consume_hedge_budget() {
+    if (hedge_budget.fetch_sub(100, std::memory_order_relaxed) >= 100) {
+        return true;
+    }
+    hedge_budget.fetch_add(100, std::memory_order_relaxed);
+    return false;
+}
+
+// Shared by the requests of a hedged read, which may outlive the read.
+struct HedgedGet {
+    struct Attempt {
+        std::unique_ptr<char[]> buf;
+        size_t bytes_read = 0;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::array<Attempt, 2> attempts;
+    int launched = 0;
+    int failed = 0;
+    // the attempt which succeeds first, -1 if all of them fail
+    int winner = -1;
+    bool done = false;
+    ObjectStorageResponse resp;
+};
+
+} // namespace
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key, int64_t file_size,
@@ -103,7 +174,7 @@ Status S3FileReader::close() {
 }
 
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::InternalError(
@@ -134,10 +205,9 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     while (retry_count <= max_retries) {
         *bytes_read = 0;
         s3_file_reader_read_counter << 1;
-        // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
-        // clang-format on
+        auto resp = bytes_req <= config::s3_hedged_read_max_bytes && config::enable_s3_hedged_read
+                            ? _hedged_get_object(client, to, offset, bytes_req, bytes_read)
+                            : _get_object(client.get(), to, offset, bytes_req, bytes_read);
         _s3_stats.total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
@@ -169,6 +239,7 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         s3_bytes_read_total << bytes_req;
         s3_bytes_per_read << bytes_req;
         DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
+        update_remote_storage_io(io_ctx, bytes_req);
         if (retry_count > 0) {
             LOG(INFO) << fmt::format("read s3 file {} succeed after {} times with {} ms sleeping",
                                      _path.native(), retry_count, total_sleep_time);
@@ -183,6 +254,99 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::InternalError(msg);
 }
 
+ObjectStorageResponse S3FileReader::_get_object(ObjStorageClient* client, char* to, size_t offset,
+                                                size_t bytes_req, size_t* bytes_read) {
+    int64_t start_us = MonotonicMicros();
+    // clang-format off
+    auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
+            to, offset, bytes_req, bytes_read);
+    // clang-format on
+    if (resp.status.code == ErrorCode::OK) {
+        get_latency_of(bytes_req) << MonotonicMicros() - start_us;
+    }
+    return resp;
+}
+
+ObjectStorageResponse S3FileReader::_hedged_get_object(
+        const std::shared_ptr<ObjStorageClient>& client, char* to, size_t offset,
+        size_t bytes_req, size_t* bytes_read) {
+    ThreadPool* pool = ExecEnv::GetInstance()->s3_hedged_read_thread_pool();
+    if (pool == nullptr) {
+        return _get_object(client.get(), to, offset, bytes_req, bytes_read);
+    }
+    earn_hedge_budget();
+    auto& latency = get_latency_of(bytes_req);
+    auto delay_us = std::max<int64_t>(latency.latency_percentile(0.95),
+                                      config::s3_hedged_read_min_delay_ms * 1000L);
+
+    // The requests write into their own buffers, so the loser never touches `to` after the
+    // read returns.
+    auto hedged = std::make_shared<HedgedGet>();
+    auto launch = [&](int i) {
+        return pool->submit_func([hedged, i, client, bucket = _bucket, key = _key, offset,
+                                  bytes_req]() {
+            auto& attempt = hedged->attempts[i];
+            int64_t start_us = MonotonicMicros();
+            attempt.buf = std::make_unique<char[]>(bytes_req);
+            // clang-format off
+            auto resp = client->get_object( { .bucket = bucket, .key = key, },
+                    attempt.buf.get(), offset, bytes_req, &attempt.bytes_read);
+            // clang-format on
+            bool ok = resp.status.code == ErrorCode::OK && attempt.bytes_read == bytes_req;
+            if (ok) {
+                get_latency_of(bytes_req) << MonotonicMicros() - start_us;
+            }
+            std::lock_guard lock(hedged->mutex);
+            if (hedged->done) {
+                return;
+            }
+            if (ok) {
+                hedged->winner = i;
+                hedged->resp = std::move(resp);
+                hedged->done = true;
+            } else {
+                hedged->resp = std::move(resp);
+                hedged->done = ++hedged->failed == hedged->launched;
+            }
+            if (hedged->done) {
+                hedged->cv.notify_all();
+            }
+        });
+    };
+
+    hedged->launched = 1;
+    if (!launch(0).ok()) {
+        return _get_object(client.get(), to, offset, bytes_req, bytes_read);
+    }
+    std::unique_lock lock(hedged->mutex);
+    if (!hedged->cv.wait_for(lock, std::chrono::microseconds(delay_us),
+                             [&]() { return hedged->done; })) {
+        s3_file_reader_outlier_request << 1;
+        if (consume_hedge_budget()) {
+            hedged->launched = 2;
+            if (launch(1).ok()) {
+                s3_file_reader_hedged_request << 1;
+                _s3_stats.hedged_get_request_counter++;
+            } else {
+                hedged->launched = 1;
+                hedge_budget.fetch_add(100, std::memory_order_relaxed);
+            }
+        }
+        hedged->cv.wait(lock, [&]() { return hedged->done; });
+    }
+    if (hedged->winner < 0) {
+        *bytes_read = 0;
+        return hedged->resp;
+    }
+    if (hedged->winner == 1) {
+        s3_file_reader_hedged_win << 1;
+    }
+    auto& attempt = hedged->attempts[hedged->winner];
+    memcpy(to, attempt.buf.get(), attempt.bytes_read);
+    *bytes_read = attempt.bytes_read;
+    return hedged->resp;
+}
+
 void S3FileReader::_collect_profile_before_close() {
     if (_profile != nullptr) {
         const char* s3_profile_name = "S3Profile";
@@ -195,11 +359,14 @@ void S3FileReader::_collect_profile_before_close() {
                 _profile, "TooManyRequestSleepTime", TUnit::TIME_MS, s3_profile_name);
         RuntimeProfile::Counter* total_bytes_read =
                 ADD_CHILD_COUNTER(_profile, "TotalBytesRead", TUnit::BYTES, s3_profile_name);
+        RuntimeProfile::Counter* hedged_get_request_counter =
+                ADD_CHILD_COUNTER(_profile, "HedgedGetRequest", TUnit::UNIT, s3_profile_name);
 
         COUNTER_UPDATE(total_get_request_counter, _s3_stats.total_get_request_counter);
         COUNTER_UPDATE(too_many_request_err_counter, _s3_stats.too_many_request_err_counter);
         COUNTER_UPDATE(too_many_request_sleep_time, _s3_stats.too_many_request_sleep_time_ms);
         COUNTER_UPDATE(total_bytes_read, _s3_stats.total_bytes_read);
+        COUNTER_UPDATE(hedged_get_request_counter, _s3_stats.hedged_get_request_counter);
     }
 }
 
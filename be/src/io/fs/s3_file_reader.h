@@ -65,7 +65,16 @@ private:
         int64_t too_many_request_err_counter = 0;
         int64_t too_many_request_sleep_time_ms = 0;
         int64_t total_bytes_read = 0;
+        int64_t hedged_get_request_counter = 0;
     };
+
+    // Get the range by a hedged request if it's enabled, see config::enable_s3_hedged_read.
+    ObjectStorageResponse _get_object(ObjStorageClient* client, char* to, size_t offset,
+                                      size_t bytes_req, size_t* bytes_read);
+    ObjectStorageResponse _hedged_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                                             char* to, size_t offset, size_t bytes_req,
+                                             size_t* bytes_read);
+
     Path _path;
     size_t _file_size;
 
@@ -22,8 +22,11 @@
 #include <fmt/core.h>
 #include <glog/logging.h>
 
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "common/config.h"
@@ -50,12 +53,67 @@ bvar::Adder<uint64_t> s3_file_being_written("s3_file_writer_file_being_written")
 bvar::Adder<uint64_t> s3_file_writer_async_close_queuing("s3_file_writer_async_close_queuing");
 bvar::Adder<uint64_t> s3_file_writer_async_close_processing(
         "s3_file_writer_async_close_processing");
+bvar::Adder<uint64_t> s3_file_writer_upload_waiting("s3_file_writer_upload_waiting");
+
+namespace {
+
+// Limits the concurrent uploading requests to a bucket of all the s3 file writers by
+// config::s3_upload_max_connections_per_bucket, the uploading threads beyond the limit
+// wait for the running ones.
+class BucketUploadPermit {
+public:
+    explicit BucketUploadPermit(const std::string& bucket) : _bucket(bucket) {
+        int limit = config::s3_upload_max_connections_per_bucket;
+        if (limit <= 0) {
+            return;
+        }
+        std::unique_lock lock(_mutex);
+        auto& running = _running[_bucket];
+        if (running >= limit) {
+            s3_file_writer_upload_waiting << 1;
+            _cv.wait(lock, [&]() {
+                return running < config::s3_upload_max_connections_per_bucket ||
+                       config::s3_upload_max_connections_per_bucket <= 0;
+            });
+            s3_file_writer_upload_waiting << -1;
+        }
+        ++running;
+        _acquired = true;
+    }
+
+    ~BucketUploadPermit() {
+        if (!_acquired) {
+            return;
+        }
+        {
+            std::lock_guard lock(_mutex);
+            if (--_running[_bucket] == 0) {
+                _running.erase(_bucket);
+            }
+        }
+        _cv.notify_all();
+    }
+
+private:
+    const std::string& _bucket;
+    bool _acquired = false;
+
+    static inline std::mutex _mutex;
+    static inline std::condition_variable _cv;
+    // the number of running uploading requests of each bucket
+    static inline std::unordered_map<std::string, int> _running;
+};
+
+} // namespace
 
 S3FileWriter::S3FileWriter(std::shared_ptr<ObjClientHolder> client, std::string bucket,
                            std::string key, const FileWriterOptions* opts)
         : _obj_storage_path_opts({.path = fmt::format("s3://{}/{}", bucket, key),
                                   .bucket = std::move(bucket),
                                   .key = std::move(key)}),
+          _min_part_size(config::s3_write_buffer_size),
+          _max_part_size(std::max(config::s3_write_buffer_size, config::s3_write_buffer_max_size)),
+          _part_size_grow_parts(config::s3_write_buffer_grow_parts),
           _used_by_s3_committer(opts ? opts->used_by_s3_committer : false),
           _obj_client(std::move(client)) {
     s3_file_writer_total << 1;
@@ -89,6 +147,19 @@ S3FileWriter::~S3FileWriter() {
     s3_file_being_written << -1;
 }
 
+size_t S3FileWriter::part_size(int64_t part_num, size_t min_size, size_t max_size,
+                               int64_t grow_parts) {
+    if (grow_parts <= 0 || max_size <= min_size) {
+        return min_size;
+    }
+    int64_t times = (part_num - 1) / grow_parts;
+    // no need to shift further once the max size is reached
+    if (times >= 63 || (max_size >> times) < min_size) {
+        return max_size;
+    }
+    return std::min(min_size << times, max_size);
+}
+
 Status S3FileWriter::_create_multi_upload_request() {
     LOG(INFO) << "create_multi_upload_request " << _obj_storage_path_opts.path.native();
     const auto& client = _obj_client->get();
@@ -176,8 +247,10 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
 }
 
 Status S3FileWriter::_build_upload_buffer() {
+    size_t capacity = _part_size(_cur_part_num);
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
+            .set_capacity(capacity)
             .set_upload_callback([part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                 _upload_one_part(part_num, buf);
             })
@@ -192,8 +265,9 @@ Status S3FileWriter::_build_upload_buffer() {
         // try to do writing into file cache, so we make the lambda capture the variable
         // we need by value to extend their lifetime
         builder.set_allocate_file_blocks_holder(
-                [builder = *_cache_builder, offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                    return builder.allocate_cache_holder(offset, config::s3_write_buffer_size);
+                [builder = *_cache_builder, offset = _bytes_appended,
+                 capacity]() -> FileBlocksHolderPtr {
+                    return builder.allocate_cache_holder(offset, capacity);
                 });
     }
     RETURN_IF_ERROR(builder.build(&_pending_buf));
@@ -239,7 +313,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -252,6 +325,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             }
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
+            size_t buffer_size = _pending_buf->get_capacaticy();
             data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
                                                                     buffer_size - _bytes_appended);
 
@@ -272,6 +346,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                     RETURN_IF_ERROR(_create_multi_upload_request());
                 }
                 _cur_part_num++;
+                _full_parts_bytes += buffer_size;
                 _countdown_event.add_count();
                 RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
                 _pending_buf = nullptr;
@@ -297,7 +372,11 @@ void S3FileWriter::_upload_one_part(int64_t part_num, UploadFileBuffer& buf) {
         buf.set_status(Status::InternalError<false>("invalid obj storage client"));
         return;
     }
-    auto resp = client->upload_part(_obj_storage_path_opts, buf.get_string_view_data(), part_num);
+    ObjectStorageUploadResponse resp;
+    {
+        BucketUploadPermit permit(_obj_storage_path_opts.bucket);
+        resp = client->upload_part(_obj_storage_path_opts, buf.get_string_view_data(), part_num);
+    }
     if (resp.resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to upload part, key={}, part_num={}, status={}",
                     _obj_storage_path_opts.key, part_num, resp.resp.status.msg);
@@ -386,13 +465,15 @@ Status S3FileWriter::_complete() {
     }
 
     // check number of parts
-    int expected_num_parts1 = (_bytes_appended / config::s3_write_buffer_size) +
-                              !!(_bytes_appended % config::s3_write_buffer_size);
+    int expected_num_parts1 = 0;
+    for (size_t remaining = _bytes_appended; remaining > 0;) {
+        remaining -= std::min(remaining, _part_size(++expected_num_parts1));
+    }
     int expected_num_parts2 =
-            (_bytes_appended % config::s3_write_buffer_size) ? _cur_part_num : _cur_part_num - 1;
+            (_bytes_appended > _full_parts_bytes) ? _cur_part_num : _cur_part_num - 1;
     DCHECK_EQ(expected_num_parts1, expected_num_parts2)
             << " bytes_appended=" << _bytes_appended << " cur_part_num=" << _cur_part_num
-            << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+            << " min_part_size=" << _min_part_size << " max_part_size=" << _max_part_size;
     if (_failed || _completed_parts.size() != expected_num_parts1 ||
         expected_num_parts1 != expected_num_parts2) {
         _st = Status::InternalError(
@@ -410,7 +491,7 @@ Status S3FileWriter::_complete() {
     TEST_SYNC_POINT_CALLBACK("S3FileWriter::_complete:2", &_completed_parts);
     LOG(INFO) << "complete_multipart_upload " << _obj_storage_path_opts.path.native()
               << " size=" << _bytes_appended << " number_parts=" << _completed_parts.size()
-              << " s3_write_buffer_size=" << config::s3_write_buffer_size;
+              << " min_part_size=" << _min_part_size << " max_part_size=" << _max_part_size;
     auto resp = client->complete_multipart_upload(_obj_storage_path_opts, _completed_parts);
     if (resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to complete multipart upload, err={}, file_path={}", resp.status.msg,
@@ -460,7 +541,11 @@ void S3FileWriter::_put_object(UploadFileBuffer& buf) {
         return;
     }
     TEST_SYNC_POINT_RETURN_WITH_VOID("S3FileWriter::_put_object", this, &buf);
-    auto resp = client->put_object(_obj_storage_path_opts, buf.get_string_view_data());
+    ObjectStorageResponse resp;
+    {
+        BucketUploadPermit permit(_obj_storage_path_opts.bucket);
+        resp = client->put_object(_obj_storage_path_opts, buf.get_string_view_data());
+    }
     if (resp.status.code != ErrorCode::OK) {
         LOG_WARNING("failed to put object, put object failed because {}, file path {}",
                     resp.status.msg, _obj_storage_path_opts.path.native());
@@ -74,6 +74,11 @@ public:
 
     Status close(bool non_block = false) override;
 
+    // The size of the part `part_num` (starts from 1), which is doubled every `grow_parts`
+    // parts from `min_size` up to `max_size`.
+    static size_t part_size(int64_t part_num, size_t min_size, size_t max_size,
+                            int64_t grow_parts);
+
 private:
     Status _close_impl();
     Status _abort();
@@ -86,6 +91,9 @@ private:
     void _upload_one_part(int64_t part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
     Status _build_upload_buffer();
+    size_t _part_size(int64_t part_num) const {
+        return part_size(part_num, _min_part_size, _max_part_size, _part_size_grow_parts);
+    }
 
     ObjectStoragePathOptions _obj_storage_path_opts;
 
@@ -101,6 +109,12 @@ private:
 
     Status _st;
     size_t _bytes_appended = 0;
+    // the bytes of the parts submitted in appendv, which are full
+    size_t _full_parts_bytes = 0;
+    // the part sizing configs when the writer is created
+    size_t _min_part_size;
+    size_t _max_part_size;
+    int64_t _part_size_grow_parts;
 
     std::shared_ptr<FileBuffer> _pending_buf;
     std::unique_ptr<FileCacheAllocatorBuilder>
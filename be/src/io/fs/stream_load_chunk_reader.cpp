@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/stream_load_chunk_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace doris {
+namespace io {
+
+Status StreamLoadPipeSplitter::next_chunk(std::string* chunk) {
+    std::lock_guard l(_lock);
+    chunk->swap(_remainder);
+    _remainder.clear();
+    size_t searched = 0;
+    while (!_eof) {
+        size_t size = chunk->size();
+        chunk->resize(std::max(size * 2, size + _chunk_size));
+        size_t bytes_read = 0;
+        // the pipe blocks until the slice is filled or the body ends
+        RETURN_IF_ERROR(_pipe->read_at(0, Slice(chunk->data() + size, chunk->size() - size),
+                                       &bytes_read));
+        chunk->resize(size + bytes_read);
+        _eof = bytes_read == 0;
+        if (chunk->size() < _chunk_size && !_eof) {
+            continue;
+        }
+        // cut the chunk after its last line delimiter, a line longer than the chunk makes the
+        // chunk grow
+        const void* last_delimiter = memrchr(chunk->data() + searched, _line_delimiter,
+                                             chunk->size() - searched);
+        if (last_delimiter != nullptr) {
+            size_t end = static_cast<const char*>(last_delimiter) - chunk->data() + 1;
+            _remainder.assign(*chunk, end);
+            chunk->resize(end);
+            return Status::OK();
+        }
+        searched = chunk->size();
+    }
+    // the last line without the line delimiter
+    return Status::OK();
+}
+
+Status StreamLoadChunkReader::read_at_impl(size_t /*offset*/, Slice result, size_t* bytes_read,
+                                           const IOContext* /*io_ctx*/) {
+    *bytes_read = 0;
+    while (*bytes_read < result.size && !_eof) {
+        if (_chunk_pos == _chunk.size()) {
+            RETURN_IF_ERROR(_splitter->next_chunk(&_chunk));
+            _chunk_pos = 0;
+            _eof = _chunk.empty();
+            continue;
+        }
+        size_t copy_size = std::min(result.size - *bytes_read, _chunk.size() - _chunk_pos);
+        memcpy(result.data + *bytes_read, _chunk.data() + _chunk_pos, copy_size);
+        _chunk_pos += copy_size;
+        *bytes_read += copy_size;
+    }
+    return Status::OK();
+}
+
+} // namespace io
+} // namespace doris
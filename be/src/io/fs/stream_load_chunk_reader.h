@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "common/status.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/path.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace io {
+struct IOContext;
+
+// Cuts the body of a stream load into chunks of whole lines, so that several readers can parse
+// one body concurrently. Each chunk ends with the line delimiter, except the last one.
+class StreamLoadPipeSplitter {
+public:
+    StreamLoadPipeSplitter(FileReaderSPtr pipe, char line_delimiter, size_t chunk_size)
+            : _pipe(std::move(pipe)), _line_delimiter(line_delimiter), _chunk_size(chunk_size) {}
+
+    // `chunk` is empty at the end of the body.
+    Status next_chunk(std::string* chunk);
+
+    // cancel the pipe if it's not finished
+    Status close() { return _pipe->close(); }
+
+private:
+    std::mutex _lock;
+    FileReaderSPtr _pipe;
+    const char _line_delimiter;
+    const size_t _chunk_size;
+    // the bytes after the last line delimiter of the previous chunk
+    std::string _remainder;
+    bool _eof = false;
+};
+
+// Reads the chunks taken from a StreamLoadPipeSplitter as a stream of whole lines. Like the pipe,
+// it ignores the offset of a read.
+class StreamLoadChunkReader final : public FileReader {
+public:
+    explicit StreamLoadChunkReader(std::shared_ptr<StreamLoadPipeSplitter> splitter)
+            : _splitter(std::move(splitter)) {}
+
+    ~StreamLoadChunkReader() override = default;
+
+    // Like closing the pipe, a reader closed before the end of the body cancels the load.
+    Status close() override {
+        if (_closed) {
+            return Status::OK();
+        }
+        _closed = true;
+        return _eof ? Status::OK() : _splitter->close();
+    }
+
+    const Path& path() const override { return _path; }
+
+    size_t size() const override { return 0; }
+
+    bool closed() const override { return _closed; }
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const IOContext* io_ctx) override;
+
+private:
+    std::shared_ptr<StreamLoadPipeSplitter> _splitter;
+    std::string _chunk;
+    size_t _chunk_pos = 0;
+    bool _eof = false;
+    bool _closed = false;
+    Path _path = "";
+};
+
+} // namespace io
+} // namespace doris
@@ -80,6 +80,10 @@ Status StreamLoadPipe::read_at_impl(size_t /*offset*/, Slice result, size_t* byt
             _buf_queue.pop_front();
             _buffered_bytes -= buf->limit;
             _put_cond.notify_one();
+            if (auto on_drained = _take_on_drained()) {
+                l.unlock();
+                on_drained();
+            }
         }
     }
     DCHECK(*bytes_read == bytes_req)
@@ -162,6 +166,33 @@ Status StreamLoadPipe::append(const ByteBufferPtr& buf) {
     return _append(buf);
 }
 
+Status StreamLoadPipe::append_without_wait(const ByteBufferPtr& buf) {
+    if (_write_buf != nullptr) {
+        _write_buf->flip();
+        RETURN_IF_ERROR(_append(_write_buf, 0, false));
+        _write_buf.reset();
+    }
+    return _append(buf, 0, false);
+}
+
+bool StreamLoadPipe::notify_when_drained(std::function<void()> on_drained) {
+    std::lock_guard<std::mutex> l(_lock);
+    size_t buffered_bytes = _use_proto ? _proto_buffered_bytes : _buffered_bytes;
+    if (_cancelled || buffered_bytes < _max_buffered_bytes) {
+        return false;
+    }
+    _on_drained = std::move(on_drained);
+    return true;
+}
+
+std::function<void()> StreamLoadPipe::_take_on_drained() {
+    size_t buffered_bytes = _use_proto ? _proto_buffered_bytes : _buffered_bytes;
+    if (_on_drained == nullptr || (!_cancelled && buffered_bytes >= _max_buffered_bytes)) {
+        return nullptr;
+    }
+    return std::exchange(_on_drained, nullptr);
+}
+
 // read the next buffer from _buf_queue
 Status StreamLoadPipe::_read_next_buffer(std::unique_ptr<uint8_t[]>* data, size_t* length) {
     std::unique_lock<std::mutex> l(_lock);
@@ -193,19 +224,23 @@ Status StreamLoadPipe::_read_next_buffer(std::unique_ptr<uint8_t[]>* data, size_
         row_ptr.release();
     }
     _put_cond.notify_one();
+    if (auto on_drained = _take_on_drained()) {
+        l.unlock();
+        on_drained();
+    }
     return Status::OK();
 }
 
-Status StreamLoadPipe::_append(const ByteBufferPtr& buf, size_t proto_byte_size) {
+Status StreamLoadPipe::_append(const ByteBufferPtr& buf, size_t proto_byte_size, bool wait) {
     {
         std::unique_lock<std::mutex> l(_lock);
         // if _buf_queue is empty, we append this buf without size check
-        if (_use_proto) {
+        if (wait && _use_proto) {
             while (!_cancelled && !_buf_queue.empty() &&
                    (_proto_buffered_bytes + proto_byte_size > _max_buffered_bytes)) {
                 _put_cond.wait(l);
             }
-        } else {
+        } else if (wait) {
             while (!_cancelled && !_buf_queue.empty() &&
                    _buffered_bytes + buf->remaining() > _max_buffered_bytes) {
                 _put_cond.wait(l);
@@ -242,13 +277,18 @@ Status StreamLoadPipe::finish() {
 
 // called when producer/consumer failed
 void StreamLoadPipe::cancel(const std::string& reason) {
+    std::function<void()> on_drained;
     {
         std::lock_guard<std::mutex> l(_lock);
         _cancelled = true;
         _cancelled_reason = reason;
+        on_drained = _take_on_drained();
     }
     _get_cond.notify_all();
     _put_cond.notify_all();
+    if (on_drained) {
+        on_drained();
+    }
 }
 
 TUniqueId StreamLoadPipe::calculate_pipe_id(const UniqueId& query_id, int32_t fragment_id) {
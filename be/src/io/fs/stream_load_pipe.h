@@ -23,6 +23,7 @@
 
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -54,6 +55,14 @@ public:
     Status append(const char* data, size_t size) override;
     Status append(const ByteBufferPtr& buf) override;
 
+    // Like append(buf), but never waits for the consumer, so the buffered bytes may go over the
+    // limit. Used by the event threads of the HTTP server, which must not be blocked.
+    Status append_without_wait(const ByteBufferPtr& buf);
+
+    // Return false if the pipe is not full. Otherwise `on_drained` is called once by the consumer
+    // when the buffered bytes drop below the limit, or when the pipe is cancelled.
+    bool notify_when_drained(std::function<void()> on_drained);
+
     const Path& path() const override { return _path; }
 
     size_t size() const override { return 0; }
@@ -99,7 +108,10 @@ private:
     // read the next buffer from _buf_queue
     Status _read_next_buffer(std::unique_ptr<uint8_t[]>* data, size_t* length);
 
-    Status _append(const ByteBufferPtr& buf, size_t proto_byte_size = 0);
+    Status _append(const ByteBufferPtr& buf, size_t proto_byte_size = 0, bool wait = true);
+
+    // Must be called with _lock held, the returned callback must be called without _lock.
+    std::function<void()> _take_on_drained();
 
     // Blocking queue
     std::mutex _lock;
@@ -123,6 +135,8 @@ private:
 
     ByteBufferPtr _write_buf;
 
+    std::function<void()> _on_drained;
+
     // no use, only for compatibility with the `Path` interface
     Path _path = "";
 
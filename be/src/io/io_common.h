@@ -58,6 +58,15 @@ struct FileCacheStatistics {
     int64_t inverted_index_local_io_timer = 0;
     int64_t inverted_index_remote_io_timer = 0;
     int64_t inverted_index_io_timer = 0;
+
+    // The io of the file readers on the local disk and on the remote storage, counted by the
+    // readers themselves. The file cache reads the missed blocks from the remote storage with
+    // the same IOContext, so they are counted here too, as the bytes actually read from the
+    // remote storage, while bytes_read_from_remote are the bytes the reader asked for.
+    int64_t num_local_disk_io_total = 0;
+    int64_t bytes_read_from_local_disk = 0;
+    int64_t num_remote_storage_io_total = 0;
+    int64_t bytes_read_from_remote_storage = 0;
 };
 
 struct IOContext {
@@ -79,5 +88,19 @@ struct IOContext {
     bool is_dryrun = false;
 };
 
+inline void update_local_disk_io(const IOContext* io_ctx, size_t bytes_read) {
+    if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr && !io_ctx->is_dryrun) {
+        io_ctx->file_cache_stats->num_local_disk_io_total++;
+        io_ctx->file_cache_stats->bytes_read_from_local_disk += bytes_read;
+    }
+}
+
+inline void update_remote_storage_io(const IOContext* io_ctx, size_t bytes_read) {
+    if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr && !io_ctx->is_dryrun) {
+        io_ctx->file_cache_stats->num_remote_storage_io_total++;
+        io_ctx->file_cache_stats->bytes_read_from_remote_storage += bytes_read;
+    }
+}
+
 } // namespace io
 } // namespace doris
@@ -510,8 +510,9 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
         DCHECK_EQ(segments.size(), num_segments);
 
         for (auto id : picked_segments) {
-            Status s = segments[id]->lookup_row_key(encoded_key, schema, with_seq_col, with_rowid,
-                                                    &loc, stats, encoded_seq_value);
+            Status s = segments[id]->lookup_row_key(
+                    encoded_key, schema, with_seq_col, with_rowid, &loc, stats, encoded_seq_value,
+                    segment_caches[i]->get_pk_index_iterator(id));
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -559,9 +560,21 @@ Status BaseTablet::calc_delete_bitmap(const BaseTabletSPtr& tablet, RowsetShared
     }
 
     OlapStopWatch watch;
+    bool is_partial_update = rowset_writer && rowset_writer->is_partial_update();
+    auto rows_per_task = static_cast<uint32_t>(config::calc_delete_bitmap_rows_per_task);
     for (const auto& segment : segments) {
         const auto& seg = segment;
-        if (token != nullptr) {
+        // the rows of a partial update in a segment are flushed together to a new segment, so the
+        // segment can't be split
+        if (token != nullptr && !is_partial_update && rows_per_task > 0 &&
+            seg->num_rows() > rows_per_task) {
+            for (uint32_t start = 0; start < seg->num_rows(); start += rows_per_task) {
+                uint32_t end = std::min(seg->num_rows(), start + rows_per_task);
+                RETURN_IF_ERROR(token->submit(tablet, rowset, seg, specified_rowsets, end_version,
+                                              delete_bitmap, rowset_writer, tablet_delete_bitmap,
+                                              start, end));
+            }
+        } else if (token != nullptr) {
             RETURN_IF_ERROR(token->submit(tablet, rowset, seg, specified_rowsets, end_version,
                                           delete_bitmap, rowset_writer, tablet_delete_bitmap));
         } else {
@@ -579,7 +592,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                                               const std::vector<RowsetSharedPtr>& specified_rowsets,
                                               DeleteBitmapPtr delete_bitmap, int64_t end_version,
                                               RowsetWriter* rowset_writer,
-                                              DeleteBitmapPtr tablet_delete_bitmap) {
+                                              DeleteBitmapPtr tablet_delete_bitmap,
+                                              uint32_t start_row, uint32_t end_row) {
     OlapStopWatch watch;
     auto rowset_id = rowset->rowset_id();
     Version dummy_version(end_version + 1, end_version + 1);
@@ -626,11 +640,23 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
 
     RETURN_IF_ERROR(seg->load_pk_index_and_bf(nullptr)); // We need index blocks to iterate
     const auto* pk_idx = seg->get_primary_key_index();
-    int total = pk_idx->num_rows();
-    uint32_t row_id = 0;
-    int32_t remaining = total;
+    int total = cast_set<int>(std::min<uint64_t>(pk_idx->num_rows(), end_row));
+    uint32_t row_id = start_row;
+    int32_t remaining = total - cast_set<int>(start_row);
     bool exact_match = false;
     std::string last_key;
+    if (start_row > 0 && remaining > 0) {
+        // start from the key at `start_row`
+        std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
+        RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
+        RETURN_IF_ERROR(iter->seek_to_ordinal(start_row));
+        auto index_column = vectorized::DataTypeFactory::instance()
+                                    .create_data_type(pk_idx->type_info()->type(), 1, 0)
+                                    ->create_column();
+        size_t num_read = 1;
+        RETURN_IF_ERROR(iter->next_batch(&num_read, index_column));
+        last_key = index_column->get_data_at(0).to_string();
+    }
     int batch_size = 1024;
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
@@ -1823,6 +1849,11 @@ void BaseTablet::agg_delete_bitmap_for_stale_rowsets(
             if (d->isEmpty()) {
                 continue;
             }
+            if (config::enable_delete_bitmap_run_optimize) {
+                // the folded bitmap stays for the life of the rowset
+                d->runOptimize();
+                d->shrinkToFit();
+            }
             VLOG_DEBUG << "agg delete bitmap for tablet_id=" << tablet_id()
                        << ", rowset_id=" << rowset->rowset_id() << ", seg_id=" << seg_id
                        << ", rowset_version=" << rowset->version().to_string()
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/olap_common.pb.h>
 
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -189,7 +190,9 @@ public:
                                       const std::vector<RowsetSharedPtr>& specified_rowsets,
                                       DeleteBitmapPtr delete_bitmap, int64_t end_version,
                                       RowsetWriter* rowset_writer,
-                                      DeleteBitmapPtr tablet_delete_bitmap = nullptr);
+                                      DeleteBitmapPtr tablet_delete_bitmap = nullptr,
+                                      uint32_t start_row = 0,
+                                      uint32_t end_row = std::numeric_limits<uint32_t>::max());
 
     Status calc_delete_bitmap_between_segments(
             RowsetId rowset_id, const std::vector<segment_v2::SegmentSharedPtr>& segments,
@@ -35,7 +35,8 @@ Status CalcDeleteBitmapToken::submit(BaseTabletSPtr tablet, RowsetSharedPtr cur_
                                      const std::vector<RowsetSharedPtr>& target_rowsets,
                                      int64_t end_version, DeleteBitmapPtr delete_bitmap,
                                      RowsetWriter* rowset_writer,
-                                     DeleteBitmapPtr tablet_delete_bitmap) {
+                                     DeleteBitmapPtr tablet_delete_bitmap, uint32_t start_row,
+                                     uint32_t end_row) {
     {
         std::shared_lock rlock(_lock);
         RETURN_IF_ERROR(_status);
@@ -46,11 +47,12 @@ Status CalcDeleteBitmapToken::submit(BaseTabletSPtr tablet, RowsetSharedPtr cur_
         SCOPED_ATTACH_TASK(_resource_ctx);
         auto st = tablet->calc_segment_delete_bitmap(cur_rowset, cur_segment, target_rowsets,
                                                      delete_bitmap, end_version, rowset_writer,
-                                                     tablet_delete_bitmap);
+                                                     tablet_delete_bitmap, start_row, end_row);
         if (!st.ok()) {
             LOG(WARNING) << "failed to calc segment delete bitmap, tablet_id: "
                          << tablet->tablet_id() << " rowset: " << cur_rowset->rowset_id()
-                         << " seg_id: " << cur_segment->id() << " version: " << end_version
+                         << " seg_id: " << cur_segment->id() << " start_row: " << start_row
+                         << " end_row: " << end_row << " version: " << end_version
                          << " error: " << st;
             std::lock_guard wlock(_lock);
             if (_status.ok()) {
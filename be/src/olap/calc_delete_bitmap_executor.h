@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -49,12 +50,14 @@ public:
     explicit CalcDeleteBitmapToken(std::unique_ptr<ThreadPoolToken> thread_token)
             : _thread_token(std::move(thread_token)), _status(Status::OK()) {}
 
-    // calculate delete bitmap of `cur_segment` to historical `target_rowsets`
+    // calculate delete bitmap of the rows [start_row, end_row) of `cur_segment` to historical
+    // `target_rowsets`
     Status submit(BaseTabletSPtr tablet, RowsetSharedPtr cur_rowset,
                   const segment_v2::SegmentSharedPtr& cur_segment,
                   const std::vector<RowsetSharedPtr>& target_rowsets, int64_t end_version,
                   DeleteBitmapPtr delete_bitmap, RowsetWriter* rowset_writer,
-                  DeleteBitmapPtr tablet_delete_bitmap);
+                  DeleteBitmapPtr tablet_delete_bitmap, uint32_t start_row = 0,
+                  uint32_t end_row = std::numeric_limits<uint32_t>::max());
 
     // calculate delete bitmap between `segments`
     Status submit(BaseTabletSPtr tablet, RowsetId rowset_id,
@@ -39,6 +39,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
+#include "cloud/cloud_tablet_hotspot.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
@@ -77,6 +78,7 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
 #include "util/doris_metrics.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -93,9 +95,6 @@ bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
     if (rhs->num_segments() == 0) {
         return true;
     }
-    if (rhs->is_segments_overlapping()) {
-        return false;
-    }
     // check segment size
     auto* beta_rowset = reinterpret_cast<BetaRowset*>(rhs.get());
     std::vector<size_t> segments_size;
@@ -106,18 +105,24 @@ bool is_rowset_tidy(std::string& pre_max_key, bool& pre_rs_key_bounds_truncated,
             return false;
         }
     }
-    std::string min_key;
-    auto ret = rhs->first_key(&min_key);
-    if (!ret) {
+    // The key ranges are checked segment by segment, so the segments of an overlapping rowset,
+    // e.g. the memtable flushes of a load of time ordered data, are linked too if they don't
+    // actually overlap.
+    std::vector<KeyBoundsPB> segments_key_bounds;
+    RETURN_FALSE_IF_ERROR(rhs->get_segments_key_bounds(&segments_key_bounds));
+    if (segments_key_bounds.size() != rhs->num_segments()) {
         return false;
     }
     bool cur_rs_key_bounds_truncated {rhs->is_segments_key_bounds_truncated()};
-    if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_max_key}, pre_rs_key_bounds_truncated,
-                                              Slice {min_key}, cur_rs_key_bounds_truncated)) {
-        return false;
+    for (const auto& key_bounds : segments_key_bounds) {
+        if (!Slice::lhs_is_strictly_less_than_rhs(Slice {pre_max_key}, pre_rs_key_bounds_truncated,
+                                                  Slice {key_bounds.min_key()},
+                                                  cur_rs_key_bounds_truncated)) {
+            return false;
+        }
+        pre_max_key = key_bounds.max_key();
+        pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
     }
-    CHECK(rhs->last_key(&pre_max_key));
-    pre_rs_key_bounds_truncated = cur_rs_key_bounds_truncated;
     return true;
 }
 
@@ -765,72 +770,120 @@ Status Compaction::do_inverted_index_compaction() {
               << ". tablet=" << _tablet->tablet_id() << ", source index size=" << src_segment_num
               << ", destination index size=" << dest_segment_num << ".";
 
-    Status status = Status::OK();
+    std::vector<std::pair<int64_t, const TabletIndex*>> index_metas;
     for (auto&& column_uniq_id : ctx.columns_to_do_index_compaction) {
         auto col = _cur_tablet_schema->column_by_uid(column_uniq_id);
         const auto* index_meta = _cur_tablet_schema->inverted_index(col);
         DBUG_EXECUTE_IF("Compaction::do_inverted_index_compaction_can_not_find_index_meta",
                         { index_meta = nullptr; })
         if (index_meta == nullptr) {
-            status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(
-                    fmt::format("Can not find index_meta for col {}", col.name()));
             LOG(WARNING) << "failed to do index compaction, can not find index_meta for column"
                          << ". tablet=" << _tablet->tablet_id()
                          << ", column uniq id=" << column_uniq_id;
             error_handler(-1, column_uniq_id);
-            break;
+            return Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(
+                    fmt::format("Can not find index_meta for col {}", col.name()));
         }
+        index_metas.emplace_back(column_uniq_id, index_meta);
+    }
 
+    // The indexes of the columns are merged by a pool if there are several of them, the opens of
+    // the shared index files and the error handling are serialized by `mutex`.
+    std::mutex mutex;
+    Status status = Status::OK();
+    auto compact_index = [&](int64_t column_uniq_id, const TabletIndex* index_meta) {
+        auto on_error = [&](const std::string& msg) {
+            std::lock_guard l(mutex);
+            error_handler(index_meta->index_id(), column_uniq_id);
+            status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(msg);
+        };
         std::vector<lucene::store::Directory*> dest_index_dirs(dest_segment_num);
         try {
             std::vector<std::unique_ptr<DorisCompoundReader>> src_idx_dirs(src_segment_num);
-            for (int src_segment_id = 0; src_segment_id < src_segment_num; src_segment_id++) {
-                auto res = index_file_readers[src_segment_id]->open(index_meta);
-                DBUG_EXECUTE_IF("Compaction::open_inverted_index_file_reader", {
-                    res = ResultError(Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "debug point: Compaction::open_index_file_reader error"));
-                })
-                if (!res.has_value()) {
-                    LOG(WARNING) << "failed to do index compaction, open inverted index file "
-                                    "reader failed"
-                                 << ". tablet=" << _tablet->tablet_id()
-                                 << ", column uniq id=" << column_uniq_id
-                                 << ", src_segment_id=" << src_segment_id;
-                    throw Exception(ErrorCode::INVERTED_INDEX_COMPACTION_ERROR, res.error().msg());
+            {
+                std::lock_guard l(mutex);
+                for (int src_segment_id = 0; src_segment_id < src_segment_num; src_segment_id++) {
+                    auto res = index_file_readers[src_segment_id]->open(index_meta);
+                    DBUG_EXECUTE_IF("Compaction::open_inverted_index_file_reader", {
+                        res = ResultError(Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                                "debug point: Compaction::open_index_file_reader error"));
+                    })
+                    if (!res.has_value()) {
+                        LOG(WARNING) << "failed to do index compaction, open inverted index file "
+                                        "reader failed"
+                                     << ". tablet=" << _tablet->tablet_id()
+                                     << ", column uniq id=" << column_uniq_id
+                                     << ", src_segment_id=" << src_segment_id;
+                        throw Exception(ErrorCode::INVERTED_INDEX_COMPACTION_ERROR,
+                                        res.error().msg());
+                    }
+                    src_idx_dirs[src_segment_id] = std::move(res.value());
                 }
-                src_idx_dirs[src_segment_id] = std::move(res.value());
-            }
-            for (int dest_segment_id = 0; dest_segment_id < dest_segment_num; dest_segment_id++) {
-                auto res = inverted_index_file_writers[dest_segment_id]->open(index_meta);
-                DBUG_EXECUTE_IF("Compaction::open_inverted_index_file_writer", {
-                    res = ResultError(Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "debug point: Compaction::open_inverted_index_file_writer error"));
-                })
-                if (!res.has_value()) {
-                    LOG(WARNING) << "failed to do index compaction, open inverted index file "
-                                    "writer failed"
-                                 << ". tablet=" << _tablet->tablet_id()
-                                 << ", column uniq id=" << column_uniq_id
-                                 << ", dest_segment_id=" << dest_segment_id;
-                    throw Exception(ErrorCode::INVERTED_INDEX_COMPACTION_ERROR, res.error().msg());
+                for (int dest_segment_id = 0; dest_segment_id < dest_segment_num;
+                     dest_segment_id++) {
+                    auto res = inverted_index_file_writers[dest_segment_id]->open(index_meta);
+                    DBUG_EXECUTE_IF("Compaction::open_inverted_index_file_writer", {
+                        res = ResultError(Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                                "debug point: Compaction::open_inverted_index_file_writer error"));
+                    })
+                    if (!res.has_value()) {
+                        LOG(WARNING) << "failed to do index compaction, open inverted index file "
+                                        "writer failed"
+                                     << ". tablet=" << _tablet->tablet_id()
+                                     << ", column uniq id=" << column_uniq_id
+                                     << ", dest_segment_id=" << dest_segment_id;
+                        throw Exception(ErrorCode::INVERTED_INDEX_COMPACTION_ERROR,
+                                        res.error().msg());
+                    }
+                    // Destination directories in dest_index_dirs do not need to be deconstructed,
+                    // but their lifecycle must be managed by inverted_index_file_writers.
+                    dest_index_dirs[dest_segment_id] = res.value().get();
                 }
-                // Destination directories in dest_index_dirs do not need to be deconstructed,
-                // but their lifecycle must be managed by inverted_index_file_writers.
-                dest_index_dirs[dest_segment_id] = res.value().get();
             }
-            auto st = compact_column(index_meta->index_id(), src_idx_dirs, dest_index_dirs,
-                                     index_tmp_path.native(), trans_vec, dest_segment_num_rows);
+            // each index has its own tmp dir, as the indexes may be merged at the same time
+            auto st = compact_column(
+                    index_meta->index_id(), src_idx_dirs, dest_index_dirs,
+                    fmt::format("{}_{}", index_tmp_path.native(), index_meta->index_id()),
+                    trans_vec, dest_segment_num_rows);
             if (!st.ok()) {
-                error_handler(index_meta->index_id(), column_uniq_id);
-                status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(st.msg());
+                on_error(std::string(st.msg()));
             }
         } catch (CLuceneError& e) {
-            error_handler(index_meta->index_id(), column_uniq_id);
-            status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(e.what());
+            on_error(e.what());
         } catch (const Exception& e) {
-            error_handler(index_meta->index_id(), column_uniq_id);
-            status = Status::Error<INVERTED_INDEX_COMPACTION_ERROR>(e.what());
+            on_error(e.what());
         }
+    };
+
+    std::unique_ptr<ThreadPool> index_compaction_pool;
+    int num_threads = std::min(config::inverted_index_compaction_threads,
+                               static_cast<int32_t>(index_metas.size()));
+    if (num_threads > 1) {
+        auto st = ThreadPoolBuilder("IndexCompactionThreadPool")
+                          .set_min_threads(num_threads)
+                          .set_max_threads(num_threads)
+                          .build(&index_compaction_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build index compaction pool, merge the indexes one by one"
+                         << ". tablet=" << _tablet->tablet_id() << ", st=" << st;
+            index_compaction_pool.reset();
+        }
+    }
+    for (const auto& [column_uniq_id, index_meta] : index_metas) {
+        if (index_compaction_pool != nullptr) {
+            auto st = index_compaction_pool->submit_func(
+                    [&compact_index, mem_tracker = _mem_tracker, column_uniq_id, index_meta] {
+                        SCOPED_ATTACH_TASK(mem_tracker);
+                        compact_index(column_uniq_id, index_meta);
+                    });
+            if (st.ok()) {
+                continue;
+            }
+        }
+        compact_index(column_uniq_id, index_meta);
+    }
+    if (index_compaction_pool != nullptr) {
+        index_compaction_pool->wait();
     }
 
     // check index compaction status. If status is not ok, we should return error and end this compaction round.
@@ -1483,6 +1536,12 @@ Status CloudCompactionMixin::modify_rowsets() {
     return Status::OK();
 }
 
+bool CloudCompactionMixin::_is_hot_tablet() const {
+    int64_t min_qpd = config::file_cache_keep_base_compaction_output_min_qpd;
+    return min_qpd > 0 &&
+           _engine.tablet_hotspot().qpd(_tablet->tablet_id()) >= static_cast<uint64_t>(min_qpd);
+}
+
 Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext& ctx) {
     // only do index compaction for dup_keys and unique_keys with mow enabled
     if (config::inverted_index_compaction_enable &&
@@ -1509,11 +1568,12 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.compaction_type = compaction_type();
 
     // We presume that the data involved in cumulative compaction is sufficiently 'hot'
-    // and should always be retained in the cache.
-    // TODO(gavin): Ensure that the retention of hot data is implemented with precision.
+    // and should always be retained in the cache. The output of base compaction is retained
+    // if the tablet is queried frequently according to the tablet hotspot.
     ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
-                           (config::enable_file_cache_keep_base_compaction_output &&
-                            compaction_type() == ReaderType::READER_BASE_COMPACTION);
+                           (compaction_type() == ReaderType::READER_BASE_COMPACTION &&
+                            (config::enable_file_cache_keep_base_compaction_output ||
+                             _is_hot_tablet()));
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(
@@ -220,6 +220,9 @@ protected:
 private:
     Status construct_output_rowset_writer(RowsetWriterContext& ctx) override;
 
+    // Whether the tablet is hot enough to keep the output of base compaction in the file cache
+    bool _is_hot_tablet() const;
+
     Status execute_compact_impl(int64_t permits);
 
     void build_basic_info();
@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -61,9 +62,12 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
+#include "runtime/workload_management/io_throttle.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -135,6 +139,8 @@ DataDir::DataDir(StorageEngine& engine, const std::string& path, int64_t capacit
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_state);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_score);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_num);
+    _base_compaction_io_throttle = std::make_unique<IOThrottle>();
+    _cumu_compaction_io_throttle = std::make_unique<IOThrottle>();
 }
 
 DataDir::~DataDir() {
@@ -142,6 +148,27 @@ DataDir::~DataDir() {
     delete _meta;
 }
 
+IOThrottle* DataDir::compaction_io_throttle(ReaderType reader_type) {
+    IOThrottle* throttle = nullptr;
+    int64_t bytes_per_second = -1;
+    switch (reader_type) {
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        throttle = _base_compaction_io_throttle.get();
+        bytes_per_second = config::base_compaction_io_bytes_per_second_per_disk;
+        break;
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+        throttle = _cumu_compaction_io_throttle.get();
+        bytes_per_second = config::cumu_compaction_io_bytes_per_second_per_disk;
+        break;
+    default:
+        return nullptr;
+    }
+    // the config is mutable, so the limit is refreshed for each compaction
+    throttle->set_io_bytes_per_second(bytes_per_second);
+    return bytes_per_second > 0 ? throttle : nullptr;
+}
+
 Status DataDir::init(bool init_meta) {
     bool exists = false;
     RETURN_IF_ERROR(io::global_local_filesystem()->exists(_path, &exists));
@@ -419,11 +446,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_mtx;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mtx](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard lock(tablet_ids_mtx);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -446,11 +474,49 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // Deserializing the metas and initializing the tablets dominate the startup with many
+    // tablets, so they are done by a pool while the metas are iterated. The tablets are sharded
+    // by tablet id to serial tokens, so the metas of the same tablet are loaded in order.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    std::vector<std::unique_ptr<ThreadPoolToken>> load_tablet_tokens;
+    int num_threads = config::load_tablet_meta_threads_per_data_dir;
+    if (num_threads > 1) {
+        auto st = ThreadPoolBuilder("load_tablet_meta")
+                          .set_min_threads(num_threads)
+                          .set_max_threads(num_threads)
+                          .build(&load_tablet_pool);
+        CHECK(st.ok()) << st;
+        for (int i = 0; i < num_threads; ++i) {
+            load_tablet_tokens.push_back(
+                    load_tablet_pool->new_token(ThreadPool::ExecutionMode::SERIAL));
+        }
+    }
+    auto load_tablet_func = [&load_tablet, &load_tablet_tokens](int64_t tablet_id,
+                                                                int32_t schema_hash,
+                                                                std::string_view value) -> bool {
+        if (load_tablet_tokens.empty()) {
+            load_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        auto& token = load_tablet_tokens[tablet_id % load_tablet_tokens.size()];
+        auto st = token->submit_func([&load_tablet, tablet_id, schema_hash,
+                                      meta = std::string(value)] {
+            SCOPED_INIT_THREAD_CONTEXT();
+            load_tablet(tablet_id, schema_hash, meta);
+        });
+        if (!st.ok()) {
+            load_tablet(tablet_id, schema_hash, value);
+        }
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    for (auto& token : load_tablet_tokens) {
+        token->wait();
+    }
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
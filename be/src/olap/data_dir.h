@@ -42,6 +42,7 @@ class TxnManager;
 class OlapMeta;
 class RowsetIdGenerator;
 class StorageEngine;
+class IOThrottle;
 
 const char* const kTestFilePath = ".testfile";
 
@@ -144,6 +145,11 @@ public:
     // Move tablet to trash.
     Status move_to_trash(const std::string& tablet_path);
 
+    // Return the throttle of the io of the compactions of `reader_type` on this dir, nullptr if
+    // their io is not limited. Base compactions have their own budget, so they don't slow down
+    // the cumulative compactions, which keep the version count of the loads low.
+    IOThrottle* compaction_io_throttle(ReaderType reader_type);
+
     static Status delete_tablet_parent_path_if_empty(const std::string& tablet_path);
 
 private:
@@ -201,6 +207,9 @@ private:
     IntGauge* disks_state = nullptr;
     IntGauge* disks_compaction_score = nullptr;
     IntGauge* disks_compaction_num = nullptr;
+
+    std::unique_ptr<IOThrottle> _base_compaction_io_throttle;
+    std::unique_ptr<IOThrottle> _cumu_compaction_io_throttle;
 };
 
 } // namespace doris
@@ -17,6 +17,8 @@
 
 #include "olap/hll.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <map>
 #include <ostream>
@@ -30,6 +32,22 @@ using std::stringstream;
 
 namespace doris {
 
+namespace {
+
+// 2^-v of all the register values, they are exactly the values of powf(2, -v), so the harmonic
+// mean is the same as computing powf for each register.
+constexpr auto HLL_INVERSE_POWERS = [] {
+    std::array<float, 256> powers {};
+    float power = 1.0F;
+    for (auto& p : powers) {
+        p = power;
+        power *= 0.5F;
+    }
+    return powers;
+}();
+
+} // namespace
+
 HyperLogLog::HyperLogLog(const Slice& src) {
     // When deserialize return false, we make this object a empty
     if (!deserialize(src)) {
@@ -74,6 +92,16 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t num) {
+    size_t i = 0;
+    for (; i < num && _type != HLL_DATA_SPARSE && _type != HLL_DATA_FULL; ++i) {
+        update(hash_values[i]);
+    }
+    for (; i < num; ++i) {
+        _update_registers(hash_values[i]);
+    }
+}
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -334,16 +362,14 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213F / (1 + 1.079F / num_streams);
     }
 
+    // Keep the order of the sum of floats, so the estimate is the same as before. The zero
+    // registers are counted by another loop, which is vectorized.
     float harmonic_mean = 0;
-    int num_zero_registers = 0;
-
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0F, -_registers[i]);
-
-        if (_registers[i] == 0) {
-            ++num_zero_registers;
-        }
+        harmonic_mean += HLL_INVERSE_POWERS[_registers[i]];
     }
+    auto num_zero_registers =
+            static_cast<int>(std::count(_registers, _registers + HLL_REGISTERS_COUNT, 0));
 
     harmonic_mean = 1.0F / harmonic_mean;
     double estimate = alpha * num_streams * num_streams * harmonic_mean;
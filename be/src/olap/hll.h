@@ -23,10 +23,7 @@
 #include <string>
 #include <utility>
 
-#ifdef __x86_64__
-#include <immintrin.h>
-#endif
-
+#include "util/sse_util.hpp"
 #include "vec/common/hash_table/phmap_fwd_decl.h"
 
 namespace doris {
@@ -205,6 +202,10 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Add `num` hash values, the same as updating them one by one, but the registers are updated
+    // in a tight loop once the explicit values are converted.
+    void update_batch(const uint64_t* hash_values, size_t num);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
@@ -287,6 +288,12 @@ private:
             src += 32;
             dst += 32;
         }
+#elif defined(__SSE2__) || defined(__aarch64__)
+        for (int i = 0; i < HLL_REGISTERS_COUNT; i += 16) {
+            __m128i xa = _mm_loadu_si128((const __m128i*)(_registers + i));
+            __m128i xb = _mm_loadu_si128((const __m128i*)(other_registers + i));
+            _mm_storeu_si128((__m128i*)(_registers + i), _mm_max_epu8(xa, xb));
+        }
 #else
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
             _registers[i] =
@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <mutex>
 #include <new>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 
@@ -29,6 +30,8 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_miss_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_stampede_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
 
+static LockContentionSite g_lru_cache_shard_lock_site("lru_cache_shard");
+
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
     // Similar to murmur hash
     const uint32_t m = 0xc6a4a793;
@@ -164,12 +167,15 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
-LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
+LRUCache::LRUCache(LRUCacheType type, bool is_lru_k)
+        : _type(type), _mutex(&g_lru_cache_shard_lock_site), _is_lru_k(is_lru_k) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
     _lru_normal.prev = &_lru_normal;
     _lru_durable.next = &_lru_durable;
     _lru_durable.prev = &_lru_durable;
+    _lru_protected.next = &_lru_protected;
+    _lru_protected.prev = &_lru_protected;
 }
 
 LRUCache::~LRUCache() {
@@ -200,24 +206,31 @@ PrunedInfo LRUCache::set_capacity(size_t capacity) {
     return {pruned_count, pruned_size};
 }
 
-uint64_t LRUCache::get_lookup_count() {
+void LRUCache::set_protected_percentage(uint32_t protected_percentage) {
     std::lock_guard l(_mutex);
-    return _lookup_count;
+    _protected_percentage = std::min(protected_percentage, 100U);
 }
 
-uint64_t LRUCache::get_hit_count() {
+void LRUCache::set_clock_lookup(bool clock_lookup) {
     std::lock_guard l(_mutex);
-    return _hit_count;
+    DCHECK_EQ(_table.element_count(), 0);
+    _clock_lookup = clock_lookup && !_cache_value_check_timestamp;
+}
+
+uint64_t LRUCache::get_lookup_count() {
+    return _lookup_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LRUCache::get_hit_count() {
+    return _hit_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_stampede_count() {
-    std::lock_guard l(_mutex);
-    return _stampede_count;
+    return _stampede_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_miss_count() {
-    std::lock_guard l(_mutex);
-    return _miss_count;
+    return _miss_count.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_usage() {
@@ -236,9 +249,9 @@ size_t LRUCache::get_element_count() {
 }
 
 bool LRUCache::_unref(LRUHandle* e) {
-    DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    uint32_t refs = std::atomic_ref(e->refs).fetch_sub(1, std::memory_order_acq_rel);
+    DCHECK(refs > 0);
+    return refs == 1;
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
@@ -290,6 +303,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 }
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
+    if (_clock_lookup) {
+        return _lookup_shared(key, hash);
+    }
     std::lock_guard l(_mutex);
     ++_lookup_count;
     LRUHandle* e = _table.lookup(key, hash);
@@ -303,6 +319,10 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
         e->refs++;
         ++_hit_count;
         e->last_visit_time = UnixMillis();
+        if (_protected_percentage > 0 && e->priority == CachePriority::NORMAL &&
+            !e->is_protected) {
+            _protect(e);
+        }
     } else {
         ++_miss_count;
     }
@@ -320,11 +340,51 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
+Cache::Handle* LRUCache::_lookup_shared(const CacheKey& key, uint32_t hash) {
+    ++_lookup_count;
+    LRUHandle* e = nullptr;
+    {
+        // the lookups only change the entries found by atomic operations, so they share the lock,
+        // and an entry could only be removed from _table with the lock held exclusively
+        std::shared_lock l(_mutex);
+        e = _table.lookup(key, hash);
+        if (e != nullptr) {
+            DCHECK(e->in_cache);
+            std::atomic_ref(e->refs).fetch_add(1, std::memory_order_relaxed);
+            std::atomic_ref(e->visited).store(true, std::memory_order_relaxed);
+            std::atomic_ref(e->last_visit_time).store(UnixMillis(), std::memory_order_relaxed);
+        }
+    }
+    if (e != nullptr) {
+        ++_hit_count;
+        return reinterpret_cast<Cache::Handle*>(e);
+    }
+
+    ++_miss_count;
+    if (_is_lru_k) {
+        std::lock_guard l(_mutex);
+        auto it = _visits_lru_cache_map.find(hash);
+        if (it != _visits_lru_cache_map.end()) {
+            _visits_lru_cache_list.splice(_visits_lru_cache_list.begin(), _visits_lru_cache_list,
+                                          it->second);
+        }
+    }
+    return nullptr;
+}
+
 void LRUCache::release(Cache::Handle* handle) {
     if (handle == nullptr) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_clock_lookup) {
+        // the entry is kept in the lru list while it is in the cache, so there is nothing to do
+        // but free it when it is removed from the cache and this is the last ref
+        if (_unref(e)) {
+            e->free();
+        }
+        return;
+    }
     bool last_ref = false;
     {
         std::lock_guard l(_mutex);
@@ -338,6 +398,7 @@ void LRUCache::release(Cache::Handle* handle) {
                 bool removed = _table.remove(e);
                 DCHECK(removed);
                 e->in_cache = false;
+                _unprotect(e);
                 _unref(e);
                 // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
                 // see the comment for old entry in `LRUCache::insert`.
@@ -346,7 +407,7 @@ void LRUCache::release(Cache::Handle* handle) {
             } else {
                 // put it to LRU free list
                 if (e->priority == CachePriority::NORMAL) {
-                    _lru_append(&_lru_normal, e);
+                    _lru_append(e->is_protected ? &_lru_protected : &_lru_normal, e);
                 } else if (e->priority == CachePriority::DURABLE) {
                     _lru_append(&_lru_durable, e);
                 }
@@ -388,22 +449,42 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
 
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
     // 1. evict normal cache entries
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_normal.next != &_lru_normal) {
-        LRUHandle* old = _lru_normal.next;
-        DCHECK(old->priority == CachePriority::NORMAL);
-        _evict_one_entry(old);
-        old->next = *to_remove_head;
-        *to_remove_head = old;
-    }
-    // 2. evict durable cache entries if need
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_durable.next != &_lru_durable) {
-        LRUHandle* old = _lru_durable.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        old->next = *to_remove_head;
-        *to_remove_head = old;
+    _evict_from_list(&_lru_normal, total_size, to_remove_head);
+    // 2. evict protected normal cache entries if need
+    _evict_from_list(&_lru_protected, total_size, to_remove_head);
+    // 3. evict durable cache entries if need
+    _evict_from_list(&_lru_durable, total_size, to_remove_head);
+}
+
+void LRUCache::_evict_from_list(LRUHandle* list, size_t total_size, LRUHandle** to_remove_head) {
+    LRUHandle* p = list->next;
+    while ((_usage + total_size > _capacity || _check_element_count_limit()) && p != list) {
+        LRUHandle* next = p->next;
+        if (_clock_lookup) {
+            // the lookups are excluded, but the refs may still be released concurrently
+            if (std::atomic_ref(p->refs).load(std::memory_order_acquire) > 1) {
+                p = next;
+                continue;
+            }
+            if (p->visited) {
+                // the second chance, the visited bits are not set again until the lock is
+                // released, so each entry is moved at most once
+                p->visited = false;
+                _lru_remove(p);
+                if (list == &_lru_normal && _protected_percentage > 0) {
+                    _protect(p);
+                    _lru_append(&_lru_protected, p);
+                } else {
+                    _lru_append(list, p);
+                }
+                p = next;
+                continue;
+            }
+        }
+        _evict_one_entry(p);
+        p->next = *to_remove_head;
+        *to_remove_head = p;
+        p = next;
     }
 }
 
@@ -414,12 +495,33 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
     bool removed = _table.remove(e);
     DCHECK(removed);
     e->in_cache = false;
+    _unprotect(e);
     _unref(e);
     // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
     // see the comment for old entry in `LRUCache::insert`.
     _usage -= e->total_size;
 }
 
+void LRUCache::_protect(LRUHandle* e) {
+    e->is_protected = true;
+    _protected_usage += e->total_size;
+    // move the oldest protected entries which are not in use back to the normal list
+    const size_t protected_capacity = _capacity * _protected_percentage / 100;
+    while (_protected_usage > protected_capacity && _lru_protected.next != &_lru_protected) {
+        LRUHandle* old = _lru_protected.next;
+        _lru_remove(old);
+        _unprotect(old);
+        _lru_append(&_lru_normal, old);
+    }
+}
+
+void LRUCache::_unprotect(LRUHandle* e) {
+    if (e->is_protected) {
+        e->is_protected = false;
+        _protected_usage -= e->total_size;
+    }
+}
+
 bool LRUCache::_check_element_count_limit() {
     return _element_count_capacity != 0 && _table.element_count() >= _element_count_capacity;
 }
@@ -474,6 +576,8 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 1; // only one for the returned handle.
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->is_protected = false;
+    e->visited = false;
     e->priority = priority;
     e->type = _type;
     memcpy(e->key_data, key.data(), key.size());
@@ -502,9 +606,18 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         e->in_cache = true;
         _usage += e->total_size;
         e->refs++; // one for the returned handle, one for LRUCache.
+        if (_clock_lookup) {
+            _lru_append(e->priority == CachePriority::DURABLE ? &_lru_durable : &_lru_normal, e);
+        }
         if (old != nullptr) {
             _stampede_count++;
+            // old is on LRU if it's only referenced by the cache, or always in the CLOCK lookup,
+            // remove it before the ref of the cache is released, which may free it concurrently
+            if (_clock_lookup || old->refs == 1) {
+                _lru_remove(old);
+            }
             old->in_cache = false;
+            _unprotect(old);
             // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
             // Whether the reference of the old entry is 0, the cache usage is subtracted here,
             // because the old entry has been removed from the cache and should not be counted in the cache capacity,
@@ -514,9 +627,6 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             _usage -= old->total_size;
             // if false, old entry is being used externally, just ref-- and sub _usage,
             if (_unref(old)) {
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
                 old->next = to_remove_head;
                 to_remove_head = old;
             }
@@ -541,16 +651,17 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
-            last_ref = _unref(e);
-            // if last_ref is false or in_cache is false, e must not be in lru
-            if (last_ref && e->in_cache) {
-                // locate in free list
+            // e is in lru if it's only referenced by the cache, or always in the CLOCK lookup,
+            // remove it before the ref of the cache is released, which may free it concurrently
+            if (_clock_lookup || e->refs == 1) {
                 _lru_remove(e);
             }
             e->in_cache = false;
+            _unprotect(e);
             // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
             // see the comment for old entry in `LRUCache::insert`.
             _usage -= e->total_size;
+            last_ref = _unref(e);
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -560,21 +671,16 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
 }
 
 PrunedInfo LRUCache::prune() {
+    return prune_if([](const LRUHandle*) { return true; });
+}
+
+PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
+        _prune_list(&_lru_normal, pred, lazy_mode, &to_remove_head);
+        _prune_list(&_lru_protected, pred, lazy_mode, &to_remove_head);
+        _prune_list(&_lru_durable, pred, lazy_mode, &to_remove_head);
     }
     int64_t pruned_count = 0;
     int64_t pruned_size = 0;
@@ -588,46 +694,22 @@ PrunedInfo LRUCache::prune() {
     return {pruned_count, pruned_size};
 }
 
-PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
-    LRUHandle* to_remove_head = nullptr;
-    {
-        std::lock_guard l(_mutex);
-        LRUHandle* p = _lru_normal.next;
-        while (p != &_lru_normal) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
-            }
-            p = next;
-        }
-
-        p = _lru_durable.next;
-        while (p != &_lru_durable) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
-            }
-            p = next;
+void LRUCache::_prune_list(LRUHandle* list, const CachePrunePredicate& pred, bool lazy_mode,
+                           LRUHandle** to_remove_head) {
+    LRUHandle* p = list->next;
+    while (p != list) {
+        LRUHandle* next = p->next;
+        if (_clock_lookup && std::atomic_ref(p->refs).load(std::memory_order_acquire) > 1) {
+            // in use, only the CLOCK lookup keeps it in the lru list
+        } else if (pred(p)) {
+            _evict_one_entry(p);
+            p->next = *to_remove_head;
+            *to_remove_head = p;
+        } else if (lazy_mode) {
+            break;
         }
+        p = next;
     }
-    int64_t pruned_count = 0;
-    int64_t pruned_size = 0;
-    while (to_remove_head != nullptr) {
-        ++pruned_count;
-        pruned_size += to_remove_head->total_size;
-        LRUHandle* next = to_remove_head->next;
-        to_remove_head->free();
-        to_remove_head = next;
-    }
-    return {pruned_count, pruned_size};
 }
 
 void LRUCache::set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor) {
@@ -635,6 +717,7 @@ void LRUCache::set_cache_value_time_extractor(CacheValueTimeExtractor cache_valu
 }
 
 void LRUCache::set_cache_value_check_timestamp(bool cache_value_check_timestamp) {
+    DCHECK(!_clock_lookup || !cache_value_check_timestamp);
     _cache_value_check_timestamp = cache_value_check_timestamp;
 }
 
@@ -723,6 +806,18 @@ PrunedInfo ShardedLRUCache::set_capacity(size_t capacity) {
     return pruned_info;
 }
 
+void ShardedLRUCache::set_protected_percentage(uint32_t protected_percentage) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_protected_percentage(protected_percentage);
+    }
+}
+
+void ShardedLRUCache::set_clock_lookup(bool clock_lookup) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_clock_lookup(clock_lookup);
+    }
+}
+
 size_t ShardedLRUCache::get_capacity() {
     std::lock_guard l(_mutex);
     return _capacity;
@@ -793,6 +888,22 @@ size_t ShardedLRUCache::get_element_count() {
     return total_element_count;
 }
 
+uint64_t ShardedLRUCache::get_lookup_count() {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
 void ShardedLRUCache::update_cache_metrics() const {
     size_t capacity = 0;
     size_t total_usage = 0;
@@ -838,6 +949,8 @@ Cache::Handle* DummyLRUCache::insert(const CacheKey& key, void* value, size_t ch
     e->refs = 1; // only one for the returned handle
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->is_protected = false;
+    e->visited = false;
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
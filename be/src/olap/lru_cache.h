@@ -17,11 +17,13 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
+#include "util/lock_contention.h"
 #include "util/metrics.h"
 
 namespace doris {
@@ -214,6 +216,17 @@ public:
 
     virtual size_t get_element_count() = 0;
 
+    virtual uint64_t get_lookup_count() { return 0; }
+    virtual uint64_t get_hit_count() { return 0; }
+
+    // Keep `protected_percentage` of the capacity for the entries hit again after they are
+    // inserted, see LRUCache. Default implementation does nothing.
+    virtual void set_protected_percentage(uint32_t protected_percentage) {}
+
+    // Let the hits only take the lock shared and mark the entries visited, see LRUCache.
+    // REQUIRES: the cache is empty. Default implementation does nothing.
+    virtual void set_clock_lookup(bool clock_lookup) {}
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Cache);
 };
@@ -230,8 +243,10 @@ struct LRUHandle {
     size_t charge;
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
-    bool in_cache; // Whether entry is in the cache.
-    uint32_t refs;
+    bool in_cache;     // Whether entry is in the cache.
+    bool is_protected; // Whether entry is in the protected segment, see LRUCache.
+    bool visited;      // Whether entry is hit since it was last checked by the eviction.
+    uint32_t refs;     // Changed atomically, the release of the clock lookup takes no lock.
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
     LRUCacheType type;
@@ -323,6 +338,8 @@ public:
     void set_element_count_capacity(uint32_t element_count_capacity) {
         _element_count_capacity = element_count_capacity;
     }
+    void set_protected_percentage(uint32_t protected_percentage);
+    void set_clock_lookup(bool clock_lookup);
 
     // Like Cache methods, but with an extra "hash" parameter.
     // Must call release on the returned handle pointer.
@@ -351,10 +368,16 @@ private:
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t total_size, LRUHandle** to_remove_head);
+    void _evict_from_list(LRUHandle* list, size_t total_size, LRUHandle** to_remove_head);
+    void _prune_list(LRUHandle* list, const CachePrunePredicate& pred, bool lazy_mode,
+                     LRUHandle** to_remove_head);
+    Cache::Handle* _lookup_shared(const CacheKey& key, uint32_t hash);
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    void _protect(LRUHandle* e);
+    void _unprotect(LRUHandle* e);
 
 private:
     LRUCacheType _type;
@@ -362,23 +385,40 @@ private:
     // Initialized before use.
     size_t _capacity = 0;
 
+    // CLOCK lookup: a hit takes _mutex shared, only increases the refs and sets the visited bit
+    // without reordering the lists, and the release takes no lock. So the entries in use are kept
+    // in the lists too, the eviction skips them, and gives the visited ones a second chance by
+    // moving them to the newest end (or to the protected segment) with the bit cleared.
+    // An idle entry over the capacity is evicted by the next insert instead of its release.
+    // Not used together with _cache_value_check_timestamp.
+    bool _clock_lookup = false;
+
     // _mutex protects the following state.
-    std::mutex _mutex;
+    ProfiledSharedMutex _mutex;
     size_t _usage = 0;
 
     // Dummy head of LRU list.
-    // Entries have refs==1 and in_cache==true.
+    // Entries have refs==1 and in_cache==true, or any refs in the CLOCK lookup.
     // _lru_normal.prev is newest entry, _lru_normal.next is oldest entry.
     LRUHandle _lru_normal;
     // _lru_durable.prev is newest entry, _lru_durable.next is oldest entry.
     LRUHandle _lru_durable;
 
+    // Segmented LRU: a normal entry hit again after it is inserted is moved to the protected
+    // segment, which is evicted after _lru_normal. When the protected segment exceeds
+    // _protected_percentage of the capacity, its oldest entries are moved back to _lru_normal.
+    // So the entries only visited once by a large scan do not evict the hot entries.
+    uint32_t _protected_percentage = 0;
+    size_t _protected_usage = 0;
+    // _lru_protected.prev is newest entry, _lru_protected.next is oldest entry.
+    LRUHandle _lru_protected;
+
     HandleTable _table;
 
-    uint64_t _lookup_count = 0; // number of cache lookups
-    uint64_t _hit_count = 0;    // number of cache hits
-    uint64_t _miss_count = 0;   // number of cache misses
-    uint64_t _stampede_count = 0;
+    std::atomic<uint64_t> _lookup_count = 0; // number of cache lookups
+    std::atomic<uint64_t> _hit_count = 0;    // number of cache hits
+    std::atomic<uint64_t> _miss_count = 0;   // number of cache misses
+    std::atomic<uint64_t> _stampede_count = 0;
 
     CacheValueTimeExtractor _cache_value_time_extractor;
     bool _cache_value_check_timestamp = false;
@@ -410,6 +450,11 @@ public:
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
     size_t get_capacity() override;
+    uint64_t get_lookup_count() override;
+    uint64_t get_hit_count() override;
+
+    void set_protected_percentage(uint32_t protected_percentage) override;
+    void set_clock_lookup(bool clock_lookup) override;
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
@@ -22,7 +22,9 @@
 #include <pdqsort.h>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,7 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/core/sort_block.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -304,25 +307,29 @@ size_t MemTable::_sort() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
     size_t same_keys_num = 0;
-    // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
-        auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
-            return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
-        };
-        _sort_one_column(*_row_in_blocks, tie, cmp);
-    }
     bool is_dup = (_keys_type == KeysType::DUP_KEYS);
-    // sort extra round by _row_pos to make the sort stable
-    auto iter = tie.iter();
-    while (iter.next()) {
-        pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
-                std::next(_row_in_blocks->begin(), iter.right()),
-                [&is_dup](const std::shared_ptr<RowInBlock>& lhs,
-                          const std::shared_ptr<RowInBlock>& rhs) -> bool {
-                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
-                });
-        same_keys_num += iter.right() - iter.left();
+    // sort new rows
+    if (!config::enable_sort_normalized_key || !_sort_by_normalized_keys(&same_keys_num)) {
+        Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
+        for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+            auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
+                return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i,
+                                                               -1);
+            };
+            _sort_one_column(*_row_in_blocks, tie, cmp);
+        }
+        // sort extra round by _row_pos to make the sort stable
+        auto iter = tie.iter();
+        while (iter.next()) {
+            pdqsort(std::next(_row_in_blocks->begin(), iter.left()),
+                    std::next(_row_in_blocks->begin(), iter.right()),
+                    [&is_dup](const std::shared_ptr<RowInBlock>& lhs,
+                              const std::shared_ptr<RowInBlock>& rhs) -> bool {
+                        return is_dup ? lhs->_row_pos > rhs->_row_pos
+                                      : lhs->_row_pos < rhs->_row_pos;
+                    });
+            same_keys_num += iter.right() - iter.left();
+        }
     }
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
@@ -342,6 +349,79 @@ size_t MemTable::_sort() {
     return same_keys_num;
 }
 
+// Sorts the new rows by the normalized keys of the key columns, which are radix sorted instead of
+// compared column by column, returns false if some key column can not be normalized.
+bool MemTable::_sort_by_normalized_keys(size_t* same_keys_num) {
+    size_t num_key_columns = _tablet_schema->num_key_columns();
+    size_t key_width = 0;
+    for (size_t i = 0; i < num_key_columns; i++) {
+        size_t width =
+                vectorized::normalized_key_width(*_input_mutable_block.get_column_by_position(i));
+        if (width == 0) {
+            return false;
+        }
+        key_width += width;
+    }
+    if (key_width > vectorized::NORMALIZED_KEY_MAX_WIDTH) {
+        return false;
+    }
+
+    size_t begin = _last_sorted_pos;
+    size_t rows = _row_in_blocks->size() - begin;
+    std::vector<size_t> row_ids(rows);
+    for (size_t i = 0; i < rows; i++) {
+        row_ids[i] = (*_row_in_blocks)[begin + i]->_row_pos;
+    }
+    // the row position is appended to the key to make the sort stable, descending for the
+    // duplicate keys so the rows of a key are in the same order as the column sort
+    size_t full_width = key_width + sizeof(uint64_t);
+    vectorized::PaddedPODArray<uint8_t> keys(rows * full_width);
+    // NULLs first, as compare_one_column(..., -1)
+    vectorized::SortColumnDescription desc(0, 1, -1);
+    size_t offset = 0;
+    for (size_t i = 0; i < num_key_columns; i++) {
+        const auto& column = *_input_mutable_block.get_column_by_position(i);
+        vectorized::encode_normalized_key(column, desc, row_ids.data(), rows, keys.data(),
+                                          full_width, offset);
+        offset += vectorized::normalized_key_width(column);
+    }
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    for (size_t i = 0; i < rows; i++) {
+        uint64_t pos = is_dup ? ~static_cast<uint64_t>(row_ids[i]) : row_ids[i];
+        uint8_t* key = keys.data() + i * full_width + key_width;
+        for (size_t b = 0; b < sizeof(uint64_t); b++) {
+            key[b] = static_cast<uint8_t>(pos >> ((sizeof(uint64_t) - 1 - b) * 8));
+        }
+    }
+    vectorized::IColumn::Permutation perm(rows);
+    vectorized::IColumn::Permutation tmp(rows);
+    std::iota(perm.begin(), perm.end(), size_t(0));
+    vectorized::radix_sort_normalized_keys(perm.data(), tmp.data(), rows, keys.data(), full_width,
+                                           0);
+
+    // count the rows whose key equals another one's, as the ties of the column sort
+    size_t same_keys = 1;
+    for (size_t i = 1; i <= rows; i++) {
+        if (i < rows && memcmp(keys.data() + perm[i - 1] * full_width,
+                               keys.data() + perm[i] * full_width, key_width) == 0) {
+            same_keys++;
+            continue;
+        }
+        if (same_keys > 1) {
+            *same_keys_num += same_keys;
+        }
+        same_keys = 1;
+    }
+    DorisVector<std::shared_ptr<RowInBlock>> sorted_rows;
+    sorted_rows.reserve(rows);
+    for (size_t i = 0; i < rows; i++) {
+        sorted_rows.emplace_back(std::move((*_row_in_blocks)[begin + perm[i]]));
+    }
+    std::move(sorted_rows.begin(), sorted_rows.end(),
+              std::next(_row_in_blocks->begin(), static_cast<ptrdiff_t>(begin)));
+    return true;
+}
+
 Status MemTable::_sort_by_cluster_keys() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
@@ -600,9 +680,8 @@ void MemTable::shrink_memtable_by_agg() {
     }
 }
 
-bool MemTable::need_flush() const {
+bool MemTable::need_flush(int64_t max_size) const {
     DBUG_EXECUTE_IF("MemTable.need_flush", { return true; });
-    auto max_size = config::write_buffer_size;
     if (_partial_update_mode == UniqueKeyUpdateModePB::UPDATE_FIXED_COLUMNS) {
         auto update_columns_size = _num_columns;
         max_size = max_size * update_columns_size / _tablet_schema->num_columns();
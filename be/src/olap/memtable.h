@@ -177,6 +177,7 @@ public:
     ~MemTable();
 
     int64_t tablet_id() const { return _tablet_id; }
+    KeysType keys_type() const { return _keys_type; }
     size_t memory_usage() const { return _mem_tracker->consumption(); }
     size_t get_flush_reserve_memory_size() const;
     // insert tuple from (row_pos) to (row_pos+num_rows)
@@ -184,7 +185,7 @@ public:
 
     void shrink_memtable_by_agg();
 
-    bool need_flush() const;
+    bool need_flush(int64_t max_size) const;
 
     bool need_agg() const;
 
@@ -248,6 +249,7 @@ private:
 
     //return number of same keys
     size_t _sort();
+    bool _sort_by_normalized_keys(size_t* same_keys_num);
     Status _sort_by_cluster_keys();
     void _sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
                           std::function<int(RowInBlock*, RowInBlock*)> cmp);
@@ -17,6 +17,7 @@
 
 #include "olap/memtable_flush_executor.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/olap_file.pb.h>
 
 #include <algorithm>
@@ -41,16 +42,18 @@ namespace doris {
 using namespace ErrorCode;
 
 bvar::Adder<int64_t> g_flush_task_num("memtable_flush_task_num");
+bvar::LatencyRecorder g_flush_segment_disk_size("memtable_flush_segment_disk_size");
 
 class MemtableFlushTask final : public Runnable {
     ENABLE_FACTORY_CREATOR(MemtableFlushTask);
 
 public:
     MemtableFlushTask(std::shared_ptr<FlushToken> flush_token, std::shared_ptr<MemTable> memtable,
-                      int32_t segment_id, int64_t submit_task_time)
+                      int32_t segment_id, int32_t num_segments, int64_t submit_task_time)
             : _flush_token(flush_token),
               _memtable(memtable),
               _segment_id(segment_id),
+              _num_segments(num_segments),
               _submit_task_time(submit_task_time) {
         g_flush_task_num << 1;
     }
@@ -60,7 +63,7 @@ public:
     void run() override {
         auto token = _flush_token.lock();
         if (token) {
-            token->_flush_memtable(_memtable, _segment_id, _submit_task_time);
+            token->_flush_memtable(_memtable, _segment_id, _num_segments, _submit_task_time);
         } else {
             LOG(WARNING) << "flush token is deconstructed, ignore the flush task";
         }
@@ -70,9 +73,43 @@ private:
     std::weak_ptr<FlushToken> _flush_token;
     std::shared_ptr<MemTable> _memtable;
     int32_t _segment_id;
+    int32_t _num_segments;
     int64_t _submit_task_time;
 };
 
+// Writes one part of a memtable split by FlushToken::_flush_block_in_segments().
+class MemtableBlockFlushTask final : public Runnable {
+    ENABLE_FACTORY_CREATOR(MemtableBlockFlushTask);
+
+public:
+    MemtableBlockFlushTask(std::shared_ptr<FlushToken> flush_token,
+                           std::shared_ptr<MemTable> memtable,
+                           std::unique_ptr<vectorized::Block> block, int32_t segment_id)
+            : _flush_token(flush_token),
+              _memtable(std::move(memtable)),
+              _block(std::move(block)),
+              _segment_id(segment_id) {
+        g_flush_task_num << 1;
+    }
+
+    ~MemtableBlockFlushTask() override { g_flush_task_num << -1; }
+
+    void run() override {
+        auto token = _flush_token.lock();
+        if (token) {
+            token->_flush_block(std::move(_memtable), std::move(_block), _segment_id);
+        } else {
+            LOG(WARNING) << "flush token is deconstructed, ignore the flush task";
+        }
+    }
+
+private:
+    std::weak_ptr<FlushToken> _flush_token;
+    std::shared_ptr<MemTable> _memtable;
+    std::unique_ptr<vectorized::Block> _block;
+    int32_t _segment_id;
+};
+
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     os << "(flush time(ms)=" << stat.flush_time_ns / NANOS_PER_MILLIS
        << ", flush wait time(ms)=" << stat.flush_wait_time_ns / NANOS_PER_MILLIS
@@ -98,8 +135,32 @@ Status FlushToken::submit(std::shared_ptr<MemTable> mem_table) {
         return Status::OK();
     }
     int64_t submit_task_time = MonotonicNanos();
-    auto task = MemtableFlushTask::create_shared(
-            shared_from_this(), mem_table, _rowset_writer->allocate_segment_id(), submit_task_time);
+    // The rows of a duplicate key table are not aggregated, so the number of the segments is known
+    // before the memtable is sorted. Their ids are allocated here to keep the order of the segments
+    // of the memtables.
+    int32_t num_segments = 1;
+    int64_t split_rows = config::memtable_flush_split_rows;
+    if (split_rows > 0 && mem_table->keys_type() == KeysType::DUP_KEYS &&
+        static_cast<int64_t>(mem_table->stat().raw_rows) > split_rows) {
+        num_segments = static_cast<int32_t>(
+                (static_cast<int64_t>(mem_table->stat().raw_rows) + split_rows - 1) / split_rows);
+    }
+    int32_t segment_id = _rowset_writer->allocate_segment_id();
+    for (int32_t i = 1; i < num_segments; i++) {
+        int32_t next_segment_id = _rowset_writer->allocate_segment_id();
+        DCHECK_EQ(segment_id + i, next_segment_id);
+    }
+    auto task = MemtableFlushTask::create_shared(shared_from_this(), mem_table, segment_id,
+                                                 num_segments, submit_task_time);
+    Status ret = _submit(std::move(task));
+    if (ret.ok()) {
+        // _wait_running_task_finish was executed after this function, so no need to notify _cond here
+        _stats.flush_running_count++;
+    }
+    return ret;
+}
+
+Status FlushToken::_submit(std::shared_ptr<Runnable> task) {
     // NOTE: we should guarantee WorkloadGroup is not deconstructed when submit memtable flush task.
     // because currently WorkloadGroup's can only be destroyed when all queries in the group is finished,
     // but not consider whether load channel is finish.
@@ -108,13 +169,8 @@ Status FlushToken::submit(std::shared_ptr<MemTable> mem_table) {
     if (wg_sptr) {
         wg_thread_pool = wg_sptr->get_memtable_flush_pool();
     }
-    Status ret = wg_thread_pool ? wg_thread_pool->submit(std::move(task))
-                                : _thread_pool->submit(std::move(task));
-    if (ret.ok()) {
-        // _wait_running_task_finish was executed after this function, so no need to notify _cond here
-        _stats.flush_running_count++;
-    }
-    return ret;
+    return wg_thread_pool ? wg_thread_pool->submit(std::move(task))
+                          : _thread_pool->submit(std::move(task));
 }
 
 // NOTE: FlushToken's submit/cancel/wait run in one thread,
@@ -175,7 +231,9 @@ Status FlushToken::_try_reserve_memory(const std::shared_ptr<ResourceContext>& r
     return st;
 }
 
-Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size) {
+Status FlushToken::_do_flush_memtable(const std::shared_ptr<MemTable>& memtable,
+                                      int32_t segment_id, int32_t num_segments,
+                                      int64_t* flush_size) {
     VLOG_CRITICAL << "begin to flush memtable for tablet: " << memtable->tablet_id()
                   << ", memsize: " << PrettyPrinter::print_bytes(memtable->memory_usage())
                   << ", rows: " << memtable->stat().raw_rows;
@@ -201,7 +259,12 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
         }};
         std::unique_ptr<vectorized::Block> block;
         RETURN_IF_ERROR(memtable->to_block(&block));
-        RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        if (num_segments > 1) {
+            RETURN_IF_ERROR(_flush_block_in_segments(memtable, block.get(), segment_id,
+                                                     num_segments, flush_size));
+        } else {
+            RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        }
         memtable->set_flush_success();
     }
     _memtable_stat += memtable->stat();
@@ -212,8 +275,105 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     return Status::OK();
 }
 
+Status FlushToken::_flush_block_in_segments(const std::shared_ptr<MemTable>& memtable,
+                                            vectorized::Block* block, int32_t segment_id,
+                                            int32_t num_segments, int64_t* flush_size) {
+    size_t rows = block->rows();
+    size_t rows_per_segment = (rows + num_segments - 1) / num_segments;
+    if (rows_per_segment * (num_segments - 1) >= rows) {
+        // the segment ids are allocated already, so none of the segments can be empty
+        return Status::InternalError("memtable of {} rows can't be flushed into {} segments", rows,
+                                     num_segments);
+    }
+    // the block is sorted, so the segments of consecutive rows don't overlap
+    for (int32_t i = 1; i < num_segments; i++) {
+        size_t start = rows_per_segment * i;
+        size_t length = std::min(rows - start, rows_per_segment);
+        auto columns = block->clone_empty_columns();
+        for (size_t cid = 0; cid < columns.size(); cid++) {
+            columns[cid]->insert_range_from(*block->get_by_position(cid).column, start, length);
+        }
+        auto part = vectorized::Block::create_unique(block->clone_with_columns(std::move(columns)));
+        auto task = MemtableBlockFlushTask::create_shared(shared_from_this(), memtable,
+                                                          std::move(part), segment_id + i);
+        _stats.flush_running_count++;
+        Status st = _submit(std::move(task));
+        if (!st.ok()) {
+            _stats.flush_running_count--;
+            return st;
+        }
+    }
+    auto columns = block->mutate_columns();
+    for (auto& column : columns) {
+        column->erase(rows_per_segment, rows - rows_per_segment);
+    }
+    block->set_columns(std::move(columns));
+    return _rowset_writer->flush_memtable(block, segment_id, flush_size);
+}
+
+void FlushToken::_flush_block(std::shared_ptr<MemTable> memtable,
+                              std::unique_ptr<vectorized::Block> block, int32_t segment_id) {
+    Defer defer {[&]() {
+        {
+            // the block is allocated by the memtable flush
+            SCOPED_ATTACH_TASK(memtable->resource_ctx());
+            SCOPED_CONSUME_MEM_TRACKER(memtable->mem_tracker());
+            block.reset();
+        }
+        memtable.reset();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stats.flush_running_count--;
+        if (_stats.flush_running_count == 0) {
+            _cond.notify_one();
+        }
+    }};
+    if (_is_shutdown()) {
+        return;
+    }
+    {
+        std::shared_lock rdlk(_flush_status_lock);
+        if (!_flush_status.ok()) {
+            return;
+        }
+    }
+    int64_t flush_size = 0;
+    Status st;
+    {
+        SCOPED_ATTACH_TASK(memtable->resource_ctx());
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                memtable->resource_ctx()->memory_context()->mem_tracker()->write_tracker());
+        SCOPED_CONSUME_MEM_TRACKER(memtable->mem_tracker());
+        st = _rowset_writer->flush_memtable(block.get(), segment_id, &flush_size);
+    }
+    if (!st.ok()) {
+        std::lock_guard wrlk(_flush_status_lock);
+        LOG(WARNING) << "Flush memtable part failed with res = " << st
+                     << ", load_id: " << print_id(_rowset_writer->load_id());
+        if (_flush_status.ok()) {
+            _flush_status = st;
+        }
+        return;
+    }
+    _update_segment_disk_size(flush_size);
+}
+
+void FlushToken::_update_segment_disk_size(int64_t flush_size) {
+    if (flush_size <= 0) {
+        return;
+    }
+    _stats.flush_disk_size_bytes += flush_size;
+    g_flush_segment_disk_size << flush_size;
+    auto size = static_cast<uint64_t>(flush_size);
+    uint64_t max_size = _stats.segment_max_disk_size;
+    while (size > max_size && !_stats.segment_max_disk_size.compare_exchange_weak(max_size, size)) {
+    }
+    uint64_t min_size = _stats.segment_min_disk_size;
+    while (size < min_size && !_stats.segment_min_disk_size.compare_exchange_weak(min_size, size)) {
+    }
+}
+
 void FlushToken::_flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t segment_id,
-                                 int64_t submit_task_time) {
+                                 int32_t num_segments, int64_t submit_task_time) {
     signal::set_signal_task_id(_rowset_writer->load_id());
     signal::tablet_id = memtable_ptr->tablet_id();
     Defer defer {[&]() {
@@ -241,7 +401,7 @@ void FlushToken::_flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t
     size_t memory_usage = memtable_ptr->memory_usage();
 
     int64_t flush_size;
-    Status s = _do_flush_memtable(memtable_ptr.get(), segment_id, &flush_size);
+    Status s = _do_flush_memtable(memtable_ptr, segment_id, num_segments, &flush_size);
 
     {
         std::shared_lock rdlk(_flush_status_lock);
@@ -268,7 +428,7 @@ void FlushToken::_flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t
     _stats.flush_time_ns += timer.elapsed_time();
     _stats.flush_finish_count++;
     _stats.flush_size_bytes += memtable_ptr->memory_usage();
-    _stats.flush_disk_size_bytes += flush_size;
+    _update_segment_disk_size(flush_size);
 }
 
 void MemTableFlushExecutor::init(int num_disk) {
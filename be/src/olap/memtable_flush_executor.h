@@ -21,6 +21,7 @@
 #include <condition_variable>
 #include <cstdint>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -45,6 +46,9 @@ struct FlushStatistic {
     std::atomic_uint64_t flush_size_bytes = 0;
     std::atomic_uint64_t flush_disk_size_bytes = 0;
     std::atomic_uint64_t flush_wait_time_ns = 0;
+    // the disk sizes of the largest and the smallest segments flushed
+    std::atomic_uint64_t segment_max_disk_size = 0;
+    std::atomic_uint64_t segment_min_disk_size = std::numeric_limits<uint64_t>::max();
 };
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
@@ -88,11 +92,26 @@ private:
 
 private:
     friend class MemtableFlushTask;
+    friend class MemtableBlockFlushTask;
+
+    Status _submit(std::shared_ptr<Runnable> task);
 
     void _flush_memtable(std::shared_ptr<MemTable> memtable_ptr, int32_t segment_id,
-                         int64_t submit_task_time);
+                         int32_t num_segments, int64_t submit_task_time);
+
+    Status _do_flush_memtable(const std::shared_ptr<MemTable>& memtable, int32_t segment_id,
+                              int32_t num_segments, int64_t* flush_size);
+
+    // Flush the sorted `block` into `num_segments` segments of consecutive rows, the first one is
+    // written by the caller and the others are submitted as MemtableBlockFlushTask.
+    Status _flush_block_in_segments(const std::shared_ptr<MemTable>& memtable,
+                                    vectorized::Block* block, int32_t segment_id,
+                                    int32_t num_segments, int64_t* flush_size);
+
+    void _flush_block(std::shared_ptr<MemTable> memtable, std::unique_ptr<vectorized::Block> block,
+                      int32_t segment_id);
 
-    Status _do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size);
+    void _update_segment_disk_size(int64_t flush_size);
 
     Status _try_reserve_memory(const std::shared_ptr<ResourceContext>& resource_context,
                                int64_t size);
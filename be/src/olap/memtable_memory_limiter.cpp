@@ -42,6 +42,7 @@ bvar::Status<int64_t> g_load_hard_mem_limit("mm_limiter_limit_hard", 0);
 bvar::Status<int64_t> g_load_soft_mem_limit("mm_limiter_limit_soft", 0);
 bvar::Adder<int> g_memtable_memory_limit_flush_memtable_count("mm_limiter_flush_memtable_count");
 bvar::LatencyRecorder g_memtable_memory_limit_flush_size_bytes("mm_limiter_flush_size_bytes");
+bvar::Adder<int> g_memtable_memory_limit_idle_flush_count("mm_limiter_idle_flush_memtable_count");
 
 // Calculate the total memory limit of all load tasks on this BE
 static int64_t calc_process_max_load_memory(int64_t process_mem_limit) {
@@ -70,6 +71,7 @@ Status MemTableMemoryLimiter::init(int64_t process_mem_limit) {
     REGISTER_HOOK_METRIC(memtable_memory_limiter_mem_consumption,
                          [this]() { return _mem_tracker->consumption(); });
     _log_timer.start();
+    _flush_size_timer.start();
     return Status::OK();
 }
 
@@ -295,6 +297,7 @@ int64_t MemTableMemoryLimiter::_flush_active_memtables(uint64_t wg_id, int64_t n
 void MemTableMemoryLimiter::refresh_mem_tracker() {
     std::lock_guard<std::mutex> l(_lock);
     _refresh_mem_tracker();
+    _update_memtable_flush_sizes();
     std::stringstream ss;
     Limit limit = Limit::NONE;
     if (_soft_limit_reached()) {
@@ -325,6 +328,88 @@ void MemTableMemoryLimiter::refresh_mem_tracker() {
     }
 }
 
+int64_t MemTableMemoryLimiter::calc_memtable_flush_size(int64_t mem_budget, double rate,
+                                                        double total_rate,
+                                                        double compression_ratio) {
+    int64_t max_size = config::adaptive_memtable_max_size;
+    if (compression_ratio > 0) {
+        // don't let the segments grow far beyond the target size
+        max_size = std::min(max_size,
+                            static_cast<int64_t>(static_cast<double>(
+                                                         config::memtable_target_segment_size) /
+                                                 compression_ratio));
+    }
+    int64_t min_size = std::min(config::adaptive_memtable_min_size, max_size);
+    int64_t size = min_size;
+    if (total_rate > 0) {
+        size = static_cast<int64_t>(static_cast<double>(mem_budget) * (rate / total_rate));
+    }
+    return std::clamp(size, min_size, max_size);
+}
+
+// Share the load memory among the writers by their ingest rate, so the hot tablets get larger
+// memtables and flush fewer and larger segments, and the memtables of the cold tablets are
+// flushed early to leave the memory to the hot ones.
+void MemTableMemoryLimiter::_update_memtable_flush_sizes() {
+    if (!config::enable_adaptive_memtable_size) {
+        if (_adaptive_flush_size) {
+            for (auto& writer : _writers) {
+                if (auto w = writer.lock()) {
+                    w->set_flush_size(0);
+                }
+            }
+            _adaptive_flush_size = false;
+        }
+        return;
+    }
+    int64_t elapsed_ns = _flush_size_timer.elapsed_time();
+    if (_adaptive_flush_size && elapsed_ns < FLUSH_SIZE_INTERVAL) {
+        return;
+    }
+    _flush_size_timer.reset();
+    bool first = !_adaptive_flush_size;
+    _adaptive_flush_size = true;
+    double seconds = std::max(static_cast<double>(elapsed_ns) / 1e9, 1e-3);
+
+    std::vector<std::pair<std::shared_ptr<MemTableWriter>, int64_t>> writers;
+    double total_rate = 0;
+    for (auto& writer : _writers) {
+        auto w = writer.lock();
+        if (w == nullptr) {
+            continue;
+        }
+        auto* stat = w->ingest_stat();
+        int64_t received_bytes = w->total_received_bytes();
+        int64_t new_bytes = received_bytes - stat->received_bytes;
+        stat->received_bytes = received_bytes;
+        double rate = static_cast<double>(new_bytes) / seconds;
+        // smooth the rate of a bursty writer
+        stat->bytes_per_second = first ? rate : (stat->bytes_per_second + rate) / 2;
+        total_rate += stat->bytes_per_second;
+        writers.emplace_back(std::move(w), new_bytes);
+    }
+
+    int64_t mem_budget =
+            std::max(_load_soft_mem_limit - _queue_mem_usage - _flush_mem_usage, int64_t {0});
+    for (auto& [w, new_bytes] : writers) {
+        double rate = w->ingest_stat()->bytes_per_second;
+        int64_t flush_size = calc_memtable_flush_size(mem_budget, rate, total_rate,
+                                                      w->flush_compression_ratio());
+        w->set_flush_size(flush_size);
+        // an idle writer checks the flush size only on the next write, so flush it here
+        if (first || new_bytes > 0 || w->active_memtable_mem_consumption() < flush_size) {
+            continue;
+        }
+        Status st = w->flush_async();
+        if (!st.ok()) {
+            LOG(WARNING) << "tablet writer failed to flush the memtable of an idle tablet, "
+                         << "tablet_id=" << w->tablet_id() << ", err=" << st;
+            static_cast<void>(w->cancel_with_status(st));
+        }
+        g_memtable_memory_limit_idle_flush_count << 1;
+    }
+}
+
 void MemTableMemoryLimiter::_refresh_mem_tracker() {
     _flush_mem_usage = 0;
     _queue_mem_usage = 0;
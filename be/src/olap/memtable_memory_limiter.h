@@ -53,6 +53,12 @@ public:
 
     int64_t mem_usage() const { return _mem_usage; }
 
+    // The memory size to flush a memtable of a writer, which gets `mem_budget` * `rate` /
+    // `total_rate` of the load memory, `compression_ratio` is disk size / memory size of its
+    // flushed memtables.
+    static int64_t calc_memtable_flush_size(int64_t mem_budget, double rate, double total_rate,
+                                            double compression_ratio);
+
 private:
     // check if the total mem consumption exceeds limit.
     // If yes, it will flush memtable to try to reduce memory consumption.
@@ -69,6 +75,7 @@ private:
     int64_t _need_flush();
     int64_t _flush_active_memtables(uint64_t wg_id, int64_t need_flush);
     void _refresh_mem_tracker();
+    void _update_memtable_flush_sizes();
 
     std::mutex _lock;
     std::condition_variable _hard_limit_end_cond;
@@ -87,6 +94,10 @@ private:
     MonotonicStopWatch _log_timer;
     static const int64_t LOG_INTERVAL = 1 * 1000 * 1000 * 1000; // 1s
 
+    bool _adaptive_flush_size = false;
+    MonotonicStopWatch _flush_size_timer;
+    static const int64_t FLUSH_SIZE_INTERVAL = 1 * 1000 * 1000 * 1000; // 1s
+
     std::vector<std::weak_ptr<MemTableWriter>> _writers;
     std::vector<std::weak_ptr<MemTableWriter>> _active_writers;
 };
@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 
 #include <filesystem>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -104,6 +105,10 @@ Status MemTableWriter::write(const vectorized::Block* block,
     }
 
     _total_received_rows += row_idxs.size();
+    _total_received_bytes += block->rows() == 0
+                                     ? 0
+                                     : static_cast<int64_t>(block->bytes() * row_idxs.size() /
+                                                            block->rows());
     auto st = _mem_table->insert(block, row_idxs);
 
     // Reset memtable immediately after insert failure to prevent potential flush operations.
@@ -126,7 +131,8 @@ Status MemTableWriter::write(const vectorized::Block* block,
     if (UNLIKELY(_mem_table->need_agg() && config::enable_shrink_memory)) {
         _mem_table->shrink_memtable_by_agg();
     }
-    if (UNLIKELY(_mem_table->need_flush())) {
+    int64_t flush_size = _flush_size > 0 ? _flush_size.load() : config::write_buffer_size;
+    if (UNLIKELY(_mem_table->need_flush(flush_size))) {
         auto s = _flush_memtable_async();
         _reset_mem_table();
         if (UNLIKELY(!s.ok())) {
@@ -294,6 +300,9 @@ void MemTableWriter::_update_profile(RuntimeProfile* profile) {
     auto sort_times = ADD_COUNTER(child, "MemTableSortTimes", TUnit::UNIT);
     auto agg_times = ADD_COUNTER(child, "MemTableAggTimes", TUnit::UNIT);
     auto segment_num = ADD_COUNTER(child, "SegmentNum", TUnit::UNIT);
+    auto flush_disk_size = ADD_COUNTER(child, "FlushDiskSize", TUnit::BYTES);
+    auto segment_max_disk_size = ADD_COUNTER(child, "SegmentMaxDiskSize", TUnit::BYTES);
+    auto segment_min_disk_size = ADD_COUNTER(child, "SegmentMinDiskSize", TUnit::BYTES);
     auto raw_rows_num = ADD_COUNTER(child, "RawRowNum", TUnit::UNIT);
     auto merged_rows_num = ADD_COUNTER(child, "MergedRowNum", TUnit::UNIT);
 
@@ -303,6 +312,13 @@ void MemTableWriter::_update_profile(RuntimeProfile* profile) {
     COUNTER_SET(wait_flush_timer, _wait_flush_time_ns);
     COUNTER_SET(close_wait_timer, _close_wait_time_ns);
     COUNTER_SET(segment_num, _segment_num);
+    const auto& flush_stat = _flush_token->get_stats();
+    COUNTER_SET(flush_disk_size, static_cast<int64_t>(flush_stat.flush_disk_size_bytes.load()));
+    COUNTER_SET(segment_max_disk_size, static_cast<int64_t>(flush_stat.segment_max_disk_size));
+    if (flush_stat.segment_min_disk_size != std::numeric_limits<uint64_t>::max()) {
+        COUNTER_SET(segment_min_disk_size,
+                    static_cast<int64_t>(flush_stat.segment_min_disk_size.load()));
+    }
     const auto& memtable_stat = _flush_token->memtable_stat();
     COUNTER_SET(sort_timer, memtable_stat.sort_ns);
     COUNTER_SET(agg_timer, memtable_stat.agg_ns);
@@ -340,6 +356,17 @@ const FlushStatistic& MemTableWriter::get_flush_token_stats() {
     return _flush_token->get_stats();
 }
 
+double MemTableWriter::flush_compression_ratio() const {
+    if (_flush_token == nullptr) {
+        return 0;
+    }
+    const auto& stat = _flush_token->get_stats();
+    uint64_t mem_size = stat.flush_size_bytes;
+    return mem_size == 0 ? 0
+                         : static_cast<double>(stat.flush_disk_size_bytes) /
+                                   static_cast<double>(mem_size);
+}
+
 uint64_t MemTableWriter::flush_running_count() const {
     return _flush_token == nullptr ? 0 : _flush_token->get_stats().flush_running_count.load();
 }
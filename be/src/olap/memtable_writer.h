@@ -51,6 +51,12 @@ namespace vectorized {
 class Block;
 } // namespace vectorized
 
+// The ingest rate of a writer, only accessed by MemTableMemoryLimiter under its lock.
+struct MemTableIngestStat {
+    int64_t received_bytes = 0;
+    double bytes_per_second = 0;
+};
+
 // Writer for a particular (load, index, tablet).
 // This class is NOT thread-safe, external synchronization is required.
 class MemTableWriter {
@@ -96,6 +102,19 @@ public:
 
     int64_t total_received_rows() const { return _total_received_rows; }
 
+    int64_t total_received_bytes() const { return _total_received_bytes; }
+
+    // The memory size to flush the active memtable, 0 means config::write_buffer_size.
+    // It's set by MemTableMemoryLimiter if config::enable_adaptive_memtable_size is true.
+    void set_flush_size(int64_t size) { _flush_size = size; }
+
+    int64_t flush_size() const { return _flush_size; }
+
+    // disk size / memory size of the flushed memtables, 0 if nothing is flushed
+    double flush_compression_ratio() const;
+
+    MemTableIngestStat* ingest_stat() { return &_ingest_stat; }
+
     const FlushStatistic& get_flush_token_stats();
 
     uint64_t flush_running_count() const;
@@ -140,6 +159,10 @@ private:
 
     // total rows num written by MemTableWriter
     std::atomic<int64_t> _total_received_rows = 0;
+    // approximate bytes of the received rows
+    std::atomic<int64_t> _total_received_bytes = 0;
+    std::atomic<int64_t> _flush_size = 0;
+    MemTableIngestStat _ingest_stat;
     int64_t _wait_flush_time_ns = 0;
     int64_t _close_wait_time_ns = 0;
     int64_t _segment_num = 0;
@@ -17,6 +17,7 @@
 
 #include "olap/merger.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/types.pb.h>
 #include <stddef.h>
@@ -38,6 +39,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/base_tablet.h"
+#include "olap/data_dir.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/olap_define.h"
@@ -52,7 +54,9 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/workload_management/io_throttle.h"
 #include "util/slice.h"
+#include "util/time.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -60,6 +64,39 @@
 
 namespace doris {
 
+bvar::Adder<int64_t> g_compaction_io_throttle_wait_us("compaction_io_throttle_wait_us");
+
+namespace {
+
+// Holds back a compaction loop to the io budget of its reader type on the data dir of the tablet.
+class CompactionIOLimiter {
+public:
+    CompactionIOLimiter(const BaseTabletSPtr& tablet, ReaderType reader_type) {
+        if (!config::is_cloud_mode()) {
+            _throttle = static_cast<Tablet*>(tablet.get())->data_dir()->compaction_io_throttle(
+                    reader_type);
+        }
+    }
+
+    // `compressed_bytes_read` is the total bytes read by the reader so far.
+    void wait(int64_t compressed_bytes_read) {
+        if (_throttle == nullptr) {
+            return;
+        }
+        _throttle->update_next_io_time(compressed_bytes_read - _bytes_read);
+        _bytes_read = compressed_bytes_read;
+        int64_t start = GetCurrentTimeMicros();
+        _throttle->acquire(-1);
+        g_compaction_io_throttle_wait_us << GetCurrentTimeMicros() - start;
+    }
+
+private:
+    IOThrottle* _throttle = nullptr;
+    int64_t _bytes_read = 0;
+};
+
+} // namespace
+
 Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                               const TabletSchema& cur_tablet_schema,
                               const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -109,6 +146,7 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
     vectorized::Block block = cur_tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
+    CompactionIOLimiter io_limiter(tablet, reader_type);
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
@@ -134,6 +172,7 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
 
         output_rows += block.rows();
         block.clear_column_data();
+        io_limiter.wait(reader.stats().compressed_bytes_read);
     }
     if (ExecEnv::GetInstance()->storage_engine().stopped()) {
         return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
@@ -295,6 +334,7 @@ Status Merger::vertical_compact_one_group(
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
+    CompactionIOLimiter io_limiter(tablet, reader_type);
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
@@ -320,6 +360,7 @@ Status Merger::vertical_compact_one_group(
         }
         output_rows += block.rows();
         block.clear_column_data();
+        io_limiter.wait(reader.stats().compressed_bytes_read);
     }
     if (ExecEnv::GetInstance()->storage_engine().stopped()) {
         return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
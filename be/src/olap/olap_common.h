@@ -331,6 +331,8 @@ struct OlapReaderStatistics {
     int64_t rows_vec_del_cond_filtered = 0;
     int64_t vec_cond_ns = 0;
     int64_t short_cond_ns = 0;
+    // times the predicates are reordered by the observed costs
+    int64_t predicate_reorder_num = 0;
     int64_t expr_filter_ns = 0;
     int64_t output_col_ns = 0;
     int64_t rows_key_range_filtered = 0;
@@ -357,6 +359,12 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // bytes of the pages found in the page cache
+    int64_t cached_pages_bytes = 0;
+    // pages decompressed from the compressed page cache
+    int64_t compressed_cached_pages_num = 0;
+    // data page ranges planned to read by the coalesced reads on remote storage
+    int64_t coalesced_read_ranges = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -375,6 +383,9 @@ struct OlapReaderStatistics {
     int64_t inverted_index_searcher_cache_hit = 0;
     int64_t inverted_index_searcher_cache_miss = 0;
     int64_t inverted_index_downgrade_count = 0;
+    // the number of terms of the conjunction queries intersected by bitmaps and by skip lists
+    int64_t inverted_index_conjunction_bitmap_terms = 0;
+    int64_t inverted_index_conjunction_skip_terms = 0;
     InvertedIndexStatistics inverted_index_stats;
 
     int64_t output_index_result_column_timer = 0;
@@ -987,6 +987,15 @@ std::vector<TabletSharedPtr> StorageEngine::_generate_compaction_tasks(
         }
     }
 
+    if (config::enable_compaction_read_amp_score) {
+        // the permits are requested in the order of submission
+        std::stable_sort(tablets_compaction.begin(), tablets_compaction.end(),
+                         [](const TabletSharedPtr& a, const TabletSharedPtr& b) {
+                             return a->read_amp_compaction_score() >
+                                    b->read_amp_compaction_score();
+                         });
+    }
+
     if (max_compaction_score > 0) {
         if (compaction_type == CompactionType::BASE_COMPACTION) {
             DorisMetrics::instance()->tablet_base_max_compaction_score->set_value(
@@ -1664,6 +1673,30 @@ int64_t StorageEngine::get_pending_publish_min_version(int64_t tablet_id) {
     return iter->second.begin()->first;
 }
 
+bool StorageEngine::take_async_publish_task(int64_t tablet_id, int64_t publish_version,
+                                            int64_t* transaction_id, int64_t* partition_id) {
+    {
+        std::unique_lock<std::shared_mutex> wlock(_async_publish_lock);
+        auto tablet_iter = _async_publish_tasks.find(tablet_id);
+        if (tablet_iter == _async_publish_tasks.end()) {
+            return false;
+        }
+        auto task_iter = tablet_iter->second.find(publish_version);
+        if (task_iter == tablet_iter->second.end()) {
+            return false;
+        }
+        *transaction_id = task_iter->second.first;
+        *partition_id = task_iter->second.second;
+        tablet_iter->second.erase(task_iter);
+    }
+    TabletSharedPtr tablet = tablet_manager()->get_tablet(tablet_id);
+    if (tablet != nullptr) {
+        static_cast<void>(TabletMetaManager::remove_pending_publish_info(
+                tablet->data_dir(), tablet_id, publish_version));
+    }
+    return true;
+}
+
 void StorageEngine::_process_async_publish() {
     // tablet, publish_version
     std::vector<std::pair<TabletSharedPtr, int64_t>> need_removed_tasks;
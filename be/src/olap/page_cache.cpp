@@ -20,6 +20,8 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
 
+#include <cstring>
+#include <memory>
 #include <ostream>
 
 #include "runtime/exec_env.h"
@@ -48,6 +50,16 @@ MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(size_t size, bo
     }
 }
 
+MemoryTrackedPageWithPageEntity::MemoryTrackedPageWithPageEntity(
+        size_t size, std::shared_ptr<MemTrackerLimiter> mem_tracker)
+        : MemoryTrackedPageBase<char*>(size, std::move(mem_tracker)), _capacity(size) {
+    {
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(this->_mem_tracker_by_allocator);
+        this->_data = reinterpret_cast<char*>(
+                Allocator<false>::alloc(this->_capacity, ALLOCATOR_ALIGNMENT_16));
+    }
+}
+
 MemoryTrackedPageWithPageEntity::~MemoryTrackedPageWithPageEntity() {
     if (this->_data != nullptr) {
         DCHECK(this->_capacity != 0 && this->_size != 0);
@@ -74,13 +86,15 @@ MemoryTrackedPageWithPagePtr<T>::~MemoryTrackedPageWithPagePtr() {
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int64_t compressed_page_cache_capacity) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, compressed_page_cache_capacity);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int64_t compressed_page_cache_capacity)
         : _index_cache_percentage(index_cache_percentage) {
     if (index_cache_percentage == 0) {
         _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
@@ -96,6 +110,10 @@ StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percenta
     }
 
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
+    if (compressed_page_cache_capacity > 0) {
+        _compressed_page_cache =
+                std::make_unique<CompressedPageCache>(compressed_page_cache_capacity, num_shards);
+    }
 }
 
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
@@ -122,6 +140,29 @@ void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHand
     *handle = PageCacheHandle(cache, lru_handle);
 }
 
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle) {
+    if (_compressed_page_cache == nullptr) {
+        return false;
+    }
+    auto* lru_handle = _compressed_page_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_page_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, const Slice& page) {
+    DCHECK(_compressed_page_cache != nullptr);
+    auto data = std::make_unique<DataPage>(page.size, _compressed_page_cache->mem_tracker());
+    memcpy(data->data(), page.data, page.size);
+    auto* lru_handle =
+            _compressed_page_cache->insert(key.encode(), data.get(), data->capacity(), 0);
+    // the handle is released at once, the page is only kept by the cache
+    PageCacheHandle handle(_compressed_page_cache.get(), lru_handle);
+    data.release();
+}
+
 template <typename T>
 void StoragePageCache::insert(const CacheKey& key, T data, size_t size, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type, bool in_memory) {
@@ -42,6 +42,8 @@ class MemoryTrackedPageBase : public LRUCacheValueBase {
 public:
     MemoryTrackedPageBase() = default;
     MemoryTrackedPageBase(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    MemoryTrackedPageBase(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker)
+            : _size(b), _mem_tracker_by_allocator(std::move(mem_tracker)) {}
 
     MemoryTrackedPageBase(const MemoryTrackedPageBase&) = delete;
     MemoryTrackedPageBase& operator=(const MemoryTrackedPageBase&) = delete;
@@ -59,6 +61,8 @@ protected:
 class MemoryTrackedPageWithPageEntity : Allocator<false>, public MemoryTrackedPageBase<char*> {
 public:
     MemoryTrackedPageWithPageEntity(size_t b, bool use_cache, segment_v2::PageTypePB page_type);
+    // The memory is tracked by `mem_tracker`, e.g. of a cache other than the page cache.
+    MemoryTrackedPageWithPageEntity(size_t b, std::shared_ptr<MemTrackerLimiter> mem_tracker);
 
     size_t capacity() { return this->_capacity; }
 
@@ -119,6 +123,8 @@ public:
                 : LRUCachePolicy(CachePolicy::CacheType::DATA_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
                                  num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true, true) {
+            set_protected_percentage(config::data_page_cache_protected_percentage);
+            set_clock_lookup(config::enable_page_cache_clock_lookup);
         }
     };
 
@@ -127,7 +133,10 @@ public:
         IndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::INDEXPAGE_CACHE, capacity,
                                  LRUCacheType::SIZE, config::index_page_cache_stale_sweep_time_sec,
-                                 num_shards) {}
+                                 num_shards) {
+            set_protected_percentage(config::index_page_cache_protected_percentage);
+            set_clock_lookup(config::enable_page_cache_clock_lookup);
+        }
     };
 
     class PKIndexPageCache : public LRUCachePolicy {
@@ -135,7 +144,20 @@ public:
         PKIndexPageCache(size_t capacity, uint32_t num_shards)
                 : LRUCachePolicy(CachePolicy::CacheType::PK_INDEX_PAGE_CACHE, capacity,
                                  LRUCacheType::SIZE,
-                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {}
+                                 config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {
+            set_protected_percentage(config::pk_index_page_cache_protected_percentage);
+            set_clock_lookup(config::enable_page_cache_clock_lookup);
+        }
+    };
+
+    // The compressed bytes of the pages, which are decompressed into the page caches above only
+    // when they are read again, so the pages read once take less memory.
+    class CompressedPageCache : public LRUCachePolicy {
+    public:
+        CompressedPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::COMPRESSED_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards) {}
     };
 
     static constexpr uint32_t kDefaultNumShards = 16;
@@ -143,14 +165,16 @@ public:
     // Create global instance of this class
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int64_t compressed_page_cache_capacity = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int64_t compressed_page_cache_capacity = 0);
 
     // Lookup the given page in the cache.
     //
@@ -186,6 +210,15 @@ public:
         return _get_page_cache(page_type)->mem_tracker();
     }
 
+    bool has_compressed_page_cache() const { return _compressed_page_cache != nullptr; }
+
+    // Lookup the compressed bytes of the page, as read from the file, in the compressed page
+    // cache. Return false if it's not found or the cache is disabled.
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle);
+
+    // Copy the compressed bytes of the page into the compressed page cache.
+    void insert_compressed(const CacheKey& key, const Slice& page);
+
 private:
     StoragePageCache();
 
@@ -196,6 +229,8 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
+    // nullptr if the compressed page cache is disabled
+    std::unique_ptr<CompressedPageCache> _compressed_page_cache;
 
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
@@ -207,6 +207,9 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
         _read_options.io_ctx.is_disposable =
                 _read_context->runtime_state->query_options().disable_file_cache;
     }
+    if (_read_context->disposable_file_cache) {
+        _read_options.io_ctx.is_disposable = true;
+    }
 
     _read_options.io_ctx.expiration_time =
             read_context->ttl_seconds > 0 && _rowset->rowset_meta()->newest_write_timestamp() > 0
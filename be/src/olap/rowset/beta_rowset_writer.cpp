@@ -23,6 +23,7 @@
 #include <fmt/format.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <ctime> // time
 #include <filesystem>
 #include <memory>
@@ -397,6 +398,9 @@ Status BetaRowsetWriter::_load_noncompacted_segment(segment_v2::SegmentSharedPtr
  *     single small
  *  3. if the consecutive smalls end up with small, compact the smalls if the
  *     length is beyond (config::segcompaction_batch_size / 2)
+ *  4. if the pending segments are beyond twice of config::segcompaction_batch_size,
+ *     which means the flushes outpace the segcompaction, take them all up to
+ *     config::segcompaction_max_batch_size
  */
 Status BetaRowsetWriter::_find_longest_consecutive_small_segment(
         SegCompactionCandidatesSharedPtr& segments) {
@@ -405,9 +409,14 @@ Status BetaRowsetWriter::_find_longest_consecutive_small_segment(
     int32_t last_segment = _num_segment - 1;
     size_t task_bytes = 0;
     uint32_t task_rows = 0;
+    int32_t batch_size = config::segcompaction_batch_size;
+    if (last_segment - _segcompacted_point >= 2 * batch_size) {
+        batch_size = std::max(batch_size, std::min(last_segment - _segcompacted_point.load(),
+                                                   config::segcompaction_max_batch_size));
+    }
     int32_t segid;
-    for (segid = _segcompacted_point;
-         segid < last_segment && segments->size() < config::segcompaction_batch_size; segid++) {
+    for (segid = _segcompacted_point; segid < last_segment && segments->size() < batch_size;
+         segid++) {
         segment_v2::SegmentSharedPtr segment;
         RETURN_IF_ERROR(_load_noncompacted_segment(segment, segid));
         const auto segment_rows = segment->num_rows();
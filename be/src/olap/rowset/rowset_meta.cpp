@@ -86,7 +86,9 @@ bool RowsetMeta::init_from_json(const std::string& json_rowset_meta) {
 bool RowsetMeta::json_rowset_meta(std::string* json_rowset_meta) {
     json2pb::Pb2JsonOptions json_options;
     json_options.pretty_json = true;
-    bool ret = json2pb::ProtoMessageToJson(_rowset_meta_pb, json_rowset_meta, json_options);
+    RowsetMetaPB rowset_meta_pb = _rowset_meta_pb;
+    _unpack(&rowset_meta_pb);
+    bool ret = json2pb::ProtoMessageToJson(rowset_meta_pb, json_rowset_meta, json_options);
     return ret;
 }
 
@@ -136,6 +138,7 @@ bool RowsetMeta::has_variant_type_in_schema() const {
 
 void RowsetMeta::to_rowset_pb(RowsetMetaPB* rs_meta_pb, bool skip_schema) const {
     *rs_meta_pb = _rowset_meta_pb;
+    _unpack(rs_meta_pb);
     if (_schema) [[likely]] {
         rs_meta_pb->set_schema_version(_schema->schema_version());
         if (!skip_schema) {
@@ -188,6 +191,7 @@ bool RowsetMeta::_serialize_to_pb(std::string* value) {
         return false;
     }
     RowsetMetaPB rowset_meta_pb = _rowset_meta_pb;
+    _unpack(&rowset_meta_pb);
     if (_schema) {
         _schema->to_schema_pb(rowset_meta_pb.mutable_tablet_schema());
     }
@@ -200,9 +204,26 @@ void RowsetMeta::_init() {
     } else {
         _rowset_id.init(_rowset_meta_pb.rowset_id_v2());
     }
+    _pack();
     update_metadata_size();
 }
 
+void RowsetMeta::_pack() {
+    _rowset_id_v2_packed = false;
+    // only if it's the same as the string of the parsed id, which is not for the invalid ids
+    if (_rowset_meta_pb.rowset_id() == 0 && _rowset_meta_pb.has_rowset_id_v2() &&
+        _rowset_meta_pb.rowset_id_v2() == _rowset_id.to_string()) {
+        _rowset_meta_pb.clear_rowset_id_v2();
+        _rowset_id_v2_packed = true;
+    }
+}
+
+void RowsetMeta::_unpack(RowsetMetaPB* rowset_meta_pb) const {
+    if (_rowset_id_v2_packed) {
+        rowset_meta_pb->set_rowset_id_v2(_rowset_id.to_string());
+    }
+}
+
 void RowsetMeta::add_segments_file_size(const std::vector<size_t>& seg_file_size) {
     _rowset_meta_pb.set_enable_segments_file_size(true);
     for (auto fsize : seg_file_size) {
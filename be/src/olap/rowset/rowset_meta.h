@@ -73,7 +73,9 @@ public:
         // rowset id is a required field, just set it to 0
         _rowset_meta_pb.set_rowset_id(0);
         _rowset_id = rowset_id;
-        _rowset_meta_pb.set_rowset_id_v2(rowset_id.to_string());
+        // rowset_id_v2 is set by `_unpack`
+        _rowset_meta_pb.clear_rowset_id_v2();
+        _rowset_id_v2_packed = true;
     }
 
     int64_t tablet_id() const { return _rowset_meta_pb.tablet_id(); }
@@ -385,6 +387,13 @@ private:
 
     void _init();
 
+    // Clear the fields of `_rowset_meta_pb` that are derived from the other members, so they are
+    // not kept in memory for each rowset, e.g. the 48 chars of rowset_id_v2.
+    void _pack();
+
+    // Set back the fields cleared by `_pack` in `rowset_meta_pb` copied from `_rowset_meta_pb`.
+    void _unpack(RowsetMetaPB* rowset_meta_pb) const;
+
     friend bool operator==(const RowsetMeta& a, const RowsetMeta& b);
 
     friend bool operator!=(const RowsetMeta& a, const RowsetMeta& b) { return !(a == b); }
@@ -396,6 +405,7 @@ private:
     RowsetId _rowset_id;
     StorageResource _storage_resource;
     bool _is_removed_from_rowset_meta = false;
+    bool _rowset_id_v2_packed = false;
 };
 
 } // namespace doris
@@ -0,0 +1,225 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/binary_fsst_page.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/status.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace segment_v2 {
+
+Status BinaryFsstPageBuilder::add(const uint8_t* vals, size_t* count) {
+    DCHECK(!_finished);
+    const auto* src = reinterpret_cast<const Slice*>(vals);
+    size_t i = 0;
+    for (; i < *count && !is_page_full(); ++i, ++src) {
+        // This may need a large memory, should return error if could not allocated
+        // successfully, to avoid BE OOM.
+        RETURN_IF_CATCH_EXCEPTION({
+            _offsets.push_back(static_cast<uint32_t>(_values.size()));
+            _values.append(src->data, src->size);
+        });
+        _size_estimate += src->size + sizeof(uint32_t);
+    }
+    *count = i;
+    return Status::OK();
+}
+
+Status BinaryFsstPageBuilder::finish(OwnedSlice* slice) {
+    DCHECK(!_finished);
+    _finished = true;
+    RETURN_IF_CATCH_EXCEPTION({
+        std::vector<Slice> values(_offsets.size());
+        for (size_t i = 0; i < _offsets.size(); ++i) {
+            values[i] = _value_at(i);
+        }
+        FsstSymbolTable symbol_table;
+        symbol_table.build(values.data(), values.size());
+        symbol_table.serialize(&_buffer);
+
+        std::vector<uint32_t> codes_offsets(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            codes_offsets[i] = static_cast<uint32_t>(_buffer.size());
+            symbol_table.encode(values[i], &_buffer);
+        }
+        for (uint32_t offset : codes_offsets) {
+            put_fixed32_le(&_buffer, offset);
+        }
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(values.size()));
+        if (!values.empty()) {
+            _first_value.assign_copy(reinterpret_cast<const uint8_t*>(values.front().data),
+                                     values.front().size);
+            _last_value.assign_copy(reinterpret_cast<const uint8_t*>(values.back().data),
+                                    values.back().size);
+        }
+        *slice = _buffer.build();
+    });
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::init() {
+    CHECK(!_parsed);
+    if (_data.size < sizeof(uint32_t)) {
+        return Status::Corruption(
+                "file corruption: not enough bytes for trailer in BinaryFsstPageDecoder. "
+                "invalid data size:{}",
+                _data.size);
+    }
+    const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+    _num_elems = decode_fixed32_le(data + _data.size - sizeof(uint32_t));
+    if ((_num_elems + 1ULL) * sizeof(uint32_t) > _data.size) {
+        return Status::Corruption("file corruption: data size: {}, num_element: {}", _data.size,
+                                  _num_elems);
+    }
+    _offsets_pos = static_cast<uint32_t>(_data.size - (_num_elems + 1) * sizeof(uint32_t));
+    _codes_pos = static_cast<uint32_t>(_symbol_table.deserialize(data, _offsets_pos));
+    if (_codes_pos == 0) {
+        return Status::Corruption("file corruption: invalid symbol table, data size: {}",
+                                  _data.size);
+    }
+    _parsed = true;
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::seek_to_position_in_page(size_t pos) {
+    DCHECK(_parsed);
+    if (pos > _num_elems) [[unlikely]] {
+        return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                "seek pos {} is larger than total elements  {}", pos, _num_elems);
+    }
+    _cur_idx = static_cast<uint32_t>(pos);
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    if (*n == 0 || _cur_idx >= _num_elems) [[unlikely]] {
+        *n = 0;
+        return Status::OK();
+    }
+    const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+    uint32_t start = _offset(_cur_idx);
+    uint32_t end = _offset(_cur_idx + max_fetch);
+    if (start < _codes_pos || end < start || end > _offsets_pos) {
+        return Status::Corruption("file corruption: invalid codes offsets [{}, {})", start, end);
+    }
+
+    _decoded.resize((end - start) * FsstSymbolTable::MAX_SYMBOL_LENGTH);
+    _decoded_offsets.resize(max_fetch + 1);
+    _decoded_offsets[0] = 0;
+    size_t decoded_size = 0;
+    for (size_t i = 0; i < max_fetch; ++i) {
+        size_t size = 0;
+        RETURN_IF_ERROR(_decode_at(_cur_idx + i, _decoded.data() + decoded_size, &size));
+        decoded_size += size;
+        _decoded_offsets[i + 1] = static_cast<uint32_t>(decoded_size);
+    }
+    dst->insert_many_continuous_binary_data(reinterpret_cast<const char*>(_decoded.data()),
+                                            _decoded_offsets.data(), max_fetch);
+    _cur_idx += static_cast<uint32_t>(max_fetch);
+    *n = max_fetch;
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal,
+                                             size_t* n, vectorized::MutableColumnPtr& dst) {
+    DCHECK(_parsed);
+    size_t read_count = 0;
+    size_t codes_size = 0;
+    for (; read_count < *n; ++read_count) {
+        ordinal_t ord = rowids[read_count] - page_first_ordinal;
+        if (ord >= _num_elems) [[unlikely]] {
+            break;
+        }
+        uint32_t start = _offset(ord);
+        uint32_t end = _offset(ord + 1);
+        if (start < _codes_pos || end < start || end > _offsets_pos) {
+            return Status::Corruption("file corruption: invalid codes offsets [{}, {})", start,
+                                      end);
+        }
+        codes_size += end - start;
+    }
+
+    _decoded.resize(codes_size * FsstSymbolTable::MAX_SYMBOL_LENGTH);
+    _binary_data.resize(read_count);
+    size_t decoded_size = 0;
+    for (size_t i = 0; i < read_count; ++i) {
+        size_t size = 0;
+        uint8_t* output = _decoded.data() + decoded_size;
+        RETURN_IF_ERROR(_decode_at(rowids[i] - page_first_ordinal, output, &size));
+        _binary_data[i] = StringRef(reinterpret_cast<const char*>(output), size);
+        decoded_size += size;
+    }
+    if (read_count > 0) [[likely]] {
+        dst->insert_many_strings(_binary_data.data(), read_count);
+    }
+    *n = read_count;
+    return Status::OK();
+}
+
+Status BinaryFsstPageDecoder::string_at_index(size_t idx, std::string* value) const {
+    DCHECK(_parsed);
+    DCHECK_LT(idx, _num_elems);
+    uint32_t codes_size = _offset(idx + 1) - _offset(idx);
+    value->resize(std::min<size_t>(codes_size, _data.size) * FsstSymbolTable::MAX_SYMBOL_LENGTH);
+    size_t size = 0;
+    RETURN_IF_ERROR(_decode_at(idx, reinterpret_cast<uint8_t*>(value->data()), &size));
+    value->resize(size);
+    return Status::OK();
+}
+
+void BinaryFsstPageDecoder::evaluate_equal(const Slice& value, size_t from, size_t n,
+                                           uint8_t* results) const {
+    DCHECK(_parsed);
+    DCHECK_LE(from + n, _num_elems);
+    faststring codes;
+    _symbol_table.encode(value, &codes);
+    const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+    uint32_t start = _offset(from);
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t end = _offset(from + i + 1);
+        results[i] = end <= _offsets_pos && end - start == codes.size() &&
+                     memcmp(data + start, codes.data(), codes.size()) == 0;
+        start = end;
+    }
+}
+
+Status BinaryFsstPageDecoder::_decode_at(size_t idx, uint8_t* output, size_t* decoded_size) const {
+    uint32_t start = _offset(idx);
+    uint32_t end = _offset(idx + 1);
+    if (start < _codes_pos || end < start || end > _offsets_pos) {
+        return Status::Corruption("file corruption: invalid codes offsets [{}, {})", start, end);
+    }
+    if (!_symbol_table.decode(reinterpret_cast<const uint8_t*>(_data.data) + start, end - start,
+                              output, decoded_size)) {
+        return Status::Corruption("file corruption: invalid codes of value {}", idx);
+    }
+    return Status::OK();
+}
+
+} // namespace segment_v2
+} // namespace doris
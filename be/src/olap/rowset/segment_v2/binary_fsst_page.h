@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/fsst_coding.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// FSST encoding for high cardinality strings, e.g. urls and logs, which gain little from the
+// dictionary. The symbols are built per page, and each value is encoded independently, so a value
+// is decoded without decompressing the whole page.
+//
+// BinaryFsstPage := SymbolTable, Codes^NumEntry, Trailer
+// SymbolTable := serialized FsstSymbolTable
+// Trailer := CodesOffset(uint32_t)^NumEntry, NumEntry(uint32_t)
+class BinaryFsstPageBuilder : public PageBuilderHelper<BinaryFsstPageBuilder> {
+public:
+    using Self = BinaryFsstPageBuilder;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    // the raw size is estimated, so the encoded page is not larger than data_page_size
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override;
+
+    Status finish(OwnedSlice* slice) override;
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.clear();
+            _offsets.clear();
+            _buffer.clear();
+            _size_estimate = sizeof(uint32_t);
+            _finished = false;
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _finished ? _buffer.size() : _size_estimate; }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+        return Status::OK();
+    }
+
+private:
+    BinaryFsstPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    Slice _value_at(size_t idx) const {
+        size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _values.size();
+        return Slice(_values.data() + _offsets[idx], end - _offsets[idx]);
+    }
+
+    PageBuilderOptions _options;
+    // the raw values added, which are encoded when the page is finished
+    faststring _values;
+    std::vector<uint32_t> _offsets;
+    faststring _buffer;
+    size_t _size_estimate = 0;
+    bool _finished = false;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+class BinaryFsstPageDecoder : public PageDecoder {
+public:
+    BinaryFsstPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    Status init() override;
+
+    Status seek_to_position_in_page(size_t pos) override;
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override;
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override;
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+    // Decodes the value at `idx` alone.
+    Status string_at_index(size_t idx, std::string* value) const;
+
+    // Sets `results[i]` to whether the value at `from + i` equals `value`, which is compared on
+    // the codes without decoding the values.
+    void evaluate_equal(const Slice& value, size_t from, size_t n, uint8_t* results) const;
+
+private:
+    // Return the offset within '_data' where the codes of the value at 'idx' start.
+    uint32_t _offset(size_t idx) const {
+        if (idx >= _num_elems) {
+            return _offsets_pos;
+        }
+        return decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offsets_pos +
+                                 idx * sizeof(uint32_t));
+    }
+
+    // Decodes the value at `idx` into `output` of MAX_SYMBOL_LENGTH bytes per code.
+    Status _decode_at(size_t idx, uint8_t* output, size_t* decoded_size) const;
+
+    Slice _data;
+    bool _parsed = false;
+    FsstSymbolTable _symbol_table;
+    uint32_t _num_elems = 0;
+    uint32_t _codes_pos = 0;
+    uint32_t _offsets_pos = 0;
+    uint32_t _cur_idx = 0;
+
+    std::vector<uint8_t> _decoded;
+    std::vector<uint32_t> _decoded_offsets;
+    std::vector<StringRef> _binary_data;
+};
+
+} // namespace segment_v2
+} // namespace doris
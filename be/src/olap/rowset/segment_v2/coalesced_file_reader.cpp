@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/coalesced_file_reader.h"
+
+#include <algorithm>
+
+namespace doris {
+namespace segment_v2 {
+
+void CoalescedFileReader::set_ranges(std::vector<io::PrefetchRange> ranges) {
+    DCHECK(_merge_range_reader == nullptr);
+    if (ranges.empty()) {
+        return;
+    }
+    std::sort(ranges.begin(), ranges.end(),
+              [](const io::PrefetchRange& lhs, const io::PrefetchRange& rhs) {
+                  return lhs.start_offset < rhs.start_offset;
+              });
+    std::vector<io::PrefetchRange> merged;
+    merged.reserve(ranges.size());
+    for (const auto& range : ranges) {
+        if (!merged.empty() && merged.back().end_offset >= range.start_offset) {
+            merged.back().end_offset = std::max(merged.back().end_offset, range.end_offset);
+        } else {
+            merged.push_back(range);
+        }
+    }
+    _merge_range_reader = std::make_unique<io::MergeRangeFileReader>(nullptr, _reader, merged);
+}
+
+Status CoalescedFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                                         const io::IOContext* io_ctx) {
+    if (_merge_range_reader != nullptr) {
+        return _merge_range_reader->read_at(offset, result, bytes_read, io_ctx);
+    }
+    return _reader->read_at(offset, result, bytes_read, io_ctx);
+}
+
+} // namespace segment_v2
+} // namespace doris
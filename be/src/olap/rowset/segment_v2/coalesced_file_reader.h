@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/buffered_reader.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/path.h"
+#include "util/slice.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// The file reader of a SegmentIterator on remote storage. Reads go to the segment file reader
+// until the data page ranges of the rows to read are planned, then they go to a
+// MergeRangeFileReader, which merges the small page reads of the columns into larger ones and
+// reads the following ranges ahead.
+//
+// The segment file reader is shared with other iterators, so it's not closed by this reader.
+class CoalescedFileReader final : public io::FileReader {
+public:
+    explicit CoalescedFileReader(io::FileReaderSPtr reader) : _reader(std::move(reader)) {}
+
+    ~CoalescedFileReader() override = default;
+
+    // `ranges` are sorted and the adjacent ones are merged, so a read of a page never spans two
+    // ranges. Must be called once, before the planned pages are read.
+    void set_ranges(std::vector<io::PrefetchRange> ranges);
+
+    Status close() override {
+        _closed = true;
+        return Status::OK();
+    }
+
+    const io::Path& path() const override { return _reader->path(); }
+
+    size_t size() const override { return _reader->size(); }
+
+    bool closed() const override { return _closed; }
+
+    const std::string& get_data_dir_path() override { return _reader->get_data_dir_path(); }
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const io::IOContext* io_ctx) override;
+
+private:
+    io::FileReaderSPtr _reader;
+    std::unique_ptr<io::MergeRangeFileReader> _merge_range_reader;
+    bool _closed = false;
+};
+
+} // namespace segment_v2
+} // namespace doris
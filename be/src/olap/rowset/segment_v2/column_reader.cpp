@@ -18,6 +18,7 @@
 #include "olap/rowset/segment_v2/column_reader.h"
 
 #include <assert.h>
+#include <bvar/bvar.h>
 #include <gen_cpp/segment_v2.pb.h>
 
 #include <algorithm>
@@ -27,8 +28,10 @@
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "olap/block_column_predicate.h"
@@ -38,6 +41,7 @@
 #include "olap/inverted_index_parser.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
+#include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/bitmap_index_reader.h"
@@ -60,11 +64,13 @@
 #include "olap/wrapper_field.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "util/binary_cast.hpp"
 #include "util/bitmap.h"
 #include "util/block_compression.h"
 #include "util/rle_encoding.h" // for RleDecoder
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_map.h"
@@ -82,6 +88,9 @@
 
 namespace doris::segment_v2 {
 
+bvar::Adder<int64_t> g_page_decompress_prefetch_num("page_decompress_prefetch_num");
+bvar::Adder<int64_t> g_page_decompress_prefetch_dropped_num("page_decompress_prefetch_dropped_num");
+
 inline bool read_as_string(PrimitiveType type) {
     return type == PrimitiveType::TYPE_STRING || type == PrimitiveType::INVALID_TYPE ||
            type == PrimitiveType::TYPE_BITMAP || type == PrimitiveType::TYPE_FIXED_LENGTH_OBJECT;
@@ -374,6 +383,53 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
 
+void ColumnReader::prefetch_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
+                                 BlockCompressionCodec* codec) const {
+    auto* pool = ExecEnv::GetInstance()->page_decompress_prefetch_thread_pool();
+    if (pool == nullptr || StoragePageCache::instance() == nullptr || _file_reader == nullptr) {
+        return;
+    }
+    // the pointers of the reader's io context may be released before the task runs
+    io::IOContext io_ctx;
+    io_ctx.reader_type = iter_opts.io_ctx.reader_type;
+    io_ctx.is_disposable = iter_opts.io_ctx.is_disposable;
+    io_ctx.expiration_time = iter_opts.io_ctx.expiration_time;
+    // the codecs and the encoding infos are global, the file reader is kept by the task
+    auto st = pool->submit_func([file_reader = _file_reader, io_ctx, pp, codec,
+                                 type = iter_opts.type, verify_checksum = _opts.verify_checksum,
+                                 kept_in_memory = _opts.kept_in_memory,
+                                 encoding_info = _encoding_info]() {
+        OlapReaderStatistics stats;
+        PageReadOptions opts(io_ctx);
+        opts.verify_checksum = verify_checksum;
+        opts.use_page_cache = true;
+        opts.kept_in_memory = kept_in_memory;
+        opts.prefetch = true;
+        opts.type = type;
+        opts.file_reader = file_reader.get();
+        opts.page_pointer = pp;
+        opts.codec = codec;
+        opts.stats = &stats;
+        opts.encoding_info = encoding_info;
+        if (type == INDEX_PAGE) {
+            opts.pre_decode = false;
+        }
+        PageHandle handle;
+        Slice page_body;
+        PageFooterPB footer;
+        auto st = PageIO::read_and_decompress_page(opts, &handle, &page_body, &footer);
+        if (!st.ok()) {
+            VLOG_DEBUG << "failed to prefetch page " << pp << " of " << file_reader->path()
+                       << ": " << st;
+        }
+    });
+    if (st.ok()) {
+        g_page_decompress_prefetch_num << 1;
+    } else {
+        g_page_decompress_prefetch_dropped_num << 1;
+    }
+}
+
 Status ColumnReader::get_row_ranges_by_zone_map(
         const AndBlockColumnPredicate* col_predicates,
         const std::vector<const ColumnPredicate*>* delete_predicates, RowRanges* row_ranges,
@@ -1210,6 +1266,36 @@ Status FileColumnIterator::seek_to_page_start() {
     return seek_to_ordinal(_page.first_ordinal);
 }
 
+Status FileColumnIterator::collect_page_ranges(RowRanges& row_ranges,
+                                               std::vector<io::PrefetchRange>* ranges) {
+    if (row_ranges.is_empty()) {
+        return Status::OK();
+    }
+    OrdinalPageIndexIterator iter;
+    RETURN_IF_ERROR(_reader->seek_at_or_before(row_ranges.from(), &iter, _opts));
+    size_t range_index = 0;
+    for (; iter.valid() && range_index < row_ranges.range_size(); iter.next()) {
+        // skip the row ranges before the page
+        while (range_index < row_ranges.range_size() &&
+               row_ranges.get_range_to(range_index) <= iter.first_ordinal()) {
+            ++range_index;
+        }
+        if (range_index == row_ranges.range_size()) {
+            break;
+        }
+        if (row_ranges.get_range_from(range_index) > iter.last_ordinal()) {
+            continue;
+        }
+        const PagePointer& pp = iter.page();
+        if (!ranges->empty() && ranges->back().end_offset == pp.offset) {
+            ranges->back().end_offset += pp.size;
+        } else {
+            ranges->emplace_back(pp.offset, pp.offset + pp.size);
+        }
+    }
+    return Status::OK();
+}
+
 Status FileColumnIterator::_seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const {
     if (page->offset_in_page == offset_in_page) {
         // fast path, do nothing
@@ -1388,6 +1474,16 @@ Status FileColumnIterator::_load_next_page(bool* eos) {
 
     RETURN_IF_ERROR(_read_data_page(_page_iter));
     RETURN_IF_ERROR(_seek_to_pos_in_page(&_page, 0));
+    // the next page is decompressed while this one is decoded, it's only done for the pages read
+    // in order, whose next page is most likely read soon
+    if (config::enable_page_decompress_prefetch && _opts.use_page_cache &&
+        _compress_codec != nullptr) {
+        auto next_page_iter = _page_iter;
+        next_page_iter.next();
+        if (next_page_iter.valid()) {
+            _reader->prefetch_page(_opts, next_page_iter.page(), _compress_codec);
+        }
+    }
     *eos = false;
     return Status::OK();
 }
@@ -62,6 +62,7 @@ class StorageReadOptions;
 
 namespace io {
 class FileReader;
+struct PrefetchRange;
 } // namespace io
 struct Slice;
 struct StringRef;
@@ -156,6 +157,11 @@ public:
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
                      BlockCompressionCodec* codec) const;
 
+    // read and decompress a page into the page cache on another thread, so the following
+    // read_page of it hits the page cache, or waits for it when it's still being read
+    void prefetch_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
+                       BlockCompressionCodec* codec) const;
+
     bool is_nullable() const { return _meta_is_nullable; }
 
     const EncodingInfo* encoding_info() const { return _encoding_info; }
@@ -390,6 +396,9 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    // Appends the ranges of the data pages which contain any row of `row_ranges` to `ranges`.
+    Status collect_page_ranges(RowRanges& row_ranges, std::vector<io::PrefetchRange>* ranges);
+
 private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
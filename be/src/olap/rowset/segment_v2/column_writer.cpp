@@ -418,6 +418,8 @@ Status ScalarColumnWriter::init() {
 
     PageBuilder* page_builder = nullptr;
 
+    _need_choose_encoding = _opts.adaptive_encoding && config::enable_adaptive_column_encoding &&
+                            _opts.meta->encoding() == DEFAULT_ENCODING;
     RETURN_IF_ERROR(
             EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
@@ -521,6 +523,10 @@ Status ScalarColumnWriter::append_nulls(size_t num_rows) {
 // num_rows must be written before return. And ptr will be modified
 // to next data should be written
 Status ScalarColumnWriter::append_data(const uint8_t** ptr, size_t num_rows) {
+    if (_need_choose_encoding) {
+        _need_choose_encoding = false;
+        RETURN_IF_ERROR(_choose_encoding(*ptr, num_rows));
+    }
     size_t remaining = num_rows;
     while (remaining > 0) {
         size_t num_written = remaining;
@@ -535,6 +541,78 @@ Status ScalarColumnWriter::append_data(const uint8_t** ptr, size_t num_rows) {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_choose_encoding(const uint8_t* data, size_t num_rows) {
+    DCHECK_EQ(_page_builder->count(), 0);
+    PageBuilderOptions opts;
+    opts.data_page_size = _opts.data_page_size;
+    opts.dict_page_size = _opts.dict_page_size;
+    size_t sample_rows =
+            std::min(num_rows, static_cast<size_t>(config::adaptive_column_encoding_sample_rows));
+    // the compressed bytes per value of the sampled page, including the dictionary
+    auto sampled_size = [&](const EncodingInfo* encoding_info, double* size) -> Status {
+        PageBuilder* builder = nullptr;
+        RETURN_IF_ERROR(encoding_info->create_page_builder(opts, &builder));
+        std::unique_ptr<PageBuilder> page_builder(builder);
+        size_t rows = sample_rows;
+        RETURN_IF_ERROR(page_builder->add(data, &rows));
+        if (rows == 0) {
+            return Status::InternalError("no value is sampled");
+        }
+        std::vector<OwnedSlice> pages(1);
+        RETURN_IF_ERROR(page_builder->finish(&pages[0]));
+        if (encoding_info->encoding() == DICT_ENCODING) {
+            RETURN_IF_ERROR(page_builder->get_dictionary_page(&pages.emplace_back()));
+        }
+        size_t total_size = 0;
+        for (const auto& page : pages) {
+            OwnedSlice compressed;
+            RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec,
+                                                       _opts.compression_min_space_saving,
+                                                       {page.slice()}, &compressed));
+            total_size += compressed.slice().empty() ? page.slice().size : compressed.slice().size;
+        }
+        *size = static_cast<double>(total_size) / static_cast<double>(rows);
+        return Status::OK();
+    };
+
+    double default_size = 0;
+    RETURN_IF_ERROR(sampled_size(_encoding_info, &default_size));
+    const EncodingInfo* best = _encoding_info;
+    double best_size = default_size * config::adaptive_column_encoding_max_size_ratio;
+    // PREFIX_ENCODING is left out, its decoder does not read by rowids. PLAIN_ENCODING only
+    // decodes by rowids for strings, which are DICT_ENCODING by default.
+    std::vector<EncodingTypePB> candidates {BIT_SHUFFLE, FOR_ENCODING, RLE, DICT_ENCODING};
+    if (_encoding_info->encoding() == DICT_ENCODING) {
+        candidates.push_back(PLAIN_ENCODING);
+    }
+    for (auto encoding : candidates) {
+        const EncodingInfo* encoding_info = nullptr;
+        if (encoding == _encoding_info->encoding() ||
+            !EncodingInfo::get(get_field()->type_info(), encoding, &encoding_info).ok()) {
+            continue;
+        }
+        double size = 0;
+        RETURN_IF_ERROR(sampled_size(encoding_info, &size));
+        if (size < best_size) {
+            best = encoding_info;
+            best_size = size;
+        }
+    }
+    if (best == _encoding_info) {
+        return Status::OK();
+    }
+
+    VLOG_DEBUG << "choose encoding " << best->encoding() << " instead of "
+               << _encoding_info->encoding() << " for column " << get_field()->name()
+               << ", sampled bytes per value " << best_size << " vs " << default_size;
+    PageBuilder* page_builder = nullptr;
+    RETURN_IF_ERROR(best->create_page_builder(opts, &page_builder));
+    _page_builder.reset(page_builder);
+    _encoding_info = best;
+    _opts.meta->set_encoding(_encoding_info->encoding());
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::_internal_append_data_in_current_page(const uint8_t* data,
                                                                  size_t* num_written) {
     RETURN_IF_ERROR(_page_builder->add(data, num_written));
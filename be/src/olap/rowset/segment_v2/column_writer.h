@@ -58,6 +58,8 @@ struct ColumnWriterOptions {
     // store compressed page only when space saving is above the threshold.
     // space saving = 1 - compressed_size / uncompressed_size
     double compression_min_space_saving = 0.1;
+    // choose the encoding by sampling the first values if the encoding is DEFAULT_ENCODING
+    bool adaptive_encoding = false;
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
@@ -230,6 +232,9 @@ public:
 private:
     Status _internal_append_data_in_current_page(const uint8_t* ptr, size_t* num_written);
 
+    // Replaces the default encoding by the encoding of the smallest sampled page of `data`.
+    Status _choose_encoding(const uint8_t* data, size_t num_rows);
+
 private:
     std::unique_ptr<PageBuilder> _page_builder;
 
@@ -238,6 +243,7 @@ private:
     ColumnWriterOptions _opts;
 
     const EncodingInfo* _encoding_info = nullptr;
+    bool _need_choose_encoding = false;
 
     ordinal_t _next_rowid = 0;
 
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -155,7 +157,55 @@ public:
     }
 
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        // the frames are decoded into the buffer and inserted into the column at once
+        _buffer.resize(to_fetch);
+        if (!_decoder->get_batch(_buffer.data(), to_fetch)) {
+            return Status::Corruption("failed to decode {} values of frame of reference page",
+                                      to_fetch);
+        }
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()), to_fetch);
+        _cur_index += to_fetch;
+        *n = to_fetch;
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            return Status::OK();
+        }
+
+        size_t total = 0;
+        while (total < *n && rowids[total] - page_first_ordinal < _num_elements) {
+            ++total;
+        }
+        if (total == 0) {
+            *n = 0;
+            return Status::OK();
+        }
+        // decode the range of the rowids once, then gather them
+        RETURN_IF_ERROR(seek_to_position_in_page(rowids[0] - page_first_ordinal));
+        size_t range = rowids[total - 1] - rowids[0] + 1;
+        _buffer.resize(range);
+        if (!_decoder->get_batch(_buffer.data(), range)) {
+            return Status::Corruption("failed to decode {} values of frame of reference page",
+                                      range);
+        }
+        _cur_index += range;
+        for (size_t i = 0; i < total; ++i) {
+            _buffer[i] = _buffer[rowids[i] - rowids[0]];
+        }
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()), total);
+        *n = total;
+        return Status::OK();
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
@@ -174,6 +224,7 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    std::vector<CppType> _buffer;
 };
 
 } // namespace segment_v2
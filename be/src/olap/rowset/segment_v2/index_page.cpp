@@ -65,7 +65,8 @@ Status IndexPageBuilder::get_first_key(Slice* key) const {
 ///////////////////////////////////////////////////////////////////////////////
 
 int64_t IndexPageReader::get_metadata_size() const {
-    return sizeof(IndexPageReader) + _footer.ByteSizeLong();
+    return sizeof(IndexPageReader) + _footer.ByteSizeLong() +
+           _fences.capacity() * sizeof(uint64_t) + _fence_idx.capacity() * sizeof(int32_t);
 }
 
 Status IndexPageReader::parse(const Slice& body, const IndexPageFooterPB& footer) {
@@ -90,9 +91,68 @@ Status IndexPageReader::parse(const Slice& body, const IndexPageFooterPB& footer
     _parsed = true;
     return Status::OK();
 }
+void IndexPageReader::build_fence_pointers() {
+    DCHECK(_parsed);
+    size_t n = _keys.size();
+    _fences.assign(n + 1, 0);
+    _fence_idx.assign(n + 1, 0);
+    // the in-order traversal of the implicit tree visits the keys in order
+    size_t idx = 0;
+    size_t k = 1;
+    while (k <= n) {
+        k <<= 1;
+    }
+    k >>= 1;
+    // start from the leftmost node, then walk the tree in order without recursion
+    for (size_t visited = 0; visited < n; visited++) {
+        _fences[k] = fence_of(_keys[idx]);
+        _fence_idx[k] = static_cast<int32_t>(idx++);
+        if (2 * k + 1 <= n) {
+            // go to the leftmost node of the right subtree
+            k = 2 * k + 1;
+            while (2 * k <= n) {
+                k <<= 1;
+            }
+        } else {
+            // go up until coming from a left child
+            while (k & 1) {
+                k >>= 1;
+            }
+            k >>= 1;
+        }
+    }
+    update_metadata_size();
+}
+
+uint64_t IndexPageReader::fence_of(const Slice& key) {
+    uint64_t fence = 0;
+    size_t size = std::min(key.size, sizeof(uint64_t));
+    for (size_t i = 0; i < size; i++) {
+        fence |= static_cast<uint64_t>(static_cast<uint8_t>(key.data[i])) << (56 - 8 * i);
+    }
+    return fence;
+}
+
+int32_t IndexPageReader::fence_lower_bound(uint64_t fence, bool inclusive) const {
+    DCHECK(has_fence_pointers());
+    size_t n = _fences.size() - 1;
+    size_t k = 1;
+    while (k <= n) {
+        // the 8 descendants three levels down share a cache line
+        __builtin_prefetch(_fences.data() + 8 * k);
+        k = 2 * k + (inclusive ? _fences[k] < fence : _fences[k] <= fence);
+    }
+    // drop the right turns after the last left turn, which is where the bound is
+    k >>= __builtin_ffsll(~static_cast<long long>(k));
+    return k == 0 ? static_cast<int32_t>(n) : _fence_idx[k];
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 Status IndexPageIterator::seek_at_or_before(const Slice& search_key) {
+    if (_reader->has_fence_pointers()) {
+        return _seek_by_fences(search_key);
+    }
     int32_t left = 0;
     int32_t right = _reader->count() - 1;
     while (left <= right) {
@@ -119,5 +179,57 @@ Status IndexPageIterator::seek_at_or_before(const Slice& search_key) {
     return Status::OK();
 }
 
+Status IndexPageIterator::_seek_by_fences(const Slice& search_key) {
+    uint64_t fence = IndexPageReader::fence_of(search_key);
+    // the keys before `left` are smaller than search_key, and the keys from `right` on are greater
+    // than it, only the keys with the same prefix need to be compared
+    int32_t left = _reader->fence_lower_bound(fence, true);
+    int32_t right = _reader->fence_lower_bound(fence, false) - 1;
+    int32_t pos = left - 1;
+    while (left <= right) {
+        int32_t mid = left + (right - left) / 2;
+        if (search_key.compare(_reader->get_key(mid)) < 0) {
+            right = mid - 1;
+        } else {
+            pos = mid;
+            left = mid + 1;
+        }
+    }
+    if (pos < 0) {
+        return Status::Error<ErrorCode::ENTRY_NOT_FOUND>(
+                "given key is smaller than all keys in page");
+    }
+    _pos = pos;
+    return Status::OK();
+}
+
+Status IndexPageIterator::seek_forward_at_or_before(const Slice& search_key) {
+    auto count = static_cast<int32_t>(_reader->count());
+    auto pos = static_cast<int32_t>(_pos);
+    if (pos >= count || search_key.compare(_reader->get_key(pos)) < 0) {
+        return seek_at_or_before(search_key);
+    }
+    // keys[pos] <= search_key, find the bound whose key is > search_key by doubling the step
+    int32_t step = 1;
+    while (pos + step < count && search_key.compare(_reader->get_key(pos + step)) >= 0) {
+        pos += step;
+        step <<= 1;
+    }
+    // the result is in [pos, min(pos + step, count) - 1]
+    int32_t left = pos + 1;
+    int32_t right = std::min(pos + step, count) - 1;
+    while (left <= right) {
+        int32_t mid = left + (right - left) / 2;
+        if (search_key.compare(_reader->get_key(mid)) < 0) {
+            right = mid - 1;
+        } else {
+            pos = mid;
+            left = mid + 1;
+        }
+    }
+    _pos = pos;
+    return Status::OK();
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -110,6 +110,20 @@ public:
 
     void reset();
 
+    // Build the fence pointers, which are the 8 bytes big endian prefixes of the keys in the
+    // Eytzinger (BFS) layout, so a search touches one cache line every three levels instead of
+    // the keys scattered in the page body.
+    void build_fence_pointers();
+
+    bool has_fence_pointers() const { return !_fences.empty(); }
+
+    // The prefix of `key` which the fence pointers are compared with, padded with zeros.
+    static uint64_t fence_of(const Slice& key);
+
+    // Return the index of the first key whose fence is >= `fence` if `inclusive`, or > `fence`
+    // otherwise, count() if there's no such key.
+    int32_t fence_lower_bound(uint64_t fence, bool inclusive) const;
+
 private:
     int64_t get_metadata_size() const override;
 
@@ -118,6 +132,9 @@ private:
     IndexPageFooterPB _footer;
     std::vector<Slice> _keys;
     std::vector<PagePointer> _values;
+    // 1-based Eytzinger layout, _fence_idx maps a position in it to the index of the key
+    std::vector<uint64_t> _fences;
+    std::vector<int32_t> _fence_idx;
 };
 
 class IndexPageIterator {
@@ -130,6 +147,11 @@ public:
     // Return other error status otherwise.
     Status seek_at_or_before(const Slice& search_key);
 
+    // Same as seek_at_or_before(), but when search_key is not smaller than the current key,
+    // gallop forward from the current entry instead of searching the whole page, so a series
+    // of seeks with ascending keys costs O(log(distance)) each.
+    Status seek_forward_at_or_before(const Slice& search_key);
+
     void seek_to_first() { _pos = 0; }
 
     // Move to the next index entry.
@@ -150,6 +172,8 @@ public:
     const PagePointer& current_page_pointer() const { return _reader->get_value(_pos); }
 
 private:
+    Status _seek_by_fences(const Slice& search_key);
+
     const IndexPageReader* _reader = nullptr;
 
     size_t _pos;
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/io_common.h"
 #include "olap/key_coder.h"
@@ -91,6 +92,10 @@ Status IndexedColumnReader::load(bool use_page_cache, bool kept_in_memory,
             RETURN_IF_ERROR(load_index_page(_meta.value_index_meta().root_page(),
                                             &_value_index_page_handle, _value_index_reader.get(),
                                             index_load_stats));
+            if (_is_pk_index && config::enable_pk_index_fence_pointers) {
+                _value_index_reader->build_fence_pointers();
+                _mem_size += _value_index_reader->count() * (sizeof(uint64_t) + sizeof(int32_t));
+            }
             _has_index_page = true;
         }
     }
@@ -225,7 +230,11 @@ Status IndexedColumnIterator::seek_at_or_after(const void* key, bool* exact_matc
         // seek index to determine the data page to seek
         std::string encoded_key;
         _reader->_value_key_coder->full_encode_ascending(key, &encoded_key);
-        Status st = _value_iter.seek_at_or_before(encoded_key);
+        // the iterator is reused by the lookups of sorted keys, e.g. when calculating the
+        // delete bitmap, so search forward from the last sought index entry
+        Status st = _current_iter == &_value_iter
+                            ? _value_iter.seek_forward_at_or_before(encoded_key)
+                            : _value_iter.seek_at_or_before(encoded_key);
         if (st.is<ENTRY_NOT_FOUND>()) {
             // all keys in page is greater than `encoded_key`, point to the first page.
             // otherwise, we may missing some pages.
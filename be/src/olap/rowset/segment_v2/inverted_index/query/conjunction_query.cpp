@@ -17,6 +17,8 @@
 
 #include "conjunction_query.h"
 
+#include "olap/olap_common.h"
+
 namespace doris::segment_v2 {
 
 ConjunctionQuery::ConjunctionQuery(const std::shared_ptr<lucene::search::IndexSearcher>& searcher,
@@ -78,44 +80,94 @@ void ConjunctionQuery::search(roaring::Roaring& roaring) {
     search_by_skiplist(roaring);
 }
 
-void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
-    // can get a term of all doc_id
-    auto func = [&roaring](const TermIterPtr& term_docs, bool first) {
-        roaring::Roaring result;
-        DocRange doc_range;
-        while (term_docs->read_range(&doc_range)) {
-            if (doc_range.type_ == DocRangeType::kMany) {
-                result.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
-            } else {
-                result.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
-            }
-        }
-        if (first) {
-            roaring.swap(result);
+void ConjunctionQuery::collect_statistics(OlapReaderStatistics* stats) const {
+    stats->inverted_index_conjunction_bitmap_terms += _bitmap_terms;
+    stats->inverted_index_conjunction_skip_terms += _skip_terms;
+}
+
+namespace {
+
+// fill `result` with all the docs of a term
+void read_bitmap(const TermIterPtr& term_docs, roaring::Roaring* result) {
+    DocRange doc_range;
+    while (term_docs->read_range(&doc_range)) {
+        if (doc_range.type_ == DocRangeType::kMany) {
+            result->addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
         } else {
-            roaring &= result;
+            result->addRange(doc_range.doc_range.first, doc_range.doc_range.second);
         }
-    };
+    }
+}
 
+} // namespace
+
+void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
     // fill the bitmap for the first time
-    func(_lead1, true);
+    read_bitmap(_lead1, &roaring);
+    ++_bitmap_terms;
 
     // the second inverted list may be empty
     if (_lead2 != nullptr) {
-        func(_lead2, false);
+        intersect(_lead2, roaring);
     }
 
     // The inverted index iterators contained in the _others array must not be empty
     for (auto& other : _others) {
-        func(other, false);
+        intersect(other, roaring);
     }
 }
 
+void ConjunctionQuery::intersect(const TermIterPtr& term_docs, roaring::Roaring& roaring) {
+    // the rest of the terms can't match any doc
+    if (roaring.isEmpty()) {
+        return;
+    }
+    // The intersection gets sparser with each term, so the frequent terms at the end are often
+    // much denser than it. Then the docs of the intersection are looked up by the skip list of
+    // the term, instead of decoding all the postings of the term.
+    if (_index_version == IndexVersion::kV1 &&
+        static_cast<uint64_t>(term_docs->doc_freq()) >
+                roaring.cardinality() * static_cast<uint64_t>(_conjunction_ratio)) {
+        std::vector<uint32_t> docs;
+        int32_t cur = -1;
+        for (uint32_t doc : roaring) {
+            if (cur < static_cast<int32_t>(doc)) {
+                cur = term_docs->advance(doc);
+                if (cur == INT32_MAX) {
+                    break;
+                }
+            }
+            if (cur == static_cast<int32_t>(doc)) {
+                docs.push_back(doc);
+            }
+        }
+        roaring::Roaring result;
+        result.addMany(docs.size(), docs.data());
+        roaring.swap(result);
+        ++_skip_terms;
+        return;
+    }
+    roaring::Roaring result;
+    read_bitmap(term_docs, &result);
+    roaring &= result;
+    ++_bitmap_terms;
+}
+
 void ConjunctionQuery::search_by_skiplist(roaring::Roaring& roaring) {
+    // the docs come in ascending order, so they are added to the bitmap in batches
+    constexpr size_t BATCH_SIZE = 1024;
+    std::vector<uint32_t> docs;
+    docs.reserve(BATCH_SIZE);
     int32_t doc = 0;
     while ((doc = do_next(_lead1->next_doc())) != INT32_MAX) {
-        roaring.add(doc);
+        docs.push_back(doc);
+        if (docs.size() == BATCH_SIZE) {
+            roaring.addMany(docs.size(), docs.data());
+            docs.clear();
+        }
     }
+    roaring.addMany(docs.size(), docs.data());
+    _skip_terms += 1 + _others.size();
 }
 
 int32_t ConjunctionQuery::do_next(int32_t doc) {
@@ -32,11 +32,16 @@ public:
 
     void add(const InvertedIndexQueryInfo& query_info) override;
     void search(roaring::Roaring& roaring) override;
+    void collect_statistics(OlapReaderStatistics* stats) const override;
 
 private:
     void search_by_bitmap(roaring::Roaring& roaring);
     void search_by_skiplist(roaring::Roaring& roaring);
 
+    // intersect `roaring` with the docs of `term_docs`, by skipping to each doc of `roaring` if it
+    // has much less docs than the term, otherwise by the bitmap of all the docs of the term
+    void intersect(const TermIterPtr& term_docs, roaring::Roaring& roaring);
+
     int32_t do_next(int32_t doc);
 
 public:
@@ -50,6 +55,10 @@ public:
     TermIterPtr _lead1;
     TermIterPtr _lead2;
     std::vector<TermIterPtr> _others;
+
+    // the number of terms intersected by bitmaps and by skip lists
+    int64_t _bitmap_terms = 0;
+    int64_t _skip_terms = 0;
 };
 
 } // namespace doris::segment_v2
\ No newline at end of file
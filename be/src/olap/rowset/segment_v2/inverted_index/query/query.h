@@ -35,6 +35,10 @@ CL_NS_USE(index)
 CL_NS_USE(search)
 CL_NS_USE(util)
 
+namespace doris {
+struct OlapReaderStatistics;
+} // namespace doris
+
 namespace doris::segment_v2 {
 
 class Query {
@@ -49,6 +53,9 @@ public:
     // a unified query interface for retrieving the ids obtained from the search.
     // @param roaring a Roaring bitmap to be populated with the search results,
     virtual void search(roaring::Roaring& roaring) = 0;
+
+    // add the statistics of the last search to `stats`
+    virtual void collect_statistics(OlapReaderStatistics* stats) const {}
 };
 
 } // namespace doris::segment_v2
\ No newline at end of file
@@ -80,10 +80,20 @@ bool BooleanQuery::should_use_skip() {
 void BooleanQuery::search_by_skiplist(const std::shared_ptr<roaring::Roaring>& result) {
     auto _next_doc = [](const auto& node) { return node->next_doc(); };
 
+    // the docs come in ascending order, so they are added to the bitmap in batches, which appends
+    // them to the containers without looking up the container of each doc
+    constexpr size_t BATCH_SIZE = 1024;
+    std::vector<uint32_t> docs;
+    docs.reserve(BATCH_SIZE);
     int32_t doc = 0;
     while ((doc = visit_node(_op, _next_doc)) != INT32_MAX) {
-        result->add(doc);
+        docs.push_back(doc);
+        if (docs.size() == BATCH_SIZE) {
+            result->addMany(docs.size(), docs.data());
+            docs.clear();
+        }
     }
+    result->addMany(docs.size(), docs.data());
 }
 
 void BooleanQuery::search_by_bitmap(const std::shared_ptr<roaring::Roaring>& result) {}
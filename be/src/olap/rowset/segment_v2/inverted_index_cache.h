@@ -22,8 +22,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
 #include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <roaring/roaring.hh>
 #include <string>
 
@@ -96,9 +99,19 @@ public:
 
     int64_t mem_consumption();
 
+    // The searchers of the same index are opened one at a time, so the queries missing a cold
+    // index at the same time wait for the first one to open it, instead of each reading its term
+    // dictionary again, which is expensive on remote storage.
+    std::mutex& open_mutex(const InvertedIndexSearcherCache::CacheKey& key) {
+        return _open_mutexes[std::hash<std::string> {}(key.index_file_path) % OPEN_MUTEX_NUM];
+    }
+
 private:
     InvertedIndexSearcherCache() = default;
 
+    static constexpr size_t OPEN_MUTEX_NUM = 1024;
+    std::array<std::mutex, OPEN_MUTEX_NUM> _open_mutexes;
+
     class InvertedIndexSearcherCachePolicy : public LRUCachePolicy {
     public:
         InvertedIndexSearcherCachePolicy(size_t capacity, uint32_t num_shards,
@@ -203,6 +203,17 @@ Status InvertedIndexReader::handle_searcher_cache(
         stats->inverted_index_searcher_cache_hit++;
         return Status::OK();
     } else {
+        std::unique_lock<std::mutex> open_lock;
+        if (query_options.enable_inverted_index_searcher_cache) {
+            open_lock = std::unique_lock(
+                    InvertedIndexSearcherCache::instance()->open_mutex(searcher_cache_key));
+            // the searcher may be opened by another query while waiting for the lock
+            if (InvertedIndexSearcherCache::instance()->lookup(searcher_cache_key,
+                                                               inverted_index_cache_handle)) {
+                stats->inverted_index_searcher_cache_hit++;
+                return Status::OK();
+            }
+        }
         DBUG_EXECUTE_IF("InvertedIndexReader.handle_searcher_cache_miss", {
             return Status::Error<ErrorCode::INTERNAL_ERROR>("handle searcher cache miss");
         });
@@ -294,6 +305,7 @@ Status InvertedIndexReader::match_index_search(
             SCOPED_RAW_TIMER(&stats->inverted_index_searcher_search_exec_timer);
             query->search(*term_match_bitmap);
         }
+        query->collect_statistics(stats);
     } catch (const CLuceneError& e) {
         return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>("CLuceneError occured: {}",
                                                                       e.what());
@@ -17,14 +17,19 @@
 
 #include "olap/rowset/segment_v2/page_io.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "cloud/config.h"
@@ -42,12 +47,81 @@
 #include "util/block_compression.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
 namespace segment_v2 {
 
+namespace {
+
+bvar::Adder<int64_t> g_page_cache_single_flight_wait_num("page_cache_single_flight_wait_num");
+
+// The pages being read into the page cache.
+class InflightPages {
+public:
+    // Return true if the caller reads the page and must call end(), otherwise wait until the
+    // reader of the page ends.
+    bool begin_or_wait(const std::string& key) {
+        auto& shard = _shards[std::hash<std::string>()(key) % SHARD_NUM];
+        std::unique_lock l(shard.mutex);
+        if (shard.keys.insert(key).second) {
+            return true;
+        }
+        g_page_cache_single_flight_wait_num << 1;
+        shard.cv.wait(l, [&]() { return !shard.keys.contains(key); });
+        return false;
+    }
+
+    void end(const std::string& key) {
+        auto& shard = _shards[std::hash<std::string>()(key) % SHARD_NUM];
+        std::lock_guard l(shard.mutex);
+        shard.keys.erase(key);
+        shard.cv.notify_all();
+    }
+
+private:
+    static constexpr size_t SHARD_NUM = 64;
+    struct Shard {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::unordered_set<std::string> keys;
+    };
+    std::array<Shard, SHARD_NUM> _shards;
+};
+
+InflightPages g_inflight_pages;
+
+// Return true if the page is found in the page cache.
+Status lookup_page_cache(const PageReadOptions& opts, StoragePageCache* cache,
+                         const StoragePageCache::CacheKey& cache_key, PageHandle* handle,
+                         Slice* body, PageFooterPB* footer, bool* found) {
+    PageCacheHandle cache_handle;
+    *found = cache->lookup(cache_key, &cache_handle, opts.type);
+    if (!*found) {
+        return Status::OK();
+    }
+    // we find page in cache, use it
+    *handle = PageHandle(std::move(cache_handle));
+    opts.stats->cached_pages_num++;
+    // parse body and footer
+    Slice page_slice = handle->data();
+    opts.stats->cached_pages_bytes += page_slice.size;
+    uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+    std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
+    if (!footer->ParseFromString(footer_buf)) {
+        return Status::Corruption("Bad page: invalid footer, footer_size={}, file={}", footer_size,
+                                  opts.file_reader->path().native());
+    }
+    *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
+    // If read from cache, then should also recorded in uncompressed bytes read counter.
+    opts.stats->uncompressed_bytes_read += body->size;
+    return Status::OK();
+}
+
+} // namespace
+
 Status PageIO::compress_page_body(BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, OwnedSlice* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -133,23 +207,34 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                          opts.file_reader->size(), opts.page_pointer.offset);
     VLOG_DEBUG << fmt::format("Reading page {}:{}:{}", cache_key.fname, cache_key.fsize,
                               cache_key.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
-        // we find page in cache, use it
-        *handle = PageHandle(std::move(cache_handle));
-        opts.stats->cached_pages_num++;
-        // parse body and footer
-        Slice page_slice = handle->data();
-        uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
-        if (!footer->ParseFromString(footer_buf)) {
-            return Status::Corruption("Bad page: invalid footer, footer_size={}, file={}",
-                                      footer_size, opts.file_reader->path().native());
-        }
-        *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-        // If read from cache, then should also recorded in uncompressed bytes read counter.
-        opts.stats->uncompressed_bytes_read += body->size;
+    bool found = false;
+    if (opts.use_page_cache && cache) {
+        RETURN_IF_ERROR(lookup_page_cache(opts, cache, cache_key, handle, body, footer, &found));
+    }
+    if (found) {
         return Status::OK();
     }
+    // Only one reader reads a page at a time, the others look up the page cache again after
+    // it's read, and read the page by themselves if it's still not there, for example it's
+    // only kept in the compressed page cache.
+    std::string inflight_key;
+    Defer end_inflight {[&]() {
+        if (!inflight_key.empty()) {
+            g_inflight_pages.end(inflight_key);
+        }
+    }};
+    if (opts.use_page_cache && cache && config::enable_page_cache_single_flight) {
+        std::string key = cache_key.encode();
+        if (g_inflight_pages.begin_or_wait(key)) {
+            inflight_key = std::move(key);
+        } else {
+            RETURN_IF_ERROR(
+                    lookup_page_cache(opts, cache, cache_key, handle, body, footer, &found));
+            if (found) {
+                return Status::OK();
+            }
+        }
+    }
 
     // every page contains 4 bytes footer length and 4 bytes checksum
     const uint32_t page_size = opts.page_pointer.size;
@@ -162,7 +247,15 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     std::unique_ptr<DataPage> page =
             std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
     Slice page_slice(page->data(), page_size);
-    {
+    PageCacheHandle compressed_handle;
+    bool from_compressed_cache = opts.use_page_cache && cache &&
+                                 cache->lookup_compressed(cache_key, &compressed_handle) &&
+                                 compressed_handle.data().size == page_size;
+    if (from_compressed_cache) {
+        // the bytes are verified when they are read from the file
+        memcpy(page_slice.data, compressed_handle.data().data, page_size);
+        opts.stats->compressed_cached_pages_num++;
+    } else {
         SCOPED_RAW_TIMER(&opts.stats->io_ns);
         size_t bytes_read = 0;
         RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
@@ -171,7 +264,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         opts.stats->compressed_bytes_read += page_size;
     }
 
-    if (opts.verify_checksum) {
+    if (opts.verify_checksum && !from_compressed_cache) {
         uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
         InjectionContext ctx = {&actual, const_cast<PageReadOptions*>(&opts)};
@@ -194,15 +287,24 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     }
 
     uint32_t body_size = page_slice.size - 4 - footer_size;
+    // whether the decompressed page is inserted into the page cache
+    bool use_page_cache = opts.use_page_cache && cache;
     if (body_size != footer->uncompressed_size()) { // need decompress body
         if (opts.codec == nullptr) {
             return Status::Corruption(
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file={}",
                     opts.file_reader->path().native());
         }
+        // The compressed page read from the file is only kept in the compressed page cache,
+        // it's decompressed into the page cache when it's read again.
+        if (use_page_cache && !from_compressed_cache && !opts.kept_in_memory && !opts.prefetch &&
+            cache->has_compressed_page_cache()) {
+            cache->insert_compressed(cache_key, Slice(page->data(), page_size));
+            use_page_cache = false;
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         std::unique_ptr<DataPage> decompressed_page = std::make_unique<DataPage>(
-                footer->uncompressed_size() + footer_size + 4, opts.use_page_cache, opts.type);
+                footer->uncompressed_size() + footer_size + 4, use_page_cache, opts.type);
 
         // decompress page body
         Slice compressed_body(page_slice.data, body_size);
@@ -230,13 +332,13 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         if (pre_decoder) {
             RETURN_IF_ERROR(pre_decoder->decode(
                     &page, &page_slice, footer->data_page_footer().nullmap_size() + footer_size + 4,
-                    opts.use_page_cache, opts.type));
+                    use_page_cache, opts.type));
         }
     }
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
     page->reset_size(page_slice.size);
-    if (opts.use_page_cache && cache) {
+    if (use_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page.get(), &cache_handle, opts.type, opts.kept_in_memory);
         *handle = PageHandle(std::move(cache_handle));
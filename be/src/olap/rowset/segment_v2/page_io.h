@@ -55,6 +55,9 @@ struct PageReadOptions {
     bool kept_in_memory = false;
     // index_page should not be pre-decoded
     bool pre_decode = true;
+    // the page is read ahead for a reader on another thread, so it's decompressed into the page
+    // cache directly instead of being kept in the compressed page cache
+    bool prefetch = false;
     // for page cache allocation
     // page types are divided into DATA_PAGE & INDEX_PAGE
     // INDEX_PAGE including index_page, dict_page and short_key_page
@@ -89,6 +92,7 @@ struct PageReadOptions {
         type = old.type;
         encoding_info = old.encoding_info;
         pre_decode = old.pre_decode;
+        prefetch = old.prefetch;
     }
 };
 
@@ -234,14 +234,15 @@ public:
         }
 
         size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
-        size_t remaining = to_fetch;
-        bool result = false;
-        CppType value;
-        while (remaining > 0) {
-            result = _rle_decoder.Get(&value);
-            DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
-            remaining--;
+        // decode the runs a batch at a time and insert each batch at once, instead of a virtual
+        // insert_data call per value
+        CppType values[DECODE_BATCH_SIZE];
+        for (size_t remaining = to_fetch; remaining > 0;) {
+            size_t batch = std::min(remaining, DECODE_BATCH_SIZE);
+            size_t decoded = _rle_decoder.get_values(values, batch);
+            DCHECK_EQ(decoded, batch);
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(values), batch);
+            remaining -= batch;
         }
 
         _cur_index += to_fetch;
@@ -260,22 +261,28 @@ public:
         auto total = *n;
         bool result = false;
         size_t read_count = 0;
-        CppType value;
+        CppType values[DECODE_BATCH_SIZE];
+        size_t num_values = 0;
         for (size_t i = 0; i < total; ++i) {
             ordinal_t ord = rowids[i] - page_first_ordinal;
             if (UNLIKELY(ord >= _num_elements)) {
-                *n = read_count;
-                return Status::OK();
+                break;
             }
 
             _rle_decoder.Skip(ord - _cur_index);
             _cur_index = ord;
 
-            result = _rle_decoder.Get(&value);
+            result = _rle_decoder.Get(&values[num_values++]);
             _cur_index++;
             DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
             read_count++;
+            if (num_values == DECODE_BATCH_SIZE) {
+                dst->insert_many_fix_len_data(reinterpret_cast<const char*>(values), num_values);
+                num_values = 0;
+            }
+        }
+        if (num_values > 0) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(values), num_values);
         }
         *n = read_count;
         return Status::OK();
@@ -288,6 +295,7 @@ public:
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
     enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    static constexpr size_t DECODE_BATCH_SIZE = 256;
 
     Slice _data;
     PageDecoderOptions _options;
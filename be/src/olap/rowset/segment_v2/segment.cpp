@@ -49,6 +49,7 @@
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/rowset/segment_v2/segment_footer_store.h"
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h" // k_segment_magic_length
 #include "olap/rowset/segment_v2/stream_reader.h"
@@ -266,15 +267,16 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             auto runtime_predicate = query_ctx->get_runtime_predicate(id).get_predicate(
                     read_options.topn_filter_target_node_id);
 
-            int32_t uid =
-                    read_options.tablet_schema->column(runtime_predicate->column_id()).unique_id();
+            // the zone map of an extracted column of variant is in the subcolumn tree
+            ColumnReader* reader = _get_column_reader(
+                    read_options.tablet_schema->column(runtime_predicate->column_id()));
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            if (reader != nullptr && reader->has_zone_map() &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -400,6 +402,18 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
                                   file_cache_key_str(_file_reader->path().native()));
     }
 
+    // the footer persisted before restart
+    auto* footer_store = SegmentFooterStore::instance();
+    if (footer_store != nullptr) {
+        std::string footer_buf;
+        if (footer_store->lookup(_file_reader->path().native(), file_size, &footer_buf)) {
+            footer = std::make_shared<SegmentFooterPB>();
+            if (footer->ParseFromString(footer_buf)) {
+                return Status::OK();
+            }
+        }
+    }
+
     uint8_t fixed_buf[12];
     size_t bytes_read = 0;
     // TODO(plat1ko): Support session variable `enable_file_cache`
@@ -471,6 +485,9 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
                 file_cache_key_str(_file_reader->path().native()));
     }
 
+    if (footer_store != nullptr) {
+        footer_store->insert(_file_reader->path().native(), file_size, footer_buf);
+    }
     VLOG_DEBUG << fmt::format("Loading segment footer from {} finished",
                               _file_reader->path().native());
     return Status::OK();
@@ -977,7 +994,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
 
 Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
-                               OlapReaderStatistics* stats, std::string* encoded_seq_value) {
+                               OlapReaderStatistics* stats, std::string* encoded_seq_value,
+                               std::unique_ptr<IndexedColumnIterator>* index_iterator) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
@@ -996,16 +1014,22 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
-    auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_index_iterator;
+    if (index_iterator == nullptr) {
+        index_iterator = &local_index_iterator;
+    }
+    if (*index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(index_iterator, stats));
+    }
+    auto& iter = *index_iterator;
+    auto st = iter->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
     }
     if (st.is<ErrorCode::ENTRY_NOT_FOUND>() || (!has_seq_col && !has_rowid && !exact_match)) {
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
-    row_location->row_id = index_iterator->get_current_ordinal();
+    row_location->row_id = iter->get_current_ordinal();
     row_location->segment_id = _segment_id;
     row_location->rowset_id = _rowset_id;
 
@@ -1014,7 +1038,7 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
             _pk_index_reader->type_info()->type(), 1, 0);
     auto index_column = index_type->create_column();
     size_t num_read = num_to_read;
-    RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
+    RETURN_IF_ERROR(iter->next_batch(&num_read, index_column));
     DCHECK(num_to_read == num_read);
 
     Slice sought_key = Slice(index_column->get_data_at(0).data, index_column->get_data_at(0).size);
@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_store.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "common/logging.h"
+#include "runtime/exec_env.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace doris {
+namespace segment_v2 {
+
+namespace {
+
+// KeyLength and FooterLength
+constexpr size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t RECORD_CHECKSUM_SIZE = sizeof(uint32_t);
+
+} // namespace
+
+SegmentFooterStore::SegmentFooterStore(const std::vector<std::string>& dirs,
+                                       int64_t max_file_size)
+        : _max_file_size(max_file_size) {
+    for (const auto& dir : dirs) {
+        auto file = std::make_unique<StoreFile>();
+        file->dir = dir;
+        _files.push_back(std::move(file));
+    }
+}
+
+SegmentFooterStore::~SegmentFooterStore() {
+    for (auto& file : _files) {
+        if (file->mapped != nullptr) {
+            munmap(const_cast<char*>(file->mapped), file->mapped_size);
+        }
+        if (file->fd >= 0) {
+            close(file->fd);
+        }
+    }
+}
+
+SegmentFooterStore* SegmentFooterStore::instance() {
+    return ExecEnv::GetInstance()->get_segment_footer_store();
+}
+
+bool SegmentFooterStore::lookup(const std::string& segment_path, uint64_t segment_size,
+                                std::string* footer) {
+    StoreFile* file = _file_of(segment_path);
+    if (file == nullptr) {
+        return false;
+    }
+    std::string key = _key(segment_path, segment_size);
+    std::lock_guard l(file->mutex);
+    if (!file->loaded) {
+        Status st = _load(file);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to load segment footer store in " << file->dir << ": " << st;
+        }
+    }
+    auto it = file->index.find(key);
+    if (it == file->index.end()) {
+        return false;
+    }
+    const Entry& entry = it->second;
+    std::string record(entry.key_length + entry.footer_length + RECORD_CHECKSUM_SIZE, '\0');
+    Status st = _read(file, entry.offset + RECORD_HEADER_SIZE, record.size(), record.data());
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to read segment footer store in " << file->dir << ": " << st;
+        return false;
+    }
+    size_t checksum_offset = entry.key_length + entry.footer_length;
+    uint32_t expect = decode_fixed32_le(reinterpret_cast<const uint8_t*>(record.data()) +
+                                        checksum_offset);
+    if (crc32c::Value(record.data(), checksum_offset) != expect ||
+        record.compare(0, entry.key_length, key) != 0) {
+        LOG(WARNING) << "bad record of segment " << segment_path << " in segment footer store in "
+                     << file->dir;
+        file->index.erase(it);
+        return false;
+    }
+    footer->assign(record.data() + entry.key_length, entry.footer_length);
+    return true;
+}
+
+void SegmentFooterStore::insert(const std::string& segment_path, uint64_t segment_size,
+                                const std::string& footer) {
+    StoreFile* file = _file_of(segment_path);
+    if (file == nullptr) {
+        return;
+    }
+    std::string key = _key(segment_path, segment_size);
+    std::string record;
+    record.reserve(RECORD_HEADER_SIZE + key.size() + footer.size() + RECORD_CHECKSUM_SIZE);
+    put_fixed32_le(&record, static_cast<uint32_t>(key.size()));
+    put_fixed32_le(&record, static_cast<uint32_t>(footer.size()));
+    record.append(key);
+    record.append(footer);
+    put_fixed32_le(&record, crc32c::Value(record.data() + RECORD_HEADER_SIZE,
+                                          key.size() + footer.size()));
+
+    std::lock_guard l(file->mutex);
+    if (!file->loaded) {
+        Status st = _load(file);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to load segment footer store in " << file->dir << ": " << st;
+        }
+    }
+    if (file->fd < 0 || file->index.contains(key) ||
+        file->size + record.size() > static_cast<uint64_t>(_max_file_size)) {
+        return;
+    }
+    ssize_t written = pwrite(file->fd, record.data(), record.size(), file->size);
+    if (written != static_cast<ssize_t>(record.size())) {
+        LOG(WARNING) << "failed to write segment footer store in " << file->dir << ": "
+                     << std::strerror(errno);
+        // the torn record is overwritten by the next one, or dropped by the next load
+        return;
+    }
+    file->index[key] = {file->size, static_cast<uint32_t>(key.size()),
+                        static_cast<uint32_t>(footer.size())};
+    file->size += record.size();
+}
+
+std::string SegmentFooterStore::_key(const std::string& segment_path, uint64_t segment_size) {
+    std::string key(segment_path);
+    put_fixed64_le(&key, segment_size);
+    return key;
+}
+
+SegmentFooterStore::StoreFile* SegmentFooterStore::_file_of(const std::string& segment_path) {
+    if (_files.empty()) {
+        return nullptr;
+    }
+    for (auto& file : _files) {
+        if (segment_path.starts_with(file->dir) &&
+            (file->dir.ends_with('/') || segment_path[file->dir.size()] == '/')) {
+            return file.get();
+        }
+    }
+    return _files.front().get();
+}
+
+Status SegmentFooterStore::_load(StoreFile* file) {
+    file->loaded = true;
+    std::string path = file->dir + "/" + FILE_NAME;
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return Status::IOError("failed to open {}: {}", path, std::strerror(errno));
+    }
+    struct stat statbuf;
+    if (fstat(fd, &statbuf) < 0) {
+        Status st = Status::IOError("failed to stat {}: {}", path, std::strerror(errno));
+        close(fd);
+        return st;
+    }
+    auto file_size = static_cast<uint64_t>(statbuf.st_size);
+    if (file_size > static_cast<uint64_t>(_max_file_size)) {
+        // start over to drop the stale records
+        file_size = 0;
+    }
+    if (file_size > 0) {
+        void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED) {
+            Status st = Status::IOError("failed to mmap {}: {}", path, std::strerror(errno));
+            close(fd);
+            return st;
+        }
+        file->mapped = static_cast<const char*>(mapped);
+        file->mapped_size = file_size;
+    }
+
+    // only the lengths are read here, the checksum of a record is verified when it's looked up
+    uint64_t offset = 0;
+    while (offset + RECORD_HEADER_SIZE <= file_size) {
+        const auto* header = reinterpret_cast<const uint8_t*>(file->mapped + offset);
+        uint32_t key_length = decode_fixed32_le(header);
+        uint32_t footer_length = decode_fixed32_le(header + sizeof(uint32_t));
+        uint64_t record_size = RECORD_HEADER_SIZE + static_cast<uint64_t>(key_length) +
+                               footer_length + RECORD_CHECKSUM_SIZE;
+        if (offset + record_size > file_size) {
+            break;
+        }
+        std::string key(file->mapped + offset + RECORD_HEADER_SIZE, key_length);
+        file->index[std::move(key)] = {offset, key_length, footer_length};
+        offset += record_size;
+    }
+    if (offset != static_cast<uint64_t>(statbuf.st_size) && ftruncate(fd, offset) != 0) {
+        Status st = Status::IOError("failed to truncate {}: {}", path, std::strerror(errno));
+        file->index.clear();
+        close(fd);
+        return st;
+    }
+    file->fd = fd;
+    file->size = offset;
+    LOG(INFO) << "loaded " << file->index.size() << " segment footers from " << path;
+    return Status::OK();
+}
+
+Status SegmentFooterStore::_read(StoreFile* file, uint64_t offset, size_t size, char* buf) {
+    if (offset + size <= file->mapped_size) {
+        memcpy(buf, file->mapped + offset, size);
+        return Status::OK();
+    }
+    ssize_t bytes_read = pread(file->fd, buf, size, offset);
+    if (bytes_read != static_cast<ssize_t>(size)) {
+        return Status::IOError("failed to read {} bytes at {}: {}", size, offset,
+                               std::strerror(errno));
+    }
+    return Status::OK();
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// Keeps the serialized segment footers in a file of each data dir, so after a restart the footers
+// of the segments opened before are not read again from the segment files, which may be remote.
+//
+// The file is an append only log:
+//
+// File := Record^N
+// Record := KeyLength(uint32_t), FooterLength(uint32_t), Key, Footer, Checksum(uint32_t)
+//
+// Key is the path and the size of the segment file, the path contains the rowset id, so a record
+// is never used for another rowset, and the records of the deleted rowsets are just not looked up
+// any more. Checksum is the crc32c of Key and Footer.
+//
+// The file is mapped and indexed on the first access, and the records appended later are read
+// by pread. The records are not appended any more when the file reaches max_file_size, and the
+// file is started over on the next load, which drops the stale records.
+class SegmentFooterStore {
+public:
+    static constexpr const char* FILE_NAME = "segment_footer_store";
+
+    SegmentFooterStore(const std::vector<std::string>& dirs, int64_t max_file_size);
+    ~SegmentFooterStore();
+
+    // Return the global instance, nullptr if it's disabled.
+    static SegmentFooterStore* instance();
+
+    // Return false if the footer is not found or broken.
+    bool lookup(const std::string& segment_path, uint64_t segment_size, std::string* footer);
+
+    // `footer` must be verified by the checksum in the segment file.
+    void insert(const std::string& segment_path, uint64_t segment_size, const std::string& footer);
+
+private:
+    struct Entry {
+        uint64_t offset; // offset of the record
+        uint32_t key_length;
+        uint32_t footer_length;
+    };
+
+    struct StoreFile {
+        std::string dir;
+        std::mutex mutex;
+        bool loaded = false;
+        int fd = -1;
+        const char* mapped = nullptr;
+        size_t mapped_size = 0;
+        // the end of the valid records
+        uint64_t size = 0;
+        std::unordered_map<std::string, Entry> index;
+    };
+
+    static std::string _key(const std::string& segment_path, uint64_t segment_size);
+
+    // The file of the data dir `segment_path` is in, or the first one for a remote segment.
+    StoreFile* _file_of(const std::string& segment_path);
+
+    Status _load(StoreFile* file);
+
+    Status _read(StoreFile* file, uint64_t offset, size_t size, char* buf);
+
+    int64_t _max_file_size;
+    std::vector<std::unique_ptr<StoreFile>> _files;
+};
+
+} // namespace segment_v2
+} // namespace doris
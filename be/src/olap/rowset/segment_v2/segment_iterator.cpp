@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -38,7 +39,9 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
+#include "io/fs/local_file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
 #include "olap/column_predicate.h"
@@ -49,6 +52,7 @@
 #include "olap/olap_common.h"
 #include "olap/primary_key_index.h"
 #include "olap/rowset/segment_v2/bitmap_index_reader.h"
+#include "olap/rowset/segment_v2/coalesced_file_reader.h"
 #include "olap/rowset/segment_v2/column_reader.h"
 #include "olap/rowset/segment_v2/index_file_reader.h"
 #include "olap/rowset/segment_v2/index_iterator.h"
@@ -70,6 +74,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/stopwatch.hpp"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
@@ -97,8 +102,25 @@ namespace doris {
 using namespace ErrorCode;
 namespace segment_v2 {
 
+// the batches between two reorders of the predicates by adaptive predicate ordering
+static constexpr uint32_t PREDICATE_REORDER_INTERVAL = 16;
+
 SegmentIterator::~SegmentIterator() = default;
 
+// Whether `key` is greater than `prev_key` in their common key columns. If so, the ordinal of
+// `key` is not less than the one of `prev_key`, whatever their paddings are.
+static bool is_greater_key(const RowCursor& key, const RowCursor& prev_key) {
+    size_t num_keys =
+            std::min(key.schema()->num_column_ids(), prev_key.schema()->num_column_ids());
+    for (uint32_t cid = 0; cid < num_keys; ++cid) {
+        int res = key.column_schema(cid)->compare_cell(key.cell(cid), prev_key.cell(cid));
+        if (res != 0) {
+            return res > 0;
+        }
+    }
+    return false;
+}
+
 // A fast range iterator for roaring bitmap. Output ranges use closed-open form, like [from, to).
 // Example:
 //   input bitmap:  [0 1 4 5 6 7 10 15 16 17 18 19]
@@ -285,6 +307,11 @@ Status SegmentIterator::_init_impl(const StorageReadOptions& opts) {
     SCOPED_RAW_TIMER(&_opts.stats->segment_iterator_init_timer_ns);
     _inited = true;
     _file_reader = _segment->_file_reader;
+    if (config::enable_segment_read_coalescing &&
+        dynamic_cast<io::LocalFileReader*>(_file_reader.get()) == nullptr) {
+        _coalesced_file_reader = std::make_shared<CoalescedFileReader>(_file_reader);
+        _file_reader = _coalesced_file_reader;
+    }
     _col_predicates.clear();
 
     for (const auto& predicate : opts.column_predicates) {
@@ -402,6 +429,30 @@ Status SegmentIterator::_lazy_init() {
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
     }
+    if (_coalesced_file_reader != nullptr) {
+        RETURN_IF_ERROR(_plan_coalesced_reads());
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_plan_coalesced_reads() {
+    RowRanges row_ranges;
+    BitmapRangeIterator range_iter(_row_bitmap);
+    uint32_t from = 0;
+    uint32_t to = 0;
+    while (range_iter.next_range(std::numeric_limits<uint32_t>::max(), &from, &to)) {
+        row_ranges.add(RowRange(from, to));
+    }
+    std::vector<io::PrefetchRange> ranges;
+    for (auto cid : _schema->column_ids()) {
+        // only the scalar columns are planned, the pages of the others are read one by one
+        auto* iter = dynamic_cast<FileColumnIterator*>(_column_iterators[cid].get());
+        if (iter != nullptr) {
+            RETURN_IF_ERROR(iter->collect_page_ranges(row_ranges, &ranges));
+        }
+    }
+    _opts.stats->coalesced_read_ranges += ranges.size();
+    _coalesced_file_reader->set_ranges(std::move(ranges));
     return Status::OK();
 }
 
@@ -421,28 +472,41 @@ Status SegmentIterator::_get_row_ranges_by_keys() {
         return Status::OK();
     }
 
-    RowRanges result_ranges;
+    // The key ranges of an IN list are sorted, so the lookup of a range starts from the upper
+    // ordinal of the previous one when its lower key is greater than the previous upper key.
+    // The row ranges are added to the bitmap directly, unioning them one by one is quadratic.
+    roaring::Roaring result_bitmap;
+    const RowCursor* prev_upper_key = nullptr;
+    rowid_t prev_upper_rowid = 0;
     for (auto& key_range : _opts.key_ranges) {
         rowid_t lower_rowid = 0;
         rowid_t upper_rowid = num_rows();
         RETURN_IF_ERROR(_prepare_seek(key_range));
-        if (key_range.upper_key != nullptr) {
+        if (key_range.lower_key != nullptr) {
+            rowid_t lower_bound = 0;
+            if (prev_upper_key != nullptr &&
+                is_greater_key(*key_range.lower_key, *prev_upper_key)) {
+                lower_bound = prev_upper_rowid;
+            }
+            RETURN_IF_ERROR(_lookup_ordinal(*key_range.lower_key, key_range.include_lower,
+                                            lower_bound, num_rows(), &lower_rowid));
+        }
+        if (lower_rowid < num_rows() && key_range.upper_key != nullptr) {
             // If client want to read upper_bound, the include_upper is true. So we
             // should get the first ordinal at which key is larger than upper_bound.
             // So we call _lookup_ordinal with include_upper's negate
             RETURN_IF_ERROR(_lookup_ordinal(*key_range.upper_key, !key_range.include_upper,
-                                            num_rows(), &upper_rowid));
+                                            lower_rowid, num_rows(), &upper_rowid));
         }
-        if (upper_rowid > 0 && key_range.lower_key != nullptr) {
-            RETURN_IF_ERROR(_lookup_ordinal(*key_range.lower_key, key_range.include_lower,
-                                            upper_rowid, &lower_rowid));
+        if (lower_rowid < upper_rowid) {
+            result_bitmap.addRange(lower_rowid, upper_rowid);
         }
-        auto row_range = RowRanges::create_single(lower_rowid, upper_rowid);
-        RowRanges::ranges_union(result_ranges, row_range, &result_ranges);
+        prev_upper_key = key_range.upper_key;
+        prev_upper_rowid = upper_rowid;
     }
     // pre-condition: _row_ranges == [0, num_rows)
     size_t pre_size = _row_bitmap.cardinality();
-    _row_bitmap = RowRanges::ranges_to_roaring(result_ranges);
+    _row_bitmap = std::move(result_bitmap);
     _opts.stats->rows_key_range_filtered += (pre_size - _row_bitmap.cardinality());
 
     return Status::OK();
@@ -1130,18 +1194,18 @@ Status SegmentIterator::_init_index_iterators() {
     return Status::OK();
 }
 
-Status SegmentIterator::_lookup_ordinal(const RowCursor& key, bool is_include, rowid_t upper_bound,
-                                        rowid_t* rowid) {
+Status SegmentIterator::_lookup_ordinal(const RowCursor& key, bool is_include, rowid_t lower_bound,
+                                        rowid_t upper_bound, rowid_t* rowid) {
     if (_segment->_tablet_schema->keys_type() == UNIQUE_KEYS &&
         _segment->get_primary_key_index() != nullptr) {
         return _lookup_ordinal_from_pk_index(key, is_include, rowid);
     }
-    return _lookup_ordinal_from_sk_index(key, is_include, upper_bound, rowid);
+    return _lookup_ordinal_from_sk_index(key, is_include, lower_bound, upper_bound, rowid);
 }
 
 // look up one key to get its ordinal at which can get data by using short key index.
-// 'upper_bound' is defined the max ordinal the function will search.
-// We use upper_bound to reduce search times.
+// [lower_bound, upper_bound] is defined the ordinals the function will search.
+// We use them to reduce search times.
 // If we find a valid ordinal, it will be set in rowid and with Status::OK()
 // If we can not find a valid key in this segment, we will set rowid to upper_bound
 // Otherwise return error.
@@ -1149,7 +1213,8 @@ Status SegmentIterator::_lookup_ordinal(const RowCursor& key, bool is_include, r
 // 2. binary search to find exact ordinal that match the input condition
 // Make is_include template to reduce branch
 Status SegmentIterator::_lookup_ordinal_from_sk_index(const RowCursor& key, bool is_include,
-                                                      rowid_t upper_bound, rowid_t* rowid) {
+                                                      rowid_t lower_bound, rowid_t upper_bound,
+                                                      rowid_t* rowid) {
     const ShortKeyIndexDecoder* sk_index_decoder = _segment->get_short_key_index();
     DCHECK(sk_index_decoder != nullptr);
 
@@ -1175,12 +1240,14 @@ Status SegmentIterator::_lookup_ordinal_from_sk_index(const RowCursor& key, bool
         // row block. so we set the rowid to first row of last row block.
         start_block_id = sk_index_decoder->num_items() - 1;
     }
-    rowid_t start = start_block_id * sk_index_decoder->num_rows_per_block();
+    rowid_t start = std::max(start_block_id * sk_index_decoder->num_rows_per_block(), lower_bound);
 
     rowid_t end = upper_bound;
     auto end_iter = sk_index_decoder->upper_bound(index_key);
     if (end_iter.valid()) {
-        end = end_iter.ordinal() * sk_index_decoder->num_rows_per_block();
+        end = std::min(static_cast<rowid_t>(end_iter.ordinal() *
+                                            sk_index_decoder->num_rows_per_block()),
+                       upper_bound);
     }
 
     // binary search to find the exact key
@@ -1225,8 +1292,10 @@ Status SegmentIterator::_lookup_ordinal_from_pk_index(const RowCursor& key, bool
     }
     bool exact_match = false;
 
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(pk_index_reader->new_iterator(&index_iterator, _opts.stats));
+    if (_pk_index_iterator == nullptr) {
+        RETURN_IF_ERROR(pk_index_reader->new_iterator(&_pk_index_iterator, _opts.stats));
+    }
+    auto& index_iterator = _pk_index_iterator;
 
     Status status = index_iterator->seek_at_or_after(&index_key, &exact_match);
     if (UNLIKELY(!status.ok())) {
@@ -1837,18 +1906,36 @@ uint16_t SegmentIterator::_evaluate_vectorization_predicate(uint16_t* sel_rowid_
     _ret_flags.resize(original_size);
     DCHECK(!_pre_eval_block_predicate.empty());
     bool is_first = true;
+    const bool measure_cost = config::enable_adaptive_predicate_order;
+    uint16_t alive_rows = original_size;
     for (auto& pred : _pre_eval_block_predicate) {
         if (pred->always_true()) {
             continue;
         }
         auto column_id = pred->column_id();
         auto& column = _current_return_columns[column_id];
+        MonotonicStopWatch watch;
+        if (measure_cost) {
+            watch.start();
+        }
         if (is_first) {
             pred->evaluate_vec(*column, original_size, (bool*)_ret_flags.data());
             is_first = false;
         } else {
             pred->evaluate_and_vec(*column, original_size, (bool*)_ret_flags.data());
         }
+        if (measure_cost) {
+            auto& cost = _predicate_costs[pred];
+            cost.eval_ns += watch.elapsed_time();
+            cost.input_rows += alive_rows;
+            alive_rows = original_size - simd::count_zero_num((int8_t*)_ret_flags.data(),
+                                                              original_size);
+            cost.output_rows += alive_rows;
+            // the predicates after are in vain
+            if (alive_rows == 0) {
+                break;
+            }
+        }
     }
 
     uint16_t new_size = 0;
@@ -1893,10 +1980,23 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     }
 
     uint16_t original_size = selected_size;
+    const bool measure_cost = config::enable_adaptive_predicate_order;
     for (auto* predicate : _short_cir_eval_predicate) {
         auto column_id = predicate->column_id();
         auto& short_cir_column = _current_return_columns[column_id];
-        selected_size = predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        if (!measure_cost) {
+            selected_size =
+                    predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+            continue;
+        }
+        auto& cost = _predicate_costs[predicate];
+        cost.input_rows += selected_size;
+        {
+            SCOPED_RAW_TIMER(&cost.eval_ns);
+            selected_size =
+                    predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        }
+        cost.output_rows += selected_size;
     }
 
     _opts.stats->short_circuit_cond_input_rows += original_size;
@@ -1910,6 +2010,39 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     return selected_size;
 }
 
+void SegmentIterator::_reorder_predicates_by_cost() {
+    auto rank = [this](const ColumnPredicate* pred) {
+        auto it = _predicate_costs.find(pred);
+        // the predicates not evaluated yet keep their places after the others
+        if (it == _predicate_costs.end() || it->second.input_rows == 0) {
+            return std::numeric_limits<double>::max();
+        }
+        double filter_rate = 1 - it->second.pass_rate();
+        if (filter_rate <= 0) {
+            return std::numeric_limits<double>::max() / 2;
+        }
+        return it->second.cost_per_row() / filter_rate;
+    };
+    auto by_rank = [&rank](const ColumnPredicate* lhs, const ColumnPredicate* rhs) {
+        return rank(lhs) < rank(rhs);
+    };
+    auto reorder = [&](std::vector<ColumnPredicate*>& predicates) {
+        if (predicates.size() > 1 &&
+            !std::is_sorted(predicates.begin(), predicates.end(), by_rank)) {
+            std::stable_sort(predicates.begin(), predicates.end(), by_rank);
+            _opts.stats->predicate_reorder_num++;
+        }
+    };
+    reorder(_pre_eval_block_predicate);
+    reorder(_short_cir_eval_predicate);
+    // decay the costs, so the order follows the data as the scan goes on
+    for (auto& [_, cost] : _predicate_costs) {
+        cost.input_rows /= 2;
+        cost.output_rows /= 2;
+        cost.eval_ns /= 2;
+    }
+}
+
 Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                 std::vector<rowid_t>& rowid_vector,
                                                 uint16_t* sel_rowid_idx, size_t select_size,
@@ -1953,6 +2086,10 @@ Status SegmentIterator::next_batch(vectorized::Block* block) {
     auto status = [&]() {
         RETURN_IF_CATCH_EXCEPTION({
             RETURN_IF_ERROR(_next_batch_internal(block));
+            if (block->rows() > 0) {
+                auto rows = static_cast<int64_t>(block->rows());
+                _block_bytes_per_row = (static_cast<int64_t>(block->bytes()) + rows - 1) / rows;
+            }
 
             // reverse block row order if read_orderby_key_reverse is true for key topn
             // it should be processed for all success _next_batch_internal
@@ -2106,6 +2243,13 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
     if (_can_opt_topn_reads()) {
         nrows_read_limit = std::min(static_cast<uint32_t>(_opts.topn_limit), nrows_read_limit);
     }
+    if (config::scan_block_max_bytes > 0 && _block_bytes_per_row > 0) {
+        // the rows of the last block tell how many rows fit in the max bytes
+        int64_t max_rows =
+                std::max<int64_t>(config::scan_block_max_bytes / _block_bytes_per_row, 1);
+        nrows_read_limit =
+                static_cast<uint32_t>(std::min(static_cast<int64_t>(nrows_read_limit), max_rows));
+    }
     // If the row bitmap size is smaller than nrows_read_limit, there's no need to reserve that many column rows.
     nrows_read_limit = std::min(_row_bitmap.cardinality(), uint64_t(nrows_read_limit));
     DBUG_EXECUTE_IF("segment_iterator.topn_opt_1", {
@@ -2169,6 +2313,12 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
             //          In SSB test, it make no difference; So need more scenarios to test
             selected_size = _evaluate_short_circuit_predicate(_sel_rowid_idx.data(), selected_size);
 
+            if (config::enable_adaptive_predicate_order &&
+                ++_batches_since_reorder >= PREDICATE_REORDER_INTERVAL) {
+                _batches_since_reorder = 0;
+                _reorder_predicates_by_cost();
+            }
+
             if (selected_size > 0) {
                 // step 3.1: output short circuit and predicate column
                 // when lazy materialization enables, _predicate_column_ids = distinct(_short_cir_pred_column_ids + _vec_pred_column_ids)
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <fmt/format.h>
 #include <gen_cpp/Exprs_types.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -67,7 +68,9 @@ struct RowLocation;
 namespace segment_v2 {
 
 class BitmapIndexIterator;
+class CoalescedFileReader;
 class ColumnIterator;
+class IndexedColumnIterator;
 class InvertedIndexIterator;
 class RowRanges;
 class IndexIterator;
@@ -169,6 +172,11 @@ private:
         std::string info;
         for (auto pred : predicates) {
             info += "\n" + pred->debug_string();
+            auto it = _predicate_costs.find(pred);
+            if (it != _predicate_costs.end() && it->second.input_rows > 0) {
+                info += fmt::format(", pass rate: {:.3f}, cost: {:.1f} ns/row",
+                                    it->second.pass_rate(), it->second.cost_per_row());
+            }
         }
         profile->add_info_string(title, info);
     }
@@ -178,15 +186,19 @@ private:
     [[nodiscard]] Status _init_return_column_iterators();
     [[nodiscard]] Status _init_bitmap_index_iterators();
     [[nodiscard]] Status _init_index_iterators();
+    // plan the data pages of the row bitmap to read for `_coalesced_file_reader`
+    [[nodiscard]] Status _plan_coalesced_reads();
     // calculate row ranges that fall into requested key ranges using short key index
     [[nodiscard]] Status _get_row_ranges_by_keys();
     [[nodiscard]] Status _prepare_seek(const StorageReadOptions::KeyRange& key_range);
-    [[nodiscard]] Status _lookup_ordinal(const RowCursor& key, bool is_include, rowid_t upper_bound,
-                                         rowid_t* rowid);
+    // the ordinal of `key` is known to be in [lower_bound, upper_bound]
+    [[nodiscard]] Status _lookup_ordinal(const RowCursor& key, bool is_include, rowid_t lower_bound,
+                                         rowid_t upper_bound, rowid_t* rowid);
     // lookup the ordinal of given key from short key index
     // the returned rowid is rowid in primary index, not the rowid encoded in primary key
     [[nodiscard]] Status _lookup_ordinal_from_sk_index(const RowCursor& key, bool is_include,
-                                                       rowid_t upper_bound, rowid_t* rowid);
+                                                       rowid_t lower_bound, rowid_t upper_bound,
+                                                       rowid_t* rowid);
     // lookup the ordinal of given key from primary key index
     [[nodiscard]] Status _lookup_ordinal_from_pk_index(const RowCursor& key, bool is_include,
                                                        rowid_t* rowid);
@@ -229,6 +241,8 @@ private:
                                uint32_t nrows_read_limit);
     uint16_t _evaluate_vectorization_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
     uint16_t _evaluate_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    // order the predicates by the observed costs, see `PredicateCost`
+    void _reorder_predicates_by_cost();
     void _collect_runtime_filter_predicate();
     void _output_non_pred_columns(vectorized::Block* block);
     [[nodiscard]] Status _read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
@@ -418,6 +432,21 @@ private:
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+
+    // The observed cost of a predicate when config::enable_adaptive_predicate_order is on. The
+    // predicates of a conjunction are evaluated in the ascending order of
+    // cost_per_row / (1 - pass_rate), so the cheap and selective ones shrink the selection first.
+    // The pass rate of a vectorized predicate is measured on the rows passed the ones before it.
+    struct PredicateCost {
+        int64_t input_rows = 0;
+        int64_t output_rows = 0;
+        int64_t eval_ns = 0;
+
+        double pass_rate() const { return (double)output_rows / input_rows; }
+        double cost_per_row() const { return (double)eval_ns / input_rows; }
+    };
+    std::unordered_map<const ColumnPredicate*, PredicateCost> _predicate_costs;
+    uint32_t _batches_since_reorder = 0;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
@@ -448,11 +477,18 @@ private:
     // used to binary search the rowid for a given key
     // only used in `_get_row_ranges_by_keys`
     vectorized::MutableColumns _seek_block;
+    // reused by the lookups of all the key ranges, which are usually sorted, so the index page
+    // is searched forward from the last lookup
+    // only used in `_get_row_ranges_by_keys`
+    std::unique_ptr<IndexedColumnIterator> _pk_index_iterator;
 
     //todo(wb) remove this field after Rowcursor is removed
     vectorized::MutableColumns _short_key;
 
     io::FileReaderSPtr _file_reader;
+    // wraps the segment file reader to coalesce the page reads on remote storage, nullptr if
+    // it's disabled
+    std::shared_ptr<CoalescedFileReader> _coalesced_file_reader;
 
     // char_type or array<char> type columns cid
     std::vector<size_t> _char_type_idx;
@@ -461,6 +497,8 @@ private:
 
     // number of rows read in the current batch
     uint32_t _current_batch_rows_read = 0;
+    // bytes per row of the last block, to limit the rows of a block by config::scan_block_max_bytes
+    int64_t _block_bytes_per_row = 0;
     // used for compaction, record selectd rowids of current batch
     uint16_t _selected_size;
     std::vector<uint16_t> _sel_rowid_idx;
@@ -181,6 +181,8 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     opts.meta = _footer.add_columns();
 
     init_column_meta(opts.meta, cid, column, schema);
+    // compaction knows all values of the output, so it pays to choose the encoding by them
+    opts.adaptive_encoding = _opts.write_type == DataWriteType::TYPE_COMPACTION;
 
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
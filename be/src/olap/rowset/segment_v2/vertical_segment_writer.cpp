@@ -178,6 +178,8 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     opts.meta = _footer.add_columns();
 
     _init_column_meta(opts.meta, cid, column);
+    // compaction knows all values of the output, so it pays to choose the encoding by them
+    opts.adaptive_encoding = _opts.write_type == DataWriteType::TYPE_COMPACTION;
 
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
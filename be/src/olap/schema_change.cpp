@@ -71,8 +71,10 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -1205,91 +1207,150 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
     }
 
     // b. Generate historical data converter
-    auto sc_procedure = _get_sc_procedure(
-            changer, sc_sorting, sc_directly,
-            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
+    int64_t sc_mem_limit =
+            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change();
+    auto sc_procedure = _get_sc_procedure(changer, sc_sorting, sc_directly, sc_mem_limit);
 
     DBUG_EXECUTE_IF("SchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
     // c.Convert historical data
-    bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
-        // set status for monitor
-        // As long as there is a new_table as running, ref table is set as running
-        // NOTE If the first sub_table fails first, it will continue to go as normal here
-        // When tablet create new rowset writer, it may change rowset type, in this case
-        // linked schema change will not be used.
-        RowsetWriterContext context;
-        context.version = rs_reader->version();
-        context.rowset_state = VISIBLE;
-        context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
-        context.tablet_schema = _new_tablet_schema;
-        context.newest_write_timestamp = rs_reader->newest_write_timestamp();
-
-        if (!rs_reader->rowset()->is_local()) {
-            context.storage_resource =
-                    *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
+    // The rowsets changed directly are converted in parallel by batches, each by its own
+    // SchemaChange, since they don't depend on each other. The rowsets of a batch are still
+    // built and added in version order. The sorting ones keep going one by one, since each of
+    // them may take the memory limitation of the thread.
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    size_t parallelism = 1;
+    std::unique_ptr<ThreadPool> convert_pool;
+    if (sc_directly && config::schema_change_max_parallel_rowsets > 1 && rs_readers.size() > 1) {
+        parallelism = std::min(static_cast<size_t>(config::schema_change_max_parallel_rowsets),
+                               rs_readers.size());
+        auto st = ThreadPoolBuilder("SchemaChangeConvertPool")
+                          .set_min_threads(static_cast<int>(parallelism))
+                          .set_max_threads(static_cast<int>(parallelism))
+                          .build(&convert_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build schema change convert pool, convert the rowsets one "
+                         << "by one. new_tablet=" << _new_tablet->tablet_id() << ", st=" << st;
+            convert_pool.reset();
+            parallelism = 1;
         }
+    }
+    auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
 
-        context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
-        // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key index
-        bool vertical = false;
-        if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
-            // see VBaseSchemaChangeWithSorting::_external_sorting
-            vertical = true;
-        }
-        auto result = _new_tablet->create_rowset_writer(context, vertical);
-        if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
-            return process_alter_exit();
-        }
-        auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
-
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
-            LOG(WARNING) << "failed to process the version."
-                         << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
-            return process_alter_exit();
-        }
-        // Add the new version of the data to the header
-        // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
-        std::lock_guard lock(_new_tablet->get_push_lock());
-        RowsetSharedPtr new_rowset;
-        if (!(res = rowset_writer->build(new_rowset)).ok()) {
-            LOG(WARNING) << "failed to build rowset, exit alter process";
-            return process_alter_exit();
+    bool have_failure_rowset = false;
+    for (size_t batch_begin = 0; batch_begin < rs_readers.size(); batch_begin += parallelism) {
+        size_t batch_end = std::min(batch_begin + parallelism, rs_readers.size());
+        std::vector<std::unique_ptr<RowsetWriter>> rowset_writers;
+        std::vector<PendingRowsetGuard> pending_rs_guards;
+        for (size_t i = batch_begin; i < batch_end; ++i) {
+            const auto& rs_reader = rs_readers[i];
+            // set status for monitor
+            // As long as there is a new_table as running, ref table is set as running
+            // NOTE If the first sub_table fails first, it will continue to go as normal here
+            // When tablet create new rowset writer, it may change rowset type, in this case
+            // linked schema change will not be used.
+            RowsetWriterContext context;
+            context.version = rs_reader->version();
+            context.rowset_state = VISIBLE;
+            context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
+            context.tablet_schema = _new_tablet_schema;
+            context.newest_write_timestamp = rs_reader->newest_write_timestamp();
+
+            if (!rs_reader->rowset()->is_local()) {
+                context.storage_resource =
+                        *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
+            }
+
+            context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
+            // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key index
+            bool vertical = false;
+            if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
+                // see VBaseSchemaChangeWithSorting::_external_sorting
+                vertical = true;
+            }
+            auto result = _new_tablet->create_rowset_writer(context, vertical);
+            if (!result.has_value()) {
+                res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                         result.error().to_string());
+                return process_alter_exit();
+            }
+            rowset_writers.push_back(std::move(result).value());
+            pending_rs_guards.push_back(_local_storage_engine.add_pending_rowset(context));
         }
-        res = _new_tablet->add_rowset(new_rowset);
-        if (res.is<PUSH_VERSION_ALREADY_EXIST>()) {
-            LOG(WARNING) << "version already exist, version revert occurred. "
-                         << "tablet=" << _new_tablet->tablet_id() << ", version='"
-                         << rs_reader->version().first << "-" << rs_reader->version().second;
-            _local_storage_engine.add_unused_rowset(new_rowset);
-            have_failure_rowset = true;
-            res = Status::OK();
-        } else if (!res) {
-            LOG(WARNING) << "failed to register new version. "
-                         << " tablet=" << _new_tablet->tablet_id()
-                         << ", version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second;
-            _local_storage_engine.add_unused_rowset(new_rowset);
-            return process_alter_exit();
+
+        std::vector<Status> statuses(batch_end - batch_begin);
+        if (convert_pool == nullptr) {
+            statuses[0] = sc_procedure->process(rs_readers[batch_begin], rowset_writers[0].get(),
+                                                _new_tablet, _base_tablet, _base_tablet_schema,
+                                                _new_tablet_schema);
         } else {
-            VLOG_NOTICE << "register new version. tablet=" << _new_tablet->tablet_id()
-                        << ", version=" << rs_reader->version().first << "-"
-                        << rs_reader->version().second;
-        }
-        if (!have_failure_rowset) {
-            *real_alter_version = rs_reader->version().second;
+            std::vector<std::unique_ptr<SchemaChange>> sc_procedures;
+            for (size_t k = 0; k < statuses.size(); ++k) {
+                sc_procedures.push_back(
+                        _get_sc_procedure(changer, sc_sorting, sc_directly, sc_mem_limit));
+            }
+            for (size_t k = 0; k < statuses.size(); ++k) {
+                auto convert = [&, k] {
+                    statuses[k] = sc_procedures[k]->process(
+                            rs_readers[batch_begin + k], rowset_writers[k].get(), _new_tablet,
+                            _base_tablet, _base_tablet_schema, _new_tablet_schema);
+                };
+                auto st = convert_pool->submit_func([convert, mem_tracker] {
+                    SCOPED_ATTACH_TASK(mem_tracker);
+                    convert();
+                });
+                if (!st.ok()) {
+                    convert();
+                }
+            }
+            convert_pool->wait();
         }
 
-        VLOG_TRACE << "succeed to convert a history version."
-                   << " version=" << rs_reader->version().first << "-"
-                   << rs_reader->version().second;
+        for (size_t i = batch_begin; i < batch_end; ++i) {
+            const auto& rs_reader = rs_readers[i];
+            auto& rowset_writer = rowset_writers[i - batch_begin];
+            if (res = statuses[i - batch_begin]; !res) {
+                LOG(WARNING) << "failed to process the version."
+                             << " version=" << rs_reader->version().first << "-"
+                             << rs_reader->version().second << ", " << res.to_string();
+                return process_alter_exit();
+            }
+            // Add the new version of the data to the header
+            // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
+            std::lock_guard lock(_new_tablet->get_push_lock());
+            RowsetSharedPtr new_rowset;
+            if (!(res = rowset_writer->build(new_rowset)).ok()) {
+                LOG(WARNING) << "failed to build rowset, exit alter process";
+                return process_alter_exit();
+            }
+            res = _new_tablet->add_rowset(new_rowset);
+            if (res.is<PUSH_VERSION_ALREADY_EXIST>()) {
+                LOG(WARNING) << "version already exist, version revert occurred. "
+                             << "tablet=" << _new_tablet->tablet_id() << ", version='"
+                             << rs_reader->version().first << "-" << rs_reader->version().second;
+                _local_storage_engine.add_unused_rowset(new_rowset);
+                have_failure_rowset = true;
+                res = Status::OK();
+            } else if (!res) {
+                LOG(WARNING) << "failed to register new version. "
+                             << " tablet=" << _new_tablet->tablet_id()
+                             << ", version=" << rs_reader->version().first << "-"
+                             << rs_reader->version().second;
+                _local_storage_engine.add_unused_rowset(new_rowset);
+                return process_alter_exit();
+            } else {
+                VLOG_NOTICE << "register new version. tablet=" << _new_tablet->tablet_id()
+                            << ", version=" << rs_reader->version().first << "-"
+                            << rs_reader->version().second;
+            }
+            if (!have_failure_rowset) {
+                *real_alter_version = rs_reader->version().second;
+            }
+
+            VLOG_TRACE << "succeed to convert a history version."
+                       << " version=" << rs_reader->version().first << "-"
+                       << rs_reader->version().second;
+        }
     }
 
     // XXX:The SchemaChange state should not be canceled at this time, because the new Delta has to be converted to the old and new Schema version
@@ -32,6 +32,7 @@
 #include "common/status.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_common.h" // for rowset id
+#include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "util/time.h"
@@ -168,6 +169,15 @@ public:
 
     std::vector<segment_v2::SegmentSharedPtr>& get_segments() { return segments; }
 
+    // The primary key index iterators of the segments, reused by the row key lookups on the
+    // segments while the handle is alive.
+    std::unique_ptr<segment_v2::IndexedColumnIterator>* get_pk_index_iterator(size_t idx) {
+        if (pk_index_iterators.size() < segments.size()) {
+            pk_index_iterators.resize(segments.size());
+        }
+        return &pk_index_iterators[idx];
+    }
+
     [[nodiscard]] bool is_inited() const { return _init; }
 
     void set_inited() {
@@ -189,6 +199,7 @@ public:
 
 private:
     std::vector<segment_v2::SegmentSharedPtr> segments;
+    std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>> pk_index_iterators;
     bool _init {false};
 
     // Don't allow copy and assign
@@ -335,6 +335,9 @@ public:
     void add_async_publish_task(int64_t partition_id, int64_t tablet_id, int64_t publish_version,
                                 int64_t transaction_id, bool is_recover);
     int64_t get_pending_publish_min_version(int64_t tablet_id);
+    // Take the async publish task of `publish_version` of the tablet, false if there isn't one.
+    bool take_async_publish_task(int64_t tablet_id, int64_t publish_version,
+                                 int64_t* transaction_id, int64_t* partition_id);
 
     bool add_broken_path(std::string path);
     bool remove_broken_path(std::string path);
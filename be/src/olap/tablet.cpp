@@ -1074,6 +1074,44 @@ uint32_t Tablet::calc_compaction_score() {
     }
 }
 
+double Tablet::compute_read_amp_compaction_score(uint32_t compaction_score, double query_rate,
+                                                 int64_t input_bytes) {
+    // a read merges about `compaction_score` sources in the range, and one after the compaction
+    double read_amp_reduction = compaction_score > 1 ? compaction_score - 1 : 0;
+    double input_mb = std::max(1.0, static_cast<double>(input_bytes) / (1024 * 1024));
+    return read_amp_reduction * (1 + query_rate) / input_mb;
+}
+
+double Tablet::calc_read_amp_compaction_score(CompactionType compaction_type,
+                                              uint32_t compaction_score) {
+    int64_t input_bytes = 0;
+    {
+        std::shared_lock rdlock(_meta_lock);
+        const int64_t point = cumulative_layer_point();
+        for (auto& rs_meta : _tablet_meta->all_rs_metas()) {
+            bool above_point = rs_meta->start_version() >= point;
+            if (rs_meta->is_local() &&
+                above_point == (compaction_type == CompactionType::CUMULATIVE_COMPACTION)) {
+                input_bytes += rs_meta->data_disk_size();
+            }
+        }
+    }
+
+    int64_t now_ms = MonotonicMillis();
+    int64_t query_scan_cnt = query_scan_count != nullptr ? query_scan_count->value() : 0;
+    if (_last_query_rate_update_ms > 0 && now_ms > _last_query_rate_update_ms) {
+        double rate = static_cast<double>(query_scan_cnt - _last_query_scan_count) * 1000 /
+                      static_cast<double>(now_ms - _last_query_rate_update_ms);
+        _query_rate = (_query_rate + rate) / 2;
+    }
+    _last_query_scan_count = query_scan_cnt;
+    _last_query_rate_update_ms = now_ms;
+
+    double score = compute_read_amp_compaction_score(compaction_score, _query_rate, input_bytes);
+    _read_amp_compaction_score = score;
+    return score;
+}
+
 bool Tablet::suitable_for_compaction(
         CompactionType compaction_type,
         std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy) {
@@ -226,6 +226,15 @@ public:
 
     uint32_t calc_compaction_score();
 
+    // The read amplification a compaction removes, weighted by the query rate of the tablet,
+    // per MB to compact. It's called by the compaction producer, and the last result is kept for
+    // ordering the tasks of a round.
+    double calc_read_amp_compaction_score(CompactionType compaction_type,
+                                          uint32_t compaction_score);
+    double read_amp_compaction_score() const { return _read_amp_compaction_score; }
+    static double compute_read_amp_compaction_score(uint32_t compaction_score, double query_rate,
+                                                    int64_t input_bytes);
+
     // This function to find max continuous version from the beginning.
     // For example: If there are 1, 2, 3, 5, 6, 7 versions belongs tablet, then 3 is target.
     // 3 will be saved in "version", and 7 will be saved in "max_version", if max_version != nullptr
@@ -645,6 +654,12 @@ private:
 
     int32_t _compaction_score = -1;
     int32_t _score_check_cnt = 0;
+
+    // queries per second, measured by the compaction producer
+    double _query_rate = 0;
+    int64_t _last_query_scan_count = 0;
+    int64_t _last_query_rate_update_ms = 0;
+    std::atomic<double> _read_amp_compaction_score = 0;
 };
 
 inline CumulativeCompactionPolicy* Tablet::cumulative_compaction_policy() {
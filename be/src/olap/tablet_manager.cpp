@@ -81,6 +81,8 @@ using namespace ErrorCode;
 
 bvar::Adder<int64_t> g_tablet_meta_schema_columns_count("tablet_meta_schema_columns_count");
 
+static LockContentionSite g_tablets_shard_lock_site("tablet_manager_tablets_shard");
+
 TabletManager::TabletManager(StorageEngine& engine, int32_t tablet_map_lock_shard_size)
         : _engine(engine),
           _tablets_shards_size(tablet_map_lock_shard_size),
@@ -88,6 +90,9 @@ TabletManager::TabletManager(StorageEngine& engine, int32_t tablet_map_lock_shar
     CHECK_GT(_tablets_shards_size, 0);
     CHECK_EQ(_tablets_shards_size & _tablets_shards_mask, 0);
     _tablets_shards.resize(_tablets_shards_size);
+    for (auto& shard : _tablets_shards) {
+        shard.lock.set_contention_site(&g_tablets_shard_lock_site);
+    }
 }
 
 TabletManager::~TabletManager() = default;
@@ -225,8 +230,9 @@ Status TabletManager::_add_tablet_to_map_unlocked(TTabletId tablet_id,
     // the perspective of root path.
     // Example: unregister all tables when a bad disk found.
     tablet->register_tablet_into_dir();
-    tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
-    tablet_map[tablet_id] = tablet;
+    auto& tablets_shard = _get_tablets_shard(tablet_id);
+    tablets_shard.tablet_map[tablet_id] = tablet;
+    tablets_shard.add_to_lookup_map(tablet_id, tablet);
     _add_tablet_to_partition(tablet);
     g_tablet_meta_schema_columns_count << tablet->tablet_meta()->tablet_columns_num();
     COUNTER_UPDATE(ADD_CHILD_TIMER(profile, "RegisterTabletInfo", "AddTablet"),
@@ -531,8 +537,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
     // Fetch tablet which need to be dropped
     TabletSharedPtr to_drop_tablet;
     {
-        std::unique_lock<std::shared_mutex> wlock(_get_tablets_shard_lock(tablet_id),
-                                                  std::defer_lock);
+        std::unique_lock wlock(_get_tablets_shard_lock(tablet_id), std::defer_lock);
         if (!had_held_shard_lock) {
             wlock.lock();
         }
@@ -551,8 +556,9 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
         }
 
         _remove_tablet_from_partition(to_drop_tablet);
-        tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
-        tablet_map.erase(tablet_id);
+        auto& tablets_shard = _get_tablets_shard(tablet_id);
+        tablets_shard.tablet_map.erase(tablet_id);
+        tablets_shard.remove_from_lookup_map(tablet_id);
     }
 
     to_drop_tablet->clear_cache();
@@ -592,8 +598,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
-    return _get_tablet_unlocked(tablet_id, include_deleted, err);
+    return _check_found_tablet(_lookup_tablet(tablet_id), tablet_id, include_deleted, err);
 }
 
 std::vector<TabletSharedPtr> TabletManager::get_all_tablet(std::function<bool(Tablet*)>&& filter) {
@@ -606,15 +611,23 @@ std::vector<TabletSharedPtr> TabletManager::get_all_tablet(std::function<bool(Ta
 void TabletManager::for_each_tablet(std::function<void(const TabletSharedPtr&)>&& handler,
                                     std::function<bool(Tablet*)>&& filter) {
     std::vector<TabletSharedPtr> tablets;
-    for (const auto& tablets_shard : _tablets_shards) {
+    for (auto& tablets_shard : _tablets_shards) {
         tablets.clear();
-        {
-            std::shared_lock rdlock(tablets_shard.lock);
-            for (const auto& [id, tablet] : tablets_shard.tablet_map) {
+        auto collect = [&](const tablet_map_t& tablet_map) {
+            for (const auto& [id, tablet] : tablet_map) {
                 if (filter(tablet.get())) {
                     tablets.emplace_back(tablet);
                 }
             }
+        };
+        {
+            butil::DoublyBufferedData<tablet_map_t>::ScopedPtr tablet_map;
+            if (tablets_shard.lookup_map.Read(&tablet_map) == 0) [[likely]] {
+                collect(*tablet_map);
+            } else {
+                std::shared_lock rdlock(tablets_shard.lock);
+                collect(tablets_shard.tablet_map);
+            }
         }
         for (const auto& tablet : tablets) {
             handler(tablet);
@@ -622,10 +635,24 @@ void TabletManager::for_each_tablet(std::function<void(const TabletSharedPtr&)>&
     }
 }
 
+TabletSharedPtr TabletManager::_lookup_tablet(TTabletId tablet_id) {
+    auto& tablets_shard = _get_tablets_shard(tablet_id);
+    butil::DoublyBufferedData<tablet_map_t>::ScopedPtr tablet_map;
+    if (tablets_shard.lookup_map.Read(&tablet_map) != 0) [[unlikely]] {
+        std::shared_lock rdlock(tablets_shard.lock);
+        return _get_tablet_unlocked(tablet_id);
+    }
+    auto it = tablet_map->find(tablet_id);
+    return it == tablet_map->end() ? nullptr : it->second;
+}
+
 TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool include_deleted,
                                                     string* err) {
-    TabletSharedPtr tablet;
-    tablet = _get_tablet_unlocked(tablet_id);
+    return _check_found_tablet(_get_tablet_unlocked(tablet_id), tablet_id, include_deleted, err);
+}
+
+TabletSharedPtr TabletManager::_check_found_tablet(TabletSharedPtr tablet, TTabletId tablet_id,
+                                                   bool include_deleted, string* err) {
     if (tablet == nullptr && include_deleted) {
         std::shared_lock rdlock(_shutdown_tablets_lock);
         for (auto& deleted_tablet : _shutdown_tablets) {
@@ -658,8 +685,7 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool in
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, TabletUid tablet_uid,
                                           bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id, include_deleted, err);
+    TabletSharedPtr tablet = get_tablet(tablet_id, include_deleted, err);
     if (tablet != nullptr && tablet->tablet_uid() == tablet_uid) {
         return tablet;
     }
@@ -726,6 +752,8 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
 struct TabletScore {
     TabletSharedPtr tablet_ptr;
     int score;
+    // the score to pick the tablets by
+    double rank;
 };
 
 std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
@@ -737,11 +765,12 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    double highest_rank = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
     TabletSharedPtr best_single_compact_tablet;
-    auto cmp = [](TabletScore left, TabletScore right) { return left.score > right.score; };
+    auto cmp = [](TabletScore left, TabletScore right) { return left.rank > right.rank; };
     std::priority_queue<TabletScore, std::vector<TabletScore>, decltype(cmp)> top_tablets(cmp);
 
     auto handler = [&](const TabletSharedPtr& tablet_ptr) {
@@ -798,6 +827,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        double current_rank = config::enable_compaction_read_amp_score
+                                      ? tablet_ptr->calc_read_amp_compaction_score(
+                                                compaction_type, current_compaction_score)
+                                      : current_compaction_score;
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -813,9 +846,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (config::compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
             ts.score = current_compaction_score;
+            ts.rank = current_rank;
             ts.tablet_ptr = tablet_ptr;
             if ((top_tablets.size() >= config::compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 current_rank > top_tablets.top().rank) ||
                 top_tablets.size() < config::compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -830,10 +864,11 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (current_rank > highest_rank && !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
+                    highest_rank = current_rank;
                     highest_score = current_compaction_score;
                     best_tablet = tablet_ptr;
                 }
@@ -954,7 +989,7 @@ Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_
             tablet->init(), absl::Substitute("tablet init failed. tablet=$0", tablet->tablet_id()));
 
     RuntimeProfile profile("CreateTablet");
-    std::lock_guard<std::shared_mutex> wrlock(_get_tablets_shard_lock(tablet_id));
+    std::lock_guard wrlock(_get_tablets_shard_lock(tablet_id));
     RETURN_NOT_OK_STATUS_WITH_WARN(
             _add_tablet_unlocked(tablet_id, tablet, update_meta, force, &profile),
             absl::Substitute("fail to add tablet. tablet=$0", tablet->tablet_id()));
@@ -1620,7 +1655,7 @@ void TabletManager::obtain_specific_quantity_tablets(vector<TabletInfo>& tablets
     }
 }
 
-std::shared_mutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
+ProfiledSharedMutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
     return _get_tablets_shard(tabletId).lock;
 }
 
@@ -1749,7 +1784,7 @@ std::set<int64_t> TabletManager::check_all_tablet_segment(bool repair) {
     for (const auto& [shard_index, shard_tablets] : repair_shard_bad_tablets) {
         auto& tablets_shard = _tablets_shards[shard_index];
         auto& tablet_map = tablets_shard.tablet_map;
-        std::lock_guard<std::shared_mutex> wrlock(tablets_shard.lock);
+        std::lock_guard wrlock(tablets_shard.lock);
         for (auto tablet_id : shard_tablets) {
             auto it = tablet_map.find(tablet_id);
             if (it == tablet_map.end()) {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <butil/containers/doubly_buffered_data.h>
 #include <butil/macros.h>
 #include <gen_cpp/BackendService_types.h>
 #include <gen_cpp/Types_types.h>
@@ -40,6 +41,7 @@
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
+#include "util/lock_contention.h"
 
 namespace doris {
 
@@ -201,6 +203,11 @@ private:
                         bool is_drop_table_or_partition, bool had_held_shard_lock);
 
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id);
+    // Look up the tablet without the shard lock.
+    TabletSharedPtr _lookup_tablet(TTabletId tablet_id);
+    // Look up the shutdown tablets if `tablet` is not found, and check if it can be used.
+    TabletSharedPtr _check_found_tablet(TabletSharedPtr tablet, TTabletId tablet_id,
+                                        bool include_deleted, std::string* err);
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, bool include_deleted,
                                          std::string* err);
 
@@ -223,7 +230,7 @@ private:
 
     void _remove_tablet_from_partition(const TabletSharedPtr& tablet);
 
-    std::shared_mutex& _get_tablets_shard_lock(TTabletId tabletId);
+    ProfiledSharedMutex& _get_tablets_shard_lock(TTabletId tabletId);
 
     bool _move_tablet_to_trash(const TabletSharedPtr& tablet);
 
@@ -237,9 +244,33 @@ private:
         tablets_shard(tablets_shard&& shard) {
             tablet_map = std::move(shard.tablet_map);
             tablets_under_transition = std::move(shard.tablets_under_transition);
+            auto copy = [this](tablet_map_t& map) {
+                map = tablet_map;
+                return 1;
+            };
+            lookup_map.Modify(copy);
         }
-        mutable std::shared_mutex lock;
+        // Must be called along with the modification of tablet_map, with the write lock held.
+        void add_to_lookup_map(TTabletId tablet_id, const TabletSharedPtr& tablet) {
+            auto add = [&](tablet_map_t& map) {
+                map[tablet_id] = tablet;
+                return 1;
+            };
+            lookup_map.Modify(add);
+        }
+        void remove_from_lookup_map(TTabletId tablet_id) {
+            auto remove = [&](tablet_map_t& map) {
+                map.erase(tablet_id);
+                return 1;
+            };
+            lookup_map.Modify(remove);
+        }
+        mutable ProfiledSharedMutex lock;
         tablet_map_t tablet_map;
+        // A copy of tablet_map for the lookups and the full walks, which read it without the lock,
+        // so they neither wait for nor block the writers of the shard. A reader only takes a
+        // thread local lock, which a writer waits for after it switches the buffers.
+        butil::DoublyBufferedData<tablet_map_t> lookup_map;
         std::mutex lock_for_transition;
         // tablet do clone, path gc, move to trash, disk migrate will record in tablets_under_transition
         // tablet <reason, thread_id, lock_times>
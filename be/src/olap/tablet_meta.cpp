@@ -1473,6 +1473,10 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
                 val->bitmap |= bm;
             }
         }
+        if (config::enable_delete_bitmap_run_optimize) {
+            val->bitmap.runOptimize();
+            val->bitmap.shrinkToFit();
+        }
         size_t charge = val->bitmap.getSizeInBytes() + sizeof(DeleteBitmapAggCache::Value);
         handle = DeleteBitmapAggCache::instance()->insert(key, val, charge, charge,
                                                           CachePriority::NORMAL);
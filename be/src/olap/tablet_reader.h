@@ -130,6 +130,8 @@ public:
         // for compaction, schema_change, check_sum: we don't use page cache
         // for query and config::disable_storage_page_cache is false, we use page cache
         bool use_page_cache = false;
+        // cache the data read from the remote storage as disposable
+        bool disposable_file_cache = false;
         Version version = Version(-1, 0);
 
         std::vector<OlapTuple> start_key;
@@ -20,10 +20,11 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <glog/logging.h>
 #include <json2pb/pb_to_json.h>
+#include <xxh3.h>
 
 #include "bvar/bvar.h"
 #include "olap/tablet_schema.h"
-#include "util/sha.h"
+#include "util/coding.h"
 
 bvar::Adder<int64_t> g_tablet_schema_cache_count("tablet_schema_cache_count");
 bvar::Adder<int64_t> g_tablet_schema_cache_columns_count("tablet_schema_cache_columns_count");
@@ -32,11 +33,16 @@ bvar::Adder<int64_t> g_tablet_schema_cache_hit_count("tablet_schema_cache_hit_co
 namespace doris {
 
 // to reduce the memory consumption of the serialized TabletSchema as key.
-// use sha256 to prevent from hash collision
+// The signature is the 128 bits hash and the length of the key. It's computed for the schema of
+// every rowset, and a cryptographic hash like sha256 costs milliseconds for the wide schemas of
+// thousands of columns, e.g. the schemas of variant tables.
 static std::string get_key_signature(const std::string& origin) {
-    SHA256Digest digest;
-    digest.reset(origin.data(), origin.length());
-    return std::string {digest.digest().data(), digest.digest().length()};
+    XXH128_hash_t hash = XXH3_128bits(origin.data(), origin.length());
+    std::string signature;
+    put_fixed64_le(&signature, hash.high64);
+    put_fixed64_le(&signature, hash.low64);
+    put_fixed64_le(&signature, origin.length());
+    return signature;
 }
 
 std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std::string& key) {
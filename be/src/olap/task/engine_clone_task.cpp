@@ -65,6 +65,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -676,8 +677,10 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
-    std::vector<std::pair<std::string, size_t>> batch_files;
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
+    std::vector<size_t> batch_file_sizes;
     for (size_t i = 0; i < total_files;) {
+        std::vector<std::pair<std::string, size_t>> batch_files;
         size_t batch_file_size = 0;
         for (size_t j = i; j < total_files; j++) {
             // Split batchs by file number and file size,
@@ -689,20 +692,71 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_files.push_back(file_info_list[j]);
             batch_file_size += file_info_list[j].second;
         }
+        i += batch_files.size();
+        batches.push_back(std::move(batch_files));
+        batch_file_sizes.push_back(batch_file_size);
+    }
 
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
-            return Status::Error<EXCEEDED_LIMIT>(
-                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                    batch_file_size);
+    // The batches but the last one, which is the .hdr file, are downloaded in parallel.
+    std::unique_ptr<ThreadPool> download_pool;
+    int num_threads = batches.empty() ? 0
+                                      : std::min(config::clone_batch_download_parallelism,
+                                                 static_cast<int32_t>(batches.size() - 1));
+    if (num_threads > 1) {
+        auto st = ThreadPoolBuilder("CloneBatchDownloadPool")
+                          .set_min_threads(num_threads)
+                          .set_max_threads(num_threads)
+                          .build(&download_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build clone download pool, download the files batch by "
+                         << "batch. tablet=" << _clone_req.tablet_id << ", st=" << st;
+            download_pool.reset();
         }
-
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
-        total_file_size += batch_file_size;
-        i += batch_files.size();
-        batch_files.clear();
     }
+    std::mutex download_status_mutex;
+    Status download_status;
+    auto download_batch = [&](size_t batch) {
+        auto st = download_files_v2(address, token, remote_dir, local_dir, batches[batch]);
+        if (!st.ok()) {
+            std::lock_guard lock(download_status_mutex);
+            if (download_status.ok()) {
+                download_status = st;
+            }
+        }
+    };
+    for (size_t batch = 0; batch < batches.size(); ++batch) {
+        if (batch + 1 == batches.size() && download_pool != nullptr) {
+            download_pool->wait();
+        }
+        {
+            std::lock_guard lock(download_status_mutex);
+            if (!download_status.ok()) {
+                break;
+            }
+            // check disk capacity
+            if (data_dir->reach_capacity_limit(batch_file_sizes[batch])) {
+                download_status = Status::Error<EXCEEDED_LIMIT>(
+                        "reach the capacity limit of path {}, file_size={}", data_dir->path(),
+                        batch_file_sizes[batch]);
+                break;
+            }
+        }
+        total_file_size += batch_file_sizes[batch];
+        if (batch + 1 < batches.size() && download_pool != nullptr) {
+            auto st = download_pool->submit_func([&download_batch, batch, this] {
+                SCOPED_ATTACH_TASK(_mem_tracker);
+                download_batch(batch);
+            });
+            if (st.ok()) {
+                continue;
+            }
+        }
+        download_batch(batch);
+    }
+    if (download_pool != nullptr) {
+        download_pool->wait();
+    }
+    RETURN_IF_ERROR(download_status);
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -61,6 +61,8 @@ static bvar::LatencyRecorder g_tablet_publish_partial_update_latency(
         "doris_pk", "tablet_publish_partial_update");
 static bvar::LatencyRecorder g_tablet_publish_add_inc_latency("doris_pk",
                                                               "tablet_publish_add_inc_rowset");
+static bvar::Adder<int64_t> g_tablet_publish_batch_versions("doris_pk",
+                                                            "tablet_publish_batch_versions");
 
 void TabletPublishStatistics::record_in_bvar() {
     g_tablet_publish_schedule_latency << schedule_time_us;
@@ -219,8 +221,9 @@ Status EnginePublishVersionTask::execute() {
                         add_error_tablet_id(tablet_info.tablet_id);
                         // When there are too many missing versions, do not directly retry the
                         // publish and handle it through async publish.
-                        if (max_version + config::mow_publish_max_discontinuous_version_num <
-                            version.first) {
+                        if (config::mow_publish_max_batch_versions > 0 ||
+                            max_version + config::mow_publish_max_discontinuous_version_num <
+                                    version.first) {
                             _engine.add_async_publish_task(
                                     partition_id, tablet_info.tablet_id, version.first,
                                     _publish_version_req.transaction_id, false);
@@ -439,6 +442,65 @@ Status publish_version_and_add_rowset(StorageEngine& engine, int64_t partition_i
     return result;
 }
 
+// Publish the version the async publish task of the tablet waits for. The caller holds the rowset
+// update lock of the tablet.
+static Status publish_pending_version(StorageEngine& engine, const TabletSharedPtr& tablet,
+                                      int64_t partition_id, int64_t transaction_id,
+                                      int64_t version, TabletPublishStatistics& stats) {
+    std::map<TabletInfo, RowsetSharedPtr> tablet_related_rs;
+    engine.txn_manager()->get_txn_related_tablets(transaction_id, partition_id,
+                                                  &tablet_related_rs);
+    auto iter = tablet_related_rs.find(TabletInfo(tablet->tablet_id(), tablet->tablet_uid()));
+    if (iter == tablet_related_rs.end()) {
+        return Status::Error<TRANSACTION_NOT_EXIST>(
+                "publish txn failed, rowset not found. tablet_id={}, transaction_id={}",
+                tablet->tablet_id(), transaction_id);
+    }
+    RowsetSharedPtr rowset = iter->second;
+    RETURN_IF_ERROR(publish_version_and_add_rowset(engine, partition_id, tablet, rowset,
+                                                   transaction_id, Version(version, version),
+                                                   nullptr, stats));
+
+    int64_t cost_us = MonotonicMicros() - stats.submit_time_us;
+    // print stats if publish cost > 500ms
+    g_tablet_publish_latency << cost_us;
+    stats.record_in_bvar();
+    LOG(INFO) << "async publish version successfully on tablet, table_id=" << tablet->table_id()
+              << ", tablet=" << tablet->tablet_id() << ", transaction_id=" << transaction_id
+              << ", version=" << version << ", num_rows=" << rowset->num_rows()
+              << ", cost: " << cost_us << "(us) "
+              << (cost_us > 500 * 1000 ? stats.to_string() : "");
+    return Status::OK();
+}
+
+// After `version` of a merge-on-write tablet is published, publish the following versions waiting
+// in async publish right away, each of them only becomes continuous by the one before it. The
+// caller holds the rowset update lock of the tablet.
+static void publish_following_pending_versions(StorageEngine& engine,
+                                               const TabletSharedPtr& tablet, int64_t version) {
+    for (int32_t i = 0; i < config::mow_publish_max_batch_versions; ++i) {
+        int64_t next_version = version + 1;
+        int64_t transaction_id = 0;
+        int64_t partition_id = 0;
+        if (!engine.take_async_publish_task(tablet->tablet_id(), next_version, &transaction_id,
+                                            &partition_id)) {
+            return;
+        }
+        TabletPublishStatistics stats;
+        stats.submit_time_us = MonotonicMicros();
+        Status st = publish_pending_version(engine, tablet, partition_id, transaction_id,
+                                            next_version, stats);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to publish pending version. tablet_id=" << tablet->tablet_id()
+                         << ", txn_id=" << transaction_id << ", version=" << next_version
+                         << ", res=" << st;
+            return;
+        }
+        g_tablet_publish_batch_versions << 1;
+        version = next_version;
+    }
+}
+
 void TabletPublishTxnTask::handle() {
     std::shared_lock migration_rlock(_tablet->get_migration_lock(), std::chrono::seconds(5));
     SCOPED_ATTACH_TASK(_mem_tracker);
@@ -461,6 +523,9 @@ void TabletPublishTxnTask::handle() {
     if (!_result.ok()) {
         return;
     }
+    if (_tablet->enable_unique_key_merge_on_write()) {
+        publish_following_pending_versions(_engine, _tablet, _version.second);
+    }
 
     int64_t cost_us = MonotonicMicros() - _stats.submit_time_us;
     g_tablet_publish_latency << cost_us;
@@ -485,32 +550,12 @@ void AsyncTabletPublishTask::handle() {
     }
     std::lock_guard<std::mutex> wrlock(_tablet->get_rowset_update_lock());
     _stats.schedule_time_us = MonotonicMicros() - _stats.submit_time_us;
-    std::map<TabletInfo, RowsetSharedPtr> tablet_related_rs;
-    _engine.txn_manager()->get_txn_related_tablets(_transaction_id, _partition_id,
-                                                   &tablet_related_rs);
-    auto iter = tablet_related_rs.find(TabletInfo(_tablet->tablet_id(), _tablet->tablet_uid()));
-    if (iter == tablet_related_rs.end()) {
+    if (!publish_pending_version(_engine, _tablet, _partition_id, _transaction_id, _version,
+                                 _stats)
+                 .ok()) {
         return;
     }
-    RowsetSharedPtr rowset = iter->second;
-    Version version(_version, _version);
-
-    auto publish_status = publish_version_and_add_rowset(_engine, _partition_id, _tablet, rowset,
-                                                         _transaction_id, version, nullptr, _stats);
-
-    if (!publish_status.ok()) {
-        return;
-    }
-
-    int64_t cost_us = MonotonicMicros() - _stats.submit_time_us;
-    // print stats if publish cost > 500ms
-    g_tablet_publish_latency << cost_us;
-    _stats.record_in_bvar();
-    LOG(INFO) << "async publish version successfully on tablet, table_id=" << _tablet->table_id()
-              << ", tablet=" << _tablet->tablet_id() << ", transaction_id=" << _transaction_id
-              << ", version=" << _version << ", num_rows=" << rowset->num_rows()
-              << ", res=" << publish_status << ", cost: " << cost_us << "(us) "
-              << (cost_us > 500 * 1000 ? _stats.to_string() : "");
+    publish_following_pending_versions(_engine, _tablet, _version);
 }
 
 } // namespace doris
@@ -68,6 +68,12 @@ namespace doris {
 using namespace ErrorCode;
 
 bvar::Adder<int64_t> g_tablet_txn_info_txn_partitions_count("tablet_txn_info_txn_partitions_count");
+// from the commit to the publish of a txn on a tablet
+bvar::LatencyRecorder g_tablet_txn_visible_latency("tablet_txn_visible");
+
+static LockContentionSite g_txn_map_lock_site("txn_manager_txn_map");
+static LockContentionSite g_txn_lock_site("txn_manager_txn");
+static LockContentionSite g_txn_delta_writer_map_lock_site("txn_manager_txn_delta_writer_map");
 
 TxnManager::TxnManager(StorageEngine& engine, int32_t txn_map_shard_size, int32_t txn_shard_size)
         : _engine(engine),
@@ -77,14 +83,22 @@ TxnManager::TxnManager(StorageEngine& engine, int32_t txn_map_shard_size, int32_
     DCHECK_GT(_txn_shard_size, 0);
     DCHECK_EQ(_txn_map_shard_size & (_txn_map_shard_size - 1), 0);
     DCHECK_EQ(_txn_shard_size & (_txn_shard_size - 1), 0);
-    _txn_map_locks = new std::shared_mutex[_txn_map_shard_size];
+    _txn_map_locks = new ProfiledSharedMutex[_txn_map_shard_size];
     _txn_tablet_maps = new txn_tablet_map_t[_txn_map_shard_size];
     _txn_partition_maps = new txn_partition_map_t[_txn_map_shard_size];
-    _txn_mutex = new std::shared_mutex[_txn_shard_size];
+    _txn_mutex = new ProfiledSharedMutex[_txn_shard_size];
     _txn_tablet_delta_writer_map = new txn_tablet_delta_writer_map_t[_txn_map_shard_size];
-    _txn_tablet_delta_writer_map_locks = new std::shared_mutex[_txn_map_shard_size];
+    _txn_tablet_delta_writer_map_locks = new ProfiledSharedMutex[_txn_map_shard_size];
     // For debugging
     _tablet_version_cache = std::make_unique<TabletVersionCache>(100000);
+    for (int32_t i = 0; i < _txn_map_shard_size; i++) {
+        _txn_map_locks[i].set_contention_site(&g_txn_map_lock_site);
+        _txn_tablet_delta_writer_map_locks[i].set_contention_site(
+                &g_txn_delta_writer_map_lock_site);
+    }
+    for (int32_t i = 0; i < _txn_shard_size; i++) {
+        _txn_mutex[i].set_contention_site(&g_txn_lock_site);
+    }
 }
 
 // prepare txn should always be allowed because ingest task will be retried
@@ -112,7 +126,7 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
                                bool ingest) {
     TxnKey key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
-    std::lock_guard<std::shared_mutex> txn_wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
 
     DBUG_EXECUTE_IF("TxnManager.prepare_txn.random_failed", {
@@ -250,10 +264,10 @@ void TxnManager::set_txn_related_delete_bitmap(
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
 
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_lock(_get_txn_lock(transaction_id));
     {
         // get tx
-        std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+        std::lock_guard<ProfiledSharedMutex> wrlock(_get_txn_map_lock(transaction_id));
         txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
         auto it = txn_tablet_map.find(key);
         if (it == txn_tablet_map.end()) {
@@ -316,7 +330,7 @@ Status TxnManager::commit_txn(OlapMeta* meta, TPartitionId partition_id,
         }
     });
 
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_lock(_get_txn_lock(transaction_id));
     // this while loop just run only once, just for if break
     do {
         // get tx
@@ -424,7 +438,7 @@ Status TxnManager::commit_txn(OlapMeta* meta, TPartitionId partition_id,
     }
 
     {
-        std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+        std::lock_guard<ProfiledSharedMutex> wrlock(_get_txn_map_lock(transaction_id));
         auto load_info = std::make_shared<TabletTxnInfo>(load_id, rowset_ptr);
         load_info->pending_rs_guard = std::move(guard);
         if (is_recovery) {
@@ -609,11 +623,14 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
     /// Step 5: remove tablet_info from tnx_tablet_map
     // txn_tablet_map[key] empty, remove key from txn_tablet_map
     int64_t t6 = MonotonicMicros();
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> wrlock(_get_txn_map_lock(transaction_id));
     stats->lock_wait_time_us += MonotonicMicros() - t6;
     _remove_txn_tablet_info_unlocked(partition_id, transaction_id, tablet_id, tablet_uid, txn_lock,
                                      wrlock);
+    if (tablet_txn_info->commit_time_us > 0) {
+        g_tablet_txn_visible_latency << MonotonicMicros() - tablet_txn_info->commit_time_us;
+    }
     VLOG_NOTICE << "publish txn successfully."
                 << " partition_id: " << key.first << ", txn_id: " << key.second
                 << ", tablet_id: " << tablet_info.tablet_id << ", rowsetid: " << rowset->rowset_id()
@@ -624,8 +641,8 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
 void TxnManager::_remove_txn_tablet_info_unlocked(TPartitionId partition_id,
                                                   TTransactionId transaction_id,
                                                   TTabletId tablet_id, TabletUid tablet_uid,
-                                                  std::lock_guard<std::shared_mutex>& txn_lock,
-                                                  std::lock_guard<std::shared_mutex>& wrlock) {
+                                                  std::lock_guard<ProfiledSharedMutex>& txn_lock,
+                                                  std::lock_guard<ProfiledSharedMutex>& wrlock) {
     std::pair<int64_t, int64_t> key {partition_id, transaction_id};
     TabletInfo tablet_info {tablet_id, tablet_uid};
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
@@ -641,8 +658,8 @@ void TxnManager::_remove_txn_tablet_info_unlocked(TPartitionId partition_id,
 
 void TxnManager::remove_txn_tablet_info(TPartitionId partition_id, TTransactionId transaction_id,
                                         TTabletId tablet_id, TabletUid tablet_uid) {
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> wrlock(_get_txn_map_lock(transaction_id));
     _remove_txn_tablet_info_unlocked(partition_id, transaction_id, tablet_id, tablet_uid, txn_lock,
                                      wrlock);
 }
@@ -656,7 +673,7 @@ Status TxnManager::rollback_txn(TPartitionId partition_id, TTransactionId transa
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
 
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
 
     auto it = txn_tablet_map.find(key);
@@ -696,7 +713,7 @@ Status TxnManager::delete_txn(OlapMeta* meta, TPartitionId partition_id,
                               TabletUid tablet_uid) {
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
-    std::lock_guard<std::shared_mutex> txn_wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard<ProfiledSharedMutex> txn_wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it == txn_tablet_map.end()) {
@@ -770,7 +787,7 @@ void TxnManager::force_rollback_tablet_related_txns(OlapMeta* meta, TTabletId ta
                                                     TabletUid tablet_uid) {
     TabletInfo tablet_info(tablet_id, tablet_uid);
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::lock_guard<std::shared_mutex> txn_wrlock(_txn_map_locks[i]);
+        std::lock_guard<ProfiledSharedMutex> txn_wrlock(_txn_map_locks[i]);
         txn_tablet_map_t& txn_tablet_map = _txn_tablet_maps[i];
         for (auto it = txn_tablet_map.begin(); it != txn_tablet_map.end();) {
             auto load_itr = it->second.find(tablet_info);
@@ -927,7 +944,7 @@ void TxnManager::_clear_txn_partition_map_unlocked(int64_t transaction_id, int64
 
 void TxnManager::add_txn_tablet_delta_writer(int64_t transaction_id, int64_t tablet_id,
                                              DeltaWriter* delta_writer) {
-    std::lock_guard<std::shared_mutex> txn_wrlock(
+    std::lock_guard<ProfiledSharedMutex> txn_wrlock(
             _get_txn_tablet_delta_writer_map_lock(transaction_id));
     txn_tablet_delta_writer_map_t& txn_tablet_delta_writer_map =
             _get_txn_tablet_delta_writer_map(transaction_id);
@@ -940,7 +957,7 @@ void TxnManager::add_txn_tablet_delta_writer(int64_t transaction_id, int64_t tab
 
 void TxnManager::finish_slave_tablet_pull_rowset(int64_t transaction_id, int64_t tablet_id,
                                                  int64_t node_id, bool is_succeed) {
-    std::lock_guard<std::shared_mutex> txn_wrlock(
+    std::lock_guard<ProfiledSharedMutex> txn_wrlock(
             _get_txn_tablet_delta_writer_map_lock(transaction_id));
     txn_tablet_delta_writer_map_t& txn_tablet_delta_writer_map =
             _get_txn_tablet_delta_writer_map(transaction_id);
@@ -961,7 +978,7 @@ void TxnManager::finish_slave_tablet_pull_rowset(int64_t transaction_id, int64_t
 }
 
 void TxnManager::clear_txn_tablet_delta_writer(int64_t transaction_id) {
-    std::lock_guard<std::shared_mutex> txn_wrlock(
+    std::lock_guard<ProfiledSharedMutex> txn_wrlock(
             _get_txn_tablet_delta_writer_map_lock(transaction_id));
     txn_tablet_delta_writer_map_t& txn_tablet_delta_writer_map =
             _get_txn_tablet_delta_writer_map(transaction_id);
@@ -44,6 +44,7 @@
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
 #include "runtime/memory/lru_cache_policy.h"
+#include "util/lock_contention.h"
 #include "util/time.h"
 #include "vec/core/block.h"
 
@@ -79,6 +80,8 @@ struct TabletTxnInfo {
     // records rowsets calc in commit txn
     RowsetIdUnorderedSet rowset_ids;
     int64_t creation_time;
+    // MonotonicMicros() when the txn is committed, to record the visible latency in publish
+    int64_t commit_time_us {0};
     bool ingest {false};
     std::shared_ptr<PartialUpdateInfo> partial_update_info;
 
@@ -117,7 +120,10 @@ struct TabletTxnInfo {
               creation_time(UnixSeconds()) {}
 
     void prepare() { state = TxnState::PREPARED; }
-    void commit() { state = TxnState::COMMITTED; }
+    void commit() {
+        state = TxnState::COMMITTED;
+        commit_time_us = MonotonicMicros();
+    }
     void rollback() { state = TxnState::ROLLEDBACK; }
     void abort() {
         if (state == TxnState::PREPARED) {
@@ -276,15 +282,15 @@ private:
     using txn_tablet_delta_writer_map_t =
             std::unordered_map<int64_t, std::map<int64_t, DeltaWriter*>>;
 
-    std::shared_mutex& _get_txn_map_lock(TTransactionId transactionId);
+    ProfiledSharedMutex& _get_txn_map_lock(TTransactionId transactionId);
 
     txn_tablet_map_t& _get_txn_tablet_map(TTransactionId transactionId);
 
     txn_partition_map_t& _get_txn_partition_map(TTransactionId transactionId);
 
-    inline std::shared_mutex& _get_txn_lock(TTransactionId transactionId);
+    inline ProfiledSharedMutex& _get_txn_lock(TTransactionId transactionId);
 
-    std::shared_mutex& _get_txn_tablet_delta_writer_map_lock(TTransactionId transactionId);
+    ProfiledSharedMutex& _get_txn_tablet_delta_writer_map_lock(TTransactionId transactionId);
 
     txn_tablet_delta_writer_map_t& _get_txn_tablet_delta_writer_map(TTransactionId transactionId);
 
@@ -295,8 +301,8 @@ private:
 
     void _remove_txn_tablet_info_unlocked(TPartitionId partition_id, TTransactionId transaction_id,
                                           TTabletId tablet_id, TabletUid tablet_uid,
-                                          std::lock_guard<std::shared_mutex>& txn_lock,
-                                          std::lock_guard<std::shared_mutex>& wrlock);
+                                          std::lock_guard<ProfiledSharedMutex>& txn_lock,
+                                          std::lock_guard<ProfiledSharedMutex>& wrlock);
 
     class TabletVersionCache : public LRUCachePolicy {
     public:
@@ -321,17 +327,17 @@ private:
     // The _txn_partition_maps[i] should be constructed/deconstructed/modified alongside with '_txn_tablet_maps[i]'
     txn_partition_map_t* _txn_partition_maps = nullptr;
 
-    std::shared_mutex* _txn_map_locks = nullptr;
+    ProfiledSharedMutex* _txn_map_locks = nullptr;
 
-    std::shared_mutex* _txn_mutex = nullptr;
+    ProfiledSharedMutex* _txn_mutex = nullptr;
 
     txn_tablet_delta_writer_map_t* _txn_tablet_delta_writer_map = nullptr;
     std::unique_ptr<TabletVersionCache> _tablet_version_cache;
-    std::shared_mutex* _txn_tablet_delta_writer_map_locks = nullptr;
+    ProfiledSharedMutex* _txn_tablet_delta_writer_map_locks = nullptr;
     DISALLOW_COPY_AND_ASSIGN(TxnManager);
 }; // TxnManager
 
-inline std::shared_mutex& TxnManager::_get_txn_map_lock(TTransactionId transactionId) {
+inline ProfiledSharedMutex& TxnManager::_get_txn_map_lock(TTransactionId transactionId) {
     return _txn_map_locks[transactionId & (_txn_map_shard_size - 1)];
 }
 
@@ -344,11 +350,11 @@ inline TxnManager::txn_partition_map_t& TxnManager::_get_txn_partition_map(
     return _txn_partition_maps[transactionId & (_txn_map_shard_size - 1)];
 }
 
-inline std::shared_mutex& TxnManager::_get_txn_lock(TTransactionId transactionId) {
+inline ProfiledSharedMutex& TxnManager::_get_txn_lock(TTransactionId transactionId) {
     return _txn_mutex[transactionId & (_txn_shard_size - 1)];
 }
 
-inline std::shared_mutex& TxnManager::_get_txn_tablet_delta_writer_map_lock(
+inline ProfiledSharedMutex& TxnManager::_get_txn_tablet_delta_writer_map_lock(
         TTransactionId transactionId) {
     return _txn_tablet_delta_writer_map_locks[transactionId & (_txn_map_shard_size - 1)];
 }
@@ -17,16 +17,24 @@
 
 #include "olap/wal/wal_writer.h"
 
+#include <bvar/bvar.h>
+
 #include "common/config.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_file_writer.h"
 #include "io/fs/path.h"
 #include "olap/storage_engine.h"
 #include "olap/wal/wal_manager.h"
 #include "util/crc32c.h"
+#include "util/time.h"
 
 namespace doris {
 
+bvar::LatencyRecorder g_wal_sync_latency("wal_sync_latency_us");
+// the appends covered by one sync, the batching efficiency of the syncs
+bvar::IntRecorder g_wal_appends_per_sync("wal_appends_per_sync");
+
 const char* k_wal_magic = "WAL1";
 const uint32_t k_wal_magic_length = 4;
 
@@ -43,6 +51,15 @@ Status WalWriter::init() {
         RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(parent_path));
     }
     RETURN_IF_ERROR(io::global_local_filesystem()->create_file(_file_name, &_file_writer));
+    if (config::group_commit_wal_preallocate_bytes > 0) {
+        // the disk space is reserved in one allocation, and the sync of an append doesn't need
+        // to update the allocation of the file
+        auto st = static_cast<io::LocalFileWriter*>(_file_writer.get())
+                          ->preallocate(config::group_commit_wal_preallocate_bytes);
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to preallocate wal " << _file_name << ", st=" << st;
+        }
+    }
     LOG(INFO) << "create wal " << _file_name;
     return Status::OK();
 }
@@ -87,9 +104,40 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
                 "failed to write block to wal expected= " + std::to_string(total_size) +
                 ",actually=" + std::to_string(offset));
     }
+    _append_count.fetch_add(1);
     return Status::OK();
 }
 
+Status WalWriter::sync() {
+    if (!_file_writer) {
+        return Status::InternalError("wal writer is null,fail to sync file={}", _file_name);
+    }
+    uint64_t append_count = _append_count.load();
+    std::unique_lock l(_sync_mutex);
+    while (_synced_count < append_count && _sync_status.ok()) {
+        if (_syncing) {
+            _sync_cv.wait(l);
+            continue;
+        }
+        _syncing = true;
+        uint64_t sync_count = _append_count.load();
+        l.unlock();
+        int64_t start_us = MonotonicMicros();
+        Status st = static_cast<io::LocalFileWriter*>(_file_writer.get())->sync_data();
+        g_wal_sync_latency << MonotonicMicros() - start_us;
+        l.lock();
+        _syncing = false;
+        if (st.ok()) {
+            g_wal_appends_per_sync << static_cast<int64_t>(sync_count - _synced_count);
+            _synced_count = sync_count;
+        } else {
+            _sync_status = st;
+        }
+        _sync_cv.notify_all();
+    }
+    return _sync_status;
+}
+
 Status WalWriter::append_header(std::string col_ids) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
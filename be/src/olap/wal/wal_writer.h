@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "common/status.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "io/fs/file_reader_writer_fwd.h"
@@ -37,6 +41,9 @@ public:
 
     Status append_blocks(const PBlockArray& blocks);
     Status append_header(std::string col_ids);
+    // Sync the blocks appended before. A caller that finds a sync in progress waits for it, then
+    // the next sync covers the blocks appended by all the callers waiting meanwhile.
+    Status sync();
 
     std::string file_name() { return _file_name; };
 
@@ -48,6 +55,14 @@ public:
 private:
     std::string _file_name;
     io::FileWriterPtr _file_writer;
+
+    // the number of the appends, and the number of them synced
+    std::atomic<uint64_t> _append_count = 0;
+    uint64_t _synced_count = 0;
+    bool _syncing = false;
+    Status _sync_status;
+    std::mutex _sync_mutex;
+    std::condition_variable _sync_cv;
 };
 
 } // namespace doris
\ No newline at end of file
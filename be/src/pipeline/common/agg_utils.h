@@ -20,6 +20,7 @@
 #include <variant>
 #include <vector>
 
+#include "common/config.h"
 #include "vec/common/arena.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
@@ -35,6 +36,8 @@ using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
+using AggregatedDataWithStringKeyTwoLevel =
+        PHHashMap<StringRef, vectorized::AggregateDataPtr, DefaultHash<StringRef>, true>;
 using AggregatedDataWithShortStringKey = StringHashMap<vectorized::AggregateDataPtr>;
 
 using AggregatedDataWithUInt32KeyPhase2 =
@@ -53,6 +56,7 @@ using AggregatedDataWithNullableShortStringKey =
 
 using AggregatedMethodVariants = std::variant<
         std::monostate, vectorized::MethodSerialized<AggregatedDataWithStringKey>,
+        vectorized::MethodSerialized<AggregatedDataWithStringKeyTwoLevel>,
         vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>,
         vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggData<vectorized::UInt32>>,
@@ -85,6 +89,14 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodKeysFixed<AggData<vectorized::UInt256>>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt136>>>;
 
+// Low cardinality string keys usually come in runs of the same value, e.g. they are decoded from
+// the same dictionary page or sorted by the key, so a row can reuse the place of the previous row
+// without hashing and probing the hash table when their keys are equal.
+template <typename HashMethodType>
+constexpr bool reuse_place_of_same_key =
+        std::is_same_v<HashMethodType,
+                       vectorized::MethodStringNoCache<AggregatedDataWithShortStringKey>>;
+
 struct AggregatedDataVariants
         : public DataVariants<AggregatedMethodVariants, vectorized::MethodSingleNullableColumn,
                               vectorized::MethodOneNumber, vectorized::DataWithNullKey> {
@@ -97,7 +109,12 @@ struct AggregatedDataVariants
         case HashKeyType::without_key:
             break;
         case HashKeyType::serialized:
-            method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
+            if (config::enable_agg_two_level_hash_table) {
+                method_variant.emplace<
+                        vectorized::MethodSerialized<AggregatedDataWithStringKeyTwoLevel>>();
+            } else {
+                method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
+            }
             break;
         case HashKeyType::int8_key:
             emplace_single<vectorized::UInt8, AggData<vectorized::UInt8>>(nullable);
@@ -17,6 +17,8 @@
 
 #include "pipeline/common/partition_sort_utils.h"
 
+#include <algorithm>
+
 namespace doris {
 #include "common/compile_check_begin.h"
 
@@ -42,7 +44,7 @@ Status PartitionBlocks::append_block_by_selector(const vectorized::Block* input_
         _selector.clear();
         // maybe better could change by user PARTITION_SORT_ROWS_THRESHOLD
         if (!eos && _partition_sort_info->_partition_inner_limit != -1 &&
-            _current_input_rows >= PARTITION_SORT_ROWS_THRESHOLD &&
+            _current_input_rows >= _sort_rows_threshold() &&
             _partition_sort_info->_topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL) {
             create_or_reset_sorter_state();
             RETURN_IF_ERROR(do_partition_topn_sort());
@@ -88,7 +90,48 @@ Status PartitionBlocks::do_partition_topn_sort() {
             _blocks.emplace_back(std::move(output_block));
         }
     }
+    if (_partition_sort_info->could_cutoff()) {
+        RETURN_IF_ERROR(_update_nth_row());
+    }
+    return Status::OK();
+}
+
+size_t PartitionBlocks::_sort_rows_threshold() const {
+    if (!_partition_sort_info->could_cutoff()) {
+        return PARTITION_SORT_ROWS_THRESHOLD;
+    }
+    auto limit = static_cast<size_t>(_partition_sort_info->_partition_inner_limit);
+    return std::min(PARTITION_SORT_ROWS_THRESHOLD,
+                    std::max(limit * PARTITION_CUTOFF_SORT_ROWS_FACTOR,
+                             PARTITION_CUTOFF_SORT_MIN_ROWS));
+}
 
+Status PartitionBlocks::_update_nth_row() {
+    size_t rows = 0;
+    for (const auto& block : _blocks) {
+        rows += block->rows();
+    }
+    // rank() outputs the ties of the nth row too, so the last row is the nth row or its tie
+    if (rows == 0 || rows < static_cast<size_t>(_partition_sort_info->_partition_inner_limit)) {
+        return Status::OK();
+    }
+    const auto& last_block = *_blocks.back();
+    auto nth_row = last_block.clone_empty();
+    {
+        auto columns = nth_row.mutate_columns();
+        for (size_t i = 0; i < columns.size(); ++i) {
+            columns[i]->insert_from(*last_block.get_by_position(i).column, last_block.rows() - 1);
+        }
+        nth_row.set_columns(std::move(columns));
+    }
+    vectorized::Columns sort_columns;
+    for (const auto& ctx : _partition_sort_info->_vsort_exec_exprs->ordering_expr_ctxs()) {
+        int column_id = -1;
+        RETURN_IF_ERROR(ctx->execute(&nth_row, &column_id));
+        sort_columns.push_back(
+                nth_row.get_by_position(column_id).column->convert_to_full_column_if_const());
+    }
+    _nth_row = std::move(sort_columns);
     return Status::OK();
 }
 
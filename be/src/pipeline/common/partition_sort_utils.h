@@ -53,6 +53,20 @@ struct PartitionSortInfo {
               _top_n_algorithm(top_n_algorithm),
               _topn_phase(topn_phase) {}
 
+    // The rows worse than the nth row of a partition could be dropped before they are buffered,
+    // once the nth row is found by a partition topn sort. It's not for dense_rank(), whose top n
+    // rows don't tell the nth distinct row.
+    bool could_cutoff() const {
+        return _partition_inner_limit > 0 && _topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL &&
+               !_vsort_exec_exprs->need_materialize_tuple() &&
+               (_has_global_limit || _top_n_algorithm != TopNAlgorithm::DENSE_RANK);
+    }
+
+    // PartitionSorter uses row_number() for a global limit
+    bool is_row_number() const {
+        return _has_global_limit || _top_n_algorithm == TopNAlgorithm::ROW_NUMBER;
+    }
+
 public:
     vectorized::VSortExecExprs* _vsort_exec_exprs = nullptr;
     int64_t _limit = -1;
@@ -76,6 +90,10 @@ static constexpr size_t PARTITION_SORT_ROWS_THRESHOLD = 5;
 #else
 static constexpr size_t PARTITION_SORT_ROWS_THRESHOLD = 20000;
 #endif
+// A partition with a small limit is sorted earlier when the worse rows could be dropped, so the
+// nth row of the partition is found before most rows are buffered.
+static constexpr size_t PARTITION_CUTOFF_SORT_ROWS_FACTOR = 4;
+static constexpr size_t PARTITION_CUTOFF_SORT_MIN_ROWS = 1024;
 
 struct PartitionBlocks {
 public:
@@ -103,6 +121,25 @@ public:
         return _init_rows <= 0 || _blocks.back()->bytes() > INITIAL_BUFFERED_BLOCK_BYTES;
     }
 
+    // Return true if the row is worse than the nth row of the partition, so it can't be in the
+    // top n rows. `sort_columns` are the results of the ordering exprs of the input block.
+    bool is_cutoff(const vectorized::Columns& sort_columns, size_t row) const {
+        if (_nth_row.empty()) {
+            return false;
+        }
+        for (size_t i = 0; i < _nth_row.size(); ++i) {
+            int direction = _partition_sort_info->_is_asc_order[i] ? 1 : -1;
+            int nulls_direction = _partition_sort_info->_nulls_first[i] ? -direction : direction;
+            int res = direction *
+                      sort_columns[i]->compare_at(row, 0, *_nth_row[i], nulls_direction);
+            if (res != 0) {
+                return res > 0;
+            }
+        }
+        // row_number() keeps any n rows of the ties, rank() keeps all of them
+        return _partition_sort_info->is_row_number();
+    }
+
     vectorized::IColumn::Selector _selector;
     std::vector<std::unique_ptr<vectorized::Block>> _blocks;
     size_t _current_input_rows = 0;
@@ -112,6 +149,12 @@ public:
     std::unique_ptr<vectorized::SortCursorCmp> _previous_row;
     std::unique_ptr<vectorized::PartitionSorter> _partition_topn_sorter = nullptr;
     std::shared_ptr<PartitionSortInfo> _partition_sort_info = nullptr;
+    // the results of the ordering exprs of the nth row of the partition, empty if not known yet
+    vectorized::Columns _nth_row;
+
+private:
+    size_t _sort_rows_threshold() const;
+    Status _update_nth_row();
 };
 
 using PartitionDataPtr = PartitionBlocks*;
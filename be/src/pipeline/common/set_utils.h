@@ -24,19 +24,19 @@
 
 namespace doris {
 
-struct RowRefWithFlag {
-    bool visited;
+// The row of the build block. Whether it's visited by a probe child is kept in
+// SetSharedState::probe_visited_rows instead, as the children are probed at the same time.
+struct RowRef {
     uint32_t row_num = 0;
-    RowRefWithFlag() = default;
+    RowRef() = default;
 #include "common/compile_check_avoid_begin.h"
     //To consider performance, checks are avoided here.
-    RowRefWithFlag(size_t row_num_count, bool is_visited = false)
-            : visited(is_visited), row_num(row_num_count) {}
+    RowRef(size_t row_num_count) : row_num(row_num_count) {}
 #include "common/compile_check_avoid_end.h"
 };
 
 template <typename T>
-using SetData = PHHashMap<T, RowRefWithFlag, HashCRC32<T>>;
+using SetData = PHHashMap<T, RowRef, HashCRC32<T>>;
 
 template <typename T>
 using SetFixedKeyHashTableContext = vectorized::MethodKeysFixed<SetData<T>>;
@@ -49,8 +49,8 @@ using SetPrimaryTypeHashTableContextNullable = vectorized::MethodSingleNullableC
         vectorized::MethodOneNumber<T, vectorized::DataWithNullKey<SetData<T>>>>;
 
 using SetSerializedHashTableContext =
-        vectorized::MethodSerialized<PHHashMap<StringRef, RowRefWithFlag>>;
-using SetMethodOneString = vectorized::MethodStringNoCache<PHHashMap<StringRef, RowRefWithFlag>>;
+        vectorized::MethodSerialized<PHHashMap<StringRef, RowRef>>;
+using SetMethodOneString = vectorized::MethodStringNoCache<PHHashMap<StringRef, RowRef>>;
 
 using SetHashTableVariants =
         std::variant<std::monostate, SetSerializedHashTableContext, SetMethodOneString,
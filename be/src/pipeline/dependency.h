@@ -663,8 +663,8 @@ struct SetSharedState : public BasicSharedState {
 public:
     /// default init
     vectorized::Block build_block; // build to source
-    //record element size in hashtable
-    int64_t valid_element_in_hash_tbl = 0;
+    // the rows of the build block, RowRef::row_num is less than it
+    size_t build_rows = 0;
     //first: idx mapped to column types
     //second: column_id, could point to origin column or cast column
     std::unordered_map<int, int> build_col_idx;
@@ -692,6 +692,13 @@ public:
 
     /// init in probe side
     std::vector<vectorized::VExprContextSPtrs> probe_child_exprs_lists;
+    // The rows of the build block found by each probe child, indexed by RowRef::row_num. Every
+    // probe child marks its own flags, so all of them are probed at the same time once the hash
+    // table is built, and the last finished one merges the flags into visited_rows.
+    std::vector<std::vector<uint8_t>> probe_visited_rows;
+    std::atomic<size_t> probe_finished_children = 0;
+    // the rows found by all the probe children for intersect, by any of them for except
+    std::vector<uint8_t> visited_rows;
 
     std::atomic<bool> ready_for_read = false;
 
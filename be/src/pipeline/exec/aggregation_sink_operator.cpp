@@ -565,6 +565,12 @@ void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* p
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
                            for (size_t i = 0; i < num_rows; ++i) {
+                               if constexpr (reuse_place_of_same_key<HashMethodType>) {
+                                   if (i > 0 && agg_method.keys[i] == agg_method.keys[i - 1]) {
+                                       places[i] = places[i - 1];
+                                       continue;
+                                   }
+                               }
                                places[i] = *agg_method.lazy_emplace(state, i, creator,
                                                                     creator_for_null_key);
                            }
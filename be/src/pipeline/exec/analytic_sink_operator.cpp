@@ -26,6 +26,8 @@
 
 #include "pipeline/exec/operator.h"
 #include "runtime/runtime_state.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 
 namespace doris::pipeline {
@@ -119,6 +121,9 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     _result_column_could_resize.resize(_agg_functions_size);
     _use_null_result.resize(_agg_functions_size, 0);
     _could_use_previous_result.resize(_agg_functions_size, 0);
+    _sliding_modes.resize(_agg_functions_size, SlidingMode::RECOMPUTE);
+    _monotonic_rows.resize(_agg_functions_size);
+    _monotonic_rows_end.resize(_agg_functions_size, 0);
 
     for (int i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i] = p._agg_functions[i]->clone(state, state->obj_pool());
@@ -137,8 +142,22 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
         if (PARTITION_FUNCTION_SET.contains(_agg_functions[i]->function()->get_name())) {
             _streaming_mode = false;
         }
-        _support_incremental_calculate &=
-                _agg_functions[i]->function()->supported_incremental_mode();
+        if (_support_incremental_calculate &&
+            _agg_functions[i]->function()->supported_incremental_mode()) {
+            _sliding_modes[i] = SlidingMode::INCREMENTAL;
+            const auto& name = _agg_functions[i]->function()->get_name();
+            // compare_at doesn't order NaN the way min/max do
+            if (_agg_expr_ctxs[i].size() == 1 &&
+                !is_float_or_double(vectorized::remove_nullable(
+                                            _agg_expr_ctxs[i][0]->root()->data_type())
+                                            ->get_primitive_type())) {
+                if (name == "max" || name == "Nullable(max)") {
+                    _sliding_modes[i] = SlidingMode::MONOTONIC_MAX;
+                } else if (name == "min" || name == "Nullable(min)") {
+                    _sliding_modes[i] = SlidingMode::MONOTONIC_MIN;
+                }
+            }
+        }
     }
 
     _partition_exprs_size = p._partition_by_eq_expr_ctxs.size();
@@ -203,17 +222,7 @@ bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_ro
             _need_more_data = true;
             break;
         }
-        if (_support_incremental_calculate) {
-            _execute_for_function<true>(_partition_by_pose.start, _partition_by_pose.end,
-                                        current_row_start, current_row_end);
-        } else {
-            _reset_agg_status();
-            // Eg: rows between unbounded preceding and 10 preceding
-            // Make sure range_start <= range_end
-            current_row_start = std::min(current_row_start, current_row_end);
-            _execute_for_function(_partition_by_pose.start, _partition_by_pose.end,
-                                  current_row_start, current_row_end);
-        }
+        _execute_for_sliding_rows(current_row_start, current_row_end);
 
         int64_t pos = current_pos_in_block();
         _insert_result_info(pos, pos + 1);
@@ -399,6 +408,78 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     }
 }
 
+void AnalyticSinkLocalState::_execute_for_sliding_rows(int64_t frame_start, int64_t frame_end) {
+    // here is the core function, should not add timer
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        std::vector<const vectorized::IColumn*> agg_columns;
+        for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
+            agg_columns.push_back(_agg_input_columns[i][j].get());
+        }
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        switch (_sliding_modes[i]) {
+        case SlidingMode::INCREMENTAL:
+            _agg_functions[i]->function()->execute_function_with_incremental(
+                    _partition_by_pose.start, _partition_by_pose.end, frame_start, frame_end, place,
+                    agg_columns.data(), _agg_arena_pool, false, false, false, &_use_null_result[i],
+                    &_could_use_previous_result[i]);
+            break;
+        case SlidingMode::MONOTONIC_MAX:
+        case SlidingMode::MONOTONIC_MIN:
+            _execute_for_monotonic_rows(i, place, agg_columns.data(), frame_start, frame_end);
+            break;
+        case SlidingMode::RECOMPUTE:
+            _use_null_result[i] = 0;
+            _could_use_previous_result[i] = 0;
+            _agg_functions[i]->reset(place);
+            // Eg: rows between 5 preceding and 10 preceding
+            // Make sure range_start <= range_end
+            _agg_functions[i]->function()->add_range_single_place(
+                    _partition_by_pose.start, _partition_by_pose.end,
+                    std::min(frame_start, frame_end), frame_end, place, agg_columns.data(),
+                    _agg_arena_pool, &_use_null_result[i], &_could_use_previous_result[i]);
+            break;
+        }
+    }
+}
+
+void AnalyticSinkLocalState::_execute_for_monotonic_rows(size_t i,
+                                                         vectorized::AggregateDataPtr place,
+                                                         const vectorized::IColumn** columns,
+                                                         int64_t frame_start, int64_t frame_end) {
+    const int64_t start = std::max(frame_start, _partition_by_pose.start);
+    const int64_t end = std::min(frame_end, _partition_by_pose.end);
+    const auto* column = columns[0];
+    const UInt8* null_map = nullptr;
+    if (column->is_nullable()) {
+        null_map = assert_cast<const vectorized::ColumnNullable*>(column)
+                           ->get_null_map_data()
+                           .data();
+    }
+    const int direction = _sliding_modes[i] == SlidingMode::MONOTONIC_MAX ? 1 : -1;
+    auto& rows = _monotonic_rows[i];
+    for (int64_t row = std::max(_monotonic_rows_end[i], start); row < end; ++row) {
+        if (null_map != nullptr && null_map[row]) {
+            continue;
+        }
+        // a row is never the result while a later row in the frame is better or equal
+        while (!rows.empty() &&
+               direction * column->compare_at(rows.back(), row, *column, 1) <= 0) {
+            rows.pop_back();
+        }
+        rows.push_back(row);
+    }
+    _monotonic_rows_end[i] = std::max(_monotonic_rows_end[i], end);
+    while (!rows.empty() && rows.front() < start) {
+        rows.pop_front();
+    }
+
+    _agg_functions[i]->reset(place);
+    _use_null_result[i] = start >= end;
+    if (!rows.empty()) {
+        _agg_functions[i]->function()->add(place, columns, rows.front(), _agg_arena_pool);
+    }
+}
+
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
@@ -874,6 +955,12 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     _current_row_position -= remove_rows;
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
+    for (size_t i = 0; i < _agg_functions_size; i++) {
+        for (auto& row : _monotonic_rows[i]) {
+            row -= remove_rows;
+        }
+        _monotonic_rows_end[i] -= remove_rows;
+    }
     int64_t candidate_partition_end_size = _next_partition_ends.size();
     while (--candidate_partition_end_size >= 0) {
         auto peek = _next_partition_ends.front();
@@ -916,6 +1003,8 @@ void AnalyticSinkLocalState::_reset_agg_status() {
     _could_use_previous_result.assign(_agg_functions_size, 0);
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i]->reset(_fn_place_ptr + _offsets_of_aggregate_states[i]);
+        _monotonic_rows[i].clear();
+        _monotonic_rows_end[i] = 0;
     }
 }
 
@@ -20,6 +20,8 @@
 
 #include <stdint.h>
 
+#include <deque>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
 
@@ -91,6 +93,10 @@ private:
     template <bool incremental = false>
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    void _execute_for_sliding_rows(int64_t frame_start, int64_t frame_end);
+    void _execute_for_monotonic_rows(size_t i, vectorized::AggregateDataPtr place,
+                                     const vectorized::IColumn** columns, int64_t frame_start,
+                                     int64_t frame_end);
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
@@ -147,6 +153,24 @@ private:
 
     std::vector<uint8_t> _use_null_result;
     std::vector<uint8_t> _could_use_previous_result;
+
+    // How each function is evaluated over the frames of rows between M preceding and N following.
+    enum class SlidingMode : uint8_t {
+        // aggregate the frame of each row again
+        RECOMPUTE,
+        // add the incoming row and remove the outgoing one
+        INCREMENTAL,
+        // min/max by a monotonic deque of the rows in the frame, whose head is the result, so a
+        // row is compared only when it comes in, instead of the frame is aggregated again when
+        // the outgoing row is the result
+        MONOTONIC_MAX,
+        MONOTONIC_MIN,
+    };
+    std::vector<SlidingMode> _sliding_modes;
+    std::vector<std::deque<int64_t>> _monotonic_rows;
+    // the rows before it were pushed into _monotonic_rows
+    std::vector<int64_t> _monotonic_rows_end;
+
     bool _streaming_mode = false;
     bool _support_incremental_calculate = true;
     bool _need_more_data = false;
@@ -105,6 +105,11 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
                              state->query_options().exchange_multi_blocks_byte_size > 0) {
     if (_send_multi_blocks) {
         _send_multi_blocks_byte_size = state->query_options().exchange_multi_blocks_byte_size;
+    } else if (config::exchg_multi_blocks_byte_size > 0) {
+        // Many small blocks (e.g. after a selective filter) make the rpc overhead dominate,
+        // so coalesce them by default if the query does not decide it.
+        _send_multi_blocks = true;
+        _send_multi_blocks_byte_size = config::exchg_multi_blocks_byte_size;
     }
 }
 
@@ -307,6 +312,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
         }
 
         instance_data.seq += requests.size();
+        _rpc_bytes += mem_byte;
+        _rpc_blocks += requests.size();
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -436,6 +443,8 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
         }
         instance_data.seq += requests.size();
+        _rpc_bytes += mem_byte;
+        _rpc_blocks += requests.size();
         brpc_request->set_packet_seq(instance_data.seq);
         brpc_request->set_eos(requests.back().eos);
         auto send_callback = channel->get_send_callback(&instance_data, requests.back().eos);
@@ -633,6 +642,9 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* _sum_rpc_timer = ADD_TIMER(profile, "RpcSumTime");
     auto* _count_rpc = ADD_COUNTER(profile, "RpcCount", TUnit::UNIT);
     auto* _avg_rpc_timer = ADD_TIMER(profile, "RpcAvgTime");
+    auto* _rpc_bytes_counter = ADD_COUNTER(profile, "RpcBytes", TUnit::BYTES);
+    auto* _avg_rpc_bytes_counter = ADD_COUNTER(profile, "RpcAvgBytes", TUnit::BYTES);
+    auto* _avg_rpc_blocks_counter = ADD_COUNTER(profile, "RpcAvgBlocks", TUnit::UNIT);
 
     int64_t max_rpc_time = 0, min_rpc_time = 0;
     get_max_min_rpc_time(&max_rpc_time, &min_rpc_time);
@@ -643,6 +655,10 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     int64_t sum_time = get_sum_rpc_time();
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
+    _rpc_bytes_counter->set(_rpc_bytes.load());
+    _avg_rpc_bytes_counter->set(_rpc_bytes / std::max(static_cast<int64_t>(1), _rpc_count.load()));
+    _avg_rpc_blocks_counter->set(_rpc_blocks /
+                                 std::max(static_cast<int64_t>(1), _rpc_count.load()));
 
     auto max_count = _state->rpc_verbose_profile_max_instance_count();
     // This counter will lead to performance degradation.
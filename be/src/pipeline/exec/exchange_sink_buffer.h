@@ -310,6 +310,9 @@ private:
 
     PlanNodeId _node_id;
     std::atomic<int64_t> _rpc_count = 0;
+    // total bytes and blocks sent by rpc, used to show the average payload of rpc
+    std::atomic<int64_t> _rpc_bytes = 0;
+    std::atomic<int64_t> _rpc_blocks = 0;
     // The state may be from PipelineFragmentContext if it is shared among multi instances.
     RuntimeState* _state = nullptr;
     QueryContext* _context = nullptr;
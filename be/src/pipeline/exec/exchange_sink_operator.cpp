@@ -60,6 +60,8 @@ Status ExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
     _local_sent_rows = ADD_COUNTER(custom_profile(), "LocalSentRows", TUnit::UNIT);
     _serialize_batch_timer = ADD_TIMER(custom_profile(), "SerializeBatchTime");
     _compress_timer = ADD_TIMER(custom_profile(), "CompressTime");
+    _adaptive_uncompressed_blocks_counter =
+            ADD_COUNTER(custom_profile(), "AdaptiveUncompressedBlocks", TUnit::UNIT);
     _local_send_timer = ADD_TIMER(custom_profile(), "LocalSendTime");
     _split_block_hash_compute_timer = ADD_TIMER(custom_profile(), "SplitBlockHashComputeTime");
     _distribute_rows_into_channels_timer =
@@ -122,6 +122,8 @@ private:
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_sent_counter = nullptr;
     RuntimeProfile::Counter* _uncompressed_bytes_counter = nullptr;
+    // blocks sent without compression because their data is incompressible
+    RuntimeProfile::Counter* _adaptive_uncompressed_blocks_counter = nullptr;
     RuntimeProfile::Counter* _local_sent_rows = nullptr;
     RuntimeProfile::Counter* _local_send_timer = nullptr;
     RuntimeProfile::Counter* _split_block_hash_compute_timer = nullptr;
@@ -25,6 +25,8 @@
 #include "olap/tablet_manager.h"
 #include "pipeline/exec/olap_scan_operator.h"
 #include "pipeline/exec/scan_operator.h"
+#include "runtime/stream_load/new_load_stream_mgr.h"
+#include "runtime/stream_load/stream_load_context.h"
 #include "vec/exec/format/format_common.h"
 #include "vec/exec/scan/file_scanner.h"
 #include "vec/exec/scan/scanner_context.h"
@@ -65,6 +67,20 @@ std::string FileScanLocalState::name_suffix() const {
                        _parent->cast<FileScanOperatorX>()._table_name);
 }
 
+// The number of scanners to parse the body of a stream load concurrently, see
+// StreamLoadPipeSplitter.
+static int stream_load_parallel_parse_num(const std::vector<TScanRangeParams>& scan_ranges) {
+    if (scan_ranges.size() != 1) {
+        return 1;
+    }
+    const auto& ranges = scan_ranges[0].scan_range.ext_scan_range.file_scan_range.ranges;
+    if (ranges.size() != 1 || !ranges[0].__isset.load_id) {
+        return 1;
+    }
+    auto ctx = ExecEnv::GetInstance()->new_load_stream_mgr()->get(ranges[0].load_id);
+    return ctx == nullptr || ctx->pipe_splitter == nullptr ? 1 : ctx->parallel_parse_num;
+}
+
 void FileScanLocalState::set_scan_ranges(RuntimeState* state,
                                          const std::vector<TScanRangeParams>& scan_ranges) {
     auto& p = _parent->cast<FileScanOperatorX>();
@@ -94,7 +110,14 @@ void FileScanLocalState::set_scan_ranges(RuntimeState* state,
 
     if (!p._batch_split_mode) {
         _max_scanners = calc_max_scanners(p.query_parallel_instance_num());
-        if (_split_source == nullptr) {
+        int parallel_parse_num = std::min(stream_load_parallel_parse_num(scan_ranges),
+                                          _max_scanners);
+        if (_split_source == nullptr && parallel_parse_num > 1) {
+            // every scanner reads the same stream, and takes its own chunks of lines from it
+            std::vector<TScanRangeParams> stream_ranges(parallel_parse_num, scan_ranges[0]);
+            _split_source = std::make_shared<vectorized::LocalSplitSourceConnector>(
+                    stream_ranges, _max_scanners);
+        } else if (_split_source == nullptr) {
             _split_source = std::make_shared<vectorized::LocalSplitSourceConnector>(scan_ranges,
                                                                                     _max_scanners);
         }
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/descriptors.h"
@@ -218,8 +219,11 @@ Status HashJoinProbeOperatorX::pull(doris::RuntimeState* state, vectorized::Bloc
     vectorized::Block temp_block;
 
     Status st;
+    // The conjuncts are evaluated in `process` if the join block is lazily materialized by them.
+    bool conjuncts_evaluated = false;
     if (local_state._probe_index < local_state._probe_block.rows()) {
         DCHECK(local_state._has_set_need_null_map_for_probe);
+        conjuncts_evaluated = _lazy_materialize_by_conjuncts;
         std::visit(
                 [&](auto&& arg, auto&& process_hashtable_ctx) {
                     using HashTableProbeType = std::decay_t<decltype(process_hashtable_ctx)>;
@@ -283,8 +287,8 @@ Status HashJoinProbeOperatorX::pull(doris::RuntimeState* state, vectorized::Bloc
     }
 
     local_state._estimate_memory_usage += temp_block.allocated_bytes();
-    RETURN_IF_ERROR(
-            local_state.filter_data_and_build_output(state, output_block, eos, &temp_block));
+    RETURN_IF_ERROR(local_state.filter_data_and_build_output(
+            state, output_block, eos, &temp_block, true, !conjuncts_evaluated));
     // Here make _join_block release the columns' ptr
     local_state._join_block.set_columns(local_state._join_block.clone_empty_columns());
     mutable_join_block.clear();
@@ -360,12 +364,13 @@ Status HashJoinProbeLocalState::filter_data_and_build_output(RuntimeState* state
                                                              vectorized::Block* output_block,
                                                              bool* eos,
                                                              vectorized::Block* temp_block,
-                                                             bool check_rows_count) {
+                                                             bool check_rows_count,
+                                                             bool need_filter_conjuncts) {
     auto output_rows = temp_block->rows();
     if (check_rows_count) {
         DCHECK(output_rows <= state->batch_size());
     }
-    {
+    if (need_filter_conjuncts) {
         SCOPED_TIMER(_join_filter_timer);
         RETURN_IF_ERROR(filter_block(_conjuncts, temp_block, temp_block->columns()));
     }
@@ -534,6 +539,19 @@ Status HashJoinProbeOperatorX::prepare(RuntimeState* state) {
         conjunct->root()->collect_slot_column_ids(_should_not_lazy_materialized_column_ids);
     }
 
+    // Only the joins which output both sides of the matched rows in `process` are lazily
+    // materialized by the conjuncts of this node, other joins have no build columns to gather.
+    _lazy_materialize_by_conjuncts =
+            config::enable_hash_join_lazy_materialize_by_conjuncts && !_conjuncts.empty() &&
+            !_have_other_join_conjunct && !_is_mark_join &&
+            (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::LEFT_OUTER_JOIN ||
+             _join_op == TJoinOp::RIGHT_OUTER_JOIN || _join_op == TJoinOp::FULL_OUTER_JOIN);
+    if (_lazy_materialize_by_conjuncts) {
+        for (auto& conjunct : _conjuncts) {
+            conjunct->root()->collect_slot_column_ids(_should_not_lazy_materialized_column_ids);
+        }
+    }
+
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_probe_expr_ctxs, state, _child->row_desc()));
     DCHECK(_build_side_child != nullptr);
     // right table data types
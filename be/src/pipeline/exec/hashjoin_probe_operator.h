@@ -58,7 +58,8 @@ public:
     void prepare_for_next();
     Status filter_data_and_build_output(RuntimeState* state, vectorized::Block* output_block,
                                         bool* eos, vectorized::Block* temp_block,
-                                        bool check_rows_count = true);
+                                        bool check_rows_count = true,
+                                        bool need_filter_conjuncts = true);
 
     bool has_null_in_build_side() { return _shared_state->_has_null_in_build_side; }
     const std::shared_ptr<vectorized::Block>& build_block() const {
@@ -154,7 +155,13 @@ public:
 
     bool need_finalize_variant_column() const { return _need_finalize_variant_column; }
 
-    bool can_do_lazy_materialized() const { return _have_other_join_conjunct || _is_mark_join; }
+    bool can_do_lazy_materialized() const {
+        return _have_other_join_conjunct || _is_mark_join || _lazy_materialize_by_conjuncts;
+    }
+
+    // The conjuncts of this node are evaluated in the probe, before the columns which are not
+    // used by the conjuncts are materialized.
+    bool lazy_materialize_by_conjuncts() const { return _lazy_materialize_by_conjuncts; }
 
     bool is_lazy_materialized_column(int column_id) const {
         return can_do_lazy_materialized() &&
@@ -188,6 +195,7 @@ private:
     std::vector<bool> _left_output_slot_flags;
     std::vector<bool> _right_output_slot_flags;
     bool _need_finalize_variant_column = false;
+    bool _lazy_materialize_by_conjuncts = false;
     std::set<int> _should_not_lazy_materialized_column_ids;
     std::vector<std::string> _right_table_column_names;
     const std::vector<TExpr> _partition_exprs;
@@ -63,6 +63,7 @@ struct ProcessHashTableProbe {
     // and output block may be different
     // The output result is determined by the other join conjunct result and same_to_prev struct
     Status do_other_join_conjuncts(vectorized::Block* output_block, DorisVector<uint8_t>& visited);
+    Status do_conjuncts_before_materialize(vectorized::Block* output_block);
 
     Status do_mark_join_conjuncts(vectorized::Block* output_block, const uint8_t* null_map);
 
@@ -295,6 +295,8 @@ Status ProcessHashTableProbe<JoinOpType>::process(HashTableType& hash_table_ctx,
         return do_mark_join_conjuncts(output_block, ignore_null_map ? nullptr : null_map);
     } else if (_have_other_join_conjunct) {
         return do_other_join_conjuncts(output_block, hash_table_ctx.hash_table->get_visited());
+    } else if (_parent_operator->lazy_materialize_by_conjuncts()) {
+        return do_conjuncts_before_materialize(output_block);
     }
 
     return Status::OK();
@@ -377,6 +379,31 @@ Status ProcessHashTableProbe<JoinOpType>::finalize_block_with_filter(
     return Status::OK();
 }
 
+template <int JoinOpType>
+Status ProcessHashTableProbe<JoinOpType>::do_conjuncts_before_materialize(
+        vectorized::Block* output_block) {
+    auto row_count = output_block->rows();
+    if (!row_count) {
+        return Status::OK();
+    }
+
+    SCOPED_TIMER(_parent->_join_filter_timer);
+    size_t orig_columns = output_block->columns();
+    vectorized::IColumn::Filter filter(row_count, 1);
+    {
+        bool can_be_filter_all = false;
+        RETURN_IF_ERROR(vectorized::VExprContext::execute_conjuncts(
+                _parent->_conjuncts, nullptr, output_block, &filter, &can_be_filter_all));
+    }
+
+    auto filter_column = vectorized::ColumnUInt8::create();
+    filter_column->get_data() = std::move(filter);
+    auto result_column_id = output_block->columns();
+    output_block->insert(
+            {std::move(filter_column), std::make_shared<vectorized::DataTypeUInt8>(), ""});
+    return finalize_block_with_filter(output_block, result_column_id, orig_columns);
+}
+
 /**
      * Mark join: there is a column named mark column which stores the result of mark join conjunct.
      * For example:
@@ -17,13 +17,19 @@
 
 #include "nested_loop_join_probe_operator.h"
 
+#include <algorithm>
 #include <memory>
+#include <set>
+#include <unordered_map>
 
 #include "common/cast_set.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -47,6 +53,7 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     _update_visited_flags_timer = ADD_TIMER(custom_profile(), "UpdateVisitedFlagsTime");
     _join_conjuncts_evaluation_timer = ADD_TIMER(custom_profile(), "JoinConjunctsEvaluationTime");
     _filtered_by_join_conjuncts_timer = ADD_TIMER(custom_profile(), "FilteredByJoinConjunctsTime");
+    _range_join_sort_timer = ADD_TIMER(custom_profile(), "RangeJoinSortTime");
     return Status::OK();
 }
 
@@ -105,6 +112,11 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
         // _probe_offset_stack and _build_offset_stack use u16 for storage
         // because on the FE side, it is guaranteed that the batch size will not exceed 65535 (the maximum value for u16).s
         while (_join_block.rows() < state->batch_size()) {
+            // The join block is output partially if the task should yield, the probe and build
+            // positions are kept in local state so the next `pull` resumes from here.
+            if (_join_block.rows() > 0 && state->should_yield()) {
+                break;
+            }
             while (_current_build_pos == _shared_state->build_blocks.size() ||
                    _left_block_pos == _child_block->rows()) {
                 // if left block is empty(), do not need disprocess the left block rows
@@ -137,7 +149,12 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
             if constexpr (set_build_side_flag) {
                 _build_offset_stack.push(cast_set<uint16_t, size_t, false>(_join_block.rows()));
             }
-            _process_left_child_block(_join_block, now_process_build_block);
+            if (p._range_build_column >= 0) {
+                auto [begin, end] = _range_build_rows(_current_build_pos - 1);
+                _process_left_child_block(_join_block, now_process_build_block, begin, end);
+            } else {
+                _process_left_child_block(_join_block, now_process_build_block);
+            }
         }
 
         {
@@ -334,12 +351,110 @@ void NestedLoopJoinProbeLocalState::_append_left_data_with_null(vectorized::Bloc
     block.set_columns(std::move(dst_columns));
 }
 
+void NestedLoopJoinProbeLocalState::_sort_build_rows_by_range_key() {
+    SCOPED_TIMER(_range_join_sort_timer);
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& build_blocks = _shared_state->build_blocks;
+    _range_sorted_build_rows.resize(build_blocks.size());
+    _range_build_keys.resize(build_blocks.size());
+    for (size_t i = 0; i < build_blocks.size(); ++i) {
+        auto column = build_blocks[i]
+                              .get_by_position(p._range_build_column)
+                              .column->convert_to_full_column_if_const();
+        const vectorized::NullMap* null_map = nullptr;
+        if (column->is_nullable()) {
+            const auto& nullable = assert_cast<const vectorized::ColumnNullable&>(*column);
+            null_map = &nullable.get_null_map_data();
+            _range_build_keys[i] = nullable.get_nested_column_ptr();
+        } else {
+            _range_build_keys[i] = column;
+        }
+        auto& rows = _range_sorted_build_rows[i];
+        rows.clear();
+        rows.reserve(column->size());
+        for (uint32_t row = 0; row < column->size(); ++row) {
+            // a null key never satisfies the range bounds
+            if (null_map == nullptr || !(*null_map)[row]) {
+                rows.push_back(row);
+            }
+        }
+        const auto& key = *_range_build_keys[i];
+        std::sort(rows.begin(), rows.end(),
+                  [&](uint32_t l, uint32_t r) { return key.compare_at(l, r, key, 1) < 0; });
+    }
+    _range_build_rows_sorted = true;
+}
+
+Status NestedLoopJoinProbeLocalState::_evaluate_range_probe_values() {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto num_columns = _child_block->columns();
+    _range_probe_values.resize(p._range_bounds.size());
+    for (size_t i = 0; i < p._range_bounds.size(); ++i) {
+        const auto& bound = p._range_bounds[i];
+        auto& ctx = _join_conjuncts[bound.conjunct_idx];
+        int result_column_id = -1;
+        RETURN_IF_ERROR(ctx->root()->children()[bound.probe_child_idx]->execute(
+                ctx.get(), _child_block.get(), &result_column_id));
+        _range_probe_values[i] = _child_block->get_by_position(result_column_id)
+                                         .column->convert_to_full_column_if_const();
+    }
+    _child_block->erase_tail(num_columns);
+    return Status::OK();
+}
+
+std::pair<const uint32_t*, const uint32_t*> NestedLoopJoinProbeLocalState::_range_build_rows(
+        size_t build_block_idx) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& rows = _range_sorted_build_rows[build_block_idx];
+    const auto& key = *_range_build_keys[build_block_idx];
+    const auto probe_row = _left_block_pos;
+    const uint32_t* begin = rows.data();
+    const uint32_t* end = rows.data() + rows.size();
+    for (size_t i = 0; i < p._range_bounds.size() && begin < end; ++i) {
+        const vectorized::IColumn* value = _range_probe_values[i].get();
+        if (value->is_nullable()) {
+            const auto& nullable = assert_cast<const vectorized::ColumnNullable&>(*value);
+            if (nullable.is_null_at(probe_row)) {
+                return {begin, begin};
+            }
+            value = &nullable.get_nested_column();
+        }
+        auto key_less = [&](uint32_t row) {
+            return key.compare_at(row, probe_row, *value, 1) < 0;
+        };
+        auto key_not_greater = [&](uint32_t row) {
+            return key.compare_at(row, probe_row, *value, 1) <= 0;
+        };
+        switch (p._range_bounds[i].op) {
+        case NestedLoopJoinProbeOperatorX::RangeOp::LT:
+            end = std::partition_point(begin, end, key_less);
+            break;
+        case NestedLoopJoinProbeOperatorX::RangeOp::LE:
+            end = std::partition_point(begin, end, key_not_greater);
+            break;
+        case NestedLoopJoinProbeOperatorX::RangeOp::GT:
+            begin = std::partition_point(begin, end, key_not_greater);
+            break;
+        case NestedLoopJoinProbeOperatorX::RangeOp::GE:
+            begin = std::partition_point(begin, end, key_less);
+            break;
+        }
+    }
+    return {begin, std::max(begin, end)};
+}
+
 void NestedLoopJoinProbeLocalState::_process_left_child_block(
-        vectorized::Block& block, const vectorized::Block& now_process_build_block) const {
+        vectorized::Block& block, const vectorized::Block& now_process_build_block,
+        const uint32_t* build_rows_begin, const uint32_t* build_rows_end) const {
     SCOPED_TIMER(_output_temp_blocks_timer);
     auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const size_t max_added_rows = build_rows_begin != nullptr
+                                          ? cast_set<size_t>(build_rows_end - build_rows_begin)
+                                          : now_process_build_block.rows();
+    if (max_added_rows == 0) {
+        return;
+    }
     auto dst_columns = block.mutate_columns();
-    const size_t max_added_rows = now_process_build_block.rows();
     for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column = _child_block->get_by_position(i);
         if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
@@ -366,15 +481,22 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
             auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
             DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
                    p._join_op == TJoinOp::FULL_OUTER_JOIN);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_nested_column_ptr()
-                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
+            auto& nested = assert_cast<vectorized::ColumnNullable*>(
+                                   dst_columns[p._num_probe_side_columns + i].get())
+                                   ->get_nested_column();
+            if (build_rows_begin != nullptr) {
+                nested.insert_indices_from(*src_column.column, build_rows_begin, build_rows_end);
+            } else {
+                nested.insert_range_from(*src_column.column, 0, max_added_rows);
+            }
             assert_cast<vectorized::ColumnNullable*>(
                     dst_columns[p._num_probe_side_columns + i].get())
                     ->get_null_map_column()
                     .get_data()
                     .resize_fill(origin_sz + max_added_rows, 0);
+        } else if (build_rows_begin != nullptr) {
+            dst_columns[p._num_probe_side_columns + i]->insert_indices_from(
+                    *src_column.column, build_rows_begin, build_rows_end);
         } else {
             dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
                                                                           0, max_added_rows);
@@ -417,9 +539,69 @@ Status NestedLoopJoinProbeOperatorX::prepare(RuntimeState* state) {
     }
     _num_probe_side_columns = _child->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    _init_range_join();
     return vectorized::VExpr::open(_join_conjuncts, state);
 }
 
+void NestedLoopJoinProbeOperatorX::_init_range_join() {
+    if (_old_version_flag || _is_output_left_side_only || _is_mark_join || _match_all_build ||
+        _is_right_semi_anti || _join_op == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) {
+        return;
+    }
+    // the op if the build column is the left child, and the op if it's the right child
+    static const std::unordered_map<std::string, std::pair<RangeOp, RangeOp>> range_ops {
+            {"lt", {RangeOp::LT, RangeOp::GT}},
+            {"le", {RangeOp::LE, RangeOp::GE}},
+            {"gt", {RangeOp::GT, RangeOp::LT}},
+            {"ge", {RangeOp::GE, RangeOp::LE}}};
+    const auto num_probe_side_columns = cast_set<int>(_num_probe_side_columns);
+    const auto num_columns = cast_set<int>(_num_probe_side_columns + _num_build_side_columns);
+    for (size_t i = 0; i < _join_conjuncts.size(); ++i) {
+        const auto& root = _join_conjuncts[i]->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->children().size() != 2) {
+            continue;
+        }
+        auto it = range_ops.find(root->fn().name.function_name);
+        if (it == range_ops.end()) {
+            continue;
+        }
+        for (size_t build_child_idx = 0; build_child_idx < 2; ++build_child_idx) {
+            const auto& build_child = root->children()[build_child_idx];
+            const auto& probe_child = root->children()[1 - build_child_idx];
+            if (!build_child->is_slot_ref()) {
+                continue;
+            }
+            auto column_id =
+                    assert_cast<const vectorized::VSlotRef*>(build_child.get())->column_id();
+            if (column_id < num_probe_side_columns || column_id >= num_columns) {
+                continue;
+            }
+            std::set<int> probe_column_ids;
+            probe_child->collect_slot_column_ids(probe_column_ids);
+            if (!probe_column_ids.empty() && *probe_column_ids.rbegin() >= num_probe_side_columns) {
+                continue;
+            }
+            // the keys are compared by compare_at, which doesn't order NaN as the predicates do
+            auto type = vectorized::remove_nullable(build_child->data_type());
+            auto primitive_type = type->get_primitive_type();
+            if (!type->equals(*vectorized::remove_nullable(probe_child->data_type())) ||
+                !(is_int_or_bool(primitive_type) || is_decimal(primitive_type) ||
+                  is_date_type(primitive_type) || is_string_type(primitive_type))) {
+                continue;
+            }
+            // all the bounds must be on the same build column
+            auto build_column = column_id - num_probe_side_columns;
+            if (_range_build_column >= 0 && _range_build_column != build_column) {
+                continue;
+            }
+            _range_build_column = build_column;
+            _range_bounds.push_back({i, 1 - build_child_idx,
+                                     build_child_idx == 0 ? it->second.first : it->second.second});
+            break;
+        }
+    }
+}
+
 bool NestedLoopJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state =
             state->get_local_state(operator_id())->cast<NestedLoopJoinProbeLocalState>();
@@ -440,6 +622,13 @@ Status NestedLoopJoinProbeOperatorX::push(doris::RuntimeState* state, vectorized
     local_state._need_more_input_data = false;
     local_state._shared_state->left_side_eos = eos;
 
+    if (_range_build_column >= 0 && block->rows() > 0) {
+        if (!local_state._range_build_rows_sorted) {
+            local_state._sort_build_rows_by_range_key();
+        }
+        RETURN_IF_ERROR(local_state._evaluate_range_probe_values());
+    }
+
     if (!_is_output_left_side_only) {
         auto func = [&](auto&& join_op_variants, auto set_build_side_flag,
                         auto set_probe_side_flag) {
@@ -58,8 +58,16 @@ private:
     void _finalize_current_phase(vectorized::Block& block, size_t batch_size);
     void _reset_with_next_probe_row();
     void _append_left_data_with_null(vectorized::Block& block) const;
+    // Join the current probe row with the build rows in [build_rows_begin, build_rows_end), or all
+    // the rows of the build block if build_rows_begin is nullptr.
     void _process_left_child_block(vectorized::Block& block,
-                                   const vectorized::Block& now_process_build_block) const;
+                                   const vectorized::Block& now_process_build_block,
+                                   const uint32_t* build_rows_begin = nullptr,
+                                   const uint32_t* build_rows_end = nullptr) const;
+    void _sort_build_rows_by_range_key();
+    Status _evaluate_range_probe_values();
+    // The sorted rows of the build block that satisfy the range bounds of the current probe row.
+    std::pair<const uint32_t*, const uint32_t*> _range_build_rows(size_t build_block_idx) const;
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -190,12 +198,20 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // For the range join, the non-null rows of each build block sorted by the range key, the keys
+    // without the null maps, and the probe side values of the range bounds of the current probe
+    // block.
+    std::vector<std::vector<uint32_t>> _range_sorted_build_rows;
+    vectorized::Columns _range_build_keys;
+    bool _range_build_rows_sorted = false;
+    vectorized::Columns _range_probe_values;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
     RuntimeProfile::Counter* _update_visited_flags_timer = nullptr;
     RuntimeProfile::Counter* _join_conjuncts_evaluation_timer = nullptr;
     RuntimeProfile::Counter* _filtered_by_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _range_join_sort_timer = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
@@ -232,8 +248,27 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+
+    // build key OP probe value
+    enum class RangeOp : uint8_t { LT, LE, GT, GE };
+    struct RangeBound {
+        size_t conjunct_idx;
+        // the child of the conjunct on the probe side
+        size_t probe_child_idx;
+        RangeOp op;
+    };
+    // Find the join conjuncts comparing a build side column with probe side expressions, e.g.
+    // `b.start <= a.ts` and `b.start > a.ts - 10`. The rows of each build block are sorted by
+    // that column, and a probe row is joined only with the build rows between its bounds, found
+    // by binary search, instead of all of them. All the join conjuncts are still evaluated on the
+    // joined rows. It's not for the joins that need the visited flags of the build side.
+    void _init_range_join();
+
     bool _is_output_left_side_only;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // the column of the range key in the build block, -1 if it's not a range join
+    int _range_build_column = -1;
+    std::vector<RangeBound> _range_bounds;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
     const bool _old_version_flag;
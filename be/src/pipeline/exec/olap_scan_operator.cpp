@@ -128,6 +128,8 @@ Status OlapScanLocalState::_init_profile() {
     _rows_expr_cond_input_counter = ADD_COUNTER(_segment_profile, "RowsExprPredInput", TUnit::UNIT);
     _vec_cond_timer = ADD_TIMER(_segment_profile, "VectorPredEvalTime");
     _short_cond_timer = ADD_TIMER(_segment_profile, "ShortPredEvalTime");
+    _predicate_reorder_counter =
+            ADD_COUNTER(_segment_profile, "PredicateReorderNum", TUnit::UNIT);
     _expr_filter_timer = ADD_TIMER(_segment_profile, "ExprFilterEvalTime");
     _predicate_column_read_timer = ADD_TIMER(_segment_profile, "PredicateColumnReadTime");
     _non_predicate_column_read_timer = ADD_TIMER(_segment_profile, "NonPredicateColumnReadTime");
@@ -157,6 +159,11 @@ Status OlapScanLocalState::_init_profile() {
 
     _total_pages_num_counter = ADD_COUNTER(_segment_profile, "TotalPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_segment_profile, "CachedPagesNum", TUnit::UNIT);
+    _cached_pages_bytes_counter = ADD_COUNTER(_segment_profile, "CachedPagesBytes", TUnit::BYTES);
+    _compressed_cached_pages_num_counter =
+            ADD_COUNTER(_segment_profile, "CompressedCachedPagesNum", TUnit::UNIT);
+    _coalesced_read_ranges_counter =
+            ADD_COUNTER(_segment_profile, "CoalescedReadRanges", TUnit::UNIT);
 
     _bitmap_index_filter_counter =
             ADD_COUNTER(_segment_profile, "RowsBitmapIndexFiltered", TUnit::UNIT);
@@ -188,6 +195,10 @@ Status OlapScanLocalState::_init_profile() {
             ADD_COUNTER(_segment_profile, "InvertedIndexSearcherCacheMiss", TUnit::UNIT);
     _inverted_index_downgrade_count_counter =
             ADD_COUNTER(_segment_profile, "InvertedIndexDowngradeCount", TUnit::UNIT);
+    _inverted_index_conjunction_bitmap_terms_counter =
+            ADD_COUNTER(_segment_profile, "InvertedIndexConjunctionBitmapTerms", TUnit::UNIT);
+    _inverted_index_conjunction_skip_terms_counter =
+            ADD_COUNTER(_segment_profile, "InvertedIndexConjunctionSkipTerms", TUnit::UNIT);
 
     _output_index_result_column_timer = ADD_TIMER(_segment_profile, "OutputIndexResultColumnTime");
     _filtered_segment_counter = ADD_COUNTER(_segment_profile, "NumSegmentFiltered", TUnit::UNIT);
@@ -473,9 +484,23 @@ Status OlapScanLocalState::hold_tablets() {
                 std::from_chars(_scan_ranges[i]->version.data(),
                                 _scan_ranges[i]->version.data() + _scan_ranges[i]->version.size(),
                                 version);
-                tasks.emplace_back([this, sync_stats, version, i]() {
-                    auto tablet =
-                            DORIS_TRY(ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats));
+                // A cached tablet already synced to the version is taken here, so only the
+                // tablets which need the meta service are synced by the parallel tasks.
+                auto cached = ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats, true);
+                if (cached.has_value() &&
+                    std::static_pointer_cast<CloudTablet>(cached.value())->is_synced_to(version)) {
+                    _tablets[i] = {std::move(cached).value(), version};
+                    ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_hotspot().count(
+                            *_tablets[i].tablet);
+                    continue;
+                }
+                BaseTabletSPtr cached_tablet = cached.has_value() ? cached.value() : nullptr;
+                tasks.emplace_back([this, sync_stats, version, i, cached_tablet]() {
+                    auto tablet = cached_tablet;
+                    if (tablet == nullptr) {
+                        tablet = DORIS_TRY(
+                                ExecEnv::get_tablet(_scan_ranges[i]->tablet_id, sync_stats));
+                    }
                     _tablets[i] = {std::move(tablet), version};
                     SyncOptions options;
                     options.query_version = version;
@@ -604,7 +629,8 @@ void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
             throw doris::Exception(doris::ErrorCode::INTERNAL_ERROR, status.msg());
         }
         doris::QueryCacheHandle handle;
-        hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
+        hit_cache = QueryCache::instance()->lookup(
+                cache_key, version, &handle, scan_ranges[0].scan_range.palo_scan_range.tablet_id);
     }
 
     if (!hit_cache) {
@@ -118,6 +118,7 @@ private:
     RuntimeProfile::Counter* _rows_expr_cond_input_counter = nullptr;
     RuntimeProfile::Counter* _vec_cond_timer = nullptr;
     RuntimeProfile::Counter* _short_cond_timer = nullptr;
+    RuntimeProfile::Counter* _predicate_reorder_counter = nullptr;
     RuntimeProfile::Counter* _expr_filter_timer = nullptr;
     RuntimeProfile::Counter* _output_col_timer = nullptr;
 
@@ -170,6 +171,11 @@ private:
     // page read from cache
     // used by segment v2
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
+    RuntimeProfile::Counter* _cached_pages_bytes_counter = nullptr;
+    // page read from compressed page cache
+    RuntimeProfile::Counter* _compressed_cached_pages_num_counter = nullptr;
+    // data page ranges planned by coalesced reads
+    RuntimeProfile::Counter* _coalesced_read_ranges_counter = nullptr;
 
     // row count filtered by bitmap inverted index
     RuntimeProfile::Counter* _bitmap_index_filter_counter = nullptr;
@@ -190,6 +196,8 @@ private:
     RuntimeProfile::Counter* _inverted_index_searcher_cache_hit_counter = nullptr;
     RuntimeProfile::Counter* _inverted_index_searcher_cache_miss_counter = nullptr;
     RuntimeProfile::Counter* _inverted_index_downgrade_count_counter = nullptr;
+    RuntimeProfile::Counter* _inverted_index_conjunction_bitmap_terms_counter = nullptr;
+    RuntimeProfile::Counter* _inverted_index_conjunction_skip_terms_counter = nullptr;
 
     RuntimeProfile::Counter* _output_index_result_column_timer = nullptr;
 
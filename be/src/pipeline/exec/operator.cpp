@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -82,8 +83,11 @@
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "pipeline/pipeline.h"
 #include "util/debug_util.h"
+#include "util/defer_op.h"
+#include "util/query_cpu_profiler.h"
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
+#include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/utils/util.hpp"
@@ -233,6 +237,9 @@ Status OperatorXBase::prepare(RuntimeState* state) {
                                                    intermediate_row_desc(i)));
     }
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_projections, state, projections_row_desc()));
+    if (config::enable_projection_common_expr_elimination) {
+        _num_common_projection_exprs = vectorized::VectorizedFnCall::mark_common_exprs(_projections);
+    }
 
     if (has_output_row_desc()) {
         RETURN_IF_ERROR(
@@ -338,6 +345,17 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         auto& mutable_columns = mutable_block.mutable_columns();
         const size_t origin_columns_count = input_block.columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        std::vector<int> common_expr_results(_num_common_projection_exprs, -1);
+        Defer reset_common_expr_results {[&]() {
+            for (auto& projection : local_state->_projections) {
+                projection->set_common_expr_results(nullptr);
+            }
+        }};
+        if (_num_common_projection_exprs > 0) {
+            for (auto& projection : local_state->_projections) {
+                projection->set_common_expr_results(&common_expr_results);
+            }
+        }
         for (int i = 0; i < mutable_columns.size(); ++i) {
             auto result_column_id = -1;
             RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
@@ -371,6 +389,7 @@ Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::
     });
 
     Status status;
+    QueryCpuProfiler::ScopedNodeTag cpu_profiler_tag(node_id());
     auto* local_state = state->get_local_state(operator_id());
     Defer defer([&]() {
         if (status.ok()) {
@@ -976,6 +976,8 @@ private:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // the number of the function calls computed once for all of `_projections` per block
+    int _num_common_projection_exprs = 0;
 
 protected:
     RowDescriptor _row_descriptor;
@@ -54,6 +54,7 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
             ADD_COUNTER(custom_profile(), "PassThroughRowsCounter", TUnit::UNIT);
     _sorted_partition_input_rows_counter =
             ADD_COUNTER(custom_profile(), "SortedPartitionInputRows", TUnit::UNIT);
+    _cutoff_rows_counter = ADD_COUNTER(custom_profile(), "CutoffRows", TUnit::UNIT);
     _partition_sort_info = std::make_shared<PartitionSortInfo>(
             &_vsort_exec_exprs, p._limit, 0, p._pool, p._is_asc_order, p._nulls_first,
             p._child->row_desc(), state, custom_profile(), p._has_global_limit,
@@ -163,6 +164,7 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
         COUNTER_SET(local_state._hash_table_size_counter, int64_t(local_state._num_partition));
         COUNTER_SET(local_state._sorted_partition_input_rows_counter,
                     local_state._sorted_partition_input_rows);
+        COUNTER_SET(local_state._cutoff_rows_counter, local_state._cutoff_rows);
         //so all data from child have sink completed
         {
             std::unique_lock<std::mutex> lc(local_state._shared_state->sink_eos_lock);
@@ -186,6 +188,18 @@ Status PartitionSortSinkOperatorX::_split_block_by_partition(
         local_state._partition_columns[i] =
                 input_block->get_by_position(result_column_id).column.get();
     }
+    local_state._sort_columns.clear();
+    if (local_state._partition_sort_info->could_cutoff()) {
+        auto num_columns = input_block->columns();
+        for (const auto& ctx : local_state._vsort_exec_exprs.ordering_expr_ctxs()) {
+            int result_column_id = -1;
+            RETURN_IF_ERROR(ctx->execute(input_block, &result_column_id));
+            local_state._sort_columns.push_back(input_block->get_by_position(result_column_id)
+                                                        .column->convert_to_full_column_if_const());
+        }
+        // the blocks of the partitions have the columns of the input only
+        input_block->erase_tail(num_columns);
+    }
     RETURN_IF_ERROR(_emplace_into_hash_table(local_state._partition_columns, input_block,
                                              local_state, eos));
     return Status::OK();
@@ -244,6 +258,11 @@ Status PartitionSortSinkOperatorX::_emplace_into_hash_table(
                         for (row = row - 1; row >= 0 && !local_state._is_need_passthrough; --row) {
                             auto& mapped = *agg_method.lazy_emplace(state, row, creator,
                                                                     creator_for_null_key);
+                            if (!local_state._sort_columns.empty() &&
+                                mapped->is_cutoff(local_state._sort_columns, row)) {
+                                local_state._cutoff_rows++;
+                                continue;
+                            }
                             mapped->add_row_idx(row);
                             local_state._sorted_partition_input_rows++;
                             local_state._is_need_passthrough =
@@ -21,8 +21,10 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <numeric>
 #include <utility>
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
@@ -53,6 +55,7 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
 
     _partitioned_blocks.resize(p._partition_count);
     _probe_spilling_streams.resize(p._partition_count);
+    _partition_levels.resize(p._partition_count);
 
     _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
                                                   "HashJoinProbeSpillDependency", true);
@@ -75,6 +78,8 @@ void PartitionedHashJoinProbeLocalState::init_counters() {
     _spill_probe_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "SpillProbeTime", 1);
     _recovery_probe_blocks = ADD_COUNTER(custom_profile(), "SpillRecoveryProbeBlocks", TUnit::UNIT);
     _recovery_probe_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "SpillRecoveryProbeTime", 1);
+    _repartition_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "SpillRepartitionTime", 1);
+    _repartition_count = ADD_COUNTER(custom_profile(), "SpillRepartitionCount", TUnit::UNIT);
     _get_child_next_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "GetChildNextTime", 1);
 
     _probe_blocks_bytes =
@@ -389,6 +394,202 @@ Status PartitionedHashJoinProbeLocalState::recover_build_blocks_from_disk(Runtim
     return spill_io_pool->submit(std::move(spill_runnable));
 }
 
+bool PartitionedHashJoinProbeLocalState::_need_to_repartition(uint32_t partition_index) const {
+    const auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+    return _partition_levels[partition_index] <
+                   uint32_t(config::spill_hash_join_max_repartition_levels) &&
+           build_block &&
+           int64_t(build_block->allocated_bytes()) >= config::spill_hash_join_partition_max_bytes;
+}
+
+Status PartitionedHashJoinProbeLocalState::_spill_repartitioned_blocks(
+        RuntimeState* state, vectorized::PartitionerBase& partitioner,
+        const std::function<Status(vectorized::Block*, bool*)>& read_block,
+        const std::string& name, std::vector<vectorized::SpillStreamSPtr>& streams,
+        std::vector<size_t>& partition_rows) {
+    const auto partition_count = streams.size();
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> partitioned_blocks(partition_count);
+    auto spill_partition = [&](size_t i) {
+        auto& stream = streams[i];
+        if (!stream) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, stream, print_id(state->query_id()), fmt::format("{}_{}", name, i),
+                    _parent->node_id(), std::numeric_limits<int32_t>::max(),
+                    std::numeric_limits<size_t>::max(), operator_profile()));
+        }
+        auto block = partitioned_blocks[i]->to_block();
+        partitioned_blocks[i].reset();
+        return stream->spill_block(state, block, false);
+    };
+
+    bool eos = false;
+    while (!eos && !state->is_cancelled()) {
+        vectorized::Block block;
+        RETURN_IF_ERROR(read_block(&block, &eos));
+        const auto rows = block.rows();
+        if (rows == 0) {
+            continue;
+        }
+        RETURN_IF_ERROR(partitioner.do_partitioning(state, &block));
+
+        std::vector<std::vector<uint32_t>> partition_indexes(partition_count);
+        const auto* channel_ids = partitioner.get_channel_ids().get<uint32_t>();
+        for (uint32_t i = 0; i != rows; ++i) {
+            partition_indexes[channel_ids[i]].emplace_back(i);
+        }
+        for (size_t i = 0; i != partition_count; ++i) {
+            const auto count = partition_indexes[i].size();
+            if (count == 0) {
+                continue;
+            }
+            if (!partitioned_blocks[i]) {
+                partitioned_blocks[i] =
+                        vectorized::MutableBlock::create_unique(block.clone_empty());
+            }
+            RETURN_IF_ERROR(partitioned_blocks[i]->add_rows(&block, partition_indexes[i].data(),
+                                                            partition_indexes[i].data() + count));
+            partition_rows[i] += count;
+            if (partitioned_blocks[i]->allocated_bytes() >=
+                vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM) {
+                RETURN_IF_ERROR(spill_partition(i));
+            }
+        }
+    }
+
+    for (size_t i = 0; i != partition_count; ++i) {
+        if (partitioned_blocks[i] && !partitioned_blocks[i]->empty()) {
+            RETURN_IF_ERROR(spill_partition(i));
+        }
+    }
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::repartition(RuntimeState* state,
+                                                      uint32_t partition_index) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    const auto level = _partition_levels[partition_index] + 1;
+
+    std::unique_ptr<vectorized::PartitionerBase> build_partitioner;
+    std::unique_ptr<vectorized::PartitionerBase> probe_partitioner;
+    RETURN_IF_ERROR(p._build_repartitioner->clone(state, build_partitioner));
+    RETURN_IF_ERROR(p._probe_repartitioner->clone(state, probe_partitioner));
+    // the build and probe rows of the same key must go to the same partition
+    static_cast<SpillRePartitionerType*>(build_partitioner.get())->set_hash_seed(level);
+    static_cast<SpillRePartitionerType*>(probe_partitioner.get())->set_hash_seed(level);
+
+    RETURN_IF_ERROR(finish_spilling(partition_index));
+    if (_shared_state->spilled_streams[partition_index]) {
+        _shared_state->spilled_streams[partition_index]->set_read_counters(operator_profile());
+    }
+
+    auto query_id = state->query_id();
+    auto repartition_func = [this, state, partition_index, level,
+                             build_partitioner = std::shared_ptr(std::move(build_partitioner)),
+                             probe_partitioner = std::shared_ptr(std::move(probe_partitioner))] {
+        SCOPED_TIMER(_repartition_timer);
+        auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+        const auto fanout = p._partition_count;
+
+        auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+        auto& build_stream = _shared_state->spilled_streams[partition_index];
+        auto read_build_block = [&](vectorized::Block* block, bool* eos) {
+            if (build_block) {
+                *block = build_block->to_block();
+                build_block.reset();
+                return Status::OK();
+            }
+            if (!build_stream) {
+                *eos = true;
+                return Status::OK();
+            }
+            return build_stream->read_next_block_sync(block, eos);
+        };
+        std::vector<vectorized::SpillStreamSPtr> build_streams(fanout);
+        std::vector<size_t> build_rows(fanout);
+        RETURN_IF_ERROR(_spill_repartitioned_blocks(state, *build_partitioner, read_build_block,
+                                                    fmt::format("hash_build_level_{}", level),
+                                                    build_streams, build_rows));
+        for (auto& stream : build_streams) {
+            if (stream) {
+                RETURN_IF_ERROR(stream->spill_eof());
+            }
+        }
+
+        auto& probe_blocks = _probe_blocks[partition_index];
+        auto& partitioned_probe_block = _partitioned_blocks[partition_index];
+        auto& probe_stream = _probe_spilling_streams[partition_index];
+        auto read_probe_block = [&](vectorized::Block* block, bool* eos) {
+            if (!probe_blocks.empty()) {
+                *block = std::move(probe_blocks.back());
+                probe_blocks.pop_back();
+                return Status::OK();
+            }
+            if (partitioned_probe_block) {
+                *block = partitioned_probe_block->to_block();
+                partitioned_probe_block.reset();
+                return Status::OK();
+            }
+            if (!probe_stream) {
+                *eos = true;
+                return Status::OK();
+            }
+            return probe_stream->read_next_block_sync(block, eos);
+        };
+        std::vector<vectorized::SpillStreamSPtr> probe_streams(fanout);
+        std::vector<size_t> probe_rows(fanout);
+        RETURN_IF_ERROR(_spill_repartitioned_blocks(state, *probe_partitioner, read_probe_block,
+                                                    fmt::format("hash_probe_level_{}", level),
+                                                    probe_streams, probe_rows));
+        if (state->is_cancelled()) {
+            return Status::OK();
+        }
+
+        for (auto* stream : {&build_stream, &probe_stream}) {
+            if (*stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(*stream);
+                stream->reset();
+            }
+        }
+
+        const auto total_build_rows = std::accumulate(build_rows.begin(), build_rows.end(), size_t(0));
+        for (uint32_t i = 0; i != fanout; ++i) {
+            _shared_state->spilled_streams.emplace_back(std::move(build_streams[i]));
+            _shared_state->partitioned_build_blocks.emplace_back();
+            _probe_spilling_streams.emplace_back(std::move(probe_streams[i]));
+            _partitioned_blocks.emplace_back();
+            // All the rows are of the same key if they are in one partition again, splitting
+            // the partition does not make it smaller, so it is built in memory as it is.
+            const bool skewed = total_build_rows > 0 && build_rows[i] == total_build_rows;
+            _partition_levels.emplace_back(
+                    skewed ? uint32_t(config::spill_hash_join_max_repartition_levels) : level);
+        }
+        COUNTER_UPDATE(_repartition_count, 1);
+        VLOG_DEBUG << fmt::format(
+                "Query:{}, hash join probe:{}, task:{}, partition:{} repartitioned to level:{}, "
+                "build rows:{}",
+                print_id(state->query_id()), _parent->node_id(), state->task_id(),
+                partition_index, level, total_build_rows);
+
+        // the data of the partition is in the new partitions now
+        _partition_cursor++;
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [repartition_func, query_id]() {
+        auto status = [&]() {
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(repartition_func());
+            return Status::OK();
+        }();
+        return status;
+    };
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _spill_dependency->block();
+    return spill_io_pool->submit(std::make_shared<SpillRecoverRunnable>(
+            state, _spill_dependency, operator_profile(), _shared_state->shared_from_this(),
+            exception_catch_func));
+}
+
 std::string PartitionedHashJoinProbeLocalState::debug_string(int indentation_level) const {
     auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
     bool need_more_input_data;
@@ -517,11 +718,17 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
     auto tnode_ = _tnode;
     tnode_.runtime_filters.clear();
 
+    std::vector<TExpr> build_exprs;
     for (const auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
         _probe_exprs.emplace_back(conjunct.left);
+        build_exprs.emplace_back(conjunct.right);
     }
     _partitioner = std::make_unique<SpillPartitionerType>(_partition_count);
     RETURN_IF_ERROR(_partitioner->init(_probe_exprs));
+    _build_repartitioner = std::make_unique<SpillRePartitionerType>(_partition_count);
+    RETURN_IF_ERROR(_build_repartitioner->init(build_exprs));
+    _probe_repartitioner = std::make_unique<SpillRePartitionerType>(_partition_count);
+    RETURN_IF_ERROR(_probe_repartitioner->init(_probe_exprs));
 
     return Status::OK();
 }
@@ -539,6 +746,10 @@ Status PartitionedHashJoinProbeOperatorX::prepare(RuntimeState* state) {
     _child = std::move(child);
     RETURN_IF_ERROR(_partitioner->prepare(state, _child->row_desc()));
     RETURN_IF_ERROR(_partitioner->open(state));
+    RETURN_IF_ERROR(_build_repartitioner->prepare(state, _build_side_child->row_desc()));
+    RETURN_IF_ERROR(_build_repartitioner->open(state));
+    RETURN_IF_ERROR(_probe_repartitioner->prepare(state, _child->row_desc()));
+    RETURN_IF_ERROR(_probe_repartitioner->open(state));
     return Status::OK();
 }
 
@@ -686,6 +897,9 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
     }
 
     if (local_state._need_to_setup_internal_operators) {
+        if (local_state._need_to_repartition(partition_index)) {
+            return local_state.repartition(state, partition_index);
+        }
         bool has_data = false;
         RETURN_IF_ERROR(local_state.recover_build_blocks_from_disk(
                 state, local_state._partition_cursor, has_data));
@@ -742,7 +956,7 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                 local_state._partition_cursor);
         local_state._partition_cursor++;
         local_state.update_profile_from_inner();
-        if (local_state._partition_cursor == _partition_count) {
+        if (local_state._partition_cursor == local_state._partition_levels.size()) {
             *eos = true;
         } else {
             local_state._need_to_setup_internal_operators = true;
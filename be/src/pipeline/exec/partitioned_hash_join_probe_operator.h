@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "common/be_mock_util.h"
 #include "common/status.h"
@@ -58,6 +61,10 @@ public:
 
     Status finish_spilling(uint32_t partition_index);
 
+    // Splits the build and probe data of the partition into partitions of the next level, which
+    // are appended to the partitions to process.
+    Status repartition(RuntimeState* state, uint32_t partition_index);
+
     template <bool spilled>
     void update_build_custom_profile(RuntimeProfile* child_profile);
 
@@ -82,6 +89,15 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    bool _need_to_repartition(uint32_t partition_index) const;
+
+    // Splits the blocks returned by `read_block` by `partitioner` and spills them into `streams`.
+    Status _spill_repartitioned_blocks(
+            RuntimeState* state, vectorized::PartitionerBase& partitioner,
+            const std::function<Status(vectorized::Block*, bool*)>& read_block,
+            const std::string& name, std::vector<vectorized::SpillStreamSPtr>& streams,
+            std::vector<size_t>& partition_rows);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
 
@@ -93,6 +109,8 @@ private:
     std::map<uint32_t, std::vector<vectorized::Block>> _probe_blocks;
 
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
+    // the repartition level of each partition, the partitions of the sink are of level 0
+    std::vector<uint32_t> _partition_levels;
 
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
@@ -113,6 +131,8 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_count = nullptr;
 
     RuntimeProfile::Counter* _probe_blocks_bytes = nullptr;
     RuntimeProfile::Counter* _memory_usage_reserved = nullptr;
@@ -191,6 +211,9 @@ private:
 
     const uint32_t _partition_count;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    // for splitting a spilled partition that is too large to build in memory
+    std::unique_ptr<vectorized::PartitionerBase> _build_repartitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _probe_repartitioner;
 };
 
 } // namespace pipeline
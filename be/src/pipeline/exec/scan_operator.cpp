@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
 
 #include "pipeline/exec/es_scan_operator.h"
 #include "pipeline/exec/file_scan_operator.h"
@@ -62,6 +63,31 @@ const static int32_t ADAPTIVE_PIPELINE_TASK_SERIAL_READ_ON_LIMIT_DEFAULT = 10000
         return;                              \
     }
 
+// How a monotonic function rounds its column argument, so a comparison of the result implies a
+// range of the column, e.g. `date_trunc(col, 'day') >= x` implies `col >= x`.
+enum class RoundingDirection {
+    NONE,
+    // the result is not greater than the argument
+    DOWN,
+    // the result is not less than the argument
+    UP,
+};
+
+static RoundingDirection rounding_direction(const std::string& fn_name) {
+    static const std::unordered_map<std::string, RoundingDirection> functions {
+            {"date_trunc", RoundingDirection::DOWN},     {"year_floor", RoundingDirection::DOWN},
+            {"month_floor", RoundingDirection::DOWN},    {"week_floor", RoundingDirection::DOWN},
+            {"day_floor", RoundingDirection::DOWN},      {"hour_floor", RoundingDirection::DOWN},
+            {"minute_floor", RoundingDirection::DOWN},   {"second_floor", RoundingDirection::DOWN},
+            {"year_ceil", RoundingDirection::UP},        {"month_ceil", RoundingDirection::UP},
+            {"week_ceil", RoundingDirection::UP},        {"day_ceil", RoundingDirection::UP},
+            {"hour_ceil", RoundingDirection::UP},        {"minute_ceil", RoundingDirection::UP},
+            {"second_ceil", RoundingDirection::UP},
+    };
+    auto it = functions.find(fn_name);
+    return it == functions.end() ? RoundingDirection::NONE : it->second;
+}
+
 template <typename Derived>
 bool ScanLocalState<Derived>::should_run_serial() const {
     return _parent->cast<typename Derived::Parent>()._should_run_serial;
@@ -265,6 +291,25 @@ Status ScanLocalState<Derived>::_normalize_predicate(
         }
         return false;
     };
+    // the slot is the argument of a monotonic function, see `rounding_direction`
+    auto monotonic_predicate_checker = [](const vectorized::VExprSPtrs& children,
+                                          std::shared_ptr<vectorized::VSlotRef>& slot,
+                                          vectorized::VExprSPtr& child_contains_slot) {
+        for (const auto& child : children) {
+            if (child->node_type() != TExprNodeType::FUNCTION_CALL ||
+                rounding_direction(child->fn().name.function_name) == RoundingDirection::NONE) {
+                continue;
+            }
+            for (const auto& arg : child->children()) {
+                if (arg->node_type() == TExprNodeType::SLOT_REF) {
+                    slot = std::dynamic_pointer_cast<vectorized::VSlotRef>(arg);
+                    child_contains_slot = child;
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
 
     if (conjunct_expr_root != nullptr) {
         if (is_leaf(conjunct_expr_root)) {
@@ -336,6 +381,17 @@ Status ScanLocalState<Derived>::_normalize_predicate(
                         },
                         *range);
                 RETURN_IF_ERROR(status);
+            } else if (config::enable_monotonic_function_pruning &&
+                       _is_predicate_acting_on_slot(cur_expr, monotonic_predicate_checker, &slot,
+                                                    &range)) {
+                Status status = Status::OK();
+                std::visit(
+                        [&](auto& value_range) {
+                            status = _normalize_monotonic_function_predicate(
+                                    cur_expr, context, slot, value_range, &pdt);
+                        },
+                        *range);
+                RETURN_IF_ERROR(status);
             }
             if (pdt == PushDownType::ACCEPTABLE && slotref != nullptr &&
                 slotref->data_type()->get_primitive_type() == PrimitiveType::TYPE_VARIANT) {
@@ -992,6 +1048,82 @@ Status ScanLocalState<Derived>::_normalize_noneq_binary_predicate(
     return Status::OK();
 }
 
+template <typename Derived>
+template <PrimitiveType T>
+Status ScanLocalState<Derived>::_normalize_monotonic_function_predicate(
+        vectorized::VExpr* expr, vectorized::VExprContext* expr_ctx, SlotDescriptor* slot,
+        ColumnValueRange<T>& range, PushDownType* pdt) {
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_DATEV2 ||
+                  T == TYPE_DATETIMEV2) {
+        if (TExprNodeType::BINARY_PRED != expr->node_type()) {
+            return Status::OK();
+        }
+        DCHECK(expr->get_num_children() == 2);
+        int fn_child = expr->children()[0]->node_type() == TExprNodeType::FUNCTION_CALL ? 0 : 1;
+        const auto& fn_call = expr->children()[fn_child];
+        const auto& constant = expr->children()[1 - fn_child];
+        if (!constant->is_constant()) {
+            return Status::OK();
+        }
+        for (const auto& arg : fn_call->children()) {
+            if (arg->node_type() != TExprNodeType::SLOT_REF && !arg->is_constant()) {
+                return Status::OK();
+            }
+        }
+
+        // the comparison with the function on the left
+        std::string fn_name =
+                reinterpret_cast<vectorized::VectorizedFnCall*>(expr)->fn().name.function_name;
+        if (fn_child == 1) {
+            static const std::unordered_map<std::string, std::string> flipped {
+                    {"lt", "gt"}, {"le", "ge"}, {"gt", "lt"}, {"ge", "le"}, {"eq", "eq"}};
+            auto it = flipped.find(fn_name);
+            if (it == flipped.end()) {
+                return Status::OK();
+            }
+            fn_name = it->second;
+        }
+        // the rounded down result only bounds the column from below, and rounded up from above
+        std::string implied_fn_name;
+        switch (rounding_direction(fn_call->fn().name.function_name)) {
+        case RoundingDirection::DOWN:
+            if (fn_name == "gt" || fn_name == "ge") {
+                implied_fn_name = fn_name;
+            } else if (fn_name == "eq") {
+                implied_fn_name = "ge";
+            }
+            break;
+        case RoundingDirection::UP:
+            if (fn_name == "lt" || fn_name == "le") {
+                implied_fn_name = fn_name;
+            } else if (fn_name == "eq") {
+                implied_fn_name = "le";
+            }
+            break;
+        case RoundingDirection::NONE:
+            break;
+        }
+        if (implied_fn_name.empty()) {
+            return Status::OK();
+        }
+
+        std::shared_ptr<ColumnPtrWrapper> const_col_wrapper;
+        RETURN_IF_ERROR(constant->get_const_col(expr_ctx, &const_col_wrapper));
+        const auto* const_column =
+                check_and_get_column<vectorized::ColumnConst>(const_col_wrapper->column_ptr.get());
+        if (const_column == nullptr || const_column->is_null_at(0)) {
+            return Status::OK();
+        }
+        StringRef value = const_column->get_data_at(0);
+        RETURN_IF_ERROR(_change_value_range<false>(
+                range, reinterpret_cast<void*>(const_cast<char*>(value.data)),
+                ColumnValueRange<T>::add_value_range, implied_fn_name, 0));
+        // the implied range is wider than the predicate, which is still evaluated
+        *pdt = PushDownType::PARTIAL_ACCEPTABLE;
+    }
+    return Status::OK();
+}
+
 template <typename Derived>
 Status ScanLocalState<Derived>::_prepare_scanners() {
     std::list<vectorized::ScannerSPtr> scanners;
@@ -1098,6 +1230,14 @@ Status ScanLocalState<Derived>::_init_profile() {
     // Size of data that read from storage.
     // Does not include rows that are cached by doris page cache.
     _scan_bytes = ADD_COUNTER(custom_profile(), "ScanBytes", TUnit::BYTES);
+    // The io of the file readers, the file cache hits are in the FileCache profile.
+    _scan_bytes_from_local_disk =
+            ADD_COUNTER(custom_profile(), "ScanBytesFromLocalDisk", TUnit::BYTES);
+    _scan_io_from_local_disk = ADD_COUNTER(custom_profile(), "ScanIOFromLocalDisk", TUnit::UNIT);
+    _scan_bytes_from_remote_storage =
+            ADD_COUNTER(custom_profile(), "ScanBytesFromRemoteStorage", TUnit::BYTES);
+    _scan_io_from_remote_storage =
+            ADD_COUNTER(custom_profile(), "ScanIOFromRemoteStorage", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -120,6 +120,10 @@ protected:
 
     RuntimeProfile::Counter* _scan_rows = nullptr;
     RuntimeProfile::Counter* _scan_bytes = nullptr;
+    RuntimeProfile::Counter* _scan_bytes_from_local_disk = nullptr;
+    RuntimeProfile::Counter* _scan_io_from_local_disk = nullptr;
+    RuntimeProfile::Counter* _scan_bytes_from_remote_storage = nullptr;
+    RuntimeProfile::Counter* _scan_io_from_remote_storage = nullptr;
 
     RuntimeFilterConsumerHelper _helper;
     std::mutex _conjunct_lock;
@@ -279,6 +283,12 @@ protected:
     Status _normalize_is_null_predicate(vectorized::VExpr* expr, vectorized::VExprContext* expr_ctx,
                                         SlotDescriptor* slot, ColumnValueRange<T>& range,
                                         PushDownType* pdt);
+    // push down the range of the column implied by a comparison on a monotonic function of it
+    template <PrimitiveType T>
+    Status _normalize_monotonic_function_predicate(vectorized::VExpr* expr,
+                                                   vectorized::VExprContext* expr_ctx,
+                                                   SlotDescriptor* slot,
+                                                   ColumnValueRange<T>& range, PushDownType* pdt);
 
     bool _ignore_cast(SlotDescriptor* slot, vectorized::VExpr* expr);
 
@@ -84,8 +84,8 @@ Status SetProbeSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized
                     using HashTableCtxType = std::decay_t<decltype(arg)>;
                     if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
                         SCOPED_TIMER(local_state._probe_timer);
-                        vectorized::HashTableProbe<HashTableCtxType, is_intersect>
-                                process_hashtable_ctx(&local_state, probe_rows);
+                        vectorized::HashTableProbe<HashTableCtxType> process_hashtable_ctx(
+                                &local_state, probe_rows);
                         return process_hashtable_ctx.mark_data_in_hashtable(arg);
                     } else {
                         LOG(WARNING) << "Uninited hash table in Set Probe Sink Operator";
@@ -181,18 +181,27 @@ Status SetProbeSinkOperatorX<is_intersect>::_extract_probe_column(
 template <bool is_intersect>
 void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
         SetProbeSinkLocalState<is_intersect>& local_state) {
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
-        _refresh_hash_table(local_state);
-        uint64_t hash_table_size = local_state._shared_state->get_hash_table_size();
-        valid_element_in_hash_tbl = is_intersect ? 0 : hash_table_size;
-        local_state._probe_columns.resize(
-                local_state._shared_state->child_exprs_lists[_cur_child_id + 1].size());
-        local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
-                ->set_ready();
-    } else {
-        local_state._dependency->set_ready_to_read();
+    auto& shared_state = *local_state._shared_state;
+    if (shared_state.probe_finished_children.fetch_add(1) + 2 != shared_state.child_quantity) {
+        return;
+    }
+    // the last finished probe child merges the visited rows of all the probe children
+    auto& probe_visited_rows = shared_state.probe_visited_rows;
+    auto& visited_rows = shared_state.visited_rows;
+    visited_rows = std::move(probe_visited_rows[0]);
+    for (size_t i = 1; i < probe_visited_rows.size(); ++i) {
+        auto* __restrict merged = visited_rows.data();
+        const auto* __restrict visited = probe_visited_rows[i].data();
+        for (size_t row = 0; row < visited_rows.size(); ++row) {
+            if constexpr (is_intersect) {
+                merged[row] &= visited[row];
+            } else {
+                merged[row] |= visited[row];
+            }
+        }
+        std::vector<uint8_t>().swap(probe_visited_rows[i]);
     }
+    local_state._dependency->set_ready_to_read();
 }
 
 template <bool is_intersect>
@@ -201,68 +210,6 @@ size_t SetProbeSinkOperatorX<is_intersect>::get_reserve_mem_size(RuntimeState* s
     return local_state._estimate_memory_usage;
 }
 
-template <bool is_intersect>
-void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
-        SetProbeSinkLocalState<is_intersect>& local_state) {
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    auto& hash_table_variants = local_state._shared_state->hash_table_variants;
-    std::visit(
-            [&](auto&& arg) {
-                using HashTableCtxType = std::decay_t<decltype(arg)>;
-                if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
-                    arg.init_iterator();
-                    auto& iter = arg.begin;
-
-                    constexpr double need_shrink_ratio = 0.25;
-                    bool is_need_shrink =
-                            is_intersect
-                                    ? (valid_element_in_hash_tbl <
-                                       arg.hash_table
-                                               ->size()) // When intersect, shrink as long as the element decreases
-                                    : ((double)valid_element_in_hash_tbl <
-                                       (double)arg.hash_table->size() *
-                                               need_shrink_ratio); // When except, element decreases need to within the 'need_shrink_ratio' before shrinking
-
-                    if (is_need_shrink) {
-                        auto tmp_hash_table =
-                                std::make_shared<typename HashTableCtxType::HashMapType>();
-                        tmp_hash_table->reserve(
-                                local_state._shared_state->valid_element_in_hash_tbl);
-                        while (iter != arg.end) {
-                            auto& mapped = iter.get_second();
-                            auto* it = &mapped;
-
-                            if constexpr (is_intersect) {
-                                if (it->visited) {
-                                    it->visited = false;
-                                    tmp_hash_table->insert(iter);
-                                }
-                            } else {
-                                if (!it->visited) {
-                                    tmp_hash_table->insert(iter);
-                                }
-                            }
-                            ++iter;
-                        }
-                        arg.hash_table = std::move(tmp_hash_table);
-                    } else if (is_intersect) {
-                        DCHECK_EQ(valid_element_in_hash_tbl, arg.hash_table->size());
-                        while (iter != arg.end) {
-                            auto& mapped = iter.get_second();
-                            auto* it = &mapped;
-                            it->visited = false;
-                            ++iter;
-                        }
-                    }
-
-                    arg.inited_iterator = false;
-                } else {
-                    LOG(WARNING) << "Uninited hash table in Set Probe Sink Operator";
-                }
-            },
-            hash_table_variants->method_variant);
-}
-
 template class SetProbeSinkLocalState<true>;
 template class SetProbeSinkLocalState<false>;
 template class SetProbeSinkOperatorX<true>;
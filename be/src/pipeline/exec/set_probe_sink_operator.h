@@ -28,7 +28,7 @@ class RuntimeState;
 
 namespace vectorized {
 class Block;
-template <class HashTableContext, bool is_intersected>
+template <class HashTableContext>
 struct HashTableProbe;
 } // namespace vectorized
 
@@ -49,11 +49,13 @@ public:
 
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
-    int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
+    uint8_t* visited_rows() {
+        return _shared_state->probe_visited_rows[_parent->cast<Parent>()._cur_child_id - 1].data();
+    }
 
 private:
     friend class SetProbeSinkOperatorX<is_intersect>;
-    template <class HashTableContext, bool is_intersected>
+    template <class HashTableContext>
     friend struct vectorized::HashTableProbe;
 
     int64_t _estimate_memory_usage = 0;
@@ -116,7 +118,6 @@ private:
     Status _extract_probe_column(SetProbeSinkLocalState<is_intersect>& local_state,
                                  vectorized::Block& block, vectorized::ColumnRawPtrs& raw_ptrs,
                                  int child_id);
-    void _refresh_hash_table(SetProbeSinkLocalState<is_intersect>& local_state);
     const int _cur_child_id;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
@@ -17,6 +17,7 @@
 
 #include "set_sink_operator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "pipeline/exec/operator.h"
@@ -72,7 +73,6 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
 
     auto& build_block = local_state._shared_state->build_block;
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
 
     if (in_block->rows() != 0) {
         {
@@ -93,11 +93,15 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
 
         if (eos) {
             uint64_t hash_table_size = local_state._shared_state->get_hash_table_size();
-            valid_element_in_hash_tbl = is_intersect ? 0 : hash_table_size;
 
-            local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
-                    ->set_ready();
             DCHECK_GT(_child_quantity, 1);
+            auto& shared_state = *local_state._shared_state;
+            shared_state.probe_visited_rows.assign(
+                    _child_quantity - 1, std::vector<uint8_t>(shared_state.build_rows, 0));
+            // the probe children only read the hash table, so all of them could start now
+            for (size_t i = _cur_child_id + 1; i < _child_quantity; ++i) {
+                shared_state.probe_finished_children_dependency[i]->set_ready();
+            }
             RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
                     state, hash_table_size, local_state._finish_dependency));
         }
@@ -117,6 +121,7 @@ Status SetSinkOperatorX<is_intersect>::_process_build_block(
     vectorized::materialize_block_inplace(block);
     vectorized::ColumnRawPtrs raw_ptrs(_child_exprs.size());
     RETURN_IF_ERROR(_extract_build_column(local_state, block, raw_ptrs, rows));
+    local_state._shared_state->build_rows = std::max(local_state._shared_state->build_rows, rows);
     auto st = Status::OK();
     std::visit(
             [&](auto&& arg) {
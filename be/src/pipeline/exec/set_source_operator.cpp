@@ -130,14 +130,14 @@ Status SetSourceOperatorX<is_intersect>::_get_data_in_hashtable(
     local_state._result_indexs.clear();
     local_state._result_indexs.reserve(batch_size);
 
-    auto add_result = [&local_state](auto value) {
-        auto* it = &value;
+    const auto& visited_rows = local_state._shared_state->visited_rows;
+    auto add_result = [&local_state, &visited_rows](auto value) {
         if constexpr (is_intersect) {
-            if (it->visited) { //intersected: have done probe, so visited values it's the result
+            if (visited_rows[value.row_num]) { //intersected: visited by all probe children
                 local_state._result_indexs.push_back(value.row_num);
             }
         } else {
-            if (!it->visited) { //except: haven't visited values it's the needed result
+            if (!visited_rows[value.row_num]) { //except: not visited by any probe child
                 local_state._result_indexs.push_back(value.row_num);
             }
         }
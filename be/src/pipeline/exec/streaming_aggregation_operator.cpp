@@ -17,6 +17,7 @@
 
 #include "streaming_aggregation_operator.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/Metrics_types.h>
 
 #include <memory>
@@ -24,6 +25,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -109,6 +111,9 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _pass_through_rows_counter = ADD_COUNTER(custom_profile(), "PassThroughRows", TUnit::UNIT);
+    _reprobe_times_counter = ADD_COUNTER(custom_profile(), "PreAggReprobeTimes", TUnit::UNIT);
+    _resume_times_counter = ADD_COUNTER(custom_profile(), "PreAggResumeTimes", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -337,6 +342,70 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+bool StreamingAggLocalState::_should_resume_pre_agg(vectorized::ColumnRawPtrs& key_columns,
+                                                    size_t rows) {
+    const int interval = config::streaming_agg_reprobe_interval_blocks;
+    if (interval <= 0 || ++_blocks_since_reprobe < interval) {
+        return false;
+    }
+    _blocks_since_reprobe = 0;
+
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    const auto spill_streaming_agg_mem_limit = p._spill_streaming_agg_mem_limit;
+    if (spill_streaming_agg_mem_limit > 0 && _memory_usage() > spill_streaming_agg_mem_limit) {
+        return false;
+    }
+
+    // Probe the hash table without inserting, if most keys of this block are already aggregated,
+    // the input is not near-unique anymore and the hash table is worth expanding again.
+    size_t hit_rows = 0;
+    {
+        SCOPED_TIMER(_hash_table_compute_timer);
+        std::visit(vectorized::Overload {
+                           [&](std::monostate& arg) -> void {
+                               throw doris::Exception(ErrorCode::INTERNAL_ERROR,
+                                                      "uninited hash table");
+                           },
+                           [&](auto& agg_method) -> void {
+                               using HashMethodType = std::decay_t<decltype(agg_method)>;
+                               using AggState = typename HashMethodType::State;
+                               AggState state(key_columns);
+                               agg_method.init_serialized_keys(key_columns, rows);
+                               for (size_t i = 0; i < rows; ++i) {
+                                   hit_rows += agg_method.find(state, i).is_found();
+                               }
+                           }},
+                   _agg_data->method_variant);
+    }
+    COUNTER_UPDATE(_reprobe_times_counter, 1);
+
+    const auto hit_percent = hit_rows * 100 / rows;
+    if (hit_percent < static_cast<size_t>(config::streaming_agg_resume_min_hit_percent)) {
+        return false;
+    }
+    COUNTER_UPDATE(_resume_times_counter, 1);
+    _should_expand_hash_table = true;
+    _record_pre_agg_decision(false, fmt::format("hit {}%", hit_percent));
+    return true;
+}
+
+void StreamingAggLocalState::_record_pre_agg_decision(bool pass_through,
+                                                      const std::string& reason) {
+    _passing_through = pass_through;
+    // keep the profile small if the decision flips many times
+    static constexpr size_t MAX_RECORDED_DECISIONS = 16;
+    if (++_pre_agg_decisions > MAX_RECORDED_DECISIONS) {
+        return;
+    }
+    if (!_pre_agg_decision_history.empty()) {
+        _pre_agg_decision_history += ", ";
+    }
+    _pre_agg_decision_history += fmt::format("{}@block{}({})",
+                                             pass_through ? "pass_through" : "aggregate",
+                                             _input_num_blocks, reason);
+    custom_profile()->add_info_string("PreAggDecisions", _pre_agg_decision_history);
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -360,8 +429,14 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
 
     size_t rows = in_block->rows();
     _places.resize(rows);
+    ++_input_num_blocks;
 
-    if (_should_not_do_pre_agg(rows)) {
+    if (_should_not_do_pre_agg(rows) && !_should_resume_pre_agg(key_columns, rows)) {
+        if (!_passing_through) {
+            _record_pre_agg_decision(
+                    true, _should_expand_hash_table ? "memory" : "low reduction");
+        }
+        COUNTER_UPDATE(_pass_through_rows_counter, rows);
         bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
 
         std::vector<vectorized::DataTypePtr> data_types;
@@ -599,6 +674,12 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
                            for (size_t i = 0; i < num_rows; ++i) {
+                               if constexpr (reuse_place_of_same_key<HashMethodType>) {
+                                   if (i > 0 && agg_method.keys[i] == agg_method.keys[i - 1]) {
+                                       places[i] = places[i - 1];
+                                       continue;
+                                   }
+                               }
                                places[i] = *agg_method.lazy_emplace(state, i, creator,
                                                                     creator_for_null_key);
                            }
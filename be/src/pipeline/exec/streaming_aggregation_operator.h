@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
@@ -60,6 +61,8 @@ private:
     bool _should_expand_preagg_hash_tables();
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
+    bool _should_resume_pre_agg(vectorized::ColumnRawPtrs& key_columns, size_t rows);
+    void _record_pre_agg_decision(bool pass_through, const std::string& reason);
 
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
@@ -86,8 +89,16 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _pass_through_rows_counter = nullptr;
+    RuntimeProfile::Counter* _reprobe_times_counter = nullptr;
+    RuntimeProfile::Counter* _resume_times_counter = nullptr;
 
     bool _should_expand_hash_table = true;
+    bool _passing_through = false;
+    size_t _input_num_blocks = 0;
+    int _blocks_since_reprobe = 0;
+    size_t _pre_agg_decisions = 0;
+    std::string _pre_agg_decision_history;
     int64_t _cur_num_rows_returned = 0;
     vectorized::Arena _agg_arena_pool;
     AggregatedDataVariantsUPtr _agg_data = nullptr;
@@ -70,17 +70,27 @@ Status TableFunctionLocalState::open(RuntimeState* state) {
     return Status::OK();
 }
 
-void TableFunctionLocalState::_copy_output_slots(
-        std::vector<vectorized::MutableColumnPtr>& columns) {
+void TableFunctionLocalState::_copy_output_slots() {
     if (!_current_row_insert_times) {
         return;
     }
+    _output_child_rows.insert(_output_child_rows.end(), _current_row_insert_times,
+                              static_cast<uint32_t>(_cur_child_offset));
+    _current_row_insert_times = 0;
+}
+
+void TableFunctionLocalState::_flush_output_slots(
+        std::vector<vectorized::MutableColumnPtr>& columns) {
+    if (_output_child_rows.empty()) {
+        return;
+    }
     auto& p = _parent->cast<TableFunctionOperatorX>();
     for (auto index : p._output_slot_indexs) {
         auto src_column = _child_block->get_by_position(index).column;
-        columns[index]->insert_many_from(*src_column, _cur_child_offset, _current_row_insert_times);
+        columns[index]->insert_indices_from(*src_column, _output_child_rows.data(),
+                                            _output_child_rows.data() + _output_child_rows.size());
     }
-    _current_row_insert_times = 0;
+    _output_child_rows.clear();
 }
 
 // Returns the index of fn of the last eos counted from back to front
@@ -176,7 +186,11 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
         while (columns[p._child_slots.size()]->size() < state->batch_size()) {
             int idx = _find_last_fn_eos_idx();
             if (idx == 0 || skip_child_row) {
-                _copy_output_slots(columns);
+                _copy_output_slots();
+                if (_cur_child_offset + 1 >= _child_block->rows()) {
+                    // the child block is released after its last row
+                    _flush_output_slots(columns);
+                }
                 // all table functions' results are exhausted, process next child row.
                 process_next_child_row();
                 if (_cur_child_offset == -1) {
@@ -209,7 +223,8 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
         }
     }
 
-    _copy_output_slots(columns);
+    _copy_output_slots();
+    _flush_output_slots(columns);
 
     size_t row_size = columns[p._child_slots.size()]->size();
     for (auto index : p._useless_slot_indexs) {
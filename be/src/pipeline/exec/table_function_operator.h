@@ -56,7 +56,10 @@ private:
 
     MOCK_FUNCTION Status _clone_table_function(RuntimeState* state);
 
-    void _copy_output_slots(std::vector<vectorized::MutableColumnPtr>& columns);
+    void _copy_output_slots();
+    // Copy the child rows collected by _copy_output_slots to the output slots, it must be called
+    // before the child block is released.
+    void _flush_output_slots(std::vector<vectorized::MutableColumnPtr>& columns);
     bool _roll_table_functions(int last_eos_idx);
     // return:
     //  0: all fns are eos
@@ -70,6 +73,9 @@ private:
     int64_t _cur_child_offset = -1;
     std::unique_ptr<vectorized::Block> _child_block;
     int _current_row_insert_times = 0;
+    // The child row of every output row not copied to the output slots yet. The output slots are
+    // copied by insert_indices_from once for many child rows, not once for every child row.
+    std::vector<uint32_t> _output_child_rows;
     bool _child_eos = false;
 
     RuntimeProfile::Counter* _init_function_timer = nullptr;
@@ -17,6 +17,9 @@
 
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "pipeline/local_exchange/local_exchanger.h"
 #include "vec/runtime/partitioner.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -82,7 +85,15 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     SCOPED_TIMER(_init_timer);
     _compute_hash_value_timer = ADD_TIMER(custom_profile(), "ComputeHashValueTime");
     _distribute_timer = ADD_TIMER(custom_profile(), "DistributeDataTime");
-    if (_parent->cast<LocalExchangeSinkOperatorX>()._type == ExchangeType::HASH_SHUFFLE) {
+    auto type = _parent->cast<LocalExchangeSinkOperatorX>()._type;
+    if (type == ExchangeType::HASH_SHUFFLE || type == ExchangeType::BUCKET_HASH_SHUFFLE) {
+        _max_source_rows_counter = ADD_COUNTER(custom_profile(), "MaxSourceRows", TUnit::UNIT);
+        _min_source_rows_counter = ADD_COUNTER(custom_profile(), "MinSourceRows", TUnit::UNIT);
+        // max rows of one source / average rows of all sources, in percent
+        _partition_skew_ratio_counter =
+                ADD_COUNTER(custom_profile(), "PartitionSkewRatio", TUnit::UNIT);
+    }
+    if (type == ExchangeType::HASH_SHUFFLE) {
         custom_profile()->add_info_string(
                 "UseGlobalShuffle",
                 std::to_string(_parent->cast<LocalExchangeSinkOperatorX>()._use_global_shuffle));
@@ -119,9 +130,24 @@ Status LocalExchangeSinkLocalState::close(RuntimeState* state, Status exec_statu
     if (_shared_state) {
         _shared_state->sub_running_sink_operators();
     }
+    _update_skew_counters();
     return Base::close(state, exec_status);
 }
 
+void LocalExchangeSinkLocalState::_update_skew_counters() {
+    if (_rows_per_source.empty() || _max_source_rows_counter == nullptr) {
+        return;
+    }
+    auto [min_it, max_it] = std::minmax_element(_rows_per_source.begin(), _rows_per_source.end());
+    int64_t total = std::accumulate(_rows_per_source.begin(), _rows_per_source.end(), int64_t(0));
+    COUNTER_SET(_max_source_rows_counter, *max_it);
+    COUNTER_SET(_min_source_rows_counter, *min_it);
+    if (total > 0) {
+        COUNTER_SET(_partition_skew_ratio_counter,
+                    *max_it * int64_t(_rows_per_source.size()) * 100 / total);
+    }
+}
+
 std::string LocalExchangeSinkLocalState::debug_string(int indentation_level) const {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer,
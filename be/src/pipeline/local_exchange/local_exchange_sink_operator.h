@@ -47,6 +47,8 @@ public:
     Status close(RuntimeState* state, Status exec_status) override;
 
 private:
+    void _update_skew_counters();
+
     friend class LocalExchangeSinkOperatorX;
     friend class ShuffleExchanger;
     friend class BucketShuffleExchanger;
@@ -63,6 +65,11 @@ private:
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
+    // Rows sent to each source by this sink, used to detect the skewed partitions.
+    std::vector<int64_t> _rows_per_source;
+    RuntimeProfile::Counter* _max_source_rows_counter = nullptr;
+    RuntimeProfile::Counter* _min_source_rows_counter = nullptr;
+    RuntimeProfile::Counter* _partition_skew_ratio_counter = nullptr;
 
     // Used by random passthrough exchanger
     int _channel_id = 0;
@@ -55,6 +55,7 @@ private:
     int _channel_id;
     RuntimeProfile::Counter* _get_block_failed_counter = nullptr;
     RuntimeProfile::Counter* _copy_data_timer = nullptr;
+    RuntimeProfile::Counter* _zero_copy_bytes_counter = nullptr;
     std::vector<RuntimeProfile::Counter*> _deps_counter;
     std::vector<DependencySPtr> _local_merge_deps;
 };
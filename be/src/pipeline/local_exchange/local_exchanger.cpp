@@ -216,6 +216,7 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     DCHECK(shuffle_idx_to_instance_idx && shuffle_idx_to_instance_idx->size() > 0);
     const auto& map = *shuffle_idx_to_instance_idx;
     int32_t enqueue_rows = 0;
+    local_state->_rows_per_source.resize(_num_partitions, 0);
     for (const auto& it : map) {
         DCHECK(it.second >= 0 && it.second < _num_partitions)
                 << it.first << " : " << it.second << " " << _num_partitions;
@@ -223,6 +224,7 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         uint32_t size = partition_rows_histogram[it.first + 1] - start;
         if (size > 0) {
             enqueue_rows += size;
+            local_state->_rows_per_source[it.second] += size;
             _enqueue_data_and_set_ready(it.second, local_state,
                                         {new_block_wrapper, {row_idx, start, size}});
         }
@@ -414,6 +416,19 @@ Status BroadcastExchanger::get_block(RuntimeState* state, vectorized::Block* blo
 
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
+        const auto& data_block = partitioned_block.first->_data_block;
+        if (config::enable_local_exchange_broadcast_zero_copy &&
+            partitioned_block.second.offset_start == 0 &&
+            partitioned_block.second.length == data_block.rows()) {
+            // Columns are immutable once they are shared by all sources, so borrow them instead
+            // of copying. The memory is released when the last reader drops the columns, and
+            // the reader which mutates the columns will get its own copy by COW.
+            *block = data_block;
+            if (profile.zero_copy_bytes_counter) {
+                COUNTER_UPDATE(profile.zero_copy_bytes_counter, data_block.allocated_bytes());
+            }
+            return Status::OK();
+        }
         SCOPED_TIMER(profile.copy_data_timer);
         vectorized::MutableBlock mutable_block =
                 vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
@@ -37,6 +37,8 @@ struct Profile {
     RuntimeProfile::Counter* compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* distribute_timer = nullptr;
     RuntimeProfile::Counter* copy_data_timer = nullptr;
+    // bytes of blocks which are borrowed by source operators instead of copied
+    RuntimeProfile::Counter* zero_copy_bytes_counter = nullptr;
 };
 
 struct SinkInfo {
@@ -32,6 +32,7 @@
 #include "pipeline/exec/scan_operator.h"
 #include "pipeline/pipeline.h"
 #include "pipeline/pipeline_fragment_context.h"
+#include "pipeline/pipeline_tracing.h"
 #include "pipeline/task_queue.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/descriptors.h"
@@ -42,8 +43,10 @@
 #include "util/container_util.hpp"
 #include "util/defer_op.h"
 #include "util/mem_info.h"
+#include "util/query_cpu_profiler.h"
 #include "util/runtime_profile.h"
 #include "util/uid_util.h"
+#include "vec/common/allocator.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream.h"
 
@@ -81,6 +84,9 @@ PipelineTask::PipelineTask(PipelinePtr& pipeline, uint32_t task_id, RuntimeState
           _execution_dep(state->get_query_ctx()->get_execution_dependency()),
           _memory_sufficient_dependency(state->get_query_ctx()->get_memory_sufficient_dependency()),
           _pipeline_name(_pipeline->name()) {
+    if (auto* tracer_ctx = ExecEnv::GetInstance()->pipeline_tracer_context()) {
+        _traced = tracer_ctx->task_trace_ring()->sampled(_query_id);
+    }
     if (!_shared_state_map.contains(_sink->dests_id().front())) {
         auto shared_state = _sink->create_shared_state();
         if (shared_state) {
@@ -230,14 +236,47 @@ void PipelineTask::_init_profile() {
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
+    _numa_local_steal_times = ADD_COUNTER(_task_profile, "NumaLocalStealTimes", TUnit::UNIT);
+    _numa_remote_steal_times = ADD_COUNTER(_task_profile, "NumaRemoteStealTimes", TUnit::UNIT);
     _memory_reserve_times = ADD_COUNTER(_task_profile, "MemoryReserveTimes", TUnit::UNIT);
     _memory_reserve_failed_times =
             ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
+    _allocator_cache_hit_times = ADD_COUNTER(_task_profile, "AllocatorCacheHitTimes", TUnit::UNIT);
+    _allocator_cache_miss_times =
+            ADD_COUNTER(_task_profile, "AllocatorCacheMissTimes", TUnit::UNIT);
+    if (config::enable_pipeline_task_hardware_counters) {
+        _hardware_counters[ThreadHardwareCounters::CPU_CYCLES] =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwCpuCycles", TUnit::UNIT, 1);
+        _hardware_counters[ThreadHardwareCounters::INSTRUCTIONS] =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwInstructions", TUnit::UNIT, 1);
+        _hardware_counters[ThreadHardwareCounters::LLC_MISSES] =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwLLCMisses", TUnit::UNIT, 1);
+        _hardware_counters[ThreadHardwareCounters::DTLB_MISSES] =
+                ADD_COUNTER_WITH_LEVEL(_task_profile, "HwDTLBMisses", TUnit::UNIT, 1);
+    }
 }
 
 void PipelineTask::_fresh_profile_counter() {
     COUNTER_SET(_schedule_counts, (int64_t)_schedule_time);
     COUNTER_SET(_wait_worker_timer, (int64_t)_wait_worker_watcher.elapsed_time());
+    if (auto* cycles = _hardware_counters[ThreadHardwareCounters::CPU_CYCLES];
+        cycles != nullptr && cycles->value() > 0) {
+        auto instructions = _hardware_counters[ThreadHardwareCounters::INSTRUCTIONS]->value();
+        _task_profile->add_info_string(
+                "HwIPC",
+                fmt::format("{:.2f}", static_cast<double>(instructions) /
+                                              static_cast<double>(cycles->value())));
+    }
+}
+
+void PipelineTask::_update_hardware_counters(const ThreadHardwareCounters::Values& start_values) {
+    ThreadHardwareCounters::Values end_values;
+    if (!ThreadHardwareCounters::read(&end_values)) {
+        return;
+    }
+    for (int i = 0; i < ThreadHardwareCounters::NUM_COUNTERS; ++i) {
+        COUNTER_UPDATE(_hardware_counters[i], end_values[i] - start_values[i]);
+    }
 }
 
 Status PipelineTask::_open() {
@@ -360,7 +399,14 @@ Status PipelineTask::execute(bool* done) {
     int64_t time_spent = 0;
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    const uint64_t run_start_time_us = _traced ? MonotonicMicros() : 0;
+    // one read of the counters at each end of this execution slice
+    ThreadHardwareCounters::Values hardware_start_values;
+    const bool read_hardware_counters =
+            _hardware_counters[ThreadHardwareCounters::CPU_CYCLES] != nullptr &&
+            ThreadHardwareCounters::read(&hardware_start_values);
     SCOPED_ATTACH_TASK(_state);
+    QueryCpuProfiler::ScopedQueryTag cpu_profiler_tag(_query_id);
     Defer running_defer {[&]() {
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
@@ -369,6 +415,12 @@ Status PipelineTask::execute(bool* done) {
         _task_cpu_timer->update(delta_cpu_time);
         fragment_context->get_query_ctx()->resource_ctx()->cpu_context()->update_cpu_cost_ms(
                 delta_cpu_time);
+        if (_traced) [[unlikely]] {
+            _trace_run(run_start_time_us, delta_cpu_time);
+        }
+        if (read_hardware_counters) {
+            _update_hardware_counters(hardware_start_values);
+        }
 
         // If task is woke up early, we should terminate all operators, and this task could be closed immediately.
         if (_wake_up_early) {
@@ -398,6 +450,14 @@ Status PipelineTask::execute(bool* done) {
 
     SCOPED_TIMER(_task_profile->total_time_counter());
     SCOPED_TIMER(_exec_timer);
+    const auto allocator_cache_hit_times = AllocatorThreadCache::hit_times();
+    const auto allocator_cache_miss_times = AllocatorThreadCache::miss_times();
+    Defer allocator_cache_defer {[&]() {
+        COUNTER_UPDATE(_allocator_cache_hit_times,
+                       AllocatorThreadCache::hit_times() - allocator_cache_hit_times);
+        COUNTER_UPDATE(_allocator_cache_miss_times,
+                       AllocatorThreadCache::miss_times() - allocator_cache_miss_times);
+    }};
 
     DBUG_EXECUTE_IF("fault_inject::PipelineXTask::execute", {
         Status status = Status::Error<INTERNAL_ERROR>("fault_inject pipeline_task execute failed");
@@ -429,6 +489,10 @@ Status PipelineTask::execute(bool* done) {
         RETURN_IF_ERROR(_open());
     }
 
+    // Let the long running operators yield cooperatively when the time slice is used up.
+    _state->set_task_yield_deadline_ns(MonotonicNanos() + int64_t(_exec_time_slice) - time_spent);
+    Defer yield_deadline_defer {[&]() { _state->set_task_yield_deadline_ns(0); }};
+
     while (!fragment_context->is_canceled()) {
         SCOPED_RAW_TIMER(&time_spent);
         Defer defer {[&]() {
@@ -556,7 +620,10 @@ Status PipelineTask::execute(bool* done) {
                     }
                 }
             });
-            status = _sink->sink(_state, block, _eos);
+            {
+                QueryCpuProfiler::ScopedNodeTag cpu_profiler_tag(_sink->node_id());
+                status = _sink->sink(_state, block, _eos);
+            }
 
             if (status.is<ErrorCode::END_OF_FILE>()) {
                 set_wake_up_early();
@@ -791,6 +858,9 @@ Status PipelineTask::revoke_memory(const std::shared_ptr<SpillContext>& spill_co
 Status PipelineTask::wake_up(Dependency* dep) {
     // call by dependency
     DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
+    if (_traced) [[unlikely]] {
+        _trace_blocked(dep);
+    }
     _blocked_dep = nullptr;
     auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
     RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
@@ -798,6 +868,41 @@ Status PipelineTask::wake_up(Dependency* dep) {
     return Status::OK();
 }
 
+void PipelineTask::_trace_run(uint64_t start_time_us, uint64_t cpu_time_ns) {
+    TaskTraceEvent event;
+    event.type = TaskTraceEvent::Type::RUN;
+    event.query_id = _query_id;
+    event.task_name = task_name();
+    event.core_id = _core_id < 0 ? 0 : static_cast<uint32_t>(_core_id);
+    event.thread_id = static_cast<uint64_t>(pthread_self());
+    event.start_time = start_time_us;
+    event.end_time = MonotonicMicros();
+    event.cpu_time_ns = cpu_time_ns;
+    ExecEnv::GetInstance()->pipeline_tracer_context()->task_trace_ring()->record(std::move(event));
+}
+
+void PipelineTask::_trace_blocked(Dependency* dep) {
+    TaskTraceEvent event;
+    event.type = TaskTraceEvent::Type::BLOCKED;
+    event.query_id = _query_id;
+    event.task_name = task_name();
+    event.dependency_name = dep->name();
+    event.start_time = _blocked_since_us;
+    event.end_time = MonotonicMicros();
+    ExecEnv::GetInstance()->pipeline_tracer_context()->task_trace_ring()->record(std::move(event));
+}
+
+void PipelineTask::_trace_runnable() {
+    TaskTraceEvent event;
+    event.type = TaskTraceEvent::Type::RUNNABLE;
+    event.query_id = _query_id;
+    event.task_name = task_name();
+    event.thread_id = static_cast<uint64_t>(pthread_self());
+    event.start_time = _runnable_since_us;
+    event.end_time = MonotonicMicros();
+    ExecEnv::GetInstance()->pipeline_tracer_context()->task_trace_ring()->record(std::move(event));
+}
+
 Status PipelineTask::_state_transition(State new_state) {
     if (_exec_state != new_state) {
         _state_change_watcher.reset();
@@ -26,8 +26,10 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -142,9 +144,22 @@ public:
     void put_in_runnable_queue() {
         _schedule_time++;
         _wait_worker_watcher.start();
+        if (_traced) [[unlikely]] {
+            _runnable_since_us = MonotonicMicros();
+        }
     }
 
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue() {
+        _wait_worker_watcher.stop();
+        if (_traced) [[unlikely]] {
+            _trace_runnable();
+        }
+    }
+
+    // Called when this task is stolen by a worker of the same (or another) NUMA node.
+    void inc_numa_steal_times(bool same_numa_node) {
+        COUNTER_UPDATE(same_numa_node ? _numa_local_steal_times : _numa_remote_steal_times, 1);
+    }
 
     bool is_running() { return _running.load(); }
     bool is_revoking() const;
@@ -167,6 +182,9 @@ public:
     Status blocked(Dependency* dependency) {
         DCHECK_EQ(_blocked_dep, nullptr) << "task: " << debug_string();
         _blocked_dep = dependency;
+        if (_traced) [[unlikely]] {
+            _blocked_since_us = MonotonicMicros();
+        }
         return _state_transition(PipelineTask::State::BLOCKED);
     }
 
@@ -187,6 +205,13 @@ private:
     // otherwise return true.
     bool _try_to_reserve_memory(const size_t reserve_size, OperatorBase* op);
 
+    // Record the intervals of a sampled task into the TaskTraceRing of PipelineTracerContext.
+    void _trace_run(uint64_t start_time_us, uint64_t cpu_time_ns);
+    void _trace_blocked(Dependency* dep);
+    void _trace_runnable();
+
+    void _update_hardware_counters(const ThreadHardwareCounters::Values& start_values);
+
     const TUniqueId _query_id;
     const uint32_t _index;
     PipelinePtr _pipeline;
@@ -225,8 +250,15 @@ private:
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
+    RuntimeProfile::Counter* _numa_local_steal_times = nullptr;
+    RuntimeProfile::Counter* _numa_remote_steal_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
+    RuntimeProfile::Counter* _allocator_cache_hit_times = nullptr;
+    RuntimeProfile::Counter* _allocator_cache_miss_times = nullptr;
+    // only if config::enable_pipeline_task_hardware_counters when the task is prepared
+    std::array<RuntimeProfile::Counter*, ThreadHardwareCounters::NUM_COUNTERS>
+            _hardware_counters {};
 
     Operators _operators; // left is _source, right is _root
     OperatorXBase* _source;
@@ -253,6 +285,11 @@ private:
     unsigned long long _exec_time_slice = config::pipeline_task_exec_time_slice * NANOS_PER_MILLIS;
     Dependency* _blocked_dep = nullptr;
 
+    // whether the intervals of this task are traced, see TaskTraceRing::sampled
+    bool _traced = false;
+    uint64_t _blocked_since_us = 0;
+    uint64_t _runnable_since_us = 0;
+
     Dependency* _execution_dep = nullptr;
     Dependency* _memory_sufficient_dependency;
     std::mutex _dependency_lock;
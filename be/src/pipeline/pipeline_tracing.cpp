@@ -19,6 +19,8 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -26,15 +28,135 @@
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "io/fs/local_file_writer.h"
 #include "util/time.h"
+#include "util/uid_util.h"
 
 namespace doris::pipeline {
 
+TaskTraceRing::TaskTraceRing(size_t capacity)
+        : _shard_capacity(capacity == 0 ? 0 : (capacity + SHARD_NUM - 1) / SHARD_NUM) {}
+
+bool TaskTraceRing::sampled(const TUniqueId& query_id) const {
+    int32_t interval = config::pipeline_task_trace_sample_interval;
+    return _shard_capacity > 0 && interval > 0 &&
+           static_cast<uint64_t>(query_id.lo) % static_cast<uint64_t>(interval) == 0;
+}
+
+void TaskTraceRing::record(TaskTraceEvent event) {
+    if (_shard_capacity == 0) [[unlikely]] {
+        return;
+    }
+    auto& shard = _shards[std::hash<std::thread::id>()(std::this_thread::get_id()) % SHARD_NUM];
+    std::lock_guard l(shard.lock);
+    if (shard.events.size() < _shard_capacity) {
+        shard.events.push_back(std::move(event));
+    } else {
+        shard.events[shard.next] = std::move(event);
+    }
+    shard.next = (shard.next + 1) % _shard_capacity;
+}
+
+std::string TaskTraceRing::dump_chrome_trace(const TUniqueId* query_id) const {
+    std::vector<TaskTraceEvent> events;
+    for (const auto& shard : _shards) {
+        std::lock_guard l(shard.lock);
+        for (const auto& event : shard.events) {
+            if (query_id == nullptr || event.query_id == *query_id) {
+                events.push_back(event);
+            }
+        }
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    auto write_metadata = [&](const char* name, uint64_t pid, uint64_t tid,
+                              const std::string& value) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name);
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Uint64(pid);
+        writer.Key("tid");
+        writer.Uint64(tid);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(value.c_str());
+        writer.EndObject();
+        writer.EndObject();
+    };
+    // perfetto needs integer ids of the processes and threads
+    std::unordered_map<std::string, uint64_t> query_pids;
+    std::unordered_map<std::string, uint64_t> task_tids;
+    for (const auto& event : events) {
+        std::string query = print_id(event.query_id);
+        auto [query_it, new_query] = query_pids.try_emplace(query, query_pids.size() + 1);
+        uint64_t pid = query_it->second;
+        if (new_query) {
+            write_metadata("process_name", pid, 0, "query " + query);
+        }
+        auto [task_it, new_task] =
+                task_tids.try_emplace(query + event.task_name, task_tids.size() + 1);
+        uint64_t tid = task_it->second;
+        if (new_task) {
+            write_metadata("thread_name", pid, tid, event.task_name);
+        }
+
+        writer.StartObject();
+        writer.Key("name");
+        switch (event.type) {
+        case TaskTraceEvent::Type::RUN:
+            writer.String("run");
+            break;
+        case TaskTraceEvent::Type::BLOCKED:
+            writer.String(("blocked by " + event.dependency_name).c_str());
+            break;
+        case TaskTraceEvent::Type::RUNNABLE:
+            writer.String("runnable");
+            break;
+        }
+        writer.Key("ph");
+        writer.String("X");
+        writer.Key("pid");
+        writer.Uint64(pid);
+        writer.Key("tid");
+        writer.Uint64(tid);
+        writer.Key("ts");
+        writer.Uint64(event.start_time);
+        writer.Key("dur");
+        writer.Uint64(event.end_time > event.start_time ? event.end_time - event.start_time : 0);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("core_id");
+        writer.Uint(event.core_id);
+        writer.Key("thread_id");
+        writer.Uint64(event.thread_id);
+        if (event.type == TaskTraceEvent::Type::RUN) {
+            writer.Key("cpu_time_us");
+            writer.Uint64(event.cpu_time_ns / 1000);
+        }
+        writer.EndObject();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    return buffer.GetString();
+}
+
 void PipelineTracerContext::record(ScheduleRecord record) {
     if (_dump_type == RecordType::None) [[unlikely]] {
         return;
@@ -22,8 +22,13 @@
 #include <gen_cpp/Types_types.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -61,10 +66,60 @@ using OneQueryTraces = moodycamel::ConcurrentQueue<ScheduleRecord>;
 using OneQueryTracesSPtr = std::shared_ptr<moodycamel::ConcurrentQueue<ScheduleRecord>>;
 using QueryTracesMap = std::map<QueryID, OneQueryTracesSPtr>;
 
+// An interval that a sampled pipeline task spent running, blocked by a dependency, or waiting for
+// a worker in the runnable queue.
+struct TaskTraceEvent {
+    enum class Type : uint8_t { RUN, BLOCKED, RUNNABLE };
+
+    Type type = Type::RUN;
+    TUniqueId query_id;
+    std::string task_name;
+    // the dependency which blocked the task, only for BLOCKED
+    std::string dependency_name;
+    uint32_t core_id = 0;
+    uint64_t thread_id = 0;
+    uint64_t start_time = 0; // us
+    uint64_t end_time = 0;   // us
+    // cpu time of the worker thread, only for RUN
+    uint64_t cpu_time_ns = 0;
+};
+
+// Keeps the latest events of the sampled tasks in a fixed-size ring buffer, so it's cheap enough
+// to be always on, unlike the dump of PipelineTracerContext. The buffer is split into shards by
+// the recording thread to reduce the contention between the workers.
+class TaskTraceRing {
+public:
+    explicit TaskTraceRing(size_t capacity);
+
+    // Whether the tasks of the query are traced, see config::pipeline_task_trace_sample_interval.
+    bool sampled(const TUniqueId& query_id) const;
+
+    void record(TaskTraceEvent event);
+
+    // Dump the events in the Chrome trace event format, which can be opened by Perfetto UI.
+    // One process per query and one thread per task. Only the events of `query_id` are dumped
+    // if it's not nullptr.
+    std::string dump_chrome_trace(const TUniqueId* query_id) const;
+
+private:
+    static constexpr size_t SHARD_NUM = 16;
+
+    struct Shard {
+        mutable std::mutex lock;
+        std::vector<TaskTraceEvent> events;
+        size_t next = 0;
+    };
+
+    size_t _shard_capacity;
+    std::array<Shard, SHARD_NUM> _shards;
+};
+
 // belongs to exec_env, for all query, if enabled
 class PipelineTracerContext {
 public:
-    PipelineTracerContext() : _data(std::make_shared<QueryTracesMap>()) {}
+    PipelineTracerContext()
+            : _data(std::make_shared<QueryTracesMap>()),
+              _task_trace_ring(std::max(config::pipeline_task_trace_ring_size, 0)) {}
     enum class RecordType {
         None,     // disable
         PerQuery, // record per query. one query one file.
@@ -77,6 +132,8 @@ public:
 
     bool enabled() const { return !(_dump_type == RecordType::None); }
 
+    TaskTraceRing* task_trace_ring() { return &_task_trace_ring; }
+
 private:
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
@@ -94,5 +151,7 @@ private:
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
+
+    TaskTraceRing _task_trace_ring;
 };
 } // namespace doris::pipeline
@@ -17,8 +17,41 @@
 
 #include "query_cache.h"
 
+#include <algorithm>
+#include <shared_mutex>
+#include <vector>
+
+#include "olap/base_tablet.h"
+#include "olap/rowset/rowset.h"
+
 namespace doris {
 
+namespace {
+
+// Return true if the rowsets of versions [start_version, end_version] have neither rows nor
+// delete predicates.
+bool only_empty_rowsets(int64_t tablet_id, int64_t start_version, int64_t end_version) {
+    auto tablet = ExecEnv::get_tablet(tablet_id);
+    if (!tablet.has_value()) {
+        return false;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    {
+        std::shared_lock rlock(tablet.value()->get_header_lock());
+        // fails if the versions are compacted with the cached ones
+        if (!tablet.value()
+                     ->capture_consistent_rowsets_unlocked({start_version, end_version}, &rowsets)
+                     .ok()) {
+            return false;
+        }
+    }
+    return std::all_of(rowsets.begin(), rowsets.end(), [](const RowsetSharedPtr& rowset) {
+        return rowset->zero_num_rows() && !rowset->rowset_meta()->has_delete_predicate();
+    });
+}
+
+} // namespace
+
 std::vector<int>* QueryCacheHandle::get_cache_slot_orders() {
     DCHECK(_handle);
     auto result_ptr = reinterpret_cast<LRUHandle*>(_handle)->value;
@@ -53,12 +86,17 @@ void QueryCache::insert(const CacheKey& key, int64_t version, CacheResult& res,
                                                   cache_size, CachePriority::NORMAL));
 }
 
-bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheHandle* handle) {
+bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheHandle* handle,
+                        int64_t tablet_id) {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
     auto* lru_handle = LRUCachePolicy::lookup(key);
     if (lru_handle) {
         QueryCacheHandle tmp_handle(this, lru_handle);
-        if (tmp_handle.get_cache_version() == version) {
+        int64_t cache_version = tmp_handle.get_cache_version();
+        if (cache_version == version ||
+            (tablet_id >= 0 && config::enable_query_cache_reuse_on_empty_versions &&
+             cache_version < version &&
+             only_empty_rowsets(tablet_id, cache_version + 1, version))) {
             *handle = std::move(tmp_handle);
             return true;
         }
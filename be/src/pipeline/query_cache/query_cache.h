@@ -144,7 +144,11 @@ public:
             : LRUCachePolicy(CachePolicy::CacheType::QUERY_CACHE, capacity, LRUCacheType::SIZE,
                              3600 * 24, num_shards) {}
 
-    bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
+    // If `tablet_id` is set, an entry of an older version is also returned when the rowsets of
+    // the tablet after that version are all empty, for example the loads into other tablets of
+    // the partition, so it has the same result as the entry of `version`.
+    bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle,
+                int64_t tablet_id = -1);
 
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
@@ -18,13 +18,17 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/time.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -33,7 +37,7 @@ PipelineTaskSPtr SubTaskQueue::try_take(bool is_steal) {
     if (_queue.empty()) {
         return nullptr;
     }
-    auto task = _queue.front();
+    auto task = std::move(_queue.front());
     _queue.pop();
     return task;
 }
@@ -98,6 +102,17 @@ PipelineTaskSPtr PriorityTaskQueue::try_take(bool is_steal) {
     return _try_take_unprotected(is_steal);
 }
 
+PipelineTaskSPtr PriorityTaskQueue::try_steal() {
+    if (_total_task_size == 0) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(_work_size_mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return nullptr;
+    }
+    return _try_take_unprotected(true);
+}
+
 PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
     std::unique_lock<std::mutex> lock(_work_size_mutex);
     auto task = _try_take_unprotected(false);
@@ -126,7 +141,7 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
         _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
     }
 
-    _sub_queues[level].push_back(task);
+    _sub_queues[level].push_back(std::move(task));
     _total_task_size++;
     DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
     _wait_task.notify_one();
@@ -136,7 +151,49 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {
+    if (config::enable_numa_aware_pipeline_task_steal) {
+        _init_numa_topology();
+    }
+}
+
+void MultiCoreTaskQueue::_init_numa_topology() {
+    // Only meaningful on a machine with more than one NUMA node.
+    if (CpuInfo::get_max_num_numa_nodes() <= 1 || CpuInfo::num_cores() <= 0) {
+        return;
+    }
+    int num_nodes = CpuInfo::get_max_num_numa_nodes();
+    _core_numa_node.resize(_core_size);
+    _numa_node_local_cores.resize(num_nodes);
+    _numa_node_remote_cores.resize(num_nodes);
+    // Worker i is bound to the NUMA node of cpu (i % num_cores), so the workers are spread
+    // over the nodes in the same way as the cpus.
+    for (int i = 0; i < _core_size; ++i) {
+        _core_numa_node[i] = CpuInfo::get_numa_node_of_core(i % CpuInfo::num_cores());
+    }
+    for (int node = 0; node < num_nodes; ++node) {
+        for (int i = 0; i < _core_size; ++i) {
+            if (_core_numa_node[i] == node) {
+                _numa_node_local_cores[node].push_back(i);
+            } else {
+                _numa_node_remote_cores[node].push_back(i);
+            }
+        }
+    }
+    _idle_since_ns.assign(_core_size, 0);
+    _numa_aware = true;
+    LOG(INFO) << "MultiCoreTaskQueue enable NUMA aware task steal, cores: " << _core_size
+              << ", numa nodes: " << num_nodes;
+}
+
+const std::vector<int>& MultiCoreTaskQueue::numa_node_cpus(int core_id) const {
+    static const std::vector<int> EMPTY;
+    if (!_numa_aware) {
+        return EMPTY;
+    }
+    DCHECK(core_id < _core_size);
+    return CpuInfo::get_cores_of_numa_node(_core_numa_node[core_id]);
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -158,21 +215,77 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
         if (task) {
             break;
         }
-        task = _steal_take(core_id);
+        task = _numa_aware ? _numa_aware_steal_take(core_id) : _steal_take(core_id);
         if (task) {
             break;
         }
-        task = _prio_task_queues[core_id].take(WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
+        // A NUMA aware worker should wake up in time to steal from the other nodes.
+        uint32_t timeout_ms =
+                _numa_aware ? std::clamp<uint32_t>(
+                                      config::pipeline_task_cross_numa_steal_idle_ms, 1,
+                                      WAIT_CORE_TASK_TIMEOUT_MS)
+                            : WAIT_CORE_TASK_TIMEOUT_MS;
+        task = _prio_task_queues[core_id].take(timeout_ms);
         if (task) {
             break;
         }
     }
     if (task) {
+        if (_numa_aware) {
+            _idle_since_ns[core_id] = 0;
+        }
         task->pop_out_runnable_queue();
     }
     return task;
 }
 
+PipelineTaskSPtr MultiCoreTaskQueue::_numa_aware_steal_take(int core_id) {
+    DCHECK(core_id < _core_size);
+    int node = _core_numa_node[core_id];
+    auto task = _steal_from(core_id, _numa_node_local_cores[node]);
+    if (task) {
+        DorisMetrics::instance()->pipeline_task_local_numa_steal_count->increment(1);
+        task->inc_numa_steal_times(true);
+        return task;
+    }
+
+    int64_t now = MonotonicNanos();
+    if (_idle_since_ns[core_id] == 0) {
+        _idle_since_ns[core_id] = now;
+    }
+    if (now - _idle_since_ns[core_id] <
+        int64_t(config::pipeline_task_cross_numa_steal_idle_ms) * NANOS_PER_MILLIS) {
+        return nullptr;
+    }
+    task = _steal_from(core_id, _numa_node_remote_cores[node]);
+    if (task) {
+        DorisMetrics::instance()->pipeline_task_remote_numa_steal_count->increment(1);
+        task->inc_numa_steal_times(false);
+    }
+    return task;
+}
+
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_from(int core_id, const std::vector<int>& candidates) {
+    if (candidates.empty()) {
+        return nullptr;
+    }
+    // Start from the next worker of `core_id` so that the victims are spread evenly.
+    auto size = candidates.size();
+    auto start = std::upper_bound(candidates.begin(), candidates.end(), core_id) -
+                 candidates.begin();
+    for (size_t i = 0; i < size; ++i) {
+        int next_id = candidates[(start + i) % size];
+        if (next_id == core_id) {
+            continue;
+        }
+        auto task = _try_steal(next_id);
+        if (task) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
 PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     DCHECK(core_id < _core_size);
     int next_id = core_id;
@@ -182,7 +295,7 @@ PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
             next_id = 0;
         }
         DCHECK(next_id < _core_size);
-        auto task = _prio_task_queues[next_id].try_take(true);
+        auto task = _try_steal(next_id);
         if (task) {
             return task;
         }
@@ -190,18 +303,24 @@ PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
     return nullptr;
 }
 
+PipelineTaskSPtr MultiCoreTaskQueue::_try_steal(int core_id) {
+    return config::enable_pipeline_task_queue_try_lock_steal
+                   ? _prio_task_queues[core_id].try_steal()
+                   : _prio_task_queues[core_id].try_take(true);
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
         core_id = _next_core.fetch_add(1) % _core_size;
     }
-    return push_back(task, core_id);
+    return push_back(std::move(task), core_id);
 }
 
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task, int core_id) {
     DCHECK(core_id < _core_size);
     task->put_in_runnable_queue();
-    return _prio_task_queues[core_id].push(task);
+    return _prio_task_queues[core_id].push(std::move(task));
 }
 
 void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
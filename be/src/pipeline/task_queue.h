@@ -27,6 +27,7 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
@@ -38,7 +39,7 @@ class SubTaskQueue {
     friend class PriorityTaskQueue;
 
 public:
-    void push_back(PipelineTaskSPtr task) { _queue.emplace(task); }
+    void push_back(PipelineTaskSPtr task) { _queue.emplace(std::move(task)); }
 
     PipelineTaskSPtr try_take(bool is_steal);
 
@@ -76,6 +77,10 @@ public:
 
     PipelineTaskSPtr take(uint32_t timeout_ms = 0);
 
+    // Used by the other workers to steal tasks. Unlike `try_take`, it does not wait for
+    // the lock if the queue is empty or is being visited by other threads.
+    PipelineTaskSPtr try_steal();
+
     Status push(PipelineTaskSPtr task);
 
     void inc_sub_queue_runtime(int level, uint64_t runtime) {
@@ -126,14 +131,37 @@ public:
 
     int cores() const { return _core_size; }
 
+    bool numa_aware() const { return _numa_aware; }
+
+    // The cpus of the NUMA node which the worker `core_id` belongs to.
+    // Empty if the queue is not NUMA aware.
+    const std::vector<int>& numa_node_cpus(int core_id) const;
+
 private:
+    void _init_numa_topology();
+
     PipelineTaskSPtr _steal_take(int core_id);
+    // Steal from the workers on the same NUMA node first, and only steal from the
+    // other nodes after the worker has been idle for `pipeline_task_cross_numa_steal_idle_ms`.
+    PipelineTaskSPtr _numa_aware_steal_take(int core_id);
+    PipelineTaskSPtr _steal_from(int core_id, const std::vector<int>& candidates);
+    PipelineTaskSPtr _try_steal(int core_id);
 
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
 
     int _core_size;
+
+    bool _numa_aware = false;
+    // NUMA node of each worker
+    std::vector<int> _core_numa_node;
+    // workers of each NUMA node, and workers which do not belong to each NUMA node
+    std::vector<std::vector<int>> _numa_node_local_cores;
+    std::vector<std::vector<int>> _numa_node_remote_cores;
+    // the time(ns) since which each worker can not find any task, 0 means the worker is busy.
+    // every slot is only visited by its own worker.
+    std::vector<int64_t> _idle_since_ns;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
 };
 #include "common/compile_check_end.h"
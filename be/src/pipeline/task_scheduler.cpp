@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -95,7 +96,26 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
     }
 }
 
+void TaskScheduler::_bind_numa_node(int index) {
+    const auto& cpus = _task_queue.numa_node_cpus(index);
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "TaskScheduler " << _name << " failed to bind worker " << index
+                     << " to NUMA node, errno: " << ret;
+    }
+}
+
 void TaskScheduler::_do_work(int index) {
+    if (_task_queue.numa_aware()) {
+        _bind_numa_node(index);
+    }
     while (!_need_to_stop) {
         auto task = _task_queue.take(index);
         if (!task) {
@@ -56,7 +56,7 @@ Result<BaseTabletSPtr> ExecEnv::get_tablet(int64_t tablet_id, SyncRowsetStats* s
                                            bool force_use_cache) {
     auto storage_engine = GetInstance()->_storage_engine.get();
     return storage_engine != nullptr
-                   ? storage_engine->get_tablet(tablet_id, sync_stats)
+                   ? storage_engine->get_tablet(tablet_id, sync_stats, force_use_cache)
                    : ResultError(Status::InternalError("failed to get tablet {}", tablet_id));
 }
 
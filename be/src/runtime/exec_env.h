@@ -65,6 +65,7 @@ class HdfsMgr;
 namespace segment_v2 {
 class InvertedIndexSearcherCache;
 class InvertedIndexQueryCache;
+class SegmentFooterStore;
 class TmpFileDirs;
 
 namespace inverted_index {
@@ -195,6 +196,11 @@ public:
     // Multiple groups are used to reduce the impact of locks.
     std::vector<TrackerLimiterGroup> mem_tracker_limiter_pool;
     void init_mem_tracker();
+    // Init the memory trackers and the caches only, for the tools reading the segments.
+    Status init_mem_env_for_tools() { return _init_mem_env(); }
+    // Init the s3 upload thread pool and the file cache only, for the tools reading and writing
+    // the remote files.
+    Status init_remote_io_env_for_tools();
     std::shared_ptr<MemTrackerLimiter> orphan_mem_tracker() { return _orphan_mem_tracker; }
     std::shared_ptr<MemTrackerLimiter> brpc_iobuf_block_memory_tracker() {
         return _brpc_iobuf_block_memory_tracker;
@@ -241,6 +247,10 @@ public:
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
     ThreadPool* non_block_close_thread_pool();
     ThreadPool* s3_file_system_thread_pool() { return _s3_file_system_thread_pool.get(); }
+    ThreadPool* s3_hedged_read_thread_pool() { return _s3_hedged_read_thread_pool.get(); }
+    ThreadPool* page_decompress_prefetch_thread_pool() {
+        return _page_decompress_prefetch_thread_pool.get();
+    }
 
     void init_file_cache_factory(std::vector<doris::CachePath>& cache_paths);
     io::FileCacheFactory* file_cache_factory() { return _file_cache_factory; }
@@ -341,6 +351,7 @@ public:
     TabletColumnObjectPool* get_tablet_column_object_pool() { return _tablet_column_object_pool; }
     SchemaCache* schema_cache() { return _schema_cache; }
     StoragePageCache* get_storage_page_cache() { return _storage_page_cache; }
+    segment_v2::SegmentFooterStore* get_segment_footer_store() { return _segment_footer_store; }
     SegmentLoader* segment_loader() { return _segment_loader; }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
     RowCache* get_row_cache() { return _row_cache; }
@@ -449,6 +460,10 @@ private:
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
     std::unique_ptr<ThreadPool> _non_block_close_thread_pool;
     std::unique_ptr<ThreadPool> _s3_file_system_thread_pool;
+    // runs the "get" requests of the hedged s3 reads
+    std::unique_ptr<ThreadPool> _s3_hedged_read_thread_pool;
+    // decompresses the next pages of the column iterators into the page cache
+    std::unique_ptr<ThreadPool> _page_decompress_prefetch_thread_pool;
 
     FragmentMgr* _fragment_mgr = nullptr;
     WorkloadGroupMgr* _workload_group_manager = nullptr;
@@ -495,6 +510,7 @@ private:
     std::unique_ptr<BaseStorageEngine> _storage_engine;
     SchemaCache* _schema_cache = nullptr;
     StoragePageCache* _storage_page_cache = nullptr;
+    segment_v2::SegmentFooterStore* _segment_footer_store = nullptr;
     SegmentLoader* _segment_loader = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
     RowCache* _row_cache = nullptr;
@@ -53,6 +53,7 @@
 #include "olap/options.h"
 #include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
+#include "olap/rowset/segment_v2/segment_footer_store.h"
 #include "olap/schema_cache.h"
 #include "olap/segment_loader.h"
 #include "olap/storage_engine.h"
@@ -257,6 +258,16 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_min_threads(config::min_s3_file_system_thread_num)
                               .set_max_threads(config::max_s3_file_system_thread_num)
                               .build(&_s3_file_system_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("S3HedgedReadThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(config::s3_hedged_read_thread_num)
+                              .build(&_s3_hedged_read_thread_pool));
+    // the prefetches are dropped when the queue is full, they are only worth doing soon
+    static_cast<void>(ThreadPoolBuilder("PageDecompressPrefetchThreadPool")
+                              .set_min_threads(0)
+                              .set_max_threads(config::page_decompress_prefetch_thread_num)
+                              .set_max_queue_size(config::page_decompress_prefetch_thread_num * 16)
+                              .build(&_page_decompress_prefetch_thread_pool));
     RETURN_IF_ERROR(_init_mem_env());
 
     // NOTE: runtime query statistics mgr could be visited by query and daemon thread
@@ -444,6 +455,21 @@ void ExecEnv::init_file_cache_factory(std::vector<doris::CachePath>& cache_paths
     }
 }
 
+Status ExecEnv::init_remote_io_env_for_tools() {
+    auto [s3_file_upload_min_threads, s3_file_upload_max_threads] =
+            get_num_threads(config::num_s3_file_upload_thread_pool_min_thread,
+                            config::num_s3_file_upload_thread_pool_max_thread);
+    RETURN_IF_ERROR(ThreadPoolBuilder("S3FileUploadThreadPool")
+                            .set_min_threads(cast_set<int>(s3_file_upload_min_threads))
+                            .set_max_threads(cast_set<int>(s3_file_upload_max_threads))
+                            .build(&_s3_file_upload_thread_pool));
+    _file_cache_open_fd_cache = std::make_unique<io::FDCache>();
+    _file_cache_factory = new io::FileCacheFactory();
+    std::vector<doris::CachePath> cache_paths;
+    init_file_cache_factory(cache_paths);
+    return Status::OK();
+}
+
 Status ExecEnv::_init_mem_env() {
     bool is_percent = false;
     std::stringstream ss;
@@ -491,11 +517,26 @@ Status ExecEnv::_init_mem_env() {
     while (!is_percent && pk_storage_page_cache_limit > MemInfo::mem_limit() / 2) {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
+    int64_t compressed_page_cache_limit =
+            ParseUtil::parse_mem_spec(config::compressed_page_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
+    while (!is_percent && compressed_page_cache_limit > MemInfo::mem_limit() / 2) {
+        compressed_page_cache_limit = compressed_page_cache_limit / 2;
+    }
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            compressed_page_cache_limit);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
+    if (config::enable_segment_footer_store) {
+        std::vector<std::string> dirs;
+        for (const auto& store_path : _store_paths) {
+            dirs.push_back(store_path.path);
+        }
+        _segment_footer_store = new segment_v2::SegmentFooterStore(
+                dirs, config::segment_footer_store_max_file_size);
+    }
 
     // Init row cache
     int64_t row_cache_mem_limit =
@@ -545,7 +586,8 @@ Status ExecEnv::_init_mem_env() {
               << config::file_cache_max_file_reader_cache_size;
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num,
+                                         config::external_file_meta_index_cache_size);
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -752,6 +794,8 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
+    SAFE_SHUTDOWN(_s3_hedged_read_thread_pool);
+    SAFE_SHUTDOWN(_page_decompress_prefetch_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
@@ -775,6 +819,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_scanner_scheduler);
     // _storage_page_cache must be destoried before _cache_manager
     SAFE_DELETE(_storage_page_cache);
+    SAFE_DELETE(_segment_footer_store);
 
     SAFE_DELETE(_small_file_mgr);
     SAFE_DELETE(_broker_mgr);
@@ -804,6 +849,8 @@ void ExecEnv::destroy() {
     _lazy_release_obj_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _s3_file_system_thread_pool.reset(nullptr);
+    _s3_hedged_read_thread_pool.reset(nullptr);
+    _page_decompress_prefetch_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
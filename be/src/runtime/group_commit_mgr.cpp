@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -32,10 +33,18 @@
 #include "runtime/fragment_mgr.h"
 #include "util/debug_points.h"
 #include "util/thrift_rpc_helper.h"
+#include "util/time.h"
 
 namespace doris {
 
 bvar::Adder<uint64_t> group_commit_block_by_memory_counter("group_commit_block_by_memory_counter");
+// from the creation of a group commit load to the end of its commit
+bvar::LatencyRecorder group_commit_visible_latency_ms("group_commit_visible_latency_ms");
+// from when a group commit load needs to commit to the end of its commit
+bvar::LatencyRecorder group_commit_commit_latency_ms("group_commit_commit_latency_ms");
+
+// the number of the recent commits to get the p99 commit latency of a table
+static constexpr size_t COMMIT_LATENCY_WINDOW_SIZE = 100;
 
 std::string LoadBlockQueue::_get_load_ids() {
     std::stringstream ss;
@@ -61,6 +70,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
     LOG(INFO) << "query_id: " << print_id(runtime_state->query_id())
               << ", add block rows=" << block->rows() << ", use group_commit label=" << label;
     DBUG_EXECUTE_IF("LoadBlockQueue.add_block.block", DBUG_BLOCK);
+    bool need_sync_wal = false;
     if (block->rows() > 0) {
         if (!config::group_commit_wait_replay_wal_finish) {
             _block_queue.emplace_back(block);
@@ -80,6 +90,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                 _cancel_without_lock(st);
                 return st;
             }
+            need_sync_wal = config::group_commit_wal_sync_on_append;
         }
         if (!runtime_state->is_cancelled() && status.ok() &&
             _all_block_queues_bytes->load(std::memory_order_relaxed) >=
@@ -96,7 +107,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
         if (_data_bytes >= _group_commit_data_bytes) {
             VLOG_DEBUG << "group commit meets commit condition for data size, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
             data_size_condition = true;
         }
         if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
@@ -104,13 +115,19 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                     .count() >= _group_commit_interval_ms) {
             VLOG_DEBUG << "group commit meets commit condition for time interval, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
         }
     }
     for (auto read_dep : _read_deps) {
         read_dep->set_ready();
         VLOG_DEBUG << "set ready for inner load_id=" << load_instance_id;
     }
+    if (need_sync_wal) {
+        // the wal is synced out of the lock, so the other loads go on appending and share the sync
+        auto wal_writer = _v_wal_writer;
+        l.unlock();
+        return wal_writer->sync_wal();
+    }
     return Status::OK();
 }
 
@@ -129,7 +146,7 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
                             std::chrono::steady_clock::now() - _start_time)
                             .count();
     if (!_need_commit && duration >= _group_commit_interval_ms) {
-        _need_commit = true;
+        _set_need_commit();
     }
     if (_block_queue.empty()) {
         if (_need_commit && duration >= 10 * _group_commit_interval_ms) {
@@ -210,6 +227,29 @@ Status LoadBlockQueue::add_load_id(const UniqueId& load_id,
     return Status::OK();
 }
 
+void LoadBlockQueue::_set_need_commit() {
+    if (!_need_commit) {
+        _need_commit = true;
+        _need_commit_time = std::chrono::steady_clock::now();
+    }
+}
+
+int64_t LoadBlockQueue::duration_ms() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                 _start_time)
+            .count();
+}
+
+int64_t LoadBlockQueue::commit_duration_ms() {
+    std::unique_lock l(mutex);
+    if (!_need_commit) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                 _need_commit_time)
+            .count();
+}
+
 void LoadBlockQueue::cancel(const Status& st) {
     DCHECK(!st.ok());
     std::unique_lock l(mutex);
@@ -257,14 +297,12 @@ Status GroupCommitTable::get_first_block_load_queue(
                 return Status::OK();
             }
         }
+        std::vector<std::shared_ptr<LoadBlockQueue>> shards;
         for (const auto& [_, inner_block_queue] : _load_block_queues) {
             if (!inner_block_queue->need_commit()) {
                 if (base_schema_version == inner_block_queue->schema_version &&
                     index_size == inner_block_queue->index_size) {
-                    if (inner_block_queue->add_load_id(load_id, put_block_dep).ok()) {
-                        load_block_queue = inner_block_queue;
-                        return Status::OK();
-                    }
+                    shards.push_back(inner_block_queue);
                 } else {
                     return Status::DataQualityError<false>(
                             "schema version not match, maybe a schema change is in process. "
@@ -272,6 +310,20 @@ Status GroupCommitTable::get_first_block_load_queue(
                 }
             }
         }
+        // the loads are spread over the shards, so they don't wait for the lock of one queue
+        size_t start = shards.empty() ? 0 : load_id.hash() % shards.size();
+        for (size_t i = 0; i < shards.size(); ++i) {
+            auto& inner_block_queue = shards[(start + i) % shards.size()];
+            if (inner_block_queue->add_load_id(load_id, put_block_dep).ok()) {
+                load_block_queue = inner_block_queue;
+                int32_t shard_num = calc_shard_num(_ingest_bytes_per_second);
+                if (static_cast<int32_t>(shards.size()) < shard_num) {
+                    // the ingest rate needs one more shard
+                    RETURN_IF_ERROR(_start_create_group_commit_load(be_exe_version, mem_tracker));
+                }
+                return Status::OK();
+            }
+        }
         return Status::InternalError<false>("can not get a block queue for table_id: " +
                                             std::to_string(_table_id) + _create_plan_failed_reason);
     };
@@ -282,31 +334,84 @@ Status GroupCommitTable::get_first_block_load_queue(
     create_plan_dep->block();
     _create_plan_deps.emplace(load_id, std::make_tuple(create_plan_dep, put_block_dep,
                                                        base_schema_version, index_size));
-    if (!_is_creating_plan_fragment) {
-        _is_creating_plan_fragment = true;
-        RETURN_IF_ERROR(
-                _thread_pool->submit_func([&, be_exe_version, mem_tracker, dep = create_plan_dep] {
-                    Defer defer {[&, dep = dep]() {
-                        std::unique_lock l(_lock);
-                        for (auto it : _create_plan_deps) {
-                            std::get<0>(it.second)->set_ready();
-                        }
-                        _create_plan_deps.clear();
-                        _is_creating_plan_fragment = false;
-                    }};
-                    auto st = _create_group_commit_load(be_exe_version, mem_tracker);
-                    if (!st.ok()) {
-                        LOG(WARNING) << "create group commit load error: " << st.to_string();
-                        _create_plan_failed_reason = ". create group commit load error: " +
-                                                     st.to_string().substr(0, 300);
-                    } else {
-                        _create_plan_failed_reason = "";
-                    }
-                }));
-    }
+    RETURN_IF_ERROR(_start_create_group_commit_load(be_exe_version, mem_tracker));
     return try_to_get_matched_queue();
 }
 
+Status GroupCommitTable::_start_create_group_commit_load(
+        int be_exe_version, std::shared_ptr<MemTrackerLimiter> mem_tracker) {
+    if (_is_creating_plan_fragment) {
+        return Status::OK();
+    }
+    _is_creating_plan_fragment = true;
+    return _thread_pool->submit_func([&, be_exe_version, mem_tracker] {
+        Defer defer {[&]() {
+            std::unique_lock l(_lock);
+            for (auto it : _create_plan_deps) {
+                std::get<0>(it.second)->set_ready();
+            }
+            _create_plan_deps.clear();
+            _is_creating_plan_fragment = false;
+        }};
+        auto st = _create_group_commit_load(be_exe_version, mem_tracker);
+        if (!st.ok()) {
+            LOG(WARNING) << "create group commit load error: " << st.to_string();
+            _create_plan_failed_reason =
+                    ". create group commit load error: " + st.to_string().substr(0, 300);
+        } else {
+            _create_plan_failed_reason = "";
+        }
+    });
+}
+
+int64_t GroupCommitTable::calc_commit_interval_ms(int64_t table_interval_ms,
+                                                  int64_t commit_latency_ms) {
+    if (!config::enable_adaptive_group_commit_interval) {
+        return table_interval_ms;
+    }
+    // a row waits for the interval at most, then for the commit
+    int64_t interval_ms = std::max<int64_t>(
+            config::group_commit_target_visible_latency_ms - commit_latency_ms,
+            config::group_commit_min_interval_ms);
+    return std::min(table_interval_ms, interval_ms);
+}
+
+int32_t GroupCommitTable::calc_shard_num(int64_t ingest_bytes_per_second) {
+    int32_t max_shards = std::max(config::group_commit_max_shards, 1);
+    if (max_shards == 1 || config::group_commit_shard_bytes_per_second <= 0) {
+        return 1;
+    }
+    int64_t shards = ingest_bytes_per_second / config::group_commit_shard_bytes_per_second + 1;
+    return static_cast<int32_t>(std::min<int64_t>(shards, max_shards));
+}
+
+void GroupCommitTable::_update_load_stats(int64_t data_bytes, int64_t commit_latency_ms) {
+    _commit_latencies_ms.push_back(commit_latency_ms);
+    if (_commit_latencies_ms.size() > COMMIT_LATENCY_WINDOW_SIZE) {
+        _commit_latencies_ms.pop_front();
+    }
+    int64_t now_ms = MonotonicMillis();
+    if (_ingest_window_start_ms == 0) {
+        _ingest_window_start_ms = now_ms;
+    }
+    _ingest_window_bytes += data_bytes;
+    if (int64_t window_ms = now_ms - _ingest_window_start_ms; window_ms >= 1000) {
+        _ingest_bytes_per_second = _ingest_window_bytes * 1000 / window_ms;
+        _ingest_window_start_ms = now_ms;
+        _ingest_window_bytes = 0;
+    }
+}
+
+int64_t GroupCommitTable::_commit_latency_p99_ms() {
+    if (_commit_latencies_ms.empty()) {
+        return 0;
+    }
+    std::vector<int64_t> latencies(_commit_latencies_ms.begin(), _commit_latencies_ms.end());
+    auto p99 = latencies.begin() + latencies.size() * 99 / 100;
+    std::nth_element(latencies.begin(), p99, latencies.end());
+    return *p99;
+}
+
 void GroupCommitTable::remove_load_id(const UniqueId& load_id) {
     std::unique_lock l(_lock);
     if (_create_plan_deps.find(load_id) != _create_plan_deps.end()) {
@@ -385,9 +490,14 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", label=" << label << ", txn_id=" << txn_id
                    << ", instance_id=" << print_id(instance_id);
         {
+            int64_t interval_ms = result.group_commit_interval_ms;
+            {
+                std::unique_lock l(_lock);
+                interval_ms = calc_commit_interval_ms(interval_ms, _commit_latency_p99_ms());
+            }
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
+                    result.wait_internal_group_commit_finish, interval_ms,
                     result.group_commit_data_bytes);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
@@ -514,6 +624,11 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             load_block_queue = it->second;
             if (!status.ok()) {
                 load_block_queue->cancel(status);
+            } else {
+                int64_t commit_latency_ms = load_block_queue->commit_duration_ms();
+                group_commit_commit_latency_ms << commit_latency_ms;
+                group_commit_visible_latency_ms << load_block_queue->duration_ms();
+                _update_load_stats(load_block_queue->data_bytes(), commit_latency_ms);
             }
             //close wal
             RETURN_IF_ERROR(load_block_queue->close_wal());
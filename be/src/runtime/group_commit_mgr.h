@@ -22,6 +22,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -90,6 +91,14 @@ public:
     void append_dependency(std::shared_ptr<pipeline::Dependency> finish_dep);
     void append_read_dependency(std::shared_ptr<pipeline::Dependency> read_dep);
     int64_t get_group_commit_interval_ms() { return _group_commit_interval_ms; };
+    int64_t data_bytes() {
+        std::unique_lock l(mutex);
+        return _data_bytes;
+    }
+    // the time from the creation of the queue
+    int64_t duration_ms() const;
+    // the time from when the queue needs to commit, 0 if it doesn't need to commit yet
+    int64_t commit_duration_ms();
 
     std::string debug_string() const {
         fmt::memory_buffer debug_string_buffer;
@@ -124,6 +133,7 @@ public:
 private:
     void _cancel_without_lock(const Status& st);
     std::string _get_load_ids();
+    void _set_need_commit();
 
     // the set of load ids of all blocks in this queue
     std::map<UniqueId, std::shared_ptr<pipeline::Dependency>> _load_ids_to_write_dep;
@@ -136,6 +146,7 @@ private:
 
     // commit
     bool _need_commit = false;
+    std::chrono::steady_clock::time_point _need_commit_time;
     // commit by time interval, can be changed by 'ALTER TABLE my_table SET ("group_commit_interval_ms"="1000");'
     int64_t _group_commit_interval_ms;
     std::chrono::steady_clock::time_point _start_time;
@@ -170,9 +181,21 @@ public:
                                 std::shared_ptr<pipeline::Dependency> get_block_dep);
     void remove_load_id(const UniqueId& load_id);
 
+    // The commit interval of a new group commit load, by the interval set for the table and the
+    // p99 latency of the recent commits.
+    static int64_t calc_commit_interval_ms(int64_t table_interval_ms, int64_t commit_latency_ms);
+    // The number of group commit loads accepting loads at the same time for the ingest rate.
+    static int32_t calc_shard_num(int64_t ingest_bytes_per_second);
+
 private:
+    // Create a group commit load in the thread pool if none is being created, `_lock` is held.
+    Status _start_create_group_commit_load(int be_exe_version,
+                                           std::shared_ptr<MemTrackerLimiter> mem_tracker);
     Status _create_group_commit_load(int be_exe_version,
                                      std::shared_ptr<MemTrackerLimiter> mem_tracker);
+    // Record a finished group commit load, `_lock` is held.
+    void _update_load_stats(int64_t data_bytes, int64_t commit_latency_ms);
+    int64_t _commit_latency_p99_ms();
     Status _exec_plan_fragment(int64_t db_id, int64_t table_id, const std::string& label,
                                int64_t txn_id, const TPipelineFragmentParams& pipeline_params);
     Status _finish_group_commit_load(int64_t db_id, int64_t table_id, const std::string& label,
@@ -197,6 +220,13 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+
+    // the commit latencies of the recent group commit loads
+    std::deque<int64_t> _commit_latencies_ms;
+    // the ingest rate is measured by the bytes of the loads finished in about a second
+    int64_t _ingest_window_start_ms = 0;
+    int64_t _ingest_window_bytes = 0;
+    int64_t _ingest_bytes_per_second = 0;
 };
 
 class GroupCommitMgr {
@@ -56,6 +56,8 @@ public:
         QUERY_CACHE = 20,
         TABLET_COLUMN_OBJECT_POOL = 21,
         SCHEMA_CLOUD_DICTIONARY_CACHE = 22,
+        COMPRESSED_PAGE_CACHE = 23,
+        FILE_META_INDEX_CACHE = 24,
     };
 
     static std::string type_string(CacheType type) {
@@ -104,6 +106,10 @@ public:
             return "TabletColumnObjectPool";
         case CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE:
             return "SchemaCloudDictionaryCache";
+        case CacheType::COMPRESSED_PAGE_CACHE:
+            return "CompressedPageCache";
+        case CacheType::FILE_META_INDEX_CACHE:
+            return "FileMetaIndexCache";
         default:
             throw Exception(Status::FatalError("not match type of cache policy :{}",
                                                static_cast<int>(type)));
@@ -134,6 +140,8 @@ public:
             {"QueryCache", CacheType::QUERY_CACHE},
             {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL},
             {"SchemaCloudDictionaryCache", CacheType::SCHEMA_CLOUD_DICTIONARY_CACHE},
+            {"CompressedPageCache", CacheType::COMPRESSED_PAGE_CACHE},
+            {"FileMetaIndexCache", CacheType::FILE_META_INDEX_CACHE},
     };
 
     static CacheType string_to_type(std::string type) {
@@ -153,6 +161,8 @@ public:
     virtual void prune_stale() = 0;
     virtual void prune_all(bool force) = 0;
     virtual int64_t adjust_capacity_weighted(double adjust_weighted) = 0;
+    // The weight to adjust this cache by, when all the caches are adjusted by `adjust_weighted`.
+    virtual double hit_ratio_adjust_weighted(double adjust_weighted) { return adjust_weighted; }
     virtual size_t get_capacity() = 0;
 
     CacheType type() { return _type; }
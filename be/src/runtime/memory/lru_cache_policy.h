@@ -19,8 +19,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
+#include "common/config.h"
 #include "olap/lru_cache.h"
 #include "runtime/memory/cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
@@ -147,6 +150,12 @@ public:
 
     uint64_t new_id() { return _cache->new_id(); };
 
+    void set_protected_percentage(uint32_t protected_percentage) {
+        _cache->set_protected_percentage(protected_percentage);
+    }
+
+    void set_clock_lookup(bool clock_lookup) { _cache->set_clock_lookup(clock_lookup); }
+
     // Subclass can override this method to determine whether to do the minor or full gc
     virtual bool exceed_prune_limit() {
         return _lru_cache_type == LRUCacheType::SIZE ? mem_consumption() > CACHE_MIN_PRUNE_SIZE
@@ -291,6 +300,27 @@ public:
         return prune_num;
     };
 
+    // Under memory pressure, a cache that is hit less since the last adjustment would lose less by
+    // giving memory back, so it is shrunk more than `adjust_weighted`, and a cache that is hit
+    // more is shrunk less: the hit ratio of 0.5 keeps `adjust_weighted`, 0 squares it, 1 keeps
+    // the initial capacity.
+    double hit_ratio_adjust_weighted(double adjust_weighted) override {
+        std::lock_guard<std::mutex> l(_lock);
+        uint64_t lookup_count = _cache->get_lookup_count();
+        uint64_t hit_count = _cache->get_hit_count();
+        uint64_t lookups = lookup_count - _last_lookup_count;
+        uint64_t hits = hit_count - _last_hit_count;
+        _last_lookup_count = lookup_count;
+        _last_hit_count = hit_count;
+        if (!config::enable_cache_capacity_adjust_by_hit_ratio || adjust_weighted <= 0 ||
+            adjust_weighted >= 1 || lookups < CACHE_MIN_ADJUST_LOOKUP_NUMBER) {
+            return adjust_weighted;
+        }
+        double hit_ratio =
+                std::min(1.0, static_cast<double>(hits) / static_cast<double>(lookups));
+        return std::pow(adjust_weighted, 2 * (1 - hit_ratio));
+    }
+
 protected:
     void _init_mem_tracker(const std::string& type_name) {
         if (std::find(CachePolicy::MetadataCache.begin(), CachePolicy::MetadataCache.end(),
@@ -313,6 +343,11 @@ protected:
     std::mutex _lock;
     LRUCacheType _lru_cache_type;
 
+    // the hit ratio of too few lookups is not trusted
+    static constexpr uint64_t CACHE_MIN_ADJUST_LOOKUP_NUMBER = 1000;
+    uint64_t _last_lookup_count = 0;
+    uint64_t _last_hit_count = 0;
+
     std::shared_ptr<MemTrackerLimiter> _mem_tracker;
     std::shared_ptr<MemTracker> _value_mem_tracker;
 };
@@ -17,8 +17,11 @@
 // This file is copied from
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <string>
 
 #include "common/compiler_util.h"
@@ -88,5 +91,96 @@ private:
     std::atomic<int64_t> _peak_value {0};
 };
 
+/*
+ * A MemCounter whose updates are spread over shards, each on its own cache line, so the threads
+ * of a tracker that consume concurrently don't bounce a shared counter between the cores.
+ * A shard is folded into the shared counter once its value reaches `fold_bytes`, so
+ * approximate_value() may lag the exact value by up to SHARD_NUM * fold_bytes, while
+ * current_value() sums the shards and is exact. The peak only sees the folded values.
+ *
+ * With fold_bytes == 0, the counter is precise and behaves like MemCounter.
+ *
+ * This class is thread-safe.
+*/
+class ShardedMemCounter {
+public:
+    static constexpr size_t SHARD_NUM = 16;
+
+    ShardedMemCounter() = default;
+
+    // Shards that are not empty are folded when switching to the precise mode, an update that
+    // races with the switch may still be left in a shard, which is counted by current_value().
+    void set_fold_bytes(int64_t fold_bytes) {
+        _fold_bytes.store(fold_bytes, std::memory_order_relaxed);
+        if (fold_bytes == 0) {
+            for (auto& shard : _shards) {
+                _counter.add(shard.value.exchange(0, std::memory_order_relaxed));
+            }
+        }
+    }
+    int64_t fold_bytes() const { return _fold_bytes.load(std::memory_order_relaxed); }
+
+    void add(int64_t delta) {
+        int64_t fold_bytes = _fold_bytes.load(std::memory_order_relaxed);
+        if (fold_bytes == 0) {
+            _counter.add(delta);
+            return;
+        }
+        auto& shard = _shards[_shard_index()];
+        int64_t value = shard.value.fetch_add(delta, std::memory_order_relaxed) + delta;
+        if (UNLIKELY(std::abs(value) >= fold_bytes)) {
+            _counter.add(shard.value.exchange(0, std::memory_order_relaxed));
+        }
+    }
+
+    void add_no_update_peak(int64_t delta) { add(delta); }
+
+    // The limit is checked against the folded value, it's exact in the precise mode.
+    bool try_add(int64_t delta, int64_t max) {
+        if (_fold_bytes.load(std::memory_order_relaxed) == 0) {
+            return _counter.try_add(delta, max);
+        }
+        if (UNLIKELY(approximate_value() + delta > max)) {
+            return false;
+        }
+        add(delta);
+        return true;
+    }
+
+    void sub(int64_t delta) { add(-delta); }
+
+    void set(int64_t v) {
+        for (auto& shard : _shards) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+        _counter.set(v);
+    }
+
+    int64_t current_value() const {
+        int64_t value = _counter.current_value();
+        for (const auto& shard : _shards) {
+            value += shard.value.load(std::memory_order_relaxed);
+        }
+        return value;
+    }
+    int64_t approximate_value() const { return _counter.current_value(); }
+    int64_t peak_value() const { return std::max(_counter.peak_value(), current_value()); }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<int64_t> value {0};
+    };
+
+    static size_t _shard_index() {
+        static std::atomic<size_t> next_index {0};
+        thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed) % SHARD_NUM;
+        return index;
+    }
+
+    std::atomic<int64_t> _fold_bytes {0};
+    MemCounter _counter;
+    std::array<Shard, SHARD_NUM> _shards;
+};
+
 #include "common/compile_check_end.h"
 } // namespace doris
@@ -47,6 +47,7 @@ MemTrackerLimiter::MemTrackerLimiter(Type type, const std::string& label, int64_
     _type = type;
     _label = label;
     _limit = byte_limit;
+    _update_counter_mode();
     _uid = UniqueId::gen_uid();
     if (_type == Type::GLOBAL) {
         _group_num = 0;
@@ -124,6 +125,16 @@ MemTrackerLimiter::~MemTrackerLimiter() {
     memory_memtrackerlimiter_cnt << -1;
 }
 
+void MemTrackerLimiter::_update_counter_mode() {
+    int64_t fold_bytes = config::mem_tracker_sharded_counter_fold_bytes;
+    // keep the lag under 1% of the limit
+    if (fold_bytes < 0 ||
+        (_limit >= 0 && _limit / 100 < fold_bytes * int64_t(ShardedMemCounter::SHARD_NUM))) {
+        fold_bytes = 0;
+    }
+    _mem_counter.set_fold_bytes(fold_bytes);
+}
+
 void MemTrackerLimiter::add_address_sanitizers(void* buf, size_t size) {
     if (open_memory_tracker_inaccurate_detect()) {
         std::lock_guard<std::mutex> l(_address_sanitizers_mtx);
@@ -210,6 +221,12 @@ RuntimeProfile* MemTrackerLimiter::make_profile(RuntimeProfile* profile) const {
         COUNTER_SET(reserved_counter, reserved_peak_consumption());
         COUNTER_SET(reserved_counter, reserved_consumption());
     }
+    if (huge_page_peak_consumption() != 0) {
+        RuntimeProfile::HighWaterMarkCounter* huge_page_counter =
+                profile_snapshot->AddHighWaterMarkCounter("HugePageMemory", TUnit::BYTES);
+        COUNTER_SET(huge_page_counter, huge_page_peak_consumption());
+        COUNTER_SET(huge_page_counter, huge_page_consumption());
+    }
     return profile_snapshot;
 }
 
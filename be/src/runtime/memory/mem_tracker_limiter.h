@@ -125,7 +125,10 @@ public:
     const std::string& label() const { return _label; }
     int64_t group_num() const { return _group_num; }
     int64_t limit() const { return _limit; }
-    void set_limit(int64_t new_mem_limit) { _limit = new_mem_limit; }
+    void set_limit(int64_t new_mem_limit) {
+        _limit = new_mem_limit;
+        _update_counter_mode();
+    }
     bool enable_check_limit() const { return _enable_check_limit; }
     void set_enable_check_limit(bool enable_check_limit) {
         _enable_check_limit = enable_check_limit;
@@ -210,6 +213,13 @@ public:
         DCHECK(reserved_consumption() >= 0);
     }
 
+    // The bytes of the allocations advised to be backed by transparent huge pages, they are
+    // also counted in the consumption.
+    int64_t huge_page_consumption() const { return _huge_page_counter.current_value(); }
+    int64_t huge_page_peak_consumption() const { return _huge_page_counter.peak_value(); }
+    void consume_huge_page(int64_t bytes) { _huge_page_counter.add(bytes); }
+    void release_huge_page(int64_t bytes) { _huge_page_counter.sub(bytes); }
+
     /*
     * Part 5, Memory profile and log method
     */
@@ -241,6 +251,10 @@ private:
     // Thread safety.
     int64_t add_untracked_mem(int64_t bytes);
 
+    // Shard the consumption counter unless the limit is small enough that the lag of the
+    // sharded counter matters, then the counter is precise.
+    void _update_counter_mode();
+
     /*
     * Part 8, Property definition
     */
@@ -252,8 +266,9 @@ private:
     // For generate runtime profile, profile name must be unique.
     UniqueId _uid;
 
-    MemCounter _mem_counter;
+    ShardedMemCounter _mem_counter;
     MemCounter _reserved_counter;
+    MemCounter _huge_page_counter;
 
     // Limit on memory consumption, in bytes.
     std::atomic<int64_t> _limit;
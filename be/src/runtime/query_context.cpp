@@ -108,6 +108,12 @@ QueryContext::QueryContext(TUniqueId query_id, ExecEnv* exec_env,
 
     _runtime_filter_mgr = std::make_unique<RuntimeFilterMgr>(true);
 
+    if (config::spill_write_bytes_per_second_per_query > 0) {
+        _spill_write_limiter =
+                std::make_unique<TokenBucket>(config::spill_write_bytes_per_second_per_query,
+                                              config::spill_write_bytes_per_second_per_query);
+    }
+
     _timeout_second = query_options.execution_timeout;
 
     bool is_query_type_valid = query_options.query_type == TQueryType::SELECT ||
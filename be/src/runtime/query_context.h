@@ -39,6 +39,7 @@
 #include "runtime_filter/runtime_filter_mgr.h"
 #include "util/hash_util.hpp"
 #include "util/threadpool.h"
+#include "util/token_bucket.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 #include "workload_group/workload_group.h"
 
@@ -177,6 +178,9 @@ public:
     }
     const TQueryOptions& query_options() const { return _query_options; }
 
+    // limits the bandwidth of the spill writes of the query, nullptr if not limited
+    TokenBucket* spill_write_limiter() { return _spill_write_limiter.get(); }
+
     // global runtime filter mgr, the runtime filter have remote target or
     // need local merge should regist here. before publish() or push_to_remote()
     // the runtime filter should do the local merge work
@@ -285,6 +289,7 @@ private:
     std::unordered_map<int, vectorized::RuntimePredicate> _runtime_predicates;
 
     std::unique_ptr<RuntimeFilterMgr> _runtime_filter_mgr;
+    std::unique_ptr<TokenBucket> _spill_write_limiter;
     const TQueryOptions _query_options;
 
     // All pipeline tasks use the same query context to report status. So we need a `_exec_status`
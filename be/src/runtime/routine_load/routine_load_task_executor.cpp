@@ -40,6 +40,7 @@
 #include "common/utils.h"
 #include "io/fs/kafka_consumer_pipe.h"
 #include "io/fs/multi_table_pipe.h"
+#include "io/fs/stream_load_chunk_reader.h"
 #include "io/fs/stream_load_pipe.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/memory_profile.h"
@@ -408,6 +409,14 @@ void RoutineLoadTaskExecutor::exec_task(std::shared_ptr<StreamLoadContext> ctx,
     }
     ctx->body_sink = pipe;
     ctx->pipe = pipe;
+    if (!ctx->is_multi_table && ctx->format == TFileFormatType::FORMAT_CSV_PLAIN &&
+        config::routine_load_parallel_parse_num > 1) {
+        // every message is appended with a line delimiter, so the chunks of lines of the pipe can
+        // be parsed by several scanners, like a stream load with `parallel_parse: true`
+        ctx->pipe_splitter = std::make_shared<io::StreamLoadPipeSplitter>(
+                ctx->pipe, '\n', config::stream_load_parallel_parse_chunk_size);
+        ctx->parallel_parse_num = config::routine_load_parallel_parse_num;
+    }
 
     // must put pipe before executing plan fragment
     HANDLE_ERROR(_exec_env->new_load_stream_mgr()->put(ctx->id, ctx), "failed to add pipe");
@@ -49,6 +49,7 @@
 #include "runtime/workload_group/workload_group.h"
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace doris {
 class RuntimeFilter;
@@ -476,6 +477,16 @@ public:
 
     [[nodiscard]] bool low_memory_mode() const;
 
+    // Cooperative yield of the running pipeline task. The task sets the deadline of its
+    // time slice before executing operators, and long running operators call `should_yield`
+    // at their loop boundaries (e.g. every few batches). If it returns true, the operator
+    // should save its loop state in its local state and return the partial result, so the
+    // task can go back to the task queue and resume it in the next schedule.
+    void set_task_yield_deadline_ns(int64_t deadline_ns) { _task_yield_deadline_ns = deadline_ns; }
+    bool should_yield() const {
+        return _task_yield_deadline_ns > 0 && MonotonicNanos() > _task_yield_deadline_ns;
+    }
+
     std::weak_ptr<QueryContext> get_query_ctx_weak();
     MOCK_FUNCTION WorkloadGroupPtr workload_group();
 
@@ -680,6 +691,10 @@ private:
     // Hold execution context for other threads
     std::weak_ptr<TaskExecutionContext> _task_execution_context;
 
+    // Deadline (MonotonicNanos) of the time slice of the pipeline task which is using this
+    // runtime state, 0 means no deadline. See `should_yield`.
+    int64_t _task_yield_deadline_ns = 0;
+
     // put runtime state before _obj_pool, so that it will be deconstructed after
     // _obj_pool. Because some of object in _obj_pool will use profile when deconstructing.
     RuntimeProfile _profile;
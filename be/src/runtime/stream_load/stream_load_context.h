@@ -45,6 +45,7 @@
 namespace doris {
 namespace io {
 class StreamLoadPipe;
+class StreamLoadPipeSplitter;
 } // namespace io
 
 // kafka related info
@@ -196,6 +197,9 @@ public:
 
     std::shared_ptr<MessageBodySink> body_sink;
     std::shared_ptr<io::StreamLoadPipe> pipe;
+    // set if the body is cut into chunks of lines to be parsed by several scanners concurrently
+    std::shared_ptr<io::StreamLoadPipeSplitter> pipe_splitter;
+    int parallel_parse_num = 1;
 
     TStreamLoadPutResult put_result;
     TStreamLoadMultiTablePutResult multi_table_put_result;
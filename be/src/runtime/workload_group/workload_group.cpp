@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 #include <gen_cpp/PaloInternalService_types.h>
 
+#include <algorithm>
 #include <charconv>
 #include <map>
 #include <mutex>
@@ -513,6 +514,12 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     std::string wg_name = wg_info->name;
     int pipeline_exec_thread_num = wg_info->pipeline_exec_thread_num;
     int scan_thread_num = wg_info->scan_thread_num;
+    // an idle group only keeps a few scan threads, and the cpu of the threads it does not use
+    // is left to the busy groups within their cgroup cpu shares.
+    int min_scan_thread_num =
+            config::enable_workload_group_elastic_scan_thread_pool
+                    ? std::min(scan_thread_num, config::doris_scanner_min_thread_pool_thread_num)
+                    : scan_thread_num;
     int max_remote_scan_thread_num = wg_info->max_remote_scan_thread_num;
     int min_remote_scan_thread_num = wg_info->min_remote_scan_thread_num;
     int max_flush_thread_num = wg_info->max_flush_thread_num;
@@ -536,7 +543,7 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
         std::unique_ptr<vectorized::SimplifiedScanScheduler> scan_scheduler =
                 std::make_unique<vectorized::SimplifiedScanScheduler>("ls_" + wg_name,
                                                                       cg_cpu_ctl_ptr, wg_name);
-        Status ret = scan_scheduler->start(scan_thread_num, scan_thread_num,
+        Status ret = scan_scheduler->start(scan_thread_num, min_scan_thread_num,
                                            config::doris_scanner_thread_pool_queue_size);
         if (ret.ok()) {
             _scan_task_sched = std::move(scan_scheduler);
@@ -585,7 +592,7 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
 
     // 2 update thread pool
     if (scan_thread_num > 0 && _scan_task_sched) {
-        _scan_task_sched->reset_thread_num(scan_thread_num, scan_thread_num);
+        _scan_task_sched->reset_thread_num(scan_thread_num, min_scan_thread_num);
     }
 
     if (max_remote_scan_thread_num >= min_remote_scan_thread_num && _remote_scan_task_sched) {
@@ -685,6 +692,10 @@ void WorkloadGroup::update_remote_scan_io(size_t scan_bytes) {
     _wg_metrics->update_remote_scan_io_bytes((uint64_t)scan_bytes);
 }
 
+void WorkloadGroup::update_file_cache_io(size_t hit_bytes, size_t miss_bytes) {
+    _wg_metrics->update_file_cache_io_bytes((uint64_t)hit_bytes, (uint64_t)miss_bytes);
+}
+
 int64_t WorkloadGroup::get_mem_used() {
     return _total_mem_used;
 }
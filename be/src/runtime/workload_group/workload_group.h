@@ -208,6 +208,9 @@ public:
 
     void update_remote_scan_io(size_t scan_bytes);
 
+    // The bytes read from the file cache and from the remote storage by the scans.
+    void update_file_cache_io(size_t hit_bytes, size_t miss_bytes);
+
     int64_t get_mem_used();
 
     virtual ThreadPool* get_memtable_flush_pool() {
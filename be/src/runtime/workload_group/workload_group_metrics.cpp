@@ -32,6 +32,9 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_remote_scan_bytes, doris::Me
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_total_local_scan_bytes,
                                      doris::MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_local_scan_bytes, doris::MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_file_cache_hit_bytes, doris::MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_file_cache_miss_bytes,
+                                     doris::MetricUnit::BYTES);
 
 #include "common/compile_check_begin.h"
 
@@ -48,6 +51,8 @@ WorkloadGroupMetrics::WorkloadGroupMetrics(WorkloadGroup* wg) {
     INT_GAUGE_METRIC_REGISTER(_entity, workload_group_mem_used_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_remote_scan_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_total_local_scan_bytes);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_file_cache_hit_bytes);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_file_cache_miss_bytes);
 
     std::vector<DataDirInfo>& data_dir_list = io::BeConfDataDirReader::be_config_data_dir_list;
     for (const auto& data_dir : data_dir_list) {
@@ -84,6 +89,12 @@ void WorkloadGroupMetrics::update_remote_scan_io_bytes(uint64_t delta_io_bytes)
     workload_group_remote_scan_bytes->increment(delta_io_bytes);
 }
 
+void WorkloadGroupMetrics::update_file_cache_io_bytes(uint64_t delta_hit_bytes,
+                                                      uint64_t delta_miss_bytes) {
+    workload_group_file_cache_hit_bytes->increment((int64_t)delta_hit_bytes);
+    workload_group_file_cache_miss_bytes->increment((int64_t)delta_miss_bytes);
+}
+
 void WorkloadGroupMetrics::refresh_metrics() {
     int interval_second = config::workload_group_metrics_interval_ms / 1000;
 
@@ -53,6 +53,8 @@ public:
 
     void update_remote_scan_io_bytes(uint64_t delta_io_bytes);
 
+    void update_file_cache_io_bytes(uint64_t delta_hit_bytes, uint64_t delta_miss_bytes);
+
     void refresh_metrics();
 
     uint64_t get_cpu_time_nanos_per_second();
@@ -68,6 +70,8 @@ private:
     IntGuage* workload_group_mem_used_bytes {nullptr};           // used for metric
     IntCounter* workload_group_remote_scan_bytes {nullptr};      // used for metric
     IntCounter* workload_group_total_local_scan_bytes {nullptr}; // used for metric
+    IntCounter* workload_group_file_cache_hit_bytes {nullptr};   // used for metric
+    IntCounter* workload_group_file_cache_miss_bytes {nullptr};  // used for metric
     std::unordered_multimap<std::string, IntCounter*>
             _local_scan_bytes_counter_map; // used for metric
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "common/factory_creator.h"
+#include "io/io_common.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/runtime_profile.h"
 
@@ -40,6 +41,12 @@ public:
         RuntimeProfile::Counter* scan_bytes_counter_;
         RuntimeProfile::Counter* scan_bytes_from_local_storage_counter_;
         RuntimeProfile::Counter* scan_bytes_from_remote_storage_counter_;
+        // the scan io by the tier it's served from
+        RuntimeProfile::Counter* scan_bytes_from_page_cache_counter_;
+        RuntimeProfile::Counter* scan_bytes_from_file_cache_counter_;
+        RuntimeProfile::Counter* scan_bytes_from_local_disk_counter_;
+        RuntimeProfile::Counter* scan_io_from_local_disk_counter_;
+        RuntimeProfile::Counter* scan_io_from_remote_storage_counter_;
         // number rows returned by query.
         // only set once by result sink when closing.
         RuntimeProfile::Counter* returned_rows_counter_;
@@ -58,6 +65,16 @@ public:
                     ADD_COUNTER(profile_, "ScanBytesFromLocalStorage", TUnit::BYTES);
             scan_bytes_from_remote_storage_counter_ =
                     ADD_COUNTER(profile_, "ScanBytesFromRemoteStorage", TUnit::BYTES);
+            scan_bytes_from_page_cache_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromPageCache", TUnit::BYTES);
+            scan_bytes_from_file_cache_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromFileCache", TUnit::BYTES);
+            scan_bytes_from_local_disk_counter_ =
+                    ADD_COUNTER(profile_, "ScanBytesFromLocalDisk", TUnit::BYTES);
+            scan_io_from_local_disk_counter_ =
+                    ADD_COUNTER(profile_, "ScanIOFromLocalDisk", TUnit::UNIT);
+            scan_io_from_remote_storage_counter_ =
+                    ADD_COUNTER(profile_, "ScanIOFromRemoteStorage", TUnit::UNIT);
             returned_rows_counter_ = ADD_COUNTER(profile_, "ReturnedRows", TUnit::UNIT);
             shuffle_send_bytes_counter_ = ADD_COUNTER(profile_, "ShuffleSendBytes", TUnit::BYTES);
             shuffle_send_rows_counter_ =
@@ -86,6 +103,21 @@ public:
     int64_t scan_bytes_from_remote_storage() const {
         return stats_.scan_bytes_from_remote_storage_counter_->value();
     }
+    int64_t scan_bytes_from_page_cache() const {
+        return stats_.scan_bytes_from_page_cache_counter_->value();
+    }
+    int64_t scan_bytes_from_file_cache() const {
+        return stats_.scan_bytes_from_file_cache_counter_->value();
+    }
+    int64_t scan_bytes_from_local_disk() const {
+        return stats_.scan_bytes_from_local_disk_counter_->value();
+    }
+    int64_t scan_io_from_local_disk() const {
+        return stats_.scan_io_from_local_disk_counter_->value();
+    }
+    int64_t scan_io_from_remote_storage() const {
+        return stats_.scan_io_from_remote_storage_counter_->value();
+    }
     int64_t returned_rows() const { return stats_.returned_rows_counter_->value(); }
     int64_t shuffle_send_bytes() const { return stats_.shuffle_send_bytes_counter_->value(); }
     int64_t shuffle_send_rows() const { return stats_.shuffle_send_rows_counter_->value(); }
@@ -106,6 +138,23 @@ public:
     void update_scan_bytes_from_remote_storage(int64_t delta) const {
         stats_.scan_bytes_from_remote_storage_counter_->update(delta);
     }
+    void update_scan_bytes_from_page_cache(int64_t delta) const {
+        stats_.scan_bytes_from_page_cache_counter_->update(delta);
+    }
+    // Roll the io of the file readers of a scan up by the tier it's served from.
+    // `file_cache_bytes` are the bytes read from the file cache since the last update.
+    // The scan bytes from local storage are the file cache hits plus the local disk reads,
+    // and the scan bytes from remote storage are the bytes actually read from it.
+    void update_scan_io(int64_t file_cache_bytes, const io::FileCacheStatistics& stats) const {
+        stats_.scan_bytes_from_file_cache_counter_->update(file_cache_bytes);
+        stats_.scan_bytes_from_local_disk_counter_->update(stats.bytes_read_from_local_disk);
+        stats_.scan_io_from_local_disk_counter_->update(stats.num_local_disk_io_total);
+        stats_.scan_io_from_remote_storage_counter_->update(stats.num_remote_storage_io_total);
+        stats_.scan_bytes_from_local_storage_counter_->update(file_cache_bytes +
+                                                              stats.bytes_read_from_local_disk);
+        stats_.scan_bytes_from_remote_storage_counter_->update(
+                stats.bytes_read_from_remote_storage);
+    }
     void update_returned_rows(int64_t delta) const { stats_.returned_rows_counter_->update(delta); }
     void update_shuffle_send_bytes(int64_t delta) const {
         stats_.shuffle_send_bytes_counter_->update(delta);
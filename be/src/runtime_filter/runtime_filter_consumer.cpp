@@ -39,7 +39,8 @@ Status RuntimeFilterConsumer::_apply_ready_expr(
     RETURN_IF_ERROR(_get_push_exprs(push_exprs, _probe_expr));
 
     for (auto i = origin_size; i < push_exprs.size(); i++) {
-        push_exprs[i]->attach_profile_counter(_rf_input, _rf_filter, _always_true_counter);
+        push_exprs[i]->attach_profile_counter(_rf_input, _rf_filter, _always_true_counter,
+                                              _disabled_counter);
     }
     return Status::OK();
 }
@@ -95,6 +96,8 @@ Status RuntimeFilterConsumer::_get_push_exprs(std::vector<vectorized::VRuntimeFi
         node.in_predicate.__set_is_not_in(false);
         node.__set_opcode(TExprOpcode::FILTER_IN);
         node.__set_is_nullable(false);
+        // the set is shared by the consumers of the filter and not changed any more
+        _wrapper->hybrid_set()->prepare_for_probe();
         auto in_pred = vectorized::VDirectInPredicate::create_shared(node, _wrapper->hybrid_set());
         in_pred->add_child(probe_ctx->root());
         auto wrapper = vectorized::VRuntimeFilterWrapper::create_shared(
@@ -241,6 +244,10 @@ void RuntimeFilterConsumer::collect_realtime_profile(RuntimeProfile* parent_oper
     c = parent_operator_profile->add_counter(fmt::format("RF{} AlwaysTrueFilterRows", filter_id),
                                              TUnit::UNIT, "RuntimeFilterInfo", 2);
     c->update(_always_true_counter->value());
+
+    c = parent_operator_profile->add_counter(fmt::format("RF{} DisabledTimes", filter_id),
+                                             TUnit::UNIT, "RuntimeFilterInfo", 2);
+    c->update(_disabled_counter->value());
 }
 
 } // namespace doris
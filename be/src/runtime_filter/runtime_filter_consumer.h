@@ -149,6 +149,9 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_counter =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
+    // the times the runtime filter is disabled for its low selectivity
+    std::shared_ptr<RuntimeProfile::Counter> _disabled_counter =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0, 1);
 
     int32_t _rf_wait_time_ms;
     const int64_t _registration_time;
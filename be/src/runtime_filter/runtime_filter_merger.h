@@ -55,8 +55,10 @@ public:
     }
 
     // If input is a disabled predicate, the final result is a disabled predicate.
-    Status merge_from(const RuntimeFilter* other) {
-        _received_producer_num++;
+    // `producer_num` is the number of products `other` has merged, it is greater than 1 when
+    // `other` is a partial merger.
+    Status merge_from(const RuntimeFilter* other, int producer_num = 1) {
+        _received_producer_num += producer_num;
         if (_expected_producer_num < _received_producer_num) {
             return Status::InternalError(
                     "runtime filter merger input product more than expected, {}", debug_string());
@@ -91,6 +93,10 @@ public:
 
     uint64_t get_received_sum_size() const { return _received_sum_size; }
 
+    int expected_producer_num() const { return _expected_producer_num; }
+
+    int received_producer_num() const { return _received_producer_num; }
+
     bool ready() const { return _rf_state == State::READY; }
 
 private:
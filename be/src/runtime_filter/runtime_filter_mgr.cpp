@@ -185,9 +185,38 @@ Status RuntimeFilterMergeControllerEntity::_init_with_desc(
             RuntimeFilterMerger::create(query_ctx.get(), runtime_filter_desc, &cnt_val->merger));
     cnt_val->merger->set_expected_producer_num(producer_size);
 
+    // only one product of a broadcast join is merged
+    const int fan_in = config::runtime_filter_merge_fan_in;
+    if (fan_in > 1 && producer_size > fan_in && !runtime_filter_desc->is_broadcast_join) {
+        for (int i = 0; i < fan_in; ++i) {
+            auto partial = std::make_unique<PartialMergeContext>();
+            RETURN_IF_ERROR(RuntimeFilterMerger::create(query_ctx.get(), runtime_filter_desc,
+                                                        &partial->merger));
+            partial->merger->set_expected_producer_num(producer_size);
+            cnt_val->partial_mergers.push_back(std::move(partial));
+        }
+    }
+
     return Status::OK();
 }
 
+Status RuntimeFilterMergeControllerEntity::_merge_into_partial_merger(GlobalMergeContext& cnt_val,
+                                                                      const RuntimeFilter* filter) {
+    // merge into the first idle partial merger, wait for one only if all of them are busy
+    const auto num = cnt_val.partial_mergers.size();
+    const auto start = cnt_val.next_partial_merger.fetch_add(1) % num;
+    for (size_t i = 0; i < num; ++i) {
+        auto& partial = *cnt_val.partial_mergers[(start + i) % num];
+        std::unique_lock<std::mutex> l(partial.mtx, std::try_to_lock);
+        if (l.owns_lock()) {
+            return partial.merger->merge_from(filter);
+        }
+    }
+    auto& partial = *cnt_val.partial_mergers[start];
+    std::lock_guard<std::mutex> l(partial.mtx);
+    return partial.merger->merge_from(filter);
+}
+
 Status RuntimeFilterMergeControllerEntity::init(std::shared_ptr<QueryContext> query_ctx,
                                                 const TRuntimeFilterParams& runtime_filter_params) {
     _mem_tracker = std::make_shared<MemTracker>("RuntimeFilterMergeControllerEntity(experimental)");
@@ -303,7 +332,28 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
     }
     auto& cnt_val = iter->second;
     bool is_ready = false;
-    {
+    if (!cnt_val.partial_mergers.empty()) {
+        // deserialize and merge out of the lock of the filter
+        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+        RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
+                                                      &tmp_filter));
+        RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+        RETURN_IF_ERROR(_merge_into_partial_merger(cnt_val, tmp_filter.get()));
+
+        std::lock_guard<std::mutex> l(cnt_val.mtx);
+        cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
+        if (++cnt_val.partial_merged_num == cnt_val.merger->expected_producer_num()) {
+            // all products have been merged into the partial mergers
+            for (auto& partial : cnt_val.partial_mergers) {
+                std::lock_guard<std::mutex> partial_lock(partial->mtx);
+                if (partial->merger->received_producer_num() > 0) {
+                    RETURN_IF_ERROR(cnt_val.merger->merge_from(
+                            partial->merger.get(), partial->merger->received_producer_num()));
+                }
+            }
+        }
+        is_ready = cnt_val.merger->ready();
+    } else {
         std::lock_guard<std::mutex> l(iter->second.mtx);
         // Skip the other broadcast join runtime filter
         if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
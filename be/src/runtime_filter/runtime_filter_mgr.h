@@ -22,6 +22,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -64,6 +65,11 @@ struct LocalMergeContext {
                              std::shared_ptr<RuntimeFilterProducer> producer);
 };
 
+struct PartialMergeContext {
+    std::mutex mtx;
+    std::shared_ptr<RuntimeFilterMerger> merger;
+};
+
 struct GlobalMergeContext {
     std::mutex mtx;
     std::shared_ptr<RuntimeFilterMerger> merger;
@@ -71,6 +77,12 @@ struct GlobalMergeContext {
     std::vector<TRuntimeFilterTargetParamsV2> targetv2_info;
     std::unordered_set<UniqueId> arrive_id;
     std::vector<PNetworkAddress> source_addrs;
+    // If there are many producers, the products are deserialized and merged into the partial
+    // mergers concurrently, and the partial mergers are merged into `merger` after all products
+    // arrived, so the merge node does not merge hundreds of large filters one by one.
+    std::vector<std::unique_ptr<PartialMergeContext>> partial_mergers;
+    std::atomic_uint32_t next_partial_merger = 0;
+    int partial_merged_num = 0;
 };
 
 // owned by RuntimeState
@@ -150,6 +162,8 @@ private:
                            const std::vector<TRuntimeFilterTargetParamsV2>&& target_info,
                            const int producer_size);
 
+    Status _merge_into_partial_merger(GlobalMergeContext& cnt_val, const RuntimeFilter* filter);
+
     // protect _filter_map
     std::shared_mutex _filter_map_mutex;
     std::shared_ptr<MemTracker> _mem_tracker;
@@ -79,6 +79,7 @@
 #include "util/debug_util.h"
 #include "util/disk_info.h"
 #include "util/mem_info.h"
+#include "util/query_cpu_profiler.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/thrift_server.h"
 #include "util/uid_util.h"
@@ -599,6 +600,7 @@ int main(int argc, char** argv) {
     // 6. start daemon thread to do clean or gc jobs
     doris::Daemon daemon;
     daemon.start();
+    doris::QueryCpuProfiler::instance()->start();
 
     exec_env->storage_engine().notify_listeners();
 
@@ -615,6 +617,7 @@ int main(int argc, char** argv) {
 #endif
     // For graceful shutdown, need to wait for all running queries to stop
     exec_env->wait_for_all_tasks_done();
+    doris::QueryCpuProfiler::instance()->stop();
     daemon.stop();
     flight_server.reset();
     LOG(INFO) << "Flight server stopped.";
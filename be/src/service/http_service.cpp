@@ -52,11 +52,14 @@
 #include "http/action/jeprofile_actions.h"
 #include "http/action/load_channel_action.h"
 #include "http/action/load_stream_action.h"
+#include "http/action/lock_contention_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pad_rowset_action.h"
 #include "http/action/pipeline_task_action.h"
+#include "http/action/pipeline_trace_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_cpu_profile_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/report_action.h"
 #include "http/action/reset_rpc_channel_action.h"
@@ -153,6 +156,15 @@ Status HttpService::start() {
     auto* adjust_tracing_dump = _pool.add(new AdjustTracingDump(_env));
     _ev_http_server->register_handler(HttpMethod::POST, "api/pipeline/tracing",
                                       adjust_tracing_dump);
+    auto* pipeline_trace_action = _pool.add(new PipelineTraceAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "api/pipeline/trace",
+                                      pipeline_trace_action);
+    auto* query_cpu_profile_action = _pool.add(new QueryCpuProfileAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "api/query_cpu_profile",
+                                      query_cpu_profile_action);
+    auto* lock_contention_action = _pool.add(new LockContentionAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "api/lock_contention",
+                                      lock_contention_action);
 
     // Register BE version action
     VersionAction* version_action =
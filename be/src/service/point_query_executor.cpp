@@ -17,6 +17,7 @@
 
 #include "service/point_query_executor.h"
 
+#include <bvar/latency_recorder.h>
 #include <fmt/format.h>
 #include <gen_cpp/Descriptors_types.h>
 #include <gen_cpp/Exprs_types.h>
@@ -26,8 +27,10 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -63,6 +66,12 @@
 
 namespace doris {
 
+bvar::LatencyRecorder g_point_query_latency("point_query", "total");
+bvar::LatencyRecorder g_point_query_init_latency("point_query", "init");
+bvar::LatencyRecorder g_point_query_lookup_key_latency("point_query", "lookup_key");
+bvar::LatencyRecorder g_point_query_lookup_data_latency("point_query", "lookup_data");
+bvar::LatencyRecorder g_point_query_output_data_latency("point_query", "output_data");
+
 class PointQueryResultBlockBuffer final : public vectorized::MySQLResultBlockBuffer {
 public:
     PointQueryResultBlockBuffer(RuntimeState* state) : vectorized::MySQLResultBlockBuffer(state) {}
@@ -344,6 +353,11 @@ void PointQueryExecutor::print_profile() {
     auto load_segments_key_us = _profile_metrics.load_segment_key_stage_ns.value() / 1000;
     auto load_segments_data_us = _profile_metrics.load_segment_data_stage_ns.value() / 1000;
     auto total_us = init_us + lookup_key_us + lookup_data_us + output_data_us;
+    g_point_query_latency << total_us;
+    g_point_query_init_latency << init_us;
+    g_point_query_lookup_key_latency << lookup_key_us;
+    g_point_query_lookup_data_latency << lookup_data_us;
+    g_point_query_output_data_latency << output_data_us;
     auto read_stats = _profile_metrics.read_stats;
     const std::string stats_str = fmt::format(
             "[lookup profile:{}us] init:{}us, init_key:{}us,"
@@ -418,7 +432,13 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // look up the keys in order, so the adjacent keys hit the same primary key index pages
+    std::vector<size_t> key_orders(_row_read_ctxs.size());
+    std::iota(key_orders.begin(), key_orders.end(), 0);
+    std::sort(key_orders.begin(), key_orders.end(), [&](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    for (size_t i : key_orders) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -0,0 +1,233 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/alp_coding.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "util/coding.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace doris {
+
+namespace {
+
+template <typename T>
+struct AlpTraits;
+
+template <>
+struct AlpTraits<double> {
+    static constexpr int MAX_EXPONENT = 18;
+    // adding and subtracting 2^52 + 2^51 rounds a double of magnitude less than 2^51
+    static constexpr double MAGIC = 6755399441055744.0;
+    static constexpr double LIMIT = 2251799813685248.0;
+    static constexpr double EXP10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                       1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                       1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC10[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                        1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                        1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpTraits<float> {
+    static constexpr int MAX_EXPONENT = 10;
+    // adding and subtracting 2^23 + 2^22 rounds a float of magnitude less than 2^22
+    static constexpr float MAGIC = 12582912.0F;
+    static constexpr float LIMIT = 4194304.0F;
+    static constexpr float EXP10[] = {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F,
+                                      1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+    static constexpr float FRAC10[] = {1e0F,  1e-1F, 1e-2F, 1e-3F, 1e-4F, 1e-5F,
+                                       1e-6F, 1e-7F, 1e-8F, 1e-9F, 1e-10F};
+};
+
+// the values sampled from a vector to choose its exponent and factor
+constexpr size_t ALP_SAMPLES = 32;
+// ExponentFactor(2) + ExceptionNum(2) + ForBytes(4)
+constexpr size_t ALP_VECTOR_HEADER_SIZE = 8;
+
+template <typename T>
+T alp_decode_value(int64_t encoded, int exponent, int factor) {
+    using Traits = AlpTraits<T>;
+    return static_cast<T>(encoded) * Traits::EXP10[factor] * Traits::FRAC10[exponent];
+}
+
+// Returns false if `value` does not round trip by the exponent and factor.
+template <typename T>
+bool alp_encode_value(T value, int exponent, int factor, int64_t* encoded) {
+    using Traits = AlpTraits<T>;
+    T scaled = value * Traits::EXP10[exponent] * Traits::FRAC10[factor];
+    // also false for NaN and infinity
+    if (!(scaled > -Traits::LIMIT && scaled < Traits::LIMIT)) {
+        return false;
+    }
+    *encoded = static_cast<int64_t>(scaled + Traits::MAGIC - Traits::MAGIC);
+    // compare the bits, so that -0.0 is an exception
+    T decoded = alp_decode_value<T>(*encoded, exponent, factor);
+    return std::memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+// The exponent and factor of the smallest estimated size of the sampled values.
+template <typename T>
+std::pair<int, int> alp_choose_exponent_factor(const T* values, size_t count) {
+    size_t step = std::max<size_t>(1, count / ALP_SAMPLES);
+    std::pair<int, int> best {0, 0};
+    size_t best_bits = std::numeric_limits<size_t>::max();
+    for (int exponent = 0; exponent <= AlpTraits<T>::MAX_EXPONENT; ++exponent) {
+        for (int factor = 0; factor <= exponent; ++factor) {
+            size_t samples = 0;
+            size_t exceptions = 0;
+            int64_t min = std::numeric_limits<int64_t>::max();
+            int64_t max = std::numeric_limits<int64_t>::min();
+            for (size_t i = 0; i < count; i += step, ++samples) {
+                int64_t encoded = 0;
+                if (alp_encode_value(values[i], exponent, factor, &encoded)) {
+                    min = std::min(min, encoded);
+                    max = std::max(max, encoded);
+                } else {
+                    ++exceptions;
+                }
+            }
+            size_t bit_width =
+                    min > max ? 0 : std::bit_width(static_cast<uint64_t>(max) - uint64_t(min));
+            size_t bits = exceptions * (sizeof(T) * 8 + 16) + (samples - exceptions) * bit_width;
+            if (bits < best_bits) {
+                best_bits = bits;
+                best = {exponent, factor};
+            }
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+template <typename T>
+void AlpEncoder<T>::encode(const T* values, size_t count, faststring* buffer) {
+    put_fixed32_le(buffer, static_cast<uint32_t>(count));
+    int64_t encoded[ALP_VECTOR_SIZE];
+    std::vector<uint16_t> positions;
+    std::vector<T> exceptions;
+    faststring for_buffer;
+    for (size_t start = 0; start < count; start += ALP_VECTOR_SIZE) {
+        const T* vector = values + start;
+        size_t size = std::min(ALP_VECTOR_SIZE, count - start);
+        auto [exponent, factor] = alp_choose_exponent_factor(vector, size);
+
+        positions.clear();
+        exceptions.clear();
+        for (size_t i = 0; i < size; ++i) {
+            if (!alp_encode_value(vector[i], exponent, factor, &encoded[i])) {
+                positions.push_back(static_cast<uint16_t>(i));
+                exceptions.push_back(vector[i]);
+            }
+        }
+        // the exceptions take the value of a encoded value to not widen the frames
+        int64_t filler = 0;
+        if (positions.size() < size) {
+            size_t i = 0;
+            for (size_t j = 0; j < positions.size() && positions[j] == i; ++j, ++i) {
+            }
+            filler = encoded[i];
+        }
+        for (auto position : positions) {
+            encoded[position] = filler;
+        }
+
+        for_buffer.clear();
+        ForEncoder<int64_t> for_encoder(&for_buffer);
+        for_encoder.put_batch(encoded, size);
+        uint32_t for_bytes = for_encoder.flush();
+
+        uint8_t header[4] = {static_cast<uint8_t>(exponent), static_cast<uint8_t>(factor)};
+        encode_fixed16_le(header + 2, static_cast<uint16_t>(positions.size()));
+        buffer->append(header, sizeof(header));
+        put_fixed32_le(buffer, for_bytes);
+        buffer->append(for_buffer.data(), for_bytes);
+        for (auto position : positions) {
+            uint8_t bytes[2];
+            encode_fixed16_le(bytes, position);
+            buffer->append(bytes, sizeof(bytes));
+        }
+        buffer->append(exceptions.data(), exceptions.size() * sizeof(T));
+    }
+}
+
+template <typename T>
+size_t AlpDecoder<T>::count(const uint8_t* data, size_t len) {
+    return len < 4 ? 0 : decode_fixed32_le(data);
+}
+
+template <typename T>
+bool AlpDecoder<T>::decode(const uint8_t* data, size_t len, T* values) {
+    if (len < 4) {
+        return false;
+    }
+    size_t count = decode_fixed32_le(data);
+    size_t offset = 4;
+    int64_t encoded[ALP_VECTOR_SIZE];
+    for (size_t start = 0; start < count; start += ALP_VECTOR_SIZE) {
+        size_t size = std::min(ALP_VECTOR_SIZE, count - start);
+        if (offset + ALP_VECTOR_HEADER_SIZE > len) {
+            return false;
+        }
+        int exponent = data[offset];
+        int factor = data[offset + 1];
+        size_t num_exceptions = decode_fixed16_le(data + offset + 2);
+        size_t for_bytes = decode_fixed32_le(data + offset + 4);
+        offset += ALP_VECTOR_HEADER_SIZE;
+        if (exponent > AlpTraits<T>::MAX_EXPONENT || factor > exponent ||
+            num_exceptions > size ||
+            offset + for_bytes + num_exceptions * (2 + sizeof(T)) > len) {
+            return false;
+        }
+
+        ForDecoder<int64_t> for_decoder(data + offset, for_bytes);
+        if (!for_decoder.init() || for_decoder.count() != size ||
+            !for_decoder.get_batch(encoded, size)) {
+            return false;
+        }
+        offset += for_bytes;
+
+        T* __restrict output = values + start;
+        for (size_t i = 0; i < size; ++i) {
+            output[i] = alp_decode_value<T>(encoded[i], exponent, factor);
+        }
+
+        const uint8_t* exception_values = data + offset + num_exceptions * 2;
+        for (size_t i = 0; i < num_exceptions; ++i) {
+            size_t position = decode_fixed16_le(data + offset + i * 2);
+            if (position >= size) {
+                return false;
+            }
+            std::memcpy(output + position, exception_values + i * sizeof(T), sizeof(T));
+        }
+        offset += num_exceptions * (2 + sizeof(T));
+    }
+    return true;
+}
+
+template class AlpEncoder<float>;
+template class AlpEncoder<double>;
+template class AlpDecoder<float>;
+template class AlpDecoder<double>;
+
+} // namespace doris
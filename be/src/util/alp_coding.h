@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "util/faststring.h"
+
+namespace doris {
+
+// The implementation of ALP (Adaptive Lossless floating-Point) coding, please refer to
+// https://dl.acm.org/doi/10.1145/3626717
+//
+// Most real world doubles, e.g. prices and sensor readings, are decimals of a few digits. Such a
+// value n is encoded losslessly as the integer d = round(n * 10^e / 10^f), which is decoded by
+// d * 10^f / 10^e. The integers of a vector are stored by frame-of-reference coding, the values
+// that do not round trip, e.g. NaN or the doubles of many digits, are stored as exceptions.
+//
+// The encoded data format is as follows:
+//
+//      32 bit ValuesNum
+//      AlpVector * ceil(ValuesNum / ALP_VECTOR_SIZE)
+//
+// AlpVector:
+//       8 bit Exponent e
+//       8 bit Factor f
+//      16 bit ExceptionNum
+//      32 bit ForBytes
+//      ForBytes of the integers encoded by ForEncoder<int64_t>
+//      16 bit Position * ExceptionNum
+//      T Value * ExceptionNum
+template <typename T>
+class AlpEncoder {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+public:
+    // Appends `count` encoded values to `buffer`.
+    static void encode(const T* values, size_t count, faststring* buffer);
+};
+
+template <typename T>
+class AlpDecoder {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+public:
+    // The number of values of the encoded data, 0 if the data is broken.
+    static size_t count(const uint8_t* data, size_t len);
+
+    // Decodes all values of the encoded data into `values`, which has room for count() values.
+    // Returns false if the data is broken.
+    static bool decode(const uint8_t* data, size_t len, T* values);
+};
+
+constexpr size_t ALP_VECTOR_SIZE = 1024;
+
+} // namespace doris
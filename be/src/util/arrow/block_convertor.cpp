@@ -17,6 +17,8 @@
 
 #include "util/arrow/block_convertor.h"
 
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
 #include <arrow/array/builder_base.h>
 #include <arrow/array/builder_binary.h>
 #include <arrow/array/builder_decimal.h>
@@ -24,7 +26,9 @@
 #include <arrow/array/builder_primitive.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
+#include <arrow/buffer.h>
 #include <arrow/type.h>
+#include <arrow/util/bit_util.h>
 #include <arrow/util/decimal.h>
 #include <arrow/visit_type_inline.h>
 #include <arrow/visitor.h>
@@ -36,10 +40,14 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -52,6 +60,47 @@ class Array;
 
 namespace doris {
 
+namespace {
+
+// A buffer of the data of a column, which keeps the column alive as long as the arrow array
+// sharing it. The column is immutable while it's shared, see Block::clear_column_data.
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(const void* data, size_t size, vectorized::ColumnPtr column)
+            : arrow::Buffer(static_cast<const uint8_t*>(data), static_cast<int64_t>(size)),
+              _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
+// Return the byte width of the values of `type` if a column of it can share its data with
+// an arrow array of `arrow_type`, 0 for a numeric type which can't, -1 for a string type.
+int zero_copy_width(PrimitiveType type, arrow::Type::type arrow_type) {
+    switch (type) {
+    case TYPE_TINYINT:
+        return arrow_type == arrow::Type::INT8 ? 1 : 0;
+    case TYPE_SMALLINT:
+        return arrow_type == arrow::Type::INT16 ? 2 : 0;
+    case TYPE_INT:
+        return arrow_type == arrow::Type::INT32 ? 4 : 0;
+    case TYPE_BIGINT:
+        return arrow_type == arrow::Type::INT64 ? 8 : 0;
+    case TYPE_FLOAT:
+        return arrow_type == arrow::Type::FLOAT ? 4 : 0;
+    case TYPE_DOUBLE:
+        return arrow_type == arrow::Type::DOUBLE ? 8 : 0;
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+    case TYPE_STRING:
+        return arrow_type == arrow::Type::STRING ? -1 : 0;
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
 class FromBlockConverter {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
@@ -67,6 +116,11 @@ public:
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Make the array sharing the buffers of `column`, null if the type can't be shared.
+    Status _convert_zero_copy(const vectorized::ColumnPtr& column,
+                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                              std::shared_ptr<arrow::Array>* array);
+
     const vectorized::Block& _block;
     const std::shared_ptr<arrow::Schema>& _schema;
     arrow::MemoryPool* _pool;
@@ -102,6 +156,12 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         if (arrow_type->name() == "utf8" && column->byte_size() >= MAX_ARROW_UTF8) {
             arrow_type = arrow::large_utf8();
         }
+        if (config::enable_zero_copy_block_to_arrow) {
+            RETURN_IF_ERROR(_convert_zero_copy(column, arrow_type, &_arrays[idx]));
+            if (_arrays[idx] != nullptr) {
+                continue;
+            }
+        }
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, arrow_type, &builder);
         if (!arrow_st.ok()) {
@@ -126,6 +186,57 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     return Status::OK();
 }
 
+Status FromBlockConverter::_convert_zero_copy(const vectorized::ColumnPtr& column,
+                                              const std::shared_ptr<arrow::DataType>& arrow_type,
+                                              std::shared_ptr<arrow::Array>* array) {
+    int width = zero_copy_width(vectorized::remove_nullable(_cur_type)->get_primitive_type(),
+                                arrow_type->id());
+    if (width == 0) {
+        return Status::OK();
+    }
+    vectorized::ColumnPtr data_column = column;
+    std::shared_ptr<arrow::Buffer> null_bitmap;
+    int64_t null_count = 0;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                column.get())) {
+        data_column = nullable->get_nested_column_ptr();
+        // arrow marks the valid values in bits, so the null map is converted anyway
+        const auto& null_map = nullable->get_null_map_data();
+        auto bitmap = arrow::AllocateBitmap(static_cast<int64_t>(_cur_rows), _pool);
+        if (!bitmap.ok()) {
+            return to_doris_status(bitmap.status());
+        }
+        null_bitmap = std::move(bitmap).ValueUnsafe();
+        uint8_t* bits = null_bitmap->mutable_data();
+        for (size_t i = 0; i < _cur_rows; ++i) {
+            arrow::bit_util::SetBitTo(bits, static_cast<int64_t>(i), !null_map[i]);
+            null_count += null_map[i];
+        }
+    }
+
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers {std::move(null_bitmap)};
+    if (width > 0) {
+        // the numeric data types are checked by zero_copy_width, so only the width matters
+        buffers.push_back(std::make_shared<ColumnBuffer>(data_column->get_raw_data().data,
+                                                         _cur_rows * width, data_column));
+    } else {
+        const auto* strings =
+                vectorized::check_and_get_column<vectorized::ColumnString>(data_column.get());
+        if (strings == nullptr) {
+            return Status::OK();
+        }
+        // offsets[-1] is 0 in the padding of the offsets, which is the first offset of arrow
+        const auto& offsets = strings->get_offsets();
+        buffers.push_back(std::make_shared<ColumnBuffer>(
+                offsets.data() - 1, (_cur_rows + 1) * sizeof(offsets[0]), data_column));
+        const auto& chars = strings->get_chars();
+        buffers.push_back(std::make_shared<ColumnBuffer>(chars.data(), chars.size(), data_column));
+    }
+    *array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(_cur_rows),
+                                                     std::move(buffers), null_count));
+    return Status::OK();
+}
+
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
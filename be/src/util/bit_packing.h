@@ -136,5 +136,18 @@ private:
     /// Compute the number of values with the given bit width that can be unpacked from
     /// an input buffer of 'in_bytes' into an output buffer with space for 'num_values'.
     static int64_t NumValuesToUnpack(int bit_width, int64_t in_bytes, int64_t num_values);
+
+#ifdef __AVX2__
+    /// Unpack values with 1 <= 'bit_width' <= 16 by 8 at a time with AVX2, which covers the
+    /// definition levels and the dictionary indices of the dictionaries up to 64K entries.
+    /// Stops when less than 8 values are left or the 16 byte load of the next 8 values
+    /// would read past 'in_bytes', the returned position is always on a byte boundary.
+    template <typename OutType>
+    static std::pair<const uint8_t*, int64_t> UnpackValuesAVX2(int bit_width,
+                                                               const uint8_t* __restrict__ in,
+                                                               int64_t in_bytes,
+                                                               int64_t num_values,
+                                                               OutType* __restrict__ out);
+#endif
 };
 } // namespace doris
@@ -17,7 +17,12 @@
 
 // the implement of BitPacking is from impala
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <tuple>
 
 #include "util/bit_packing.h"
 
@@ -55,10 +60,29 @@ std::pair<const uint8_t*, int64_t> BitPacking::UnpackValues(int bit_width,
                                                             OutType* __restrict__ out) {
     static_assert(IsSupportedUnpackingType<OutType>(), "Only unsigned integers are supported.");
 
+    int64_t num_unpacked = 0;
+#ifdef __AVX2__
+    if constexpr (sizeof(OutType) <= sizeof(uint32_t)) {
+        if (bit_width >= 1 && bit_width <= 16) {
+            num_values = NumValuesToUnpack(bit_width, in_bytes, num_values);
+            const uint8_t* in_pos = nullptr;
+            std::tie(in_pos, num_unpacked) =
+                    UnpackValuesAVX2(bit_width, in, in_bytes, num_values, out);
+            in_bytes -= in_pos - in;
+            in = in_pos;
+            num_values -= num_unpacked;
+            out += num_unpacked;
+        }
+    }
+#endif
+
+    // The tail left by the AVX2 unpacking is unpacked here.
 #pragma push_macro("UNPACK_VALUES_CASE")
-#define UNPACK_VALUES_CASE(ignore1, i, ignore2) \
-    case i:                                     \
-        return UnpackValues<OutType, i>(in, in_bytes, num_values, out);
+#define UNPACK_VALUES_CASE(ignore1, i, ignore2)                                          \
+    case i: {                                                                            \
+        auto [in_pos, num_read] = UnpackValues<OutType, i>(in, in_bytes, num_values, out); \
+        return std::make_pair(in_pos, num_unpacked + num_read);                          \
+    }
 
     switch (bit_width) {
         // Expand cases from 0 to 64.
@@ -70,6 +94,61 @@ std::pair<const uint8_t*, int64_t> BitPacking::UnpackValues(int bit_width,
 #pragma pop_macro("UNPACK_VALUES_CASE")
 }
 
+#ifdef __AVX2__
+template <typename OutType>
+std::pair<const uint8_t*, int64_t> BitPacking::UnpackValuesAVX2(int bit_width,
+                                                                const uint8_t* __restrict__ in,
+                                                                int64_t in_bytes,
+                                                                int64_t num_values,
+                                                                OutType* __restrict__ out) {
+    DCHECK(bit_width >= 1 && bit_width <= 16);
+    // 8 values take 'bit_width' bytes, value i starts at bit i * bit_width and spans at most
+    // 3 bytes. The 16 bytes are loaded into both 128-bit lanes, then each 32-bit lane picks
+    // the bytes of its value by a shuffle, shifts the value down and masks it off.
+    alignas(32) uint8_t shuffle_bytes[32];
+    alignas(32) uint32_t shift_bits[8];
+    for (int i = 0; i < 8; ++i) {
+        int first_bit = i * bit_width;
+        int first_byte = first_bit / CHAR_BIT;
+        int last_byte = (first_bit + bit_width - 1) / CHAR_BIT;
+        for (int j = 0; j < 4; ++j) {
+            // 0x80 zeroes the byte
+            shuffle_bytes[i * 4 + j] =
+                    first_byte + j <= last_byte ? static_cast<uint8_t>(first_byte + j) : 0x80;
+        }
+        shift_bits[i] = first_bit % CHAR_BIT;
+    }
+    const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(shuffle_bytes));
+    const __m256i shift = _mm256_load_si256(reinterpret_cast<const __m256i*>(shift_bits));
+    const __m256i mask = _mm256_set1_epi32(static_cast<int>(GetMask(bit_width)));
+
+    const uint8_t* in_pos = in;
+    int64_t num_unpacked = 0;
+    while (num_values - num_unpacked >= 8 && in_bytes >= static_cast<int64_t>(sizeof(__m128i))) {
+        __m256i bytes = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_pos)));
+        __m256i values = _mm256_and_si256(
+                _mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffle), shift), mask);
+        if constexpr (sizeof(OutType) == sizeof(uint32_t)) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + num_unpacked), values);
+        } else {
+            __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(values),
+                                              _mm256_extracti128_si256(values, 1));
+            if constexpr (sizeof(OutType) == sizeof(uint16_t)) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + num_unpacked), packed);
+            } else {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + num_unpacked),
+                                 _mm_packus_epi16(packed, packed));
+            }
+        }
+        in_pos += bit_width;
+        in_bytes -= bit_width;
+        num_unpacked += 8;
+    }
+    return std::make_pair(in_pos, num_unpacked);
+}
+#endif
+
 template <typename OutType, int BIT_WIDTH>
 std::pair<const uint8_t*, int64_t> BitPacking::UnpackValues(const uint8_t* __restrict__ in,
                                                             int64_t in_bytes, int64_t num_values,
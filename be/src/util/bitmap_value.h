@@ -34,6 +34,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -665,11 +666,48 @@ public:
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
         Roaring64Map ans;
-        // not particularly fast
+        ans.union_many(n, inputs);
+        return ans;
+    }
+
+    /**
+     * computes the logical or (union) between the current bitmap and "n"
+     * bitmaps, writing the result in the current bitmap.
+     *
+     * The 32-bit bitmaps are grouped by the high bytes, and each group is
+     * unioned at once by roaring_bitmap_or_many, which unions the containers
+     * lazily and computes the cardinalities only once at the end, instead of
+     * n pairwise unions.
+     */
+    Roaring64Map& union_many(size_t n, const Roaring64Map** inputs) {
+        phmap::btree_map<uint32_t, std::vector<const roaring::Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            if (inputs[lcv] == this) {
+                continue;
+            }
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].push_back(&map_entry.second);
+            }
         }
-        return ans;
+        for (auto& [key, bitmaps] : groups) {
+            auto iter = roarings.find(key);
+            if (iter != roarings.end()) {
+                if (bitmaps.size() == 1) {
+                    iter->second |= *bitmaps[0];
+                } else {
+                    bitmaps.push_back(&iter->second);
+                    iter->second = roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data());
+                }
+                continue;
+            }
+            if (bitmaps.size() == 1) {
+                roarings[key] = *bitmaps[0];
+            } else {
+                roarings[key] = roaring::Roaring::fastunion(bitmaps.size(), bitmaps.data());
+            }
+            roarings[key].setCopyOnWrite(copyOnWrite);
+        }
+        return *this;
     }
 
     friend class Roaring64MapSetBitForwardIterator;
@@ -1278,9 +1316,7 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
-                }
+                _bitmap->union_many(bitmaps.size(), bitmaps.data());
                 break;
             case SET: {
                 *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
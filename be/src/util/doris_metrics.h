@@ -249,6 +249,8 @@ public:
     IntCounter* scanner_cnt = nullptr;
     IntCounter* scanner_task_cnt = nullptr;
     IntCounter* pipeline_task_queue_size = nullptr;
+    IntCounter* pipeline_task_local_numa_steal_count = nullptr;
+    IntCounter* pipeline_task_remote_numa_steal_count = nullptr;
 
     IntGauge* runtime_filter_consumer_num = nullptr;
     IntGauge* runtime_filter_consumer_ready_num = nullptr;
@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace doris {
+
+namespace {
+
+// the bytes of the values sampled to build the symbols
+constexpr size_t FSST_SAMPLE_BYTES = 16 * 1024;
+// each generation merges the adjacent symbols of the previous one
+constexpr int FSST_GENERATIONS = 5;
+
+} // namespace
+
+void FsstSymbolTable::build(const Slice* values, size_t count) {
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total_bytes += values[i].size;
+    }
+    size_t step = std::max<size_t>(1, total_bytes / FSST_SAMPLE_BYTES);
+    std::vector<Slice> samples;
+    for (size_t i = 0; i < count; i += step) {
+        samples.push_back(values[i]);
+    }
+
+    _num_symbols = 0;
+    _init_index();
+    std::unordered_map<std::string, size_t> counts;
+    std::vector<std::pair<size_t, std::string>> candidates;
+    for (int generation = 0; generation < FSST_GENERATIONS; ++generation) {
+        counts.clear();
+        for (const auto& sample : samples) {
+            const auto* data = reinterpret_cast<const uint8_t*>(sample.data);
+            std::string_view prev;
+            for (size_t pos = 0; pos < sample.size;) {
+                uint8_t code = _find_code(data + pos, sample.size - pos);
+                size_t len = code == ESCAPE_CODE ? 1 : _lengths[code];
+                std::string_view symbol(sample.data + pos, len);
+                ++counts[std::string(symbol)];
+                if (!prev.empty() && prev.size() + len <= MAX_SYMBOL_LENGTH) {
+                    ++counts[std::string(prev).append(symbol)];
+                }
+                prev = symbol;
+                pos += len;
+            }
+        }
+
+        // the gain of a symbol is the bytes it covers
+        candidates.clear();
+        for (auto& [symbol, symbol_count] : counts) {
+            candidates.emplace_back(symbol_count * symbol.size(), symbol);
+        }
+        size_t num_symbols = std::min(MAX_SYMBOLS, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + num_symbols, candidates.end(),
+                          [](const auto& a, const auto& b) {
+                              return a.first != b.first ? a.first > b.first : a.second < b.second;
+                          });
+        _num_symbols = num_symbols;
+        for (size_t code = 0; code < num_symbols; ++code) {
+            const auto& symbol = candidates[code].second;
+            _symbols[code] = 0;
+            memcpy(&_symbols[code], symbol.data(), symbol.size());
+            _lengths[code] = static_cast<uint8_t>(symbol.size());
+        }
+        _init_index();
+    }
+}
+
+void FsstSymbolTable::serialize(faststring* buffer) const {
+    buffer->push_back(static_cast<char>(_num_symbols));
+    buffer->append(_lengths, _num_symbols);
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        buffer->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+size_t FsstSymbolTable::deserialize(const uint8_t* data, size_t len) {
+    if (len < 1 || len < 1 + data[0]) {
+        return 0;
+    }
+    size_t num_symbols = data[0];
+    size_t offset = 1 + num_symbols;
+    for (size_t code = 0; code < num_symbols; ++code) {
+        uint8_t length = data[1 + code];
+        if (length == 0 || length > MAX_SYMBOL_LENGTH || offset + length > len) {
+            return 0;
+        }
+        _symbols[code] = 0;
+        memcpy(&_symbols[code], data + offset, length);
+        _lengths[code] = length;
+        offset += length;
+    }
+    _num_symbols = num_symbols;
+    _init_index();
+    return offset;
+}
+
+void FsstSymbolTable::encode(const Slice& value, faststring* buffer) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+    for (size_t pos = 0; pos < value.size;) {
+        uint8_t code = _find_code(data + pos, value.size - pos);
+        buffer->push_back(static_cast<char>(code));
+        if (code == ESCAPE_CODE) {
+            buffer->push_back(static_cast<char>(data[pos]));
+            ++pos;
+        } else {
+            pos += _lengths[code];
+        }
+    }
+}
+
+bool FsstSymbolTable::decode(const uint8_t* codes, size_t len, uint8_t* output,
+                             size_t* output_len) const {
+    uint8_t* out = output;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t code = codes[i];
+        if (code == ESCAPE_CODE) [[unlikely]] {
+            if (++i == len) {
+                return false;
+            }
+            *out++ = codes[i];
+        } else {
+            // the codes are from a table of _num_symbols symbols, the others are decoded as empty
+            memcpy(out, &_symbols[code], sizeof(uint64_t));
+            out += _lengths[code];
+        }
+    }
+    *output_len = out - output;
+    return true;
+}
+
+void FsstSymbolTable::_init_index() {
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+    for (size_t code = _num_symbols; code < MAX_SYMBOLS; ++code) {
+        _symbols[code] = 0;
+        _lengths[code] = 0;
+    }
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        uint8_t first_byte;
+        memcpy(&first_byte, &_symbols[code], 1);
+        _codes_by_first_byte[first_byte].push_back(static_cast<uint8_t>(code));
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        std::stable_sort(codes.begin(), codes.end(),
+                         [this](uint8_t a, uint8_t b) { return _lengths[a] > _lengths[b]; });
+    }
+}
+
+uint8_t FsstSymbolTable::_find_code(const uint8_t* data, size_t len) const {
+    for (uint8_t code : _codes_by_first_byte[data[0]]) {
+        if (_lengths[code] <= len && memcmp(&_symbols[code], data, _lengths[code]) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+} // namespace doris
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace doris {
+
+// The symbol table of FSST (Fast Static Symbol Table) coding, please refer to
+// https://www.vldb.org/pvldb/vol13/p2649-boncz.pdf
+//
+// A string is encoded as a sequence of 1 byte codes, each code stands for a symbol of up to 8
+// bytes, and a byte that is not covered by any symbol is escaped by ESCAPE_CODE. The strings are
+// encoded independently, so any of them can be decoded without the others. The encoding of a
+// string is deterministic, two strings are equal iff their codes are equal.
+//
+// The serialized format is as follows:
+//
+//       8 bit SymbolNum
+//       8 bit SymbolLength * SymbolNum
+//      Bytes of the symbols
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+
+    // Builds the symbols from a sample of `values`.
+    void build(const Slice* values, size_t count);
+
+    void serialize(faststring* buffer) const;
+
+    // Returns the bytes of the serialized table, 0 if the data is broken.
+    size_t deserialize(const uint8_t* data, size_t len);
+
+    // Appends the codes of `value` to `buffer`.
+    void encode(const Slice& value, faststring* buffer) const;
+
+    // The decoded bytes of `len` codes are at most `len * MAX_SYMBOL_LENGTH`, which `output`
+    // must have room for. Returns false if the codes end with a dangling escape code.
+    bool decode(const uint8_t* codes, size_t len, uint8_t* output, size_t* output_len) const;
+
+    size_t num_symbols() const { return _num_symbols; }
+
+private:
+    void _init_index();
+
+    // the code of the longest symbol at the start of `data`, or ESCAPE_CODE
+    uint8_t _find_code(const uint8_t* data, size_t len) const;
+
+    size_t _num_symbols = 0;
+    // the symbols are padded by 0 to 8 bytes, so a symbol is decoded by one 8 bytes store
+    uint64_t _symbols[MAX_SYMBOLS] {};
+    uint8_t _lengths[MAX_SYMBOLS] {};
+    // the codes of the symbols starting with each byte, the longest first
+    std::vector<uint8_t> _codes_by_first_byte[256];
+};
+
+} // namespace doris
@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/lock_contention.h"
+
+#include <fmt/format.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/symbol_index.h"
+#include "vec/common/demangle.h"
+
+namespace doris {
+
+namespace {
+
+// The call sites kept of each site, the later ones are dropped.
+constexpr size_t MAX_CALL_SITES = 256;
+
+struct SiteRegistry {
+    std::mutex lock;
+    std::vector<LockContentionSite*> sites;
+};
+
+SiteRegistry* site_registry() {
+    static auto* registry = new SiteRegistry();
+    return registry;
+}
+
+} // namespace
+
+LockContentionSite::LockContentionSite(std::string name)
+        : _name(std::move(name)),
+          _contended("lock_contention", _name + "_contended"),
+          _wait_us("lock_contention", _name + "_wait_us") {
+    auto* registry = site_registry();
+    std::lock_guard l(registry->lock);
+    registry->sites.push_back(this);
+}
+
+bool LockContentionSite::_should_sample() {
+    int32_t interval = config::lock_contention_sample_interval;
+    if (interval <= 0) {
+        return false;
+    }
+    static thread_local uint32_t waits = 0;
+    return ++waits % static_cast<uint32_t>(interval) == 0;
+}
+
+void LockContentionSite::_record(int64_t wait_us, const void* waiter, const void* holder) {
+    _wait_us << wait_us;
+    std::lock_guard l(_lock);
+    _sampled_wait_us += wait_us;
+    auto add = [wait_us](std::unordered_map<const void*, CallSiteStats>& call_sites,
+                         const void* call_site) {
+        auto it = call_sites.find(call_site);
+        if (it == call_sites.end()) {
+            if (call_sites.size() >= MAX_CALL_SITES) {
+                return;
+            }
+            it = call_sites.emplace(call_site, CallSiteStats()).first;
+        }
+        it->second.waits++;
+        it->second.wait_us += wait_us;
+    };
+    add(_waiters, waiter);
+    if (holder != nullptr) {
+        add(_holders, holder);
+    }
+}
+
+int64_t LockContentionSite::sampled_wait_us() const {
+    std::lock_guard l(_lock);
+    return _sampled_wait_us;
+}
+
+std::string LockContentionSite::report(size_t top_n) {
+    std::vector<LockContentionSite*> sites;
+    {
+        auto* registry = site_registry();
+        std::lock_guard l(registry->lock);
+        sites = registry->sites;
+    }
+    std::sort(sites.begin(), sites.end(), [](const auto* a, const auto* b) {
+        return a->_contended.get_value() > b->_contended.get_value();
+    });
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+#endif
+    auto write_call_sites = [&](rapidjson::Writer<rapidjson::StringBuffer>& writer,
+                                const std::unordered_map<const void*, CallSiteStats>& stats) {
+        std::vector<std::pair<const void*, CallSiteStats>> call_sites(stats.begin(), stats.end());
+        std::sort(call_sites.begin(), call_sites.end(), [](const auto& a, const auto& b) {
+            return a.second.wait_us > b.second.wait_us;
+        });
+        if (call_sites.size() > top_n) {
+            call_sites.resize(top_n);
+        }
+        writer.StartArray();
+        for (const auto& [address, call_site] : call_sites) {
+            std::string name = fmt::format("{}", address);
+#if defined(__ELF__) && !defined(__FreeBSD__)
+            if (const auto* symbol = symbol_index->findSymbol(address)) {
+                name = fmt::format("{}+{:#x}", demangle(symbol->name),
+                                   reinterpret_cast<uintptr_t>(address) -
+                                           reinterpret_cast<uintptr_t>(symbol->address_begin));
+            }
+#endif
+            writer.StartObject();
+            writer.Key("call_site");
+            writer.String(name.c_str());
+            writer.Key("sampled_waits");
+            writer.Int64(call_site.waits);
+            writer.Key("sampled_wait_us");
+            writer.Int64(call_site.wait_us);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    };
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("sample_interval");
+    writer.Int(config::lock_contention_sample_interval);
+    writer.Key("locks");
+    writer.StartArray();
+    for (auto* site : sites) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(site->_name.c_str());
+        writer.Key("contended");
+        writer.Int64(site->_contended.get_value());
+        writer.Key("wait_us_p50");
+        writer.Int64(site->_wait_us.latency_percentile(0.5));
+        writer.Key("wait_us_p99");
+        writer.Int64(site->_wait_us.latency_percentile(0.99));
+        writer.Key("wait_us_max");
+        writer.Int64(site->_wait_us.max_latency());
+        std::lock_guard l(site->_lock);
+        writer.Key("sampled_wait_us");
+        writer.Int64(site->_sampled_wait_us);
+        writer.Key("waiters");
+        write_call_sites(writer, site->_waiters);
+        writer.Key("holders");
+        write_call_sites(writer, site->_holders);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+} // namespace doris
@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <bvar/bvar.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace doris {
+
+// The contention stats of a kind of lock, e.g. the shard locks of all the LRU caches. A lock is
+// first tried without blocking, only when it's held by another thread every
+// lock_contention_sample_interval-th wait is timed, and recorded with the call site of the waiter
+// and the one of the holder (the last one which acquired the lock exclusively), so the locks not
+// contended cost just a try_lock and a store.
+//
+// The sites are global objects, which live as long as the process, see api/lock_contention.
+class LockContentionSite {
+public:
+    explicit LockContentionSite(std::string name);
+
+    const std::string& name() const { return _name; }
+
+    template <typename Mutex>
+    void lock(Mutex& mutex, const void* waiter, std::atomic<const void*>* holder) {
+        if (!mutex.try_lock()) {
+            _wait(
+                    mutex, [](Mutex& m) { m.lock(); }, waiter,
+                    holder == nullptr ? nullptr : holder->load(std::memory_order_relaxed));
+        }
+        if (holder != nullptr) {
+            holder->store(waiter, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Mutex>
+    void lock_shared(Mutex& mutex, const void* waiter, std::atomic<const void*>* holder) {
+        if (!mutex.try_lock_shared()) {
+            _wait(
+                    mutex, [](Mutex& m) { m.lock_shared(); }, waiter,
+                    holder == nullptr ? nullptr : holder->load(std::memory_order_relaxed));
+        }
+    }
+
+    // The json of all the sites by the contended times, with the top `top_n` call sites of each site
+    // by the wait time.
+    static std::string report(size_t top_n);
+
+    // For test.
+    int64_t contended() const { return _contended.get_value(); }
+    int64_t sampled_wait_us() const;
+
+private:
+    struct CallSiteStats {
+        int64_t waits = 0;
+        int64_t wait_us = 0;
+    };
+
+    static bool _should_sample();
+
+    template <typename Mutex, typename LockFn>
+    void _wait(Mutex& mutex, LockFn lock_fn, const void* waiter, const void* holder) {
+        _contended << 1;
+        if (!_should_sample()) {
+            lock_fn(mutex);
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        lock_fn(mutex);
+        auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+        _record(wait_us, waiter, holder);
+    }
+
+    void _record(int64_t wait_us, const void* waiter, const void* holder);
+
+    const std::string _name;
+    bvar::Adder<int64_t> _contended;
+    bvar::LatencyRecorder _wait_us;
+
+    // only touched by the sampled waits
+    mutable std::mutex _lock;
+    int64_t _sampled_wait_us = 0;
+    std::unordered_map<const void*, CallSiteStats> _waiters;
+    std::unordered_map<const void*, CallSiteStats> _holders;
+};
+
+// A mutex whose contention is recorded in a LockContentionSite, satisfies Lockable (and
+// SharedLockable for std::shared_mutex), so it's used with std::lock_guard, std::unique_lock and
+// std::shared_lock as the wrapped mutex. Without a site it's just the wrapped mutex.
+template <typename Mutex>
+class ProfiledMutex {
+public:
+    ProfiledMutex() = default;
+    explicit ProfiledMutex(LockContentionSite* site) : _site(site) {}
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    // For the arrays of locks, must be called before the lock is used.
+    void set_contention_site(LockContentionSite* site) { _site = site; }
+
+    // Not inlined, so the return address is the call site in the function taking the lock.
+    __attribute__((noinline)) void lock() {
+        const void* caller = __builtin_return_address(0);
+        if (_site == nullptr) {
+            _mutex.lock();
+            return;
+        }
+        _site->lock(_mutex, caller, &_holder);
+    }
+
+    bool try_lock() {
+        if (!_mutex.try_lock()) {
+            return false;
+        }
+        _holder.store(__builtin_return_address(0), std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() {
+        if constexpr (std::is_same_v<Mutex, std::shared_mutex>) {
+            // the shared holders are not tracked, so an idle exclusive holder is not blamed
+            _holder.store(nullptr, std::memory_order_relaxed);
+        }
+        _mutex.unlock();
+    }
+
+    __attribute__((noinline)) void lock_shared() {
+        const void* caller = __builtin_return_address(0);
+        if (_site == nullptr) {
+            _mutex.lock_shared();
+            return;
+        }
+        _site->lock_shared(_mutex, caller, &_holder);
+    }
+
+    bool try_lock_shared() { return _mutex.try_lock_shared(); }
+
+    void unlock_shared() { _mutex.unlock_shared(); }
+
+private:
+    Mutex _mutex;
+    LockContentionSite* _site = nullptr;
+    std::atomic<const void*> _holder = nullptr;
+};
+
+using ProfiledSharedMutex = ProfiledMutex<std::shared_mutex>;
+
+// Lock a plain mutex, whose lock type can't be changed, with its contention recorded in `site`.
+// `holder` is the call site of the last one which locked the mutex by this, could be nullptr.
+// Not inlined, so the return address is the call site in the function taking the lock.
+template <typename Mutex>
+__attribute__((noinline)) void profiled_lock(Mutex& mutex, LockContentionSite* site,
+                                             std::atomic<const void*>* holder) {
+    site->lock(mutex, __builtin_return_address(0), holder);
+}
+
+} // namespace doris
@@ -599,4 +599,89 @@ void PerfCounters::get_proc_status(ProcStatus* out) {
     out->vm_hwm = parse_bytes("status/VmHWM");
 }
 
+namespace {
+
+struct ThreadCounterGroup {
+    ThreadCounterGroup() {
+        for (int i = 0; i < ThreadHardwareCounters::NUM_COUNTERS; ++i) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(perf_event_attr));
+            switch (i) {
+            case ThreadHardwareCounters::CPU_CYCLES:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case ThreadHardwareCounters::INSTRUCTIONS:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case ThreadHardwareCounters::LLC_MISSES:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case ThreadHardwareCounters::DTLB_MISSES:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            default:
+                break;
+            }
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            // 0 and -1: the calling thread on any cpu
+            int fd = sys_perf_event_open(&attr, 0, -1, group_fd, 0);
+            if (fd < 0) {
+                if (i == ThreadHardwareCounters::CPU_CYCLES) {
+                    // no hardware counter at all without the cycles
+                    return;
+                }
+                continue;
+            }
+            if (group_fd < 0) {
+                group_fd = fd;
+            } else {
+                member_fds.push_back(fd);
+            }
+            indexes.push_back(i);
+        }
+    }
+
+    ~ThreadCounterGroup() {
+        for (int fd : member_fds) {
+            close(fd);
+        }
+        if (group_fd >= 0) {
+            close(group_fd);
+        }
+    }
+
+    int group_fd = -1;
+    std::vector<int> member_fds;
+    // the counter of each value read from the group
+    std::vector<int> indexes;
+};
+
+} // namespace
+
+bool ThreadHardwareCounters::read(Values* values) {
+    static thread_local ThreadCounterGroup group;
+    if (group.group_fd < 0) {
+        return false;
+    }
+    // read_format of PERF_FORMAT_GROUP: nr, value[nr]
+    uint64_t buffer[NUM_COUNTERS + 1];
+    auto bytes = (group.indexes.size() + 1) * sizeof(uint64_t);
+    if (::read(group.group_fd, buffer, bytes) != static_cast<ssize_t>(bytes)) {
+        return false;
+    }
+    values->fill(0);
+    for (size_t i = 0; i < group.indexes.size() && i < buffer[0]; ++i) {
+        (*values)[group.indexes[i]] = static_cast<int64_t>(buffer[i + 1]);
+    }
+    return true;
+}
+
 } // namespace doris
@@ -23,6 +23,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <stdint.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -173,4 +174,23 @@ private:
     static int64_t _vm_peak;
 };
 
+// The hardware counters of the calling thread. They are opened as one counter group on the first
+// read of each thread, and one read() returns all of them, so the delta of two reads breaks down
+// the cpu time of the code in between, e.g. one execution slice of a pipeline task.
+class ThreadHardwareCounters {
+public:
+    enum Counter {
+        CPU_CYCLES,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        DTLB_MISSES,
+        NUM_COUNTERS,
+    };
+    using Values = std::array<int64_t, NUM_COUNTERS>;
+
+    // Return false if the counters are not available to this thread, e.g. forbidden by
+    // perf_event_paranoid or no PMU in a VM. A counter unsupported by the cpu is read as 0.
+    static bool read(Values* values);
+};
+
 } // namespace doris
@@ -0,0 +1,287 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/query_cpu_profiler.h"
+
+#include <fmt/format.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "common/stack_trace.h"
+#include "common/symbol_index.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+#include "vec/common/demangle.h"
+
+namespace doris {
+
+namespace {
+
+// written by the thread itself, read by the signal handler interrupting the thread
+thread_local QueryCpuProfiler::ThreadTag thread_tag;
+
+int sample_signal() {
+    // the realtime signals are not used by others, unlike SIGPROF of gperftools
+    return SIGRTMIN + 2;
+}
+
+} // namespace
+
+QueryCpuProfiler::ScopedQueryTag::ScopedQueryTag(const TUniqueId& query_id) : _saved(thread_tag) {
+    thread_tag.query_id_hi = query_id.hi;
+    thread_tag.query_id_lo = query_id.lo;
+    thread_tag.node_id = -1;
+}
+
+QueryCpuProfiler::ScopedQueryTag::~ScopedQueryTag() {
+    thread_tag = _saved;
+}
+
+QueryCpuProfiler::ScopedNodeTag::ScopedNodeTag(int32_t node_id) : _saved(thread_tag.node_id) {
+    thread_tag.node_id = node_id;
+}
+
+QueryCpuProfiler::ScopedNodeTag::~ScopedNodeTag() {
+    thread_tag.node_id = _saved;
+}
+
+QueryCpuProfiler* QueryCpuProfiler::instance() {
+    static QueryCpuProfiler profiler;
+    return &profiler;
+}
+
+void QueryCpuProfiler::start() {
+    if (!config::enable_query_cpu_profiler || config::query_cpu_profiler_frequency <= 0 ||
+        _started) {
+        return;
+    }
+    struct sigaction sa {};
+    sa.sa_sigaction = _signal_handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(sample_signal(), &sa, nullptr) != 0) {
+        LOG(WARNING) << "failed to set the signal handler of query cpu profiler, errno=" << errno;
+        return;
+    }
+
+    struct sigevent sev {};
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo = sample_signal();
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &sev, &_timer) != 0) {
+        LOG(WARNING) << "failed to create the timer of query cpu profiler, errno=" << errno;
+        return;
+    }
+    int64_t interval_ns = NANOS_PER_SEC / config::query_cpu_profiler_frequency;
+    struct itimerspec its {};
+    its.it_interval.tv_sec = interval_ns / NANOS_PER_SEC;
+    its.it_interval.tv_nsec = interval_ns % NANOS_PER_SEC;
+    its.it_value = its.it_interval;
+    if (timer_settime(_timer, 0, &its, nullptr) != 0) {
+        LOG(WARNING) << "failed to start the timer of query cpu profiler, errno=" << errno;
+        timer_delete(_timer);
+        return;
+    }
+    _started = true;
+    _thread = std::thread(&QueryCpuProfiler::_collect_thread, this);
+    pthread_setname_np(_thread.native_handle(), "query_cpu_prof");
+    LOG(INFO) << "query cpu profiler started, frequency=" << config::query_cpu_profiler_frequency;
+}
+
+void QueryCpuProfiler::stop() {
+    if (!_started) {
+        return;
+    }
+    timer_delete(_timer);
+    {
+        std::lock_guard l(_stop_lock);
+        _stopped = true;
+    }
+    _stop_cv.notify_all();
+    _thread.join();
+    _started = false;
+}
+
+void QueryCpuProfiler::_signal_handler(int sig, siginfo_t* info, void* context) {
+    int saved_errno = errno;
+    auto* profiler = instance();
+    uint64_t index = profiler->_next_sample.fetch_add(1, std::memory_order_relaxed) % RING_SIZE;
+    auto& sample = profiler->_samples[index];
+    if (sample.ready.load(std::memory_order_acquire)) {
+        // not collected yet
+        profiler->_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        sample.tag = thread_tag;
+        sample.pc = getCallerAddress(*reinterpret_cast<const ucontext_t*>(context));
+        sample.ready.store(true, std::memory_order_release);
+    }
+    errno = saved_errno;
+}
+
+void QueryCpuProfiler::_collect_thread() {
+    while (true) {
+        {
+            std::unique_lock l(_stop_lock);
+            if (_stop_cv.wait_for(l, std::chrono::seconds(1), [this] { return _stopped; })) {
+                break;
+            }
+        }
+        _collect();
+    }
+}
+
+void QueryCpuProfiler::_collect() {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+#endif
+    int64_t minute = MonotonicSeconds() / 60;
+    std::lock_guard l(_lock);
+    if (_buckets.empty() || _buckets.back().minute != minute) {
+        _buckets.emplace_back().minute = minute;
+    }
+    while (_buckets.size() > 1 &&
+           _buckets.front().minute <= minute - config::query_cpu_profiler_window_minutes) {
+        _buckets.pop_front();
+    }
+    auto& bucket = _buckets.back();
+    for (auto& sample : _samples) {
+        if (!sample.ready.load(std::memory_order_acquire)) {
+            continue;
+        }
+        ThreadTag tag = sample.tag;
+        const void* function = sample.pc;
+        sample.ready.store(false, std::memory_order_release);
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+        if (const auto* symbol = symbol_index->findSymbol(function)) {
+            function = symbol->address_begin;
+        }
+#endif
+        TUniqueId query_id;
+        query_id.__set_hi(tag.query_id_hi);
+        query_id.__set_lo(tag.query_id_lo);
+        auto& query = bucket.queries[query_id];
+        query.samples++;
+        query.node_samples[tag.node_id]++;
+        query.function_samples[function]++;
+    }
+}
+
+std::string QueryCpuProfiler::report(const TUniqueId* query_id, size_t top_n) {
+    std::unordered_map<TUniqueId, QueryProfile> queries;
+    {
+        std::lock_guard l(_lock);
+        for (const auto& bucket : _buckets) {
+            for (const auto& [id, profile] : bucket.queries) {
+                if (query_id != nullptr && id != *query_id) {
+                    continue;
+                }
+                auto& query = queries[id];
+                query.samples += profile.samples;
+                for (const auto& [node_id, samples] : profile.node_samples) {
+                    query.node_samples[node_id] += samples;
+                }
+                for (const auto& [function, samples] : profile.function_samples) {
+                    query.function_samples[function] += samples;
+                }
+            }
+        }
+    }
+    std::vector<std::pair<TUniqueId, QueryProfile*>> sorted_queries;
+    for (auto& [id, profile] : queries) {
+        sorted_queries.emplace_back(id, &profile);
+    }
+    std::sort(sorted_queries.begin(), sorted_queries.end(),
+              [](const auto& a, const auto& b) { return a.second->samples > b.second->samples; });
+    if (sorted_queries.size() > top_n) {
+        sorted_queries.resize(top_n);
+    }
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+#endif
+    const int64_t interval_us = config::query_cpu_profiler_frequency > 0
+                                        ? 1000000 / config::query_cpu_profiler_frequency
+                                        : 0;
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("window_minutes");
+    writer.Int(config::query_cpu_profiler_window_minutes);
+    writer.Key("dropped_samples");
+    writer.Int64(_dropped_samples.load(std::memory_order_relaxed));
+    writer.Key("queries");
+    writer.StartArray();
+    for (const auto& [id, profile] : sorted_queries) {
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(print_id(id).c_str());
+        writer.Key("samples");
+        writer.Int64(profile->samples);
+        writer.Key("cpu_time_ms");
+        writer.Int64(profile->samples * interval_us / 1000);
+        writer.Key("nodes");
+        writer.StartArray();
+        for (const auto& [node_id, samples] : profile->node_samples) {
+            writer.StartObject();
+            writer.Key("node_id");
+            writer.Int(node_id);
+            writer.Key("samples");
+            writer.Int64(samples);
+            writer.EndObject();
+        }
+        writer.EndArray();
+
+        std::vector<std::pair<const void*, int64_t>> functions(profile->function_samples.begin(),
+                                                               profile->function_samples.end());
+        std::sort(functions.begin(), functions.end(),
+                  [](const auto& a, const auto& b) { return a.second > b.second; });
+        if (functions.size() > top_n) {
+            functions.resize(top_n);
+        }
+        writer.Key("functions");
+        writer.StartArray();
+        for (const auto& [function, samples] : functions) {
+            std::string name = fmt::format("{}", function);
+#if defined(__ELF__) && !defined(__FreeBSD__)
+            if (const auto* symbol = symbol_index->findSymbol(function)) {
+                name = demangle(symbol->name);
+            }
+#endif
+            writer.StartObject();
+            writer.Key("function");
+            writer.String(name.c_str());
+            writer.Key("samples");
+            writer.Int64(samples);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+} // namespace doris
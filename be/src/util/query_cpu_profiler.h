@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <signal.h>
+#include <time.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "util/hash_util.hpp" // IWYU pragma: keep
+
+namespace doris {
+
+// A continuous sampling profiler of the cpu time of the process, whose samples are tagged with the
+// query and the plan node running on the thread, so the queries which burned cpu in the last
+// minutes, and the functions they burned it in, are known without reproducing the issue.
+//
+// A timer of the process cpu time sends a signal at config::query_cpu_profiler_frequency per cpu
+// second, which is delivered to the running thread. The signal handler only takes the interrupted
+// pc and the tag of the thread into a preallocated ring, which is signal safe, and a background
+// thread symbolizes and aggregates the samples into buckets of one minute. The buckets older than
+// config::query_cpu_profiler_window_minutes are dropped.
+//
+// The sampled functions are the innermost ones (self time), the stacks are not unwound in the
+// signal handler since the PHDR cache is not enabled.
+class QueryCpuProfiler {
+public:
+    // The tag of the thread, written by the thread itself and read by the signal handler.
+    struct ThreadTag {
+        int64_t query_id_hi = 0;
+        int64_t query_id_lo = 0;
+        int32_t node_id = -1;
+    };
+
+    // Tag the samples of this thread with the query in the scope.
+    class ScopedQueryTag {
+    public:
+        explicit ScopedQueryTag(const TUniqueId& query_id);
+        ~ScopedQueryTag();
+
+    private:
+        ThreadTag _saved;
+    };
+
+    // Tag the samples of this thread with the plan node in the scope.
+    class ScopedNodeTag {
+    public:
+        explicit ScopedNodeTag(int32_t node_id);
+        ~ScopedNodeTag();
+
+    private:
+        int32_t _saved;
+    };
+
+    static QueryCpuProfiler* instance();
+
+    // Start the sampling if config::enable_query_cpu_profiler.
+    void start();
+    void stop();
+
+    // The samples of the window in json, sorted by the samples of the queries, the samples of no
+    // query are under the query id 0-0. Only the top `top_n` queries and the top `top_n`
+    // functions of each of them, or only `query_id` if it's not nullptr.
+    std::string report(const TUniqueId* query_id, size_t top_n);
+
+private:
+    static constexpr size_t RING_SIZE = 4096;
+
+    struct Sample {
+        std::atomic<bool> ready {false};
+        ThreadTag tag;
+        const void* pc = nullptr;
+    };
+
+    struct QueryProfile {
+        int64_t samples = 0;
+        std::unordered_map<int32_t, int64_t> node_samples;
+        // by the start address of the function, or the pc if it's not found
+        std::unordered_map<const void*, int64_t> function_samples;
+    };
+
+    struct Bucket {
+        int64_t minute = 0;
+        std::unordered_map<TUniqueId, QueryProfile> queries;
+    };
+
+    static void _signal_handler(int sig, siginfo_t* info, void* context);
+
+    void _collect_thread();
+    void _collect();
+
+    std::array<Sample, RING_SIZE> _samples;
+    std::atomic<uint64_t> _next_sample {0};
+    std::atomic<int64_t> _dropped_samples {0};
+
+    bool _started = false;
+    timer_t _timer;
+    std::thread _thread;
+    std::mutex _stop_lock;
+    std::condition_variable _stop_cv;
+    bool _stopped = false;
+
+    // protect _buckets
+    std::mutex _lock;
+    std::deque<Bucket> _buckets;
+};
+
+} // namespace doris
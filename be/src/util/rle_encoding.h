@@ -19,6 +19,7 @@
 #include <glog/logging.h>
 
 #include <limits> // IWYU pragma: keep
+#include <type_traits>
 
 #include "util/bit_stream_utils.inline.h"
 #include "util/bit_util.h"
@@ -359,6 +360,28 @@ size_t RleDecoder<T>::get_values(T* values, size_t num_values) {
             read_num += read_this_time;
         } else if (literal_count_ > 0) {
             read_this_time = std::min((size_t)literal_count_, read_this_time);
+            if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                          sizeof(T) <= sizeof(uint32_t)) {
+                // A literal run starts on a byte boundary, unpack the values in batches and
+                // leave the ones which don't end on a byte boundary to the loop below.
+                size_t num_batched = read_this_time / 8 * 8;
+                if (num_batched > 0 && bit_reader_.position() % 8 == 0) {
+                    int byte_offset = bit_reader_.position() / 8;
+                    int64_t num_unpacked =
+                            BitPacking::UnpackValues(
+                                    bit_width_, bit_reader_.buffer() + byte_offset,
+                                    bit_reader_.max_bytes() - byte_offset, num_batched,
+                                    reinterpret_cast<std::make_unsigned_t<T>*>(values))
+                                    .second;
+                    DCHECK_EQ(num_unpacked, num_batched);
+                    bool result = bit_reader_.Advance(num_unpacked * bit_width_);
+                    DCHECK(result);
+                    values += num_unpacked;
+                    literal_count_ -= num_unpacked;
+                    read_num += num_unpacked;
+                    read_this_time -= num_unpacked;
+                }
+            }
             for (int i = 0; i < read_this_time; ++i) {
                 bool result = bit_reader_.GetValue(bit_width_, values);
                 DCHECK(result);
@@ -98,6 +98,40 @@ inline auto bytes_mask_to_bits_mask(const uint8_t* data) {
 #endif
 }
 
+// The mask of the bytes equal to `c` in the bits_mask_length() bytes at `data`, in the layout of
+// bytes_mask_to_bits_mask().
+inline auto bytes_equal_to_bits_mask(const uint8_t* data, uint8_t c) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return get_nibble_mask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(c)));
+#elif defined(__AVX2__)
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+                              _mm256_set1_epi8(static_cast<char>(c)))));
+#elif defined(__SSE2__)
+    auto c16 = _mm_set1_epi8(static_cast<char>(c));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), c16))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), c16)))
+            << 16);
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 32; ++i) {
+        mask |= static_cast<uint32_t>(c == *(data + i)) << i;
+    }
+    return mask;
+#endif
+}
+
+// The index of the first byte set in a non-zero mask of bytes_mask_to_bits_mask().
+inline std::size_t first_index_of_bits_mask(decltype(bytes_mask_to_bits_mask(nullptr)) mask) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return __builtin_ctzll(mask) >> 2;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
 inline constexpr auto bits_mask_all() {
 #if defined(__ARM_NEON) && defined(__aarch64__)
     return 0xffff'ffff'ffff'ffffULL;
@@ -50,6 +50,8 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(thread_pool_task_execution_count_total, Met
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(thread_pool_task_wait_worker_time_ns_total,
                                      MetricUnit::NANOSECONDS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(thread_pool_task_wait_worker_count_total, MetricUnit::NOUNIT);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(thread_pool_task_wait_worker_time_ns,
+                                       MetricUnit::NANOSECONDS);
 using namespace ErrorCode;
 
 using std::string;
@@ -315,6 +317,7 @@ Status ThreadPool::init() {
     INT_COUNTER_METRIC_REGISTER(_metric_entity, thread_pool_task_wait_worker_time_ns_total);
     INT_COUNTER_METRIC_REGISTER(_metric_entity, thread_pool_task_wait_worker_count_total);
     INT_COUNTER_METRIC_REGISTER(_metric_entity, thread_pool_submit_failed);
+    HISTOGRAM_METRIC_REGISTER(_metric_entity, thread_pool_task_wait_worker_time_ns);
 
     _metric_entity->register_hook("update", [this]() {
         {
@@ -423,6 +426,10 @@ Status ThreadPool::submit_func(std::function<void()> f) {
 Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token) {
     DCHECK(token);
 
+    Task task;
+    task.runnable = std::move(r);
+    task.submit_time_wather.start();
+
     std::unique_lock<std::mutex> l(_lock);
     if (!_pool_status.ok()) [[unlikely]] {
         return _pool_status;
@@ -470,10 +477,6 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
         _num_threads_pending_start++;
     }
 
-    Task task;
-    task.runnable = std::move(r);
-    task.submit_time_wather.start();
-
     // Add the task to the token's queue.
     ThreadPoolToken::State state = token->state();
     DCHECK(state == ThreadPoolToken::State::IDLE || state == ThreadPoolToken::State::RUNNING);
@@ -593,17 +596,12 @@ void ThreadPool::dispatch_thread() {
             continue;
         }
 
-        MonotonicStopWatch task_execution_time_watch;
-        task_execution_time_watch.start();
         // Get the next token and task to execute.
         ThreadPoolToken* token = _queue.front();
         _queue.pop_front();
         DCHECK_EQ(ThreadPoolToken::State::RUNNING, token->state());
         DCHECK(!token->_entries.empty());
         Task task = std::move(token->_entries.front());
-        thread_pool_task_wait_worker_time_ns_total->increment(
-                task.submit_time_wather.elapsed_time());
-        thread_pool_task_wait_worker_count_total->increment(1);
         token->_entries.pop_front();
         token->_active_threads++;
         --_total_queued_tasks;
@@ -611,6 +609,15 @@ void ThreadPool::dispatch_thread() {
 
         l.unlock();
 
+        // The metrics are atomic, update them out of the lock which is shared by all the
+        // submitters and workers of the pool.
+        MonotonicStopWatch task_execution_time_watch;
+        task_execution_time_watch.start();
+        auto wait_worker_time_ns = task.submit_time_wather.elapsed_time();
+        thread_pool_task_wait_worker_time_ns_total->increment(wait_worker_time_ns);
+        thread_pool_task_wait_worker_count_total->increment(1);
+        thread_pool_task_wait_worker_time_ns->add(wait_worker_time_ns);
+
         // Execute the task
         task.runnable->run();
         // Destruct the task while we do not hold the lock.
@@ -620,10 +627,10 @@ void ThreadPool::dispatch_thread() {
         // In the worst case, the destructor might even try to do something
         // with this threadpool, and produce a deadlock.
         task.runnable.reset();
-        l.lock();
         thread_pool_task_execution_time_ns_total->increment(
                 task_execution_time_watch.elapsed_time());
         thread_pool_task_execution_count_total->increment(1);
+        l.lock();
         // Possible states:
         // 1. The token was shut down while we ran its task. Transition to QUIESCED.
         // 2. The token has no more queued tasks. Transition back to IDLE.
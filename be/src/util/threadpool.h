@@ -417,6 +417,8 @@ private:
     IntCounter* thread_pool_task_execution_count_total = nullptr;
     IntCounter* thread_pool_task_wait_worker_time_ns_total = nullptr;
     IntCounter* thread_pool_task_wait_worker_count_total = nullptr;
+    // the distribution of the time the tasks wait in the queue, to size the pool
+    HistogramMetric* thread_pool_task_wait_worker_time_ns = nullptr;
 
     IntCounter* thread_pool_submit_failed = nullptr;
 };
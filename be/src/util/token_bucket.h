@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+
+#include "common/logging.h"
+#include "util/time.h"
+
+namespace doris {
+
+// A token bucket refilled by `rate` tokens per second, holding at most `burst` tokens.
+// The tokens are taken after the work they account for is done, so the bucket may go into
+// debt, and the taker should wait the returned time before doing more work.
+class TokenBucket {
+public:
+    TokenBucket(int64_t rate, int64_t burst)
+            : _rate(rate), _burst(burst), _tokens(burst), _last_refill_ns(MonotonicNanos()) {
+        DCHECK_GT(rate, 0);
+    }
+
+    // Takes `tokens` from the bucket, returns the nanoseconds to wait until it is out of debt.
+    int64_t take(int64_t tokens) { return take(tokens, MonotonicNanos()); }
+
+    int64_t take(int64_t tokens, int64_t now_ns) {
+        std::lock_guard<std::mutex> l(_lock);
+        if (now_ns > _last_refill_ns) {
+            auto refill = static_cast<double>(now_ns - _last_refill_ns) *
+                          static_cast<double>(_rate) / NANOS_PER_SEC;
+            _tokens = std::min(static_cast<double>(_burst), _tokens + refill);
+            _last_refill_ns = now_ns;
+        }
+        _tokens -= static_cast<double>(tokens);
+        if (_tokens >= 0) {
+            return 0;
+        }
+        return static_cast<int64_t>(-_tokens * NANOS_PER_SEC / static_cast<double>(_rate));
+    }
+
+private:
+    const int64_t _rate;
+    const int64_t _burst;
+
+    std::mutex _lock;
+    double _tokens;
+    int64_t _last_refill_ns;
+};
+
+} // namespace doris
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "olap/hll.h"
 #include "util/hash_util.hpp"
@@ -55,6 +56,11 @@ struct AggregateFunctionApproxCountDistinctData {
         }
     }
 
+    // `hash_values` don't contain 0.
+    void add_batch(const uint64_t* hash_values, size_t num) {
+        hll_data.update_batch(hash_values, num);
+    }
+
     void merge(const AggregateFunctionApproxCountDistinctData& rhs) {
         hll_data.merge(rhs.hll_data);
     }
@@ -95,21 +101,23 @@ public:
 
     void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
              Arena&) const override {
-        if constexpr (is_decimal(type) || is_int_or_bool(type) || is_ip(type) ||
-                      is_date_type(type) || is_float_or_double(type) || type == TYPE_TIME ||
-                      type == TYPE_TIMEV2) {
-            auto column =
-                    assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0]);
-            auto value = column->get_element(row_num);
-            this->data(place).add(
-                    HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED));
-        } else {
-            auto value = assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0])
-                                 ->get_data_at(row_num);
-            uint64_t hash_value =
-                    HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
-            this->data(place).add(hash_value);
+        this->data(place).add(_hash(
+                assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0]),
+                row_num));
+    }
+
+    // Hash the whole column first, then update the registers in a tight loop.
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        const auto* column = assert_cast<const ColumnDataType*>(columns[0]);
+        std::vector<uint64_t> hash_values;
+        hash_values.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (uint64_t hash_value = _hash(column, i); hash_value != 0) {
+                hash_values.push_back(hash_value);
+            }
         }
+        this->data(place).add_batch(hash_values.data(), hash_values.size());
     }
 
     void reset(AggregateDataPtr place) const override { this->data(place).reset(); }
@@ -132,6 +140,19 @@ public:
         auto& column = assert_cast<ColumnInt64&>(to);
         column.get_data().push_back(this->data(place).get());
     }
+
+private:
+    static uint64_t _hash(const ColumnDataType* column, size_t row_num) {
+        if constexpr (is_decimal(type) || is_int_or_bool(type) || is_ip(type) ||
+                      is_date_type(type) || is_float_or_double(type) || type == TYPE_TIME ||
+                      type == TYPE_TIMEV2) {
+            auto value = column->get_element(row_num);
+            return HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED);
+        } else {
+            auto value = column->get_data_at(row_num);
+            return HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+        }
+    }
 };
 
 } // namespace doris::vectorized
@@ -137,6 +137,17 @@ struct AggregateFunctionBitmapData {
 
     void merge(const BitmapValue& data) { Op::merge(value, data, is_first); }
 
+    // The union merges the bitmaps of a block at once by fastunion.
+    void merge_batch(std::vector<const BitmapValue*>& data) {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            Op::add_batch(value, data, is_first);
+        } else {
+            for (const auto* bitmap : data) {
+                Op::merge(value, *bitmap, is_first);
+            }
+        }
+    }
+
     void write(BufferWritable& buf) const { DataTypeBitMap::serialize_as_stream(value, buf); }
 
     void read(BufferReadable& buf) { DataTypeBitMap::deserialize_as_stream(value, buf); }
@@ -191,9 +202,11 @@ public:
         const size_t num_rows = column.size();
         auto* data = col.get_data().data();
 
+        std::vector<const BitmapValue*> values(num_rows);
         for (size_t i = 0; i != num_rows; ++i) {
-            this->data(place).merge(data[i]);
+            values[i] = &data[i];
         }
+        this->data(place).merge_batch(values);
     }
 
     void deserialize_and_merge_from_column_range(AggregateDataPtr __restrict place,
@@ -203,9 +216,12 @@ public:
                 << ", begin:" << begin << ", end:" << end << ", column.size():" << column.size();
         auto& col = assert_cast<const ColumnBitmap&>(column);
         auto* data = col.get_data().data();
+        std::vector<const BitmapValue*> values;
+        values.reserve(end - begin + 1);
         for (size_t i = begin; i <= end; ++i) {
-            this->data(place).merge(data[i]);
+            values.push_back(&data[i]);
         }
+        this->data(place).merge_batch(values);
     }
 
     void deserialize_and_merge_vec(const AggregateDataPtr* places, size_t offset,
@@ -287,6 +303,22 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            const auto& column = assert_cast<const ColVecType&>(*columns[0]);
+            std::vector<const BitmapValue*> values(batch_size);
+            for (size_t i = 0; i < batch_size; ++i) {
+                values[i] = &column.get_data()[i];
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, static_cast<ssize_t>(i), arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         this->data(place).merge(
@@ -368,6 +400,32 @@ public:
         }
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        if constexpr (std::is_same_v<ColVecType, ColumnBitmap>) {
+            const ColVecType* column = nullptr;
+            const ColumnNullable* nullable_column = nullptr;
+            if constexpr (arg_is_nullable) {
+                nullable_column = &assert_cast<const ColumnNullable&>(*columns[0]);
+                column = &assert_cast<const ColVecType&>(nullable_column->get_nested_column());
+            } else {
+                column = &assert_cast<const ColVecType&>(*columns[0]);
+            }
+            std::vector<const BitmapValue*> values;
+            values.reserve(batch_size);
+            for (size_t i = 0; i < batch_size; ++i) {
+                if (nullable_column == nullptr || !nullable_column->is_null_at(i)) {
+                    values.push_back(&column->get_data()[i]);
+                }
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                add(place, columns, static_cast<ssize_t>(i), arena);
+            }
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         this->data(place).merge(const_cast<AggFunctionData&>(this->data(rhs)).get());
@@ -27,6 +27,7 @@
 #include <memory>
 #include <vector>
 
+#include "util/simd/bits.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_fixed_length_object.h"
@@ -64,6 +65,17 @@ public:
         ++data(place).count;
     }
 
+    // Count the consecutive rows of the same group at once.
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn**, Arena&, bool) const override {
+        for (size_t begin = 0, end = 0; begin < batch_size; begin = end) {
+            auto* place = places[begin];
+            for (end = begin + 1; end < batch_size && places[end] == place; ++end) {
+            }
+            data(place + place_offset).count += end - begin;
+        }
+    }
+
     void reset(AggregateDataPtr place) const override {
         AggregateFunctionCount::data(place).count = 0;
     }
@@ -191,6 +203,37 @@ public:
             *could_use_previous_result = true;
         }
     }
+
+    bool supported_incremental_mode() const override { return true; }
+
+    void execute_function_with_incremental(int64_t partition_start, int64_t partition_end,
+                                           int64_t frame_start, int64_t frame_end,
+                                           AggregateDataPtr place, const IColumn** columns,
+                                           Arena& arena, bool previous_is_nul, bool end_is_nul,
+                                           bool has_null, UInt8* use_null_result,
+                                           UInt8* could_use_previous_result) const override {
+        int64_t current_frame_start = std::max<int64_t>(frame_start, partition_start);
+        int64_t current_frame_end = std::min<int64_t>(frame_end, partition_end);
+
+        if (current_frame_start >= current_frame_end) {
+            *use_null_result = true;
+            return;
+        }
+        if (*could_use_previous_result) {
+            auto outcoming_pos = frame_start - 1;
+            auto incoming_pos = frame_end - 1;
+            if (outcoming_pos >= partition_start && outcoming_pos < partition_end) {
+                --AggregateFunctionCount::data(place).count;
+            }
+            if (incoming_pos >= partition_start && incoming_pos < partition_end) {
+                ++AggregateFunctionCount::data(place).count;
+            }
+        } else {
+            this->add_range_single_place(partition_start, partition_end, frame_start, frame_end,
+                                         place, columns, arena, use_null_result,
+                                         could_use_previous_result);
+        }
+    }
 };
 
 // TODO: Maybe AggregateFunctionCountNotNullUnary should be a subclass of AggregateFunctionCount
@@ -213,6 +256,22 @@ public:
                          .is_null_at(row_num);
     }
 
+    // Count the not-NULL values of the consecutive rows of the same group at once.
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena&, bool) const override {
+        const auto* null_map =
+                assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0])
+                        .get_null_map_data()
+                        .data();
+        for (size_t begin = 0, end = 0; begin < batch_size; begin = end) {
+            auto* place = places[begin];
+            for (end = begin + 1; end < batch_size && places[end] == place; ++end) {
+            }
+            data(place + place_offset).count += simd::count_zero_num(
+                    reinterpret_cast<const int8_t*>(null_map + begin), end - begin);
+        }
+    }
+
     void reset(AggregateDataPtr place) const override { data(place).count = 0; }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
@@ -359,6 +418,41 @@ public:
             AggregateFunctionCountNotNullUnary::data(place).count += count;
         }
     }
+
+    bool supported_incremental_mode() const override { return true; }
+
+    void execute_function_with_incremental(int64_t partition_start, int64_t partition_end,
+                                           int64_t frame_start, int64_t frame_end,
+                                           AggregateDataPtr place, const IColumn** columns,
+                                           Arena& arena, bool previous_is_nul, bool end_is_nul,
+                                           bool has_null, UInt8* use_null_result,
+                                           UInt8* could_use_previous_result) const override {
+        int64_t current_frame_start = std::max<int64_t>(frame_start, partition_start);
+        int64_t current_frame_end = std::min<int64_t>(frame_end, partition_end);
+
+        if (current_frame_start >= current_frame_end) {
+            *use_null_result = true;
+            return;
+        }
+        if (*could_use_previous_result) {
+            const auto& nullable_column =
+                    assert_cast<const ColumnNullable&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+            auto outcoming_pos = frame_start - 1;
+            auto incoming_pos = frame_end - 1;
+            if (outcoming_pos >= partition_start && outcoming_pos < partition_end &&
+                !nullable_column.is_null_at(outcoming_pos)) {
+                --AggregateFunctionCountNotNullUnary::data(place).count;
+            }
+            if (incoming_pos >= partition_start && incoming_pos < partition_end &&
+                !nullable_column.is_null_at(incoming_pos)) {
+                ++AggregateFunctionCountNotNullUnary::data(place).count;
+            }
+        } else {
+            this->add_range_single_place(partition_start, partition_end, frame_start, frame_end,
+                                         place, columns, arena, use_null_result,
+                                         could_use_previous_result);
+        }
+    }
 };
 
 } // namespace doris::vectorized
@@ -26,6 +26,7 @@
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "util/bitmap_expr_calculation.h"
 #include "util/bitmap_intersect.h"
@@ -353,6 +354,15 @@ struct OrthBitmapUnionCountData {
                 assert_cast<const ColumnBitmap&, TypeCheckOnRelease::DISABLE>(*columns[0]);
         value |= column.get_data()[row_num];
     }
+    // Union the bitmaps of a block at once by fastunion.
+    void add_batch(const IColumn** columns, size_t batch_size) {
+        const auto& column = assert_cast<const ColumnBitmap&>(*columns[0]);
+        std::vector<const BitmapValue*> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = &column.get_data()[i];
+        }
+        value.fastunion(values);
+    }
     void merge(const OrthBitmapUnionCountData& rhs) { result += rhs.result; }
 
     void write(BufferWritable& buf) {
@@ -398,6 +408,16 @@ public:
         this->data(place).add(columns, row_num);
     }
 
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena& arena) const override {
+        if constexpr (requires(Impl& impl) { impl.add_batch(columns, batch_size); }) {
+            this->data(place).add_batch(columns, batch_size);
+        } else {
+            IAggregateFunctionDataHelper<Impl, AggFunctionOrthBitmapFunc<Impl>>::
+                    add_batch_single_place(batch_size, place, columns, arena);
+        }
+    }
+
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena&) const override {
         this->data(place).merge(this->data(rhs));
@@ -555,33 +555,29 @@ void ColumnStr<T>::deserialize_vec_with_null_map(StringRef* keys, const size_t n
     }
 }
 
-template <typename T>
-template <bool positive>
-struct ColumnStr<T>::less {
-    const ColumnStr<T>& parent;
-    explicit less(const ColumnStr<T>& parent_) : parent(parent_) {}
-    bool operator()(size_t lhs, size_t rhs) const {
-        int res = memcmp_small_allow_overflow15(
-                parent.chars.data() + parent.offset_at(lhs), parent.size_at(lhs),
-                parent.chars.data() + parent.offset_at(rhs), parent.size_at(rhs));
-
-        return positive ? (res < 0) : (res > 0);
-    }
-};
-
 template <typename T>
 void ColumnStr<T>::get_permutation(bool reverse, size_t limit, int /*nan_direction_hint*/,
                                    IColumn::Permutation& res) const {
     size_t s = offsets.size();
-    res.resize(s);
+    // the strings are compared by the inlined prefixes first
+    std::vector<PermutationWithInlineValue<TYPE_STRING>> rows(s);
     for (size_t i = 0; i < s; ++i) {
-        res[i] = i;
+        rows[i].set_value(get_data_at(i));
+        rows[i].row_id = static_cast<uint32_t>(i);
     }
 
+    using Row = PermutationWithInlineValue<TYPE_STRING>;
     if (reverse) {
-        pdqsort(res.begin(), res.end(), less<false>(*this));
+        pdqsort(rows.begin(), rows.end(),
+                [](const Row& a, const Row& b) { return Row::compare(a, b) > 0; });
     } else {
-        pdqsort(res.begin(), res.end(), less<true>(*this));
+        pdqsort(rows.begin(), rows.end(),
+                [](const Row& a, const Row& b) { return Row::compare(a, b) < 0; });
+    }
+
+    res.resize(s);
+    for (size_t i = 0; i < s; ++i) {
+        res[i] = rows[i].row_id;
     }
 }
 
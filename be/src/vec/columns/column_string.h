@@ -96,8 +96,6 @@ private:
         return uint32_t(offsets[i] - offsets[i - 1]);
     }
 
-    template <bool positive>
-    struct less;
     template <bool positive>
     struct lessWithCollation;
 
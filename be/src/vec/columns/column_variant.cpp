@@ -1618,6 +1618,10 @@ void ColumnVariant::unnest(Subcolumns::NodePtr& entry, Subcolumns& arg_subcolumn
 
 void ColumnVariant::finalize(FinalizeMode mode) {
     Subcolumns new_subcolumns;
+    // The subcolumns which may be materialized, with their ratios of default values
+    std::vector<std::pair<double, Subcolumns::NodePtr>> materialized_candidates;
+    const bool limit_subcolumns =
+            mode == FinalizeMode::WRITE_MODE && config::variant_max_subcolumns_count > 0;
     // finalize root first
     if (mode == FinalizeMode::WRITE_MODE || !is_null_root()) {
         new_subcolumns.create_root(subcolumns.get_root()->data);
@@ -1652,8 +1656,42 @@ void ColumnVariant::finalize(FinalizeMode mode) {
             continue;
         }
 
+        if (limit_subcolumns && !entry->path.has_nested_part()) {
+            materialized_candidates.emplace_back(
+                    entry->data.get_finalized_column().get_ratio_of_default_rows(), entry);
+            continue;
+        }
+
         new_subcolumns.add(entry->path, entry->data);
     }
+    if (!materialized_candidates.empty()) {
+        // Only the hottest paths are materialized, the others are encoded into the root as
+        // sparse columns, so a flush of many sparse keys doesn't add as many columns to the schema.
+        std::vector<double> ratios;
+        ratios.reserve(materialized_candidates.size());
+        for (const auto& [ratio, _] : materialized_candidates) {
+            ratios.push_back(ratio);
+        }
+        size_t max_count = config::variant_max_subcolumns_count;
+        double max_ratio = std::numeric_limits<double>::max();
+        if (ratios.size() > max_count) {
+            std::nth_element(ratios.begin(), ratios.begin() + max_count - 1, ratios.end());
+            max_ratio = ratios[max_count - 1];
+        }
+        // the paths of the same ratio as the last one are cut in their order to keep max_count
+        size_t num_ties = max_count - std::count_if(ratios.begin(), ratios.end(),
+                                                    [&](double r) { return r < max_ratio; });
+        for (auto& [ratio, entry] : materialized_candidates) {
+            if (ratio < max_ratio) {
+                new_subcolumns.add(entry->path, entry->data);
+            } else if (ratio == max_ratio && num_ties > 0) {
+                --num_ties;
+                new_subcolumns.add(entry->path, entry->data);
+            } else {
+                sparse_columns.add(entry->path, entry->data);
+            }
+        }
+    }
     std::swap(subcolumns, new_subcolumns);
     doc_structure = nullptr;
     _prev_positions.clear();
@@ -20,6 +20,7 @@
 #include <glog/logging.h>
 
 #include <atomic>
+#include <bit>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
@@ -45,6 +46,85 @@ namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+namespace {
+
+constexpr size_t THREAD_CACHE_MIN_BUFFER_BYTES = 4096;
+constexpr int THREAD_CACHE_SIZE_CLASSES = 64;
+constexpr int THREAD_CACHE_BUFFERS_PER_CLASS = 16;
+
+// The buffers are kept in fixed arrays, the cache must not allocate memory itself while freeing.
+struct ThreadCache {
+    ~ThreadCache() {
+        destroyed = true;
+        for (int i = 0; i < THREAD_CACHE_SIZE_CLASSES; ++i) {
+            for (int j = 0; j < counts[i]; ++j) {
+                std::free(buffers[i][j]);
+            }
+        }
+    }
+
+    void* buffers[THREAD_CACHE_SIZE_CLASSES][THREAD_CACHE_BUFFERS_PER_CLASS];
+    int counts[THREAD_CACHE_SIZE_CLASSES] = {};
+    size_t cached_bytes = 0;
+    uint64_t hit_times = 0;
+    uint64_t miss_times = 0;
+    // the allocations in the destructors of other thread locals bypass the cache
+    bool destroyed = false;
+};
+
+thread_local ThreadCache thread_cache;
+
+// the size class of a buffer of `size` bytes, or -1 if it is not cacheable
+int thread_cache_size_class(size_t size) {
+    if (size < THREAD_CACHE_MIN_BUFFER_BYTES || (size & (size - 1)) != 0 ||
+        size > static_cast<size_t>(config::allocator_thread_cache_max_buffer_bytes) ||
+        thread_cache.destroyed) {
+        return -1;
+    }
+    return std::countr_zero(size);
+}
+
+} // namespace
+
+void* AllocatorThreadCache::get(size_t size) {
+    int size_class = thread_cache_size_class(size);
+    if (size_class < 0) {
+        return nullptr;
+    }
+    auto& count = thread_cache.counts[size_class];
+    if (count == 0) {
+        ++thread_cache.miss_times;
+        return nullptr;
+    }
+    ++thread_cache.hit_times;
+    thread_cache.cached_bytes -= size;
+    return thread_cache.buffers[size_class][--count];
+}
+
+bool AllocatorThreadCache::put(void* buf, size_t size) {
+    int size_class = thread_cache_size_class(size);
+    if (size_class < 0 ||
+        thread_cache.cached_bytes + size >
+                static_cast<size_t>(config::allocator_thread_cache_bytes)) {
+        return false;
+    }
+    auto& count = thread_cache.counts[size_class];
+    if (count == THREAD_CACHE_BUFFERS_PER_CLASS) {
+        return false;
+    }
+    thread_cache.buffers[size_class][count++] = buf;
+    thread_cache.cached_bytes += size;
+    return true;
+}
+
+uint64_t AllocatorThreadCache::hit_times() {
+    return thread_cache.hit_times;
+}
+
+uint64_t AllocatorThreadCache::miss_times() {
+    return thread_cache.miss_times;
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::sys_memory_exceed(
         size_t size, std::string* err_msg) const {
@@ -286,6 +366,69 @@ void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::remove_
             ->remove_address_sanitizers(buf, size);
 }
 
+// The bytes of the whole huge pages inside [buf, buf + size) if the allocation is large enough to
+// use huge pages, the partial pages at both ends are shared with other allocations of jemalloc.
+static size_t huge_page_range(void* buf, size_t size, char** begin) {
+    if (!doris::config::enable_huge_page_for_large_allocation ||
+        size < static_cast<size_t>(doris::config::huge_page_allocation_threshold_bytes)) {
+        return 0;
+    }
+    auto start = (reinterpret_cast<uintptr_t>(buf) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    auto end = (reinterpret_cast<uintptr_t>(buf) + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (end <= start) {
+        return 0;
+    }
+    *begin = reinterpret_cast<char*>(start);
+    return end - start;
+}
+
+template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
+void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::add_huge_pages(
+        void* buf, size_t size) const {
+    if constexpr (!MemoryAllocator::need_check_and_tracking_memory()) {
+        return;
+    }
+    char* begin = nullptr;
+    size_t bytes = huge_page_range(buf, size, &begin);
+    if (bytes == 0) {
+        return;
+    }
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    // The advice is best effort, e.g. it fails if the kernel does not support transparent huge
+    // pages. The advised bytes are counted anyway, so that they match the bytes released in free.
+    [[maybe_unused]] int res = madvise(begin, bytes, MADV_HUGEPAGE);
+#ifdef BE_TEST
+    if (!doris::pthread_context_ptr_init) {
+        return;
+    }
+#endif
+    doris::thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker()->consume_huge_page(
+            bytes);
+#endif
+}
+
+template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
+void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::remove_huge_pages(
+        void* buf, size_t size) const {
+    if constexpr (!MemoryAllocator::need_check_and_tracking_memory()) {
+        return;
+    }
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    char* begin = nullptr;
+    size_t bytes = huge_page_range(buf, size, &begin);
+    if (bytes == 0) {
+        return;
+    }
+#ifdef BE_TEST
+    if (!doris::pthread_context_ptr_init) {
+        return;
+    }
+#endif
+    doris::thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker()->release_huge_page(
+            bytes);
+#endif
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
 void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(size_t size,
                                                                                 size_t alignment) {
@@ -318,7 +461,13 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(
             if constexpr (clear_memory) {
                 buf = MemoryAllocator::calloc(size, 1);
             } else {
-                buf = MemoryAllocator::malloc(size);
+                buf = nullptr;
+                if constexpr (use_thread_cache) {
+                    buf = AllocatorThreadCache::get(size);
+                }
+                if (buf == nullptr) {
+                    buf = MemoryAllocator::malloc(size);
+                }
             }
 
             if (nullptr == buf) {
@@ -351,19 +500,27 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::alloc(
     if constexpr (MemoryAllocator::need_record_actual_size()) {
         consume_memory(record_size - size);
     }
+    add_huge_pages(buf, size);
     return buf;
 }
 
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator>
 void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::free(void* buf,
                                                                               size_t size) {
+    remove_huge_pages(buf, size);
     if (use_mmap && size >= doris::config::mmap_threshold) {
         if (0 != munmap(buf, size)) {
             throw_bad_alloc(fmt::format("Allocator: Cannot munmap {}.", size));
         }
     } else {
         remove_address_sanitizers(buf, size);
-        MemoryAllocator::free(buf);
+        if constexpr (use_thread_cache) {
+            if (!AllocatorThreadCache::put(buf, size)) {
+                MemoryAllocator::free(buf);
+            }
+        } else {
+            MemoryAllocator::free(buf);
+        }
     }
     release_memory(size);
 }
@@ -388,8 +545,25 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
         (old_size < doris::config::mmap_threshold && new_size < doris::config::mmap_threshold &&
          alignment <= MALLOC_MIN_ALIGNMENT)) {
         remove_address_sanitizers(buf, old_size);
+        remove_huge_pages(buf, old_size);
+        void* new_buf = nullptr;
+        if constexpr (use_thread_cache) {
+            // A growing buffer takes a cached buffer of the new size if there is one, e.g. the
+            // PODArray of a new block grows into the buffers freed by the previous block.
+            if (new_size > old_size) {
+                new_buf = AllocatorThreadCache::get(new_size);
+            }
+            if (new_buf != nullptr) {
+                memcpy(new_buf, buf, old_size);
+                if (!AllocatorThreadCache::put(buf, old_size)) {
+                    MemoryAllocator::free(buf);
+                }
+            }
+        }
         /// Resize malloc'd memory region with no special alignment requirement.
-        void* new_buf = MemoryAllocator::realloc(buf, new_size);
+        if (new_buf == nullptr) {
+            new_buf = MemoryAllocator::realloc(buf, new_size);
+        }
         if (nullptr == new_buf) {
             release_memory(new_size);
             throw_bad_alloc(
@@ -397,6 +571,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
         }
         // usually, buf addr = new_buf addr, asan maybe not equal.
         add_address_sanitizers(new_buf, new_size);
+        add_huge_pages(new_buf, new_size);
 
         buf = new_buf;
         release_memory(old_size);
@@ -408,6 +583,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
     } else if (old_size >= doris::config::mmap_threshold &&
                new_size >= doris::config::mmap_threshold) {
         /// Resize mmap'd memory region.
+        remove_huge_pages(buf, old_size);
         // On apple and freebsd self-implemented mremap used (common/mremap.h)
         buf = clickhouse_mremap(buf, old_size, new_size, MREMAP_MAYMOVE, PROT_READ | PROT_WRITE,
                                 mmap_flags, -1, 0);
@@ -417,6 +593,7 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator>::reallo
                                         old_size, new_size));
         }
         release_memory(old_size);
+        add_huge_pages(buf, new_size);
 
         /// No need for zero-fill, because mmap guarantees it.
 
@@ -57,6 +57,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <type_traits>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #ifdef THREAD_SANITIZER
@@ -81,6 +82,7 @@
 
 namespace doris {
 static constexpr size_t MMAP_MIN_ALIGNMENT = 4096;
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
 static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
 
 // The memory for __int128 should be aligned to 16 bytes.
@@ -224,6 +226,24 @@ private:
     static std::mutex _mutex;
 };
 
+/** A thread local cache of freed malloc buffers of power of two sizes, such as the buffers of
+  * PODArray. The blocks created and destroyed by an operator reuse the buffers instead of
+  * going to jemalloc for every growth. A cached buffer is released from the mem tracker when it
+  * is put into the cache, and consumed again by the allocator that reuses it.
+  */
+class AllocatorThreadCache {
+public:
+    // Returns nullptr if there is no cached buffer of `size`.
+    static void* get(size_t size);
+
+    // Returns false if `buf` is not cached, the caller should free it.
+    static bool put(void* buf, size_t size);
+
+    // The number of cacheable allocations of this thread that reused or missed a cached buffer.
+    static uint64_t hit_times();
+    static uint64_t miss_times();
+};
+
 /** Responsible for allocating / freeing memory. Used, for example, in PODArray, Arena.
   * Also used in hash tables.
   * The interface is different from std::allocator
@@ -265,6 +285,10 @@ protected:
     static constexpr bool clear_memory = clear_memory_;
 
 private:
+    // The zeroed memory is not cached, zeroing a reused buffer costs as much as calloc.
+    static constexpr bool use_thread_cache =
+            !clear_memory_ && std::is_base_of_v<DefaultMemoryAllocator, MemoryAllocator>;
+
     void sys_memory_check(size_t size) const;
     void memory_tracker_check(size_t size) const;
     // If sys memory or tracker exceeds the limit, but there is no external catch bad_alloc,
@@ -285,6 +309,9 @@ private:
     void throw_bad_alloc(const std::string& err) const;
     void add_address_sanitizers(void* buf, size_t size) const;
     void remove_address_sanitizers(void* buf, size_t size) const;
+    // Advise the huge pages for a large allocation and count them in the mem tracker.
+    void add_huge_pages(void* buf, size_t size) const;
+    void remove_huge_pages(void* buf, size_t size) const;
 
     // Freshly mmapped pages are copy-on-write references to a global zero page.
     // On the first write, a page fault occurs, and an actual writable page is
@@ -21,11 +21,11 @@
 
 namespace doris::vectorized {
 
-template <class HashTableContext, bool is_intersected>
+template <class HashTableContext>
 struct HashTableProbe {
     template <typename Parent>
     HashTableProbe(Parent* parent, int probe_rows)
-            : _valid_element_in_hash_tbl(parent->valid_element_in_hash_tbl()),
+            : _visited_rows(parent->visited_rows()),
               _probe_rows(probe_rows),
               _probe_raw_ptrs(parent->_probe_columns) {}
 
@@ -38,22 +38,14 @@ struct HashTableProbe {
         for (int probe_index = 0; probe_index < _probe_rows; probe_index++) {
             auto find_result = hash_table_ctx.find(key_getter, probe_index);
             if (find_result.is_found()) { //if found, marked visited
-                auto* it = &find_result.get_mapped();
-                if (!(it->visited)) {
-                    it->visited = true;
-                    if constexpr (is_intersected) { //intersected
-                        (*_valid_element_in_hash_tbl)++;
-                    } else {
-                        (*_valid_element_in_hash_tbl)--; //except
-                    }
-                }
+                _visited_rows[find_result.get_mapped().row_num] = 1;
             }
         }
         return Status::OK();
     }
 
 private:
-    int64_t* _valid_element_in_hash_tbl = nullptr;
+    uint8_t* _visited_rows = nullptr;
     const size_t _probe_rows;
     ColumnRawPtrs& _probe_raw_ptrs;
     std::vector<StringRef> _probe_keys;
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <array>
 #include <limits>
 
 #include "common/exception.h"
@@ -42,9 +43,17 @@ public:
                         static_cast<size_t>(std::numeric_limits<int32_t>::max()) + 1);
     }
 
+    // If `first` is larger than this number of buckets (4MB), it does not fit in L2 cache and a
+    // probe on it is a random DRAM access, so a bucket bitmap is used to skip empty buckets.
+    static constexpr uint32_t BUCKET_BITMAP_MIN_BUCKETS = 1 << 20;
+    // Number of radix bits of the bucket number used to partition the build rows of large hash
+    // tables, each partition covers 1/256 of `first`, which fits in L2 cache.
+    static constexpr int BUILD_RADIX_BITS = 8;
+
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(bucket_bitmap);
     }
 
     template <int JoinOpType>
@@ -57,6 +66,11 @@ public:
         bucket_size = calc_bucket_size(num_elem + 1);
         first.resize(bucket_size + 1);
         next.resize(num_elem);
+        _use_bucket_bitmap = bucket_size >= BUCKET_BITMAP_MIN_BUCKETS;
+        if (_use_bucket_bitmap) {
+            // one more bit for the null bucket
+            bucket_bitmap.assign((bucket_size + 1 + 63) / 64, 0);
+        }
 
         if constexpr (JoinOpType == TJoinOp::FULL_OUTER_JOIN ||
                       JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
@@ -77,13 +91,20 @@ public:
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums, size_t num_elem,
                bool keep_null_key) {
         build_keys = keys;
-        for (size_t i = 1; i < num_elem; i++) {
-            uint32_t bucket_num = bucket_nums[i];
-            next[i] = first[bucket_num];
-            first[bucket_num] = i;
+        if (_use_bucket_bitmap) {
+            _radix_build(bucket_nums, num_elem);
+        } else {
+            for (size_t i = 1; i < num_elem; i++) {
+                uint32_t bucket_num = bucket_nums[i];
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
         }
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
+            if (_use_bucket_bitmap) {
+                bucket_bitmap[bucket_size >> 6] &= ~(1ULL << (bucket_size & 63));
+            }
         }
         _keep_null_key = keep_null_key;
     }
@@ -210,12 +231,76 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
+        if (_use_bucket_bitmap) {
+            // The bitmap is 1/32 of `first` and usually stays in cache, so the probe rows which
+            // do not match any build rows do not need to touch `first` at all.
+            // For the others, prefetch the buckets HASH_MAP_PREFETCH_DIST rows ahead, so that the
+            // loads of `first` are overlapped instead of stalled one by one.
+            const size_t num_buckets = buckets.size();
+            auto bucket_not_empty = [&](uint32_t bucket) {
+                return (bucket_bitmap[bucket >> 6] >> (bucket & 63)) & 1;
+            };
+            for (size_t i = 0; i < num_buckets; ++i) {
+                if (i + HASH_MAP_PREFETCH_DIST < num_buckets) {
+                    const auto ahead = buckets[i + HASH_MAP_PREFETCH_DIST];
+                    if (bucket_not_empty(ahead)) {
+                        __builtin_prefetch(&first[ahead], 0, 1);
+                    }
+                }
+                buckets[i] = bucket_not_empty(buckets[i]) ? first[buckets[i]] : 0;
+            }
+            return;
+        }
         for (unsigned int& bucket : buckets) {
             bucket = first[bucket];
         }
     }
 
 private:
+    // Build the large hash table partition by partition on the high bits of the bucket number,
+    // so the writes of `first` and `bucket_bitmap` hit a cache-sized range instead of the whole
+    // array. Rows of a bucket are still inserted in row order, so the chains are the same as the
+    // ones built row by row.
+    void _radix_build(const uint32_t* __restrict bucket_nums, size_t num_elem) {
+        if (num_elem <= 1) {
+            return;
+        }
+        // bucket_size is a power of two not less than BUCKET_BITMAP_MIN_BUCKETS, the null bucket
+        // `bucket_size` is in the last partition.
+        const int shift = __builtin_ctz(bucket_size) - BUILD_RADIX_BITS;
+        constexpr size_t num_partitions = (1 << BUILD_RADIX_BITS) + 1;
+        std::array<uint32_t, num_partitions + 1> offsets {};
+        for (size_t i = 1; i < num_elem; i++) {
+            offsets[(bucket_nums[i] >> shift) + 1]++;
+        }
+        for (size_t i = 1; i <= num_partitions; i++) {
+            offsets[i] += offsets[i - 1];
+        }
+        DorisVector<uint32_t> partitioned_rows(num_elem - 1);
+        for (size_t i = 1; i < num_elem; i++) {
+            partitioned_rows[offsets[bucket_nums[i] >> shift]++] = uint32_t(i);
+        }
+        for (auto row : partitioned_rows) {
+            uint32_t bucket_num = bucket_nums[row];
+            next[row] = first[bucket_num];
+            first[bucket_num] = row;
+            bucket_bitmap[bucket_num >> 6] |= 1ULL << (bucket_num & 63);
+        }
+    }
+
+    // Prefetch the build key and the chain of the probe row HASH_MAP_PREFETCH_DIST rows ahead,
+    // only for the large hash tables whose build side does not fit in cache.
+    void _prefetch_build_row(const uint32_t* __restrict build_idx_map, int probe_idx,
+                             int probe_rows) const {
+        if (!_use_bucket_bitmap || probe_idx + int(HASH_MAP_PREFETCH_DIST) >= probe_rows) {
+            return;
+        }
+        if (auto build_idx = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST]; build_idx) {
+            __builtin_prefetch(&build_keys[build_idx], 0, 1);
+            __builtin_prefetch(&next[build_idx], 0, 1);
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -242,6 +327,7 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
@@ -271,6 +357,7 @@ private:
                 }
             }
 
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -327,6 +414,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -381,6 +469,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build_row(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -467,6 +556,9 @@ private:
 
     DorisVector<uint32_t> first = {0};
     DorisVector<uint32_t> next = {0};
+    // one bit per bucket of `first`, set if the bucket is not empty
+    DorisVector<uint64_t> bucket_bitmap;
+    bool _use_bucket_bitmap = false;
 
     // use in iter hash map
     mutable uint32_t iter_idx = 1;
@@ -30,13 +30,16 @@ ALWAYS_INLINE inline auto lookup_result_get_mapped(std::pair<const Key, Mapped>*
     return &(it->second);
 }
 
-template <typename Key, typename Mapped, typename HashMethod = DefaultHash<Key>>
+template <typename Key, typename Mapped, typename HashMethod = DefaultHash<Key>,
+          bool TwoLevel = false>
 class PHHashMap : private boost::noncopyable {
 public:
     using Self = PHHashMap;
     using Hash = HashMethod;
     using cell_type = std::pair<const Key, Mapped>;
-    using HashMapImpl = doris::vectorized::flat_hash_map<Key, Mapped, Hash>;
+    using HashMapImpl = std::conditional_t<
+            TwoLevel, doris::vectorized::two_level_flat_hash_map<Key, Mapped, Hash>,
+            doris::vectorized::flat_hash_map<Key, Mapped, Hash>>;
 
     using key_type = Key;
     using mapped_type = Mapped;
@@ -190,7 +193,11 @@ public:
 
     size_t get_buffer_size_in_bytes() const {
         const auto capacity = _hash_map.capacity();
-        return capacity * sizeof(typename HashMapImpl::slot_type);
+        if constexpr (TwoLevel) {
+            return capacity * sizeof(typename HashMapImpl::value_type);
+        } else {
+            return capacity * sizeof(typename HashMapImpl::slot_type);
+        }
     }
 
     bool add_elem_size_overflow(size_t row) const {
@@ -203,9 +210,16 @@ public:
         if (!add_elem_size_overflow(num_elem)) {
             return 0;
         }
-        auto new_size = _hash_map.capacity() * 2 + 1;
-        return phmap::priv::hashtable_debug_internal::HashtableDebugAccess<
-                HashMapImpl>::LowerBoundAllocatedByteSize(new_size);
+        if constexpr (TwoLevel) {
+            // only the sub maps which reach the load factor grow, one sub map at a time
+            auto new_size =
+                    (_hash_map.capacity() >> doris::vectorized::TWO_LEVEL_HASH_MAP_BITS) * 2 + 1;
+            return new_size * (sizeof(typename HashMapImpl::value_type) + 1);
+        } else {
+            auto new_size = _hash_map.capacity() * 2 + 1;
+            return phmap::priv::hashtable_debug_internal::HashtableDebugAccess<
+                    HashMapImpl>::LowerBoundAllocatedByteSize(new_size);
+        }
     }
 
     size_t size() const { return _hash_map.size(); }
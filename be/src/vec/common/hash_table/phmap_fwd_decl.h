@@ -47,6 +47,16 @@ template <typename K, typename V, typename Hash = phmap::Hash<K>, typename Eq =
           typename Alloc = Allocator_<phmap::Pair<const K, V>>>
 using flat_hash_map = phmap::flat_hash_map<K, V, Hash, Eq, Alloc>;
 
+/// Two-level hash map with 2^TWO_LEVEL_HASH_MAP_BITS sub maps selected by the hash value, each
+/// sub map resizes on its own, so growing a huge map never rehashes all the elements at once.
+constexpr size_t TWO_LEVEL_HASH_MAP_BITS = 8;
+
+template <typename K, typename V, typename Hash = phmap::Hash<K>, typename Eq = phmap::EqualTo<K>,
+          typename Alloc = Allocator_<phmap::Pair<const K, V>>>
+using two_level_flat_hash_map =
+        phmap::parallel_flat_hash_map<K, V, Hash, Eq, Alloc, TWO_LEVEL_HASH_MAP_BITS,
+                                      phmap::NullMutex>;
+
 template <typename K, typename Hash = phmap::Hash<K>, typename Eq = phmap::EqualTo<K>,
           typename Alloc = Allocator_<K>>
 using flat_hash_set = phmap::flat_hash_set<K, Hash, Eq, Alloc>;
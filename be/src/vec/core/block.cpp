@@ -48,7 +48,9 @@
 #include "util/slice.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
+#include "vec/columns/column_decimal.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -705,9 +707,14 @@ void Block::clear_column_data(int64_t column_size) noexcept {
     }
     for (auto& d : data) {
         if (d.column) {
-            // Temporarily disable reference count check because a column might be referenced multiple times within a block.
-            // Queries like this: `select c, c from t1;`
-            (*std::move(d.column)).assume_mutable()->clear();
+            if (d.column->use_count() > 1) {
+                // The column is borrowed by other blocks (e.g. a block broadcast by local
+                // exchanger), or referenced multiple times within this block, queries like this:
+                // `select c, c from t1;`. Do not clear the shared data in place.
+                d.column = d.column->clone_empty();
+            } else {
+                (*std::move(d.column)).assume_mutable()->clear();
+            }
         }
     }
     row_same_bit.clear();
@@ -771,9 +778,50 @@ void Block::update_hash(SipHash& hash) const {
     }
 }
 
+namespace {
+
+// a filter selecting at most 1/SPARSE_FILTER_RATIO of the rows is sparse
+constexpr size_t SPARSE_FILTER_RATIO = 8;
+
+// true if `column` gathers the rows of a selection vector by a simple loop, the storage columns
+// such as PredicateColumnType and ColumnDictionary do not support insert_indices_from
+bool can_gather_by_selection(const IColumn& column) {
+    const IColumn* nested = &column;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(nested)) {
+        nested = &nullable->get_nested_column();
+    }
+    return check_and_get_column<ColumnString>(nested) || check_and_get_column<ColumnUInt8>(nested) ||
+           check_and_get_column<ColumnInt8>(nested) || check_and_get_column<ColumnInt16>(nested) ||
+           check_and_get_column<ColumnInt32>(nested) || check_and_get_column<ColumnInt64>(nested) ||
+           check_and_get_column<ColumnInt128>(nested) ||
+           check_and_get_column<ColumnFloat32>(nested) ||
+           check_and_get_column<ColumnFloat64>(nested) ||
+           check_and_get_column<ColumnDateV2>(nested) ||
+           check_and_get_column<ColumnDateTimeV2>(nested) ||
+           check_and_get_column<ColumnDecimal32>(nested) ||
+           check_and_get_column<ColumnDecimal64>(nested) ||
+           check_and_get_column<ColumnDecimal128V3>(nested);
+}
+
+} // namespace
+
 void Block::filter_block_internal(Block* block, const std::vector<uint32_t>& columns_to_filter,
                                   const IColumn::Filter& filter) {
     size_t count = filter.size() - simd::count_zero_num((int8_t*)filter.data(), filter.size());
+    // For a sparse filter, the selected rows are computed once and every column gathers them,
+    // instead of scanning the whole filter once per column.
+    std::vector<uint32_t> selection;
+    if (count != 0 && count * SPARSE_FILTER_RATIO <= filter.size() &&
+        columns_to_filter.size() > 1) {
+        selection.resize(filter.size());
+        size_t selected = 0;
+        for (size_t i = 0; i < filter.size(); ++i) {
+            selection[selected] = static_cast<uint32_t>(i);
+            selected += filter[i] != 0;
+        }
+        DCHECK_EQ(selected, count);
+        selection.resize(count);
+    }
     for (const auto& col : columns_to_filter) {
         auto& column = block->get_by_position(col).column;
         if (column->size() == count) {
@@ -783,6 +831,14 @@ void Block::filter_block_internal(Block* block, const std::vector<uint32_t>& col
             block->get_by_position(col).column->assume_mutable()->clear();
             continue;
         }
+        if (!selection.empty() && column->size() == filter.size() &&
+            can_gather_by_selection(*column)) {
+            auto result = column->clone_empty();
+            result->reserve(count);
+            result->insert_indices_from(*column, selection.data(), selection.data() + count);
+            column = std::move(result);
+            continue;
+        }
         if (column->is_exclusive()) {
             const auto result_size = column->assume_mutable()->filter(filter);
             if (result_size != count) [[unlikely]] {
@@ -1005,6 +1061,12 @@ Status MutableBlock::add_rows(const Block* block, const uint32_t* row_begin,
         if (column_offset != nullptr) {
             DCHECK_EQ(columns(), column_offset->size());
         }
+        // The rows of a block are often all sent to one tablet, then they are copied by ranges
+        // instead of gathered row by row.
+        bool is_range = row_begin != row_end;
+        for (const uint32_t* row = row_begin; is_range && row != row_end; ++row) {
+            is_range = *row == *row_begin + (row - row_begin);
+        }
         const auto& block_data = block->get_columns_with_type_and_name();
         for (size_t i = 0; i < _columns.size(); ++i) {
             const auto& src_col = column_offset ? block_data[(*column_offset)[i]] : block_data[i];
@@ -1012,7 +1074,11 @@ Status MutableBlock::add_rows(const Block* block, const uint32_t* row_begin,
             auto& dst = _columns[i];
             const auto& src = *src_col.column.get();
             DCHECK_GE(src.size(), row_end - row_begin);
-            dst->insert_indices_from(src, row_begin, row_end);
+            if (is_range) {
+                dst->insert_range_from(src, *row_begin, row_end - row_begin);
+            } else {
+                dst->insert_indices_from(src, row_begin, row_end);
+            }
         }
     });
     return Status::OK();
@@ -20,10 +20,170 @@
 
 #include "vec/core/sort_block.h"
 
+#include <cstring>
+
+#include "common/config.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
 
+namespace {
+
+/// Ranges of fewer rows are sorted by comparison instead of another radix pass.
+constexpr size_t RADIX_SORT_MIN_ROWS = 64;
+
+template <PrimitiveType T, typename F>
+bool visit_normalized_key_column(const IColumn& column, F& f) {
+    if (const auto* col = check_and_get_column<ColumnVector<T>>(column)) {
+        f(*col);
+        return true;
+    }
+    return false;
+}
+
+/// Calls `f` with the integer or date column, their values compare as the integers of the
+/// column, returns false for the other columns.
+template <typename F>
+bool visit_normalized_key_column(const IColumn& column, F&& f) {
+    return visit_normalized_key_column<TYPE_BOOLEAN>(column, f) ||
+           visit_normalized_key_column<TYPE_TINYINT>(column, f) ||
+           visit_normalized_key_column<TYPE_SMALLINT>(column, f) ||
+           visit_normalized_key_column<TYPE_INT>(column, f) ||
+           visit_normalized_key_column<TYPE_BIGINT>(column, f) ||
+           visit_normalized_key_column<TYPE_DATE>(column, f) ||
+           visit_normalized_key_column<TYPE_DATETIME>(column, f) ||
+           visit_normalized_key_column<TYPE_DATEV2>(column, f) ||
+           visit_normalized_key_column<TYPE_DATETIMEV2>(column, f);
+}
+
+} // namespace
+
+size_t normalized_key_width(const IColumn& column) {
+    const IColumn* nested = &column;
+    size_t width = 0;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        nested = &nullable->get_nested_column();
+        width = 1;
+    }
+    size_t value_width = 0;
+    visit_normalized_key_column(
+            *nested, [&](const auto& col) { value_width = sizeof(col.get_data()[0]); });
+    return value_width == 0 ? 0 : width + value_width;
+}
+
+void encode_normalized_key(const IColumn& column, const SortColumnDescription& desc,
+                           const size_t* row_ids, size_t rows, uint8_t* keys, size_t key_width,
+                           size_t offset) {
+    const IColumn* nested = &column;
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        nested = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+        // NULL is greater than the other values in the sort order iff direction * nulls_direction > 0
+        const uint8_t null_byte = desc.direction * desc.nulls_direction > 0 ? 1 : 0;
+        for (size_t i = 0; i < rows; ++i) {
+            size_t row = row_ids == nullptr ? i : row_ids[i];
+            keys[i * key_width + offset] = (*null_map)[row] ? null_byte : uint8_t(1 - null_byte);
+        }
+        ++offset;
+    }
+    visit_normalized_key_column(*nested, [&](const auto& col) {
+        using ValueType = std::decay_t<decltype(col.get_data()[0])>;
+        using UnsignedType = std::make_unsigned_t<ValueType>;
+        constexpr size_t value_width = sizeof(ValueType);
+        const auto& data = col.get_data();
+        for (size_t i = 0; i < rows; ++i) {
+            size_t row = row_ids == nullptr ? i : row_ids[i];
+            uint8_t* key = keys + i * key_width + offset;
+            if (null_map != nullptr && (*null_map)[row]) {
+                memset(key, 0, value_width);
+                continue;
+            }
+            auto value = static_cast<UnsignedType>(data[row]);
+            if constexpr (std::is_signed_v<ValueType>) {
+                value ^= UnsignedType(1) << (value_width * 8 - 1);
+            }
+            if (desc.direction < 0) {
+                value = static_cast<UnsignedType>(~value);
+            }
+            for (size_t b = 0; b < value_width; ++b) {
+                key[b] = static_cast<uint8_t>(value >> ((value_width - 1 - b) * 8));
+            }
+        }
+    });
+}
+
+void radix_sort_normalized_keys(size_t* perm, size_t* tmp, size_t rows, const uint8_t* keys,
+                                size_t key_width, size_t byte) {
+    while (byte < key_width) {
+        if (rows <= RADIX_SORT_MIN_ROWS) {
+            pdqsort(perm, perm + rows, [&](size_t a, size_t b) {
+                return memcmp(keys + a * key_width + byte, keys + b * key_width + byte,
+                              key_width - byte) < 0;
+            });
+            return;
+        }
+
+        size_t counts[257] = {};
+        for (size_t i = 0; i < rows; ++i) {
+            ++counts[keys[perm[i] * key_width + byte] + 1];
+        }
+        if (std::find(counts + 1, counts + 257, rows) != counts + 257) {
+            // all rows have the same byte
+            ++byte;
+            continue;
+        }
+        for (size_t i = 1; i < 257; ++i) {
+            counts[i] += counts[i - 1];
+        }
+        size_t positions[256];
+        memcpy(positions, counts, sizeof(positions));
+        for (size_t i = 0; i < rows; ++i) {
+            tmp[positions[keys[perm[i] * key_width + byte]]++] = perm[i];
+        }
+        memcpy(perm, tmp, rows * sizeof(size_t));
+        for (size_t i = 0; i < 256; ++i) {
+            if (counts[i + 1] - counts[i] > 1) {
+                radix_sort_normalized_keys(perm + counts[i], tmp + counts[i],
+                                           counts[i + 1] - counts[i], keys, key_width, byte + 1);
+            }
+        }
+        return;
+    }
+}
+
+namespace {
+
+/// Sorts `perm` by the normalized keys of the sort columns, returns false if some sort column
+/// can not be normalized.
+bool sort_by_normalized_keys(const ColumnsWithSortDescriptions& columns_with_sort_desc,
+                             size_t rows, IColumn::Permutation& perm) {
+    size_t key_width = 0;
+    for (const auto& [column, desc] : columns_with_sort_desc) {
+        size_t width = normalized_key_width(*column);
+        if (width == 0) {
+            return false;
+        }
+        key_width += width;
+    }
+    if (key_width > NORMALIZED_KEY_MAX_WIDTH) {
+        return false;
+    }
+
+    PaddedPODArray<uint8_t> keys(rows * key_width);
+    size_t offset = 0;
+    for (const auto& [column, desc] : columns_with_sort_desc) {
+        encode_normalized_key(*column, desc, nullptr, rows, keys.data(), key_width, offset);
+        offset += normalized_key_width(*column);
+    }
+    IColumn::Permutation tmp(rows);
+    radix_sort_normalized_keys(perm.data(), tmp.data(), rows, keys.data(), key_width, 0);
+    return true;
+}
+
+} // namespace
+
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -78,7 +238,10 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
 
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
-        {
+        // a partial sort of the first `limit` rows is cheaper than a full radix sort
+        bool sorted = limit == 0 && config::enable_sort_normalized_key &&
+                      sort_by_normalized_keys(columns_with_sort_desc, size, perm);
+        if (!sorted) {
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
@@ -25,11 +25,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cstring>
 #include <boost/iterator/iterator_facade.hpp>
 #include <utility>
 #include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "gutil/endian.h"
 #include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
@@ -61,6 +63,26 @@ using ColumnsWithSortDescriptions = std::vector<ColumnWithSortDescription>;
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description);
 
+/// Rows are sorted by normalized keys if all sort columns of a row fit in this many bytes.
+constexpr size_t NORMALIZED_KEY_MAX_WIDTH = 32;
+
+/// Returns the bytes of the normalized key of the (nullable) integer or date column, or 0 if it
+/// can not be normalized.
+size_t normalized_key_width(const IColumn& column);
+
+/// Writes the normalized key of the column at `offset` of the key of every row: an optional byte
+/// that puts NULLs first or last, then the big endian value with the sign bit flipped, with all
+/// bits flipped for descending order. The i-th key is of the row `row_ids[i]`, or of the row i
+/// if `row_ids` is null.
+void encode_normalized_key(const IColumn& column, const SortColumnDescription& desc,
+                           const size_t* row_ids, size_t rows, uint8_t* keys, size_t key_width,
+                           size_t offset);
+
+/// MSD radix sort of the rows in `perm` by the bytes of their keys from `byte` on, `tmp` has room
+/// for `rows` rows.
+void radix_sort_normalized_keys(size_t* perm, size_t* tmp, size_t rows, const uint8_t* keys,
+                                size_t key_width, size_t byte);
+
 struct EqualRangeIterator {
     int range_begin;
     int range_end;
@@ -139,6 +161,33 @@ struct PermutationWithInlineValue {
     uint32_t row_id;
 };
 
+template <>
+struct PermutationWithInlineValue<TYPE_STRING> {
+    using ValueType = StringRef;
+    ValueType inline_value;
+    uint32_t row_id;
+    /// The first 4 bytes of the string in big endian, padded with zeros. It fits in the padding
+    /// of the struct and decides most comparisons without touching the chars.
+    uint32_t prefix;
+
+    void set_value(const StringRef& value) {
+        inline_value = value;
+        prefix = 0;
+        memcpy(&prefix, value.data, std::min(value.size, sizeof(prefix)));
+        prefix = to_endian<std::endian::big>(prefix);
+    }
+
+    /// The same order as memcmp_small_allow_overflow15 of the strings.
+    static int compare(const PermutationWithInlineValue& a, const PermutationWithInlineValue& b) {
+        if (a.prefix != b.prefix) {
+            return a.prefix < b.prefix ? -1 : 1;
+        }
+        return memcmp_small_allow_overflow15(
+                reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
+                reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
+    }
+};
+
 template <PrimitiveType T>
 using PermutationForColumn = std::vector<PermutationWithInlineValue<T>>;
 
@@ -351,7 +400,7 @@ private:
                 permutation_for_column[i].inline_value = column.get_data()[row_id];
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
-                permutation_for_column[i].inline_value = column.get_data_at(row_id);
+                permutation_for_column[i].set_value(column.get_data_at(row_id));
             } else {
                 static_assert(always_false_v<ColumnType>);
             }
@@ -431,13 +480,11 @@ private:
         _create_permutation(column, permutation_for_column.data(), perms);
         auto comparator = [&](const PermutationWithInlineValue<InlineType>& a,
                               const PermutationWithInlineValue<InlineType>& b) {
-            if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
+            if constexpr (InlineType != TYPE_STRING) {
                 return a.inline_value > b.inline_value ? 1
                                                        : (a.inline_value < b.inline_value ? -1 : 0);
             } else {
-                return memcmp_small_allow_overflow15(
-                        reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
-                        reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
+                return PermutationWithInlineValue<TYPE_STRING>::compare(a, b);
             }
         };
 
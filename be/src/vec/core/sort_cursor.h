@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
@@ -473,4 +475,143 @@ template <typename Cursor>
 using SortingQueue = SortingQueueImpl<Cursor, SortingQueueStrategy::Default>;
 template <typename Cursor>
 using SortingQueueBatch = SortingQueueImpl<Cursor, SortingQueueStrategy::Batch>;
+
+/// Tournament tree of sort cursors. Every inner node keeps the loser of the match between its two
+/// subtrees and node 0 keeps the overall winner, i.e. the cursor with the smallest current row.
+/// When the winner moves to its next row only the matches on the path from its leaf to the root
+/// are replayed, which takes log2(k) comparisons while a binary heap takes up to 2 * log2(k).
+class MergeSortLoserTree {
+public:
+    MergeSortLoserTree() = default;
+
+    /// Cursors that are already at eof take part as leaves which lose every match.
+    void init(std::vector<MergeSortCursor> cursors) {
+        _cursors = std::move(cursors);
+        const size_t num_leaves = _cursors.size();
+        _exhausted.resize(num_leaves);
+        _num_active = 0;
+        for (size_t i = 0; i < num_leaves; ++i) {
+            _exhausted[i] = _cursors[i]->eof();
+            _num_active += !_exhausted[i];
+        }
+        _tree.assign(std::max<size_t>(num_leaves, 1), 0);
+        if (num_leaves <= 1) {
+            return;
+        }
+
+        /// Leaf i is node num_leaves + i, the children of node n are 2n and 2n + 1.
+        std::vector<size_t> winners(2 * num_leaves);
+        for (size_t i = 0; i < num_leaves; ++i) {
+            winners[num_leaves + i] = i;
+        }
+        for (size_t node = num_leaves - 1; node > 0; --node) {
+            size_t lhs = winners[2 * node];
+            size_t rhs = winners[2 * node + 1];
+            if (_beats(lhs, rhs)) {
+                winners[node] = lhs;
+                _tree[node] = rhs;
+            } else {
+                winners[node] = rhs;
+                _tree[node] = lhs;
+            }
+        }
+        _tree[0] = winners[1];
+    }
+
+    bool empty() const { return _num_active == 0; }
+    size_t size() const { return _num_active; }
+
+    MergeSortCursor& top() {
+        DCHECK(!empty());
+        return _cursors[_tree[0]];
+    }
+
+    /// The winner moved to its next row.
+    void update_top() { _replay(_tree[0]); }
+
+    /// The number of rows from the current row of the winner which beat the current rows of all
+    /// the other cursors, at most `max_rows`. They can be taken before replaying the matches once,
+    /// which pays off when the runs hardly overlap, e.g. they come from range partitioned inputs.
+    /// Like SortingQueueBatch::update_batch_size, but the winner is only compared with the
+    /// runner-up, which is the best of the losers on the path of the winner.
+    size_t top_run_length(size_t max_rows) const {
+        const size_t winner = _tree[0];
+        const auto& cursor = _cursors[winner];
+        const size_t limit = std::min<size_t>(max_rows, cursor->rows - cursor->pos);
+        if (limit <= 1 || _num_active == 1) {
+            return limit;
+        }
+        size_t runner_up = winner;
+        for (size_t node = (_cursors.size() + winner) / 2; node > 0; node /= 2) {
+            size_t loser = _tree[node];
+            if (!_exhausted[loser] && (runner_up == winner || _beats(loser, runner_up))) {
+                runner_up = loser;
+            }
+        }
+        auto wins = [&](size_t offset) {
+            auto res = cursor.greater_at(_cursors[runner_up], cursor->pos + offset,
+                                         _cursors[runner_up]->pos);
+            return res < 0 || (res == 0 && winner < runner_up);
+        };
+
+        /// The rows [0, good) win, and the row `bad` loses or is out of the limit. Gallop to find
+        /// a losing row, then binary search between them.
+        size_t good = 1;
+        size_t bad = limit;
+        for (size_t step = 1; good < bad; step *= 2) {
+            size_t probe = std::min(good + step - 1, bad - 1);
+            if (!wins(probe)) {
+                bad = probe;
+                break;
+            }
+            good = probe + 1;
+        }
+        while (good < bad) {
+            size_t mid = good + (bad - good) / 2;
+            if (wins(mid)) {
+                good = mid + 1;
+            } else {
+                bad = mid;
+            }
+        }
+        return good;
+    }
+
+    /// The winner has no more rows.
+    void remove_top() {
+        DCHECK(!_exhausted[_tree[0]]);
+        _exhausted[_tree[0]] = true;
+        --_num_active;
+        _replay(_tree[0]);
+    }
+
+private:
+    /// Ties are won by the cursor with the smaller index to keep the merge deterministic.
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (_exhausted[lhs]) {
+            return false;
+        }
+        if (_exhausted[rhs]) {
+            return true;
+        }
+        auto res = _cursors[lhs].greater_at(_cursors[rhs], _cursors[lhs]->pos,
+                                            _cursors[rhs]->pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    void _replay(size_t leaf) {
+        size_t winner = leaf;
+        for (size_t node = (_cursors.size() + leaf) / 2; node > 0; node /= 2) {
+            if (_beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+
+    std::vector<MergeSortCursor> _cursors;
+    std::vector<uint8_t> _exhausted;
+    std::vector<size_t> _tree;
+    size_t _num_active = 0;
+};
 } // namespace doris::vectorized
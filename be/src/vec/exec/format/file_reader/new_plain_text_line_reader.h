@@ -225,7 +225,7 @@ public:
         _state.reset();
     }
 
-    [[nodiscard]] inline std::vector<size_t> column_sep_positions() const {
+    [[nodiscard]] inline const std::vector<size_t>& column_sep_positions() const {
         return _column_sep_positions;
     }
 
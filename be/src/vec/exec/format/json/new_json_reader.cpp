@@ -1612,6 +1612,8 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
     bool has_valid_value = false;
     // iterate through object, simdjson::ondemond will parsing on the fly
     size_t key_index = 0;
+    size_t num_columns_to_fill = slot_descs.size() - (_should_process_skip_bitmap_col() ? 1 : 0);
+    size_t num_seen_columns = 0;
     for (auto field : *value) {
         std::string_view key = field.unescaped_key();
         StringRef name_ref(key.data(), key.size());
@@ -1648,6 +1650,11 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         }
         _seen_columns[column_index] = true;
         has_valid_value = true;
+        if (!_is_hive_table && ++num_seen_columns == num_columns_to_fill) {
+            // All the columns are filled, and the duplicated keys are ignored, so the rest of the
+            // object is skipped by simdjson without being parsed.
+            break;
+        }
     }
 
     if (!has_valid_value && _is_load) {
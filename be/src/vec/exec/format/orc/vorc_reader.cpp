@@ -1932,6 +1932,21 @@ Status OrcReader::get_next_block_impl(Block* block, size_t* read_rows, bool* eof
         std::vector<orc::ColumnVectorBatch*> batch_vec;
         _fill_batch_vec(batch_vec, _batch.get(), 0);
 
+        // Apply the position deletes before reading the lazy read columns, so the flat ones are
+        // decoded into the selected rows only, and are not filtered with the other columns.
+        _execute_filter_position_delete_rowids(*_filter);
+        _lazy_read_sel.clear();
+        const auto* __restrict filter_data = _filter->data();
+        for (uint16_t i = 0; i < _batch->numElements; ++i) {
+            if (filter_data[i]) {
+                _lazy_read_sel.push_back(i);
+            }
+        }
+        // keep the block not empty if all the rows are deleted
+        bool select_rows =
+                !_lazy_read_sel.empty() && _lazy_read_sel.size() < _batch->numElements;
+        std::vector<bool> selected_columns(column_to_keep, false);
+
         for (auto& col_name : _lazy_read_ctx.lazy_read_columns) {
             auto& column_with_type_and_name = block->get_by_name(col_name);
             auto& column_ptr = column_with_type_and_name.column;
@@ -1941,6 +1956,15 @@ Status OrcReader::get_next_block_impl(Block* block, size_t* read_rows, bool* eof
             if (orc_col_idx == _colname_to_idx.end()) {
                 return Status::InternalError("Wrong read column '{}' in orc file", col_name);
             }
+            auto* cvb = batch_vec[orc_col_idx->second];
+            if (select_rows && _select_batch_rows(cvb, _lazy_read_sel)) {
+                RETURN_IF_ERROR(_orc_column_to_doris_column<false>(
+                        col_name, column_ptr, column_type,
+                        _table_info_node_ptr->get_children_node(col_name),
+                        _type_map[file_column_name], cvb, _lazy_read_sel.size()));
+                selected_columns[block->get_position_by_name(col_name)] = true;
+                continue;
+            }
             RETURN_IF_ERROR(_orc_column_to_doris_column<true>(
                     col_name, column_ptr, column_type,
                     _table_info_node_ptr->get_children_node(col_name), _type_map[file_column_name],
@@ -1962,7 +1986,7 @@ Status OrcReader::get_next_block_impl(Block* block, size_t* read_rows, bool* eof
         }
         {
             SCOPED_RAW_TIMER(&_statistics.predicate_filter_time);
-            _execute_filter_position_delete_rowids(*_filter);
+            std::erase_if(columns_to_filter, [&](uint32_t i) { return selected_columns[i]; });
             {
                 SCOPED_RAW_TIMER(&_statistics.decode_null_map_time);
                 RETURN_IF_CATCH_EXCEPTION(
@@ -2830,6 +2854,43 @@ void ORCFileInputStream::_collect_profile_before_close() {
     }
 }
 
+template <typename T>
+static void select_values(T* values, const std::vector<uint16_t>& sel) {
+    // sel is ascending, so the values are moved forward in place
+    for (size_t i = 0; i < sel.size(); ++i) {
+        values[i] = values[sel[i]];
+    }
+}
+
+bool OrcReader::_select_batch_rows(orc::ColumnVectorBatch* cvb,
+                                   const std::vector<uint16_t>& sel) {
+    if (auto* strings = dynamic_cast<orc::EncodedStringVectorBatch*>(cvb)) {
+        if (strings->isEncoded) {
+            select_values(strings->index.data(), sel);
+        } else {
+            select_values(strings->data.data(), sel);
+            select_values(strings->length.data(), sel);
+        }
+    } else if (auto* longs = dynamic_cast<orc::LongVectorBatch*>(cvb)) {
+        select_values(longs->data.data(), sel);
+    } else if (auto* doubles = dynamic_cast<orc::DoubleVectorBatch*>(cvb)) {
+        select_values(doubles->data.data(), sel);
+    } else if (auto* decimals = dynamic_cast<orc::Decimal64VectorBatch*>(cvb)) {
+        select_values(decimals->values.data(), sel);
+    } else if (auto* decimals = dynamic_cast<orc::Decimal128VectorBatch*>(cvb)) {
+        select_values(decimals->values.data(), sel);
+    } else if (auto* timestamps = dynamic_cast<orc::TimestampVectorBatch*>(cvb)) {
+        select_values(timestamps->data.data(), sel);
+        select_values(timestamps->nanoseconds.data(), sel);
+    } else {
+        return false;
+    }
+    if (cvb->hasNulls) {
+        select_values(cvb->notNull.data(), sel);
+    }
+    return true;
+}
+
 void OrcReader::_execute_filter_position_delete_rowids(IColumn::Filter& filter) {
     if (_position_delete_ordered_rowids == nullptr) {
         return;
@@ -599,6 +599,11 @@ private:
 
     Status _fill_row_id_columns(Block* block);
 
+    // Keep only the rows of `sel` in the flat batch of a lazy read column, so it's decoded into
+    // the selected rows directly instead of being decoded in full and filtered afterwards.
+    // Return false if the batch is not flat, e.g. a list, map or struct.
+    static bool _select_batch_rows(orc::ColumnVectorBatch* cvb, const std::vector<uint16_t>& sel);
+
     bool _seek_to_read_one_line() {
         if (_read_line_mode_mode) {
             if (_read_lines.empty()) {
@@ -674,6 +679,8 @@ private:
     const std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
     bool _is_acid = false;
     std::unique_ptr<IColumn::Filter> _filter;
+    // the rows selected by _filter in the current batch
+    std::vector<uint16_t> _lazy_read_sel;
     LazyReadContext _lazy_read_ctx;
     const TransactionalHiveReader::AcidRowIDSet* _delete_rows = nullptr;
     std::unique_ptr<IColumn::Filter> _delete_rows_filter_ptr;
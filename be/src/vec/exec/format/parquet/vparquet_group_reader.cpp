@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <ostream>
+#include <unordered_set>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -219,15 +220,44 @@ bool RowGroupReader::_can_filter_by_dict(int slot_id,
     //  the implementation of NULL values because the dictionary itself does not contain
     //  NULL value encoding. As a result, many NULL-related functions or expressions
     //  cannot work properly, such as is null, is not null, coalesce, etc.
-    //  Here we check if the predicate expr is IN or BINARY_PRED.
+    //  Here we check if the predicate expr is IN or BINARY_PRED, or any other predicate which
+    //  is NULL for the NULL values, such as LIKE, so the NULL rows are filtered as before.
     //  Implementation of NULL value dictionary filtering will be carried out later.
     return std::ranges::all_of(_slot_id_to_filter_conjuncts->at(slot_id), [&](const auto& ctx) {
-        return (ctx->root()->node_type() == TExprNodeType::IN_PRED ||
-                ctx->root()->node_type() == TExprNodeType::BINARY_PRED) &&
-               ctx->root()->children()[0]->node_type() == TExprNodeType::SLOT_REF;
+        return ((ctx->root()->node_type() == TExprNodeType::IN_PRED ||
+                 ctx->root()->node_type() == TExprNodeType::BINARY_PRED) &&
+                ctx->root()->children()[0]->node_type() == TExprNodeType::SLOT_REF) ||
+               _is_null_propagating(ctx->root());
     });
 }
 
+bool RowGroupReader::_is_null_propagating(const VExprSPtr& expr) {
+    // the string functions whose result is NULL for a NULL string
+    static const std::unordered_set<std::string> NULL_PROPAGATING_FUNCTIONS = {
+            "like", "regexp", "starts_with", "ends_with"};
+    const auto& children = expr->children();
+    switch (expr->node_type()) {
+    case TExprNodeType::IN_PRED:
+        return children[0]->node_type() == TExprNodeType::SLOT_REF;
+    case TExprNodeType::BINARY_PRED:
+        // NULL <=> 'a' is false, not NULL
+        return expr->op() != TExprOpcode::EQ_FOR_NULL &&
+               children[0]->node_type() == TExprNodeType::SLOT_REF;
+    case TExprNodeType::FUNCTION_CALL:
+        return NULL_PROPAGATING_FUNCTIONS.contains(expr->fn().name.function_name) &&
+               !children.empty() && children[0]->node_type() == TExprNodeType::SLOT_REF &&
+               std::all_of(children.begin() + 1, children.end(),
+                           [](const auto& child) { return child->is_constant(); });
+    case TExprNodeType::COMPOUND_PRED:
+        // NOT NULL, NULL AND NULL and NULL OR NULL are all NULL
+        return !children.empty() && std::ranges::all_of(children, [](const auto& child) {
+            return _is_null_propagating(child);
+        });
+    default:
+        return false;
+    }
+}
+
 // This function is copied from
 // https://github.com/apache/impala/blob/master/be/src/exec/parquet/hdfs-parquet-scanner.cc#L1717
 bool RowGroupReader::is_dictionary_encoded(const tparquet::ColumnMetaData& column_metadata) {
@@ -965,6 +995,13 @@ Status RowGroupReader::_rewrite_dict_predicates() {
             }
         }
 
+        // All the values pass, so the rows don't need filtering unless some of them are NULL.
+        if (dict_codes.size() == dict_value_column_size &&
+            !temp_block.get_by_position(dict_pos).column->is_nullable()) {
+            it = _dict_filter_cols.erase(it);
+            continue;
+        }
+
         // About Performance: if dict_column size is too large, it will generate a large IN filter.
         if (dict_codes.size() > MAX_DICT_CODE_PREDICATE_TO_REWRITE) {
             it = _dict_filter_cols.erase(it);
@@ -23,7 +23,10 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <utility>
 
 #include "common/status.h"
@@ -41,6 +44,8 @@
 #include "util/string_util.h"
 #include "util/timezone_utils.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -56,6 +61,7 @@
 #include "vec/exprs/vin_predicate.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
+#include "vec/exprs/vtopn_pred.h"
 
 namespace cctz {
 class time_zone;
@@ -126,8 +132,12 @@ void ParquetReader::_init_profile() {
 
         _parquet_profile.filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.filtered_row_groups_by_topn = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByTopN", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.to_read_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "ReadGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.row_groups_read_by_statistics = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "ReadGroupsByStatistics", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_group_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredRowsByGroup", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_page_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -344,6 +354,7 @@ Status ParquetReader::init_reader(
     }
     // build column predicates for column lazy read
     _lazy_read_ctx.conjuncts = conjuncts;
+    _init_topn_filters();
     RETURN_IF_ERROR(_init_row_groups(filter_groups));
     return Status::OK();
 }
@@ -500,6 +511,17 @@ Status ParquetReader::get_columns(std::unordered_map<std::string, DataTypePtr>*
 }
 
 Status ParquetReader::get_next_block(Block* block, size_t* read_rows, bool* eof) {
+    if (_push_down_agg_type == TPushAggOp::type::MINMAX && _delete_rows == nullptr &&
+        (_current_group_reader == nullptr || _row_group_eof) && !_read_row_groups.empty() &&
+        _fill_min_max_by_statistics(
+                _t_metadata->row_groups[_read_row_groups.front().row_group_id], block)) {
+        // The row group is answered by its statistics and not read.
+        _read_row_groups.pop_front();
+        _statistics.row_groups_read_by_statistics++;
+        *read_rows = 2;
+        *eof = false;
+        return Status::OK();
+    }
     if (_current_group_reader == nullptr || _row_group_eof) {
         Status st = _next_row_group_reader();
         if (!st.ok() && !st.is<ErrorCode::END_OF_FILE>()) {
@@ -584,6 +606,11 @@ Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
     }
+    while (!_read_row_groups.empty() &&
+           _filter_row_group_by_topn(
+                   _t_metadata->row_groups[_read_row_groups.front().row_group_id])) {
+        _read_row_groups.pop_front();
+    }
     if (_read_row_groups.empty()) {
         _row_group_eof = true;
         _current_group_reader.reset(nullptr);
@@ -782,27 +809,41 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         read_whole_row_group();
         return Status::OK();
     }
-    std::vector<uint8_t> col_index_buff(page_index._column_index_size);
-    size_t bytes_read = 0;
-    Slice result(col_index_buff.data(), page_index._column_index_size);
-    {
+    // The page index is read through the meta cache if it's enabled, so the scans of the same
+    // file don't read it again.
+    FileIndexHandle col_index_handle;
+    FileIndexHandle off_index_handle;
+    std::vector<uint8_t> col_index_buff;
+    std::vector<uint8_t> off_index_buff;
+    auto read_index = [&](size_t offset, size_t size, FileIndexHandle* handle,
+                          std::vector<uint8_t>* buff, const uint8_t** data) -> Status {
         SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(_file_reader->read_at(page_index._column_index_start, result, &bytes_read,
-                                              _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
+        size_t bytes_read = 0;
+        if (_meta_cache != nullptr) {
+            RETURN_IF_ERROR(_meta_cache->get_file_index(_file_reader, _io_ctx,
+                                                        _file_description.mtime, offset, size,
+                                                        &bytes_read, handle));
+            *data = reinterpret_cast<const uint8_t*>(handle->data().get_data());
+        } else {
+            buff->resize(size);
+            RETURN_IF_ERROR(
+                    _file_reader->read_at(offset, Slice(buff->data(), size), &bytes_read, _io_ctx));
+            *data = buff->data();
+        }
+        _column_statistics.read_bytes += bytes_read;
+        if (bytes_read > 0) {
+            _column_statistics.meta_read_calls += 1;
+        }
+        return Status::OK();
+    };
+    const uint8_t* col_index_data = nullptr;
+    RETURN_IF_ERROR(read_index(page_index._column_index_start, page_index._column_index_size,
+                               &col_index_handle, &col_index_buff, &col_index_data));
     auto& schema_desc = _file_metadata->schema();
     std::vector<RowRange> skipped_row_ranges;
-    std::vector<uint8_t> off_index_buff(page_index._offset_index_size);
-    Slice res(off_index_buff.data(), page_index._offset_index_size);
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_page_index_time);
-        RETURN_IF_ERROR(
-                _file_reader->read_at(page_index._offset_index_start, res, &bytes_read, _io_ctx));
-    }
-    _column_statistics.read_bytes += bytes_read;
-    // read twice: parse column index & parse offset index
-    _column_statistics.meta_read_calls += 2;
+    const uint8_t* off_index_data = nullptr;
+    RETURN_IF_ERROR(read_index(page_index._offset_index_start, page_index._offset_index_size,
+                               &off_index_handle, &off_index_buff, &off_index_data));
     SCOPED_RAW_TIMER(&_statistics.parse_page_index_time);
 
     for (size_t idx = 0; idx < _read_table_columns.size(); idx++) {
@@ -823,7 +864,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::ColumnIndex column_index;
-        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_buff.data(), &column_index));
+        RETURN_IF_ERROR(page_index.parse_column_index(chunk, col_index_data, &column_index));
         const int64_t num_of_pages = column_index.null_pages.size();
         if (num_of_pages <= 0) {
             continue;
@@ -837,7 +878,7 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
             continue;
         }
         tparquet::OffsetIndex offset_index;
-        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_buff.data(), &offset_index));
+        RETURN_IF_ERROR(page_index.parse_offset_index(chunk, off_index_data, &offset_index));
         for (int page_id : skipped_page_range) {
             RowRange skipped_row_range;
             RETURN_IF_ERROR(page_index.create_skipped_row_range(offset_index, row_group.num_rows,
@@ -1001,6 +1042,245 @@ Status ParquetReader::_process_column_stat_filter(const std::vector<tparquet::Co
     return Status::OK();
 }
 
+void ParquetReader::_init_topn_filters() {
+    _topn_filters.clear();
+    if (_colname_to_value_range == nullptr) {
+        return;
+    }
+    for (const auto& conjunct : _lazy_read_ctx.conjuncts) {
+        const auto* topn_pred = typeid_cast<const VTopNPred*>(conjunct->root().get());
+        if (topn_pred == nullptr || topn_pred->predicate() == nullptr) {
+            continue;
+        }
+        const auto* slot_ref = typeid_cast<const VSlotRef*>(topn_pred->get_child(0).get());
+        if (slot_ref == nullptr || !_colname_to_value_range->contains(slot_ref->expr_name())) {
+            continue;
+        }
+        _topn_filters.emplace_back(slot_ref->expr_name(), topn_pred->predicate());
+    }
+}
+
+// Narrows the range of the column to the values that may still enter the TopN, returns false
+// if the type of the column is not supported.
+template <PrimitiveType T>
+static bool add_topn_range(ColumnValueRange<T>& range, const RuntimePredicate& predicate) {
+    if constexpr (T == TYPE_TINYINT || T == TYPE_SMALLINT || T == TYPE_INT || T == TYPE_BIGINT ||
+                  T == TYPE_DATEV2 || T == TYPE_DATETIMEV2) {
+        using CppType = typename PrimitiveTypeTraits<T>::CppType;
+        Field value = predicate.get_value();
+        return range.add_range(predicate.is_asc() ? FILTER_LESS_OR_EQUAL : FILTER_LARGER_OR_EQUAL,
+                               value.get<CppType>())
+                .ok();
+    } else {
+        return false;
+    }
+}
+
+bool ParquetReader::_filter_row_group_by_topn(const tparquet::RowGroup& row_group) {
+    if (!_enable_filter_by_min_max) {
+        return false;
+    }
+    for (const auto& [table_col_name, predicate] : _topn_filters) {
+        if (!predicate->has_value() ||
+            !_table_info_node_ptr->children_column_exists(table_col_name)) {
+            continue;
+        }
+        auto file_col_name = _table_info_node_ptr->children_file_column_name(table_col_name);
+        const FieldSchema* col_schema = _file_metadata->schema().get_column(file_col_name);
+        if (col_schema == nullptr || col_schema->physical_column_index < 0) {
+            continue;
+        }
+        const auto& meta_data = row_group.columns[col_schema->physical_column_index].meta_data;
+        const auto& statistic = meta_data.statistics;
+        // Only the min_value/max_value statistics are used, they are in the order of the type.
+        if (!statistic.__isset.min_value || !statistic.__isset.max_value ||
+            col_schema->physical_type == tparquet::Type::INT96 ||
+            col_schema->parquet_schema.logicalType.__isset.UNKNOWN) {
+            continue;
+        }
+        // NULLs always enter a TopN of NULLS FIRST
+        if (predicate->nulls_first() &&
+            !(statistic.__isset.null_count && statistic.null_count == 0)) {
+            continue;
+        }
+        ColumnValueRangeType range = _colname_to_value_range->at(table_col_name);
+        if (!std::visit([&](auto& r) { return add_topn_range(r, *predicate); }, range)) {
+            continue;
+        }
+        bool is_all_null =
+                statistic.__isset.null_count && statistic.null_count == meta_data.num_values;
+        if (ParquetPredicate::filter_by_stats(range, col_schema, false, statistic.min_value,
+                                              statistic.max_value, is_all_null, *_ctz, true)) {
+            _statistics.filtered_row_groups_by_topn++;
+            _statistics.filtered_group_rows += row_group.num_rows;
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+
+template <PrimitiveType type, typename T>
+void insert_min_max(IColumn* column, T min_value, T max_value) {
+    using CppType = typename PrimitiveTypeTraits<type>::CppType;
+    auto& data = assert_cast<typename PrimitiveTypeTraits<type>::ColumnType*>(column)->get_data();
+    data.push_back(static_cast<CppType>(min_value));
+    data.push_back(static_cast<CppType>(max_value));
+}
+
+// Only the integers and the floating numbers are decoded, the statistics of the binary columns
+// may be truncated, and the min and the max of them may be not the values in the row group.
+template <typename T>
+bool decode_min_max(const tparquet::Statistics& statistic, T* min_value, T* max_value) {
+    if (statistic.min_value.size() != sizeof(T) || statistic.max_value.size() != sizeof(T)) {
+        return false;
+    }
+    memcpy(min_value, statistic.min_value.data(), sizeof(T));
+    memcpy(max_value, statistic.max_value.data(), sizeof(T));
+    if constexpr (std::is_floating_point_v<T>) {
+        return !std::isnan(*min_value) && !std::isnan(*max_value);
+    }
+    return true;
+}
+
+bool fill_min_max(const FieldSchema* col_schema, const tparquet::Statistics& statistic,
+                  PrimitiveType type, IColumn* column) {
+    const auto& schema = col_schema->parquet_schema;
+    if ((schema.__isset.logicalType && schema.logicalType.__isset.INTEGER &&
+         !schema.logicalType.INTEGER.isSigned) ||
+        (schema.__isset.converted_type &&
+         (schema.converted_type == tparquet::ConvertedType::UINT_8 ||
+          schema.converted_type == tparquet::ConvertedType::UINT_16 ||
+          schema.converted_type == tparquet::ConvertedType::UINT_32 ||
+          schema.converted_type == tparquet::ConvertedType::UINT_64))) {
+        // the statistics of unsigned integers are in unsigned order
+        return false;
+    }
+    switch (type) {
+    case TYPE_TINYINT:
+        [[fallthrough]];
+    case TYPE_SMALLINT:
+        [[fallthrough]];
+    case TYPE_INT: {
+        int32_t min_value = 0;
+        int32_t max_value = 0;
+        if (col_schema->physical_type != tparquet::Type::INT32 ||
+            !decode_min_max(statistic, &min_value, &max_value)) {
+            return false;
+        }
+        if (type == TYPE_TINYINT) {
+            if (min_value < std::numeric_limits<int8_t>::min() ||
+                max_value > std::numeric_limits<int8_t>::max()) {
+                return false;
+            }
+            insert_min_max<TYPE_TINYINT>(column, min_value, max_value);
+        } else if (type == TYPE_SMALLINT) {
+            if (min_value < std::numeric_limits<int16_t>::min() ||
+                max_value > std::numeric_limits<int16_t>::max()) {
+                return false;
+            }
+            insert_min_max<TYPE_SMALLINT>(column, min_value, max_value);
+        } else {
+            insert_min_max<TYPE_INT>(column, min_value, max_value);
+        }
+        return true;
+    }
+    case TYPE_BIGINT: {
+        if (col_schema->physical_type == tparquet::Type::INT32) {
+            int32_t min_value = 0;
+            int32_t max_value = 0;
+            if (!decode_min_max(statistic, &min_value, &max_value)) {
+                return false;
+            }
+            insert_min_max<TYPE_BIGINT>(column, min_value, max_value);
+            return true;
+        }
+        int64_t min_value = 0;
+        int64_t max_value = 0;
+        if (col_schema->physical_type != tparquet::Type::INT64 ||
+            !decode_min_max(statistic, &min_value, &max_value)) {
+            return false;
+        }
+        insert_min_max<TYPE_BIGINT>(column, min_value, max_value);
+        return true;
+    }
+    case TYPE_FLOAT: {
+        float min_value = 0;
+        float max_value = 0;
+        if (col_schema->physical_type != tparquet::Type::FLOAT ||
+            !decode_min_max(statistic, &min_value, &max_value)) {
+            return false;
+        }
+        insert_min_max<TYPE_FLOAT>(column, min_value, max_value);
+        return true;
+    }
+    case TYPE_DOUBLE: {
+        if (col_schema->physical_type == tparquet::Type::FLOAT) {
+            float min_value = 0;
+            float max_value = 0;
+            if (!decode_min_max(statistic, &min_value, &max_value)) {
+                return false;
+            }
+            insert_min_max<TYPE_DOUBLE>(column, min_value, max_value);
+            return true;
+        }
+        double min_value = 0;
+        double max_value = 0;
+        if (col_schema->physical_type != tparquet::Type::DOUBLE ||
+            !decode_min_max(statistic, &min_value, &max_value)) {
+            return false;
+        }
+        insert_min_max<TYPE_DOUBLE>(column, min_value, max_value);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
+bool ParquetReader::_fill_min_max_by_statistics(const tparquet::RowGroup& row_group,
+                                                Block* block) {
+    // The columns are decoded first, so the block is untouched if any of them can't be.
+    std::vector<std::pair<std::string, MutableColumnPtr>> min_max_columns;
+    for (const auto& table_col_name : _read_table_columns) {
+        if (!_table_info_node_ptr->children_column_exists(table_col_name)) {
+            return false;
+        }
+        auto file_col_name = _table_info_node_ptr->children_file_column_name(table_col_name);
+        const FieldSchema* col_schema = _file_metadata->schema().get_column(file_col_name);
+        if (col_schema == nullptr || col_schema->physical_column_index < 0) {
+            return false;
+        }
+        const auto& statistic =
+                row_group.columns[col_schema->physical_column_index].meta_data.statistics;
+        if (!statistic.__isset.min_value || !statistic.__isset.max_value) {
+            return false;
+        }
+        DataTypePtr type = remove_nullable(block->get_by_name(table_col_name).type);
+        MutableColumnPtr column = type->create_column();
+        if (!fill_min_max(col_schema, statistic, type->get_primitive_type(), column.get())) {
+            return false;
+        }
+        min_max_columns.emplace_back(table_col_name, std::move(column));
+    }
+    for (auto& [table_col_name, min_max_column] : min_max_columns) {
+        auto& column_with_type_and_name = block->get_by_name(table_col_name);
+        MutableColumnPtr column = column_with_type_and_name.column->assume_mutable();
+        if (column->is_nullable()) {
+            auto& nullable_column = assert_cast<ColumnNullable&>(*column);
+            auto& null_map = nullable_column.get_null_map_data();
+            nullable_column.get_nested_column().insert_range_from(*min_max_column, 0, 2);
+            null_map.resize_fill(null_map.size() + 2, 0);
+        } else {
+            column->insert_range_from(*min_max_column, 0, 2);
+        }
+    }
+    return true;
+}
+
 void ParquetReader::_init_chunk_dicts() {}
 
 Status ParquetReader::_process_dict_filter(bool* filter_group) {
@@ -1026,7 +1306,11 @@ void ParquetReader::_collect_profile() {
         _current_group_reader->collect_profile_before_close();
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.filtered_row_groups_by_topn,
+                   _statistics.filtered_row_groups_by_topn);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
+    COUNTER_UPDATE(_parquet_profile.row_groups_read_by_statistics,
+                   _statistics.row_groups_read_by_statistics);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
     COUNTER_UPDATE(_parquet_profile.lazy_read_filtered_rows, _statistics.lazy_read_filtered_rows);
@@ -62,6 +62,7 @@ namespace vectorized {
 class Block;
 class FileMetaData;
 class PageIndex;
+class RuntimePredicate;
 class ShardedKVCache;
 class VExprContext;
 } // namespace vectorized
@@ -75,7 +76,9 @@ class ParquetReader : public GenericReader {
 public:
     struct Statistics {
         int32_t filtered_row_groups = 0;
+        int32_t filtered_row_groups_by_topn = 0;
         int32_t read_row_groups = 0;
+        int32_t row_groups_read_by_statistics = 0;
         int64_t filtered_group_rows = 0;
         int64_t filtered_page_rows = 0;
         int64_t lazy_read_filtered_rows = 0;
@@ -163,7 +166,9 @@ protected:
 private:
     struct ParquetProfile {
         RuntimeProfile::Counter* filtered_row_groups = nullptr;
+        RuntimeProfile::Counter* filtered_row_groups_by_topn = nullptr;
         RuntimeProfile::Counter* to_read_row_groups = nullptr;
+        RuntimeProfile::Counter* row_groups_read_by_statistics = nullptr;
         RuntimeProfile::Counter* filtered_group_rows = nullptr;
         RuntimeProfile::Counter* filtered_page_rows = nullptr;
         RuntimeProfile::Counter* lazy_read_filtered_rows = nullptr;
@@ -219,6 +224,12 @@ private:
                                        bool* filter_group);
     Status _process_row_group_filter(const RowGroupReader::RowGroupIndex& row_group_index,
                                      const tparquet::RowGroup& row_group, bool* filter_group);
+    // TopN Filter
+    void _init_topn_filters();
+    bool _filter_row_group_by_topn(const tparquet::RowGroup& row_group);
+    // For the MINMAX push down aggregation, fill the min and the max of each read column into two
+    // rows of `block` if the statistics of the row group have all of them.
+    bool _fill_min_max_by_statistics(const tparquet::RowGroup& row_group, Block* block);
     void _init_chunk_dicts();
     Status _process_dict_filter(bool* filter_group);
     void _init_bloom_filter();
@@ -305,6 +316,9 @@ private:
     const VExprContextSPtrs* _not_single_slot_filter_conjuncts = nullptr;
     const std::unordered_map<int, VExprContextSPtrs>* _slot_id_to_filter_conjuncts = nullptr;
     std::unordered_map<tparquet::Type::type, bool> _ignored_stats;
+    // The TopN filters on the read columns, the threshold of a TopN tightens while the scan is
+    // running, so they are checked against the statistics of a row group right before it is read.
+    std::vector<std::pair<std::string, const RuntimePredicate*>> _topn_filters;
 
     std::vector<std::vector<RowRange>> _read_line_mode_row_ranges;
     std::pair<std::shared_ptr<RowIdColumnIteratorV2>, int> _row_id_column_iterator_pair = {nullptr,
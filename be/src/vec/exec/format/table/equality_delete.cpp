@@ -17,7 +17,10 @@
 
 #include "vec/exec/format/table/equality_delete.h"
 
+#include <algorithm>
+
 #include "exprs/create_predicate_function.h"
+#include "util/bit_util.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
@@ -98,8 +101,16 @@ Status MultiEqualityDelete::_build_set() {
     for (ColumnPtr column : _delete_block->get_columns()) {
         column->update_hashes_with_value(_delete_hashes.data(), nullptr);
     }
+    // twice the buckets of the rows keeps the chains short and most of the buckets empty
+    auto num_buckets = static_cast<size_t>(BitUtil::next_power_of_two(
+            std::max<int64_t>(2 * static_cast<int64_t>(rows), 16)));
+    _bucket_mask = num_buckets - 1;
+    _bucket_first.assign(num_buckets, 0);
+    _bucket_next.assign(rows, 0);
     for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+        auto& first = _bucket_first[_delete_hashes[i] & _bucket_mask];
+        _bucket_next[i] = first;
+        first = static_cast<uint32_t>(i + 1);
     }
     _data_column_index.resize(_delete_block->columns());
     return Status::OK();
@@ -137,11 +148,13 @@ Status MultiEqualityDelete::filter_data_block(Block* data_block) {
         _filter->assign(rows, UInt8(1));
     }
     auto* filter_data = _filter->data();
+    const auto* bucket_first = _bucket_first.data();
+    const auto* bucket_next = _bucket_next.data();
     for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
+        uint64_t hash = _data_hashes[i];
+        for (uint32_t row = bucket_first[hash & _bucket_mask]; row != 0;
+             row = bucket_next[row - 1]) {
+            if (_delete_hashes[row - 1] == hash && _equal(data_block, i, row - 1)) {
                 filter_data[i] = 0;
                 break;
             }
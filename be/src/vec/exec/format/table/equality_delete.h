@@ -27,8 +27,8 @@ namespace doris::vectorized {
  * If there's only one delete column in delete file, use `SimpleEqualityDelete`,
  * which uses optimized `HybridSetBase` to build the hash set.
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
- * which generates a hash column from all delete columns, and only compare the values
- * when the hash values are the same.
+ * which generates a hash column from all delete columns, probes a chained hash table with the
+ * hash column like the hash join, and only compare the values when the hash values are the same.
  */
 class EqualityDeleteBase {
 protected:
@@ -85,10 +85,13 @@ protected:
     std::vector<uint64_t> _delete_hashes;
     // hash column for data block
     std::vector<uint64_t> _data_hashes;
-    // hash code => row index
-    // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
+    // hash code => row index, if hash values are equal, then compare the real values.
+    // `_bucket_first[hash & _bucket_mask]` is the first delete row of the bucket, and
+    // `_bucket_next[row]` is the next delete row of the same bucket, both are row index + 1,
+    // and 0 ends the chain. Most rows of the data block stop at an empty bucket.
+    std::vector<uint32_t> _bucket_first;
+    std::vector<uint32_t> _bucket_next;
+    uint64_t _bucket_mask = 0;
     // the delete column indexes in data block
     std::vector<size_t> _data_column_index;
     std::unique_ptr<IColumn::Filter> _filter;
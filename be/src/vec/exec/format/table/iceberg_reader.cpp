@@ -146,51 +146,35 @@ Status IcebergTableReader::_equality_delete_base(
     bool init_schema = false;
     std::vector<std::string> equality_delete_col_names;
     std::vector<DataTypePtr> equality_delete_col_types;
-    std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
-            partition_columns;
-    std::unordered_map<std::string, VExprContextSPtr> missing_columns;
 
     for (const auto& delete_file : delete_files) {
-        TFileRangeDesc delete_desc;
-        // must use __set() method to make sure __isset is true
-        delete_desc.__set_fs_name(_range.fs_name);
-        delete_desc.path = delete_file.path;
-        delete_desc.start_offset = 0;
-        delete_desc.size = -1;
-        delete_desc.file_size = -1;
-        std::unique_ptr<GenericReader> delete_reader = _create_equality_reader(delete_desc);
+        SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+        Status create_status = Status::OK();
+        // an equality delete file usually covers many data files, so it's read once per scan node
+        auto* delete_block = _kv_cache->get<Block>(
+                _equality_delete_file_cache_key(delete_file.path), [&]() -> Block* {
+                    auto block = std::make_unique<Block>();
+                    create_status = _read_equality_delete_file(delete_file.path, block.get());
+                    if (!create_status.ok()) {
+                        return nullptr;
+                    }
+                    return block.release();
+                });
+        RETURN_IF_ERROR(create_status);
         if (!init_schema) {
-            RETURN_IF_ERROR(delete_reader->init_schema_reader());
-            RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
-                                                             &equality_delete_col_types));
+            equality_delete_col_names = delete_block->get_names();
+            equality_delete_col_types = delete_block->get_data_types();
             _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
+        } else if (delete_block->get_names() != equality_delete_col_names) {
+            return Status::InternalError(
+                    "Equality delete file {} has different delete columns from the other ones",
+                    delete_file.path);
         }
-        if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(parquet_reader->init_reader(
-                    equality_delete_col_names, nullptr, {}, nullptr, nullptr, nullptr, nullptr,
-                    nullptr, TableSchemaChangeHelper::ConstNode::get_instance(), false));
-        } else if (auto* orc_reader = typeid_cast<OrcReader*>(delete_reader.get())) {
-            RETURN_IF_ERROR(orc_reader->init_reader(&equality_delete_col_names, nullptr, {}, false,
-                                                    {}, {}, nullptr, nullptr));
-        } else {
-            return Status::InternalError("Unsupported format of delete file");
-        }
-
-        RETURN_IF_ERROR(delete_reader->set_fill_columns(partition_columns, missing_columns));
-
-        bool eof = false;
-        while (!eof) {
-            Block block;
-            _generate_equality_delete_block(&block, equality_delete_col_names,
-                                            equality_delete_col_types);
-            size_t read_rows = 0;
-            RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
-            if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
-                RETURN_IF_ERROR(mutable_block.merge(block));
-            }
+        if (delete_block->rows() > 0) {
+            MutableBlock mutable_block(&_equality_delete_block);
+            RETURN_IF_ERROR(mutable_block.merge(*delete_block));
         }
     }
     for (int i = 0; i < equality_delete_col_names.size(); ++i) {
@@ -210,6 +194,54 @@ Status IcebergTableReader::_equality_delete_base(
     return _equality_delete_impl->init(_profile);
 }
 
+Status IcebergTableReader::_read_equality_delete_file(const std::string& path,
+                                                      Block* delete_block) {
+    TFileRangeDesc delete_desc;
+    // must use __set() method to make sure __isset is true
+    delete_desc.__set_fs_name(_range.fs_name);
+    delete_desc.path = path;
+    delete_desc.start_offset = 0;
+    delete_desc.size = -1;
+    delete_desc.file_size = -1;
+    std::unique_ptr<GenericReader> delete_reader = _create_equality_reader(delete_desc);
+    std::vector<std::string> equality_delete_col_names;
+    std::vector<DataTypePtr> equality_delete_col_types;
+    std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
+            partition_columns;
+    std::unordered_map<std::string, VExprContextSPtr> missing_columns;
+    RETURN_IF_ERROR(delete_reader->init_schema_reader());
+    RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
+                                                     &equality_delete_col_types));
+    _generate_equality_delete_block(delete_block, equality_delete_col_names,
+                                    equality_delete_col_types);
+    if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
+        RETURN_IF_ERROR(parquet_reader->init_reader(
+                equality_delete_col_names, nullptr, {}, nullptr, nullptr, nullptr, nullptr,
+                nullptr, TableSchemaChangeHelper::ConstNode::get_instance(), false));
+    } else if (auto* orc_reader = typeid_cast<OrcReader*>(delete_reader.get())) {
+        RETURN_IF_ERROR(orc_reader->init_reader(&equality_delete_col_names, nullptr, {}, false, {},
+                                                {}, nullptr, nullptr));
+    } else {
+        return Status::InternalError("Unsupported format of delete file");
+    }
+
+    RETURN_IF_ERROR(delete_reader->set_fill_columns(partition_columns, missing_columns));
+
+    bool eof = false;
+    while (!eof) {
+        Block block;
+        _generate_equality_delete_block(&block, equality_delete_col_names,
+                                        equality_delete_col_types);
+        size_t read_rows = 0;
+        RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
+        if (read_rows > 0) {
+            MutableBlock mutable_block(delete_block);
+            RETURN_IF_ERROR(mutable_block.merge(block));
+        }
+    }
+    return Status::OK();
+}
+
 void IcebergTableReader::_generate_equality_delete_block(
         Block* block, const std::vector<std::string>& equality_delete_col_names,
         const std::vector<DataTypePtr>& equality_delete_col_types) {
@@ -111,10 +111,15 @@ protected:
     PositionDeleteRange _get_range(const ColumnString& file_path_column);
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
+    static std::string _equality_delete_file_cache_key(const std::string& path) {
+        return "equality_delete_" + path;
+    }
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    // Read all the rows of an equality delete file into `delete_block`.
+    Status _read_equality_delete_file(const std::string& path, Block* delete_block);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -17,11 +17,14 @@
 
 #include "jni_connector.h"
 
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
 #include <glog/logging.h>
 
 #include <sstream>
 #include <variant>
 
+#include "common/config.h"
 #include "jni.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/runtime_state.h"
@@ -37,6 +40,7 @@
 #include "vec/data_types/data_type_map.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_struct.h"
+#include "vec/data_types/serde/data_type_serde.h"
 
 namespace doris {
 class RuntimeProfile;
@@ -117,6 +121,9 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     // return the address of meta information
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
+    if (_jni_scanner_get_next_arrow_batch != nullptr) {
+        return _get_next_arrow_block(env, block, read_rows, eof);
+    }
     long meta_address = 0;
     {
         SCOPED_RAW_TIMER(&_java_scan_watcher);
@@ -145,6 +152,67 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     return Status::OK();
 }
 
+Status JniConnector::_get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows,
+                                           bool* eof) {
+    // Call org.apache.doris.common.jni.JniScanner#getNextArrowBatch
+    // java side exports the batch into the c structs and returns the number of rows
+    struct ArrowArray c_array {};
+    struct ArrowSchema c_schema {};
+    long num_rows = 0;
+    {
+        SCOPED_RAW_TIMER(&_java_scan_watcher);
+        num_rows = env->CallLongMethod(_jni_scanner_obj, _jni_scanner_get_next_arrow_batch,
+                                       reinterpret_cast<jlong>(&c_array),
+                                       reinterpret_cast<jlong>(&c_schema));
+    }
+    Status st = JniUtil::GetJniExceptionMsg(env);
+    if (!st.ok() || num_rows == 0) {
+        if (c_array.release != nullptr) {
+            c_array.release(&c_array);
+        }
+        if (c_schema.release != nullptr) {
+            c_schema.release(&c_schema);
+        }
+        RETURN_IF_ERROR(st);
+        *read_rows = 0;
+        *eof = true;
+        return Status::OK();
+    }
+
+    SCOPED_RAW_TIMER(&_fill_block_watcher);
+    // both c structs are released by ImportRecordBatch, even if it fails
+    auto batch_result = arrow::ImportRecordBatch(&c_array, &c_schema);
+    if (!batch_result.ok()) {
+        return Status::InternalError("Failed to import arrow batch of {}: {}", _connector_name,
+                                     batch_result.status().ToString());
+    }
+    std::shared_ptr<arrow::RecordBatch> batch = std::move(batch_result).ValueUnsafe();
+    if (batch->num_rows() != num_rows) {
+        return Status::InternalError("Arrow batch of {} has {} rows, but {} rows are returned",
+                                     _connector_name, batch->num_rows(), num_rows);
+    }
+    for (const auto& column_name : _column_names) {
+        std::shared_ptr<arrow::Array> arrow_column = batch->GetColumnByName(column_name);
+        if (arrow_column == nullptr) {
+            return Status::InternalError("Column {} is not found in arrow batch of {}",
+                                         column_name, _connector_name);
+        }
+        auto& column_with_type_and_name = block->get_by_name(column_name);
+        try {
+            RETURN_IF_ERROR(column_with_type_and_name.type->get_serde()->read_column_from_arrow(
+                    column_with_type_and_name.column->assume_mutable_ref(), arrow_column.get(), 0,
+                    num_rows, _state->timezone_obj()));
+        } catch (Exception& e) {
+            return Status::InternalError("Failed to convert arrow column {}: {}", column_name,
+                                         e.what());
+        }
+    }
+    *read_rows = num_rows;
+    *eof = false;
+    _has_read += num_rows;
+    return Status::OK();
+}
+
 Status JniConnector::get_table_schema(std::string& table_schema_str) {
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
@@ -275,6 +343,16 @@ Status JniConnector::_init_jni_scanner(JNIEnv* env, int batch_size) {
     _jni_scanner_get_statistics =
             env->GetMethodID(_jni_scanner_cls, "getStatistics", "()Ljava/util/Map;");
     RETURN_ERROR_IF_EXC(env);
+    if (config::enable_jni_arrow_batch && !_is_table_schema) {
+        // Only the scanners with arrow vectors implement it, and NoSuchMethodError is thrown
+        // by the others.
+        _jni_scanner_get_next_arrow_batch =
+                env->GetMethodID(_jni_scanner_cls, "getNextArrowBatch", "(JJ)J");
+        if (env->ExceptionCheck()) {
+            env->ExceptionClear();
+            _jni_scanner_get_next_arrow_batch = nullptr;
+        }
+    }
     RETURN_IF_ERROR(JniUtil::LocalToGlobalRef(env, jni_scanner_obj, &_jni_scanner_obj));
     env->DeleteLocalRef(jni_scanner_obj);
     RETURN_ERROR_IF_EXC(env);
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <arrow/c/abi.h>
 #include <jni.h>
 #include <string.h>
 
@@ -307,6 +308,8 @@ private:
     jmethodID _jni_scanner_get_append_data_time = nullptr;
     jmethodID _jni_scanner_get_create_vector_table_time = nullptr;
     jmethodID _jni_scanner_get_next_batch = nullptr;
+    // Optional, nullptr if the scanner doesn't export the batches by Arrow C Data Interface
+    jmethodID _jni_scanner_get_next_arrow_batch = nullptr;
     jmethodID _jni_scanner_get_table_schema = nullptr;
     jmethodID _jni_scanner_close = nullptr;
     jmethodID _jni_scanner_release_column = nullptr;
@@ -327,6 +330,13 @@ private:
 
     Status _fill_block(Block* block, size_t num_rows);
 
+    /**
+     * Fill the block by the batch exported by
+     * org.apache.doris.common.jni.JniScanner#getNextArrowBatch.
+     * The buffers of java side are released when the imported batch is destroyed.
+     */
+    Status _get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows, bool* eof);
+
     static Status _fill_column(TableMetaAddress& address, ColumnPtr& doris_column,
                                DataTypePtr& data_type, size_t num_rows);
 
@@ -1609,6 +1609,15 @@ void FileScanner::try_stop() {
     }
 }
 
+void FileScanner::update_realtime_counters() {
+    // the file cache counters go into the profile on close, so only their increments are
+    // rolled up here
+    int64_t file_cache_bytes =
+            _file_cache_statistics->bytes_read_from_local - _reported_file_cache_bytes;
+    _reported_file_cache_bytes = _file_cache_statistics->bytes_read_from_local;
+    _update_storage_io_counters(file_cache_bytes, _file_cache_statistics.get());
+}
+
 void FileScanner::_collect_profile_before_close() {
     Scanner::_collect_profile_before_close();
     if (config::enable_file_cache && _state->query_options().enable_file_cache &&
@@ -74,6 +74,8 @@ public:
 
     void try_stop() override;
 
+    void update_realtime_counters() override;
+
     Status prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts) override;
 
     std::string get_name() override { return FileScanner::NAME; }
@@ -180,6 +182,8 @@ protected:
     Block _runtime_filter_partition_prune_block;
 
     std::unique_ptr<io::FileCacheStatistics> _file_cache_statistics;
+    // bytes read from the file cache rolled up into the query statistics
+    int64_t _reported_file_cache_bytes = 0;
     std::unique_ptr<io::IOContext> _io_ctx;
 
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
@@ -60,6 +60,7 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/string_util.h"
 #include "vec/common/schema_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/scan_node.h"
@@ -372,6 +373,7 @@ Status OlapScanner::_init_tablet_reader_params(
     }
 
     _tablet_reader_params.use_page_cache = _state->enable_page_cache();
+    _tablet_reader_params.disposable_file_cache = _use_disposable_file_cache();
 
     if (tablet->enable_unique_key_merge_on_write() && !_state->skip_delete_bitmap()) {
         _tablet_reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
@@ -431,6 +433,33 @@ Status OlapScanner::_init_tablet_reader_params(
     return Status::OK();
 }
 
+bool OlapScanner::_use_disposable_file_cache() const {
+    if (config::file_cache_disposable_scan_bytes >= 0) {
+        int64_t scan_bytes = 0;
+        for (const auto& rs_split : _tablet_reader_params.rs_splits) {
+            scan_bytes += rs_split.rs_reader->rowset()->data_disk_size();
+        }
+        if (scan_bytes > config::file_cache_disposable_scan_bytes) {
+            return true;
+        }
+    }
+    std::string workload_groups = config::file_cache_disposable_workload_groups;
+    if (workload_groups.empty()) {
+        return false;
+    }
+    auto wg = _state->get_query_ctx()->workload_group();
+    if (wg == nullptr) {
+        return false;
+    }
+    std::string wg_name = wg->name();
+    for (const auto& name : split(workload_groups, ",")) {
+        if (trim(name) == wg_name) {
+            return true;
+        }
+    }
+    return false;
+}
+
 Status OlapScanner::_init_variant_columns() {
     auto& tablet_schema = _tablet_reader_params.tablet_schema;
     if (tablet_schema->num_variant_columns() == 0) {
@@ -543,6 +572,7 @@ void OlapScanner::update_realtime_counters() {
     COUNTER_UPDATE(local_state->_read_compressed_counter, stats.compressed_bytes_read);
     COUNTER_UPDATE(local_state->_scan_bytes, stats.uncompressed_bytes_read);
     COUNTER_UPDATE(local_state->_scan_rows, stats.raw_rows_read);
+    COUNTER_UPDATE(local_state->_cached_pages_bytes_counter, stats.cached_pages_bytes);
 
     // Make sure the scan bytes and scan rows counter in audit log is the same as the counter in
     // doris metrics.
@@ -553,10 +583,14 @@ void OlapScanner::update_realtime_counters() {
     _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_rows(stats.raw_rows_read);
     _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes(
             stats.uncompressed_bytes_read);
-    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_local_storage(
-            stats.file_cache_stats.bytes_read_from_local);
-    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_remote_storage(
-            stats.file_cache_stats.bytes_read_from_remote);
+    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_bytes_from_page_cache(
+            stats.cached_pages_bytes);
+    _update_storage_io_counters(stats.file_cache_stats.bytes_read_from_local,
+                                &_tablet_reader->mutable_stats()->file_cache_stats);
+    if (auto wg = _state->get_query_ctx()->workload_group(); wg != nullptr) {
+        wg->update_file_cache_io(stats.file_cache_stats.bytes_read_from_local,
+                                 stats.file_cache_stats.bytes_read_from_remote);
+    }
 
     // In case of no cache, we still need to update the IO stats. uncompressed bytes read == local + remote
     if (stats.file_cache_stats.bytes_read_from_local == 0 &&
@@ -573,6 +607,7 @@ void OlapScanner::update_realtime_counters() {
     _tablet_reader->mutable_stats()->compressed_bytes_read = 0;
     _tablet_reader->mutable_stats()->uncompressed_bytes_read = 0;
     _tablet_reader->mutable_stats()->raw_rows_read = 0;
+    _tablet_reader->mutable_stats()->cached_pages_bytes = 0;
     _tablet_reader->mutable_stats()->file_cache_stats.bytes_read_from_local = 0;
     _tablet_reader->mutable_stats()->file_cache_stats.bytes_read_from_remote = 0;
 }
@@ -603,6 +638,7 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_scan_rows, stats.raw_rows_read);
     COUNTER_UPDATE(local_state->_vec_cond_timer, stats.vec_cond_ns);
     COUNTER_UPDATE(local_state->_short_cond_timer, stats.short_cond_ns);
+    COUNTER_UPDATE(local_state->_predicate_reorder_counter, stats.predicate_reorder_num);
     COUNTER_UPDATE(local_state->_expr_filter_timer, stats.expr_filter_ns);
     COUNTER_UPDATE(local_state->_block_init_timer, stats.block_init_ns);
     COUNTER_UPDATE(local_state->_block_init_seek_timer, stats.block_init_seek_ns);
@@ -648,6 +684,9 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_key_range_filtered_counter, stats.rows_key_range_filtered);
     COUNTER_UPDATE(local_state->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(local_state->_cached_pages_num_counter, stats.cached_pages_num);
+    COUNTER_UPDATE(local_state->_compressed_cached_pages_num_counter,
+                   stats.compressed_cached_pages_num);
+    COUNTER_UPDATE(local_state->_coalesced_read_ranges_counter, stats.coalesced_read_ranges);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_counter, stats.rows_bitmap_index_filtered);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_timer, stats.bitmap_index_filter_timer);
     COUNTER_UPDATE(local_state->_inverted_index_filter_counter, stats.rows_inverted_index_filtered);
@@ -675,6 +714,10 @@ void OlapScanner::_collect_profile_before_close() {
                    stats.inverted_index_searcher_cache_miss);
     COUNTER_UPDATE(local_state->_inverted_index_downgrade_count_counter,
                    stats.inverted_index_downgrade_count);
+    COUNTER_UPDATE(local_state->_inverted_index_conjunction_bitmap_terms_counter,
+                   stats.inverted_index_conjunction_bitmap_terms);
+    COUNTER_UPDATE(local_state->_inverted_index_conjunction_skip_terms_counter,
+                   stats.inverted_index_conjunction_skip_terms);
 
     InvertedIndexProfileReporter inverted_index_profile;
     inverted_index_profile.update(local_state->_index_filter_profile.get(),
@@ -89,6 +89,9 @@ private:
                                       const pipeline::FilterPredicates& filter_predicates,
                                       const std::vector<FunctionFilter>& function_filters);
 
+    // Whether the data read is cached as disposable, for a large scan or a batch query.
+    bool _use_disposable_file_cache() const;
+
     [[nodiscard]] Status _init_return_columns();
     [[nodiscard]] Status _init_variant_columns();
 
@@ -251,12 +251,29 @@ void Scanner::_collect_profile_before_close() {
     _state->update_num_rows_load_unselected(_counter.num_rows_unselected);
 }
 
-void Scanner::update_scan_cpu_timer() {
+void Scanner::_update_storage_io_counters(int64_t file_cache_bytes,
+                                          io::FileCacheStatistics* stats) {
+    COUNTER_UPDATE(_local_state->_scan_bytes_from_local_disk, stats->bytes_read_from_local_disk);
+    COUNTER_UPDATE(_local_state->_scan_io_from_local_disk, stats->num_local_disk_io_total);
+    COUNTER_UPDATE(_local_state->_scan_bytes_from_remote_storage,
+                   stats->bytes_read_from_remote_storage);
+    COUNTER_UPDATE(_local_state->_scan_io_from_remote_storage,
+                   stats->num_remote_storage_io_total);
+    _state->get_query_ctx()->resource_ctx()->io_context()->update_scan_io(file_cache_bytes,
+                                                                          *stats);
+    stats->bytes_read_from_local_disk = 0;
+    stats->num_local_disk_io_total = 0;
+    stats->bytes_read_from_remote_storage = 0;
+    stats->num_remote_storage_io_total = 0;
+}
+
+int64_t Scanner::update_scan_cpu_timer() {
     int64_t cpu_time = _cpu_watch.elapsed_time();
     _scan_cpu_timer += cpu_time;
     if (_state && _state->get_query_ctx()) {
         _state->get_query_ctx()->resource_ctx()->cpu_context()->update_cpu_cost_ms(cpu_time);
     }
+    return cpu_time;
 }
 
 } // namespace doris::vectorized
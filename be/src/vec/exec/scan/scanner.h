@@ -103,6 +103,10 @@ protected:
     // Update the counters before closing this scanner
     virtual void _collect_profile_before_close();
 
+    // Roll the io of the file readers up into the scan operator and the query, the local disk
+    // and the remote storage io of `stats` are reset.
+    void _update_storage_io_counters(int64_t file_cache_bytes, io::FileCacheStatistics* stats);
+
     // Filter the output block finally.
     Status _filter_output_block(Block* block);
 
@@ -134,7 +138,8 @@ public:
 
     int64_t get_scanner_wait_worker_timer() const { return _scanner_wait_worker_timer; }
 
-    void update_scan_cpu_timer();
+    // Return the cpu time since start_scan_cpu_timer().
+    int64_t update_scan_cpu_timer();
 
     // Some counters need to be updated realtime, for example, workload group policy need
     // scan bytes to cancel the query exceed limit.
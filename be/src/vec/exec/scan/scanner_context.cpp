@@ -22,6 +22,7 @@
 #include <glog/logging.h>
 #include <zconf.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <ctime>
 #include <memory>
@@ -114,6 +115,7 @@ Status ScannerContext::init() {
         _scanner_scheduler = _state->get_query_ctx()->get_scan_scheduler();
     } else {
         _scanner_scheduler = _state->get_query_ctx()->get_remote_scan_scheduler();
+        _is_remote_scan = true;
     }
 #endif
     // _max_bytes_in_queue controls the maximum memory that can be used by a single scan operator.
@@ -453,10 +455,28 @@ void ScannerContext::update_peak_running_scanner(int num) {
     _local_state->_peak_running_scanner->add(num);
 }
 
+int32_t ScannerContext::_io_wait_scale() const {
+    // the local scanners are cpu bound, their wall time is mostly the wait for a cpu
+    if (!_is_remote_scan || config::remote_scan_concurrency_max_io_wait_scale <= 1) {
+        return 1;
+    }
+    int64_t wall_time = _scan_wall_time.load(std::memory_order_relaxed);
+    int64_t cpu_time = _scan_cpu_time.load(std::memory_order_relaxed);
+    // not enough samples yet
+    if (cpu_time <= 0 || wall_time < 100 * NANOS_PER_MILLIS) {
+        return 1;
+    }
+    return static_cast<int32_t>(std::clamp<int64_t>(
+            wall_time / cpu_time, 1, config::remote_scan_concurrency_max_io_wait_scale));
+}
+
 int32_t ScannerContext::_get_margin(std::unique_lock<std::mutex>& transfer_lock,
                                     std::unique_lock<std::shared_mutex>& scheduler_lock) {
+    const int32_t io_wait_scale = _io_wait_scale();
+    const int32_t min_scan_concurrency =
+            std::min(_min_scan_concurrency * io_wait_scale, _max_scan_concurrency * io_wait_scale);
     // margin_1 is used to ensure each scan operator could have at least _min_scan_concurrency scan tasks.
-    int32_t margin_1 = _min_scan_concurrency - (_tasks_queue.size() + _num_scheduled_scanners);
+    int32_t margin_1 = min_scan_concurrency - (_tasks_queue.size() + _num_scheduled_scanners);
 
     // margin_2 is used to ensure the scan scheduler could have at least _min_scan_concurrency_of_scan_scheduler scan tasks.
     int32_t margin_2 =
@@ -478,7 +498,7 @@ int32_t ScannerContext::_get_margin(std::unique_lock<std::mutex>& transfer_lock,
     VLOG_DEBUG << fmt::format(
             "[{}|{}] schedule scan task, margin_1: {} = {} - ({} + {}), margin_2: {} = {} - "
             "({} + {}), margin: {}",
-            print_id(_query_id), ctx_id, margin_1, _min_scan_concurrency, _tasks_queue.size(),
+            print_id(_query_id), ctx_id, margin_1, min_scan_concurrency, _tasks_queue.size(),
             _num_scheduled_scanners, margin_2, _min_scan_concurrency_of_scan_scheduler,
             _scanner_scheduler->get_active_threads(), _scanner_scheduler->get_queue_size(), margin);
 
@@ -587,10 +607,11 @@ Status ScannerContext::_schedule_scan_task(std::shared_ptr<ScanTask> current_sca
 
 std::shared_ptr<ScanTask> ScannerContext::_pull_next_scan_task(
         std::shared_ptr<ScanTask> current_scan_task, int32_t current_concurrency) {
-    if (current_concurrency >= _max_scan_concurrency) {
+    const int32_t max_scan_concurrency = _max_scan_concurrency * _io_wait_scale();
+    if (current_concurrency >= max_scan_concurrency) {
         VLOG_DEBUG << fmt::format(
                 "ScannerContext {} current concurrency {} >= _max_scan_concurrency {}, skip pull",
-                ctx_id, current_concurrency, _max_scan_concurrency);
+                ctx_id, current_concurrency, max_scan_concurrency);
         return nullptr;
     }
 
@@ -151,6 +151,12 @@ public:
     // Push back a scan task.
     void push_back_scan_task(std::shared_ptr<ScanTask> scan_task);
 
+    // Record the wall time and the cpu time of a scan task run.
+    void update_scan_time(int64_t wall_time, int64_t cpu_time) {
+        _scan_wall_time.fetch_add(wall_time, std::memory_order_relaxed);
+        _scan_cpu_time.fetch_add(cpu_time, std::memory_order_relaxed);
+    }
+
     // Return true if this ScannerContext need no more process
     bool done() const { return _is_finished || _should_stop; }
 
@@ -246,6 +252,13 @@ protected:
     int32_t _min_scan_concurrency = 1;
     int32_t _max_scan_concurrency = 0;
 
+    // A remote scanner waits for the storage most of its time, so by Little's law it needs
+    // wall time / cpu time times of the concurrency to keep the same cpu busy.
+    bool _is_remote_scan = false;
+    std::atomic<int64_t> _scan_wall_time = 0;
+    std::atomic<int64_t> _scan_cpu_time = 0;
+    int32_t _io_wait_scale() const;
+
     Status _schedule_scan_task(std::shared_ptr<ScanTask> current_scan_task,
                                std::unique_lock<std::mutex>& transfer_lock,
                                std::unique_lock<std::shared_mutex>& scheduler_lock);
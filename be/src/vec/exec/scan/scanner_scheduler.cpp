@@ -263,7 +263,10 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
                 raw_bytes_read += free_block_bytes;
                 if (!scan_task->cached_blocks.empty() &&
                     scan_task->cached_blocks.back().first->rows() + free_block->rows() <=
-                            ctx->batch_size()) {
+                            ctx->batch_size() &&
+                    (config::scan_block_max_bytes <= 0 ||
+                     static_cast<int64_t>(scan_task->cached_blocks.back().first->bytes() +
+                                          free_block->bytes()) <= config::scan_block_max_bytes)) {
                     size_t block_size = scan_task->cached_blocks.back().first->allocated_bytes();
                     vectorized::MutableBlock mutable_block(
                             scan_task->cached_blocks.back().first.get());
@@ -328,7 +331,8 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
     }
     // WorkloadGroup Policy will check cputime realtime, so that should update the counter
     // as soon as possible, could not update it on close.
-    scanner->update_scan_cpu_timer();
+    int64_t cpu_time = scanner->update_scan_cpu_timer();
+    ctx->update_scan_time(max_run_time_watch.elapsed_time(), cpu_time);
     scanner->update_realtime_counters();
 
     if (eos) {
@@ -45,6 +45,65 @@ public:
     virtual TFileScanRangeParams* get_params() = 0;
 
 protected:
+    // Cut the parquet and orc ranges larger than config::file_scan_max_range_size into the ranges
+    // of that size, and make each of them a scan range, so they are read by different scanners and
+    // an idle scanner takes the remaining row groups of a large file from the shared queue.
+    // The readers read the row groups(stripes) whose middle(start) is in the range, so each row
+    // group is still read exactly once, and the footer is parsed once by the file meta cache.
+    template <typename T>
+    static std::vector<T> _split_large_ranges(const std::vector<T>& scan_ranges) {
+        const int64_t max_range_size = config::file_scan_max_range_size;
+        if (max_range_size <= 0) {
+            return scan_ranges;
+        }
+        std::vector<T> split_ranges;
+        split_ranges.reserve(scan_ranges.size());
+        for (const auto& scan_range : scan_ranges) {
+            const auto& file_scan_range = scan_range.scan_range.ext_scan_range.file_scan_range;
+            std::vector<TFileRangeDesc> kept_ranges;
+            std::vector<TFileRangeDesc> sub_ranges;
+            for (const auto& range : file_scan_range.ranges) {
+                auto format_type = range.__isset.format_type ? range.format_type
+                                   : file_scan_range.__isset.params
+                                           ? file_scan_range.params.format_type
+                                           : TFileFormatType::FORMAT_UNKNOWN;
+                if ((format_type != TFileFormatType::FORMAT_PARQUET &&
+                     format_type != TFileFormatType::FORMAT_ORC) ||
+                    range.size < 2 * max_range_size) {
+                    kept_ranges.push_back(range);
+                    continue;
+                }
+                int64_t start = range.start_offset;
+                int64_t end = range.start_offset + range.size;
+                while (start < end) {
+                    // the last one takes the tail smaller than max_range_size
+                    int64_t size = end - start < 2 * max_range_size ? end - start : max_range_size;
+                    auto& sub_range = sub_ranges.emplace_back(range);
+                    sub_range.__set_start_offset(start);
+                    sub_range.__set_size(size);
+                    start += size;
+                }
+            }
+            if (sub_ranges.empty()) {
+                split_ranges.push_back(scan_range);
+                continue;
+            }
+            if (!kept_ranges.empty()) {
+                auto& kept = split_ranges.emplace_back(scan_range);
+                kept.scan_range.ext_scan_range.file_scan_range.ranges = std::move(kept_ranges);
+            }
+            for (auto& sub_range : sub_ranges) {
+                auto& split = split_ranges.emplace_back(scan_range);
+                split.scan_range.ext_scan_range.file_scan_range.ranges = {std::move(sub_range)};
+            }
+        }
+        if (split_ranges.size() != scan_ranges.size()) {
+            LOG(INFO) << "Split " << scan_ranges.size() << " scan ranges to "
+                      << split_ranges.size();
+        }
+        return split_ranges;
+    }
+
     template <typename T>
     void _merge_ranges(std::vector<T>& merged_ranges, const std::vector<T>& scan_ranges) {
         if (scan_ranges.size() <= _max_scanners) {
@@ -104,7 +163,7 @@ private:
 public:
     LocalSplitSourceConnector(const std::vector<TScanRangeParams>& scan_ranges, int max_scanners) {
         _max_scanners = max_scanners;
-        _merge_ranges<TScanRangeParams>(_scan_ranges, scan_ranges);
+        _merge_ranges<TScanRangeParams>(_scan_ranges, _split_large_ranges(scan_ranges));
     }
 
     Status get_next(bool* has_next, TFileRangeDesc* range) override;
@@ -38,6 +38,7 @@ SkewedPartitionRebalancer::SkewedPartitionRebalancer(
                   std::max(min_partition_data_processed_rebalance_threshold,
                            min_data_processed_rebalance_threshold)),
           _partition_row_count(partition_count, 0),
+          _partition_data_processed(partition_count, 0),
           _data_processed(0),
           _data_processed_at_last_rebalance(0),
           _partition_data_size(partition_count, 0),
@@ -68,6 +69,11 @@ void SkewedPartitionRebalancer::add_partition_row_count(int partition, long row_
     _partition_row_count[partition] += row_count;
 }
 
+void SkewedPartitionRebalancer::add_partition_data_size(int partition, long data_size) {
+    _track_partition_data_size = true;
+    _partition_data_processed[partition] += data_size;
+}
+
 void SkewedPartitionRebalancer::rebalance() {
     long current_data_processed = _data_processed;
     if (_should_rebalance(current_data_processed)) {
@@ -76,6 +82,14 @@ void SkewedPartitionRebalancer::rebalance() {
 }
 
 void SkewedPartitionRebalancer::_calculate_partition_data_size(long data_processed) {
+    if (_track_partition_data_size) {
+        for (int partition = 0; partition < _partition_count; partition++) {
+            _partition_data_size[partition] =
+                    std::max(_partition_data_processed[partition], _partition_data_size[partition]);
+        }
+        return;
+    }
+
     long total_partition_row_count = 0;
     for (int partition = 0; partition < _partition_count; partition++) {
         total_partition_row_count += _partition_row_count[partition];
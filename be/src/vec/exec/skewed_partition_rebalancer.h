@@ -83,6 +83,9 @@ public:
     int get_task_id(int partition_id, int64_t index);
     void add_data_processed(long data_size);
     void add_partition_row_count(int partition, long row_count);
+    // Once it's called, the data sizes of the partitions are the tracked ones rather than the
+    // ones estimated by the row counts.
+    void add_partition_data_size(int partition, long data_size);
     void rebalance();
 
 private:
@@ -122,6 +125,8 @@ private:
     long _min_partition_data_processed_rebalance_threshold;
     long _min_data_processed_rebalance_threshold;
     std::vector<long> _partition_row_count;
+    bool _track_partition_data_size = false;
+    std::vector<long> _partition_data_processed;
     long _data_processed;
     long _data_processed_at_last_rebalance;
     std::vector<long> _partition_data_size;
@@ -22,6 +22,8 @@
 #include <gen_cpp/Types_types.h>
 
 #include <ostream>
+#include <set>
+#include <typeinfo>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -122,6 +124,9 @@ Status VectorizedFnCall::prepare(RuntimeState* state, const RowDescriptor& desc,
     if (fn().__isset.dict_function) {
         fn_ctx->set_dict_function(fn().dict_function);
     }
+    if (config::enable_fused_expr_execution) {
+        _fused_comparison = VFusedComparison::create(*this);
+    }
     return Status::OK();
 }
 
@@ -232,6 +237,34 @@ Status VectorizedFnCall::execute_runtime_filter(doris::vectorized::VExprContext*
 
 Status VectorizedFnCall::execute(VExprContext* context, vectorized::Block* block,
                                  int* result_column_id) {
+    auto* common_expr_results = context->common_expr_results();
+    if (_common_expr_id < 0 || common_expr_results == nullptr) {
+        return _execute(context, block, result_column_id);
+    }
+    auto& common_result = (*common_expr_results)[_common_expr_id];
+    if (common_result < 0) {
+        RETURN_IF_ERROR(_execute(context, block, result_column_id));
+        common_result = *result_column_id;
+    } else {
+        *result_column_id = common_result;
+    }
+    return Status::OK();
+}
+
+Status VectorizedFnCall::_execute(VExprContext* context, vectorized::Block* block,
+                                  int* result_column_id) {
+    // the runtime filters need the argument columns, so they are not fused
+    if (_fused_comparison != nullptr) {
+        if (fast_execute(context, block, result_column_id)) {
+            return Status::OK();
+        }
+        ColumnPtr result;
+        if (_fused_comparison->execute(*block, &result)) {
+            *result_column_id = block->columns();
+            block->insert({std::move(result), _data_type, _expr_name});
+            return Status::OK();
+        }
+    }
     ColumnNumbers arguments;
     return _do_execute(context, block, result_column_id, arguments);
 }
@@ -272,6 +305,63 @@ bool VectorizedFnCall::can_push_down_to_index() const {
     return _function->can_push_down_to_index();
 }
 
+bool VectorizedFnCall::_is_deterministic() const {
+    static const std::set<std::string> NON_DETERMINISTIC_FUNCTIONS = {
+            "rand", "random", "random_bytes", "uuid", "uuid_numeric", "sleep"};
+    if (_fn.binary_type != TFunctionBinaryType::BUILTIN ||
+        NON_DETERMINISTIC_FUNCTIONS.contains(_function_name)) {
+        return false;
+    }
+    for (const auto& child : _children) {
+        const auto* fn_call = dynamic_cast<const VectorizedFnCall*>(child.get());
+        if (fn_call != nullptr && !fn_call->_is_deterministic()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int VectorizedFnCall::mark_common_exprs(const VExprContextSPtrs& ctxs) {
+    std::vector<VectorizedFnCall*> fn_calls;
+    std::vector<VExpr*> exprs;
+    for (const auto& ctx : ctxs) {
+        exprs.push_back(ctx->root().get());
+    }
+    while (!exprs.empty()) {
+        auto* expr = exprs.back();
+        exprs.pop_back();
+        // the other exprs, e.g. lambda functions and the subclasses, may execute their children
+        // on other blocks, so only the children of plain function calls are searched
+        if (typeid(*expr) != typeid(VectorizedFnCall)) {
+            continue;
+        }
+        fn_calls.push_back(static_cast<VectorizedFnCall*>(expr));
+        for (const auto& child : expr->children()) {
+            exprs.push_back(child.get());
+        }
+    }
+
+    int num = 0;
+    for (size_t i = 0; i < fn_calls.size(); ++i) {
+        auto* fn_call = fn_calls[i];
+        if (fn_call->_common_expr_id >= 0 || !fn_call->_is_deterministic()) {
+            continue;
+        }
+        for (size_t j = i + 1; j < fn_calls.size(); ++j) {
+            auto* other = fn_calls[j];
+            if (other != fn_call && other->_common_expr_id < 0 &&
+                fn_call->_data_type->equals(*other->_data_type) && fn_call->equals(*other)) {
+                fn_call->_common_expr_id = num;
+                other->_common_expr_id = num;
+            }
+        }
+        if (fn_call->_common_expr_id >= 0) {
+            ++num;
+        }
+    }
+    return num;
+}
+
 bool VectorizedFnCall::equals(const VExpr& other) {
     const auto* other_ptr = dynamic_cast<const VectorizedFnCall*>(&other);
     if (!other_ptr) {
@@ -25,6 +25,7 @@
 #include "udf/udf.h"
 #include "vec/core/column_numbers.h"
 #include "vec/exprs/vexpr.h"
+#include "vec/exprs/vfused_comparison.h"
 #include "vec/exprs/vliteral.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vec/functions/function.h"
@@ -70,6 +71,12 @@ public:
     }
     static std::string debug_string(const std::vector<VectorizedFnCall*>& exprs);
 
+    // Marks the deterministic builtin function calls which appear more than once in `ctxs`,
+    // e.g. `date_trunc(ts, 'day')` in several projections. When the contexts share the common
+    // expr results, such a call is only computed once per block and the others reuse its result
+    // column. Returns the number of the distinct common exprs.
+    static int mark_common_exprs(const VExprContextSPtrs& ctxs);
+
     bool can_push_down_to_index() const override;
     bool equals(const VExpr& other) override;
 
@@ -79,8 +86,14 @@ protected:
     FunctionBasePtr _function;
     std::string _expr_name;
     std::string _function_name;
+    // not null if the expr is a comparison of arithmetic which can be evaluated in a fused loop
+    std::unique_ptr<VFusedComparison> _fused_comparison;
+    // the index in the common expr results of the context, -1 if it is not a common expr
+    int _common_expr_id = -1;
 
 private:
+    bool _is_deterministic() const;
+    Status _execute(VExprContext* context, Block* block, int* result_column_id);
     Status _do_execute(doris::vectorized::VExprContext* context, doris::vectorized::Block* block,
                        int* result_column_id, ColumnNumbers& args);
 };
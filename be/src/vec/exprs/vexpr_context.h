@@ -239,6 +239,15 @@ public:
 
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
+    // The column ids of the common exprs computed in the block being executed, -1 if not computed
+    // yet. It is shared by the contexts executed on the same block, see
+    // VectorizedFnCall::mark_common_exprs.
+    void set_common_expr_results(std::vector<int>* common_expr_results) {
+        _common_expr_results = common_expr_results;
+    }
+
+    std::vector<int>* common_expr_results() const { return _common_expr_results; }
+
     VExprContext& operator=(const VExprContext& other) {
         if (this == &other) {
             return *this;
@@ -310,6 +319,8 @@ private:
     // Force to materialize even if the slot need_materialize is false, we just ignore need_materialize flag
     bool _force_materialize_slot = false;
 
+    std::vector<int>* _common_expr_results = nullptr;
+
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
     size_t _memory_usage = 0;
 };
@@ -0,0 +1,350 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_comparison.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "runtime/primitive_type.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/accurate_comparison.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+constexpr size_t FUSED_CHUNK_ROWS = 256;
+// the registers hold the results of the inner nodes of a chunk
+constexpr int FUSED_MAX_REGISTERS = 8;
+
+enum class ArithmeticOp { ADD, SUBTRACT, MULTIPLY };
+enum class CompareOp { EQ, NE, LT, LE, GT, GE };
+
+// the name of the builtin binary function of `expr` if it is a `node_type` node
+bool get_function_name(const VExpr& expr, TExprNodeType::type node_type, std::string* name) {
+    if (expr.node_type() != node_type || expr.get_num_children() != 2 ||
+        expr.fn().binary_type != TFunctionBinaryType::BUILTIN) {
+        return false;
+    }
+    *name = expr.fn().name.function_name;
+    return true;
+}
+
+template <PrimitiveType PT>
+class VFusedComparisonImpl final : public VFusedComparison {
+    using T = typename PrimitiveTypeTraits<PT>::CppType;
+    using ColumnType = typename PrimitiveTypeTraits<PT>::ColumnType;
+
+    struct Operand {
+        enum class Kind { COLUMN, CONST, REGISTER };
+        Kind kind = Kind::CONST;
+        // the index in `_column_ids` or the register
+        int index = 0;
+        T value {};
+    };
+
+    struct Instruction {
+        ArithmeticOp op;
+        Operand left;
+        Operand right;
+        int dst;
+    };
+
+    // the data of an operand of a chunk
+    struct Source {
+        const T* data;
+        bool is_const;
+    };
+
+public:
+    bool compile(const VExpr& expr, CompareOp op) {
+        _op = op;
+        _result_nullable = expr.data_type()->is_nullable();
+        if (!_compile(*expr.get_child(0), 0, &_left) ||
+            !_compile(*expr.get_child(1), _left.kind == Operand::Kind::REGISTER ? 1 : 0,
+                      &_right)) {
+            return false;
+        }
+        return !_instructions.empty() && !_column_ids.empty();
+    }
+
+    bool execute(const Block& block, ColumnPtr* result) const override {
+        const size_t rows = block.rows();
+        std::vector<const T*> columns(_column_ids.size());
+        std::vector<const NullMap*> null_maps;
+        for (size_t i = 0; i < _column_ids.size(); ++i) {
+            if (_column_ids[i] >= block.columns()) {
+                return false;
+            }
+            const IColumn* column = block.get_by_position(_column_ids[i]).column.get();
+            if (is_column_const(*column)) {
+                return false;
+            }
+            if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+                if (!_result_nullable) {
+                    return false;
+                }
+                null_maps.push_back(&nullable->get_null_map_data());
+                column = &nullable->get_nested_column();
+            }
+            const auto* typed_column = check_and_get_column<ColumnType>(column);
+            if (typed_column == nullptr) {
+                return false;
+            }
+            columns[i] = typed_column->get_data().data();
+        }
+
+        auto result_column = ColumnUInt8::create(rows);
+        auto* __restrict result_data = result_column->get_data().data();
+        T registers[FUSED_MAX_REGISTERS][FUSED_CHUNK_ROWS];
+        for (size_t start = 0; start < rows; start += FUSED_CHUNK_ROWS) {
+            const size_t chunk_rows = std::min(FUSED_CHUNK_ROWS, rows - start);
+            auto source = [&](const Operand& operand) -> Source {
+                switch (operand.kind) {
+                case Operand::Kind::COLUMN:
+                    return {columns[operand.index] + start, false};
+                case Operand::Kind::REGISTER:
+                    return {registers[operand.index], false};
+                default:
+                    return {&operand.value, true};
+                }
+            };
+            for (const auto& instruction : _instructions) {
+                _arithmetic(instruction.op, source(instruction.left), source(instruction.right),
+                            registers[instruction.dst], chunk_rows);
+            }
+            _compare(source(_left), source(_right), result_data + start, chunk_rows);
+        }
+
+        if (!_result_nullable) {
+            *result = std::move(result_column);
+            return true;
+        }
+        auto null_map_column = ColumnUInt8::create(rows, 0);
+        auto* __restrict null_map = null_map_column->get_data().data();
+        for (const auto* input_null_map : null_maps) {
+            const auto* __restrict input = input_null_map->data();
+            for (size_t i = 0; i < rows; ++i) {
+                null_map[i] |= input[i];
+            }
+        }
+        *result = ColumnNullable::create(std::move(result_column), std::move(null_map_column));
+        return true;
+    }
+
+private:
+    bool _compile(const VExpr& expr, int depth, Operand* operand) {
+        if (remove_nullable(expr.data_type())->get_primitive_type() != PT) {
+            return false;
+        }
+        if (expr.is_nullable() && !_result_nullable) {
+            return false;
+        }
+        if (const auto* slot = dynamic_cast<const VSlotRef*>(&expr)) {
+            if (slot->column_id() < 0) {
+                return false;
+            }
+            auto column_id = static_cast<uint32_t>(slot->column_id());
+            auto it = std::find(_column_ids.begin(), _column_ids.end(), column_id);
+            operand->kind = Operand::Kind::COLUMN;
+            operand->index = static_cast<int>(it - _column_ids.begin());
+            if (it == _column_ids.end()) {
+                _column_ids.push_back(column_id);
+            }
+            return true;
+        }
+        if (expr.is_literal()) {
+            const auto& column = static_cast<const VLiteral&>(expr).get_column_ptr();
+            if (column == nullptr || column->size() != 1 || column->is_null_at(0)) {
+                return false;
+            }
+            auto data = column->get_data_at(0);
+            if (data.size != sizeof(T)) {
+                return false;
+            }
+            operand->kind = Operand::Kind::CONST;
+            memcpy(&operand->value, data.data, sizeof(T));
+            return true;
+        }
+
+        std::string name;
+        if (!get_function_name(expr, TExprNodeType::ARITHMETIC_EXPR, &name)) {
+            return false;
+        }
+        ArithmeticOp op;
+        if (name == "add") {
+            op = ArithmeticOp::ADD;
+        } else if (name == "subtract") {
+            op = ArithmeticOp::SUBTRACT;
+        } else if (name == "multiply") {
+            op = ArithmeticOp::MULTIPLY;
+        } else {
+            return false;
+        }
+        if (depth >= FUSED_MAX_REGISTERS) {
+            return false;
+        }
+        Instruction instruction {.op = op, .dst = depth};
+        if (!_compile(*expr.get_child(0), depth, &instruction.left) ||
+            !_compile(*expr.get_child(1),
+                      instruction.left.kind == Operand::Kind::REGISTER ? depth + 1 : depth,
+                      &instruction.right)) {
+            return false;
+        }
+        _instructions.push_back(instruction);
+        operand->kind = Operand::Kind::REGISTER;
+        operand->index = depth;
+        return true;
+    }
+
+    template <typename Result, typename Func>
+    static void _apply(const Source& left, const Source& right, Result* __restrict dst,
+                       size_t rows, Func func) {
+        const T* __restrict l = left.data;
+        const T* __restrict r = right.data;
+        if (!left.is_const && !right.is_const) {
+            for (size_t i = 0; i < rows; ++i) {
+                dst[i] = func(l[i], r[i]);
+            }
+        } else if (left.is_const && !right.is_const) {
+            const T value = *l;
+            for (size_t i = 0; i < rows; ++i) {
+                dst[i] = func(value, r[i]);
+            }
+        } else if (!left.is_const) {
+            const T value = *r;
+            for (size_t i = 0; i < rows; ++i) {
+                dst[i] = func(l[i], value);
+            }
+        } else {
+            std::fill(dst, dst + rows, func(*l, *r));
+        }
+    }
+
+    // the same as the arithmetic functions of bigint and double, the overflow of bigint is not
+    // checked
+    static void _arithmetic(ArithmeticOp op, const Source& left, const Source& right, T* dst,
+                            size_t rows) {
+        switch (op) {
+        case ArithmeticOp::ADD:
+            _apply(left, right, dst, rows, [](T a, T b) { return a + b; });
+            break;
+        case ArithmeticOp::SUBTRACT:
+            _apply(left, right, dst, rows, [](T a, T b) { return a - b; });
+            break;
+        case ArithmeticOp::MULTIPLY:
+            _apply(left, right, dst, rows, [](T a, T b) { return a * b; });
+            break;
+        }
+    }
+
+    void _compare(const Source& left, const Source& right, UInt8* dst, size_t rows) const {
+        switch (_op) {
+        case CompareOp::EQ:
+            _apply(left, right, dst, rows, [](T a, T b) { return EqualsOp<PT, PT>::apply(a, b); });
+            break;
+        case CompareOp::NE:
+            _apply(left, right, dst, rows,
+                   [](T a, T b) { return NotEqualsOp<PT, PT>::apply(a, b); });
+            break;
+        case CompareOp::LT:
+            _apply(left, right, dst, rows, [](T a, T b) { return LessOp<PT, PT>::apply(a, b); });
+            break;
+        case CompareOp::LE:
+            _apply(left, right, dst, rows,
+                   [](T a, T b) { return LessOrEqualsOp<PT, PT>::apply(a, b); });
+            break;
+        case CompareOp::GT:
+            _apply(left, right, dst, rows,
+                   [](T a, T b) { return GreaterOp<PT, PT>::apply(a, b); });
+            break;
+        case CompareOp::GE:
+            _apply(left, right, dst, rows,
+                   [](T a, T b) { return GreaterOrEqualsOp<PT, PT>::apply(a, b); });
+            break;
+        }
+    }
+
+    CompareOp _op = CompareOp::EQ;
+    bool _result_nullable = false;
+    Operand _left;
+    Operand _right;
+    // in the order of execution, the operands of an instruction are computed before it
+    std::vector<Instruction> _instructions;
+    std::vector<uint32_t> _column_ids;
+};
+
+template <PrimitiveType PT>
+std::unique_ptr<VFusedComparison> create_fused_comparison(const VExpr& expr, CompareOp op) {
+    auto fused = std::make_unique<VFusedComparisonImpl<PT>>();
+    if (!fused->compile(expr, op)) {
+        return nullptr;
+    }
+    return fused;
+}
+
+} // namespace
+
+std::unique_ptr<VFusedComparison> VFusedComparison::create(const VExpr& expr) {
+    std::string name;
+    if (!get_function_name(expr, TExprNodeType::BINARY_PRED, &name)) {
+        return nullptr;
+    }
+    CompareOp op;
+    if (name == "eq") {
+        op = CompareOp::EQ;
+    } else if (name == "ne") {
+        op = CompareOp::NE;
+    } else if (name == "lt") {
+        op = CompareOp::LT;
+    } else if (name == "le") {
+        op = CompareOp::LE;
+    } else if (name == "gt") {
+        op = CompareOp::GT;
+    } else if (name == "ge") {
+        op = CompareOp::GE;
+    } else {
+        return nullptr;
+    }
+    if (remove_nullable(expr.data_type())->get_primitive_type() != TYPE_BOOLEAN) {
+        return nullptr;
+    }
+
+    switch (remove_nullable(expr.get_child(0)->data_type())->get_primitive_type()) {
+    case TYPE_BIGINT:
+        return create_fused_comparison<TYPE_BIGINT>(expr, op);
+    case TYPE_DOUBLE:
+        return create_fused_comparison<TYPE_DOUBLE>(expr, op);
+    default:
+        return nullptr;
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "vec/columns/column.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+class VExpr;
+
+// Evaluates a comparison whose operands are trees of add, subtract and multiply over bigint or
+// double slots and literals, e.g. `a * b + c > d`. The rows are evaluated chunk by chunk in one
+// fused loop, so the columns of the inner nodes are never materialized.
+class VFusedComparison {
+public:
+    virtual ~VFusedComparison() = default;
+
+    // Returns nullptr if `expr` is not such a comparison or has no arithmetic to fuse.
+    static std::unique_ptr<VFusedComparison> create(const VExpr& expr);
+
+    // Returns false if the columns of `block` are not supported, e.g. const columns, then the
+    // expr should be executed by the interpreter.
+    virtual bool execute(const Block& block, ColumnPtr* result) const = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
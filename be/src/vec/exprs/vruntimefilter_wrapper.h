@@ -66,10 +66,12 @@ public:
 
     void attach_profile_counter(std::shared_ptr<RuntimeProfile::Counter> rf_input_rows,
                                 std::shared_ptr<RuntimeProfile::Counter> rf_filter_rows,
-                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows) {
+                                std::shared_ptr<RuntimeProfile::Counter> always_true_filter_rows,
+                                std::shared_ptr<RuntimeProfile::Counter> disabled_times) {
         DCHECK(rf_input_rows != nullptr);
         DCHECK(rf_filter_rows != nullptr);
         DCHECK(always_true_filter_rows != nullptr);
+        DCHECK(disabled_times != nullptr);
 
         if (rf_input_rows != nullptr) {
             _rf_input_rows = rf_input_rows;
@@ -80,6 +82,9 @@ public:
         if (always_true_filter_rows != nullptr) {
             _always_true_filter_rows = always_true_filter_rows;
         }
+        if (disabled_times != nullptr) {
+            _disabled_times = disabled_times;
+        }
     }
 
     void update_counters(int64_t filter_rows, int64_t input_rows) {
@@ -104,8 +109,17 @@ public:
         if (!_always_true) {
             _judge_filter_rows += filter_rows;
             _judge_input_rows += input_rows;
+            if (_judge_input_rows < uint64_t(config::runtime_filter_selectivity_window_rows)) {
+                return;
+            }
             judge_selectivity(_ignore_thredhold, _judge_filter_rows, _judge_input_rows,
                               _always_true);
+            if (_always_true) {
+                COUNTER_UPDATE(_disabled_times, 1);
+            }
+            // the next window is judged on its own rows only
+            _judge_input_rows = 0;
+            _judge_filter_rows = 0;
         }
     }
 
@@ -132,7 +146,9 @@ private:
     // based on runtime_filter_sampling_frequency. During each period, if _always_true
     // is evaluated as true, the logic for always_true is applied for the rest of that period
     // without recalculating. At the beginning of the next period,
-    // reset_judge_selectivity is used to reset these variables.
+    // reset_judge_selectivity is used to reset these variables. Within a period, the selectivity
+    // is judged on windows of runtime_filter_selectivity_window_rows input rows, so neither a
+    // few small blocks nor the rows of the earlier windows decide it.
     std::atomic_int _judge_counter = 0;
     std::atomic_uint64_t _judge_input_rows = 0;
     std::atomic_uint64_t _judge_filter_rows = 0;
@@ -144,6 +160,8 @@ private:
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
     std::shared_ptr<RuntimeProfile::Counter> _always_true_filter_rows =
             std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
+    std::shared_ptr<RuntimeProfile::Counter> _disabled_times =
+            std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
 
     std::string _expr_name;
     double _ignore_thredhold;
@@ -111,9 +111,6 @@ std::string VSlotRef::debug_string() const {
 }
 
 bool VSlotRef::equals(const VExpr& other) {
-    if (!VExpr::equals(other)) {
-        return false;
-    }
     const auto* other_ptr = dynamic_cast<const VSlotRef*>(&other);
     if (!other_ptr) {
         return false;
@@ -114,6 +114,9 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    // valid after prepare
+    const RuntimePredicate* predicate() const { return _predicate; }
+
 private:
     int _source_node_id;
     std::string _expr_name;
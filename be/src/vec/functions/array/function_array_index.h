@@ -286,6 +286,29 @@ private:
         return ColumnNullable::create(std::move(dst), std::move(dst_null_column));
     }
 
+    // The position of the first element equal to `value`, or `len`. The elements are compared in
+    // chunks without branches, so the compiler vectorizes the comparisons of a chunk.
+    template <typename T>
+    static size_t _find_first(const T* data, size_t len, const T& value) {
+        static constexpr size_t CHUNK_SIZE = 16;
+        size_t pos = 0;
+        for (; pos + CHUNK_SIZE <= len; pos += CHUNK_SIZE) {
+            bool found = false;
+            for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+                found |= data[pos + i] == value;
+            }
+            if (found) {
+                break;
+            }
+        }
+        for (; pos < len; ++pos) {
+            if (data[pos] == value) {
+                return pos;
+            }
+        }
+        return len;
+    }
+
     template <typename NestedColumnType, typename RightColumnType>
     ColumnPtr _execute_number(const ColumnArray::Offsets64& offsets, const UInt8* nested_null_map,
                               const IColumn& nested_column, const IColumn& right_column,
@@ -314,28 +337,36 @@ private:
             typename PrimitiveTypeTraits<ResultType>::CppType res = 0;
             size_t off = offsets[row - 1];
             size_t len = offsets[row] - off;
-            for (size_t pos = 0; pos < len; ++pos) {
-                // match null value
-                if (right_nested_null_map && right_nested_null_map[row] && nested_null_map &&
-                    nested_null_map[pos + off]) {
-                    ConcreteAction::apply(res, pos);
-                    if constexpr (!ConcreteAction::resume_execution) {
-                        break;
+            const auto* row_data = nested_data.data() + off;
+            if (nested_null_map != nullptr && right_nested_null_map && right_nested_null_map[row]) {
+                // a null value only matches the null elements
+                for (size_t pos = 0; pos < len; ++pos) {
+                    if (nested_null_map[pos + off]) {
+                        ConcreteAction::apply(res, pos);
+                        if constexpr (!ConcreteAction::resume_execution) {
+                            break;
+                        }
                     }
                 }
-                // some is null while another is not
-                if (right_nested_null_map && nested_null_map &&
-                    right_nested_null_map[row] != nested_null_map[pos + off]) {
-                    continue;
+            } else if (nested_null_map != nullptr) {
+                for (size_t pos = 0; pos < len; ++pos) {
+                    if (!nested_null_map[pos + off] && row_data[pos] == right_data[row]) {
+                        ConcreteAction::apply(res, pos);
+                        if constexpr (!ConcreteAction::resume_execution) {
+                            break;
+                        }
+                    }
                 }
-                if (nested_null_map && nested_null_map[pos + off]) {
-                    continue;
+            } else if constexpr (ConcreteAction::resume_execution) {
+                for (size_t pos = 0; pos < len; ++pos) {
+                    if (row_data[pos] == right_data[row]) {
+                        ConcreteAction::apply(res, pos);
+                    }
                 }
-                if (nested_data[pos + off] == right_data[row]) {
+            } else {
+                size_t pos = _find_first(row_data, len, right_data[row]);
+                if (pos < len) {
                     ConcreteAction::apply(res, pos);
-                    if constexpr (!ConcreteAction::resume_execution) {
-                        break;
-                    }
                 }
             }
             dst_data[row] = res;
@@ -196,36 +196,4 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
     return columns;
 }
 
-ColumnPtr ComplexHashMapDictionary::get_single_value_column(
-        const IColumn::Selector& value_index, const NullMap& key_not_found,
-        const std::string& attribute_name, const DataTypePtr& attribute_type) const {
-    const auto rows = value_index.size();
-    MutableColumnPtr res_column = attribute_type->create_column();
-    ColumnUInt8::MutablePtr res_null = ColumnUInt8::create(rows, false);
-    auto& res_null_map = res_null->get_data();
-    const auto& value_data = _values_data[attribute_index(attribute_name)];
-    std::visit(
-            [&](auto&& arg, auto value_is_nullable) {
-                using ValueDataType = std::decay_t<decltype(arg)>;
-                using OutputColumnType = ValueDataType::OutputColumnType;
-                auto* res_real_column = assert_cast<OutputColumnType*>(res_column.get());
-                const auto* value_column = arg.get();
-                const auto* value_null_map = arg.get_null_map();
-                for (size_t i = 0; i < rows; i++) {
-                    if (key_not_found[i]) {
-                        // if input key is not found, set the result column to null
-                        res_real_column->insert_default();
-                        res_null_map[i] = true;
-                    } else {
-                        set_value_data<value_is_nullable>(res_real_column, res_null_map[i],
-                                                          value_column, value_null_map,
-                                                          value_index[i]);
-                    }
-                }
-            },
-            value_data, attribute_nullable_variant(attribute_index(attribute_name)));
-
-    return ColumnNullable::create(std::move(res_column), std::move(res_null));
-}
-
 } // namespace doris::vectorized
@@ -71,10 +71,6 @@ private:
     void load_data(const ColumnPtrs& key_columns, const DataTypes& key_types,
                    const std::vector<ColumnPtr>& values_column);
 
-    ColumnPtr get_single_value_column(const IColumn::Selector& value_index, const NullMap& null_map,
-                                      const std::string& attribute_name,
-                                      const DataTypePtr& attribute_type) const;
-
     void init_find_hash_map(DictionaryHashMapMethod& find_hash_map_method,
                             const DataTypes& key_types) const;
 
@@ -196,6 +196,14 @@ protected:
 
     void load_values(const std::vector<ColumnPtr>& values_column);
 
+    // Gather the values of the found keys into the result column in one pass.
+    // value_index : index in the value column of every row of the keys
+    // key_not_found : if true, the key is not found or null, and the result is null
+    ColumnPtr get_single_value_column(const IColumn::Selector& value_index,
+                                      const NullMap& key_not_found,
+                                      const std::string& attribute_name,
+                                      const DataTypePtr& attribute_type) const;
+
     // _value_data is used to store the data of value columns.
     std::vector<ValueData> _values_data;
     std::string _dict_name;
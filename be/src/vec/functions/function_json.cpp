@@ -184,15 +184,12 @@ match_value(const std::vector<JsonPath>& parsed_paths, rapidjson::Value* documen
     return root;
 }
 
-template <JsonFunctionType fntype>
-rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
-                                  rapidjson::Document* document) {
-    std::vector<JsonPath>* parsed_paths;
-    std::vector<JsonPath> tmp_parsed_paths;
-
+// Returns false if no value matches `path_string`. `parsed_paths` is empty if the path has no
+// tokens, then it matches the document itself.
+bool parse_json_path(std::string_view path_string, std::vector<JsonPath>* parsed_paths) {
     //Cannot use '\' as the last character, return NULL
     if (path_string.back() == '\\') {
-        return nullptr;
+        return false;
     }
 
     std::string fixed_string;
@@ -213,22 +210,26 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         auto tok = get_json_token(path_string);
 #endif
         std::vector<std::string> paths(tok.begin(), tok.end());
-        get_parsed_paths(paths, &tmp_parsed_paths);
-        if (tmp_parsed_paths.empty()) {
-            return document;
-        }
+        get_parsed_paths(paths, parsed_paths);
     } catch (boost::escaped_list_error&) {
         // meet unknown escape sequence, example '$.name\k'
-        return nullptr;
+        return false;
     }
+    return parsed_paths->empty() || (*parsed_paths)[0].is_valid;
+}
 
-    parsed_paths = &tmp_parsed_paths;
-
-    if (!(*parsed_paths)[0].is_valid) {
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
+                                  rapidjson::Document* document) {
+    std::vector<JsonPath> parsed_paths;
+    if (!parse_json_path(path_string, &parsed_paths)) {
         return nullptr;
     }
+    if (parsed_paths.empty()) {
+        return document;
+    }
 
-    if (UNLIKELY((*parsed_paths).size() == 1)) {
+    if (UNLIKELY(parsed_paths.size() == 1)) {
         if (fntype == JSON_FUN_STRING) {
             document->SetString(json_string.data(),
                                 cast_set<rapidjson::SizeType>(json_string.size()),
@@ -245,7 +246,7 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         return nullptr;
     }
 
-    return match_value(*parsed_paths, document, document->GetAllocator());
+    return match_value(parsed_paths, document, document->GetAllocator());
 }
 
 template <typename NumberType>
@@ -766,18 +767,62 @@ struct FunctionJsonExtractImpl {
             }
 
         } else {
+            // the const paths are parsed once, and the document of a row is parsed once for all
+            // the paths
+            const size_t num_paths = data_columns.size() - 1;
+            std::vector<std::vector<JsonPath>> const_parsed_paths(num_paths);
+            std::vector<bool> const_path_valid(num_paths, false);
+            for (size_t col = 1; col < data_columns.size(); ++col) {
+                if (column_is_consts[col]) {
+                    const auto path = data_columns[col]->get_data_at(0);
+                    const_path_valid[col - 1] = parse_json_path(
+                            std::string_view(path.data, path.size), &const_parsed_paths[col - 1]);
+                }
+            }
+            std::vector<JsonPath> row_parsed_paths;
             rapidjson::Value value;
             value.SetArray();
-            value.Reserve(cast_set<rapidjson::SizeType>(data_columns.size() - 1), allocator);
+            value.Reserve(cast_set<rapidjson::SizeType>(num_paths), allocator);
             for (size_t row = 0; row < input_rows_count; row++) {
                 value.Clear();
                 bool found_any = false;
+                rapidjson::Document row_document;
+                bool row_document_parsed = false;
                 for (size_t col = 1; col < data_columns.size(); ++col) {
-                    auto result = parse_json(json_col, data_columns[col], allocator, row, col,
-                                             column_is_consts);
-                    if (result.first) {
+                    const std::vector<JsonPath>* parsed_paths = &const_parsed_paths[col - 1];
+                    bool path_valid = const_path_valid[col - 1];
+                    if (!column_is_consts[col]) {
+                        row_parsed_paths.clear();
+                        const auto path = data_columns[col]->get_data_at(row);
+                        path_valid = parse_json_path(std::string_view(path.data, path.size),
+                                                     &row_parsed_paths);
+                        parsed_paths = &row_parsed_paths;
+                    }
+                    if (!path_valid) {
+                        continue;
+                    }
+                    if (parsed_paths->empty()) {
+                        // the same as get_json_object, which returns the unparsed document
+                        found_any = true;
+                        value.PushBack(rapidjson::Value(), allocator);
+                        continue;
+                    }
+                    if (!row_document_parsed) {
+                        const auto obj =
+                                json_col->get_data_at(index_check_const(row, column_is_consts[0]));
+                        row_document.Parse(obj.data, obj.size);
+                        row_document_parsed = true;
+                    }
+                    if (UNLIKELY(row_document.HasParseError())) {
+                        continue;
+                    }
+                    auto* root =
+                            match_value(*parsed_paths, &row_document, row_document.GetAllocator());
+                    if (root != nullptr) {
                         found_any = true;
-                        value.PushBack(std::move(result.second), allocator);
+                        rapidjson::Value path_value;
+                        path_value.CopyFrom(*root, allocator);
+                        value.PushBack(std::move(path_value), allocator);
                     }
                 }
                 insert_result_lambda(value, !found_any, row);
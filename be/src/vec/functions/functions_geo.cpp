@@ -624,85 +624,75 @@ struct StRelationFunction {
         auto null_map = ColumnUInt8::create(size, 0);
         auto& null_map_data = null_map->get_data();
 
-        if (left_const) {
-            const_vector(left_column, right_column, res, null_map_data, size);
-        } else if (right_const) {
-            vector_const(left_column, right_column, res, null_map_data, size);
-        } else {
-            vector_vector(left_column, right_column, res, null_map_data, size);
+        auto& res_data = res->get_data();
+
+        // The shape of the previous row is reused if the value is the same, so the constant
+        // argument is decoded once, and so is a value repeated in the consecutive rows, e.g. the
+        // probe side of the output of a nested loop join.
+        ShapeCache caches[2];
+        for (size_t row = 0; row < size; ++row) {
+            const auto* lhs =
+                    caches[0].get(left_column->get_data_at(index_check_const(row, left_const)));
+            if (lhs == nullptr) {
+                null_map_data[row] = 1;
+                continue;
+            }
+            const auto* rhs =
+                    caches[1].get(right_column->get_data_at(index_check_const(row, right_const)));
+            if (rhs == nullptr) {
+                null_map_data[row] = 1;
+                continue;
+            }
+            res_data[row] = Func::evaluate(lhs, rhs);
         }
         block.replace_by_position(result,
                                   ColumnNullable::create(std::move(res), std::move(null_map)));
         return Status::OK();
     }
 
-    static void loop_do(StringRef& lhs_value, StringRef& rhs_value,
-                        std::vector<std::unique_ptr<GeoShape>>& shapes,
-                        ColumnUInt8::MutablePtr& res, NullMap& null_map, int row) {
-        StringRef* strs[2] = {&lhs_value, &rhs_value};
-        for (int i = 0; i < 2; ++i) {
-            std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(strs[i]->data, strs[i]->size));
-            shapes[i] = std::move(shape);
-            if (!shapes[i]) {
-                null_map[row] = 1;
-                break;
-            }
-        }
-        if (shapes[0] && shapes[1]) {
-            auto relation_value = Func::evaluate(shapes[0].get(), shapes[1].get());
-            res->get_data()[row] = relation_value;
-        }
-    }
-
-    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
-        }
-    }
-
-    static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
-        }
-    }
+    struct ShapeCache {
+        bool decoded = false;
+        StringRef value;
+        std::unique_ptr<GeoShape> shape;
 
-    static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+        const GeoShape* get(const StringRef& new_value) {
+            bool same_ref = new_value.data == value.data && new_value.size == value.size;
+            if (!decoded || (!same_ref && new_value != value)) {
+                shape = GeoShape::from_encoded(new_value.data, new_value.size);
+                value = new_value;
+                decoded = true;
+            }
+            return shape.get();
         }
-    }
+    };
 };
 
 struct StContainsFunc {
     static constexpr auto NAME = "st_contains";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->contains(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->contains(shape2);
+    }
 };
 
 struct StIntersectsFunc {
     static constexpr auto NAME = "st_intersects";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->intersects(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->intersects(shape2);
+    }
 };
 
 struct StDisjointFunc {
     static constexpr auto NAME = "st_disjoint";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->disjoint(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->disjoint(shape2);
+    }
 };
 
 struct StTouchesFunc {
     static constexpr auto NAME = "st_touches";
-    static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->touches(shape2); }
+    static bool evaluate(const GeoShape* shape1, const GeoShape* shape2) {
+        return shape1->touches(shape2);
+    }
 };
 
 struct StGeometryFromText {
@@ -54,11 +54,11 @@ size_t IPAddressDictionary::allocated_bytes() const {
            vec_mem(origin_row_idx_column) + vec_mem(parent_subnet);
 }
 
-ColumnPtr IPAddressDictionary::get_column(const std::string& attribute_name,
-                                          const DataTypePtr& attribute_type,
-                                          const ColumnPtr& key_column,
-                                          const DataTypePtr& key_type) const {
-    if (have_nullable({attribute_type}) || have_nullable({key_type})) {
+ColumnPtrs IPAddressDictionary::get_columns(const std::vector<std::string>& attribute_names,
+                                            const DataTypes& attribute_types,
+                                            const ColumnPtr& key_column,
+                                            const DataTypePtr& key_type) const {
+    if (have_nullable(attribute_types) || have_nullable({key_type})) {
         throw doris::Exception(
                 ErrorCode::INTERNAL_ERROR,
                 "IPAddressDictionary get_column attribute_type or key_type must not nullable type");
@@ -72,88 +72,52 @@ ColumnPtr IPAddressDictionary::get_column(const std::string& attribute_name,
     }
 
     const auto rows = key_column->size();
-    MutableColumnPtr res_column = attribute_type->create_column();
-    ColumnUInt8::MutablePtr res_null = ColumnUInt8::create(rows, false);
-    auto& res_null_map = res_null->get_data();
-    const auto& value_data = _values_data[attribute_index(attribute_name)];
-
+    IColumn::Selector value_index = IColumn::Selector(rows);
+    // if key is not found, or key is null , wiil set true
+    NullMap key_not_found = NullMap(rows, false);
+    // if input key column is nullable, will not be null
+    const ColumnNullable* null_key =
+            key_column->is_nullable() ? assert_cast<const ColumnNullable*>(key_column.get())
+                                      : nullptr;
+    // input key column without nullable
     if (key_type->get_primitive_type() == TYPE_IPV6) {
-        // input key column without nullable
-        const auto* ipv6_column = assert_cast<const ColumnIPv6*>(remove_nullable(key_column).get());
-        // if input key column is nullable, will not be null
-        const ColumnNullable* null_key =
-                key_column->is_nullable() ? assert_cast<const ColumnNullable*>(key_column.get())
-                                          : nullptr;
-        std::visit(
-                [&](auto&& arg, auto key_is_nullable, auto value_is_nullable) {
-                    using ValueDataType = std::decay_t<decltype(arg)>;
-                    using OutputColumnType = ValueDataType::OutputColumnType;
-                    auto* res_real_column = assert_cast<OutputColumnType*>(res_column.get());
-                    const auto* value_column = arg.get();
-                    const auto* value_null_map = arg.get_null_map();
-                    for (size_t i = 0; i < rows; i++) {
-                        if constexpr (key_is_nullable) {
-                            if (null_key->is_null_at(i)) {
-                                // if input key is null, set the result column to null
-                                res_real_column->insert_default();
-                                res_null_map[i] = true;
-                                continue;
-                            }
-                        }
-                        auto it = look_up_IP(ipv6_column->get_element(i));
-                        if (it == ip_not_found()) {
-                            // if input key is not found, set the result column to null
-                            res_real_column->insert_default();
-                            res_null_map[i] = true;
-                        } else {
-                            const auto idx = *it;
-                            set_value_data<value_is_nullable>(res_real_column, res_null_map[i],
-                                                              value_column, value_null_map, idx);
-                        }
-                    }
-                },
-                value_data, make_bool_variant(null_key != nullptr),
-                attribute_nullable_variant(attribute_index(attribute_name)));
+        look_up_IPs(assert_cast<const ColumnIPv6*>(remove_nullable(key_column).get()), null_key,
+                    value_index, key_not_found);
     } else {
-        // input key column without nullable
-        const auto* ipv4_column = assert_cast<const ColumnIPv4*>(remove_nullable(key_column).get());
-        // if input key column is nullable, will not be null
-        const ColumnNullable* null_key =
-                key_column->is_nullable() ? assert_cast<const ColumnNullable*>(key_column.get())
-                                          : nullptr;
-        std::visit(
-                [&](auto&& arg, auto key_is_nullable, auto value_is_nullable) {
-                    using ValueDataType = std::decay_t<decltype(arg)>;
-                    using OutputColumnType = ValueDataType::OutputColumnType;
-                    auto* res_real_column = assert_cast<OutputColumnType*>(res_column.get());
-                    const auto* value_column = arg.get();
-                    const auto* value_null_map = arg.get_null_map();
-                    for (size_t i = 0; i < rows; i++) {
-                        if constexpr (key_is_nullable) {
-                            if (null_key->is_null_at(i)) {
-                                // if input key is null, set the result column to null
-                                res_real_column->insert_default();
-                                res_null_map[i] = true;
-                                continue;
-                            }
-                        }
-                        auto it = look_up_IP(ipv4_to_ipv6(ipv4_column->get_element(i)));
-                        if (it == ip_not_found()) {
-                            // if input key is not found, set the result column to null
-                            res_real_column->insert_default();
-                            res_null_map[i] = true;
-                        } else {
-                            const auto idx = *it;
-                            set_value_data<value_is_nullable>(res_real_column, res_null_map[i],
-                                                              value_column, value_null_map, idx);
-                        }
-                    }
-                },
-                value_data, make_bool_variant(null_key != nullptr),
-                attribute_nullable_variant(attribute_index(attribute_name)));
+        look_up_IPs(assert_cast<const ColumnIPv4*>(remove_nullable(key_column).get()), null_key,
+                    value_index, key_not_found);
+    }
+
+    ColumnPtrs columns;
+    for (size_t i = 0; i < attribute_names.size(); ++i) {
+        columns.push_back(get_single_value_column(value_index, key_not_found, attribute_names[i],
+                                                  attribute_types[i]));
     }
+    return columns;
+}
 
-    return ColumnNullable::create(std::move(res_column), std::move(res_null));
+template <typename ColumnType>
+void IPAddressDictionary::look_up_IPs(const ColumnType* ip_column, const ColumnNullable* null_key,
+                                      IColumn::Selector& value_index,
+                                      NullMap& key_not_found) const {
+    const auto& ips = ip_column->get_data();
+    for (size_t i = 0; i < ips.size(); i++) {
+        if (null_key != nullptr && null_key->is_null_at(i)) {
+            key_not_found[i] = true;
+            continue;
+        }
+        RowIdxConstIter it;
+        if constexpr (std::is_same_v<ColumnType, ColumnIPv6>) {
+            it = look_up_IP(ips[i]);
+        } else {
+            it = look_up_IP(ipv4_to_ipv6(ips[i]));
+        }
+        if (it == ip_not_found()) {
+            key_not_found[i] = true;
+        } else {
+            value_index[i] = *it;
+        }
+    }
 }
 
 IPv6 IPAddressDictionary::format_ipv6_cidr(const uint8_t* addr, uint8_t prefix) {
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
 #include "vec/core/types.h"
@@ -38,7 +39,14 @@ public:
     ~IPAddressDictionary() override;
 
     ColumnPtr get_column(const std::string& attribute_name, const DataTypePtr& attribute_type,
-                         const ColumnPtr& key_column, const DataTypePtr& key_type) const override;
+                         const ColumnPtr& key_column, const DataTypePtr& key_type) const override {
+        return get_columns({attribute_name}, {attribute_type}, key_column, key_type)[0];
+    }
+
+    // The keys are looked up once for all the attributes.
+    ColumnPtrs get_columns(const std::vector<std::string>& attribute_names,
+                           const DataTypes& attribute_types, const ColumnPtr& key_column,
+                           const DataTypePtr& key_type) const override;
 
     static DictionaryPtr create_ip_trie_dict(const std::string& name, const ColumnPtr& key_column,
                                              const ColumnsWithTypeAndName& values_data) {
@@ -68,6 +76,11 @@ private:
 
     RowIdxConstIter look_up_IP(const IPv6& target) const;
 
+    // Look up all the keys, see IDictionary::get_single_value_column for the output.
+    template <typename ColumnType>
+    void look_up_IPs(const ColumnType* ip_column, const ColumnNullable* null_key,
+                     IColumn::Selector& value_index, NullMap& key_not_found) const;
+
     void load_data(const ColumnPtr& key_column, const std::vector<ColumnPtr>& values_column);
 
     std::vector<IPv6> ip_column;
@@ -183,8 +183,91 @@ struct VectorEndsWithSearchState : public VectorPatternSearchState {
     }
 };
 
+std::string FunctionRegexpLike::required_literal(const std::string& pattern) {
+    std::string longest;
+    std::string current;
+    auto end_literal = [&]() {
+        if (current.size() > longest.size()) {
+            longest.swap(current);
+        }
+        current.clear();
+    };
+    const size_t size = pattern.size();
+    for (size_t i = 0; i < size; i++) {
+        char c = pattern[i];
+        switch (c) {
+        case '|':
+        case '(':
+        case ')':
+            // an alternation may make any literal optional, and a group may be quantified
+            return "";
+        case '?':
+        case '*':
+        case '{':
+            // the quantified char may not appear
+            if (!current.empty()) {
+                current.pop_back();
+            }
+            end_literal();
+            if (c == '{') {
+                i = pattern.find('}', i);
+                if (i == std::string::npos) {
+                    return "";
+                }
+            }
+            break;
+        case '\\':
+            // the escapes may be char classes, e.g. \d, skip the escaped char
+            if (i + 1 < size && pattern[i + 1] == 'Q') {
+                return "";
+            }
+            end_literal();
+            ++i;
+            break;
+        case '[': {
+            end_literal();
+            // skip the class, `]` right after `[` or `[^` is a member of the class
+            size_t j = i + 1;
+            if (j < size && pattern[j] == '^') {
+                ++j;
+            }
+            if (j < size && pattern[j] == ']') {
+                ++j;
+            }
+            for (; j < size && pattern[j] != ']'; ++j) {
+                if (pattern[j] == '[') {
+                    // e.g. [[:alpha:]]
+                    return "";
+                }
+                if (pattern[j] == '\\') {
+                    ++j;
+                }
+            }
+            if (j >= size) {
+                return "";
+            }
+            i = j;
+            break;
+        }
+        case '.':
+        case '^':
+        case '$':
+        case '+':
+            end_literal();
+            break;
+        default:
+            current.push_back(c);
+        }
+    }
+    end_literal();
+    return longest;
+}
+
 Status LikeSearchState::clone(LikeSearchState& cloned) {
     cloned.set_search_string(search_string);
+    if (!prefilter_string.empty()) {
+        cloned.set_prefilter_string(prefilter_string);
+    }
 
     std::string re_pattern;
     FunctionLike::convert_like_pattern(this, pattern_str, &re_pattern);
@@ -381,6 +464,10 @@ Status FunctionLikeBase::vector_substring_fn(const ColumnString& vals,
 
 Status FunctionLikeBase::constant_regex_fn_scalar(LikeSearchState* state, const StringRef& val,
                                                   const StringRef& pattern, unsigned char* result) {
+    if (state->prefilter_string_sv.size > 0 && state->prefilter_pattern.search(val) == -1) {
+        *result = 0;
+        return Status::OK();
+    }
     if (state->hs_database) { // use hyperscan
         auto ret = hs_scan(state->hs_database.get(), val.data, val.size, 0, state->hs_scratch.get(),
                            doris::vectorized::LikeSearchState::hs_match_handler, (void*)result);
@@ -413,8 +500,20 @@ Status FunctionLikeBase::constant_regex_fn(LikeSearchState* state, const ColumnS
                                            const StringRef& pattern,
                                            ColumnUInt8::Container& result) {
     auto sz = val.size();
+    // only the rows which contain the prefilter literal are matched by the regex engine
+    const bool prefiltered = state->prefilter_string_sv.size > 0;
+    if (prefiltered) {
+        search_rows(state->prefilter_pattern, state->prefilter_string_sv.size, val.get_chars(),
+                    val.get_offsets(), result);
+    }
     if (state->hs_database) { // use hyperscan
         for (size_t i = 0; i < sz; i++) {
+            if (prefiltered) {
+                if (!result[i]) {
+                    continue;
+                }
+                result[i] = 0;
+            }
             const auto& str_ref = val.get_data_at(i);
             auto ret = hs_scan(state->hs_database.get(), str_ref.data, str_ref.size, 0,
                                state->hs_scratch.get(),
@@ -426,6 +525,9 @@ Status FunctionLikeBase::constant_regex_fn(LikeSearchState* state, const ColumnS
         }
     } else { // fallback to re2
         for (size_t i = 0; i < sz; i++) {
+            if (prefiltered && !result[i]) {
+                continue;
+            }
             const auto& str_ref = val.get_data_at(i);
             *(result.data() + i) =
                     RE2::PartialMatch(re2::StringPiece(str_ref.data, str_ref.size), *state->regex);
@@ -547,6 +649,16 @@ Status FunctionLikeBase::execute_substring(const ColumnString::Chars& values,
                                            const ColumnString::Offsets& value_offsets,
                                            ColumnUInt8::Container& result,
                                            LikeSearchState* search_state) const {
+    search_rows(search_state->substring_pattern,
+                search_state->substring_pattern.get_pattern_length(), values, value_offsets,
+                result);
+    return Status::OK();
+}
+
+void FunctionLikeBase::search_rows(const doris::StringSearch& search, size_t needle_size,
+                                   const ColumnString::Chars& values,
+                                   const ColumnString::Offsets& value_offsets,
+                                   ColumnUInt8::Container& result) {
     // treat continuous multi string data as a long string data
     const UInt8* begin = values.data();
     const UInt8* end = begin + values.size();
@@ -554,12 +666,11 @@ Status FunctionLikeBase::execute_substring(const ColumnString::Chars& values,
 
     /// Current index in the array of strings.
     size_t i = 0;
-    size_t needle_size = search_state->substring_pattern.get_pattern_length();
 
     /// We will search for the next occurrence in all strings at once.
     while (pos < end) {
         // search return matched substring start offset
-        pos = (UInt8*)search_state->substring_pattern.search((char*)pos, end - pos);
+        pos = (UInt8*)search.search((char*)pos, end - pos);
         if (pos >= end) {
             break;
         }
@@ -579,8 +690,6 @@ Status FunctionLikeBase::execute_substring(const ColumnString::Chars& values,
         pos = begin + value_offsets[i];
         ++i;
     }
-
-    return Status::OK();
 }
 
 Status FunctionLikeBase::vector_const(const ColumnString& values, const StringRef* pattern_val,
@@ -766,6 +875,31 @@ void FunctionLike::convert_like_pattern(LikeSearchState* state, const std::strin
     }
 }
 
+std::string FunctionLike::required_literal(const std::string& pattern) {
+    std::string longest;
+    std::string current;
+    auto end_literal = [&]() {
+        if (current.size() > longest.size()) {
+            longest.swap(current);
+        }
+        current.clear();
+    };
+    // the same escapes as convert_like_pattern
+    for (size_t i = 0; i < pattern.size(); i++) {
+        char c = pattern[i];
+        if (c == '\\' && i + 1 < pattern.size() &&
+            (pattern[i + 1] == '%' || pattern[i + 1] == '_' || pattern[i + 1] == '\\')) {
+            current.push_back(pattern[++i]);
+        } else if (c == '%' || c == '_') {
+            end_literal();
+        } else {
+            current.push_back(c);
+        }
+    }
+    end_literal();
+    return longest;
+}
+
 void FunctionLike::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
@@ -894,6 +1028,11 @@ Status FunctionLike::construct_like_const_state(FunctionContext* context, const
                        << ", size: " << re_pattern.size();
         }
 
+        auto prefilter_string = required_literal(pattern_str);
+        if (!prefilter_string.empty()) {
+            state->search_state.set_prefilter_string(prefilter_string);
+        }
+
         hs_database_t* database = nullptr;
         hs_scratch_t* scratch = nullptr;
         if (try_hyperscan && hs_prepare(context, re_pattern.c_str(), &database, &scratch).ok()) {
@@ -987,6 +1126,11 @@ Status FunctionRegexpLike::open(FunctionContext* context,
             state->function = constant_substring_fn;
             state->scalar_function = constant_substring_fn_scalar;
         } else {
+            auto prefilter_string = required_literal(pattern_str);
+            if (!prefilter_string.empty()) {
+                state->search_state.set_prefilter_string(prefilter_string);
+            }
+
             hs_database_t* database = nullptr;
             hs_scratch_t* scratch = nullptr;
             if (hs_prepare(context, pattern_str.c_str(), &database, &scratch).ok()) {
@@ -97,6 +97,13 @@ struct LikeSearchState {
     /// in the value.
     doris::StringSearch substring_pattern;
 
+    /// Used for LIKE, RLIKE and REGEXP predicates if the pattern is a constant argument which
+    /// is matched by the regex engine. Every matched value contains this literal, so the values
+    /// without it are filtered out before the regex engine.
+    std::string prefilter_string;
+    StringRef prefilter_string_sv;
+    doris::StringSearch prefilter_pattern;
+
     /// Used for RLIKE and REGEXP predicates if the pattern is a constant argument.
     std::unique_ptr<re2::RE2> regex;
 
@@ -134,6 +141,12 @@ struct LikeSearchState {
         search_string_sv = StringRef(search_string);
         substring_pattern.set_pattern(&search_string_sv);
     }
+
+    void set_prefilter_string(const std::string& prefilter_string_arg) {
+        prefilter_string = prefilter_string_arg;
+        prefilter_string_sv = StringRef(prefilter_string);
+        prefilter_pattern.set_pattern(&prefilter_string_sv);
+    }
 };
 
 using LikeFn = std::function<doris::Status(LikeSearchState*, const ColumnString&, const StringRef&,
@@ -266,6 +279,12 @@ protected:
     static Status regexp_fn_scalar(LikeSearchState* state, const StringRef& val,
                                    const StringRef& pattern, unsigned char* result);
 
+    // set 1 to the rows which contain the pattern of `search`, the rows are searched at once
+    static void search_rows(const doris::StringSearch& search, size_t needle_size,
+                            const ColumnString::Chars& values,
+                            const ColumnString::Offsets& value_offsets,
+                            ColumnUInt8::Container& result);
+
     // hyperscan compile expression to database and allocate scratch space
     static Status hs_prepare(FunctionContext* context, const char* expression,
                              hs_database_t** database, hs_scratch_t** scratch);
@@ -303,6 +322,9 @@ private:
                                      std::string* re_pattern);
 
     static void remove_escape_character(std::string* search_string);
+
+    // the longest literal which every value matching the like `pattern` contains
+    static std::string required_literal(const std::string& pattern);
 };
 
 class FunctionRegexpLike : public FunctionLikeBase {
@@ -315,6 +337,10 @@ public:
     String get_name() const override { return name; }
 
     Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override;
+
+    // the longest literal which every value matching the regexp `pattern` contains, empty if
+    // the pattern is not simple enough to be sure, e.g. it has alternations or groups
+    static std::string required_literal(const std::string& pattern);
 };
 
 } // namespace doris::vectorized
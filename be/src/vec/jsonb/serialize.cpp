@@ -51,21 +51,22 @@ void JsonbSerializeUtil::block_to_jsonb(const TabletSchema& schema, const Block&
     auto num_rows = block.rows();
     Arena arena;
     assert(num_cols <= block.columns());
+    // the columns in the row store, the row store column itself is ignored
+    std::vector<int> cids;
+    for (int j = 0; j < num_cols; ++j) {
+        const auto& tablet_column = *schema.columns()[j];
+        if (!tablet_column.is_row_store_column() &&
+            (row_store_cids.empty() || row_store_cids.contains(tablet_column.unique_id()))) {
+            cids.push_back(j);
+        }
+    }
+    JsonbWriterT<JsonbOutStream> jsonb_writer;
     for (int i = 0; i < num_rows; ++i) {
-        JsonbWriterT<JsonbOutStream> jsonb_writer;
+        jsonb_writer.reset();
         jsonb_writer.writeStartObject();
-        for (int j = 0; j < num_cols; ++j) {
-            const auto& column = block.get_by_position(j).column;
-            const auto& tablet_column = *schema.columns()[j];
-            // ignore row store columns
-            if (tablet_column.is_row_store_column()) {
-                continue;
-            }
-            // TODO improve performance for checking column in group
-            if (row_store_cids.empty() || row_store_cids.contains(tablet_column.unique_id())) {
-                serdes[j]->write_one_cell_to_jsonb(*column, jsonb_writer, arena,
-                                                   tablet_column.unique_id(), i);
-            }
+        for (int j : cids) {
+            serdes[j]->write_one_cell_to_jsonb(*block.get_by_position(j).column, jsonb_writer,
+                                               arena, schema.columns()[j]->unique_id(), i);
         }
         jsonb_writer.writeEndObject();
         dst.insert_data(jsonb_writer.getOutput()->getBuffer(), jsonb_writer.getOutput()->getSize());
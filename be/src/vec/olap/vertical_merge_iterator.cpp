@@ -298,6 +298,17 @@ bool VerticalMergeIteratorContext::compare(const VerticalMergeIteratorContext& r
     return result;
 }
 
+bool VerticalMergeIteratorContext::block_tail_less_than(
+        const VerticalMergeIteratorContext& rhs) const {
+    int last = static_cast<int>(_block->rows()) - 1;
+    if (_key_group_cluster_key_idxes.empty()) {
+        return _block->compare_at(last, rhs._index_in_block, _num_key_columns, *rhs._block, -1) <
+               0;
+    }
+    return _block->compare_at(last, rhs._index_in_block, &_key_group_cluster_key_idxes,
+                              *rhs._block, -1) < 0;
+}
+
 Status VerticalMergeIteratorContext::copy_rows(Block* block, size_t count) {
     Block& src = *_block;
     Block& dst = *block;
@@ -446,6 +457,27 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
 
         auto ctx = _merge_heap.top();
         _merge_heap.pop();
+        // When the rows of the same source come in a row, the data may not overlap much. If the
+        // rest of the block of the source is before all the other sources, copy it as one range
+        // without going through the heap for each row. The comparison is not tried on the rows
+        // alternating between sources, which gain nothing from it.
+        if (pre_ctx == ctx && !ctx->is_same() && ctx->remain_rows() > 1 &&
+            (_merge_heap.empty() || ctx->block_tail_less_than(*_merge_heap.top()))) {
+            size_t count =
+                    std::min(ctx->remain_rows(), static_cast<size_t>(_block_row_max) - row_idx);
+            RETURN_IF_ERROR(pre_ctx->copy_rows(block));
+            pre_ctx = nullptr;
+            tmp_row_sources.insert(tmp_row_sources.end(), count, RowSource(ctx->order(), false));
+            if (UNLIKELY(_record_rowids)) {
+                for (size_t i = 0; i < count; ++i) {
+                    _block_row_locations[row_idx + i] = ctx->row_location(i);
+                }
+            }
+            RETURN_IF_ERROR(ctx->copy_rows(block, count));
+            row_idx += count;
+            RETURN_IF_ERROR(_advance(ctx));
+            continue;
+        }
         if (ctx->is_same()) {
             tmp_row_sources.emplace_back(ctx->order(), true);
         } else {
@@ -480,28 +512,7 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
             }
         }
 
-        RETURN_IF_ERROR(ctx->advance());
-        if (ctx->valid()) {
-            _merge_heap.push(ctx);
-        } else {
-            // push next iterator in same rowset into heap
-            size_t cur_order = ctx->order();
-            for (size_t next_order = cur_order + 1;
-                 next_order < _iterator_init_flags.size() && !_iterator_init_flags[next_order];
-                 ++next_order) {
-                auto& next_ctx = _ori_iter_ctx[next_order];
-                DCHECK(next_ctx);
-                RETURN_IF_ERROR(next_ctx->init(_opts));
-                if (next_ctx->valid()) {
-                    _merge_heap.push(next_ctx.get());
-                    break;
-                }
-                // next_ctx is empty segment, move to next
-                next_ctx.reset();
-            }
-            // Release ctx earlier to reduce resource consumed
-            _ori_iter_ctx[cur_order].reset();
-        }
+        RETURN_IF_ERROR(_advance(ctx));
     }
     RETURN_IF_ERROR(_row_sources_buf->append(tmp_row_sources));
     if (!_merge_heap.empty()) {
@@ -513,6 +524,32 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
     return Status::EndOfFile("no more data in segment");
 }
 
+Status VerticalHeapMergeIterator::_advance(VerticalMergeIteratorContext* ctx) {
+    RETURN_IF_ERROR(ctx->advance());
+    if (ctx->valid()) {
+        _merge_heap.push(ctx);
+    } else {
+        // push next iterator in same rowset into heap
+        size_t cur_order = ctx->order();
+        for (size_t next_order = cur_order + 1;
+             next_order < _iterator_init_flags.size() && !_iterator_init_flags[next_order];
+             ++next_order) {
+            auto& next_ctx = _ori_iter_ctx[next_order];
+            DCHECK(next_ctx);
+            RETURN_IF_ERROR(next_ctx->init(_opts));
+            if (next_ctx->valid()) {
+                _merge_heap.push(next_ctx.get());
+                break;
+            }
+            // next_ctx is empty segment, move to next
+            next_ctx.reset();
+        }
+        // Release ctx earlier to reduce resource consumed
+        _ori_iter_ctx[cur_order].reset();
+    }
+    return Status::OK();
+}
+
 Status VerticalHeapMergeIterator::init(const StorageReadOptions& opts,
                                        CompactionSampleInfo* sample_info) {
     DCHECK(_origin_iters.size() == _iterator_init_flags.size());
@@ -162,6 +162,9 @@ public:
     Status block_reset(const std::shared_ptr<Block>& block);
     Status init(const StorageReadOptions& opts, CompactionSampleInfo* sample_info = nullptr);
     bool compare(const VerticalMergeIteratorContext& rhs) const;
+    // Return true if the key of the last row of the current block is less than the key of the
+    // current row of `rhs`, then all the remaining rows of the block come before `rhs`.
+    bool block_tail_less_than(const VerticalMergeIteratorContext& rhs) const;
     Status copy_rows(Block* block, bool advanced = true);
     Status copy_rows(Block* block, size_t count);
 
@@ -195,6 +198,10 @@ public:
         DCHECK(_record_rowids);
         return _block_row_locations[_index_in_block];
     }
+    RowLocation row_location(size_t offset) {
+        DCHECK(_record_rowids);
+        return _block_row_locations[_index_in_block + offset];
+    }
 
     size_t bytes() {
         if (_block) {
@@ -280,6 +287,10 @@ public:
 private:
     int _get_size(Block* block) { return block->rows(); }
 
+    // Advance `ctx` past its current row and push it back into the heap, or push the next
+    // iterator of the same rowset if it's finished.
+    Status _advance(VerticalMergeIteratorContext* ctx);
+
     // It will be released after '_merge_heap' has been built.
     std::vector<RowwiseIteratorUPtr> _origin_iters;
     std::vector<bool> _iterator_init_flags;
@@ -85,6 +85,9 @@ public:
 
     Status clone(RuntimeState* state, std::unique_ptr<PartitionerBase>& partitioner) override;
 
+    // the initial value of the crc32 hash of the rows
+    void set_hash_seed(uint32_t seed) { _hash_seed = seed; }
+
 protected:
     Status _get_partition_column_result(Block* block, std::vector<int>& result) const {
         int counter = 0;
@@ -98,6 +101,7 @@ protected:
 
     VExprContextSPtrs _partition_expr_ctxs;
     mutable std::vector<uint32_t> _hash_vals;
+    uint32_t _hash_seed = 0;
 };
 
 struct ShuffleChannelIds {
@@ -113,5 +117,19 @@ struct SpillPartitionChannelIds {
         return ((l >> 16) | (l << 16)) % r;
     }
 };
+
+// Crc32 is linear in its seed, so the hash is mixed before taking the modulo, for the rows of
+// one spilled partition to spread over all the partitions of a hash seed of the next level.
+struct SpillRePartitionChannelIds {
+    template <typename HashValueType>
+    HashValueType operator()(HashValueType l, size_t r) {
+        l ^= l >> 16;
+        l *= 0x85ebca6b;
+        l ^= l >> 13;
+        l *= 0xc2b2ae35;
+        l ^= l >> 16;
+        return l % r;
+    }
+};
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
@@ -1949,10 +1949,82 @@ bool DateV2Value<T>::from_date_str(const char* date_str, int len,
                                    bool convert_zero) {
     return from_date_str_base(date_str, len, scale, &local_time_zone, convert_zero);
 }
+// the value of the `N` digits at `str`, or -1 if any of them is not a digit
+template <int N>
+static inline int parse_fixed_digits(const char* str) {
+    int value = 0;
+    for (int i = 0; i < N; ++i) {
+        auto digit = static_cast<unsigned char>(str[i] - '0');
+        if (digit > 9) {
+            return -1;
+        }
+        value = value * 10 + digit;
+    }
+    return value;
+}
+
+template <typename T>
+bool DateV2Value<T>::from_fixed_format_date_str(const char* date_str, int len, int scale) {
+    constexpr int DATE_LEN = 10;     // YYYY-MM-DD
+    constexpr int DATETIME_LEN = 19; // YYYY-MM-DD HH:MM:SS
+    if (len != DATE_LEN && len < DATETIME_LEN) {
+        return false;
+    }
+    if (date_str[4] != '-' || date_str[7] != '-') {
+        return false;
+    }
+    const int year = parse_fixed_digits<4>(date_str);
+    const int month = parse_fixed_digits<2>(date_str + 5);
+    const int day = parse_fixed_digits<2>(date_str + 8);
+    if (year < 0 || month < 0 || day < 0) {
+        return false;
+    }
+
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    uint32_t microsecond = 0;
+    if (len > DATE_LEN) {
+        if ((date_str[10] != ' ' && date_str[10] != 'T') || date_str[13] != ':' ||
+            date_str[16] != ':') {
+            return false;
+        }
+        hour = parse_fixed_digits<2>(date_str + 11);
+        minute = parse_fixed_digits<2>(date_str + 14);
+        second = parse_fixed_digits<2>(date_str + 17);
+        if (hour < 0 || minute < 0 || second < 0) {
+            return false;
+        }
+        if (len > DATETIME_LEN) {
+            // the fraction longer than the scale is rounded by from_date_str_base
+            const int fraction_len = len - DATETIME_LEN - 1;
+            if (!is_datetime || date_str[DATETIME_LEN] != '.' || fraction_len < 1 ||
+                fraction_len > std::min(scale, 6)) {
+                return false;
+            }
+            for (int i = 0; i < fraction_len; ++i) {
+                auto digit = static_cast<unsigned char>(date_str[DATETIME_LEN + 1 + i] - '0');
+                if (digit > 9) {
+                    return false;
+                }
+                microsecond = microsecond * 10 + digit;
+            }
+            microsecond *= static_cast<uint32_t>(int_exp10(6 - fraction_len));
+        }
+    }
+    return check_range_and_set_time(static_cast<uint16_t>(year), static_cast<uint8_t>(month),
+                                    static_cast<uint8_t>(day), static_cast<uint8_t>(hour),
+                                    static_cast<uint8_t>(minute), static_cast<uint8_t>(second),
+                                    microsecond);
+}
+
 // if local_time_zone is null, only be able to parse time without timezone
 template <typename T>
 bool DateV2Value<T>::from_date_str_base(const char* date_str, int len, int scale,
                                         const cctz::time_zone* local_time_zone, bool convert_zero) {
+    if (from_fixed_format_date_str(date_str, len, scale)) {
+        return true;
+    }
     const char* ptr = date_str;
     const char* end = date_str + len;
     // ONLY 2, 6 can follow by a space
@@ -1330,6 +1330,11 @@ private:
     bool from_date_str_base(const char* date_str, int len, int scale,
                             const cctz::time_zone* local_time_zone, bool convert_zero);
 
+    // The fast path of from_date_str_base for 'YYYY-MM-DD', 'YYYY-MM-DD HH:MM:SS' and
+    // 'YYYY-MM-DD HH:MM:SS.ffffff' whose fraction needs no rounding. Returns false if `date_str`
+    // is not in these formats or is invalid, then it is parsed by from_date_str_base.
+    bool from_fixed_format_date_str(const char* date_str, int len, int scale);
+
     // Used to construct from int value
     int64_t standardize_timevalue(int64_t value);
 
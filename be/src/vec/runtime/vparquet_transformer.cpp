@@ -232,6 +232,11 @@ Status VParquetTransformer::_parse_properties() {
             arrow_builder.enable_deprecated_int96_timestamps();
         }
         arrow_builder.store_schema();
+        if (config::enable_parquet_writer_parallel_column_write) {
+            // The column chunks of the buffered row group are encoded and compressed on the
+            // arrow cpu thread pool, which is shared by all the writers.
+            arrow_builder.set_use_threads(true);
+        }
         _arrow_properties = arrow_builder.build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
@@ -76,11 +76,12 @@ Status VSortedRunMerger::prepare(const std::vector<BlockSupplier>& input_runs) {
         return Status::Cancelled(e.what());
     }
 
+    std::vector<MergeSortCursor> cursors;
+    cursors.reserve(_cursors.size());
     for (auto& cursor : _cursors) {
-        if (!cursor->eof()) {
-            _priority_queue.push(MergeSortCursor(cursor));
-        }
+        cursors.emplace_back(cursor);
     }
+    _loser_tree.init(std::move(cursors));
 
     return Status::OK();
 }
@@ -91,16 +92,18 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     // copy the data of block.
     // return the data in receive data directly
 
-    if (_pending_cursor != nullptr) {
-        MergeSortCursor cursor(_pending_cursor);
+    if (_top_pending) {
+        auto& cursor = _loser_tree.top();
         {
             ScopedTimer<MonotonicStopWatch> timer1(_get_next_block_timer);
             cursor->process_next();
         }
         if (!cursor->eof()) {
-            _priority_queue.push(cursor);
+            _loser_tree.update_top();
+        } else {
+            _loser_tree.remove_top();
         }
-        _pending_cursor = nullptr;
+        _top_pending = false;
     }
 
     Defer set_limit([&]() {
@@ -111,11 +114,11 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         }
     });
 
-    if (_priority_queue.empty()) {
+    if (_loser_tree.empty()) {
         *eos = true;
         return Status::OK();
-    } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    } else if (_loser_tree.size() == 1) {
+        auto current = _loser_tree.top();
         DCHECK(!current->eof());
         DCHECK(current->block_ptr() != nullptr);
         while (_offset != 0) {
@@ -123,11 +126,11 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             current->next(process_rows);
             _offset -= process_rows;
             if (current->is_last(0)) {
-                _priority_queue.pop();
                 if (current->eof()) {
+                    _loser_tree.remove_top();
                     *eos = true;
                 } else {
-                    _pending_cursor = current.impl;
+                    _top_pending = true;
                 }
                 return Status::OK();
             }
@@ -143,16 +146,16 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         current->block_ptr()->swap(*output_block);
         current->next(current->rows - current->pos);
         if (current->eof()) {
+            _loser_tree.remove_top();
             *eos = true;
         } else {
-            _pending_cursor = current.impl;
+            _top_pending = true;
         }
-        _priority_queue.pop();
         return Status::OK();
     } else {
-        size_t num_columns = _priority_queue.top().impl->block->columns();
+        size_t num_columns = _loser_tree.top().impl->block->columns();
         MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(
-                output_block, *_priority_queue.top().impl->block);
+                output_block, *_loser_tree.top().impl->block);
         MutableColumns& merged_columns = m_block.mutable_columns();
 
         if (num_columns != merged_columns.size()) {
@@ -180,19 +183,23 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 
         /// Take rows from queue in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
+        while (merged_rows != _batch_size && !_loser_tree.empty()) {
+            auto current = _loser_tree.top();
 
             if (_offset > 0) {
                 _offset--;
+                current->next();
             } else {
-                _indexs.emplace_back(current->pos);
-                _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
+                // take the whole run of rows the winner keeps winning at once
+                size_t run_rows = _loser_tree.top_run_length(_batch_size - merged_rows);
+                for (size_t i = 0; i < run_rows; ++i) {
+                    _indexs.emplace_back(current->pos + i);
+                    _block_addrs.emplace_back(current->block_ptr());
+                }
+                merged_rows += run_rows;
+                current->next(run_rows);
             }
 
-            current->next();
             if (_need_more_data(current)) {
                 do_insert();
                 return Status::OK();
@@ -212,12 +219,13 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 
 bool VSortedRunMerger::_need_more_data(MergeSortCursor& current) {
     if (!current->is_last(0)) {
-        _priority_queue.push(current);
+        _loser_tree.update_top();
         return false;
     } else if (current->eof()) {
+        _loser_tree.remove_top();
         return false;
     } else {
-        _pending_cursor = current.impl;
+        _top_pending = true;
         return true;
     }
 }
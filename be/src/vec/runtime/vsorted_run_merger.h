@@ -20,7 +20,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
 #include <vector>
 
 #include "common/status.h"
@@ -35,8 +34,8 @@ namespace doris::vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that maintains the run with the next
+// rows in sorted order at the root of the tree.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -54,8 +53,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -74,11 +72,12 @@ protected:
     size_t _offset = 0;
 
     std::vector<std::shared_ptr<BlockSupplierSortCursorImpl>> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    MergeSortLoserTree _loser_tree;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
-    /// we make it as a pending cursor until the supplier is readable.
-    std::shared_ptr<MergeSortCursorImpl> _pending_cursor = nullptr;
+    /// we make it as a pending cursor until the supplier is readable. The pending
+    /// cursor is always the winner of the loser tree.
+    bool _top_pending = false;
 
     // Times calls to get_next().
     RuntimeProfile::Counter* _get_next_timer = nullptr;
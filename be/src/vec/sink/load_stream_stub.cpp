@@ -468,6 +468,7 @@ void LoadStreamStub::_handle_failure(butil::IOBuf& buf, Status st) {
 }
 
 Status LoadStreamStub::_send_with_retry(butil::IOBuf& buf) {
+    auto bytes = static_cast<int64_t>(buf.size());
     for (;;) {
         RETURN_IF_ERROR(_check_cancel());
         int ret;
@@ -483,8 +484,11 @@ Status LoadStreamStub::_send_with_retry(butil::IOBuf& buf) {
         DBUG_EXECUTE_IF("LoadStreamStub._send_with_retry.stream_write_failed", { ret = EPIPE; });
         switch (ret) {
         case 0:
+            _bytes_sent.fetch_add(bytes, std::memory_order_relaxed);
+            _is_congested.store(false, std::memory_order_relaxed);
             return Status::OK();
         case EAGAIN: {
+            _is_congested.store(true, std::memory_order_relaxed);
             const timespec time = butil::seconds_from_now(config::load_stream_eagain_wait_seconds);
             int wait_ret = brpc::StreamWait(_stream_id, &time);
             if (wait_ret != 0) {
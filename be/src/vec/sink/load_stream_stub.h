@@ -201,6 +201,12 @@ public:
 
     bool is_incremental() const { return _is_incremental; }
 
+    int64_t bytes_sent() const { return _bytes_sent.load(std::memory_order_relaxed); }
+
+    // true if the last write got EAGAIN, i.e. the stream window is full because the receiver
+    // falls behind
+    bool is_congested() const { return _is_congested.load(std::memory_order_relaxed); }
+
     friend std::ostream& operator<<(std::ostream& ostr, const LoadStreamStub& stub);
 
     std::string to_string();
@@ -240,6 +246,8 @@ protected:
     std::atomic<bool> _is_closed;
     std::atomic<bool> _is_cancelled;
     std::atomic<bool> _is_eos;
+    std::atomic<int64_t> _bytes_sent {0};
+    std::atomic<bool> _is_congested {false};
 
     PUniqueId _load_id;
     brpc::StreamId _stream_id;
@@ -299,7 +307,24 @@ public:
             return nullptr;
         }
         size_t i = _select_index.fetch_add(1);
-        return _streams[i % _streams.size()];
+        if (!config::enable_load_stream_select_by_load || _streams.size() == 1) {
+            return _streams[i % _streams.size()];
+        }
+        // Start from the round-robin one, and take the least loaded stream: one not congested
+        // first, then the one which sent less bytes, since the messages of a stream are handled
+        // in order by the receiver.
+        size_t selected = i % _streams.size();
+        for (size_t k = 1; k < _streams.size(); k++) {
+            size_t j = (i + k) % _streams.size();
+            bool congested = _streams[j]->is_congested();
+            bool selected_congested = _streams[selected]->is_congested();
+            if (congested != selected_congested
+                        ? !congested
+                        : _streams[j]->bytes_sent() < _streams[selected]->bytes_sent()) {
+                selected = j;
+            }
+        }
+        return _streams[selected];
     }
 
     void cancel(Status reason) {
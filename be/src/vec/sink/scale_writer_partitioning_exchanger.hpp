@@ -22,6 +22,8 @@
 #include <iostream>
 #include <vector>
 
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/core/block.h"
 #include "vec/exec/skewed_partition_rebalancer.h"
 #include "vec/runtime/partitioner.h"
@@ -41,6 +43,7 @@ public:
                                     min_partition_data_processed_rebalance_threshold,
                                     min_data_processed_rebalance_threshold),
               _partition_row_counts(partition_count, 0),
+              _partition_data_sizes(partition_count, 0),
               _partition_writer_ids(partition_count, -1),
               _partition_writer_indexes(partition_count, 0),
               _task_count(task_count),
@@ -92,9 +95,12 @@ public:
             _hash_vals[position] = writer_id;
         }
 
+        _calculate_partition_data_sizes(*block, crc_values);
         for (size_t partition_id = 0; partition_id < _partition_row_counts.size(); partition_id++) {
             _partition_rebalancer.add_partition_row_count(partition_id,
                                                           _partition_row_counts[partition_id]);
+            _partition_rebalancer.add_partition_data_size(partition_id,
+                                                          _partition_data_sizes[partition_id]);
         }
         _partition_rebalancer.add_data_processed(block->bytes());
 
@@ -114,6 +120,32 @@ public:
     }
 
 private:
+    // The fixed length columns are charged evenly to the rows, and the strings by their own sizes,
+    // so a partition of long strings is not taken as one of the average size.
+    void _calculate_partition_data_sizes(const Block& block, const uint32_t* crc_values) const {
+        size_t rows = block.rows();
+        size_t fixed_bytes = block.bytes();
+        std::vector<const ColumnString*> string_columns;
+        for (const auto& column_with_type_and_name : block) {
+            ColumnPtr column = remove_nullable(column_with_type_and_name.column);
+            const auto* string_column = check_and_get_column<ColumnString>(*column);
+            if (string_column != nullptr) {
+                string_columns.push_back(string_column);
+                fixed_bytes -= std::min(fixed_bytes, string_column->get_chars().size());
+            }
+        }
+        long row_fixed_bytes = rows == 0 ? 0 : fixed_bytes / rows;
+        for (int partition_id = 0; partition_id < _partition_row_counts.size(); partition_id++) {
+            _partition_data_sizes[partition_id] =
+                    _partition_row_counts[partition_id] * row_fixed_bytes;
+        }
+        for (const auto* string_column : string_columns) {
+            for (size_t position = 0; position < rows; position++) {
+                _partition_data_sizes[crc_values[position]] += string_column->size_at(position);
+            }
+        }
+    }
+
     int _get_next_writer_id(int partition_id) const {
         return _partition_rebalancer.get_task_id(partition_id,
                                                  _partition_writer_indexes[partition_id]++);
@@ -123,6 +155,7 @@ private:
     std::unique_ptr<PartitionerBase> _crc_partitioner;
     mutable SkewedPartitionRebalancer _partition_rebalancer;
     mutable std::vector<int> _partition_row_counts;
+    mutable std::vector<long> _partition_data_sizes;
     mutable std::vector<int> _partition_writer_ids;
     mutable std::vector<int> _partition_writer_indexes;
     mutable std::vector<HashValType> _hash_vals;
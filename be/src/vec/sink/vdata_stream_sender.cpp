@@ -104,6 +104,10 @@ Status Channel::open(RuntimeState* state) {
     _be_number = state->be_number();
     _brpc_timeout_ms = get_execution_rpc_timeout_ms(state->execution_timeout());
     _serializer.set_is_local(_is_local);
+    // Another BE process on the same host, the data only goes through the loopback device,
+    // so compression costs cpu but saves nothing.
+    _serializer.set_skip_compression(!_is_local && config::exchange_skip_compression_for_same_host &&
+                                     _brpc_dest_addr.hostname == BackendOptions::get_localhost());
 
     // In bucket shuffle join will set fragment_instance_id (-1, -1)
     // to build a camouflaged empty channel. the ip and port is '0.0.0.0:0"
@@ -330,13 +334,44 @@ Status BlockSerializer::_serialize_block(PBlock* dest, size_t num_receivers) {
     return Status::OK();
 }
 
+segment_v2::CompressionTypePB BlockSerializer::_next_compression_type() {
+    if (_skip_compression) {
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    if (_adaptive_uncompressed_blocks > 0) {
+        _adaptive_uncompressed_blocks--;
+        if (_parent->_adaptive_uncompressed_blocks_counter) {
+            COUNTER_UPDATE(_parent->_adaptive_uncompressed_blocks_counter, 1);
+        }
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    return _parent->compression_type();
+}
+
+void BlockSerializer::_update_compression_ratio(segment_v2::CompressionTypePB compression_type,
+                                                size_t uncompressed_bytes,
+                                                size_t compressed_bytes) {
+    if (!config::enable_exchange_adaptive_compression ||
+        compression_type == segment_v2::CompressionTypePB::NO_COMPRESSION ||
+        uncompressed_bytes == 0) {
+        return;
+    }
+    // Data like uuids, hashes or random doubles costs cpu to compress but saves nothing, send
+    // the following blocks of this channel without compression and probe again later.
+    if (compressed_bytes * 100 >= uncompressed_bytes * (100 - MIN_COMPRESSION_SAVED_PERCENT)) {
+        _adaptive_uncompressed_blocks = ADAPTIVE_COMPRESSION_PROBE_INTERVAL;
+    }
+}
+
 Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t num_receivers) {
     SCOPED_TIMER(_parent->_serialize_batch_timer);
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    auto compression_type = _next_compression_type();
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, compression_type,
                                    _parent->transfer_large_data_by_brpc()));
+    _update_compression_ratio(compression_type, uncompressed_bytes, compressed_bytes);
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
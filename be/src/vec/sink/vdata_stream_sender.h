@@ -93,15 +93,30 @@ public:
     void set_is_local(bool is_local) { _is_local = is_local; }
     bool is_local() const { return _is_local; }
 
+    // Send the serialized blocks without compression, used if the receiver is on the same host.
+    void set_skip_compression(bool skip_compression) { _skip_compression = skip_compression; }
+
     void set_low_memory_mode(RuntimeState* state) { _buffer_mem_limit = 4 * 1024 * 1024; }
 
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
+    segment_v2::CompressionTypePB _next_compression_type();
+    void _update_compression_ratio(segment_v2::CompressionTypePB compression_type,
+                                   size_t uncompressed_bytes, size_t compressed_bytes);
+
+    // If compression saves less than this ratio (in percent) of bytes, the data is considered
+    // incompressible.
+    static constexpr size_t MIN_COMPRESSION_SAVED_PERCENT = 10;
+    // Number of blocks sent without compression before probing the compression ratio again.
+    static constexpr int ADAPTIVE_COMPRESSION_PROBE_INTERVAL = 16;
 
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
 
     bool _is_local;
+    bool _skip_compression = false;
+    // remaining blocks to send without compression because the data is incompressible
+    int _adaptive_uncompressed_blocks = 0;
     const int _batch_size;
     std::atomic<size_t> _buffer_mem_limit = UINT64_MAX;
 };
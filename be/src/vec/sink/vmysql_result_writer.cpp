@@ -174,6 +174,32 @@ Status VMysqlResultWriter<is_binary_format>::_set_options(
     return Status::OK();
 }
 
+template <bool is_binary_format>
+void VMysqlResultWriter<is_binary_format>::_init_serdes(const Block& block) {
+    const size_t num_cols = _output_vexpr_ctxs.size();
+    _serdes.reserve(num_cols);
+    for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+        int scale = _output_vexpr_ctxs[col_idx]->root()->data_type()->get_scale();
+        // decimalv2 scale and precision is hard code, so we should get real scale and precision
+        // from expr
+        DataTypeSerDeSPtr serde;
+        if (_output_vexpr_ctxs[col_idx]->root()->data_type()->get_primitive_type() ==
+            PrimitiveType::TYPE_DECIMALV2) {
+            if (_output_vexpr_ctxs[col_idx]->root()->is_nullable()) {
+                auto nested_serde =
+                        std::make_shared<DataTypeDecimalSerDe<TYPE_DECIMALV2>>(27, scale);
+                serde = std::make_shared<DataTypeNullableSerDe>(nested_serde);
+            } else {
+                serde = std::make_shared<DataTypeDecimalSerDe<TYPE_DECIMALV2>>(27, scale);
+            }
+        } else {
+            serde = block.get_by_position(col_idx).type->get_serde();
+        }
+        serde->set_return_object_as_string(output_object_data());
+        _serdes.push_back(std::move(serde));
+    }
+}
+
 template <bool is_binary_format>
 Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* state, Block& block) {
     Status status = Status::OK();
@@ -184,7 +210,11 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
     uint64_t bytes_sent = 0;
     {
         SCOPED_TIMER(_convert_tuple_timer);
-        MysqlRowBuffer<is_binary_format> row_buffer;
+        if (_serdes.empty()) {
+            _init_serdes(block);
+        }
+        auto& row_buffer = _row_buffer;
+        row_buffer.reset();
         if constexpr (is_binary_format) {
             row_buffer.start_binary_row(_output_vexpr_ctxs.size());
         }
@@ -202,24 +232,7 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
         for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
             const auto& [column_ptr, col_const] =
                     unpack_if_const(block.get_by_position(col_idx).column);
-            int scale = _output_vexpr_ctxs[col_idx]->root()->data_type()->get_scale();
-            // decimalv2 scale and precision is hard code, so we should get real scale and precision
-            // from expr
-            DataTypeSerDeSPtr serde;
-            if (_output_vexpr_ctxs[col_idx]->root()->data_type()->get_primitive_type() ==
-                PrimitiveType::TYPE_DECIMALV2) {
-                if (_output_vexpr_ctxs[col_idx]->root()->is_nullable()) {
-                    auto nested_serde =
-                            std::make_shared<DataTypeDecimalSerDe<TYPE_DECIMALV2>>(27, scale);
-                    serde = std::make_shared<DataTypeNullableSerDe>(nested_serde);
-                } else {
-                    serde = std::make_shared<DataTypeDecimalSerDe<TYPE_DECIMALV2>>(27, scale);
-                }
-            } else {
-                serde = block.get_by_position(col_idx).type->get_serde();
-            }
-            serde->set_return_object_as_string(output_object_data());
-            arguments.emplace_back(column_ptr.get(), col_const, serde);
+            arguments.emplace_back(column_ptr.get(), col_const, _serdes[col_idx]);
         }
 
         for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
@@ -241,7 +254,7 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
 
             // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+            result->result_batch.rows[row_idx].assign(row_buffer.buf(), row_buffer.length());
             bytes_sent += row_buffer.length();
             row_buffer.reset();
             if constexpr (is_binary_format) {
@@ -82,6 +82,7 @@ private:
     void _init_profile();
     Status _set_options(const TSerdeDialect::type& serde_dialect);
     Status _write_one_block(RuntimeState* state, Block& block);
+    void _init_serdes(const Block& block);
 
     std::shared_ptr<MySQLResultBlockBuffer> _sinker = nullptr;
 
@@ -104,6 +105,12 @@ private:
     uint64_t _bytes_sent = 0;
 
     DataTypeSerDe::FormatOptions _options;
+
+    // The serdes of the output columns, built for the first block and reused by the later ones,
+    // since the output types don't change.
+    DataTypeSerDeSPtrs _serdes;
+    // Reused by all the rows of all the blocks, so its buffer grows to the widest row only once.
+    MysqlRowBuffer<is_binary_format> _row_buffer;
 };
 } // namespace vectorized
 } // namespace doris
@@ -76,6 +76,10 @@ Status VWalWriter::write_wal(vectorized::Block* block) {
     return Status::OK();
 }
 
+Status VWalWriter::sync_wal() {
+    return _wal_writer->sync();
+}
+
 Status VWalWriter::close() {
     if (config::group_commit_wait_replay_wal_finish) {
         std::string wal_path;
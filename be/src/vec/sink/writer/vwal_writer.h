@@ -35,6 +35,7 @@ public:
     ~VWalWriter();
     Status init();
     Status write_wal(vectorized::Block* block);
+    Status sync_wal();
     Status close();
 
 private:
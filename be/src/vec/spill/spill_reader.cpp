@@ -22,6 +22,7 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
@@ -121,21 +122,41 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    Slice result(read_buff_.data(), bytes_to_read);
-    size_t bytes_read = 0;
-    {
-        SCOPED_TIMER(_read_file_timer);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+    size_t block_start = block_start_offsets_[read_block_index_];
+    if (block_start < read_buff_begin_ || block_start + bytes_to_read > read_buff_end_) {
+        // read the following blocks together with this one, up to spill_io_batch_bytes
+        size_t end_index = read_block_index_ + 1;
+        while (end_index < block_count_ &&
+               block_start_offsets_[end_index + 1] - block_start <=
+                       static_cast<size_t>(config::spill_io_batch_bytes)) {
+            ++end_index;
+        }
+        size_t batch_bytes = block_start_offsets_[end_index] - block_start;
+        read_buff_.resize(batch_bytes);
+
+        Slice batch(read_buff_.data(), batch_bytes);
+        size_t batch_bytes_read = 0;
+        {
+            SCOPED_TIMER(_read_file_timer);
+            RETURN_IF_ERROR(file_reader_->read_at(block_start, batch, &batch_bytes_read));
+        }
+        DCHECK(batch_bytes_read == batch_bytes);
+        read_buff_begin_ = block_start;
+        read_buff_end_ = block_start + batch_bytes_read;
+
+        COUNTER_UPDATE(_read_file_size, batch_bytes_read);
+        ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(batch_bytes_read);
+        if (_resource_ctx) {
+            _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(
+                    batch_bytes_read);
+        }
     }
+
+    Slice result(read_buff_.data() + (block_start - read_buff_begin_), bytes_to_read);
+    size_t bytes_read = std::min(bytes_to_read, read_buff_end_ - block_start);
     DCHECK(bytes_read == bytes_to_read);
 
     if (bytes_read > 0) {
-        COUNTER_UPDATE(_read_file_size, bytes_read);
-        ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
-        if (_resource_ctx) {
-            _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
-        }
         COUNTER_UPDATE(_read_block_count, 1);
         {
             SCOPED_TIMER(_deserialize_timer);
@@ -78,6 +78,9 @@ private:
     size_t read_block_index_ = 0;
     size_t max_sub_block_size_ = 0;
     PaddedPODArray<char> read_buff_;
+    // the file range [read_buff_begin_, read_buff_end_) is in read_buff_
+    size_t read_buff_begin_ = 0;
+    size_t read_buff_end_ = 0;
     std::vector<size_t> block_start_offsets_;
 
     PBlock pb_block_;
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #include "io/fs/local_file_system.h"
@@ -53,6 +54,7 @@ SpillStream::SpillStream(RuntimeState* state, int64_t stream_id, SpillDataDir* d
     _total_file_count = custom_profile->get_counter("SpillWriteFileTotalCount");
     _current_file_count = custom_profile->get_counter("SpillWriteFileCurrentCount");
     _current_file_size = custom_profile->get_counter("SpillWriteFileCurrentBytes");
+    _write_throttle_timer = ADD_TIMER_WITH_LEVEL(custom_profile, "SpillWriteThrottleTime", 1);
 }
 
 void SpillStream::update_shared_profiles(RuntimeProfile* source_op_profile) {
@@ -135,6 +137,17 @@ Status SpillStream::spill_block(RuntimeState* state, const Block& block, bool eo
         return Status::Error<INTERNAL_ERROR>("fault_inject spill_stream spill_block failed");
     });
     RETURN_IF_ERROR(writer_->write(state, block, written_bytes));
+    if (auto* limiter = state->get_query_ctx()->spill_write_limiter();
+        limiter != nullptr && written_bytes > 0) {
+        SCOPED_TIMER(_write_throttle_timer);
+        auto wait_ns = limiter->take(static_cast<int64_t>(written_bytes));
+        // wait in slices to stop soon when the query is cancelled
+        while (wait_ns > 0 && !state->is_cancelled()) {
+            auto slice_ns = std::min(wait_ns, MAX_THROTTLE_WAIT_SLICE_NS);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(slice_ns));
+            wait_ns -= slice_ns;
+        }
+    }
     if (eof) {
         RETURN_IF_ERROR(spill_eof());
     } else {
@@ -38,6 +38,8 @@ public:
     // to avoid too many small file writes
     static constexpr size_t MIN_SPILL_WRITE_BATCH_MEM = 32 * 1024;
     static constexpr size_t MAX_SPILL_WRITE_BATCH_MEM = 32 * 1024 * 1024;
+    // the max time of one sleep when the spill writes of the query are throttled
+    static constexpr int64_t MAX_THROTTLE_WAIT_SLICE_NS = 100L * 1000 * 1000;
     SpillStream(RuntimeState* state, int64_t stream_id, SpillDataDir* data_dir,
                 std::string spill_dir, size_t batch_rows, size_t batch_bytes,
                 RuntimeProfile* profile);
@@ -104,6 +106,7 @@ private:
     RuntimeProfile::Counter* _current_file_count = nullptr;
     RuntimeProfile::Counter* _total_file_count = nullptr;
     RuntimeProfile::Counter* _current_file_size = nullptr;
+    RuntimeProfile::Counter* _write_throttle_timer = nullptr;
 };
 using SpillStreamSPtr = std::shared_ptr<SpillStream>;
 } // namespace vectorized
@@ -18,6 +18,7 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
@@ -77,6 +78,12 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
     if (rows <= batch_size_) {
         return _write_internal(block, written_bytes);
     } else {
+        // the sub blocks are serialized into buffers and written in batches
+        Defer release_buffers {[&]() {
+            COUNTER_UPDATE(_memory_used_counter, -buffers_bytes_);
+            buffers_.clear();
+            buffers_bytes_ = 0;
+        }};
         auto tmp_block = block.clone_empty();
         const auto& src_data = block.get_columns_with_type_and_name();
 
@@ -96,82 +103,94 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
             int64_t tmp_blcok_mem = tmp_block.allocated_bytes();
             COUNTER_UPDATE(_memory_used_counter, tmp_blcok_mem);
             Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -tmp_blcok_mem); }};
-            RETURN_IF_ERROR(_write_internal(tmp_block, written_bytes));
+            RETURN_IF_ERROR(_serialize_block(tmp_block));
+            if (buffers_bytes_ >= config::spill_io_batch_bytes) {
+                RETURN_IF_ERROR(_flush_buffers(written_bytes));
+            }
 
             row_idx += block_rows;
         }
-        return Status::OK();
+        return _flush_buffers(written_bytes);
     }
 }
 
 Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
-    size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    Defer release_buffers {[&]() {
+        COUNTER_UPDATE(_memory_used_counter, -buffers_bytes_);
+        buffers_.clear();
+        buffers_bytes_ = 0;
+    }};
+    RETURN_IF_ERROR(_serialize_block(block));
+    return _flush_buffers(written_bytes);
+}
 
-    Status status;
+Status SpillWriter::_serialize_block(const Block& block) {
+    if (block.rows() == 0) {
+        return Status::OK();
+    }
+    size_t uncompressed_bytes = 0, compressed_bytes = 0;
     std::string buff;
-    int64_t buff_size {0};
-
-    if (block.rows() > 0) {
-        {
-            PBlock pblock;
-            SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
-            RETURN_IF_ERROR(status);
-            int64_t pblock_mem = pblock.ByteSizeLong();
-            COUNTER_UPDATE(_memory_used_counter, pblock_mem);
-            Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
-            if (!pblock.SerializeToString(&buff)) {
-                return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
-                        "serialize spill data error. [path={}]", file_path_);
-            }
-            buff_size = buff.size();
-            COUNTER_UPDATE(_memory_used_counter, buff_size);
-            Defer defer2 {[&]() { COUNTER_UPDATE(_memory_used_counter, -buff_size); }};
-        }
-        if (data_dir_->reach_capacity_limit(buff_size)) {
-            return Status::Error<ErrorCode::DISK_REACH_CAPACITY_LIMIT>(
-                    "spill data total size exceed limit, path: {}, size limit: {}, spill data "
-                    "size: {}",
-                    data_dir_->path(),
-                    PrettyPrinter::print_bytes(data_dir_->get_spill_data_limit()),
-                    PrettyPrinter::print_bytes(data_dir_->get_spill_data_bytes()));
-        }
+    PBlock pblock;
+    SCOPED_TIMER(_serialize_timer);
+    RETURN_IF_ERROR(block.serialize(
+            BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
+            &compressed_bytes,
+            segment_v2::CompressionTypePB::ZSTD)); // ZSTD for better compression ratio
+    int64_t pblock_mem = pblock.ByteSizeLong();
+    COUNTER_UPDATE(_memory_used_counter, pblock_mem);
+    Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
+    if (!pblock.SerializeToString(&buff)) {
+        return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
+                "serialize spill data error. [path={}]", file_path_);
+    }
+    int64_t buff_size = buff.size();
+    COUNTER_UPDATE(_memory_used_counter, buff_size);
+    buffers_bytes_ += buff_size;
+    buffers_.emplace_back(std::move(buff));
+    return Status::OK();
+}
 
-        {
-            Defer defer {[&]() {
-                if (status.ok()) {
-                    data_dir_->update_spill_data_usage(buff_size);
-                    ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(buff_size);
-
-                    written_bytes += buff_size;
-                    max_sub_block_size_ = std::max(max_sub_block_size_, (size_t)buff_size);
-
-                    meta_.append((const char*)&total_written_bytes_, sizeof(size_t));
-                    COUNTER_UPDATE(_write_file_total_size, buff_size);
-                    if (_resource_ctx) {
-                        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(
-                                buff_size);
-                    }
-                    if (_write_file_current_size) {
-                        COUNTER_UPDATE(_write_file_current_size, buff_size);
-                    }
-                    COUNTER_UPDATE(_write_block_counter, 1);
-                    total_written_bytes_ += buff_size;
-                    ++written_blocks_;
-                }
-            }};
-            {
-                SCOPED_TIMER(_write_file_timer);
-                status = file_writer_->append(buff);
-                RETURN_IF_ERROR(status);
-            }
-        }
+Status SpillWriter::_flush_buffers(size_t& written_bytes) {
+    if (buffers_.empty()) {
+        return Status::OK();
+    }
+    Defer defer {[&]() {
+        COUNTER_UPDATE(_memory_used_counter, -buffers_bytes_);
+        buffers_.clear();
+        buffers_bytes_ = 0;
+    }};
+    if (data_dir_->reach_capacity_limit(buffers_bytes_)) {
+        return Status::Error<ErrorCode::DISK_REACH_CAPACITY_LIMIT>(
+                "spill data total size exceed limit, path: {}, size limit: {}, spill data "
+                "size: {}",
+                data_dir_->path(), PrettyPrinter::print_bytes(data_dir_->get_spill_data_limit()),
+                PrettyPrinter::print_bytes(data_dir_->get_spill_data_bytes()));
+    }
+
+    std::vector<Slice> slices(buffers_.begin(), buffers_.end());
+    {
+        SCOPED_TIMER(_write_file_timer);
+        RETURN_IF_ERROR(file_writer_->appendv(slices.data(), slices.size()));
     }
 
-    return status;
+    data_dir_->update_spill_data_usage(buffers_bytes_);
+    ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(buffers_bytes_);
+    COUNTER_UPDATE(_write_file_total_size, buffers_bytes_);
+    if (_resource_ctx) {
+        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(buffers_bytes_);
+    }
+    if (_write_file_current_size) {
+        COUNTER_UPDATE(_write_file_current_size, buffers_bytes_);
+    }
+    COUNTER_UPDATE(_write_block_counter, buffers_.size());
+    written_bytes += buffers_bytes_;
+    for (const auto& buff : buffers_) {
+        max_sub_block_size_ = std::max(max_sub_block_size_, buff.size());
+        meta_.append((const char*)&total_written_bytes_, sizeof(size_t));
+        total_written_bytes_ += static_cast<int64_t>(buff.size());
+        ++written_blocks_;
+    }
+    return Status::OK();
 }
 
 } // namespace doris::vectorized
\ No newline at end of file
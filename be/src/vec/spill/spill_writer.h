@@ -20,6 +20,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "io/fs/file_writer.h"
 #include "runtime/workload_management/resource_context.h"
@@ -73,6 +74,12 @@ public:
 private:
     Status _write_internal(const Block& block, size_t& written_bytes);
 
+    // serialize the block and append it to the buffers to write
+    Status _serialize_block(const Block& block);
+
+    // write all the buffers to the file in one IO
+    Status _flush_buffers(size_t& written_bytes);
+
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
@@ -87,6 +94,10 @@ private:
     int64_t total_written_bytes_ = 0;
     std::string meta_;
 
+    // the serialized blocks not written yet
+    std::vector<std::string> buffers_;
+    int64_t buffers_bytes_ = 0;
+
     RuntimeProfile::Counter* _write_file_timer = nullptr;
     RuntimeProfile::Counter* _serialize_timer = nullptr;
     RuntimeProfile::Counter* _write_block_counter = nullptr;
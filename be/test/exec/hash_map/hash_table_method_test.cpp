@@ -115,6 +115,31 @@ TEST(HashTableMethodTest, testMethodSerialized) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodSerializedTwoLevel) {
+    MethodSerialized<PHHashMap<StringRef, IColumn::ColumnIndex, DefaultHash<StringRef>, true>>
+            method;
+
+    test_insert(method, {ColumnHelper::create_column<DataTypeInt32>({1, 2, 3, 4, 5}),
+                         ColumnHelper::create_column<DataTypeString>({"1", "2", "3", "4", "5"})});
+
+    test_find(method,
+              {ColumnHelper::create_column<DataTypeInt32>({1, 2, 3, 4, 5}),
+               ColumnHelper::create_column<DataTypeString>({"1", "2", "3", "4", "5"})},
+              {0, 1, 2, 3, 4});
+
+    test_find(method,
+              {ColumnHelper::create_column<DataTypeInt32>({1, 2, 7, 4, 6, 5}),
+               ColumnHelper::create_column<DataTypeString>({"1", "2", "7", "4", "6", "5"})},
+              {0, 1, -1, 3, -1, 4});
+
+    size_t size = 0;
+    for (auto it = method.hash_table->begin(); it != method.hash_table->end(); ++it) {
+        ++size;
+    }
+    EXPECT_EQ(size, 5);
+    EXPECT_EQ(method.hash_table->size(), 5);
+}
+
 TEST(HashTableMethodTest, testMethodStringNoCache) {
     MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>> method;
 
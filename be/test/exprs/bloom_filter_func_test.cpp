@@ -291,6 +291,52 @@ TEST_F(BloomFilterFuncTest, InsertFixedLen) {
     ASSERT_EQ(offsets[1], 2);
 }
 
+TEST_F(BloomFilterFuncTest, FindFixedLenBatches) {
+    BloomFilterFunc<PrimitiveType::TYPE_INT> bloom_filter_func(true);
+    RuntimeFilterParams params {1,
+                                RuntimeFilterType::BLOOM_FILTER,
+                                PrimitiveType::TYPE_INT,
+                                false,
+                                0,
+                                0,
+                                0,
+                                256,
+                                0,
+                                0,
+                                false,
+                                false};
+    bloom_filter_func.init_params(&params);
+    auto st = bloom_filter_func.init_with_fixed_length(1024);
+    ASSERT_TRUE(st.ok()) << "Failed to init bloom filter with fixed length: " << st.to_string();
+
+    // the even values are inserted, more rows than one batch of the probe
+    const int rows = 1000;
+    std::vector<int32_t> inserted;
+    std::vector<int32_t> values;
+    std::vector<uint8_t> nulls;
+    for (int i = 0; i < rows; ++i) {
+        if (i % 2 == 0) {
+            inserted.push_back(i);
+        }
+        values.push_back(i);
+        nulls.push_back(i % 7 == 0);
+    }
+    bloom_filter_func.insert_fixed_len(
+            vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(inserted), 0);
+
+    auto column = vectorized::ColumnHelper::create_nullable_column<vectorized::DataTypeInt32>(
+            values, nulls);
+    std::vector<uint8_t> results(rows);
+    bloom_filter_func.find_fixed_len(column, results.data());
+    for (int i = 0; i < rows; ++i) {
+        if (nulls[i]) {
+            EXPECT_FALSE(results[i]) << i;
+        } else if (i % 2 == 0) {
+            EXPECT_TRUE(results[i]) << i;
+        }
+    }
+}
+
 TEST_F(BloomFilterFuncTest, Merge) {
     BloomFilterFunc<PrimitiveType::TYPE_INT> bloom_filter_func(false);
     const size_t runtime_length = 1024;
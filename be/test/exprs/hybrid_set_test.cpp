@@ -726,4 +726,43 @@ TEST_F(HybridSetTest, StringValueSet) {
     }
 }
 
+TEST_F(HybridSetTest, DenseBitmap) {
+    // every third value of [-3000, 3000) is dense enough for the bitmap
+    std::unique_ptr<HybridSetBase> set(create_set(PrimitiveType::TYPE_INT, false));
+    std::vector<int32_t> values;
+    for (int32_t i = -3000; i < 3000; ++i) {
+        values.push_back(i);
+        if (i % 3 == 0) {
+            set->insert(&i);
+        }
+    }
+    // and two values far away from the rest are not
+    std::unique_ptr<HybridSetBase> sparse_set(create_set(PrimitiveType::TYPE_INT, false));
+    sparse_set->insert(set.get());
+    int32_t far = type_limit<int32_t>::max();
+    sparse_set->insert(&far);
+    far = type_limit<int32_t>::min();
+    sparse_set->insert(&far);
+    values.push_back(type_limit<int32_t>::max());
+    values.push_back(type_limit<int32_t>::min());
+
+    set->prepare_for_probe();
+    sparse_set->prepare_for_probe();
+    using Set = HybridSet<PrimitiveType::TYPE_INT>;
+    ASSERT_TRUE(static_cast<Set*>(set.get())->_use_dense_bitmap);
+    ASSERT_FALSE(static_cast<Set*>(sparse_set.get())->_use_dense_bitmap);
+
+    auto column = vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(values);
+    auto result = vectorized::ColumnUInt8::create(values.size(), 0);
+    auto sparse_result = vectorized::ColumnUInt8::create(values.size(), 0);
+    set->find_batch(*column, values.size(), result->get_data());
+    sparse_set->find_batch(*column, values.size(), sparse_result->get_data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        bool expected = values[i] % 3 == 0 && values[i] >= -3000 && values[i] < 3000;
+        EXPECT_EQ(result->get_data()[i], expected) << values[i];
+        EXPECT_EQ(set->find(&values[i]), expected) << values[i];
+        EXPECT_EQ(sparse_result->get_data()[i], expected || i >= values.size() - 2) << values[i];
+    }
+}
+
 } // namespace doris
@@ -4528,6 +4528,33 @@ TEST_F(BlockFileCacheTest, test_align_size) {
     });
 }
 
+TEST_F(BlockFileCacheTest, read_pattern_detector) {
+    const size_t file_size = 10_mb + 10086;
+    {
+        ReadPatternDetector detector;
+        EXPECT_TRUE(detector.on_read(0, 100_kb, file_size, 1_mb, 2).empty());
+        // sequential
+        EXPECT_EQ(detector.on_read(100_kb, 100_kb, file_size, 1_mb, 2),
+                  std::vector<size_t>({1_mb, 2_mb}));
+        EXPECT_EQ(detector.on_read(200_kb, 900_kb, file_size, 1_mb, 2),
+                  std::vector<size_t>({3_mb}));
+        EXPECT_TRUE(detector.on_read(1100_kb, 100_kb, file_size, 1_mb, 2).empty());
+        // random
+        EXPECT_TRUE(detector.on_read(9_mb, 100_kb, file_size, 1_mb, 2).empty());
+        EXPECT_EQ(detector.on_read(9_mb + 100_kb, 100_kb, file_size, 1_mb, 2),
+                  std::vector<size_t>({10_mb}));
+    }
+    {
+        ReadPatternDetector detector;
+        EXPECT_TRUE(detector.on_read(0, 100_kb, file_size, 1_mb, 2).empty());
+        EXPECT_TRUE(detector.on_read(3_mb, 100_kb, file_size, 1_mb, 2).empty());
+        // strided
+        EXPECT_EQ(detector.on_read(6_mb, 100_kb, file_size, 1_mb, 2),
+                  std::vector<size_t>({9_mb}));
+        EXPECT_TRUE(detector.on_read(9_mb, 100_kb, file_size, 1_mb, 2).empty());
+    }
+}
+
 TEST_F(BlockFileCacheTest, remove_if_cached_when_isnt_releasable) {
     if (fs::exists(cache_base_path)) {
         fs::remove_all(cache_base_path);
@@ -508,4 +508,27 @@ TEST_F(BufferedReaderTest, test_range_cache_file_reader) {
     }
 }
 
+TEST_F(BufferedReaderTest, test_io_cost_model) {
+    // 1ms latency and 100MB/s bandwidth
+    auto elapsed_ns = [](size_t bytes) { return 1000000 + static_cast<int64_t>(bytes) * 10; };
+    io::IOCostModel model;
+    for (int i = 0; i < 31; ++i) {
+        size_t bytes = (i % 2 == 0 ? 16 : 1024) * 1024;
+        model.record(bytes, elapsed_ns(bytes));
+    }
+    EXPECT_EQ(0, model.equivalent_io_size());
+    for (int i = 0; i < 100; ++i) {
+        size_t bytes = (i % 4 + 1) * 256 * 1024;
+        model.record(bytes, elapsed_ns(bytes));
+    }
+    EXPECT_NEAR(100000, model.equivalent_io_size(), 1000);
+
+    // the reads of the same size are not enough to fit
+    io::IOCostModel same_size_model;
+    for (int i = 0; i < 100; ++i) {
+        same_size_model.record(1024, elapsed_ns(1024));
+    }
+    EXPECT_EQ(0, same_size_model.equivalent_io_size());
+}
+
 } // end namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/file_meta_cache.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+
+static constexpr std::string_view test_dir = "ut_dir/file_meta_cache_test";
+
+class FileMetaCacheTest : public testing::Test {
+public:
+    void SetUp() override {
+        auto st = io::global_local_filesystem()->delete_directory(test_dir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(test_dir);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    void TearDown() override {
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(test_dir).ok());
+    }
+};
+
+TEST_F(FileMetaCacheTest, file_index) {
+    std::string path = std::string(test_dir) + "/file";
+    {
+        io::FileWriterPtr writer;
+        ASSERT_TRUE(io::global_local_filesystem()->create_file(path, &writer).ok());
+        ASSERT_TRUE(writer->append("0123456789").ok());
+        ASSERT_TRUE(writer->close().ok());
+    }
+    io::FileReaderSPtr reader;
+    ASSERT_TRUE(io::global_local_filesystem()->open_file(path, &reader).ok());
+
+    FileMetaCache cache(10, 1 << 20);
+    size_t bytes_read = 0;
+    {
+        FileIndexHandle handle;
+        ASSERT_TRUE(cache.get_file_index(reader, nullptr, 1, 2, 4, &bytes_read, &handle).ok());
+        EXPECT_EQ(4, bytes_read);
+        EXPECT_EQ("2345", handle.data().to_string());
+    }
+    {
+        FileIndexHandle handle;
+        ASSERT_TRUE(cache.get_file_index(reader, nullptr, 1, 2, 4, &bytes_read, &handle).ok());
+        EXPECT_EQ(0, bytes_read);
+        EXPECT_EQ("2345", handle.data().to_string());
+    }
+    {
+        // the file is changed
+        FileIndexHandle handle;
+        ASSERT_TRUE(cache.get_file_index(reader, nullptr, 2, 2, 4, &bytes_read, &handle).ok());
+        EXPECT_EQ(4, bytes_read);
+    }
+    {
+        FileIndexHandle handle;
+        EXPECT_FALSE(cache.get_file_index(reader, nullptr, 1, 8, 4, &bytes_read, &handle).ok());
+    }
+}
+
+} // namespace doris
@@ -34,6 +34,7 @@
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/io_common.h"
 #include "util/slice.h"
 
 namespace doris {
@@ -250,6 +251,32 @@ TEST_F(LocalFileSystemTest, AbnormalFileWriter) {
     ASSERT_EQ(bytes_read, 0);
 }
 
+TEST_F(LocalFileSystemTest, LocalDiskIOStatistics) {
+    auto fname = fmt::format("{}/abc", test_dir);
+    io::FileWriterPtr file_writer;
+    auto st = io::global_local_filesystem()->create_file(fname, &file_writer);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_TRUE(file_writer->append("abcdef").ok());
+    ASSERT_TRUE(file_writer->close().ok());
+
+    io::FileReaderSPtr file_reader;
+    st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+    io::FileCacheStatistics stats;
+    io::IOContext io_ctx;
+    io_ctx.file_cache_stats = &stats;
+    char buf[1024];
+    size_t bytes_read;
+    ASSERT_TRUE(file_reader->read_at(0, {buf, 3}, &bytes_read, &io_ctx).ok());
+    ASSERT_TRUE(file_reader->read_at(3, {buf, 3}, &bytes_read, &io_ctx).ok());
+    // not counted without io context
+    ASSERT_TRUE(file_reader->read_at(0, {buf, 6}, &bytes_read).ok());
+    EXPECT_EQ(stats.num_local_disk_io_total, 2);
+    EXPECT_EQ(stats.bytes_read_from_local_disk, 6);
+    EXPECT_EQ(stats.num_remote_storage_io_total, 0);
+    EXPECT_EQ(stats.bytes_read_from_remote_storage, 0);
+}
+
 TEST_F(LocalFileSystemTest, AbnormalWriteRead) {
     auto sp = SyncPoint::get_instance();
     sp->enable_processing();
@@ -1470,4 +1470,17 @@ TEST_F(S3FileWriterTest, write_buffer_boundary) {
     // clang-format on
 }
 
+TEST_F(S3FileWriterTest, part_size) {
+    constexpr size_t MB = 1024L * 1024L;
+    EXPECT_EQ(5 * MB, io::S3FileWriter::part_size(1, 5 * MB, 64 * MB, 1000));
+    EXPECT_EQ(5 * MB, io::S3FileWriter::part_size(1000, 5 * MB, 64 * MB, 1000));
+    EXPECT_EQ(10 * MB, io::S3FileWriter::part_size(1001, 5 * MB, 64 * MB, 1000));
+    EXPECT_EQ(40 * MB, io::S3FileWriter::part_size(3001, 5 * MB, 64 * MB, 1000));
+    EXPECT_EQ(64 * MB, io::S3FileWriter::part_size(4001, 5 * MB, 64 * MB, 1000));
+    EXPECT_EQ(64 * MB, io::S3FileWriter::part_size(10000, 5 * MB, 64 * MB, 1));
+    // growing is disabled
+    EXPECT_EQ(5 * MB, io::S3FileWriter::part_size(10000, 5 * MB, 64 * MB, 0));
+    EXPECT_EQ(8 * MB, io::S3FileWriter::part_size(10000, 8 * MB, 5 * MB, 1000));
+}
+
 } // namespace doris
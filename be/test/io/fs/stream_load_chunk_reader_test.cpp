@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/stream_load_chunk_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "io/fs/stream_load_pipe.h"
+
+namespace doris::io {
+
+TEST(StreamLoadChunkReaderTest, chunks_of_lines) {
+    auto pipe = std::make_shared<StreamLoadPipe>();
+    std::string body;
+    for (int i = 0; i < 1000; ++i) {
+        body += std::to_string(i) + ",abc\n";
+    }
+    // a line longer than a chunk, and the last line without a line delimiter
+    body += std::string(100, 'x') + "\n";
+    body += "last";
+    std::thread producer([&]() {
+        for (size_t pos = 0; pos < body.size(); pos += 7) {
+            EXPECT_TRUE(
+                    pipe->append(body.data() + pos, std::min<size_t>(7, body.size() - pos)).ok());
+        }
+        EXPECT_TRUE(pipe->finish().ok());
+    });
+
+    auto splitter = std::make_shared<StreamLoadPipeSplitter>(pipe, '\n', 64);
+    std::vector<std::string> read(4);
+    std::vector<std::thread> consumers;
+    for (auto& data : read) {
+        consumers.emplace_back([&]() {
+            StreamLoadChunkReader reader(splitter);
+            char buf[10];
+            size_t bytes_read = 0;
+            do {
+                EXPECT_TRUE(reader.read_at(0, Slice(buf, sizeof(buf)), &bytes_read).ok());
+                data.append(buf, bytes_read);
+            } while (bytes_read > 0);
+            EXPECT_TRUE(reader.close().ok());
+        });
+    }
+    producer.join();
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    // every reader reads whole lines, and all the lines are read once
+    std::vector<std::string> lines;
+    bool has_last = false;
+    for (const auto& data : read) {
+        size_t start = 0;
+        for (size_t end = data.find('\n'); end != std::string::npos;
+             start = end + 1, end = data.find('\n', start)) {
+            lines.push_back(data.substr(start, end - start));
+        }
+        if (start < data.size()) {
+            EXPECT_EQ("last", data.substr(start));
+            EXPECT_FALSE(has_last);
+            has_last = true;
+        }
+    }
+    EXPECT_TRUE(has_last);
+    ASSERT_EQ(1001, lines.size());
+    std::sort(lines.begin(), lines.end());
+    std::vector<std::string> expected;
+    for (int i = 0; i < 1000; ++i) {
+        expected.push_back(std::to_string(i) + ",abc");
+    }
+    expected.push_back(std::string(100, 'x'));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, lines);
+}
+
+} // namespace doris::io
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/stream_load_pipe.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "util/byte_buffer.h"
+
+namespace doris::io {
+
+static ByteBufferPtr make_buffer(size_t size) {
+    ByteBufferPtr buf;
+    EXPECT_TRUE(ByteBuffer::allocate(size, &buf).ok());
+    buf->pos = size;
+    buf->flip();
+    return buf;
+}
+
+TEST(StreamLoadPipeTest, notify_when_drained) {
+    StreamLoadPipe pipe(100);
+    int drained = 0;
+    EXPECT_TRUE(pipe.append_without_wait(make_buffer(60)).ok());
+    EXPECT_FALSE(pipe.notify_when_drained([&]() { ++drained; }));
+
+    // over the limit without waiting
+    EXPECT_TRUE(pipe.append_without_wait(make_buffer(60)).ok());
+    EXPECT_TRUE(pipe.append_without_wait(make_buffer(60)).ok());
+    EXPECT_EQ(180, pipe.current_capacity());
+    EXPECT_TRUE(pipe.notify_when_drained([&]() { ++drained; }));
+
+    char buf[60];
+    size_t bytes_read = 0;
+    EXPECT_TRUE(pipe.read_at(0, Slice(buf, sizeof(buf)), &bytes_read).ok());
+    EXPECT_EQ(0, drained);
+    EXPECT_TRUE(pipe.read_at(0, Slice(buf, sizeof(buf)), &bytes_read).ok());
+    EXPECT_EQ(1, drained);
+    EXPECT_TRUE(pipe.read_at(0, Slice(buf, sizeof(buf)), &bytes_read).ok());
+    EXPECT_EQ(1, drained);
+}
+
+TEST(StreamLoadPipeTest, notify_when_cancelled) {
+    StreamLoadPipe pipe(100);
+    int drained = 0;
+    EXPECT_TRUE(pipe.append_without_wait(make_buffer(200)).ok());
+    EXPECT_TRUE(pipe.notify_when_drained([&]() { ++drained; }));
+    pipe.cancel("test");
+    EXPECT_EQ(1, drained);
+    EXPECT_FALSE(pipe.notify_when_drained([&]() { ++drained; }));
+    EXPECT_FALSE(pipe.append_without_wait(make_buffer(10)).ok());
+}
+
+} // namespace doris::io
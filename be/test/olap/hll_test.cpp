@@ -20,6 +20,9 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <cstring>
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
 #include "util/hash_util.hpp"
 #include "util/slice.h"
@@ -194,6 +197,29 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    for (int num : {0, 100, 200, 10000}) {
+        std::vector<uint64_t> hash_values;
+        HyperLogLog expected;
+        for (int i = 0; i < num; ++i) {
+            hash_values.push_back(hash(i));
+            expected.update(hash(i));
+        }
+        HyperLogLog hll;
+        // the second batch starts in the explicit values
+        hll.update_batch(hash_values.data(), num / 2);
+        hll.update_batch(hash_values.data() + num / 2, num - num / 2);
+        EXPECT_EQ(expected.estimate_cardinality(), hll.estimate_cardinality());
+        EXPECT_EQ(expected.to_string(), hll.to_string());
+
+        uint8_t expected_buf[HLL_COLUMN_DEFAULT_LEN];
+        uint8_t buf[HLL_COLUMN_DEFAULT_LEN];
+        size_t expected_len = expected.serialize(expected_buf);
+        ASSERT_EQ(expected_len, hll.serialize(buf));
+        EXPECT_EQ(0, memcmp(expected_buf, buf, expected_len));
+    }
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
@@ -562,6 +562,88 @@ TEST_F(CacheTest, Number) {
     EXPECT_EQ(0, cache.get_usage());
 }
 
+TEST_F(CacheTest, ProtectedEntries) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(10);
+    cache.set_protected_percentage(50);
+    auto lookup = [&](const std::string& key) {
+        CacheKey cache_key(key);
+        auto* handle = cache.lookup(cache_key, cache_key.hash(key.data(), key.size(), 0));
+        cache.release(handle);
+        return handle != nullptr;
+    };
+
+    for (int i = 0; i < 4; ++i) {
+        insert_number_LRUCache(cache, CacheKey(std::to_string(i)), 0, 1, CachePriority::NORMAL);
+    }
+    // 0 and 1 are hit again, so they are protected
+    EXPECT_TRUE(lookup("0"));
+    EXPECT_TRUE(lookup("1"));
+
+    // the entries of a scan only evict the entries not protected
+    for (int i = 100; i < 120; ++i) {
+        insert_number_LRUCache(cache, CacheKey(std::to_string(i)), 0, 1, CachePriority::NORMAL);
+    }
+    EXPECT_EQ(10, cache.get_usage());
+    EXPECT_TRUE(lookup("0"));
+    EXPECT_TRUE(lookup("1"));
+    EXPECT_FALSE(lookup("2"));
+    EXPECT_FALSE(lookup("3"));
+
+    // the protected entries are at most 5, the oldest are moved back to be evicted
+    for (int i = 110; i < 120; ++i) {
+        EXPECT_EQ(i >= 112, lookup(std::to_string(i))) << i;
+    }
+    for (int i = 200; i < 205; ++i) {
+        insert_number_LRUCache(cache, CacheKey(std::to_string(i)), 0, 1, CachePriority::NORMAL);
+    }
+    EXPECT_FALSE(lookup("0"));
+    EXPECT_FALSE(lookup("1"));
+    for (int i = 115; i < 120; ++i) {
+        EXPECT_TRUE(lookup(std::to_string(i))) << i;
+    }
+    cache.prune();
+    EXPECT_EQ(0, cache.get_usage());
+}
+
+TEST_F(CacheTest, ClockLookup) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(10);
+    cache.set_clock_lookup(true);
+    auto lookup = [&](const std::string& key) {
+        CacheKey cache_key(key);
+        return cache.lookup(cache_key, cache_key.hash(key.data(), key.size(), 0));
+    };
+
+    for (int i = 0; i < 10; ++i) {
+        insert_number_LRUCache(cache, CacheKey(std::to_string(i)), 0, 1, CachePriority::NORMAL);
+    }
+    // 0 and 1 are visited, so they get a second chance, and 2 is in use
+    cache.release(lookup("0"));
+    cache.release(lookup("1"));
+    auto* handle = lookup("2");
+    ASSERT_NE(nullptr, handle);
+    for (int i = 100; i < 107; ++i) {
+        insert_number_LRUCache(cache, CacheKey(std::to_string(i)), 0, 1, CachePriority::NORMAL);
+    }
+    EXPECT_EQ(10, cache.get_usage());
+    for (int i = 3; i < 10; ++i) {
+        EXPECT_EQ(nullptr, lookup(std::to_string(i))) << i;
+    }
+    for (const auto* key : {"0", "1", "2"}) {
+        auto* found = lookup(key);
+        EXPECT_NE(nullptr, found) << key;
+        cache.release(found);
+    }
+
+    // the entry in use is not pruned
+    EXPECT_EQ(9, cache.prune().pruned_count);
+    EXPECT_EQ(1, cache.get_usage());
+    cache.release(handle);
+    EXPECT_EQ(1, cache.prune().pruned_count);
+    EXPECT_EQ(0, cache.get_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     init_size_cache();
     // Add a bunch of light and heavy entries and then count the combined
@@ -857,4 +939,29 @@ TEST_F(CacheTest, ResetInitialCapacity) {
     ASSERT_EQ(kCacheSize / 2, cache()->get_usage());
 }
 
+TEST_F(CacheTest, HitRatioAdjustWeighted) {
+    init_number_cache();
+    // too few lookups
+    EXPECT_DOUBLE_EQ(0.5, cache()->hit_ratio_adjust_weighted(0.5));
+
+    for (int i = 0; i < kCacheSize; i++) {
+        Insert(i, 1000 + i, 1);
+        EXPECT_EQ(1000 + i, Lookup(i));
+    }
+    EXPECT_DOUBLE_EQ(1, cache()->hit_ratio_adjust_weighted(0.5));
+
+    for (int i = 0; i < kCacheSize; i++) {
+        EXPECT_EQ(-1, Lookup(kCacheSize + i));
+    }
+    EXPECT_DOUBLE_EQ(0.25, cache()->hit_ratio_adjust_weighted(0.5));
+
+    for (int i = 0; i < kCacheSize; i++) {
+        EXPECT_EQ(1000 + i, Lookup(i));
+        EXPECT_EQ(-1, Lookup(kCacheSize + i));
+    }
+    EXPECT_DOUBLE_EQ(0.5, cache()->hit_ratio_adjust_weighted(0.5));
+    // the capacity is not reduced
+    EXPECT_DOUBLE_EQ(2, cache()->hit_ratio_adjust_weighted(2));
+}
+
 } // namespace doris
@@ -181,4 +181,27 @@ TEST_F(MemTableMemoryLimiterTest, handle_memtable_flush_test) {
     res = _engine_ref->tablet_manager()->drop_tablet(request.tablet_id, request.replica_id, false);
     EXPECT_EQ(Status::OK(), res);
 }
+
+TEST_F(MemTableMemoryLimiterTest, calc_memtable_flush_size) {
+    auto min_size = config::adaptive_memtable_min_size;
+    auto max_size = config::adaptive_memtable_max_size;
+    auto target_size = config::memtable_target_segment_size;
+    config::adaptive_memtable_min_size = 16 << 20;
+    config::adaptive_memtable_max_size = 1 << 30;
+    config::memtable_target_segment_size = 256 << 20;
+
+    // the memory is shared by the ingest rate
+    EXPECT_EQ(512 << 20, MemTableMemoryLimiter::calc_memtable_flush_size(1 << 30, 3, 6, 0));
+    // a cold writer flushes at the min size
+    EXPECT_EQ(16 << 20, MemTableMemoryLimiter::calc_memtable_flush_size(1 << 30, 0, 6, 0));
+    EXPECT_EQ(16 << 20, MemTableMemoryLimiter::calc_memtable_flush_size(1 << 30, 0, 0, 0));
+    // a hot writer is limited by the max size
+    EXPECT_EQ(1 << 30, MemTableMemoryLimiter::calc_memtable_flush_size(4L << 30, 6, 6, 0));
+    // and by the target segment size
+    EXPECT_EQ(512 << 20, MemTableMemoryLimiter::calc_memtable_flush_size(4L << 30, 6, 6, 0.5));
+
+    config::adaptive_memtable_min_size = min_size;
+    config::adaptive_memtable_max_size = max_size;
+    config::memtable_target_segment_size = target_size;
+}
 } // namespace doris
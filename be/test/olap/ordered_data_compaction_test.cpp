@@ -621,5 +621,37 @@ TEST_F(OrderedDataCompactionTest, test_index_disk_size) {
               << std::endl;
     EXPECT_EQ(out_rowset->rowset_meta()->total_disk_size(), expected_total_size);
 }
+
+TEST_F(OrderedDataCompactionTest, test_overlapping_rowsets_with_ordered_segments) {
+    auto num_input_rowset = 3;
+    auto num_segments = 2;
+    auto rows_per_segment = 50;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(num_input_rowset, num_segments, rows_per_segment, input_data);
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false, 10000, false);
+    EXPECT_TRUE(io::global_local_filesystem()->create_directory(tablet->tablet_path()).ok());
+
+    // the segments of the rowsets are marked overlapping, but their keys are ordered
+    std::vector<RowsetSharedPtr> input_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        input_rowsets.push_back(create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]));
+    }
+    CumulativeCompaction cu_compaction(*engine_ref, tablet);
+    cu_compaction._input_rowsets = input_rowsets;
+    EXPECT_EQ(cu_compaction.handle_ordered_data_compaction(), true);
+    EXPECT_EQ(cu_compaction._output_rowset->rowset_meta()->segments_overlap(), NONOVERLAPPING);
+    EXPECT_EQ(cu_compaction._output_rowset->num_rows(),
+              num_input_rowset * num_segments * rows_per_segment);
+
+    // the segments of the first rowset really overlap
+    std::vector<std::vector<std::tuple<int64_t, int64_t>>> overlapping_data = {input_data[0][0],
+                                                                               input_data[0][0]};
+    input_rowsets[0] = create_rowset(tablet_schema, tablet, OVERLAPPING, overlapping_data);
+    CumulativeCompaction overlapping_compaction(*engine_ref, tablet);
+    overlapping_compaction._input_rowsets = input_rowsets;
+    EXPECT_EQ(overlapping_compaction.handle_ordered_data_compaction(), false);
+}
 } // namespace vectorized
 } // namespace doris
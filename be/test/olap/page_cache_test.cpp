@@ -286,4 +286,32 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+TEST_F(StoragePageCacheTest, compressed_page) {
+    StoragePageCache cache(kNumShards * 2048, 0, 0, kNumShards, kNumShards * 2048);
+    EXPECT_TRUE(cache.has_compressed_page_cache());
+
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+    {
+        PageCacheHandle handle;
+        EXPECT_FALSE(cache.lookup_compressed(key, &handle));
+    }
+
+    std::string compressed(512, 'x');
+    cache.insert_compressed(key, Slice(compressed));
+    {
+        PageCacheHandle handle;
+        EXPECT_TRUE(cache.lookup_compressed(key, &handle));
+        EXPECT_EQ(compressed, handle.data().to_string());
+        // the decompressed page is not cached
+        PageCacheHandle data_handle;
+        EXPECT_FALSE(cache.lookup(key, &data_handle, page_type));
+    }
+
+    StoragePageCache disabled_cache(kNumShards * 2048, 0, 0, kNumShards);
+    EXPECT_FALSE(disabled_cache.has_compressed_page_cache());
+    PageCacheHandle handle;
+    EXPECT_FALSE(disabled_cache.lookup_compressed(key, &handle));
+}
+
 } // namespace doris
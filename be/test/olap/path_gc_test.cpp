@@ -57,8 +57,9 @@ TEST(PathGcTest, GcTabletAndRowset) {
         tablet_meta->set_shard_id(tablet_id % 4);
         tablet_meta->_schema_hash = tablet_id;
         auto tablet = std::make_shared<Tablet>(engine, std::move(tablet_meta), &data_dir);
-        auto& tablet_map = engine.tablet_manager()->_get_tablet_map(tablet_id);
-        tablet_map[tablet_id] = tablet;
+        auto& tablets_shard = engine.tablet_manager()->_get_tablets_shard(tablet_id);
+        tablets_shard.tablet_map[tablet_id] = tablet;
+        tablets_shard.add_to_lookup_map(tablet_id, tablet);
         return tablet;
     };
     std::vector<TabletSharedPtr> active_tablets;
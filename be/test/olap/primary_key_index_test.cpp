@@ -253,6 +253,119 @@ TEST_F(PrimaryKeyIndexTest, multiple_pages) {
     }
 }
 
+TEST_F(PrimaryKeyIndexTest, reused_iterator) {
+    std::string filename = kTestDir + "/reused_iterator";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+
+    auto old_page_size = config::primary_key_data_page_size;
+    config::primary_key_data_page_size = 5 * 5;
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 0, 0);
+    static_cast<void>(builder.init());
+    std::vector<std::string> keys;
+    for (int i = 10000; i < 12000; i += 2) {
+        keys.push_back(std::to_string(i));
+        static_cast<void>(builder.add_item(keys.back()));
+    }
+    EXPECT_GT(builder.data_page_num(), 100);
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+    config::primary_key_data_page_size = old_page_size;
+
+    PrimaryKeyIndexReader index_reader;
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta, nullptr).ok());
+
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+    bool exact_match = false;
+    // ascending keys with growing gaps search forward from the last entry
+    for (size_t i = 0, step = 1; i < keys.size(); i += step, step++) {
+        EXPECT_TRUE(index_iterator->seek_at_or_after(&keys[i], &exact_match).ok());
+        EXPECT_TRUE(exact_match);
+        EXPECT_EQ(i, index_iterator->get_current_ordinal());
+    }
+    // descending keys fall back to the whole search
+    for (size_t i = keys.size(); i > 0; i -= std::min<size_t>(i, 7)) {
+        std::string key = std::to_string(std::stoi(keys[i - 1]) + 1);
+        auto status = index_iterator->seek_at_or_after(&key, &exact_match);
+        if (i == keys.size()) {
+            EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+            continue;
+        }
+        EXPECT_TRUE(status.ok());
+        EXPECT_FALSE(exact_match);
+        EXPECT_EQ(i, index_iterator->get_current_ordinal());
+    }
+    {
+        std::string key("0");
+        EXPECT_TRUE(index_iterator->seek_at_or_after(&key, &exact_match).ok());
+        EXPECT_FALSE(exact_match);
+        EXPECT_EQ(0, index_iterator->get_current_ordinal());
+    }
+}
+
+TEST_F(PrimaryKeyIndexTest, fence_pointers) {
+    std::string filename = kTestDir + "/fence_pointers";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+
+    auto old_page_size = config::primary_key_data_page_size;
+    config::primary_key_data_page_size = 5 * 5;
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 0, 0);
+    static_cast<void>(builder.init());
+    // the keys longer than the fences share the prefixes in groups
+    std::vector<std::string> keys;
+    for (int i = 1000; i < 3000; i += 2) {
+        keys.push_back(std::to_string(i / 100) + "_prefix_" + std::to_string(i));
+        static_cast<void>(builder.add_item(keys.back()));
+    }
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+    config::primary_key_data_page_size = old_page_size;
+
+    auto old_enable = config::enable_pk_index_fence_pointers;
+    config::enable_pk_index_fence_pointers = true;
+    PrimaryKeyIndexReader index_reader;
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta, nullptr).ok());
+    config::enable_pk_index_fence_pointers = old_enable;
+
+    bool exact_match = false;
+    for (size_t i = 0; i < keys.size(); i++) {
+        std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+        EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+        EXPECT_TRUE(index_iterator->seek_at_or_after(&keys[i], &exact_match).ok());
+        EXPECT_TRUE(exact_match);
+        EXPECT_EQ(i, index_iterator->get_current_ordinal());
+
+        std::string key = keys[i] + "0";
+        index_iterator.reset();
+        EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+        auto status = index_iterator->seek_at_or_after(&key, &exact_match);
+        if (i + 1 == keys.size()) {
+            EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+        } else {
+            EXPECT_TRUE(status.ok());
+            EXPECT_FALSE(exact_match);
+            EXPECT_EQ(i + 1, index_iterator->get_current_ordinal());
+        }
+    }
+    {
+        std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+        EXPECT_TRUE(index_reader.new_iterator(&index_iterator, nullptr).ok());
+        std::string key("0");
+        EXPECT_TRUE(index_iterator->seek_at_or_after(&key, &exact_match).ok());
+        EXPECT_EQ(0, index_iterator->get_current_ordinal());
+    }
+}
+
 TEST_F(PrimaryKeyIndexTest, single_page) {
     std::string filename = kTestDir + "/single_page";
     io::FileWriterPtr file_writer;
@@ -108,6 +108,28 @@ TEST_F(RowsetMetaTest, TestInit) {
     do_check(rowset_meta_3);
 }
 
+TEST_F(RowsetMetaTest, TestPackRowsetIdV2) {
+    RowsetId rowset_id;
+    rowset_id.init(2, 3, 4, 5);
+    RowsetMetaPB rowset_meta_pb;
+    rowset_meta_pb.set_rowset_id(0);
+    rowset_meta_pb.set_rowset_id_v2(rowset_id.to_string());
+    rowset_meta_pb.set_tablet_id(15673);
+    RowsetMeta rowset_meta;
+    EXPECT_TRUE(rowset_meta.init_from_pb(rowset_meta_pb));
+    EXPECT_EQ(rowset_id, rowset_meta.rowset_id());
+    EXPECT_FALSE(rowset_meta._rowset_meta_pb.has_rowset_id_v2());
+    EXPECT_EQ(rowset_id.to_string(), rowset_meta.get_rowset_pb().rowset_id_v2());
+
+    std::string value;
+    EXPECT_TRUE(rowset_meta.serialize(&value));
+    RowsetMeta rowset_meta_2;
+    EXPECT_TRUE(rowset_meta_2.init(value));
+    EXPECT_EQ(rowset_id, rowset_meta_2.rowset_id());
+    EXPECT_EQ(rowset_id.to_string(), rowset_meta_2.get_rowset_pb().rowset_id_v2());
+    EXPECT_TRUE(rowset_meta == rowset_meta_2);
+}
+
 TEST_F(RowsetMetaTest, TestInitWithInvalidData) {
     RowsetMeta rowset_meta;
     EXPECT_FALSE(rowset_meta.init_from_json("invalid json meta data"));
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/coalesced_file_reader.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <limits.h>
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+namespace segment_v2 {
+
+namespace {
+
+class CountingFileReader : public io::FileReader {
+public:
+    CountingFileReader(size_t size) : _size(size) {}
+
+    Status close() override { return Status::OK(); }
+
+    const io::Path& path() const override { return _path; }
+
+    size_t size() const override { return _size; }
+
+    bool closed() const override { return false; }
+
+    int num_reads = 0;
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const io::IOContext* io_ctx) override {
+        num_reads++;
+        *bytes_read = std::min(_size - offset, result.size);
+        for (size_t i = 0; i < *bytes_read; ++i) {
+            result.data[i] = (offset + i) % UCHAR_MAX;
+        }
+        return Status::OK();
+    }
+
+private:
+    size_t _size;
+    io::Path _path = "/tmp/mock";
+};
+
+void check_page(io::FileReader* reader, size_t offset, size_t size) {
+    std::vector<char> page(size);
+    size_t bytes_read = 0;
+    ASSERT_TRUE(reader->read_at(offset, Slice(page.data(), size), &bytes_read).ok());
+    ASSERT_EQ(size, bytes_read);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ((char)((offset + i) % UCHAR_MAX), page[i]);
+    }
+}
+
+} // namespace
+
+TEST(CoalescedFileReaderTest, interleaved_pages) {
+    constexpr size_t PAGE_SIZE = 4096;
+    constexpr size_t NUM_PAGES = 16;
+    auto inner = std::make_shared<CountingFileReader>(1024 * 1024);
+    CoalescedFileReader reader(inner);
+
+    // not planned yet
+    check_page(&reader, 0, PAGE_SIZE);
+    EXPECT_EQ(1, inner->num_reads);
+
+    // the pages of two columns
+    const size_t column_offsets[] = {0, 512 * 1024};
+    std::vector<io::PrefetchRange> ranges;
+    for (size_t column_offset : column_offsets) {
+        for (size_t i = 0; i < NUM_PAGES; ++i) {
+            ranges.emplace_back(column_offset + i * PAGE_SIZE, column_offset + (i + 1) * PAGE_SIZE);
+        }
+    }
+    reader.set_ranges(ranges);
+
+    inner->num_reads = 0;
+    for (size_t i = 0; i < NUM_PAGES; ++i) {
+        for (size_t column_offset : column_offsets) {
+            check_page(&reader, column_offset + i * PAGE_SIZE, PAGE_SIZE);
+        }
+    }
+    EXPECT_LE(inner->num_reads, 4);
+
+    // a page out of the ranges is read directly
+    inner->num_reads = 0;
+    check_page(&reader, 256 * 1024, PAGE_SIZE);
+    EXPECT_EQ(1, inner->num_reads);
+}
+
+} // namespace segment_v2
+} // namespace doris
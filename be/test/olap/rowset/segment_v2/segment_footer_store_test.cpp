@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_footer_store.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class SegmentFooterStoreTest : public testing::Test {
+public:
+    const std::string kTestDir = "./ut_dir/segment_footer_store_test";
+
+    void SetUp() override {
+        auto st = io::global_local_filesystem()->delete_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+        st = io::global_local_filesystem()->create_directory(kTestDir);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+    void TearDown() override {
+        EXPECT_TRUE(io::global_local_filesystem()->delete_directory(kTestDir).ok());
+    }
+};
+
+TEST_F(SegmentFooterStoreTest, restart) {
+    const std::string segment = kTestDir + "/data/0/10001/0/rowset_1_0.dat";
+    const std::string footer(1000, 'f');
+    {
+        SegmentFooterStore store({kTestDir}, 1 << 20);
+        std::string found;
+        EXPECT_FALSE(store.lookup(segment, 4096, &found));
+        store.insert(segment, 4096, footer);
+        EXPECT_TRUE(store.lookup(segment, 4096, &found));
+        EXPECT_EQ(footer, found);
+        // another size is another segment file
+        EXPECT_FALSE(store.lookup(segment, 8192, &found));
+    }
+    {
+        SegmentFooterStore store({kTestDir}, 1 << 20);
+        std::string found;
+        EXPECT_TRUE(store.lookup(segment, 4096, &found));
+        EXPECT_EQ(footer, found);
+        store.insert(kTestDir + "/data/0/10001/0/rowset_2_0.dat", 4096, footer);
+    }
+
+    // a torn record at the end is dropped
+    const std::string path = kTestDir + "/" + SegmentFooterStore::FILE_NAME;
+    auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 10);
+    {
+        SegmentFooterStore store({kTestDir}, 1 << 20);
+        std::string found;
+        EXPECT_TRUE(store.lookup(segment, 4096, &found));
+        EXPECT_FALSE(store.lookup(kTestDir + "/data/0/10001/0/rowset_2_0.dat", 4096, &found));
+    }
+    EXPECT_LT(std::filesystem::file_size(path), size - 10);
+}
+
+TEST_F(SegmentFooterStoreTest, bad_record) {
+    const std::string segment = kTestDir + "/data/0/10001/0/rowset_1_0.dat";
+    {
+        SegmentFooterStore store({kTestDir}, 1 << 20);
+        store.insert(segment, 4096, std::string(1000, 'f'));
+    }
+    const std::string path = kTestDir + "/" + SegmentFooterStore::FILE_NAME;
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(500);
+        file.put('x');
+    }
+    SegmentFooterStore store({kTestDir}, 1 << 20);
+    std::string found;
+    EXPECT_FALSE(store.lookup(segment, 4096, &found));
+}
+
+TEST_F(SegmentFooterStoreTest, max_file_size) {
+    SegmentFooterStore store({kTestDir}, 2048);
+    store.insert(kTestDir + "/rowset_1_0.dat", 4096, std::string(1000, 'f'));
+    store.insert(kTestDir + "/rowset_2_0.dat", 4096, std::string(1000, 'f'));
+    std::string found;
+    EXPECT_TRUE(store.lookup(kTestDir + "/rowset_1_0.dat", 4096, &found));
+    EXPECT_FALSE(store.lookup(kTestDir + "/rowset_2_0.dat", 4096, &found));
+}
+
+} // namespace segment_v2
+} // namespace doris
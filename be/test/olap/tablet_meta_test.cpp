@@ -245,4 +245,22 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     }
 }
 
+TEST(TabletMetaTest, TestDeleteBitmapAggRunOptimize) {
+    DeleteBitmap dbmp(10087);
+    // the rows are deleted in contiguous ranges by the versions
+    for (uint32_t version = 1; version <= 10; ++version) {
+        for (uint32_t row = (version - 1) * 10000; row < version * 10000; ++row) {
+            dbmp.add({RowsetId {2, 0, 1, 1}, 0, version}, row);
+        }
+    }
+    auto bm = dbmp.get_agg({RowsetId {2, 0, 1, 1}, 0, 10});
+    ASSERT_EQ(bm->cardinality(), 100000);
+    ASSERT_TRUE(bm->hasRunCompression());
+    ASSERT_TRUE(bm->contains(99999));
+    ASSERT_FALSE(bm->contains(100000));
+    bm = dbmp.get_agg({RowsetId {2, 0, 1, 1}, 0, 5});
+    ASSERT_EQ(bm->cardinality(), 50000);
+    ASSERT_FALSE(bm->contains(50000));
+}
+
 } // namespace doris
@@ -409,6 +409,16 @@ TEST_F(TestTablet, cooldown_policy) {
     }
 }
 
+TEST_F(TestTablet, compute_read_amp_compaction_score) {
+    constexpr int64_t MB = 1024 * 1024;
+    // nothing to merge
+    EXPECT_EQ(0, Tablet::compute_read_amp_compaction_score(1, 100, 10 * MB));
+    EXPECT_DOUBLE_EQ(9, Tablet::compute_read_amp_compaction_score(10, 0, MB / 2));
+    EXPECT_DOUBLE_EQ(0.9, Tablet::compute_read_amp_compaction_score(10, 0, 10 * MB));
+    // a queried tablet is worth more per byte
+    EXPECT_DOUBLE_EQ(9.9, Tablet::compute_read_amp_compaction_score(10, 10, 10 * MB));
+}
+
 TEST_F(TestTablet, get_local_versions) {
     // 10 remote rowsets
     for (int i = 1; i <= 10; i++) {
@@ -106,8 +106,9 @@ public:
         auto tablet_meta = std::make_shared<TabletMeta>();
         tablet_meta->set_tablet_uid(_tablet_uid);
         auto tablet = std::make_shared<Tablet>(*k_engine, std::move(tablet_meta), nullptr);
-        auto& tablet_map = k_engine->tablet_manager()->_get_tablet_map(tablet_id);
-        tablet_map[tablet_id] = std::move(tablet);
+        auto& tablets_shard = k_engine->tablet_manager()->_get_tablets_shard(tablet_id);
+        tablets_shard.tablet_map[tablet_id] = tablet;
+        tablets_shard.add_to_lookup_map(tablet_id, tablet);
     }
 
     virtual void SetUp() {
@@ -18,8 +18,11 @@
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "gmock/gmock.h"
@@ -138,4 +141,56 @@ TEST_F(WalReaderWriterTest, TestWriteAndRead1) {
     static_cast<void>(wal_reader.finalize());
     EXPECT_EQ(3, block_count);
 }
+
+TEST_F(WalReaderWriterTest, TestConcurrentSync) {
+    auto preallocate_bytes = config::group_commit_wal_preallocate_bytes;
+    config::group_commit_wal_preallocate_bytes = 1 << 20;
+    std::string file_name = _s_test_data_path + "/sync.wal";
+    auto wal_writer = WalWriter(file_name);
+    EXPECT_TRUE(wal_writer.init().ok());
+    config::group_commit_wal_preallocate_bytes = preallocate_bytes;
+
+    // the appends are serialized like the ones of a load block queue, the syncs are not
+    std::mutex append_mutex;
+    std::atomic<size_t> file_len = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < 10; ++j) {
+                PBlock pblock;
+                generate_block(pblock, i * 10 + j);
+                {
+                    std::lock_guard l(append_mutex);
+                    EXPECT_TRUE(wal_writer.append_blocks(std::vector<PBlock*> {&pblock}).ok());
+                }
+                file_len += pblock.ByteSizeLong() + WalWriter::LENGTH_SIZE +
+                            WalWriter::CHECKSUM_SIZE;
+                EXPECT_TRUE(wal_writer.sync().ok());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // the preallocated space doesn't change the size of the file
+    int64_t file_size = -1;
+    EXPECT_TRUE(io::global_local_filesystem()->file_size(file_name, &file_size).ok());
+    EXPECT_EQ(file_len, file_size);
+    EXPECT_TRUE(wal_writer.finalize().ok());
+
+    auto wal_reader = WalReader(file_name);
+    EXPECT_TRUE(wal_reader.init().ok());
+    auto block_count = 0;
+    while (true) {
+        PBlock pblock;
+        Status st = wal_reader.read_block(pblock);
+        if (!st.ok()) {
+            EXPECT_TRUE(st.is<ErrorCode::END_OF_FILE>());
+            break;
+        }
+        ++block_count;
+    }
+    static_cast<void>(wal_reader.finalize());
+    EXPECT_EQ(80, block_count);
+}
 } // namespace doris
\ No newline at end of file
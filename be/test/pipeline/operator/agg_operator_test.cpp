@@ -31,6 +31,7 @@
 #include "testutil/mock/mock_slot_ref.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
 
 namespace doris::pipeline {
 
@@ -397,6 +398,52 @@ TEST_F(AggOperatorTestWithGroupBy, test_need_finalize) {
     }
 }
 
+TEST_F(AggOperatorTestWithGroupBy, test_string_key_runs) {
+    // consecutive rows with the same string key share the agg place of the first row of the run
+    using namespace vectorized;
+    OperatorContext ctx;
+    auto sink_op = std::make_shared<MockAggsinkOperator>();
+    sink_op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            ctx.pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()),
+            false, false));
+    sink_op->_pool = &ctx.pool;
+    EXPECT_TRUE(sink_op->prepare(&ctx.state).ok());
+    sink_op->_probe_expr_ctxs =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeString>());
+
+    auto source_op = std::make_shared<MockAggSourceOperator>();
+    source_op->mock_row_descriptor.reset(
+            new MockRowDescriptor {{std::make_shared<vectorized::DataTypeString>(),
+                                    std::make_shared<vectorized::DataTypeInt64>()},
+                                   &ctx.pool});
+    source_op->_without_key = false;
+    source_op->_needs_finalize = true;
+    EXPECT_TRUE(source_op->prepare(&ctx.state).ok());
+
+    auto shared_state = init_sink_and_source(sink_op, source_op, ctx);
+
+    {
+        vectorized::Block block {ColumnHelper::create_column_with_name<DataTypeString>(
+                                         {"cn", "cn", "us", "us", "us", "cn", "", "", "uk"}),
+                                 ColumnHelper::create_column_with_name<DataTypeInt64>(
+                                         {1, 1, 10, 10, 10, 1, 100, 100, 1000})};
+        auto st = sink_op->sink(&ctx.state, &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    {
+        vectorized::Block block;
+        bool eos = false;
+        auto st = source_op->get_block(&ctx.state, &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(ColumnHelper::block_equal_with_sort(
+                block, vectorized::Block {ColumnHelper::create_column_with_name<DataTypeString>(
+                                                  {"", "cn", "uk", "us"}),
+                                          ColumnHelper::create_column_with_name<DataTypeInt64>(
+                                                  {200, 3, 1000, 30})}));
+    }
+}
+
 TEST_F(AggOperatorTestWithGroupBy, test_2_phase) {
     /*
          group by key   |  sum(value)    
@@ -814,4 +814,62 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction8) {
     std::cout << "######### AggFunction with row_number test end #########" << std::endl;
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(AnalyticSinkOperatorTest, AggFunctionMaxSlidingRows) {
+    int batch_size = 2;
+    Initialize(batch_size);
+    create_operator(true, 1, "max", {std::make_shared<DataTypeInt64>()});
+    sink->_agg_expr_ctxs.resize(1);
+    sink->_agg_expr_ctxs[0] =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    TAnalyticWindow temp_window;
+    temp_window.type = TAnalyticWindowType::ROWS;
+    TAnalyticWindowBoundary window_start;
+    window_start.type = TAnalyticWindowBoundaryType::PRECEDING;
+    window_start.__set_rows_offset_value(2);
+    temp_window.__set_window_start(window_start);
+    TAnalyticWindowBoundary window_end;
+    window_end.type = TAnalyticWindowBoundaryType::FOLLOWING;
+    window_end.__set_rows_offset_value(1);
+    temp_window.__set_window_end(window_end);
+    create_window_type(true, true, temp_window);
+    create_local_state();
+    // test with max agg function and rows between 2 preceding and 1 following:
+    // _get_next_for_sliding_rows by the monotonic deque
+
+    std::vector<int64_t> data_vals {5, 3, 4, 1, 2, 0, 9, 8, 7, 6};
+    std::vector<int64_t> expect_vals {5, 5, 5, 4, 4, 9, 9, 9, 9, 8};
+    {
+        for (int i = 0; i < 5; i++) {
+            std::vector<int64_t> block_vals(data_vals.begin() + i * batch_size,
+                                            data_vals.begin() + (i + 1) * batch_size);
+            vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>(block_vals);
+            auto st = sink->sink(state.get(), &block, i == 4);
+            EXPECT_TRUE(st.ok()) << st.msg();
+        }
+    }
+
+    {
+        for (int i = 0; i < 5; i++) {
+            std::vector<int64_t> data_vals_tmp(data_vals.begin() + i * batch_size,
+                                               data_vals.begin() + (i + 1) * batch_size);
+            std::vector<int64_t> expect_vals_tmp(expect_vals.begin() + i * batch_size,
+                                                 expect_vals.begin() + (i + 1) * batch_size);
+            vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+            bool eos = false;
+            auto st = source->get_block(state.get(), &block, &eos);
+            EXPECT_TRUE(st.ok()) << st.msg();
+            std::cout << "source get from block is: \n" << block.dump_data() << std::endl;
+            EXPECT_TRUE(ColumnHelper::block_equal(
+                    block,
+                    ColumnHelper::create_block<DataTypeInt64>(data_vals_tmp, expect_vals_tmp)));
+        }
+        vectorized::Block block2 = ColumnHelper::create_block<DataTypeInt64>({});
+        bool eos2 = false;
+        auto st2 = source->get_block(state.get(), &block2, &eos2);
+        EXPECT_TRUE(st2.ok()) << st2.msg();
+        EXPECT_EQ(block2.rows(), 0);
+        EXPECT_TRUE(eos2);
+    }
+}
+
+} // namespace doris::pipeline
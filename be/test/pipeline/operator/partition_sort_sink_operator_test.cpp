@@ -232,6 +232,18 @@ TEST_F(PartitionSortOperatorTest, test_one_partition) {
     test_partition_sort(partition_exprs_num, topn_num);
 }
 
+TEST_F(PartitionSortOperatorTest, test_cutoff) {
+    int partition_exprs_num = 1;
+    int topn_num = 3;
+    test_for_sink_and_source(partition_exprs_num, true, topn_num);
+    test_partition_sort(partition_exprs_num, topn_num);
+#ifndef NDEBUG
+    // the 5 partitions are sorted after the first block, so the rows of them in the second block
+    // are not better than their 3rd rows
+    EXPECT_EQ(sink_local_state->_cutoff_rows, 5);
+#endif
+}
+
 TEST_F(PartitionSortOperatorTest, TestWithoutKey) {
     std::vector<vectorized::DataTypePtr> types {std::make_shared<vectorized::DataTypeInt32>()};
     std::unique_ptr<PartitionedHashMapVariants> _variants =
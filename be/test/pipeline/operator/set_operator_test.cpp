@@ -554,4 +554,45 @@ TEST_F(ExceptOperatorTest, test_refresh_hash_table) {
         EXPECT_TRUE(block.empty());
     }
 }
-} // namespace doris::pipeline
\ No newline at end of file
+
+TEST_F(IntersectOperatorTest, test_probe_children_in_any_order) {
+    init_op(3, {std::make_shared<DataTypeInt64>()});
+
+    sink_op->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    probe_sink_ops[0]->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    probe_sink_ops[1]->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+
+    init_local_state();
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3, 4, 5});
+        EXPECT_TRUE(sink_op->sink(state.get(), &block, true));
+    }
+    // all the probe children could run once the hash table is built
+    EXPECT_TRUE(OperatorHelper::is_ready(probe_sink_local_state[0]->dependencies()));
+    EXPECT_TRUE(OperatorHelper::is_ready(probe_sink_local_state[1]->dependencies()));
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({4, 5, 6});
+        EXPECT_TRUE(probe_sink_ops[1]->sink(states[1].get(), &block, true));
+    }
+    EXPECT_TRUE(OperatorHelper::is_block(source_local_state->dependencies()));
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({3, 4});
+        EXPECT_TRUE(probe_sink_ops[0]->sink(states[0].get(), &block, true));
+    }
+
+    {
+        EXPECT_TRUE(OperatorHelper::is_ready(source_local_state->dependencies()));
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(source_op->get_block(state.get(), &block, &eos));
+        EXPECT_TRUE(ColumnHelper::block_equal_with_sort(
+                block, ColumnHelper::create_block<DataTypeInt64>({4})));
+    }
+}
+} // namespace doris::pipeline
@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -29,6 +30,7 @@
 #include "testutil/mock/mock_agg_fn_evaluator.h"
 #include "testutil/mock/mock_runtime_state.h"
 #include "testutil/mock/mock_slot_ref.h"
+#include "util/defer_op.h"
 #include "util/bitmap_value.h"
 #include "util/jsonb_document.h"
 #include "vec/data_types/data_type_bitmap.h"
@@ -406,4 +408,81 @@ TEST_F(StreamingAggOperatorTest, test4) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, resume_pre_agg_after_reprobe) {
+    const auto origin_interval = config::streaming_agg_reprobe_interval_blocks;
+    config::streaming_agg_reprobe_interval_blocks = 1;
+    Defer defer {[&]() { config::streaming_agg_reprobe_interval_blocks = origin_interval; }};
+
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    {
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 2, 2, 2, 3}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+    }
+
+    {
+        // all keys hit the hash table, so the block is aggregated instead of passed through
+        local_state->should_not_do_pre_agg = true;
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3, 1, 2, 3}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+        EXPECT_TRUE(op->need_more_input_data(state.get()));
+        EXPECT_EQ(local_state->_resume_times_counter->value(), 1);
+    }
+
+    {
+        // no key hits the hash table, so the block is passed through
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({4, 5, 6, 7, 8, 9}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+
+        EXPECT_EQ(local_state->_get_hash_table_size(), 3);
+        EXPECT_FALSE(op->need_more_input_data(state.get()));
+        EXPECT_EQ(local_state->_reprobe_times_counter->value(), 2);
+        EXPECT_EQ(local_state->_resume_times_counter->value(), 1);
+        EXPECT_EQ(local_state->_pass_through_rows_counter->value(), 6);
+    }
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+}
+
 } // namespace doris::pipeline
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "common/config.h"
+
+namespace doris::pipeline {
+
+TEST(TaskTraceRingTest, ring_and_dump) {
+    TaskTraceRing ring(16);
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(100);
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(2);
+    other_query_id.__set_lo(200);
+    // all events of this thread go into one shard of 1 event
+    for (uint64_t i = 0; i < 10; ++i) {
+        TaskTraceEvent event;
+        event.type = TaskTraceEvent::Type::BLOCKED;
+        event.query_id = i % 2 == 0 ? query_id : other_query_id;
+        event.task_name = "task0(Pipeline 0)";
+        event.dependency_name = "DATA_QUEUE_DEPENDENCY";
+        event.start_time = i * 10;
+        event.end_time = i * 10 + 5;
+        ring.record(std::move(event));
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(ring.dump_chrome_trace(nullptr).c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    const auto& events = doc["traceEvents"];
+    // process_name, thread_name and the last event
+    ASSERT_EQ(3, events.Size());
+    EXPECT_STREQ("M", events[0]["ph"].GetString());
+    EXPECT_STREQ("X", events[2]["ph"].GetString());
+    EXPECT_STREQ("blocked by DATA_QUEUE_DEPENDENCY", events[2]["name"].GetString());
+    EXPECT_EQ(90, events[2]["ts"].GetUint64());
+    EXPECT_EQ(5, events[2]["dur"].GetUint64());
+
+    doc.Parse(ring.dump_chrome_trace(&query_id).c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_EQ(0, doc["traceEvents"].Size());
+}
+
+TEST(TaskTraceRingTest, sampled) {
+    auto sample_interval = config::pipeline_task_trace_sample_interval;
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(100);
+
+    config::pipeline_task_trace_sample_interval = 100;
+    EXPECT_TRUE(TaskTraceRing(16).sampled(query_id));
+    EXPECT_FALSE(TaskTraceRing(0).sampled(query_id));
+    query_id.__set_lo(101);
+    EXPECT_FALSE(TaskTraceRing(16).sampled(query_id));
+    config::pipeline_task_trace_sample_interval = 0;
+    EXPECT_FALSE(TaskTraceRing(16).sampled(query_id));
+
+    config::pipeline_task_trace_sample_interval = sample_interval;
+}
+
+} // namespace doris::pipeline
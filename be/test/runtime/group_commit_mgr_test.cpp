@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/group_commit_mgr.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris {
+
+TEST(GroupCommitTableTest, calc_commit_interval_ms) {
+    auto enable = config::enable_adaptive_group_commit_interval;
+    auto target = config::group_commit_target_visible_latency_ms;
+    auto min_interval = config::group_commit_min_interval_ms;
+    config::group_commit_target_visible_latency_ms = 2000;
+    config::group_commit_min_interval_ms = 100;
+
+    config::enable_adaptive_group_commit_interval = false;
+    EXPECT_EQ(10000, GroupCommitTable::calc_commit_interval_ms(10000, 500));
+
+    config::enable_adaptive_group_commit_interval = true;
+    EXPECT_EQ(1500, GroupCommitTable::calc_commit_interval_ms(10000, 500));
+    // never longer than the interval of the table
+    EXPECT_EQ(1000, GroupCommitTable::calc_commit_interval_ms(1000, 500));
+    // a slow commit doesn't make the interval too short
+    EXPECT_EQ(100, GroupCommitTable::calc_commit_interval_ms(10000, 5000));
+
+    config::enable_adaptive_group_commit_interval = enable;
+    config::group_commit_target_visible_latency_ms = target;
+    config::group_commit_min_interval_ms = min_interval;
+}
+
+TEST(GroupCommitTableTest, calc_shard_num) {
+    auto max_shards = config::group_commit_max_shards;
+    auto shard_bytes = config::group_commit_shard_bytes_per_second;
+    config::group_commit_shard_bytes_per_second = 100;
+
+    config::group_commit_max_shards = 1;
+    EXPECT_EQ(1, GroupCommitTable::calc_shard_num(1000));
+
+    config::group_commit_max_shards = 4;
+    EXPECT_EQ(1, GroupCommitTable::calc_shard_num(0));
+    EXPECT_EQ(1, GroupCommitTable::calc_shard_num(99));
+    EXPECT_EQ(2, GroupCommitTable::calc_shard_num(100));
+    EXPECT_EQ(4, GroupCommitTable::calc_shard_num(1000));
+
+    config::group_commit_max_shards = max_shards;
+    config::group_commit_shard_bytes_per_second = shard_bytes;
+}
+
+} // namespace doris
@@ -22,7 +22,10 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
 #include "vec/common/allocator_fwd.h"
 
 namespace doris {
@@ -59,4 +62,64 @@ TEST(AllocatorTest, TestNormal) {
     test_normal();
 }
 
+TEST(AllocatorTest, TestThreadCache) {
+    Allocator<false, false, false> allocator;
+    auto* ptr = allocator.alloc(8192);
+    allocator.free(ptr, 8192);
+
+    // the freed buffer is reused by the next allocation of the same size class
+    auto hit_times = AllocatorThreadCache::hit_times();
+    auto* reused = allocator.alloc(8192);
+    EXPECT_EQ(reused, ptr);
+    EXPECT_EQ(AllocatorThreadCache::hit_times(), hit_times + 1);
+
+    // a growing buffer takes the cached buffer of the new size
+    auto* grown = allocator.alloc(16384);
+    allocator.free(grown, 16384);
+    reused = allocator.realloc(reused, 8192, 16384);
+    EXPECT_EQ(reused, grown);
+    allocator.free(reused, 16384);
+
+    // the sizes not of power of two are not cached
+    auto miss_times = AllocatorThreadCache::miss_times();
+    ptr = allocator.alloc(5000);
+    allocator.free(ptr, 5000);
+    EXPECT_EQ(AllocatorThreadCache::get(5000), nullptr);
+    EXPECT_EQ(AllocatorThreadCache::miss_times(), miss_times);
+
+    // the zeroed memory is not taken from the cache
+    Allocator<true, false, false> clear_allocator;
+    auto* cleared = static_cast<char*>(clear_allocator.alloc(16384));
+    EXPECT_EQ(cleared[0], 0);
+    clear_allocator.free(cleared, 16384);
+}
+
+TEST(AllocatorTest, TestHugePage) {
+    bool enable_huge_page = config::enable_huge_page_for_large_allocation;
+    int64_t threshold = config::huge_page_allocation_threshold_bytes;
+    config::enable_huge_page_for_large_allocation = true;
+    config::huge_page_allocation_threshold_bytes = 8 * 1024 * 1024;
+    auto* tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+    int64_t huge_page_bytes = tracker->huge_page_consumption();
+
+    Allocator<false, false, false> allocator;
+    auto* ptr = static_cast<char*>(allocator.alloc(16 * 1024 * 1024));
+    memset(ptr, 1, 16 * 1024 * 1024);
+    // at least the 2MB pages inside the buffer except the ones at both ends
+    EXPECT_GE(tracker->huge_page_consumption(), huge_page_bytes + 12 * 1024 * 1024);
+    ptr = static_cast<char*>(allocator.realloc(ptr, 16 * 1024 * 1024, 32 * 1024 * 1024));
+    EXPECT_EQ(ptr[0], 1);
+    EXPECT_GE(tracker->huge_page_consumption(), huge_page_bytes + 28 * 1024 * 1024);
+    allocator.free(ptr, 32 * 1024 * 1024);
+    EXPECT_EQ(tracker->huge_page_consumption(), huge_page_bytes);
+
+    // the small allocations are not advised
+    ptr = static_cast<char*>(allocator.alloc(4 * 1024 * 1024));
+    EXPECT_EQ(tracker->huge_page_consumption(), huge_page_bytes);
+    allocator.free(ptr, 4 * 1024 * 1024);
+
+    config::enable_huge_page_for_large_allocation = enable_huge_page;
+    config::huge_page_allocation_threshold_bytes = threshold;
+}
+
 } // namespace doris
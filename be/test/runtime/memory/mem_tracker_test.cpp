@@ -19,6 +19,8 @@
 #include <gtest/gtest-test-part.h>
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "runtime/memory/mem_tracker_limiter.h"
@@ -49,4 +51,34 @@ TEST(MemTrackerTest, SingleTrackerWithLimit) {
     t->release(5);
 }
 
+TEST(MemTrackerTest, ShardedMemCounter) {
+    ShardedMemCounter counter;
+    counter.set_fold_bytes(100);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 1000; ++j) {
+                counter.add(30);
+            }
+            for (int j = 0; j < 500; ++j) {
+                counter.sub(30);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.current_value(), 8 * 500 * 30);
+    EXPECT_LE(counter.current_value() - counter.approximate_value(),
+              int64_t(ShardedMemCounter::SHARD_NUM) * 100);
+    EXPECT_GE(counter.peak_value(), counter.current_value());
+
+    counter.set_fold_bytes(0);
+    EXPECT_EQ(counter.approximate_value(), 8 * 500 * 30);
+    EXPECT_FALSE(counter.try_add(1, 8 * 500 * 30));
+    EXPECT_TRUE(counter.try_add(1, 8 * 500 * 30 + 1));
+    counter.set(0);
+    EXPECT_EQ(counter.current_value(), 0);
+}
+
 } // end namespace doris
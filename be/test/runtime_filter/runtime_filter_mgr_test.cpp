@@ -24,6 +24,7 @@
 #include "runtime/query_context.h"
 #include "runtime_filter/runtime_filter_producer.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer_op.h"
 
 namespace doris {
 
@@ -181,4 +182,46 @@ TEST_F(RuntimeFilterMgrTest, TestRuntimeFilterMergeControllerEntity) {
     }
 }
 
+TEST_F(RuntimeFilterMgrTest, TestRuntimeFilterMergeWithPartialMergers) {
+    int rid = 1;
+    int producer_num = 20;
+    auto fan_in = config::runtime_filter_merge_fan_in;
+    Defer defer {[&]() { config::runtime_filter_merge_fan_in = fan_in; }};
+    config::runtime_filter_merge_fan_in = 4;
+
+    auto query_options = TQueryOptionsBuilder().build();
+    auto fe_address = TNetworkAddress();
+    fe_address.hostname = BackendOptions::get_localhost();
+    fe_address.port = config::brpc_port;
+    auto ctx = QueryContext::create(TUniqueId(), ExecEnv::GetInstance(), query_options,
+                                    fe_address, true, fe_address, QuerySource::INTERNAL_FRONTEND);
+    auto entity = std::make_shared<RuntimeFilterMergeControllerEntity>();
+    auto desc = TRuntimeFilterDescBuilder().add_planId_to_target_expr(0).build();
+    auto param = TRuntimeFilterParamsBuilder()
+                         .add_rid_to_runtime_filter(rid, desc)
+                         .add_runtime_filter_builder_num(rid, producer_num)
+                         .add_rid_to_target_paramv2(rid, {TRuntimeFilterTargetParamsV2()})
+                         .build();
+    EXPECT_TRUE(entity->init(ctx, param).ok());
+
+    auto& cnt_val = entity->_filter_map[rid];
+    ASSERT_EQ(cnt_val.partial_mergers.size(), 4);
+    for (int i = 0; i < producer_num; ++i) {
+        std::shared_ptr<RuntimeFilterProducer> producer;
+        EXPECT_TRUE(RuntimeFilterProducer::create(ctx.get(), &desc, &producer).ok());
+        producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+        EXPECT_TRUE(entity->_merge_into_partial_merger(cnt_val, producer.get()).ok());
+    }
+    int merged_num = 0;
+    for (auto& partial : cnt_val.partial_mergers) {
+        merged_num += partial->merger->received_producer_num();
+        EXPECT_TRUE(cnt_val.merger
+                            ->merge_from(partial->merger.get(),
+                                         partial->merger->received_producer_num())
+                            .ok());
+    }
+    EXPECT_EQ(merged_num, producer_num);
+    EXPECT_TRUE(cnt_val.merger->ready());
+}
+
 } // namespace doris
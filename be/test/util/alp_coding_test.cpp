@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/alp_coding.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+template <typename T>
+size_t alp_round_trip(const std::vector<T>& values) {
+    faststring buffer;
+    AlpEncoder<T>::encode(values.data(), values.size(), &buffer);
+    EXPECT_EQ(values.size(), AlpDecoder<T>::count(buffer.data(), buffer.size()));
+
+    std::vector<T> decoded(values.size());
+    EXPECT_TRUE(AlpDecoder<T>::decode(buffer.data(), buffer.size(), decoded.data()));
+    // compare the bits for NaN and -0.0
+    EXPECT_EQ(0, std::memcmp(values.data(), decoded.data(), values.size() * sizeof(T)));
+    return buffer.size();
+}
+
+TEST(TestAlpCoding, decimal_doubles) {
+    std::mt19937 rng(1);
+    std::vector<double> values;
+    for (int i = 0; i < 5000; ++i) {
+        values.push_back(static_cast<double>(rng() % 1000000) / 100);
+    }
+    size_t size = alp_round_trip(values);
+    EXPECT_LT(size, values.size() * sizeof(double) / 2);
+}
+
+TEST(TestAlpCoding, random_doubles) {
+    std::mt19937_64 rng(2);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<double> values;
+    for (int i = 0; i < 3000; ++i) {
+        values.push_back(distribution(rng));
+    }
+    alp_round_trip(values);
+}
+
+TEST(TestAlpCoding, special_values) {
+    std::vector<double> values {0.0,
+                                -0.0,
+                                std::numeric_limits<double>::quiet_NaN(),
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::lowest(),
+                                std::numeric_limits<double>::denorm_min(),
+                                1.5,
+                                -2.25};
+    alp_round_trip(values);
+
+    // all values are exceptions
+    std::vector<double> nans(1500, std::numeric_limits<double>::quiet_NaN());
+    alp_round_trip(nans);
+
+    alp_round_trip(std::vector<double> {});
+}
+
+TEST(TestAlpCoding, floats) {
+    std::mt19937 rng(3);
+    std::vector<float> values;
+    for (int i = 0; i < 2500; ++i) {
+        values.push_back(static_cast<float>(rng() % 100000) / 10);
+    }
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+    values.push_back(-0.0F);
+    size_t size = alp_round_trip(values);
+    EXPECT_LT(size, values.size() * sizeof(float));
+}
+
+TEST(TestAlpCoding, broken_data) {
+    std::vector<double> values(2000, 12.5);
+    faststring buffer;
+    AlpEncoder<double>::encode(values.data(), values.size(), &buffer);
+    std::vector<double> decoded(values.size());
+    for (size_t len = 0; len < buffer.size(); len += 7) {
+        EXPECT_FALSE(AlpDecoder<double>::decode(buffer.data(), len, decoded.data()));
+    }
+}
+
+} // namespace doris
@@ -218,4 +218,35 @@ TEST(TestBitStreamUtil, TestUint64) {
     reader.GetValue(16, &v4);
     EXPECT_EQ(v4, 126);
 }
+
+TEST(TestBitStreamUtil, TestUnpackBatch) {
+    // cover both the 8 values unpacked at a time and the tail
+    const int num_values = 1000 + 7;
+    for (int bit_width = 1; bit_width <= 32; ++bit_width) {
+        faststring buffer;
+        BitWriter writer(&buffer);
+        std::vector<uint32_t> values(num_values);
+        for (int i = 0; i < num_values; ++i) {
+            values[i] = static_cast<uint32_t>((i * 2654435761ULL) & ((1ULL << bit_width) - 1));
+            writer.PutValue(values[i], bit_width);
+        }
+        writer.Flush();
+
+        std::vector<uint32_t> unpacked(num_values);
+        BatchedBitReader reader(buffer.data(), buffer.size());
+        EXPECT_EQ(num_values, reader.UnpackBatch(bit_width, num_values, unpacked.data()));
+        EXPECT_EQ(values, unpacked) << "bit width " << bit_width;
+
+        if (bit_width <= 16) {
+            std::vector<uint16_t> unpacked16(num_values);
+            auto [end, num_read] = BitPacking::UnpackValues(bit_width, buffer.data(), buffer.size(),
+                                                            num_values, unpacked16.data());
+            EXPECT_EQ(num_values, num_read);
+            EXPECT_EQ(buffer.data() + buffer.size(), end);
+            for (int i = 0; i < num_values; ++i) {
+                EXPECT_EQ(values[i], unpacked16[i]) << "bit width " << bit_width;
+            }
+        }
+    }
+}
 } // namespace doris
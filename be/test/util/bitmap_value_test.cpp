@@ -896,6 +896,59 @@ TEST(BitmapValueTest, bitmap_union) {
     config::enable_set_in_bitmap_value = old_config;
 }
 
+TEST(BitmapValueTest, Roaring64Map_fastunion) {
+    using doris::detail::Roaring64Map;
+    // 3 high keys, each one in some of the inputs
+    std::vector<Roaring64Map> inputs(5);
+    std::vector<std::vector<uint64_t>> bits(inputs.size());
+    Roaring64Map expected;
+    for (uint64_t i = 0; i < inputs.size(); i++) {
+        for (uint64_t v = i * 100; v < i * 100 + 1000; v++) {
+            bits[i].push_back(v);
+            if (i % 2 == 0) {
+                bits[i].push_back((1ULL << 32) + v);
+            }
+        }
+        bits[i].push_back((i + 2) << 32);
+        for (auto v : bits[i]) {
+            inputs[i].add(v);
+            expected.add(v);
+        }
+    }
+    std::vector<const Roaring64Map*> pointers;
+    for (const auto& input : inputs) {
+        pointers.push_back(&input);
+    }
+    Roaring64Map result = Roaring64Map::fastunion(pointers.size(), pointers.data());
+    EXPECT_TRUE(expected == result);
+    EXPECT_EQ(expected.cardinality(), result.cardinality());
+
+    Roaring64Map existing;
+    existing.add(uint64_t(5000));
+    existing.add(uint64_t(100) << 32);
+    existing.union_many(pointers.size(), pointers.data());
+    expected.add(uint64_t(5000));
+    expected.add(uint64_t(100) << 32);
+    EXPECT_TRUE(expected == existing);
+
+    // union with itself changes nothing
+    pointers.push_back(&existing);
+    existing.union_many(pointers.size(), pointers.data());
+    EXPECT_TRUE(expected == existing);
+
+    std::vector<BitmapValue> values;
+    for (const auto& input_bits : bits) {
+        values.emplace_back(input_bits);
+    }
+    // a BITMAP unioned with the others
+    BitmapValue union_value(bits[0]);
+    union_value.fastunion({&values[1], &values[2], &values[3], &values[4]});
+    EXPECT_EQ(result.cardinality(), union_value.cardinality());
+    for (auto v : result) {
+        EXPECT_TRUE(union_value.contains(v));
+    }
+}
+
 TEST(BitmapValueTest, bitmap_intersect) {
     BitmapValue empty;
     BitmapValue single(1024);
@@ -300,4 +300,28 @@ TEST_F(TestForCoding, accuracy_test) {
     }
 }
 
-} // namespace doris
\ No newline at end of file
+TEST_F(TestForCoding, bit_unpack_accuracy_test) {
+    std::default_random_engine e;
+    std::uniform_int_distribution<int64_t> u;
+    ForDecoder<int64_t> decoder(nullptr, 0);
+    for (int n = 1; n <= 255; n++) {
+        std::vector<int64_t> test_data(n);
+        std::vector<int64_t> output(n);
+        // the original bit_pack does not support the sign bit of int64_t
+        for (int w = 1; w <= 63; w++) {
+            uint64_t in_mask = (uint64_t(1) << w) - 1;
+            for (int i = 0; i < n; i++) {
+                test_data[i] = int64_t(uint64_t(u(e)) & in_mask);
+            }
+            int size = (n * w + 7) / 8;
+            std::vector<uint8_t> packed(size);
+            bit_pack<int64_t>(test_data.data(), n, w, packed.data());
+            decoder.bit_unpack(packed.data(), n, w, output.data());
+            for (int i = 0; i < n; i++) {
+                ASSERT_EQ(test_data[i], output[i]) << "n=" << n << " w=" << w << " i=" << i;
+            }
+        }
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+class FsstCodingTest : public testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 rng(1);
+        const std::vector<std::string> hosts {"www.example.com", "api.doris.apache.org",
+                                              "github.com"};
+        for (int i = 0; i < 5000; ++i) {
+            _values.push_back("https://" + hosts[rng() % hosts.size()] + "/path/" +
+                              std::to_string(rng() % 100000) + "?q=item");
+        }
+        _values.emplace_back();
+        _values.emplace_back("\xff\x00\xfe", 3);
+        for (const auto& value : _values) {
+            _slices.emplace_back(value);
+        }
+        _symbol_table.build(_slices.data(), _slices.size());
+    }
+
+    std::string decode(const FsstSymbolTable& symbol_table, const faststring& codes) {
+        std::string value(codes.size() * FsstSymbolTable::MAX_SYMBOL_LENGTH, '\0');
+        size_t size = 0;
+        EXPECT_TRUE(symbol_table.decode(codes.data(), codes.size(),
+                                        reinterpret_cast<uint8_t*>(value.data()), &size));
+        value.resize(size);
+        return value;
+    }
+
+    std::vector<std::string> _values;
+    std::vector<Slice> _slices;
+    FsstSymbolTable _symbol_table;
+};
+
+TEST_F(FsstCodingTest, round_trip) {
+    EXPECT_GT(_symbol_table.num_symbols(), 0);
+    faststring serialized;
+    _symbol_table.serialize(&serialized);
+    FsstSymbolTable symbol_table;
+    EXPECT_EQ(serialized.size(), symbol_table.deserialize(serialized.data(), serialized.size()));
+
+    size_t raw_size = 0;
+    size_t encoded_size = 0;
+    for (const auto& value : _values) {
+        faststring codes;
+        _symbol_table.encode(Slice(value), &codes);
+        EXPECT_EQ(value, decode(symbol_table, codes));
+        raw_size += value.size();
+        encoded_size += codes.size();
+    }
+    EXPECT_LT(encoded_size, raw_size / 2);
+}
+
+TEST_F(FsstCodingTest, equal_on_codes) {
+    faststring codes;
+    _symbol_table.encode(Slice(_values[0]), &codes);
+    for (const auto& value : _values) {
+        faststring other;
+        _symbol_table.encode(Slice(value), &other);
+        EXPECT_EQ(value == _values[0],
+                  codes.size() == other.size() &&
+                          memcmp(codes.data(), other.data(), codes.size()) == 0);
+    }
+}
+
+TEST_F(FsstCodingTest, unseen_bytes) {
+    // the bytes not in the symbols are escaped
+    std::string value("unseen \x01\x02\x03 bytes", 16);
+    faststring codes;
+    _symbol_table.encode(Slice(value), &codes);
+    EXPECT_EQ(value, decode(_symbol_table, codes));
+
+    uint8_t escape = FsstSymbolTable::ESCAPE_CODE;
+    uint8_t output[FsstSymbolTable::MAX_SYMBOL_LENGTH];
+    size_t size = 0;
+    EXPECT_FALSE(_symbol_table.decode(&escape, 1, output, &size));
+}
+
+TEST_F(FsstCodingTest, broken_symbol_table) {
+    faststring serialized;
+    _symbol_table.serialize(&serialized);
+    FsstSymbolTable symbol_table;
+    for (size_t len = 0; len < serialized.size(); len += 13) {
+        EXPECT_EQ(0, symbol_table.deserialize(serialized.data(), len));
+    }
+}
+
+} // namespace doris
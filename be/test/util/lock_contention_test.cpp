@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "util/lock_contention.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "util/countdown_latch.h"
+
+namespace doris {
+
+class LockContentionTest : public testing::Test {
+public:
+    void SetUp() override {
+        _sample_interval = config::lock_contention_sample_interval;
+        config::lock_contention_sample_interval = 1;
+    }
+    void TearDown() override { config::lock_contention_sample_interval = _sample_interval; }
+
+private:
+    int32_t _sample_interval;
+};
+
+TEST_F(LockContentionTest, uncontended) {
+    static LockContentionSite site("lock_contention_test_uncontended");
+    ProfiledMutex<std::mutex> mutex(&site);
+    for (int i = 0; i < 100; i++) {
+        std::lock_guard l(mutex);
+    }
+    EXPECT_EQ(0, site.contended());
+    EXPECT_EQ(0, site.sampled_wait_us());
+}
+
+TEST_F(LockContentionTest, contended) {
+    static LockContentionSite site("lock_contention_test_contended");
+    ProfiledSharedMutex mutex(&site);
+    CountDownLatch locked(1);
+    std::thread holder([&] {
+        std::lock_guard l(mutex);
+        locked.count_down();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    locked.wait();
+    {
+        std::shared_lock l(mutex);
+    }
+    holder.join();
+    {
+        // not contended any more
+        std::lock_guard l(mutex);
+    }
+    EXPECT_EQ(1, site.contended());
+    EXPECT_GT(site.sampled_wait_us(), 0);
+
+    std::string report = LockContentionSite::report(10);
+    EXPECT_NE(std::string::npos, report.find("lock_contention_test_contended"));
+    EXPECT_NE(std::string::npos, report.find("holders"));
+}
+
+TEST_F(LockContentionTest, plain_mutex) {
+    static LockContentionSite site("lock_contention_test_plain_mutex");
+    std::mutex mutex;
+    std::atomic<const void*> holder_call_site = nullptr;
+    CountDownLatch locked(1);
+    std::thread holder([&] {
+        profiled_lock(mutex, &site, &holder_call_site);
+        std::lock_guard l(mutex, std::adopt_lock);
+        locked.count_down();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    locked.wait();
+    EXPECT_NE(nullptr, holder_call_site.load());
+    {
+        profiled_lock(mutex, &site, &holder_call_site);
+        std::lock_guard l(mutex, std::adopt_lock);
+    }
+    holder.join();
+    EXPECT_EQ(1, site.contended());
+    EXPECT_GT(site.sampled_wait_us(), 0);
+}
+
+} // namespace doris
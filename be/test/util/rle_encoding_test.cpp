@@ -418,4 +418,30 @@ TEST_F(TestRle, TestSkip) {
     encoder.Flush();
 }
 
+TEST_F(TestRle, TestGetValues) {
+    // levels of a max level 3, the literal runs are read in batches and one by one
+    faststring buffer;
+    RleEncoder<int16_t> encoder(&buffer, 2);
+    std::vector<int16_t> values;
+    for (int i = 0; i < 2000; ++i) {
+        int16_t value = i % 300 < 100 ? 3 : static_cast<int16_t>(i * 7 % 4);
+        values.push_back(value);
+        encoder.Put(value);
+    }
+    encoder.Flush();
+
+    for (size_t batch_size : {1, 7, 8, 29, 64, 2000}) {
+        RleDecoder<int16_t> decoder(buffer.data(), encoder.len(), 2);
+        std::vector<int16_t> decoded(values.size());
+        size_t num_decoded = 0;
+        while (num_decoded < values.size()) {
+            size_t n = decoder.get_values(decoded.data() + num_decoded,
+                                          std::min(batch_size, values.size() - num_decoded));
+            ASSERT_GT(n, 0);
+            num_decoded += n;
+        }
+        EXPECT_EQ(values, decoded) << "batch size " << batch_size;
+    }
+}
+
 } // namespace doris
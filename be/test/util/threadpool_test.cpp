@@ -130,6 +130,7 @@ TEST_F(ThreadPoolTest, TestSimpleTasks) {
     EXPECT_TRUE(_pool->submit(task).ok());
     _pool->wait();
     EXPECT_EQ(10 + 15 + 20 + 15, counter.load());
+    EXPECT_EQ(4, _pool->thread_pool_task_wait_worker_time_ns->num());
     _pool->shutdown();
 }
 
@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/token_bucket.h"
+
+#include <gtest/gtest.h>
+
+namespace doris {
+
+TEST(TokenBucketTest, take_within_burst) {
+    TokenBucket bucket(1000, 1000);
+    int64_t now = MonotonicNanos();
+    EXPECT_EQ(bucket.take(600, now), 0);
+    EXPECT_EQ(bucket.take(400, now), 0);
+    // 500 tokens in debt, half a second to refill
+    EXPECT_EQ(bucket.take(500, now), NANOS_PER_SEC / 2);
+}
+
+TEST(TokenBucketTest, refill_over_time) {
+    TokenBucket bucket(1000, 1000);
+    int64_t now = MonotonicNanos();
+    EXPECT_EQ(bucket.take(1000, now), 0);
+    EXPECT_EQ(bucket.take(500, now + NANOS_PER_SEC / 2), 0);
+    // the refilled tokens never exceed the burst
+    EXPECT_EQ(bucket.take(1000, now + NANOS_PER_SEC * 10), 0);
+    EXPECT_GT(bucket.take(1, now + NANOS_PER_SEC * 10), 0);
+}
+
+} // namespace doris
@@ -24,10 +24,13 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "runtime/define_primitive_type.h"
 #include "vec/columns/common_column_test.h"
 #include "vec/data_types/data_type_factory.hpp"
 #include "vec/data_types/data_type_nothing.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
 #include "vec/json/path_in_data.h"
 
 namespace doris::vectorized {
@@ -122,6 +125,39 @@ TEST_F(ColumnVariantTest, updateHashValueWithColumnNothingTest) {
     EXPECT_NO_THROW(variant->update_crc_with_value(0, 3, crc_hash_with_null, null_map.data()));
 }
 
+TEST_F(ColumnVariantTest, test_finalize_with_max_subcolumns_count) {
+    auto type = make_nullable(std::make_shared<DataTypeInt32>());
+    auto make_subcolumn = [&](size_t num_nulls) {
+        auto column = type->create_column();
+        for (size_t i = 0; i < 10; ++i) {
+            if (i < num_nulls) {
+                column->insert_default();
+            } else {
+                column->insert(Field::create_field<TYPE_INT>(static_cast<int32_t>(i)));
+            }
+        }
+        return ColumnVariant::Subcolumn(std::move(column), type, true, false);
+    };
+    ColumnVariant::Subcolumns subcolumns;
+    subcolumns.create_root(ColumnVariant::Subcolumn(10, true, true /*root*/));
+    subcolumns.add(PathInData("v.a"), make_subcolumn(8));
+    subcolumns.add(PathInData("v.b"), make_subcolumn(0));
+    subcolumns.add(PathInData("v.c"), make_subcolumn(5));
+    auto variant = ColumnVariant::create(std::move(subcolumns), true);
+
+    int32_t max_subcolumns_count = config::variant_max_subcolumns_count;
+    config::variant_max_subcolumns_count = 2;
+    variant->finalize(ColumnVariant::FinalizeMode::WRITE_MODE);
+    config::variant_max_subcolumns_count = max_subcolumns_count;
+
+    // v.a has the most nulls
+    EXPECT_NE(variant->get_subcolumn(PathInData("v.b")), nullptr);
+    EXPECT_NE(variant->get_subcolumn(PathInData("v.c")), nullptr);
+    EXPECT_EQ(variant->get_subcolumn(PathInData("v.a")), nullptr);
+    ASSERT_EQ(variant->get_sparse_subcolumns().size(), 1);
+    EXPECT_EQ((*variant->get_sparse_subcolumns().begin())->path.get_path(), "v.a");
+}
+
 // TEST
 TEST_F(ColumnVariantTest, test_pop_back) {
     ColumnVariant::Subcolumn subcolumn(0, true /* is_nullable */, false /* is_root */);
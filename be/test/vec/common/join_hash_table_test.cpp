@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace doris {
+
+class JoinHashTableTest : public testing::Test {
+protected:
+    using HashTable = JoinHashTable<uint64_t>;
+
+    // Build a hash table with `rows` build rows, the key of build row i is i * 2,
+    // row 0 is the mocked row.
+    void build(HashTable& table, uint32_t rows) {
+        _build_keys.resize(rows);
+        for (uint32_t i = 0; i < rows; ++i) {
+            _build_keys[i] = uint64_t(i) * 2;
+        }
+        table.prepare_build<TJoinOp::LEFT_SEMI_JOIN>(rows, PROBE_ROWS, false);
+        _bucket_size = table.get_bucket_size();
+        std::vector<uint32_t> bucket_nums(rows);
+        for (uint32_t i = 0; i < rows; ++i) {
+            bucket_nums[i] = uint32_t(table.hash(_build_keys[i]) & (_bucket_size - 1));
+        }
+        table.build(_build_keys.data(), bucket_nums.data(), rows, false);
+    }
+
+    // Probe keys 0, 1, 2 ... and returns the matched probe rows of left semi join.
+    std::vector<uint32_t> probe(HashTable& table) {
+        std::vector<uint64_t> probe_keys(PROBE_ROWS);
+        DorisVector<uint32_t> build_idx_map(PROBE_ROWS);
+        for (uint32_t i = 0; i < PROBE_ROWS; ++i) {
+            probe_keys[i] = i;
+            build_idx_map[i] = uint32_t(table.hash(probe_keys[i]) & (_bucket_size - 1));
+        }
+        table.pre_build_idxs(build_idx_map);
+
+        std::vector<uint32_t> probe_idxs(PROBE_ROWS + 1);
+        std::vector<uint32_t> build_idxs(PROBE_ROWS + 1);
+        bool probe_visited = false;
+        auto [probe_idx, build_idx, matched_cnt] = table.find_batch<TJoinOp::LEFT_SEMI_JOIN>(
+                probe_keys.data(), build_idx_map.data(), 0, 0, PROBE_ROWS, probe_idxs.data(),
+                probe_visited, build_idxs.data(), nullptr, false, false, false);
+        EXPECT_EQ(probe_idx, int(PROBE_ROWS));
+        probe_idxs.resize(matched_cnt);
+        return probe_idxs;
+    }
+
+    static constexpr uint32_t PROBE_ROWS = 4096;
+    std::vector<uint64_t> _build_keys;
+    uint32_t _bucket_size = 0;
+};
+
+TEST_F(JoinHashTableTest, probe_small_table) {
+    HashTable table;
+    build(table, 1024);
+    ASSERT_LT(table.get_bucket_size(), HashTable::BUCKET_BITMAP_MIN_BUCKETS);
+
+    auto matched = probe(table);
+    // even keys in [2, 2046] are matched, key 0 only exists in the mocked row
+    ASSERT_EQ(matched.size(), 1023);
+    for (size_t i = 0; i < matched.size(); ++i) {
+        EXPECT_EQ(matched[i], (i + 1) * 2);
+    }
+}
+
+TEST_F(JoinHashTableTest, probe_large_table_with_bucket_bitmap) {
+    HashTable table;
+    build(table, HashTable::BUCKET_BITMAP_MIN_BUCKETS);
+    ASSERT_GE(table.get_bucket_size(), HashTable::BUCKET_BITMAP_MIN_BUCKETS);
+
+    auto matched = probe(table);
+    // all even probe keys except 0 are matched, odd keys hit empty buckets or miss in chains
+    ASSERT_EQ(matched.size(), PROBE_ROWS / 2 - 1);
+    for (size_t i = 0; i < matched.size(); ++i) {
+        EXPECT_EQ(matched[i], (i + 1) * 2);
+    }
+}
+
+TEST_F(JoinHashTableTest, radix_build_keeps_chain_order) {
+    // every key has two build rows, row i and row i + 1 share key i / 2 * 2
+    constexpr uint32_t rows = HashTable::BUCKET_BITMAP_MIN_BUCKETS;
+    _build_keys.resize(rows);
+    for (uint32_t i = 0; i < rows; ++i) {
+        _build_keys[i] = uint64_t(i / 2) * 2;
+    }
+    HashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(rows, PROBE_ROWS, false);
+    _bucket_size = table.get_bucket_size();
+    ASSERT_GE(_bucket_size, HashTable::BUCKET_BITMAP_MIN_BUCKETS);
+    std::vector<uint32_t> bucket_nums(rows);
+    for (uint32_t i = 0; i < rows; ++i) {
+        bucket_nums[i] = uint32_t(table.hash(_build_keys[i]) & (_bucket_size - 1));
+    }
+    table.build(_build_keys.data(), bucket_nums.data(), rows, false);
+
+    std::vector<uint64_t> probe_keys(PROBE_ROWS);
+    DorisVector<uint32_t> build_idx_map(PROBE_ROWS);
+    for (uint32_t i = 0; i < PROBE_ROWS; ++i) {
+        probe_keys[i] = uint64_t(i + 1) * 2;
+        build_idx_map[i] = uint32_t(table.hash(probe_keys[i]) & (_bucket_size - 1));
+    }
+    table.pre_build_idxs(build_idx_map);
+
+    std::vector<uint32_t> probe_idxs(PROBE_ROWS + 1);
+    std::vector<uint32_t> build_idxs(PROBE_ROWS + 1);
+    std::vector<std::pair<uint32_t, uint32_t>> matched;
+    int probe_idx = 0;
+    uint32_t build_idx = 0;
+    bool probe_visited = false;
+    while (probe_idx < int(PROBE_ROWS)) {
+        auto [next_probe_idx, next_build_idx, matched_cnt] =
+                table.find_batch<TJoinOp::INNER_JOIN>(
+                        probe_keys.data(), build_idx_map.data(), probe_idx, build_idx, PROBE_ROWS,
+                        probe_idxs.data(), probe_visited, build_idxs.data(), nullptr, false, false,
+                        false);
+        for (uint32_t i = 0; i < matched_cnt; ++i) {
+            matched.emplace_back(probe_idxs[i], build_idxs[i]);
+        }
+        probe_idx = next_probe_idx;
+        build_idx = next_build_idx;
+    }
+
+    // the later build row of a key is at the head of its chain
+    ASSERT_EQ(matched.size(), PROBE_ROWS * 2);
+    for (uint32_t i = 0; i < PROBE_ROWS; ++i) {
+        EXPECT_EQ(matched[i * 2].first, i);
+        EXPECT_EQ(matched[i * 2].second, (i + 1) * 2 + 1);
+        EXPECT_EQ(matched[i * 2 + 1].first, i);
+        EXPECT_EQ(matched[i * 2 + 1].second, (i + 1) * 2);
+    }
+}
+
+} // namespace doris
@@ -1302,6 +1302,38 @@ TEST(BlockTest, filter) {
     }
 }
 
+TEST(BlockTest, filter_sparse) {
+    constexpr size_t rows = 1000;
+    std::vector<int32_t> ints;
+    std::vector<std::string> strings;
+    std::vector<uint8_t> nulls;
+    vectorized::IColumn::Filter filter(rows, 0);
+    for (size_t i = 0; i < rows; ++i) {
+        ints.push_back(int32_t(i));
+        strings.push_back(std::to_string(i * 7));
+        nulls.push_back(i % 3 == 0);
+        filter[i] = i % 17 == 0;
+    }
+    auto block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(ints);
+    block.insert(
+            vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeString>(strings));
+    block.insert(vectorized::ColumnHelper::create_nullable_column_with_name<
+                 vectorized::DataTypeInt32>(ints, nulls));
+    block.insert({vectorized::ColumnConst::create(vectorized::ColumnInt32::create(1, 5), rows),
+                  std::make_shared<vectorized::DataTypeInt32>(), "const"});
+
+    // the same as filtering the columns one by one
+    auto expected = block;
+    for (size_t i = 0; i < expected.columns(); ++i) {
+        auto& column = expected.get_by_position(i).column;
+        column = column->filter(filter, -1);
+    }
+    vectorized::Block::filter_block_internal(&block, {0, 1, 2, 3}, filter);
+    ASSERT_EQ(block.rows(), (rows + 16) / 17);
+    EXPECT_TRUE(vectorized::ColumnHelper::block_equal(block, expected));
+    EXPECT_TRUE(vectorized::is_column_const(*block.get_by_position(3).column));
+}
+
 TEST(BlockTest, add_rows) {
     auto block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>({1, 2, 3});
     block.insert(vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeString>(
@@ -1320,6 +1352,19 @@ TEST(BlockTest, add_rows) {
     ASSERT_TRUE(st.ok()) << st.to_string();
 
     ASSERT_EQ(mutable_block2.rows(), 3);
+
+    // consecutive rows are copied as a range
+    auto block3 = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>({1, 2, 3});
+    block3.insert(vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeString>(
+            {"abc", "efg", "hij"}));
+    vectorized::MutableBlock mutable_block3(block3.clone_empty());
+    std::vector<uint32_t> range_rows {1, 2};
+    st = mutable_block3.add_rows(&block3, range_rows.data(), range_rows.data() + range_rows.size());
+    ASSERT_TRUE(st.ok()) << st.to_string();
+    auto result = mutable_block3.to_block();
+    ASSERT_EQ(result.rows(), 2);
+    EXPECT_EQ(result.get_by_position(0).column->get_int(0), 2);
+    EXPECT_EQ(result.get_by_position(1).column->get_data_at(1).to_string(), "hij");
 }
 
 TEST(BlockTest, others) {
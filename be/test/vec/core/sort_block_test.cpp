@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/config.h"
+#include "testutil/column_helper.h"
+#include "util/defer_op.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class SortBlockTest : public testing::Test {
+protected:
+    // the sorted block of `description` with and without normalized keys
+    std::pair<Block, Block> sort(Block& block, const SortDescription& description) {
+        bool enable_normalized_key = config::enable_sort_normalized_key;
+        Defer defer {[&]() { config::enable_sort_normalized_key = enable_normalized_key; }};
+
+        config::enable_sort_normalized_key = true;
+        auto normalized = block.clone_empty();
+        sort_block(block, normalized, description);
+
+        config::enable_sort_normalized_key = false;
+        auto compared = block.clone_empty();
+        sort_block(block, compared, description);
+        return {std::move(normalized), std::move(compared)};
+    }
+};
+
+TEST_F(SortBlockTest, normalized_key_same_as_column_sort) {
+    constexpr size_t rows = 5000;
+    std::mt19937 rng(42);
+    std::vector<int32_t> ints;
+    std::vector<uint8_t> int_nulls;
+    std::vector<int64_t> bigints;
+    std::vector<int8_t> tinyints;
+    std::vector<uint8_t> tinyint_nulls;
+    for (size_t i = 0; i < rows; ++i) {
+        ints.push_back(int32_t(rng() % 64) - 32);
+        int_nulls.push_back(rng() % 8 == 0);
+        bigints.push_back(int64_t(rng()) - (int64_t(1) << 31));
+        tinyints.push_back(int8_t(int(rng() % 256) - 128));
+        tinyint_nulls.push_back(rng() % 16 == 0);
+    }
+    auto nullable_int = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>());
+    auto nullable_tinyint = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt8>());
+    Block block {
+            ColumnWithTypeAndName(
+                    ColumnHelper::create_nullable_column<DataTypeInt32>(ints, int_nulls),
+                    nullable_int, "c0"),
+            ColumnHelper::create_column_with_name<DataTypeInt64>(bigints),
+            ColumnWithTypeAndName(
+                    ColumnHelper::create_nullable_column<DataTypeInt8>(tinyints, tinyint_nulls),
+                    nullable_tinyint, "c2")};
+
+    // asc nulls first, desc, desc nulls first
+    SortDescription description {{0, 1, -1}, {1, -1, -1}, {2, -1, 1}};
+    auto [normalized, compared] = sort(block, description);
+    EXPECT_TRUE(ColumnHelper::block_equal(normalized, compared));
+
+    // asc nulls last, asc nulls last, the rows of the same keys may differ in the last column
+    SortDescription description2 {{2, 1, 1}, {0, 1, 1}};
+    auto [normalized2, compared2] = sort(block, description2);
+    EXPECT_TRUE(ColumnHelper::column_equal(normalized2.get_by_position(2).column,
+                                           compared2.get_by_position(2).column));
+    EXPECT_TRUE(ColumnHelper::column_equal(normalized2.get_by_position(0).column,
+                                           compared2.get_by_position(0).column));
+}
+
+TEST_F(SortBlockTest, string_sort_by_inlined_prefix) {
+    constexpr size_t rows = 3000;
+    std::mt19937 rng(7);
+    // zeros and high bytes inside the 4 bytes prefix
+    const std::string alphabet {'\0', 'a', 'b', '\xff'};
+    std::vector<std::string> strings;
+    std::vector<int32_t> ints;
+    for (size_t i = 0; i < rows; ++i) {
+        std::string value;
+        for (size_t j = rng() % 7; j > 0; --j) {
+            value.push_back(alphabet[rng() % alphabet.size()]);
+        }
+        strings.push_back(std::move(value));
+        ints.push_back(int32_t(rng() % 4));
+    }
+    auto string_column = ColumnString::create();
+    for (const auto& value : strings) {
+        string_column->insert_data(value.data(), value.size());
+    }
+
+    auto check_sorted = [&](const IColumn::Permutation& perm, bool reverse) {
+        ASSERT_EQ(perm.size(), rows);
+        for (size_t i = 1; i < rows; ++i) {
+            const auto& prev = strings[perm[i - 1]];
+            const auto& cur = strings[perm[i]];
+            EXPECT_TRUE(reverse ? prev >= cur : prev <= cur) << i;
+        }
+    };
+    IColumn::Permutation perm;
+    string_column->get_permutation(false, 0, 1, perm);
+    check_sorted(perm, false);
+    string_column->get_permutation(true, 0, 1, perm);
+    check_sorted(perm, true);
+
+    // the string column inlined in the permutation of ColumnSorter
+    Block block {ColumnWithTypeAndName(std::move(string_column),
+                                       std::make_shared<DataTypeString>(), "c0"),
+                 ColumnHelper::create_column_with_name<DataTypeInt32>(ints)};
+    SortDescription description {{0, -1, -1}, {1, 1, 1}};
+    auto sorted = block.clone_empty();
+    sort_block(block, sorted, description);
+    const auto& sorted_strings = sorted.get_by_position(0).column;
+    const auto& sorted_ints = assert_cast<const ColumnInt32&>(*sorted.get_by_position(1).column);
+    for (size_t i = 1; i < rows; ++i) {
+        auto prev = sorted_strings->get_data_at(i - 1).to_string();
+        auto cur = sorted_strings->get_data_at(i).to_string();
+        EXPECT_GE(prev, cur) << i;
+        if (prev == cur) {
+            EXPECT_LE(sorted_ints.get_element(i - 1), sorted_ints.get_element(i)) << i;
+        }
+    }
+}
+
+TEST_F(SortBlockTest, normalized_key_of_selected_rows) {
+    std::vector<int32_t> ints {5, -3, 7, 0, -3};
+    std::vector<uint8_t> nulls {0, 0, 1, 0, 0};
+    auto column = ColumnHelper::create_nullable_column<DataTypeInt32>(ints, nulls);
+    ASSERT_EQ(normalized_key_width(*column), 5);
+
+    // the rows 4, 2, 0, 3
+    std::vector<size_t> row_ids {4, 2, 0, 3};
+    std::vector<uint8_t> keys(row_ids.size() * 5);
+    encode_normalized_key(*column, SortColumnDescription(0, 1, -1), row_ids.data(), row_ids.size(),
+                          keys.data(), 5, 0);
+    std::vector<size_t> perm {0, 1, 2, 3};
+    std::vector<size_t> tmp(perm.size());
+    radix_sort_normalized_keys(perm.data(), tmp.data(), perm.size(), keys.data(), 5, 0);
+    // NULL, -3, 0, 5
+    EXPECT_EQ(perm, (std::vector<size_t> {1, 0, 3, 2}));
+}
+
+} // namespace doris::vectorized
@@ -41,6 +41,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "olap/hll.h"
 #include "runtime/descriptors.cpp"
 #include "util/arrow/block_convertor.h"
@@ -486,4 +487,46 @@ TEST(DataTypeSerDeArrowTest, BigStringSerDeTest) {
     CommonDataTypeSerdeTest::compare_two_blocks(block, assert_block);
 }
 
+TEST(DataTypeSerDeArrowTest, ZeroCopySerDeTest) {
+    auto block = std::make_shared<Block>();
+    auto int_col = vectorized::ColumnInt64::create();
+    auto str_col = vectorized::ColumnString::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    for (int i = 0; i < 7; ++i) {
+        int_col->insert_value(i * 100);
+        std::string str = std::to_string(i * 100);
+        str_col->insert_data(str.data(), str.size());
+        null_map->insert_value(i % 3 == 0);
+    }
+    const auto* int_data = int_col->get_data().data();
+    const auto* str_data = str_col->get_chars().data();
+    block->insert({std::move(int_col), std::make_shared<DataTypeInt64>(), "int"});
+    block->insert({vectorized::ColumnNullable::create(std::move(str_col), std::move(null_map)),
+                   std::make_shared<DataTypeNullable>(std::make_shared<DataTypeString>()),
+                   "str"});
+
+    config::enable_zero_copy_block_to_arrow = true;
+    auto shared = CommonDataTypeSerdeTest::serialize_arrow(block);
+    config::enable_zero_copy_block_to_arrow = false;
+    auto copied = CommonDataTypeSerdeTest::serialize_arrow(block);
+    config::enable_zero_copy_block_to_arrow = true;
+
+    EXPECT_TRUE(shared->Equals(*copied));
+    EXPECT_EQ(3, shared->column(1)->null_count());
+    EXPECT_EQ(int_data, shared->column(0)->data()->buffers[1]->data());
+    EXPECT_EQ(str_data, shared->column(1)->data()->buffers[2]->data());
+
+    // the arrays keep the columns alive
+    block.reset();
+    auto assert_block = std::make_shared<Block>();
+    assert_block->insert({std::make_shared<DataTypeInt64>()->create_column(),
+                          std::make_shared<DataTypeInt64>(), "int"});
+    auto str_type = std::make_shared<DataTypeNullable>(std::make_shared<DataTypeString>());
+    assert_block->insert({str_type->create_column(), str_type, "str"});
+    CommonDataTypeSerdeTest::deserialize_arrow(assert_block, shared);
+    EXPECT_EQ(600, assert_block->get_by_position(0).column->get_int(6));
+    EXPECT_TRUE(assert_block->get_by_position(1).column->is_null_at(0));
+    EXPECT_EQ("500", assert_block->get_by_position(1).column->get_data_at(5).to_string());
+}
+
 } // namespace doris::vectorized
@@ -17,7 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_ipv4.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
 #include "vec/functions/dictionary_factory.h"
 #include "vec/functions/ip_address_dictionary.h"
 #include "vec/runtime/ip_address_cidr.h"
@@ -73,4 +78,47 @@ TEST(DictionaryIpTest, testEQ) {
     EXPECT_NE(get_ipv6_from_cidr_format("192.1.255.1/20"), get_ipv6_from_ipv4("192.1.255.1"));
 }
 
+TEST(DictionaryIpTest, testGetColumns) {
+    auto key_column = ColumnString::create();
+    auto name_column = ColumnString::create();
+    auto id_column = ColumnInt64::create();
+    std::vector<std::string> cidrs = {"192.168.1.0/24", "192.168.1.128/25", "10.0.0.0/8"};
+    for (size_t i = 0; i < cidrs.size(); i++) {
+        key_column->insert_value(cidrs[i]);
+        name_column->insert_value("net" + std::to_string(i));
+        id_column->insert_value(i);
+    }
+    auto dict = create_ip_trie_dict_from_column(
+            "ip dict",
+            ColumnWithTypeAndName {key_column->clone(), std::make_shared<DataTypeString>(), ""},
+            ColumnsWithTypeAndName {
+                    {name_column->clone(), std::make_shared<DataTypeString>(), "name"},
+                    {id_column->clone(), std::make_shared<DataTypeInt64>(), "id"}});
+
+    auto ip_column = ColumnIPv4::create();
+    for (const auto* ip : {"192.168.1.1", "192.168.1.200", "10.1.1.1", "172.16.0.1"}) {
+        IPv4 ipv4;
+        EXPECT_TRUE(IPv4Value::from_string(ipv4, ip));
+        ip_column->insert_value(ipv4);
+    }
+    auto results = dict->get_columns({"name", "id"},
+                                     {std::make_shared<DataTypeString>(),
+                                      std::make_shared<DataTypeInt64>()},
+                                     ip_column->clone(), std::make_shared<DataTypeIPv4>());
+    ASSERT_EQ(2, results.size());
+    const auto& names = assert_cast<const ColumnNullable&>(*results[0]);
+    const auto& ids = assert_cast<const ColumnNullable&>(*results[1]);
+    std::vector<int64_t> expected = {0, 1, 2, -1};
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (expected[i] < 0) {
+            EXPECT_TRUE(names.is_null_at(i));
+            EXPECT_TRUE(ids.is_null_at(i));
+            continue;
+        }
+        EXPECT_EQ("net" + std::to_string(expected[i]), names.get_data_at(i).to_string());
+        EXPECT_EQ(expected[i],
+                  assert_cast<const ColumnInt64&>(ids.get_nested_column()).get_element(i));
+    }
+}
+
 } // namespace doris::vectorized
@@ -115,6 +115,23 @@ TEST_F(EncloseCsvLineReaderTest, CsvBasic) {
                      {{1, 4}, {1, 4}});
 }
 
+// Lines longer than the simd block used to find the column separators
+TEST_F(EncloseCsvLineReaderTest, LongLines) {
+    std::string field(40, 'x');
+    std::string line = field + "," + field + ",\"" + field + "," + field + "\",a,b";
+    verify_csv_split(line + "\n" + line, "\n", ",", '"', '\\', false, {line, line},
+                     {{40, 81, 165, 167}, {40, 81, 165, 167}});
+
+    std::string short_fields;
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < 50; ++i) {
+        short_fields += "a,";
+        positions.push_back(2 * i + 1);
+    }
+    short_fields += "a";
+    verify_csv_split(short_fields, "\n", ",", '"', '\\', false, {short_fields}, {positions});
+}
+
 // Edge cases and corner scenarios
 TEST_F(EncloseCsvLineReaderTest, EdgeCases) {
     verify_csv_split("\n\na,b,c", "\n", ",", '"', '\\', false, {"", "", "a,b,c"}, {{}, {}, {1, 3}});
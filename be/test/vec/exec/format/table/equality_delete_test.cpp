@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/equality_delete.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/column_helper.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(EqualityDeleteTest, multi_columns) {
+    auto int_type = std::make_shared<DataTypeInt32>();
+    Block delete_block({ColumnWithTypeAndName(
+                                ColumnHelper::create_column<DataTypeInt32>({1, 2, 3, 3}), int_type,
+                                "a"),
+                        ColumnWithTypeAndName(
+                                ColumnHelper::create_column<DataTypeInt32>({10, 20, 30, 31}),
+                                int_type, "b")});
+    auto delete_impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    RuntimeProfile profile("test");
+    ASSERT_TRUE(delete_impl->init(&profile).ok());
+
+    Block data_block(
+            {ColumnWithTypeAndName(ColumnHelper::create_column<DataTypeInt32>({1, 1, 2, 3, 3, 4}),
+                                   int_type, "a"),
+             ColumnWithTypeAndName(
+                     ColumnHelper::create_column<DataTypeInt32>({10, 11, 20, 31, 32, 40}),
+                     int_type, "b"),
+             ColumnWithTypeAndName(ColumnHelper::create_column<DataTypeInt32>({0, 1, 2, 3, 4, 5}),
+                                   int_type, "id")});
+    ASSERT_TRUE(delete_impl->filter_data_block(&data_block).ok());
+    EXPECT_TRUE(ColumnHelper::column_equal(data_block.get_by_name("id").column,
+                                           ColumnHelper::create_column<DataTypeInt32>({1, 4, 5})));
+}
+
+} // namespace doris::vectorized
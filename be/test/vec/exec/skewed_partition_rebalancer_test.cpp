@@ -334,4 +334,34 @@ TEST_F(SkewedPartitionRebalancerTest, test_consider_skewed_partition_only_within
                                          get_partition_assignments(rebalancer.get())));
 }
 
+TEST_F(SkewedPartitionRebalancerTest, test_rebalance_with_partition_data_size) {
+    const int partitionCount = 3;
+    const int taskCount = 3;
+    const int taskBucketCount = 1;
+    const long MEGABYTE = 1024 * 1024;
+    const long MIN_PARTITION_DATA_PROCESSED_REBALANCE_THRESHOLD = 1 * MEGABYTE; // 1MB
+    const long MIN_DATA_PROCESSED_REBALANCE_THRESHOLD = 50 * MEGABYTE;          // 50MB
+
+    std::unique_ptr<SkewedPartitionRebalancer> rebalancer(
+            new SkewedPartitionRebalancer(partitionCount, taskCount, taskBucketCount,
+                                          MIN_PARTITION_DATA_PROCESSED_REBALANCE_THRESHOLD,
+                                          MIN_DATA_PROCESSED_REBALANCE_THRESHOLD));
+
+    // The row counts are even, but partition 0 has the long rows.
+    rebalancer->add_partition_row_count(0, 1000);
+    rebalancer->add_partition_row_count(1, 1000);
+    rebalancer->add_partition_row_count(2, 1000);
+    rebalancer->add_partition_data_size(0, 50 * MEGABYTE);
+    rebalancer->add_partition_data_size(1, 5 * MEGABYTE);
+    rebalancer->add_partition_data_size(2, 5 * MEGABYTE);
+
+    rebalancer->add_data_processed(60 * MEGABYTE);
+    rebalancer->rebalance();
+
+    // Partition 0 is scaled to task 1, then task 1 is skewed and partition 1 is scaled to task 2.
+    // Nothing is rebalanced if the data sizes are estimated by the row counts.
+    EXPECT_TRUE(_compare_vector_of_lists({{0, 1}, {1, 2}, {2}},
+                                         get_partition_assignments(rebalancer.get())));
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/split_source_connector.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+TEST(SplitSourceConnectorTest, split_large_ranges) {
+    auto old_size = config::file_scan_max_range_size;
+    config::file_scan_max_range_size = 100;
+
+    std::vector<TScanRangeParams> scan_ranges(1);
+    auto& ranges = scan_ranges[0].scan_range.ext_scan_range.file_scan_range.ranges;
+    TFileRangeDesc large;
+    large.__set_format_type(TFileFormatType::FORMAT_PARQUET);
+    large.__set_path("large");
+    large.__set_start_offset(4);
+    large.__set_size(350);
+    ranges.push_back(large);
+    TFileRangeDesc text = large;
+    text.__set_format_type(TFileFormatType::FORMAT_CSV_PLAIN);
+    text.__set_path("text");
+    ranges.push_back(text);
+
+    LocalSplitSourceConnector connector(scan_ranges, 16);
+    // the text range, and 3 sub ranges of the parquet range
+    EXPECT_EQ(4, connector.num_scan_ranges());
+    std::vector<TFileRangeDesc> got;
+    bool has_next = true;
+    while (true) {
+        TFileRangeDesc range;
+        ASSERT_TRUE(connector.get_next(&has_next, &range).ok());
+        if (!has_next) {
+            break;
+        }
+        got.push_back(range);
+    }
+    ASSERT_EQ(4, got.size());
+    EXPECT_EQ("text", got[0].path);
+    EXPECT_EQ(350, got[0].size);
+    EXPECT_EQ(4, got[1].start_offset);
+    EXPECT_EQ(100, got[1].size);
+    EXPECT_EQ(104, got[2].start_offset);
+    EXPECT_EQ(100, got[2].size);
+    EXPECT_EQ(204, got[3].start_offset);
+    EXPECT_EQ(150, got[3].size);
+
+    config::file_scan_max_range_size = old_size;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vectorized_fn_call.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/mock/mock_literal_expr.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+class VectorizedFnCallTest : public testing::Test {
+protected:
+    static std::shared_ptr<VectorizedFnCall> fn_call(const std::string& name,
+                                                     const VExprSPtrs& children) {
+        auto fn = std::make_shared<VectorizedFnCall>();
+        fn->_fn.name.function_name = name;
+        fn->_fn.binary_type = TFunctionBinaryType::BUILTIN;
+        fn->_function_name = name;
+        fn->_data_type = std::make_shared<DataTypeInt64>();
+        for (const auto& child : children) {
+            fn->add_child(child);
+        }
+        return fn;
+    }
+
+    static VExprSPtr slot(int column_id) {
+        return std::make_shared<MockSlotRef>(column_id, std::make_shared<DataTypeInt64>());
+    }
+};
+
+TEST_F(VectorizedFnCallTest, mark_common_exprs) {
+    // abs(c0) + 1, abs(c0) * abs(c1), random(c0) + random(c0)
+    auto abs0 = fn_call("abs", {slot(0)});
+    auto literal = std::make_shared<MockLiteral>(
+            ColumnHelper::create_column_with_name<DataTypeInt64>({1}));
+    auto add = fn_call("add", {abs0, literal});
+    auto abs0_2 = fn_call("abs", {slot(0)});
+    auto abs1 = fn_call("abs", {slot(1)});
+    auto multiply = fn_call("multiply", {abs0_2, abs1});
+    auto random0 = fn_call("random", {slot(0)});
+    auto random0_2 = fn_call("random", {slot(0)});
+    auto add_random = fn_call("add", {random0, random0_2});
+
+    VExprContextSPtrs ctxs {std::make_shared<VExprContext>(add),
+                            std::make_shared<VExprContext>(multiply),
+                            std::make_shared<VExprContext>(add_random)};
+    EXPECT_EQ(VectorizedFnCall::mark_common_exprs(ctxs), 1);
+    EXPECT_EQ(abs0->_common_expr_id, 0);
+    EXPECT_EQ(abs0_2->_common_expr_id, 0);
+    EXPECT_EQ(abs1->_common_expr_id, -1);
+    EXPECT_EQ(add->_common_expr_id, -1);
+    EXPECT_EQ(random0->_common_expr_id, -1);
+    EXPECT_EQ(random0_2->_common_expr_id, -1);
+
+    // the computed result of a common expr is reused
+    std::vector<int> common_expr_results {3};
+    ctxs[1]->set_common_expr_results(&common_expr_results);
+    Block block;
+    int result_column_id = -1;
+    EXPECT_TRUE(abs0_2->execute(ctxs[1].get(), &block, &result_column_id).ok());
+    EXPECT_EQ(result_column_id, 3);
+}
+
+} // namespace doris::vectorized
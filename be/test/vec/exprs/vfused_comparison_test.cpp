@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_comparison.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "testutil/column_helper.h"
+#include "testutil/mock/mock_fn_call.h"
+#include "testutil/mock/mock_literal_expr.h"
+#include "testutil/mock/mock_slot_ref.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+class VFusedComparisonTest : public testing::Test {
+protected:
+    static VExprSPtr fn_call(const std::string& name, TExprNodeType::type node_type,
+                             DataTypePtr data_type, VExprSPtr left, VExprSPtr right) {
+        auto fn = MockFnCall::create(name);
+        fn->_node_type = node_type;
+        fn->_data_type = std::move(data_type);
+        fn->add_child(std::move(left));
+        fn->add_child(std::move(right));
+        return fn;
+    }
+
+    static constexpr size_t ROWS = 600;
+};
+
+TEST_F(VFusedComparisonTest, double_arithmetic) {
+    std::vector<double> a, b, c;
+    std::vector<uint8_t> c_nulls;
+    for (size_t i = 0; i < ROWS; ++i) {
+        a.push_back(double(i % 17) - 8);
+        b.push_back(double(i % 5) * 0.5);
+        c.push_back(double(i % 11));
+        c_nulls.push_back(i % 7 == 0);
+    }
+    Block block {ColumnHelper::create_column_with_name<DataTypeFloat64>(a),
+                 ColumnHelper::create_column_with_name<DataTypeFloat64>(b),
+                 ColumnHelper::create_nullable_column_with_name<DataTypeFloat64>(c, c_nulls)};
+
+    // a * b + c > 5.5
+    auto float64 = std::make_shared<DataTypeFloat64>();
+    auto nullable_float64 = std::make_shared<DataTypeNullable>(float64);
+    auto multiply =
+            fn_call("multiply", TExprNodeType::ARITHMETIC_EXPR, float64,
+                    std::make_shared<MockSlotRef>(0, float64),
+                    std::make_shared<MockSlotRef>(1, float64));
+    auto add = fn_call("add", TExprNodeType::ARITHMETIC_EXPR, nullable_float64, multiply,
+                       std::make_shared<MockSlotRef>(2, nullable_float64));
+    auto gt = fn_call("gt", TExprNodeType::BINARY_PRED,
+                      std::make_shared<DataTypeNullable>(std::make_shared<DataTypeUInt8>()), add,
+                      std::make_shared<MockLiteral>(
+                              ColumnHelper::create_column_with_name<DataTypeFloat64>({5.5})));
+
+    auto fused = VFusedComparison::create(*gt);
+    ASSERT_NE(fused, nullptr);
+    ColumnPtr result;
+    ASSERT_TRUE(fused->execute(block, &result));
+    ASSERT_EQ(result->size(), ROWS);
+    const auto& nullable = assert_cast<const ColumnNullable&>(*result);
+    const auto& data = assert_cast<const ColumnUInt8&>(nullable.get_nested_column()).get_data();
+    for (size_t i = 0; i < ROWS; ++i) {
+        EXPECT_EQ(nullable.is_null_at(i), c_nulls[i]) << i;
+        if (!c_nulls[i]) {
+            EXPECT_EQ(data[i], a[i] * b[i] + c[i] > 5.5) << i;
+        }
+    }
+}
+
+TEST_F(VFusedComparisonTest, bigint_arithmetic) {
+    std::vector<int64_t> a, b;
+    for (size_t i = 0; i < ROWS; ++i) {
+        a.push_back(int64_t(i) * 3);
+        b.push_back(int64_t(i % 13) * 100);
+    }
+    Block block {ColumnHelper::create_column_with_name<DataTypeInt64>(a),
+                 ColumnHelper::create_column_with_name<DataTypeInt64>(b)};
+
+    // 1000 - a <= b - a * 2
+    auto int64 = std::make_shared<DataTypeInt64>();
+    auto left = fn_call(
+            "subtract", TExprNodeType::ARITHMETIC_EXPR, int64,
+            std::make_shared<MockLiteral>(
+                    ColumnHelper::create_column_with_name<DataTypeInt64>({1000})),
+            std::make_shared<MockSlotRef>(0, int64));
+    auto multiply = fn_call(
+            "multiply", TExprNodeType::ARITHMETIC_EXPR, int64,
+            std::make_shared<MockSlotRef>(0, int64),
+            std::make_shared<MockLiteral>(ColumnHelper::create_column_with_name<DataTypeInt64>({2})));
+    auto right = fn_call("subtract", TExprNodeType::ARITHMETIC_EXPR, int64,
+                         std::make_shared<MockSlotRef>(1, int64), multiply);
+    auto le = fn_call("le", TExprNodeType::BINARY_PRED, std::make_shared<DataTypeUInt8>(), left,
+                      right);
+
+    auto fused = VFusedComparison::create(*le);
+    ASSERT_NE(fused, nullptr);
+    ColumnPtr result;
+    ASSERT_TRUE(fused->execute(block, &result));
+    const auto& data = assert_cast<const ColumnUInt8&>(*result).get_data();
+    for (size_t i = 0; i < ROWS; ++i) {
+        EXPECT_EQ(data[i], 1000 - a[i] <= b[i] - a[i] * 2) << i;
+    }
+
+    // a nullable column is not expected by a not nullable comparison
+    Block nullable_block {ColumnHelper::create_nullable_column_with_name<DataTypeInt64>(
+                                  a, std::vector<uint8_t>(ROWS, 0)),
+                          ColumnHelper::create_column_with_name<DataTypeInt64>(b)};
+    EXPECT_FALSE(fused->execute(nullable_block, &result));
+}
+
+TEST_F(VFusedComparisonTest, not_fused) {
+    auto int64 = std::make_shared<DataTypeInt64>();
+    auto uint8 = std::make_shared<DataTypeUInt8>();
+    auto literal = std::make_shared<MockLiteral>(
+            ColumnHelper::create_column_with_name<DataTypeInt64>({1}));
+
+    // no arithmetic
+    auto gt = fn_call("gt", TExprNodeType::BINARY_PRED, uint8,
+                      std::make_shared<MockSlotRef>(0, int64), literal);
+    EXPECT_EQ(VFusedComparison::create(*gt), nullptr);
+
+    // divide is not fused
+    auto divide = fn_call("int_divide", TExprNodeType::ARITHMETIC_EXPR, int64,
+                          std::make_shared<MockSlotRef>(0, int64), literal);
+    auto eq = fn_call("eq", TExprNodeType::BINARY_PRED, uint8, divide, literal);
+    EXPECT_EQ(VFusedComparison::create(*eq), nullptr);
+
+    // int is not fused
+    auto int32 = std::make_shared<DataTypeInt32>();
+    auto add = fn_call("add", TExprNodeType::ARITHMETIC_EXPR, int32,
+                       std::make_shared<MockSlotRef>(0, int32),
+                       std::make_shared<MockSlotRef>(1, int32));
+    auto lt = fn_call("lt", TExprNodeType::BINARY_PRED, uint8, add,
+                      std::make_shared<MockSlotRef>(2, int32));
+    EXPECT_EQ(VFusedComparison::create(*lt), nullptr);
+}
+
+} // namespace doris::vectorized
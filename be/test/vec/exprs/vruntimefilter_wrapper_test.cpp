@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vruntimefilter_wrapper.h"
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace doris::vectorized {
+
+TEST(VRuntimeFilterWrapperTest, judge_selectivity_by_window) {
+    auto window_rows = config::runtime_filter_selectivity_window_rows;
+    Defer defer {[&]() { config::runtime_filter_selectivity_window_rows = window_rows; }};
+    config::runtime_filter_selectivity_window_rows = 1000;
+
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::BLOOM_PRED);
+    TTypeNode type_node;
+    type_node.__set_type(TTypeNodeType::SCALAR);
+    TScalarType scalar_type;
+    scalar_type.__set_type(TPrimitiveType::BOOLEAN);
+    type_node.__set_scalar_type(scalar_type);
+    TTypeDesc type_desc;
+    type_desc.types.push_back(type_node);
+    node.__set_type(type_desc);
+    VRuntimeFilterWrapper wrapper(node, nullptr, 0.4, false, 1);
+    auto disabled_times = std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0);
+    wrapper.attach_profile_counter(std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0),
+                                   std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0),
+                                   std::make_shared<RuntimeProfile::Counter>(TUnit::UNIT, 0),
+                                   disabled_times);
+
+    // a small block filtering nothing does not decide the selectivity
+    wrapper.do_judge_selectivity(0, 100);
+    EXPECT_FALSE(wrapper._always_true);
+
+    // a selective window
+    wrapper.do_judge_selectivity(800, 900);
+    EXPECT_FALSE(wrapper._always_true);
+
+    // the earlier selective window does not hide that the filter stops filtering
+    wrapper.do_judge_selectivity(100, 1000);
+    EXPECT_TRUE(wrapper._always_true);
+    EXPECT_EQ(disabled_times->value(), 1);
+}
+
+} // namespace doris::vectorized
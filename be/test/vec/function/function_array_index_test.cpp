@@ -203,6 +203,24 @@ TEST(function_array_index_test, array_position) {
         static_cast<void>(check_function<DataTypeInt64, true>(func_name, input_types, data_set));
     }
 
+    // array_position(Array<Int32>, Int32) with the arrays longer than a chunk of comparisons
+    {
+        InputTypeSet input_types = {PrimitiveType::TYPE_ARRAY, PrimitiveType::TYPE_INT,
+                                    PrimitiveType::TYPE_INT};
+
+        TestArray vec;
+        for (int i = 1; i <= 40; ++i) {
+            vec.push_back(Int32(i));
+        }
+        DataSet data_set = {{{vec, Int32(1)}, Int64(1)},
+                            {{vec, Int32(16)}, Int64(16)},
+                            {{vec, Int32(17)}, Int64(17)},
+                            {{vec, Int32(35)}, Int64(35)},
+                            {{vec, Int32(41)}, Int64(0)}};
+
+        static_cast<void>(check_function<DataTypeInt64, true>(func_name, input_types, data_set));
+    }
+
     // array_position(Array<Int8>, Int8)
     {
         InputTypeSet input_types = {PrimitiveType::TYPE_ARRAY, PrimitiveType::TYPE_TINYINT,
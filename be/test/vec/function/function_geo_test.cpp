@@ -288,6 +288,7 @@ TEST(VGeoFunctionsTest, function_geo_st_contains) {
 
     DataSet data_set = {{{buf1, buf2}, (uint8_t)1},
                         {{buf1, buf3}, (uint8_t)0},
+                        {{buf1, buf2}, (uint8_t)1},
                         {{buf1, Null()}, Null()},
                         {{Null(), buf3}, Null()}};
     {
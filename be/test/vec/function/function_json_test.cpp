@@ -156,4 +156,34 @@ TEST(FunctionJsonTEST, JsonExtractTest) {
                                                            data_set));
 }
 
+TEST(FunctionJsonTEST, JsonExtractMultiPathTest) {
+    std::string func_name = "json_extract";
+    // the document of a row is parsed once for all the paths
+    DataSet data_set = {
+            {{STRING(R"({"k1": "v1", "k2": {"k21": 6.6}})"), STRING("$.k1"), STRING("$.k2.k21")},
+             STRING(R"(["v1",6.6])")},
+            {{STRING(R"({"k1": "v1", "k2": {"k21": 6.6}})"), STRING("$.k1"), STRING("$.k3")},
+             STRING(R"(["v1"])")},
+            {{STRING(R"({"k1": "v1", "k2": {"k21": 6.6}})"), STRING("$.k3"), STRING("$.k4")},
+             Null()},
+            {{STRING(R"({"a": [1, 2]})"), STRING("$.a[*]"), STRING("$.a[1]")},
+             STRING(R"([[1,2],2])")},
+            {{STRING(R"({"a": [1, 2]})"), STRING("$.a"), STRING("$.a\\")}, STRING(R"([[1,2]])")},
+            {{STRING("not json"), STRING("$.k1"), STRING("$.k2")}, Null()},
+            {{Null(), STRING("$.k1"), STRING("$.k2")}, Null()}};
+
+    InputTypeSet input_types = {PrimitiveType::TYPE_VARCHAR, PrimitiveType::TYPE_VARCHAR,
+                                PrimitiveType::TYPE_VARCHAR};
+    static_cast<void>(check_function<DataTypeString, true>(func_name, input_types, data_set));
+
+    InputTypeSet const_path_input_types = {PrimitiveType::TYPE_VARCHAR,
+                                           Consted {PrimitiveType::TYPE_VARCHAR},
+                                           Consted {PrimitiveType::TYPE_VARCHAR}};
+    for (const auto& line : data_set) {
+        DataSet const_path_data_set = {line};
+        static_cast<void>(check_function<DataTypeString, true>(func_name, const_path_input_types,
+                                                               const_path_data_set));
+    }
+}
+
 } // namespace doris::vectorized
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "function_test_util.h"
@@ -25,6 +26,7 @@
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
+#include "vec/functions/like.h"
 
 namespace doris::vectorized {
 
@@ -96,6 +98,65 @@ TEST(FunctionLikeTest, like) {
             func_name, const_pattern_input_types, data_set));
 }
 
+TEST(FunctionLikeTest, required_literal) {
+    EXPECT_EQ(FunctionLike::required_literal("%error%timeout%"), "timeout");
+    EXPECT_EQ(FunctionLike::required_literal("a_c%"), "a");
+    EXPECT_EQ(FunctionLike::required_literal("%ab\\%cd%e"), "ab%cd");
+    EXPECT_EQ(FunctionLike::required_literal("%_\\b\\b%"), "\\b\\b");
+    EXPECT_EQ(FunctionLike::required_literal("%_%"), "");
+
+    EXPECT_EQ(FunctionRegexpLike::required_literal("error.*timeout"), "timeout");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("^errors?: [0-9]+ timeouts"), " timeouts");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("ab{2,3}c\\d+xy*"), "a");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("[]abc]de"), "de");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("error|timeout"), "");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("(?i)timeout"), "");
+    EXPECT_EQ(FunctionRegexpLike::required_literal("x[[:digit:]]yz"), "");
+}
+
+TEST(FunctionLikeTest, like_with_required_literal) {
+    // `timeout` of the second and third rows crosses the boundary of the rows, and the fourth row
+    // only contains the literal
+    auto values = ColumnString::create();
+    for (const auto* value : {"error: read timeout", "errortime", "out", "timeout error", "",
+                              "error timeout"}) {
+        values->insert_data(value, strlen(value));
+    }
+    for (bool try_hyperscan : {true, false}) {
+        auto state = std::make_shared<LikeState>();
+        std::string pattern = "%error%timeout%";
+        EXPECT_TRUE(FunctionLike::construct_like_const_state(nullptr, StringRef(pattern), state,
+                                                             try_hyperscan)
+                            .ok());
+        EXPECT_EQ(state->search_state.prefilter_string, "timeout");
+
+        ColumnUInt8::Container result(values->size(), 0);
+        EXPECT_TRUE(state->function(&state->search_state, *values, StringRef(pattern), result).ok());
+        EXPECT_EQ(result, ColumnUInt8::Container({1, 0, 0, 0, 0, 1}));
+
+        for (size_t i = 0; i < values->size(); ++i) {
+            unsigned char row_result = 0;
+            EXPECT_TRUE(state->scalar_function(&state->search_state, values->get_data_at(i),
+                                               StringRef(pattern), &row_result)
+                                .ok());
+            EXPECT_EQ(row_result, result[i]);
+        }
+    }
+
+    DataSet data_set = {
+            {{std::string("error 42 timeout"), std::string("error [0-9]+ timeout")}, uint8_t(1)},
+            {{std::string("error 42 time"), std::string("error [0-9]+ timeout")}, uint8_t(0)},
+            {{std::string("timeout error 4"), std::string("error [0-9]+ timeout")}, uint8_t(0)},
+            {{std::string("error x timeout"), std::string("error [0-9]+ timeout")}, uint8_t(0)}};
+    InputTypeSet const_pattern_input_types = {PrimitiveType::TYPE_VARCHAR,
+                                              Consted {PrimitiveType::TYPE_VARCHAR}};
+    for (const auto& line : data_set) {
+        DataSet const_pattern_dataset = {line};
+        static_cast<void>(check_function<DataTypeUInt8, true>("regexp", const_pattern_input_types,
+                                                              const_pattern_dataset));
+    }
+}
+
 TEST(FunctionLikeTest, regexp) {
     std::string func_name = "regexp";
 
@@ -542,6 +542,81 @@ TEST_F(VerticalCompactionTest, TestDupKeyVerticalMerge) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestDupKeyVerticalMergeDisjointRowsets) {
+    auto num_input_rowset = 3;
+    auto num_segments = 2;
+    auto rows_per_segment = 10 * 1024;
+    // the keys of the rowsets don't overlap, and the later rowsets have the smaller keys, so the
+    // rows of each source are merged in long runs
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(num_input_rowset, num_segments, rows_per_segment, NONOVERLAPPING,
+                        input_data);
+    int64_t rowset_rows = num_segments * rows_per_segment;
+    for (auto rs_id = 0; rs_id < num_input_rowset; rs_id++) {
+        for (auto& segment_data : input_data[rs_id]) {
+            for (auto& row : segment_data) {
+                std::get<0>(row) += (num_input_rowset - 1 - rs_id) * rowset_rows;
+            }
+        }
+    }
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    std::vector<RowsetSharedPtr> input_rowsets;
+    std::vector<RowsetReaderSharedPtr> input_rs_readers;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        RowsetSharedPtr rowset = create_rowset(tablet_schema, NONOVERLAPPING, input_data[i], i);
+        input_rowsets.push_back(rowset);
+        RowsetReaderSharedPtr rs_reader;
+        ASSERT_TRUE(rowset->create_reader(&rs_reader).ok());
+        input_rs_readers.push_back(std::move(rs_reader));
+    }
+
+    auto writer_context = create_rowset_writer_context(tablet_schema, NONOVERLAPPING, 3456,
+                                                       {0, input_rowsets.back()->end_version()});
+    auto res = RowsetFactory::create_rowset_writer(*engine_ref, writer_context, true);
+    ASSERT_TRUE(res.has_value()) << res.error();
+    auto output_rs_writer = std::move(res).value();
+
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false);
+    Merger::Statistics stats;
+    RowIdConversion rowid_conversion;
+    stats.rowid_conversion = &rowid_conversion;
+    auto s = Merger::vertical_merge_rowsets(tablet, ReaderType::READER_BASE_COMPACTION,
+                                            *tablet_schema, input_rs_readers,
+                                            output_rs_writer.get(), 100, num_segments, &stats);
+    ASSERT_TRUE(s.ok()) << s;
+    RowsetSharedPtr out_rowset;
+    EXPECT_EQ(Status::OK(), output_rs_writer->build(out_rowset));
+    ASSERT_TRUE(out_rowset);
+
+    RowsetReaderContext reader_context;
+    reader_context.tablet_schema = tablet_schema;
+    reader_context.need_ordered_result = false;
+    std::vector<uint32_t> return_columns = {0, 1};
+    reader_context.return_columns = &return_columns;
+    RowsetReaderSharedPtr output_rs_reader;
+    create_and_init_rowset_reader(out_rowset.get(), reader_context, &output_rs_reader);
+
+    vectorized::Block output_block;
+    std::vector<std::tuple<int64_t, int64_t>> output_data;
+    do {
+        block_create(tablet_schema, &output_block);
+        s = output_rs_reader->next_block(&output_block);
+        auto columns = output_block.get_columns_with_type_and_name();
+        EXPECT_EQ(columns.size(), 2);
+        for (auto i = 0; i < output_block.rows(); i++) {
+            output_data.emplace_back(columns[0].column->get_int(i), columns[1].column->get_int(i));
+        }
+    } while (s == Status::OK());
+    EXPECT_EQ(Status::Error<END_OF_FILE>(""), s);
+    ASSERT_EQ(output_data.size(), num_input_rowset * rowset_rows);
+    for (int64_t id = 0; id < output_data.size(); id++) {
+        // the value column is generated from the key before it's shifted
+        EXPECT_EQ(id, std::get<0>(output_data[id]));
+        EXPECT_EQ(id % rowset_rows + 1, std::get<1>(output_data[id]));
+    }
+}
+
 TEST_F(VerticalCompactionTest, TestDupWithoutKeyVerticalMerge) {
     auto num_input_rowset = 2;
     auto num_segments = 2;
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_slot_ref.h"
 #include "vec/data_types/data_type_nullable.h"
@@ -485,4 +487,143 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
+TEST(SortMergerTest, MANY_RUNS_INTERLEAVED) {
+    /**
+     * in: run i of 7 runs returns the blocks [i, i + 7 * 1, ..., i + 7 * 4] and
+     *     [i + 7 * 5, ..., i + 7 * 9], then eos
+     *     offset = 3, limit = -1, ASC
+     * out: [3, 4, ..., 69]
+     */
+    const int num_children = 7;
+    const int batch_size = 8;
+    const int rows_per_block = 5;
+    const int num_round = 2;
+    std::vector<int> round;
+    round.resize(num_children, 0);
+
+    std::unique_ptr<VSortedRunMerger> merger;
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    {
+        std::vector<bool> is_asc_order = {true};
+        std::vector<bool> nulls_first = {false};
+        const int limit = -1;
+        const int offset = 3;
+        merger.reset(new VSortedRunMerger(ordering_expr, is_asc_order, nulls_first, batch_size,
+                                          limit, offset, profile.get()));
+    }
+    {
+        std::vector<vectorized::BlockSupplier> child_block_suppliers;
+        for (int child_idx = 0; child_idx < num_children; child_idx++) {
+            vectorized::BlockSupplier block_supplier =
+                    [&, round_vec = &round, id = child_idx](vectorized::Block* block, bool* eos) {
+                        int block_round = (*round_vec)[id]++;
+                        *eos = block_round == num_round;
+                        if (*eos) {
+                            return Status::OK();
+                        }
+                        std::vector<int64_t> data;
+                        for (int i = 0; i < rows_per_block; ++i) {
+                            data.push_back(id + num_children * (block_round * rows_per_block + i));
+                        }
+                        *block = ColumnHelper::create_block<DataTypeInt64>(data);
+                        return Status::OK();
+                    };
+            child_block_suppliers.push_back(block_supplier);
+        }
+        EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
+    }
+    {
+        std::vector<int64_t> merged;
+        bool eos = false;
+        while (!eos) {
+            vectorized::Block block;
+            EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+            EXPECT_LE(block.rows(), static_cast<size_t>(batch_size));
+            if (block.rows() == 0) {
+                continue;
+            }
+            const auto& column =
+                    assert_cast<const ColumnInt64&>(*block.get_by_position(0).column);
+            merged.insert(merged.end(), column.get_data().begin(), column.get_data().end());
+        }
+        const int total_rows = num_children * rows_per_block * num_round;
+        ASSERT_EQ(merged.size(), static_cast<size_t>(total_rows - 3));
+        for (size_t i = 0; i < merged.size(); ++i) {
+            EXPECT_EQ(merged[i], static_cast<int64_t>(i) + 3);
+        }
+    }
+}
+
+TEST(SortMergerTest, MANY_RUNS_DISJOINT) {
+    /**
+     * in: run i of 5 runs returns the blocks [100 * i, ..., 100 * i + 29] and
+     *     [100 * i + 30, ..., 100 * i + 59], except that run 2 overlaps run 1 with the values
+     *     [100 + 50, ..., 100 + 109], then eos
+     *     offset = 0, limit = -1, ASC
+     * out: all the values in order, the whole runs are taken at once
+     */
+    const int num_children = 5;
+    const int batch_size = 16;
+    const int rows_per_block = 30;
+    const int num_round = 2;
+    std::vector<int> round;
+    round.resize(num_children, 0);
+    auto first_value = [](int id) { return id == 2 ? 150 : 100 * id; };
+
+    std::unique_ptr<VSortedRunMerger> merger;
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    {
+        std::vector<bool> is_asc_order = {true};
+        std::vector<bool> nulls_first = {false};
+        merger.reset(new VSortedRunMerger(ordering_expr, is_asc_order, nulls_first, batch_size,
+                                          -1, 0, profile.get()));
+    }
+    {
+        std::vector<vectorized::BlockSupplier> child_block_suppliers;
+        for (int child_idx = 0; child_idx < num_children; child_idx++) {
+            vectorized::BlockSupplier block_supplier =
+                    [&, round_vec = &round, id = child_idx](vectorized::Block* block, bool* eos) {
+                        int block_round = (*round_vec)[id]++;
+                        *eos = block_round == num_round;
+                        if (*eos) {
+                            return Status::OK();
+                        }
+                        std::vector<int64_t> data;
+                        for (int i = 0; i < rows_per_block; ++i) {
+                            data.push_back(first_value(id) + block_round * rows_per_block + i);
+                        }
+                        *block = ColumnHelper::create_block<DataTypeInt64>(data);
+                        return Status::OK();
+                    };
+            child_block_suppliers.push_back(block_supplier);
+        }
+        EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
+    }
+    {
+        std::vector<int64_t> merged;
+        bool eos = false;
+        while (!eos) {
+            vectorized::Block block;
+            EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+            EXPECT_LE(block.rows(), static_cast<size_t>(batch_size));
+            if (block.rows() == 0) {
+                continue;
+            }
+            const auto& column =
+                    assert_cast<const ColumnInt64&>(*block.get_by_position(0).column);
+            merged.insert(merged.end(), column.get_data().begin(), column.get_data().end());
+        }
+        std::vector<int64_t> expected;
+        for (int id = 0; id < num_children; ++id) {
+            for (int i = 0; i < rows_per_block * num_round; ++i) {
+                expected.push_back(first_value(id) + i);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(expected, merged);
+    }
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
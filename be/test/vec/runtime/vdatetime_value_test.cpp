@@ -675,6 +675,55 @@ TEST(VDateTimeValueTest, date_v2_from_date_format_str_with_all_space) {
     }
 }
 
+TEST(VDateTimeValueTest, datetime_v2_from_fixed_format_date_str) {
+    auto from_str = [](DateV2Value<DateTimeV2ValueType>& value, const std::string& str, int scale,
+                       bool convert_zero = false) {
+        return value.from_date_str(str.data(), int(str.size()), scale, convert_zero);
+    };
+    auto fast_path = [](DateV2Value<DateTimeV2ValueType>& value, const std::string& str,
+                        int scale) {
+        return value.from_fixed_format_date_str(str.data(), int(str.size()), scale);
+    };
+    DateV2Value<DateTimeV2ValueType> value;
+
+    EXPECT_TRUE(fast_path(value, "2024-02-29 23:59:58.123", 6));
+    EXPECT_EQ(value.year(), 2024);
+    EXPECT_EQ(value.month(), 2);
+    EXPECT_EQ(value.day(), 29);
+    EXPECT_EQ(value.hour(), 23);
+    EXPECT_EQ(value.minute(), 59);
+    EXPECT_EQ(value.second(), 58);
+    EXPECT_EQ(value.microsecond(), 123000);
+    EXPECT_TRUE(fast_path(value, "2024-02-29T01:02:03", -1));
+    EXPECT_EQ(value.hour(), 1);
+    EXPECT_EQ(value.microsecond(), 0);
+    EXPECT_TRUE(fast_path(value, "2024-02-29", 0));
+    EXPECT_EQ(value.hour(), 0);
+
+    // the other formats and the invalid dates are parsed by the general path
+    EXPECT_FALSE(fast_path(value, "2024-02-29 23:59:58.125", 2));
+    EXPECT_TRUE(from_str(value, "2024-02-29 23:59:58.125", 2));
+    EXPECT_EQ(value.microsecond(), 130000);
+    EXPECT_FALSE(fast_path(value, " 2024-02-29", 0));
+    EXPECT_TRUE(from_str(value, " 2024-02-29", 0));
+    EXPECT_EQ(value.day(), 29);
+    EXPECT_FALSE(fast_path(value, "2024/02/29", 0));
+    EXPECT_TRUE(from_str(value, "2024/02/29", 0));
+    EXPECT_EQ(value.day(), 29);
+    EXPECT_FALSE(fast_path(value, "0000-00-00", 0));
+    EXPECT_TRUE(from_str(value, "0000-00-00", 0, true));
+    EXPECT_EQ(value.month(), 1);
+    EXPECT_FALSE(fast_path(value, "2023-02-29 00:00:00", 0));
+    EXPECT_FALSE(from_str(value, "2023-02-29 00:00:00", 0));
+    EXPECT_FALSE(fast_path(value, "2023-01-01 24:00:00", 0));
+    EXPECT_FALSE(from_str(value, "2023-01-01 24:00:00", 0));
+
+    DateV2Value<DateV2ValueType> date;
+    EXPECT_FALSE(date.from_fixed_format_date_str("2024-02-29 23:59:58.1", 21, 6));
+    EXPECT_TRUE(date.from_fixed_format_date_str("2024-02-29 23:59:58", 19, 0));
+    EXPECT_EQ(date.day(), 29);
+}
+
 TEST(VDateTimeValueTest, datetime_diff_test) {
     // Test case 1: DATE to DATE - Different years, months, days
     {
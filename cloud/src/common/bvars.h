@@ -254,6 +254,8 @@ extern BvarLatencyRecorderWithTag g_bvar_ms_check_kv;
 extern BvarLatencyRecorderWithTag g_bvar_ms_get_schema_dict;
 extern bvar::Adder<int64_t> g_bvar_update_delete_bitmap_fail_counter;
 extern bvar::Adder<int64_t> g_bvar_get_delete_bitmap_fail_counter;
+extern bvar::Adder<int64_t> g_bvar_ms_schema_cache_hit;
+extern bvar::Adder<int64_t> g_bvar_ms_schema_cache_miss;
 
 // recycler's bvars
 extern BvarStatusWithTag<int64_t> g_bvar_recycler_recycle_index_earlest_ts;
@@ -274,6 +276,8 @@ extern mBvarStatus<int64_t> g_bvar_recycler_instance_recycle_last_success_ts;
 
 extern mBvarIntAdder g_bvar_recycler_vault_recycle_status;
 extern mBvarIntAdder g_bvar_recycler_vault_recycle_task_concurrency;
+extern mBvarInt64Adder g_bvar_recycler_vault_deleted_files_num;
+extern mBvarInt64Adder g_bvar_recycler_vault_delete_files_cost_us;
 extern mBvarStatus<int64_t> g_bvar_recycler_instance_last_round_recycled_num;
 extern mBvarStatus<int64_t> g_bvar_recycler_instance_last_round_to_recycle_num;
 extern mBvarStatus<int64_t> g_bvar_recycler_instance_last_round_recycled_bytes;
@@ -302,6 +306,7 @@ extern bvar::LatencyRecorder g_bvar_txn_kv_batch_get;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_get_count_normalized;
+extern bvar::Status<int64_t> g_bvar_rate_limiter_txn_kv_overloaded;
 
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_put_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_remove_conflict_by_fail_counter;
@@ -95,6 +95,11 @@ CONF_Bool(enable_checker, "false");
 // The parallelism for parallel recycle operation
 // s3_producer_pool recycle_tablet_pool, delete single object in this pool
 CONF_Int32(recycle_pool_parallelism, "40");
+// Max number of files of the rowsets deleted by a request to the object storage, the files of a
+// rowset are always deleted by the same request
+CONF_mInt32(recycle_delete_files_batch_size, "1000");
+// Max number of the requests deleting the rowset files of a vault in parallel
+CONF_mInt32(recycle_delete_files_parallelism_per_vault, "8");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
 // Currently only used for recycler test
@@ -155,6 +160,16 @@ CONF_Int64(default_max_qps_limit, "1000000");
 CONF_String(specific_max_qps_limit, "get_cluster:5000000;begin_txn:5000000");
 CONF_Bool(enable_rate_limit, "true");
 CONF_Int64(bvar_qps_update_second, "5");
+// Adapt the qps limits of the low priority rpcs of each instance to the load of the txn kv, in the
+// style of AIMD: the limit is halved from the current qps when the txn kv is overloaded, and
+// increased by `adaptive_rate_limit_qps_increase` each `bvar_qps_update_second` otherwise
+CONF_mBool(enable_adaptive_rate_limit, "false");
+CONF_String(low_priority_rpc_names, "start_tablet_job;finish_tablet_job");
+// the txn kv is overloaded if the avg commit latency or the conflicts exceed these thresholds
+CONF_mInt64(adaptive_rate_limit_txn_kv_commit_latency_us, "500000");
+CONF_mInt64(adaptive_rate_limit_txn_kv_conflicts_per_second, "100");
+CONF_mInt64(adaptive_rate_limit_qps_increase, "100");
+CONF_mInt64(adaptive_rate_limit_min_qps, "10");
 
 CONF_mInt32(copy_job_max_retention_second, "259200"); //3 * 24 * 3600 seconds
 CONF_String(arn_id, "");
@@ -279,6 +294,8 @@ CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
+// threads to commit the partitions of a lazy committed txn in parallel
+CONF_Int32(txn_lazy_commit_partition_num_threads, "16");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
 
@@ -341,4 +358,7 @@ CONF_mString(ca_cert_file_paths,
 CONF_Bool(enable_split_rowset_meta_pb, "false");
 CONF_Int32(split_rowset_meta_pb_size, "10000"); // split rowset meta pb size, default is 10K
 
+// Max number of the schema kvs cached by get_rowset, 0 to disable the cache
+CONF_mInt64(schema_cache_capacity, "10000");
+
 } // namespace doris::cloud::config
@@ -1668,9 +1668,13 @@ std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt,
     return versions;
 }
 
-static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rowset_meta,
-                                       const std::string& key, MetaServiceCode& code,
-                                       std::string& msg) {
+static bool try_fetch_and_parse_schema(Transaction* txn, SchemaCache* schema_cache,
+                                       RowsetMetaCloudPB& rowset_meta, const std::string& key,
+                                       MetaServiceCode& code, std::string& msg) {
+    if (auto cached = schema_cache->get(key); cached != nullptr) {
+        rowset_meta.mutable_tablet_schema()->CopyFrom(*cached);
+        return true;
+    }
     ValueBuf val_buf;
     TxnErrorCode err = cloud::blob_get(txn, key, &val_buf);
     if (err != TxnErrorCode::TXN_OK) {
@@ -1686,6 +1690,7 @@ static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rows
         msg = fmt::format("malformed schema value, key={}", key);
         return false;
     }
+    schema_cache->put(key, std::make_shared<doris::TabletSchemaCloudPB>(*schema));
     return true;
 }
 
@@ -1861,7 +1866,8 @@ void MetaServiceImpl::get_rowset(::google::protobuf::RpcController* controller,
             } else {
                 auto key = meta_schema_key(
                         {instance_id, idx.index_id(), rowset_meta.schema_version()});
-                if (!try_fetch_and_parse_schema(txn.get(), rowset_meta, key, code, msg)) {
+                if (!try_fetch_and_parse_schema(txn.get(), &schema_cache_, rowset_meta, key,
+                                                code, msg)) {
                     return;
                 }
                 version_to_schema.emplace(rowset_meta.schema_version(),
@@ -31,6 +31,7 @@
 #include "common/stats.h"
 #include "cpp/sync_point.h"
 #include "meta-service/delete_bitmap_lock_white_list.h"
+#include "meta-service/meta_service_schema.h"
 #include "meta-service/txn_lazy_committer.h"
 #include "meta-store/txn_kv.h"
 #include "rate-limiter/rate_limiter.h"
@@ -398,6 +399,7 @@ private:
     std::shared_ptr<TxnKv> txn_kv_;
     std::shared_ptr<ResourceManager> resource_mgr_;
     std::shared_ptr<RateLimiter> rate_limiter_;
+    SchemaCache schema_cache_;
     std::shared_ptr<TxnLazyCommitter> txn_lazy_committer_;
     std::shared_ptr<DeleteBitmapLockWhiteList> delete_bitmap_lock_white_list_;
 };
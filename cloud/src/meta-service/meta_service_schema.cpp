@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "common/bvars.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/util.h"
@@ -131,6 +132,35 @@ bool parse_schema_value(const ValueBuf& buf, doris::TabletSchemaCloudPB* schema)
     // TODO(plat1ko): Apply decompression based on value version
     return buf.to_pb(schema);
 }
+
+std::shared_ptr<const doris::TabletSchemaCloudPB> SchemaCache::get(const std::string& schema_key) {
+    std::lock_guard lock(mtx_);
+    auto it = map_.find(schema_key);
+    if (it == map_.end()) {
+        g_bvar_ms_schema_cache_miss << 1;
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    g_bvar_ms_schema_cache_hit << 1;
+    return it->second->second;
+}
+
+void SchemaCache::put(const std::string& schema_key,
+                      std::shared_ptr<const doris::TabletSchemaCloudPB> schema) {
+    int64_t capacity = config::schema_cache_capacity;
+    std::lock_guard lock(mtx_);
+    if (auto it = map_.find(schema_key); it != map_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+    } else if (capacity > 0) {
+        lru_.emplace_front(schema_key, std::move(schema));
+        map_.emplace(schema_key, lru_.begin());
+    }
+    // capacity may be decreased at runtime
+    while (!lru_.empty() && static_cast<int64_t>(lru_.size()) > capacity) {
+        map_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
 /**
  * Processes dictionary items, mapping them to a dictionary key and adding the key to rowset meta.
  * If it's a new item, generates a new key and increments the item ID. This function is also responsible
@@ -20,6 +20,12 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace doris::cloud {
 class Transaction;
 struct ValueBuf;
@@ -41,4 +47,24 @@ void read_schema_dict(MetaServiceCode& code, std::string& msg, const std::string
                       SchemaCloudDictionary* rsp_dict,
                       GetRowsetRequest::SchemaOp schema_op = GetRowsetRequest::FILL_WITH_DICT);
 
+// Caches the parsed schema kvs. A schema kv is written once and never updated (see
+// `put_schema_kv`), so a cached schema is valid as long as its key is, no version check is needed.
+// The least recently used schemas are evicted when there are more than
+// `config::schema_cache_capacity` schemas.
+class SchemaCache {
+public:
+    // Return nullptr if the schema of `schema_key` is not cached
+    std::shared_ptr<const doris::TabletSchemaCloudPB> get(const std::string& schema_key);
+
+    void put(const std::string& schema_key,
+             std::shared_ptr<const doris::TabletSchemaCloudPB> schema);
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<const doris::TabletSchemaCloudPB>>;
+
+    std::mutex mtx_;
+    std::list<Entry> lru_; // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> map_;
+};
+
 } // namespace doris::cloud
@@ -17,10 +17,15 @@
 
 #include "txn_lazy_committer.h"
 
+#include <bthread/countdown_event.h>
+
+#include <algorithm>
 #include <chrono>
+#include <functional>
 
 #include "common/logging.h"
 #include "common/stats.h"
+#include "common/stopwatch.h"
 #include "common/util.h"
 #include "cpp/sync_point.h"
 #include "meta-service/meta_service_helper.h"
@@ -299,14 +304,180 @@ TxnLazyCommitTask::TxnLazyCommitTask(const std::string& instance_id, int64_t txn
     DCHECK(txn_id > 0);
 }
 
-void TxnLazyCommitTask::commit() {
+void TxnLazyCommitTask::commit_partition(
+        int64_t db_id, int64_t partition_id,
+        std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+        MetaServiceCode& code, std::string& msg) {
     std::stringstream ss;
+    // tablet_id -> TabletIndexPB
+    std::unordered_map<int64_t, TabletIndexPB> tablet_ids;
+    // Each batch is converted in a kv txn, which puts about the same bytes of the rowset metas
+    // as the tmp rowset metas, so the bytes are bounded by max_txn_commit_byte too
+    auto max_rowsets_per_batch =
+            static_cast<size_t>(std::max(config::txn_lazy_max_rowsets_per_batch, 1));
+    for (size_t i = 0; i < tmp_rowset_metas.size();) {
+        size_t end = i;
+        int64_t batch_bytes = 0;
+        while (end < tmp_rowset_metas.size() && end - i < max_rowsets_per_batch) {
+            auto& [tmp_rowset_key, tmp_rowset_pb] = tmp_rowset_metas[end];
+            auto bytes = static_cast<int64_t>(tmp_rowset_key.size() + tmp_rowset_pb.ByteSizeLong());
+            if (end > i && batch_bytes + bytes > config::max_txn_commit_byte) {
+                break;
+            }
+            batch_bytes += bytes;
+            ++end;
+        }
+        std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
+                sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + i,
+                                               tmp_rowset_metas.begin() + end);
+        convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code, msg, db_id,
+                            sub_partition_tmp_rowset_metas, tablet_ids);
+        if (code != MetaServiceCode::OK) return;
+        i = end;
+    }
+
+    std::unique_ptr<Transaction> txn;
+    TxnErrorCode err = txn_kv_->create_txn(&txn);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::CREATE>(err);
+        ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+
+    int64_t table_id = -1;
+    DCHECK(tmp_rowset_metas.size() > 0);
+    if (tablet_ids.size() > 0) {
+        // get table_id from memory cache
+        table_id = tablet_ids.begin()->second.table_id();
+    } else {
+        // get table_id from storage
+        int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
+        std::string tablet_idx_key = meta_tablet_idx_key({instance_id_, first_tablet_id});
+        std::string tablet_idx_val;
+        err = txn->get(tablet_idx_key, &tablet_idx_val, true);
+        if (TxnErrorCode::TXN_OK != err) {
+            code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                                          : cast_as<ErrCategory::READ>(err);
+            ss << "failed to get tablet idx, txn_id=" << txn_id_
+               << " key=" << hex(tablet_idx_key) << " err=" << err;
+            msg = ss.str();
+            LOG(WARNING) << msg;
+            return;
+        }
+
+        TabletIndexPB tablet_idx_pb;
+        if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
+            code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+            ss << "failed to parse tablet idx pb txn_id=" << txn_id_
+               << " key=" << hex(tablet_idx_key);
+            msg = ss.str();
+            return;
+        }
+        table_id = tablet_idx_pb.table_id();
+    }
+
+    DCHECK(table_id > 0);
+    DCHECK(partition_id > 0);
+
+    std::string ver_val;
+    std::string ver_key = partition_version_key({instance_id_, db_id, table_id, partition_id});
+    err = txn->get(ver_key, &ver_val);
+    if (TxnErrorCode::TXN_OK != err) {
+        code = err == TxnErrorCode::TXN_KEY_NOT_FOUND ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                                      : cast_as<ErrCategory::READ>(err);
+        ss << "failed to get partiton version, txn_id=" << txn_id_ << " key=" << hex(ver_key)
+           << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+    VersionPB version_pb;
+    if (!version_pb.ParseFromString(ver_val)) {
+        code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+        ss << "failed to parse version pb txn_id=" << txn_id_ << " key=" << hex(ver_key);
+        msg = ss.str();
+        return;
+    }
+
+    if (version_pb.pending_txn_ids_size() > 0 && version_pb.pending_txn_ids(0) == txn_id_) {
+        DCHECK(version_pb.pending_txn_ids_size() == 1);
+        version_pb.clear_pending_txn_ids();
+        ver_val.clear();
+
+        if (version_pb.has_version()) {
+            version_pb.set_version(version_pb.version() + 1);
+        } else {
+            // first commit txn version is 2
+            version_pb.set_version(2);
+        }
+        if (!version_pb.SerializeToString(&ver_val)) {
+            code = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
+            ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
+            msg = ss.str();
+            return;
+        }
+        txn->put(ver_key, ver_val);
+        LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
+                  << " version_pb=" << version_pb.ShortDebugString();
+
+        for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
+            txn->remove(tmp_rowset_key);
+            LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key) << " txn_id=" << txn_id_;
+        }
+
+        err = txn->commit();
+        if (err != TxnErrorCode::TXN_OK) {
+            code = cast_as<ErrCategory::COMMIT>(err);
+            ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
+            msg = ss.str();
+            return;
+        }
+    }
+}
+
+void TxnLazyCommitTask::commit_partitions(
+        int64_t db_id,
+        std::unordered_map<int64_t,
+                           std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                partition_to_tmp_rowset_metas) {
+    // The partitions have their own versions and rowsets, so they are committed in parallel
+    std::vector<std::pair<MetaServiceCode, std::string>> results(
+            partition_to_tmp_rowset_metas.size(), {MetaServiceCode::OK, ""});
+    bthread::CountdownEvent event(static_cast<int>(partition_to_tmp_rowset_metas.size()));
+    size_t i = 0;
+    for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
+        auto* result = &results[i++];
+        std::function<void()> commit_func = [this, &event, db_id, partition_id = partition_id,
+                                             metas = &tmp_rowset_metas, result]() {
+            commit_partition(db_id, partition_id, *metas, result->first, result->second);
+            event.signal();
+        };
+        if (partition_to_tmp_rowset_metas.size() == 1 ||
+            txn_lazy_committer_->partition_pool_->submit(commit_func) != 0) {
+            commit_func();
+        }
+    }
+    event.wait();
+
+    for (auto& [code, msg] : results) {
+        if (code != MetaServiceCode::OK) {
+            code_ = code;
+            msg_ = std::move(msg);
+            return;
+        }
+    }
+}
+
+void TxnLazyCommitTask::commit() {
     int retry_times = 0;
     do {
         LOG(INFO) << "lazy task commit txn_id=" << txn_id_ << " retry_times=" << retry_times;
         do {
             code_ = MetaServiceCode::OK;
             msg_.clear();
+            StopWatch sw;
             int64_t db_id;
             std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>> all_tmp_rowset_metas;
             scan_tmp_rowset(instance_id_, txn_id_, txn_kv_, code_, msg_, &db_id,
@@ -315,6 +486,7 @@ void TxnLazyCommitTask::commit() {
                 LOG(WARNING) << "scan_tmp_rowset failed, txn_id=" << txn_id_ << " code=" << code_;
                 break;
             }
+            int64_t scan_cost_us = sw.elapsed_us();
 
             VLOG_DEBUG << "txn_id=" << txn_id_
                        << " tmp_rowset_metas.size()=" << all_tmp_rowset_metas.size();
@@ -326,146 +498,28 @@ void TxnLazyCommitTask::commit() {
             std::unordered_map<int64_t,
                                std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>
                     partition_to_tmp_rowset_metas;
-            for (auto& [tmp_rowset_key, tmp_rowset_pb] : all_tmp_rowset_metas) {
-                partition_to_tmp_rowset_metas[tmp_rowset_pb.partition_id()].emplace_back();
-                partition_to_tmp_rowset_metas[tmp_rowset_pb.partition_id()].back().first =
-                        tmp_rowset_key;
-                partition_to_tmp_rowset_metas[tmp_rowset_pb.partition_id()].back().second =
-                        tmp_rowset_pb;
+            for (auto& tmp_rowset_meta : all_tmp_rowset_metas) {
+                int64_t partition_id = tmp_rowset_meta.second.partition_id();
+                partition_to_tmp_rowset_metas[partition_id].emplace_back(
+                        std::move(tmp_rowset_meta));
             }
 
-            // tablet_id -> TabletIndexPB
-            std::unordered_map<int64_t, TabletIndexPB> tablet_ids;
-            for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
-                for (size_t i = 0; i < tmp_rowset_metas.size();
-                     i += config::txn_lazy_max_rowsets_per_batch) {
-                    size_t end =
-                            (i + config::txn_lazy_max_rowsets_per_batch) > tmp_rowset_metas.size()
-                                    ? tmp_rowset_metas.size()
-                                    : i + config::txn_lazy_max_rowsets_per_batch;
-                    std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
-                            sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + i,
-                                                           tmp_rowset_metas.begin() + end);
-                    convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code_, msg_, db_id,
-                                        sub_partition_tmp_rowset_metas, tablet_ids);
-                    if (code_ != MetaServiceCode::OK) break;
-                }
-                if (code_ != MetaServiceCode::OK) break;
-
-                std::unique_ptr<Transaction> txn;
-                TxnErrorCode err = txn_kv_->create_txn(&txn);
-                if (err != TxnErrorCode::TXN_OK) {
-                    code_ = cast_as<ErrCategory::CREATE>(err);
-                    ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-
-                int64_t table_id = -1;
-                DCHECK(tmp_rowset_metas.size() > 0);
-                if (table_id <= 0) {
-                    if (tablet_ids.size() > 0) {
-                        // get table_id from memory cache
-                        table_id = tablet_ids.begin()->second.table_id();
-                    } else {
-                        // get table_id from storage
-                        int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
-                        std::string tablet_idx_key =
-                                meta_tablet_idx_key({instance_id_, first_tablet_id});
-                        std::string tablet_idx_val;
-                        err = txn->get(tablet_idx_key, &tablet_idx_val, true);
-                        if (TxnErrorCode::TXN_OK != err) {
-                            code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                            ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                            : cast_as<ErrCategory::READ>(err);
-                            ss << "failed to get tablet idx, txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key) << " err=" << err;
-                            msg_ = ss.str();
-                            LOG(WARNING) << msg_;
-                            break;
-                        }
-
-                        TabletIndexPB tablet_idx_pb;
-                        if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
-                            code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                            ss << "failed to parse tablet idx pb txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key);
-                            msg_ = ss.str();
-                            break;
-                        }
-                        table_id = tablet_idx_pb.table_id();
-                    }
-                }
-
-                DCHECK(table_id > 0);
-                DCHECK(partition_id > 0);
-
-                std::string ver_val;
-                std::string ver_key =
-                        partition_version_key({instance_id_, db_id, table_id, partition_id});
-                err = txn->get(ver_key, &ver_val);
-                if (TxnErrorCode::TXN_OK != err) {
-                    code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                    ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                    : cast_as<ErrCategory::READ>(err);
-                    ss << "failed to get partiton version, txn_id=" << txn_id_
-                       << " key=" << hex(ver_key) << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-                VersionPB version_pb;
-                if (!version_pb.ParseFromString(ver_val)) {
-                    code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                    ss << "failed to parse version pb txn_id=" << txn_id_
-                       << " key=" << hex(ver_key);
-                    msg_ = ss.str();
-                    break;
-                }
-
-                if (version_pb.pending_txn_ids_size() > 0 &&
-                    version_pb.pending_txn_ids(0) == txn_id_) {
-                    DCHECK(version_pb.pending_txn_ids_size() == 1);
-                    version_pb.clear_pending_txn_ids();
-                    ver_val.clear();
-
-                    if (version_pb.has_version()) {
-                        version_pb.set_version(version_pb.version() + 1);
-                    } else {
-                        // first commit txn version is 2
-                        version_pb.set_version(2);
-                    }
-                    if (!version_pb.SerializeToString(&ver_val)) {
-                        code_ = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
-                        ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
-                        msg_ = ss.str();
-                        break;
-                    }
-                    txn->put(ver_key, ver_val);
-                    LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
-                              << " version_pb=" << version_pb.ShortDebugString();
-
-                    for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
-                        txn->remove(tmp_rowset_key);
-                        LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key)
-                                  << " txn_id=" << txn_id_;
-                    }
-
-                    err = txn->commit();
-                    if (err != TxnErrorCode::TXN_OK) {
-                        code_ = cast_as<ErrCategory::COMMIT>(err);
-                        ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
-                        msg_ = ss.str();
-                        break;
-                    }
-                }
-            }
+            commit_partitions(db_id, partition_to_tmp_rowset_metas);
             if (code_ != MetaServiceCode::OK) {
                 LOG(WARNING) << "txn_id=" << txn_id_ << " code=" << code_ << " msg=" << msg_;
                 break;
             }
+            int64_t commit_partitions_cost_us = sw.elapsed_us() - scan_cost_us;
+
             make_committed_txn_visible(instance_id_, db_id, txn_id_, txn_kv_, code_, msg_);
+            LOG(INFO) << "lazy task commit txn_id=" << txn_id_
+                      << " num_tmp_rowsets=" << all_tmp_rowset_metas.size()
+                      << " num_partitions=" << partition_to_tmp_rowset_metas.size()
+                      << " scan_cost_us=" << scan_cost_us
+                      << " commit_partitions_cost_us=" << commit_partitions_cost_us
+                      << " make_visible_cost_us="
+                      << sw.elapsed_us() - scan_cost_us - commit_partitions_cost_us
+                      << " code=" << code_;
         } while (false);
     } while (code_ == MetaServiceCode::KV_TXN_CONFLICT &&
              retry_times++ < config::txn_store_retry_times);
@@ -504,6 +558,9 @@ TxnLazyCommitter::TxnLazyCommitter(std::shared_ptr<TxnKv> txn_kv) : txn_kv_(txn_
     worker_pool_ = std::make_unique<SimpleThreadPool>(config::txn_lazy_commit_num_threads,
                                                       "txn_lazy_commiter");
     worker_pool_->start();
+    partition_pool_ = std::make_unique<SimpleThreadPool>(
+            config::txn_lazy_commit_partition_num_threads, "txn_lazy_partition");
+    partition_pool_->start();
 }
 
 /**
@@ -39,6 +39,19 @@ public:
 private:
     friend class TxnLazyCommitter;
 
+    // Convert the tmp rowsets of a partition in batches, then bump the partition version
+    void commit_partition(
+            int64_t db_id, int64_t partition_id,
+            std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+            MetaServiceCode& code, std::string& msg);
+
+    // Set code_ and msg_ to the first failure of the partitions
+    void commit_partitions(
+            int64_t db_id,
+            std::unordered_map<int64_t,
+                               std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                    partition_to_tmp_rowset_metas);
+
     std::string instance_id_;
     int64_t txn_id_;
     std::shared_ptr<TxnKv> txn_kv_;
@@ -57,9 +70,13 @@ public:
     void remove(int64_t txn_id);
 
 private:
+    friend class TxnLazyCommitTask;
+
     std::shared_ptr<TxnKv> txn_kv_;
 
     std::unique_ptr<SimpleThreadPool> worker_pool_;
+    // runs the partitions of the tasks in worker_pool_
+    std::unique_ptr<SimpleThreadPool> partition_pool_;
 
     std::mutex mutex_;
     // <txn_id, TxnLazyCommitTask>
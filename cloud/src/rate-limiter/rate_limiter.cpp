@@ -67,14 +67,20 @@ void for_each_rpc_name(google::protobuf::Service* service, Callable cb) {
 
 void RateLimiter::init(google::protobuf::Service* service) {
     auto rpc_name_to_specific_limit = parse_specific_qps_limit(config::specific_max_qps_limit);
+    std::vector<std::string> low_priority_rpc_names;
+    butil::SplitString(config::low_priority_rpc_names, ';', &low_priority_rpc_names);
     std::unique_lock write_lock(mutex_);
+    overload_detector_ = std::make_shared<TxnKvOverloadDetector>();
     for_each_rpc_name(service, [&](const std::string& rpc_name) {
         auto it = rpc_name_to_specific_limit.find(rpc_name);
         int64_t max_qps_limit = config::default_max_qps_limit;
         if (it != rpc_name_to_specific_limit.end()) {
             max_qps_limit = it->second;
         }
-        limiters_[rpc_name] = std::make_shared<RpcRateLimiter>(rpc_name, max_qps_limit);
+        bool low_priority = std::ranges::find(low_priority_rpc_names, rpc_name) !=
+                            low_priority_rpc_names.end();
+        limiters_[rpc_name] = std::make_shared<RpcRateLimiter>(
+                rpc_name, max_qps_limit, low_priority ? overload_detector_ : nullptr);
     });
     for (const auto& [k, _] : rpc_name_to_specific_limit) {
         rpc_with_specific_limit_.insert(k);
@@ -151,7 +157,9 @@ bool RpcRateLimiter::get_qps_token(const std::string& instance_id,
         qps_token = it->second;
     }
 
-    return qps_token->get_token(get_bvar_qps);
+    return qps_token->get_token(get_bvar_qps, config::enable_adaptive_rate_limit
+                                                      ? overload_detector_.get()
+                                                      : nullptr);
 }
 
 void RpcRateLimiter::set_max_qps_limit(int64_t max_qps_limit) {
@@ -183,7 +191,34 @@ void RpcRateLimiter::for_each_qps_token(
     }
 }
 
-bool RpcRateLimiter::QpsToken::get_token(std::function<int()>& get_bvar_qps) {
+bool TxnKvOverloadDetector::is_overloaded() {
+    using namespace std::chrono;
+    auto now = steady_clock::now();
+    std::lock_guard<bthread::Mutex> l(mutex_);
+    auto duration_s = duration_cast<seconds>(now - last_update_time_).count();
+    if (duration_s <= config::bvar_qps_update_second) {
+        return overloaded_;
+    }
+    int64_t conflict_count = g_bvar_txn_kv_commit_conflict_counter.get_value();
+    int64_t conflicts_per_second =
+            duration_s > 0 ? (conflict_count - last_conflict_count_) / duration_s : 0;
+    bool overloaded =
+            g_bvar_txn_kv_commit.latency() > config::adaptive_rate_limit_txn_kv_commit_latency_us ||
+            conflicts_per_second > config::adaptive_rate_limit_txn_kv_conflicts_per_second;
+    if (overloaded != overloaded_) {
+        LOG(INFO) << "txn kv overloaded=" << overloaded
+                  << " commit_latency_us=" << g_bvar_txn_kv_commit.latency()
+                  << " conflicts_per_second=" << conflicts_per_second;
+        g_bvar_rate_limiter_txn_kv_overloaded.set_value(overloaded);
+    }
+    overloaded_ = overloaded;
+    last_conflict_count_ = conflict_count;
+    last_update_time_ = now;
+    return overloaded_;
+}
+
+bool RpcRateLimiter::QpsToken::get_token(std::function<int()>& get_bvar_qps,
+                                         TxnKvOverloadDetector* overload_detector) {
     using namespace std::chrono;
     auto now = steady_clock::now();
     std::lock_guard<bthread::Mutex> l(mutex_);
@@ -196,6 +231,20 @@ bool RpcRateLimiter::QpsToken::get_token(std::function<int()>& get_bvar_qps) {
         access_count_ = 0;
         last_update_time_ = now;
         current_qps_ = get_bvar_qps();
+        if (overload_detector != nullptr) {
+            // AIMD, so the heavy instances are cut more than the light ones
+            if (overload_detector->is_overloaded()) {
+                adaptive_qps_limit_ = std::max(std::min(adaptive_qps_limit_, current_qps_) / 2,
+                                               config::adaptive_rate_limit_min_qps);
+            } else {
+                adaptive_qps_limit_ = std::min(
+                        adaptive_qps_limit_ + config::adaptive_rate_limit_qps_increase,
+                        max_qps_limit_);
+            }
+        }
+    }
+    if (overload_detector != nullptr) {
+        return current_qps_ < std::min(adaptive_qps_limit_, max_qps_limit_);
     }
     return current_qps_ < max_qps_limit_;
 }
@@ -203,6 +252,7 @@ bool RpcRateLimiter::QpsToken::get_token(std::function<int()>& get_bvar_qps) {
 void RpcRateLimiter::QpsToken::set_max_qps_limit(int64_t max_qps_limit) {
     std::lock_guard<bthread::Mutex> l(mutex_);
     max_qps_limit_ = max_qps_limit;
+    adaptive_qps_limit_ = max_qps_limit;
 }
 
 } // namespace doris::cloud
@@ -21,6 +21,7 @@
 #include <bthread/mutex.h>
 #include <google/protobuf/service.h>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <shared_mutex>
@@ -33,6 +34,7 @@
 namespace doris::cloud {
 
 class RpcRateLimiter;
+class TxnKvOverloadDetector;
 
 class RateLimiter {
 public:
@@ -86,12 +88,32 @@ private:
     // rpc names which specific limit have been set
     std::unordered_set<std::string> rpc_with_specific_limit_;
     bthread::Mutex mutex_;
+    // shared by the limiters of the low priority rpcs
+    std::shared_ptr<TxnKvOverloadDetector> overload_detector_;
+};
+
+// Detects the overload of the txn kv by the avg commit latency and the commit conflicts, the result
+// is refreshed at most once per `bvar_qps_update_second`.
+class TxnKvOverloadDetector {
+public:
+    bool is_overloaded();
+
+private:
+    bthread::Mutex mutex_;
+    std::chrono::steady_clock::time_point last_update_time_;
+    int64_t last_conflict_count_ {0};
+    bool overloaded_ {false};
 };
 
 class RpcRateLimiter {
 public:
-    RpcRateLimiter(const std::string rpc_name, const int64_t max_qps_limit)
-            : rpc_name_(rpc_name), max_qps_limit_(max_qps_limit) {}
+    // The qps limits of the instances adapt to the load of the txn kv if `overload_detector` is
+    // set, see `enable_adaptive_rate_limit`
+    RpcRateLimiter(const std::string rpc_name, const int64_t max_qps_limit,
+                   std::shared_ptr<TxnKvOverloadDetector> overload_detector = nullptr)
+            : rpc_name_(rpc_name),
+              max_qps_limit_(max_qps_limit),
+              overload_detector_(std::move(overload_detector)) {}
 
     ~RpcRateLimiter() = default;
 
@@ -123,20 +145,27 @@ public:
 
     class QpsToken {
     public:
-        QpsToken(const int64_t max_qps_limit) : max_qps_limit_(max_qps_limit) {}
+        QpsToken(const int64_t max_qps_limit)
+                : max_qps_limit_(max_qps_limit), adaptive_qps_limit_(max_qps_limit) {}
 
-        bool get_token(std::function<int()>& get_bvar_qps);
+        // Adapt the limit to the load of the txn kv if `overload_detector` is not nullptr
+        bool get_token(std::function<int()>& get_bvar_qps,
+                       TxnKvOverloadDetector* overload_detector = nullptr);
 
         void set_max_qps_limit(int64_t max_qps_limit);
 
         int64_t max_qps_limit() const { return max_qps_limit_; }
 
+        int64_t adaptive_qps_limit() const { return adaptive_qps_limit_; }
+
     private:
         bthread::Mutex mutex_;
         std::chrono::steady_clock::time_point last_update_time_;
         int64_t access_count_ {0};
         int64_t current_qps_ {0};
         int64_t max_qps_limit_;
+        // <= max_qps_limit_, only used by the low priority rpcs
+        int64_t adaptive_qps_limit_;
     };
 
     void for_each_qps_token(std::function<void(std::string_view, std::shared_ptr<QpsToken>)> cb);
@@ -151,6 +180,7 @@ private:
     std::unordered_set<std::string> instance_with_specific_limit_;
     std::string rpc_name_;
     int64_t max_qps_limit_;
+    std::shared_ptr<TxnKvOverloadDetector> overload_detector_;
 };
 
 } // namespace doris::cloud
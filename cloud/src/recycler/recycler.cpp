@@ -1708,8 +1708,9 @@ int InstanceRecycler::delete_rowset_data(
         const std::map<std::string, doris::RowsetMetaCloudPB>& rowsets, RowsetRecyclingState type,
         RecyclerMetricsContext& metrics_context) {
     int ret = 0;
-    // resource_id -> file_paths
-    std::map<std::string, std::vector<std::string>> resource_file_paths;
+    // resource_id -> batches of file_paths, the files of a rowset are in the same batch
+    std::map<std::string, std::vector<std::vector<std::string>>> resource_file_paths;
+    auto batch_size = static_cast<size_t>(std::max(config::recycle_delete_files_batch_size, 1));
     // (resource_id, tablet_id, rowset_id)
     std::vector<std::tuple<std::string, int64_t, std::string>> rowsets_delete_by_prefix;
     bool is_formal_rowset = (type == RowsetRecyclingState::FORMAL_ROWSET);
@@ -1734,7 +1735,7 @@ int InstanceRecycler::delete_rowset_data(
             continue;
         }
 
-        auto& file_paths = resource_file_paths[rs.resource_id()];
+        auto& batches = resource_file_paths[rs.resource_id()];
         const auto& rowset_id = rs.rowset_id_v2();
         int64_t tablet_id = rs.tablet_id();
         int64_t num_segments = rs.num_segments();
@@ -1803,6 +1804,10 @@ int InstanceRecycler::delete_rowset_data(
             rowsets_delete_by_prefix.emplace_back(rs.resource_id(), tablet_id, rs.rowset_id_v2());
             continue;
         }
+        if (batches.empty() || batches.back().size() >= batch_size) {
+            batches.emplace_back();
+        }
+        auto& file_paths = batches.back();
         for (int64_t i = 0; i < num_segments; ++i) {
             file_paths.push_back(segment_path(tablet_id, rowset_id, i));
             if (index_format == InvertedIndexStorageFormatPB::V1) {
@@ -1828,57 +1833,82 @@ int InstanceRecycler::delete_rowset_data(
     SyncExecutor<int> concurrent_delete_executor(_thread_pool_group.s3_producer_pool,
                                                  "delete_rowset_data",
                                                  [](const int& ret) { return ret != 0; });
-    for (auto& [resource_id, file_paths] : resource_file_paths) {
-        concurrent_delete_executor.add([&, rid = &resource_id, paths = &file_paths]() -> int {
-            DCHECK(accessor_map_.count(*rid))
-                    << "uninitilized accessor, instance_id=" << instance_id_
-                    << " resource_id=" << resource_id << " path[0]=" << (*paths)[0];
-            TEST_SYNC_POINT_CALLBACK("InstanceRecycler::delete_rowset_data.no_resource_id",
-                                     &accessor_map_);
-            if (!accessor_map_.contains(*rid)) {
-                LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
-                        .tag("resource_id", resource_id)
-                        .tag("instance_id", instance_id_);
-                return -1;
+    auto count_recycled = [&metrics_context, &rowsets,
+                           this](const std::vector<std::string>& paths) {
+        // deduplication of different files with the same rowset id
+        // 020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.dat
+        //020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.idx
+        std::set<std::string> deleted_rowset_id;
+
+        std::for_each(paths.begin(), paths.end(), [&](const std::string& path) {
+            std::vector<std::string> str;
+            butil::SplitString(path, '/', &str);
+            std::string rowset_id;
+            if (auto pos = str.back().find('_'); pos != std::string::npos) {
+                rowset_id = str.back().substr(0, pos);
+            } else {
+                LOG(WARNING) << "failed to parse rowset_id, path=" << path;
+                return;
             }
-            auto& accessor = accessor_map_[*rid];
-            int ret = accessor->delete_files(*paths);
-            if (!ret) {
-                // deduplication of different files with the same rowset id
-                // 020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.dat
-                //020000000000007fd045a62bc87a6587dd7ac274aa36e5a9_0.idx
-                std::set<std::string> deleted_rowset_id;
-
-                std::for_each(
-                        paths->begin(), paths->end(),
-                        [&metrics_context, &rowsets, &deleted_rowset_id](const std::string& path) {
-                            std::vector<std::string> str;
-                            butil::SplitString(path, '/', &str);
-                            std::string rowset_id;
-                            if (auto pos = str.back().find('_'); pos != std::string::npos) {
-                                rowset_id = str.back().substr(0, pos);
-                            } else {
-                                LOG(WARNING) << "failed to parse rowset_id, path=" << path;
-                                return;
-                            }
-                            auto rs_meta = rowsets.find(rowset_id);
-                            if (rs_meta != rowsets.end() &&
-                                !deleted_rowset_id.contains(rowset_id)) {
-                                deleted_rowset_id.emplace(rowset_id);
-                                metrics_context.total_recycled_data_size +=
-                                        rs_meta->second.total_disk_size();
-                                segment_metrics_context_.total_recycled_num +=
-                                        rs_meta->second.num_segments();
-                                segment_metrics_context_.total_recycled_data_size +=
-                                        rs_meta->second.total_disk_size();
-                                metrics_context.total_recycled_num++;
-                            }
-                        });
-                segment_metrics_context_.report();
-                metrics_context.report();
+            auto rs_meta = rowsets.find(rowset_id);
+            if (rs_meta != rowsets.end() && !deleted_rowset_id.contains(rowset_id)) {
+                deleted_rowset_id.emplace(rowset_id);
+                metrics_context.total_recycled_data_size += rs_meta->second.total_disk_size();
+                segment_metrics_context_.total_recycled_num += rs_meta->second.num_segments();
+                segment_metrics_context_.total_recycled_data_size +=
+                        rs_meta->second.total_disk_size();
+                metrics_context.total_recycled_num++;
             }
-            return ret;
         });
+        segment_metrics_context_.report();
+        metrics_context.report();
+    };
+    // The batches of a resource are deleted by at most `recycle_delete_files_parallelism_per_vault`
+    // tasks, each of them takes the next batch until all of them are deleted
+    std::vector<std::unique_ptr<std::atomic<size_t>>> next_batches;
+    auto parallelism = static_cast<size_t>(
+            std::max(config::recycle_delete_files_parallelism_per_vault, 1));
+    for (auto& [resource_id, batches] : resource_file_paths) {
+        auto* next_batch =
+                next_batches.emplace_back(std::make_unique<std::atomic<size_t>>(0)).get();
+        for (size_t i = 0; i < std::min(batches.size(), parallelism); ++i) {
+            concurrent_delete_executor.add([&, rid = &resource_id, all_paths = &batches,
+                                            next_batch]() -> int {
+                DCHECK(accessor_map_.count(*rid))
+                        << "uninitilized accessor, instance_id=" << instance_id_
+                        << " resource_id=" << *rid << " path[0]=" << all_paths->front()[0];
+                TEST_SYNC_POINT_CALLBACK("InstanceRecycler::delete_rowset_data.no_resource_id",
+                                         &accessor_map_);
+                if (!accessor_map_.contains(*rid)) {
+                    LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
+                            .tag("resource_id", *rid)
+                            .tag("instance_id", instance_id_);
+                    return -1;
+                }
+                auto& accessor = accessor_map_[*rid];
+                g_bvar_recycler_vault_recycle_task_concurrency.put(
+                        {instance_id_, metrics_context.operation_type, *rid}, 1);
+                int ret = 0;
+                for (size_t batch = (*next_batch)++; batch < all_paths->size();
+                     batch = (*next_batch)++) {
+                    const auto& paths = (*all_paths)[batch];
+                    StopWatch sw;
+                    if (accessor->delete_files(paths) != 0) {
+                        // go on with the other batches, the failed ones are retried next round
+                        ret = -1;
+                        continue;
+                    }
+                    g_bvar_recycler_vault_deleted_files_num.put({instance_id_, *rid},
+                                                                paths.size());
+                    g_bvar_recycler_vault_delete_files_cost_us.put({instance_id_, *rid},
+                                                                   sw.elapsed_us());
+                    count_recycled(paths);
+                }
+                g_bvar_recycler_vault_recycle_task_concurrency.put(
+                        {instance_id_, metrics_context.operation_type, *rid}, -1);
+                return ret;
+            });
+        }
     }
     for (const auto& [resource_id, tablet_id, rowset_id] : rowsets_delete_by_prefix) {
         LOG_INFO(
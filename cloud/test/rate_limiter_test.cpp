@@ -26,6 +26,7 @@
 #include <thread>
 
 #include "common/config.h"
+#include "common/defer.h"
 #include "common/util.h"
 #include "meta-service/meta_service.h"
 #include "meta-store/keys.h"
@@ -382,3 +383,38 @@ TEST(RateLimiterTest, AdjustLimitMockRPCTest) {
         ASSERT_EQ(limit, 10000);
     }
 }
+
+TEST(RateLimiterTest, AdaptiveQpsLimitTest) {
+    auto origin_update_second = config::bvar_qps_update_second;
+    auto origin_latency_us = config::adaptive_rate_limit_txn_kv_commit_latency_us;
+    DORIS_CLOUD_DEFER {
+        config::bvar_qps_update_second = origin_update_second;
+        config::adaptive_rate_limit_txn_kv_commit_latency_us = origin_latency_us;
+    };
+    // refresh the qps and the overload on each call
+    config::bvar_qps_update_second = -1;
+
+    TxnKvOverloadDetector detector;
+    RpcRateLimiter::QpsToken token(1000);
+    int qps = 400;
+    std::function<int()> get_bvar_qps = [&] { return qps; };
+    ASSERT_TRUE(token.get_token(get_bvar_qps));
+
+    // overloaded, halved from the current qps
+    config::adaptive_rate_limit_txn_kv_commit_latency_us = -1;
+    ASSERT_FALSE(token.get_token(get_bvar_qps, &detector));
+    ASSERT_EQ(token.adaptive_qps_limit(), 200);
+    ASSERT_FALSE(token.get_token(get_bvar_qps, &detector));
+    ASSERT_EQ(token.adaptive_qps_limit(), 100);
+    // the static limit is used without the detector
+    ASSERT_TRUE(token.get_token(get_bvar_qps));
+
+    // recovered, increased additively
+    config::adaptive_rate_limit_txn_kv_commit_latency_us = 1L << 40;
+    qps = 150;
+    ASSERT_TRUE(token.get_token(get_bvar_qps, &detector));
+    ASSERT_EQ(token.adaptive_qps_limit(), 100 + config::adaptive_rate_limit_qps_increase);
+
+    token.set_max_qps_limit(1000);
+    ASSERT_EQ(token.adaptive_qps_limit(), 1000);
+}
@@ -27,6 +27,7 @@
 #include "common/defer.h"
 #include "cpp/sync_point.h"
 #include "meta-service/meta_service.h"
+#include "meta-service/meta_service_schema.h"
 #include "meta-store/keys.h"
 #include "meta-store/txn_kv.h"
 #include "meta-store/txn_kv_error.h"
@@ -814,4 +815,33 @@ TEST(AlterSchemaKVTest, AlterDisableAutoCompactionTest) {
     }
 }
 
+TEST(SchemaCacheTest, LruTest) {
+    auto origin_capacity = config::schema_cache_capacity;
+    DORIS_CLOUD_DEFER {
+        config::schema_cache_capacity = origin_capacity;
+    };
+    config::schema_cache_capacity = 2;
+    SchemaCache cache;
+    auto make_schema = [](int32_t schema_version) {
+        auto schema = std::make_shared<doris::TabletSchemaCloudPB>();
+        fill_schema(schema.get(), schema_version);
+        return schema;
+    };
+    EXPECT_EQ(cache.get("key1"), nullptr);
+    cache.put("key1", make_schema(1));
+    cache.put("key2", make_schema(2));
+    ASSERT_NE(cache.get("key1"), nullptr);
+    EXPECT_EQ(cache.get("key1")->schema_version(), 1);
+    // key2 is the least recently used one
+    cache.put("key3", make_schema(3));
+    EXPECT_EQ(cache.get("key2"), nullptr);
+    EXPECT_NE(cache.get("key1"), nullptr);
+    EXPECT_NE(cache.get("key3"), nullptr);
+
+    config::schema_cache_capacity = 0;
+    cache.put("key4", make_schema(4));
+    EXPECT_EQ(cache.get("key1"), nullptr);
+    EXPECT_EQ(cache.get("key4"), nullptr);
+}
+
 } // namespace doris::cloud